@@ -31,6 +31,15 @@ const METAL_INCS: &[(&str, &str)] = &[
     ("fp4.h", include_str!("../kernels/metal/fp4.h")),
 ];
 
+/// Rust target features the C++ kernels have dedicated code paths for, with
+/// the compiler flag that enables each of them.
+const CPP_TARGET_FEATURES: &[(&str, &str)] = &[
+    ("sse4.1", "-msse4.1"),
+    ("avx2", "-mavx2"),
+    ("avx512f", "-mavx512f"),
+    ("sha", "-msha"),
+];
+
 #[derive(Eq, PartialEq, Hash)]
 pub enum KernelType {
     Cpp,
@@ -122,10 +131,19 @@ impl KernelBuild {
     fn compile_cpp(&mut self, output: &str) {
         // It's *highly* recommended to install `sccache` and use this combined with
         // `RUSTC_WRAPPER=/path/to/sccache` to speed up rebuilds of C++ kernels
-        cc::Build::new()
+        let mut build = cc::Build::new();
+        for flag in self.flags.iter() {
+            build.flag(flag);
+        }
+        for flag in cpp_target_feature_flags() {
+            build.flag_if_supported(flag);
+        }
+        build
             .cpp(true)
             .debug(false)
+            .define("NDEBUG", None)
             .files(&self.files)
+            .includes(&self.inc_dirs)
             .flag_if_supported("/std:c++17")
             .flag_if_supported("-std=c++17")
             .flag_if_supported("-fno-var-tracking")
@@ -259,6 +277,27 @@ impl KernelBuild {
     }
 }
 
+/// Returns the flags that enable the [CPP_TARGET_FEATURES] the crate is being
+/// built for.
+///
+/// The C++ kernels are built for the same target features as the Rust code,
+/// so building with `RUSTFLAGS="-C target-cpu=native"` (or e.g.
+/// `-C target-feature=+avx2`) also builds their AVX2, AVX-512 and SHA code
+/// paths.  By default only the portable ones are built.
+fn cpp_target_feature_flags() -> Vec<&'static str> {
+    let arch = env::var("CARGO_CFG_TARGET_ARCH").unwrap_or_default();
+    if arch != "x86_64" && arch != "x86" {
+        return Vec::new();
+    }
+    let features = env::var("CARGO_CFG_TARGET_FEATURE").unwrap_or_default();
+    let features: Vec<&str> = features.split(',').collect();
+    CPP_TARGET_FEATURES
+        .iter()
+        .filter(|(feature, _)| features.contains(feature))
+        .map(|(_, flag)| *flag)
+        .collect()
+}
+
 fn risc0_cache() -> PathBuf {
     directories::ProjectDirs::from("com.risczero", "RISC Zero", "risc0")
         .unwrap()
@@ -29,13 +29,29 @@ fn main() {
 }
 
 fn build_cpu_kernels() {
+    // fp.h, fp4.h and fpvec.h come from risc0-sys.
+    let include = env::var("DEP_RISC0_SYS_INCLUDE").unwrap();
+
     let srcs: Vec<PathBuf> = glob::glob("cxx/*.cpp")
         .unwrap()
         .map(|x| x.unwrap())
         .collect();
     KernelBuild::new(KernelType::Cpp)
+        .include(&include)
         .files(&srcs)
         .compile("circuit");
+
+    // The step functions once more, keeping the register checks, for
+    // `risc0_circuit_recursion_set_checked`.
+    let steps: Vec<PathBuf> = glob::glob("cxx/step_*.cpp")
+        .unwrap()
+        .map(|x| x.unwrap())
+        .collect();
+    KernelBuild::new(KernelType::Cpp)
+        .include(&include)
+        .files(&steps)
+        .flag("-DRISC0_CIRCUIT_CHECKED")
+        .compile("circuit_checked");
 }
 
 fn build_metal_kernels() {
@@ -16,8 +16,9 @@
 #include "fp.h"
 #include "fp4.h"
 
+#include <atomic>
 #include <cstdint>
-#include <stdexcept>
+#include <vector>
 
 using namespace risc0;
 
@@ -29,93 +30,255 @@ extern "C" void risc0_circuit_recursion_string_free(risc0_string* str) {
   delete str;
 }
 
+static const char* externName(ExternId id) {
+  switch (id) {
+  case ExternId::Halt:
+    return "halt";
+  case ExternId::Trace:
+    return "trace";
+  case ExternId::GetMajor:
+    return "getMajor";
+  case ExternId::GetMinor:
+    return "getMinor";
+  case ExternId::Divide:
+    return "divide";
+  case ExternId::BigintQuotient:
+    return "bigintQuotient";
+  case ExternId::PageInfo:
+    return "pageInfo";
+  case ExternId::RamWrite:
+    return "ramWrite";
+  case ExternId::RamRead:
+    return "ramRead";
+  case ExternId::PlonkWrite:
+    return "plonkWrite";
+  case ExternId::PlonkRead:
+    return "plonkRead";
+  case ExternId::PlonkWriteAccum:
+    return "plonkWriteAccum";
+  case ExternId::PlonkReadAccum:
+    return "plonkReadAccum";
+  case ExternId::Log:
+    return "log";
+  case ExternId::SyscallInit:
+    return "syscallInit";
+  case ExternId::SyscallBody:
+    return "syscallBody";
+  case ExternId::SyscallFini:
+    return "syscallFini";
+  case ExternId::WomWrite:
+    return "womWrite";
+  case ExternId::WomRead:
+    return "womRead";
+  case ExternId::ReadIOPHeader:
+    return "readIOPHeader";
+  case ExternId::ReadIOPBody:
+    return "readIOPBody";
+  }
+  // Ids come from the generated code, so this is unreachable; let the host reject it by name.
+  return "unknown";
+}
+
 struct BridgeContext {
   void* ctx;
-  Callback* callback;
+  const HostTable* table;
+  size_t cycle;
 };
 
-static void bridgeCallback(void* ctx,
-                           const char* name,
+static bool bridgeCallback(void* ctx,
+                           ExternId id,
+                           uint32_t extra_id,
                            const char* extra,
                            const Fp* args_ptr,
                            size_t args_len,
                            Fp* outs_ptr,
                            size_t outs_len) {
   BridgeContext* bridgeCtx = reinterpret_cast<BridgeContext*>(ctx);
-  if (!bridgeCtx->callback(bridgeCtx->ctx, name, extra, args_ptr, args_len, outs_ptr, outs_len)) {
-    throw std::runtime_error("Host callback failure");
-  }
+  const HostTable* table = bridgeCtx->table;
+  ExternCallback* fn = table->externs[static_cast<size_t>(id)];
+  size_t cycle = bridgeCtx->cycle;
+  return fn ? fn(bridgeCtx->ctx, cycle, extra_id, extra, args_ptr, args_len, outs_ptr, outs_len)
+            : table->callback(bridgeCtx->ctx,
+                              cycle,
+                              externName(id),
+                              extra,
+                              args_ptr,
+                              args_len,
+                              outs_ptr,
+                              outs_len);
+}
+
+using StepFn = Fp(void*, circuit::recursion::HostBridge, size_t, size_t, Fp**, const char**);
+
+// The fast and the checked build of a step function.
+struct StepVariants {
+  StepFn* fast;
+  StepFn* checked;
+};
+
+static constexpr StepVariants kStepComputeAccum{circuit::recursion::fast::step_compute_accum,
+                                                circuit::recursion::checked::step_compute_accum};
+static constexpr StepVariants kStepVerifyAccum{circuit::recursion::fast::step_verify_accum,
+                                               circuit::recursion::checked::step_verify_accum};
+static constexpr StepVariants kStepExec{circuit::recursion::fast::step_exec,
+                                        circuit::recursion::checked::step_exec};
+static constexpr StepVariants kStepVerifyBytes{circuit::recursion::fast::step_verify_bytes,
+                                               circuit::recursion::checked::step_verify_bytes};
+static constexpr StepVariants kStepVerifyMem{circuit::recursion::fast::step_verify_mem,
+                                             circuit::recursion::checked::step_verify_mem};
+
+// Selects which build of the step functions runs; see risc0_circuit_recursion_set_checked.
+static std::atomic<bool> checkedSteps{false};
+
+extern "C" void risc0_circuit_recursion_set_checked(bool checked) {
+  checkedSteps.store(checked, std::memory_order_relaxed);
+}
+
+std::atomic<bool> circuit::recursion::logExterns{false};
+
+extern "C" void risc0_circuit_recursion_set_log(bool enabled) {
+  circuit::recursion::logExterns.store(enabled, std::memory_order_relaxed);
+}
+
+// Runs the selected build of `variants` over the cycles [begin, end) and returns the result of the
+// last one.  The step functions report failures by status rather than by throwing, so the run
+// stops at the first failing cycle and its message is handed back through `err`.
+static uint32_t stepRange(risc0_error* err,
+                          BridgeContext& bridgeCtx,
+                          const StepVariants& variants,
+                          size_t steps,
+                          size_t begin,
+                          size_t end,
+                          Fp** args) {
+  StepFn* step = checkedSteps.load(std::memory_order_relaxed) ? variants.checked : variants.fast;
+  return ffi_wrap<uint32_t>(err, 0, [&] {
+    Fp result;
+    const char* stepErr = nullptr;
+    for (size_t cycle = begin; cycle < end; cycle++) {
+      bridgeCtx.cycle = cycle;
+      result = step(&bridgeCtx, bridgeCallback, steps, cycle, args, &stepErr);
+      if (stepErr) {
+        err->msg = new risc0_string{stepErr};
+        return uint32_t(0);
+      }
+    }
+    return result.asRaw();
+  });
 }
 
 extern "C" uint32_t risc0_circuit_recursion_step_compute_accum(risc0_error* err,
                                                                void* ctx,
-                                                               Callback callback,
+                                                               const HostTable* table,
                                                                size_t steps,
                                                                size_t cycle,
                                                                Fp** args_ptr,
                                                                size_t /*args_len*/) {
-  return ffi_wrap<uint32_t>(err, 0, [&] {
-    BridgeContext bridgeCtx{ctx, callback};
-    return circuit::recursion::step_compute_accum(
-               &bridgeCtx, bridgeCallback, steps, cycle, args_ptr)
-        .asRaw();
-  });
+  BridgeContext bridgeCtx{ctx, table, cycle};
+  return stepRange(err, bridgeCtx, kStepComputeAccum, steps, cycle, cycle + 1, args_ptr);
+}
+
+extern "C" uint32_t risc0_circuit_recursion_step_compute_accum_range(risc0_error* err,
+                                                                     void* ctx,
+                                                                     const HostTable* table,
+                                                                     size_t steps,
+                                                                     size_t begin,
+                                                                     size_t end,
+                                                                     Fp** args_ptr,
+                                                                     size_t /*args_len*/) {
+  BridgeContext bridgeCtx{ctx, table, begin};
+  return stepRange(err, bridgeCtx, kStepComputeAccum, steps, begin, end, args_ptr);
 }
 
 extern "C" uint32_t risc0_circuit_recursion_step_verify_accum(risc0_error* err,
                                                               void* ctx,
-                                                              Callback callback,
+                                                              const HostTable* table,
                                                               size_t steps,
                                                               size_t cycle,
                                                               Fp** args_ptr,
                                                               size_t /*args_len*/) {
-  return ffi_wrap<uint32_t>(err, 0, [&] {
-    BridgeContext bridgeCtx{ctx, callback};
-    return circuit::recursion::step_verify_accum(&bridgeCtx, bridgeCallback, steps, cycle, args_ptr)
-        .asRaw();
-  });
+  BridgeContext bridgeCtx{ctx, table, cycle};
+  return stepRange(err, bridgeCtx, kStepVerifyAccum, steps, cycle, cycle + 1, args_ptr);
+}
+
+extern "C" uint32_t risc0_circuit_recursion_step_verify_accum_range(risc0_error* err,
+                                                                    void* ctx,
+                                                                    const HostTable* table,
+                                                                    size_t steps,
+                                                                    size_t begin,
+                                                                    size_t end,
+                                                                    Fp** args_ptr,
+                                                                    size_t /*args_len*/) {
+  BridgeContext bridgeCtx{ctx, table, begin};
+  return stepRange(err, bridgeCtx, kStepVerifyAccum, steps, begin, end, args_ptr);
 }
 
 extern "C" uint32_t risc0_circuit_recursion_step_exec(risc0_error* err,
                                                       void* ctx,
-                                                      Callback callback,
+                                                      const HostTable* table,
                                                       size_t steps,
                                                       size_t cycle,
                                                       Fp** args_ptr,
                                                       size_t /*args_len*/) {
-  return ffi_wrap<uint32_t>(err, 0, [&] {
-    BridgeContext bridgeCtx{ctx, callback};
-    return circuit::recursion::step_exec(&bridgeCtx, bridgeCallback, steps, cycle, args_ptr)
-        .asRaw();
-  });
+  BridgeContext bridgeCtx{ctx, table, cycle};
+  return stepRange(err, bridgeCtx, kStepExec, steps, cycle, cycle + 1, args_ptr);
+}
+
+extern "C" uint32_t risc0_circuit_recursion_step_exec_range(risc0_error* err,
+                                                            void* ctx,
+                                                            const HostTable* table,
+                                                            size_t steps,
+                                                            size_t begin,
+                                                            size_t end,
+                                                            Fp** args_ptr,
+                                                            size_t /*args_len*/) {
+  BridgeContext bridgeCtx{ctx, table, begin};
+  return stepRange(err, bridgeCtx, kStepExec, steps, begin, end, args_ptr);
 }
 
 extern "C" uint32_t risc0_circuit_recursion_step_verify_bytes(risc0_error* err,
                                                               void* ctx,
-                                                              Callback callback,
+                                                              const HostTable* table,
                                                               size_t steps,
                                                               size_t cycle,
                                                               Fp** args_ptr,
                                                               size_t /*args_len*/) {
-  return ffi_wrap<uint32_t>(err, 0, [&] {
-    BridgeContext bridgeCtx{ctx, callback};
-    return circuit::recursion::step_verify_bytes(&bridgeCtx, bridgeCallback, steps, cycle, args_ptr)
-        .asRaw();
-  });
+  BridgeContext bridgeCtx{ctx, table, cycle};
+  return stepRange(err, bridgeCtx, kStepVerifyBytes, steps, cycle, cycle + 1, args_ptr);
+}
+
+extern "C" uint32_t risc0_circuit_recursion_step_verify_bytes_range(risc0_error* err,
+                                                                    void* ctx,
+                                                                    const HostTable* table,
+                                                                    size_t steps,
+                                                                    size_t begin,
+                                                                    size_t end,
+                                                                    Fp** args_ptr,
+                                                                    size_t /*args_len*/) {
+  BridgeContext bridgeCtx{ctx, table, begin};
+  return stepRange(err, bridgeCtx, kStepVerifyBytes, steps, begin, end, args_ptr);
 }
 
 extern "C" uint32_t risc0_circuit_recursion_step_verify_mem(risc0_error* err,
                                                             void* ctx,
-                                                            Callback callback,
+                                                            const HostTable* table,
                                                             size_t steps,
                                                             size_t cycle,
                                                             Fp** args_ptr,
                                                             size_t /*args_len*/) {
-  return ffi_wrap<uint32_t>(err, 0, [&] {
-    BridgeContext bridgeCtx{ctx, callback};
-    return circuit::recursion::step_verify_mem(&bridgeCtx, bridgeCallback, steps, cycle, args_ptr)
-        .asRaw();
-  });
+  BridgeContext bridgeCtx{ctx, table, cycle};
+  return stepRange(err, bridgeCtx, kStepVerifyMem, steps, cycle, cycle + 1, args_ptr);
+}
+
+extern "C" uint32_t risc0_circuit_recursion_step_verify_mem_range(risc0_error* err,
+                                                                  void* ctx,
+                                                                  const HostTable* table,
+                                                                  size_t steps,
+                                                                  size_t begin,
+                                                                  size_t end,
+                                                                  Fp** args_ptr,
+                                                                  size_t /*args_len*/) {
+  BridgeContext bridgeCtx{ctx, table, begin};
+  return stepRange(err, bridgeCtx, kStepVerifyMem, steps, begin, end, args_ptr);
 }
 
 #if defined(__clang__)
@@ -123,6 +286,21 @@ extern "C" uint32_t risc0_circuit_recursion_step_verify_mem(risc0_error* err,
 #endif
 
 extern "C" Fp4
-risc0_circuit_recursion_poly_fp(size_t cycle, size_t steps, Fp4* poly_mix, Fp** args) {
-  return circuit::recursion::poly_fp(cycle, steps, poly_mix, args);
+risc0_circuit_recursion_poly_fp(size_t cycle, size_t steps, const Fp4* mix_pows, Fp** args) {
+  return circuit::recursion::poly_fp(cycle, steps, mix_pows, args);
+}
+
+extern "C" void risc0_circuit_recursion_poly_fp_batch(
+    size_t cycle, size_t count, size_t steps, const Fp4* mix_pows, Fp** args, Fp4* out) {
+  size_t i = 0;
+  for (; i + kFpVecLanes <= count; i += kFpVecLanes) {
+    Fp4Vec<kFpVecLanes> tot =
+        circuit::recursion::poly_fp_batch(cycle + i, steps, mix_pows, args);
+    for (size_t lane = 0; lane < kFpVecLanes; lane++) {
+      out[i + lane] = tot.get(lane);
+    }
+  }
+  for (; i < count; i++) {
+    out[i] = circuit::recursion::poly_fp(cycle + i, steps, mix_pows, args);
+  }
 }
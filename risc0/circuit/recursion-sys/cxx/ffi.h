@@ -16,13 +16,65 @@
 
 #include "fp.h"
 #include "fp4.h"
+#include "fpvec.h"
 
+#include <atomic>
 #include <cstdint>
 #include <exception>
 #include <string>
 
+/// Identifiers for the externs emitted by the circuit generator.  These must match
+/// `risc0_zkp::adapter::ExternId`, since the host dispatches on them directly.
+enum class ExternId : uint32_t {
+  Halt = 0,
+  Trace = 1,
+  GetMajor = 2,
+  GetMinor = 3,
+  Divide = 4,
+  BigintQuotient = 5,
+  PageInfo = 6,
+  RamWrite = 7,
+  RamRead = 8,
+  PlonkWrite = 9,
+  PlonkRead = 10,
+  PlonkWriteAccum = 11,
+  PlonkReadAccum = 12,
+  Log = 13,
+  SyscallInit = 14,
+  SyscallBody = 15,
+  SyscallFini = 16,
+  WomWrite = 17,
+  WomRead = 18,
+  ReadIOPHeader = 19,
+  ReadIOPBody = 20,
+};
+
+constexpr size_t kExternCount = 21;
+
+/// Interned identifiers for the 'extra' string argument of an extern.  The plonk kinds match
+/// `risc0_zkp::adapter::ExtraId`; ids starting at kExtraFirstLog name the log formats of this
+/// circuit.
+enum ExtraId : uint32_t {
+  kExtraNone = 0,
+  kExtraBytes = 1,
+  kExtraRam = 2,
+  kExtraWom = 3,
+  kExtraFirstLog = 4,
+};
+
+/// String-keyed host callback, used for any extern without an entry in the HostTable.
 using Callback =
-    bool(void*, const char*, const char*, const risc0::Fp*, size_t, risc0::Fp*, size_t);
+    bool(void*, size_t, const char*, const char*, const risc0::Fp*, size_t, risc0::Fp*, size_t);
+
+/// Host callback for a single extern, selected by its ExternId.
+using ExternCallback =
+    bool(void*, size_t, uint32_t, const char*, const risc0::Fp*, size_t, risc0::Fp*, size_t);
+
+/// Dispatch table handed over by the host.  A null entry in `externs` falls back to `callback`.
+struct HostTable {
+  Callback* callback;
+  ExternCallback* externs[kExternCount];
+};
 
 struct risc0_string {
   std::string str;
@@ -48,14 +100,71 @@ template <typename T, typename F> T ffi_wrap(risc0_error* err, T val, F fn) {
 
 namespace risc0::circuit::recursion {
 
-using HostBridge = void(void*, const char*, const char*, const Fp*, size_t, Fp*, size_t);
+using HostBridge = bool(void*, ExternId, uint32_t, const char*, const Fp*, size_t, Fp*, size_t);
+
+/// The step functions don't throw: on failure they store a message in `*err` and return
+/// Fp::invalid().
+inline Fp stepFailed(const char** err, const char* msg) {
+  *err = msg;
+  return Fp::invalid();
+}
+
+inline Fp hostFailed(const char** err) {
+  return stepFailed(err, "Host callback failure");
+}
+
+/// Whether the step functions call the "log" externs; see risc0_circuit_recursion_set_log.  A
+/// step loads it once, and with logging off each log extern is a branch instead of packing
+/// arguments and calling into the host.
+extern std::atomic<bool> logExterns;
+
+// The step functions are built twice.  The fast build skips the register checks, while the checked
+// build (RISC0_CIRCUIT_CHECKED) fails the step on a read of an unset register or a conflicting
+// write, naming the register.  Each build lives in its own namespace.  rewrite-cxx.py emits the
+// checks from the compiler's asserts.
+#ifdef RISC0_CIRCUIT_CHECKED
+#define RISC0_STEP_VARIANT checked
+constexpr bool kCheckRegs = true;
+#else
+#define RISC0_STEP_VARIANT fast
+constexpr bool kCheckRegs = false;
+#endif
+
+namespace fast {
+
+Fp step_compute_accum(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_verify_accum(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_exec(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_verify_bytes(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_verify_mem(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+
+} // namespace fast
+
+namespace checked {
+
+Fp step_compute_accum(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_verify_accum(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_exec(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_verify_bytes(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+Fp step_verify_mem(
+    void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err);
+
+} // namespace checked
+
+/// Number of powers of poly_mix, starting at poly_mix^0, that poly_fp reads.  The powers don't
+/// depend on the cycle, so callers compute them once and share them between rows.
+constexpr size_t kPolyMixPows = 1141;
 
-Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args);
-Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args);
-Fp step_exec(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args);
-Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args);
-Fp step_verify_mem(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args);
+Fp4 poly_fp(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args);
 
-Fp4 poly_fp(size_t cycle, size_t steps, Fp4* poly_mix, Fp** args);
+/// Evaluates poly_fp for the kFpVecLanes consecutive cycles starting at `cycle`.
+Fp4Vec<kFpVecLanes> poly_fp_batch(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args);
 
 } // namespace risc0::circuit::recursion
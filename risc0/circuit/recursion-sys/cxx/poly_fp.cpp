@@ -12,10 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "fp.h"
 #include "fp4.h"
+#include "fpvec.h"
 
 #include <cstdint>
 
@@ -24,12 +25,28 @@ constexpr size_t kInvRate = 4;
 // clang-format off
 namespace risc0::circuit::recursion {
 
-struct MixState {
-  Fp4 tot;
-  Fp4 mul;
+/// Reads the rows of one cycle.
+struct OneRow {
+  using Ext = Fp4;
+
+  static Fp load(const Fp* col, size_t row, size_t /*mask*/) { return col[row]; }
+};
+
+/// Reads the rows of kFpVecLanes consecutive cycles.
+struct LaneRows {
+  using Ext = Fp4Vec<kFpVecLanes>;
+
+  static FpVec<kFpVecLanes> load(const Fp* col, size_t row, size_t mask) {
+    return FpVec<kFpVecLanes>::loadRows(col, row, mask);
+  }
+};
+
+template <typename Rows> struct MixState {
+  typename Rows::Ext tot;
 };
 
-Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
+template <typename Rows>
+typename Rows::Ext polyFp(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args) {
   size_t mask = steps - 1;
   // loc("zirgen/circuit/recursion/micro.cpp":151:0)
   Fp x0(0);
@@ -4684,65 +4701,65 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":140:0)
   Fp x2325(1834032191);
   // loc("zirgen/circuit/recursion/recursion.cpp":41:0)
-  MixState x2326{Fp4(0), Fp4(1)};
+  MixState<Rows> x2326{Fp4(0)};
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/micro_ops(Reg)"("./zirgen/components/mux.h":49:0))
-  auto x2327 = args[0][1 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2327 = Rows::load(args[0] + 1 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/write_addr(Reg)"("zirgen/circuit/recursion/top.cpp":22:0))
-  auto x2328 = args[0][0 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2328 = Rows::load(args[0] + 0 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[0](recursion::MicroInst)/opcode(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x2329 = args[0][7 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2329 = Rows::load(args[0] + 7 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/add(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2330 = args[2][91 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2330 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/sub(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2331 = args[2][92 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2331 = Rows::load(args[2] + 92 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2332 = x2331 * x2;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2333 = x2330 + x2332;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/mul(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2334 = args[2][93 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2334 = Rows::load(args[2] + 93 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2335 = x2334 * x3;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2336 = x2333 + x2335;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/inv(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2337 = args[2][94 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2337 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2338 = x2337 * x4;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2339 = x2336 + x2338;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/eq(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2340 = args[2][95 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2340 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2341 = x2340 * x5;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2342 = x2339 + x2341;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/read_iop_header(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2343 = args[2][96 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2343 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2344 = x2343 * x6;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2345 = x2342 + x2344;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/read_iop_body(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2346 = args[2][97 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2346 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2347 = x2346 * x7;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2348 = x2345 + x2347;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/mix_rng(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2349 = args[2][98 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2349 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2350 = x2349 * x8;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2351 = x2348 + x2350;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/select(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2352 = args[2][99 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2352 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2353 = x2352 * x9;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2354 = x2351 + x2353;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/extract(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2355 = args[2][100 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2355 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2356 = x2355 * x10;
   // loc("./zirgen/components/onehot.h":46:0)
@@ -4750,93 +4767,93 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":40:0)
   auto x2358 = x2357 - x2329;
   // loc("./zirgen/components/onehot.h":40:0)
-  MixState x2359{x2326.tot + x2326.mul * x2358, x2326.mul * (*mix)};
+  MixState<Rows> x2359{x2326.tot + mixPows[0] * x2358};
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[0](recursion::MicroInst)/operand[0](Reg)"("zirgen/circuit/recursion/micro.cpp":14:0))
-  auto x2360 = args[0][8 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2360 = Rows::load(args[0] + 8 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[0](recursion::MicroInst)/operand[1](Reg)"("zirgen/circuit/recursion/micro.cpp":15:0))
-  auto x2361 = args[0][9 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2361 = Rows::load(args[0] + 9 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[0](recursion::MicroInst)/operand[2](Reg)"("zirgen/circuit/recursion/micro.cpp":16:0))
-  auto x2362 = args[0][10 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2362 = Rows::load(args[0] + 10 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/decode(OneHot)/constop(Reg)"("zirgen/circuit/recursion/micro.cpp":19:0))
-  auto x2363 = args[2][90 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2363 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  auto x2364 = args[2][5 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2364 = Rows::load(args[2] + 5 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2365{x2326.tot + x2326.mul * x2364, x2326.mul * (*mix)};
+  MixState<Rows> x2365{x2326.tot + mixPows[0] * x2364};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2366 = args[2][6 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2366 = Rows::load(args[2] + 6 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2367{x2365.tot + x2365.mul * x2366, x2365.mul * (*mix)};
+  MixState<Rows> x2367{x2365.tot + mixPows[1] * x2366};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2368 = args[2][7 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2368 = Rows::load(args[2] + 7 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2369{x2367.tot + x2367.mul * x2368, x2367.mul * (*mix)};
+  MixState<Rows> x2369{x2367.tot + mixPows[2] * x2368};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2370 = args[2][8 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2370 = Rows::load(args[2] + 8 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2371{x2369.tot + x2369.mul * x2370, x2369.mul * (*mix)};
+  MixState<Rows> x2371{x2369.tot + mixPows[3] * x2370};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2372 = args[2][9 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2372 = Rows::load(args[2] + 9 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2373{x2371.tot + x2371.mul * x2372, x2371.mul * (*mix)};
+  MixState<Rows> x2373{x2371.tot + mixPows[4] * x2372};
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  auto x2374 = args[2][10 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2374 = Rows::load(args[2] + 10 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2375{x2373.tot + x2373.mul * x2374, x2373.mul * (*mix)};
+  MixState<Rows> x2375{x2373.tot + mixPows[5] * x2374};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2376 = args[2][11 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2376 = Rows::load(args[2] + 11 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2377{x2375.tot + x2375.mul * x2376, x2375.mul * (*mix)};
+  MixState<Rows> x2377{x2375.tot + mixPows[6] * x2376};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2378 = args[2][12 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2378 = Rows::load(args[2] + 12 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2379{x2377.tot + x2377.mul * x2378, x2377.mul * (*mix)};
+  MixState<Rows> x2379{x2377.tot + mixPows[7] * x2378};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2380 = args[2][13 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2380 = Rows::load(args[2] + 13 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2381{x2379.tot + x2379.mul * x2380, x2379.mul * (*mix)};
+  MixState<Rows> x2381{x2379.tot + mixPows[8] * x2380};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2382 = args[2][14 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2382 = Rows::load(args[2] + 14 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2383{x2381.tot + x2381.mul * x2382, x2381.mul * (*mix)};
+  MixState<Rows> x2383{x2381.tot + mixPows[9] * x2382};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  auto x2384 = args[2][15 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2384 = Rows::load(args[2] + 15 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x2385 = x2384 - x2328;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2386{x2383.tot + x2383.mul * x2385, x2383.mul * (*mix)};
+  MixState<Rows> x2386{x2383.tot + mixPows[10] * x2385};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2387 = args[2][16 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2387 = Rows::load(args[2] + 16 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2388 = x2387 - x2360;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2389{x2386.tot + x2386.mul * x2388, x2386.mul * (*mix)};
+  MixState<Rows> x2389{x2386.tot + mixPows[11] * x2388};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2390 = args[2][17 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2390 = Rows::load(args[2] + 17 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2391 = x2390 - x2361;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2392{x2389.tot + x2389.mul * x2391, x2389.mul * (*mix)};
+  MixState<Rows> x2392{x2389.tot + mixPows[12] * x2391};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2393 = args[2][18 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2393 = Rows::load(args[2] + 18 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2394 = x2393 - x2362;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2395{x2392.tot + x2392.mul * x2394, x2392.mul * (*mix)};
+  MixState<Rows> x2395{x2392.tot + mixPows[13] * x2394};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2396 = args[2][19 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2396 = Rows::load(args[2] + 19 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2397{x2395.tot + x2395.mul * x2396, x2395.mul * (*mix)};
+  MixState<Rows> x2397{x2395.tot + mixPows[14] * x2396};
   // loc("zirgen/circuit/recursion/micro.cpp":19:0)
-  MixState x2398{x2359.tot + x2363 * x2397.tot * x2359.mul, x2359.mul * x2397.mul};
+  MixState<Rows> x2398{x2359.tot + x2363 * x2397.tot * mixPows[1]};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2399 = x2364 - x2360;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2400{x2326.tot + x2326.mul * x2399, x2326.mul * (*mix)};
+  MixState<Rows> x2400{x2326.tot + mixPows[0] * x2399};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2401 = x2374 - x2361;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2402{x2400.tot + x2400.mul * x2401, x2400.mul * (*mix)};
+  MixState<Rows> x2402{x2400.tot + mixPows[1] * x2401};
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
   auto x2403 = x2366 + x2376;
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
@@ -4846,25 +4863,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
   auto x2406 = x2372 + x2382;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2407{x2402.tot + x2402.mul * x2385, x2402.mul * (*mix)};
+  MixState<Rows> x2407{x2402.tot + mixPows[2] * x2385};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2408 = x2387 - x2403;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2409{x2407.tot + x2407.mul * x2408, x2407.mul * (*mix)};
+  MixState<Rows> x2409{x2407.tot + mixPows[3] * x2408};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2410 = x2390 - x2404;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2411{x2409.tot + x2409.mul * x2410, x2409.mul * (*mix)};
+  MixState<Rows> x2411{x2409.tot + mixPows[4] * x2410};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2412 = x2393 - x2405;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2413{x2411.tot + x2411.mul * x2412, x2411.mul * (*mix)};
+  MixState<Rows> x2413{x2411.tot + mixPows[5] * x2412};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2414 = x2396 - x2406;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2415{x2413.tot + x2413.mul * x2414, x2413.mul * (*mix)};
+  MixState<Rows> x2415{x2413.tot + mixPows[6] * x2414};
   // loc("zirgen/circuit/recursion/micro.cpp":25:0)
-  MixState x2416{x2398.tot + x2330 * x2415.tot * x2398.mul, x2398.mul * x2415.mul};
+  MixState<Rows> x2416{x2398.tot + x2330 * x2415.tot * mixPows[16]};
   // loc("zirgen/circuit/recursion/micro.cpp":34:0)
   auto x2417 = x2366 - x2376;
   // loc("zirgen/circuit/recursion/micro.cpp":34:0)
@@ -4876,21 +4893,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2421 = x2387 - x2417;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2422{x2407.tot + x2407.mul * x2421, x2407.mul * (*mix)};
+  MixState<Rows> x2422{x2407.tot + mixPows[3] * x2421};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2423 = x2390 - x2418;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2424{x2422.tot + x2422.mul * x2423, x2422.mul * (*mix)};
+  MixState<Rows> x2424{x2422.tot + mixPows[4] * x2423};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2425 = x2393 - x2419;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2426{x2424.tot + x2424.mul * x2425, x2424.mul * (*mix)};
+  MixState<Rows> x2426{x2424.tot + mixPows[5] * x2425};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2427 = x2396 - x2420;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2428{x2426.tot + x2426.mul * x2427, x2426.mul * (*mix)};
+  MixState<Rows> x2428{x2426.tot + mixPows[6] * x2427};
   // loc("zirgen/circuit/recursion/micro.cpp":31:0)
-  MixState x2429{x2416.tot + x2331 * x2428.tot * x2416.mul, x2416.mul * x2428.mul};
+  MixState<Rows> x2429{x2416.tot + x2331 * x2428.tot * mixPows[23]};
   // loc("zirgen/circuit/recursion/micro.cpp":40:0)
   auto x2430 = x2372 * x2378;
   // loc("zirgen/circuit/recursion/micro.cpp":40:0)
@@ -4956,33 +4973,33 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2461 = x2387 - x2437;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2462{x2407.tot + x2407.mul * x2461, x2407.mul * (*mix)};
+  MixState<Rows> x2462{x2407.tot + mixPows[3] * x2461};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2463 = x2390 - x2445;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2464{x2462.tot + x2462.mul * x2463, x2462.mul * (*mix)};
+  MixState<Rows> x2464{x2462.tot + mixPows[4] * x2463};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2465 = x2393 - x2453;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2466{x2464.tot + x2464.mul * x2465, x2464.mul * (*mix)};
+  MixState<Rows> x2466{x2464.tot + mixPows[5] * x2465};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2467 = x2396 - x2460;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2468{x2466.tot + x2466.mul * x2467, x2466.mul * (*mix)};
+  MixState<Rows> x2468{x2466.tot + mixPows[6] * x2467};
   // loc("zirgen/circuit/recursion/micro.cpp":37:0)
-  MixState x2469{x2429.tot + x2334 * x2468.tot * x2429.mul, x2429.mul * x2468.mul};
+  MixState<Rows> x2469{x2429.tot + x2334 * x2468.tot * mixPows[30]};
   // loc("zirgen/circuit/recursion/micro.cpp":43:0)
   auto x2470 = x2337 * x2361;
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2471{x2400.tot + x2400.mul * x2374, x2400.mul * (*mix)};
+  MixState<Rows> x2471{x2400.tot + mixPows[1] * x2374};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2472{x2471.tot + x2471.mul * x2376, x2471.mul * (*mix)};
+  MixState<Rows> x2472{x2471.tot + mixPows[2] * x2376};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2473{x2472.tot + x2472.mul * x2378, x2472.mul * (*mix)};
+  MixState<Rows> x2473{x2472.tot + mixPows[3] * x2378};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2474{x2473.tot + x2473.mul * x2380, x2473.mul * (*mix)};
+  MixState<Rows> x2474{x2473.tot + mixPows[4] * x2380};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2475{x2474.tot + x2474.mul * x2382, x2474.mul * (*mix)};
+  MixState<Rows> x2475{x2474.tot + mixPows[5] * x2382};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2476 = x2372 * x2390;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
@@ -5048,89 +5065,89 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2507 = x1 - x2483;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2508{x2475.tot + x2475.mul * x2507, x2475.mul * (*mix)};
+  MixState<Rows> x2508{x2475.tot + mixPows[6] * x2507};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2509 = x0 - x2491;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2510{x2508.tot + x2508.mul * x2509, x2508.mul * (*mix)};
+  MixState<Rows> x2510{x2508.tot + mixPows[7] * x2509};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2511 = x0 - x2499;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2512{x2510.tot + x2510.mul * x2511, x2510.mul * (*mix)};
+  MixState<Rows> x2512{x2510.tot + mixPows[8] * x2511};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2513 = x0 - x2506;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2514{x2512.tot + x2512.mul * x2513, x2512.mul * (*mix)};
+  MixState<Rows> x2514{x2512.tot + mixPows[9] * x2513};
   // loc("zirgen/circuit/recursion/micro.cpp":43:0)
-  MixState x2515{x2469.tot + x2470 * x2514.tot * x2469.mul, x2469.mul * x2514.mul};
+  MixState<Rows> x2515{x2469.tot + x2470 * x2514.tot * mixPows[37]};
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
   auto x2516 = x1 - x2361;
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
   auto x2517 = x2337 * x2516;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/extra(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x2518 = args[2][101 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2518 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
   auto x2519 = x1 - x2387;
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
   auto x2520 = x2387 * x2519;
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
-  MixState x2521{x2475.tot + x2475.mul * x2520, x2475.mul * (*mix)};
+  MixState<Rows> x2521{x2475.tot + mixPows[6] * x2520};
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
   auto x2522 = x2518 * x2366;
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
   auto x2523 = x2522 - x2519;
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
-  MixState x2524{x2521.tot + x2521.mul * x2523, x2521.mul * (*mix)};
+  MixState<Rows> x2524{x2521.tot + mixPows[7] * x2523};
   // loc("zirgen/circuit/recursion/micro.cpp":65:0)
   auto x2525 = x2387 * x2366;
   // loc("zirgen/circuit/recursion/micro.cpp":65:0)
-  MixState x2526{x2524.tot + x2524.mul * x2525, x2524.mul * (*mix)};
+  MixState<Rows> x2526{x2524.tot + mixPows[8] * x2525};
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
-  MixState x2527{x2515.tot + x2517 * x2526.tot * x2515.mul, x2515.mul * x2526.mul};
+  MixState<Rows> x2527{x2515.tot + x2517 * x2526.tot * mixPows[47]};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2528 = x0 - x2387;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2529{x2428.tot + x2428.mul * x2528, x2428.mul * (*mix)};
+  MixState<Rows> x2529{x2428.tot + mixPows[7] * x2528};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2530 = x0 - x2390;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2531{x2529.tot + x2529.mul * x2530, x2529.mul * (*mix)};
+  MixState<Rows> x2531{x2529.tot + mixPows[8] * x2530};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2532 = x0 - x2393;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2533{x2531.tot + x2531.mul * x2532, x2531.mul * (*mix)};
+  MixState<Rows> x2533{x2531.tot + mixPows[9] * x2532};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2534 = x0 - x2396;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2535{x2533.tot + x2533.mul * x2534, x2533.mul * (*mix)};
+  MixState<Rows> x2535{x2533.tot + mixPows[10] * x2534};
   // loc("zirgen/circuit/recursion/micro.cpp":68:0)
-  MixState x2536{x2527.tot + x2340 * x2535.tot * x2527.mul, x2527.mul * x2535.mul};
+  MixState<Rows> x2536{x2527.tot + x2340 * x2535.tot * mixPows[56]};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2537{x2386.tot + x2386.mul * x2387, x2386.mul * (*mix)};
+  MixState<Rows> x2537{x2386.tot + mixPows[11] * x2387};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2538{x2537.tot + x2537.mul * x2390, x2537.mul * (*mix)};
+  MixState<Rows> x2538{x2537.tot + mixPows[12] * x2390};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2539{x2538.tot + x2538.mul * x2393, x2538.mul * (*mix)};
+  MixState<Rows> x2539{x2538.tot + mixPows[13] * x2393};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2540{x2539.tot + x2539.mul * x2396, x2539.mul * (*mix)};
+  MixState<Rows> x2540{x2539.tot + mixPows[14] * x2396};
   // loc("zirgen/circuit/recursion/micro.cpp":75:0)
-  MixState x2541{x2536.tot + x2343 * x2540.tot * x2536.mul, x2536.mul * x2540.mul};
+  MixState<Rows> x2541{x2536.tot + x2343 * x2540.tot * mixPows[67]};
   // loc("zirgen/circuit/recursion/micro.cpp":94:0)
   auto x2542 = x2360 * x2390;
   // loc("zirgen/circuit/recursion/micro.cpp":94:0)
-  MixState x2543{x2383.tot + x2383.mul * x2542, x2383.mul * (*mix)};
+  MixState<Rows> x2543{x2383.tot + mixPows[10] * x2542};
   // loc("zirgen/circuit/recursion/micro.cpp":95:0)
   auto x2544 = x2361 * x2393;
   // loc("zirgen/circuit/recursion/micro.cpp":95:0)
-  MixState x2545{x2543.tot + x2543.mul * x2544, x2543.mul * (*mix)};
+  MixState<Rows> x2545{x2543.tot + mixPows[11] * x2544};
   // loc("zirgen/circuit/recursion/micro.cpp":96:0)
   auto x2546 = x2361 * x2396;
   // loc("zirgen/circuit/recursion/micro.cpp":96:0)
-  MixState x2547{x2545.tot + x2545.mul * x2546, x2545.mul * (*mix)};
+  MixState<Rows> x2547{x2545.tot + mixPows[12] * x2546};
   // loc("zirgen/circuit/recursion/micro.cpp":82:0)
-  MixState x2548{x2541.tot + x2346 * x2547.tot * x2541.mul, x2541.mul * x2547.mul};
+  MixState<Rows> x2548{x2541.tot + x2346 * x2547.tot * mixPows[82]};
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/extra(Reg)"("zirgen/circuit/recursion/micro.cpp":107:0))
-  auto x2549 = args[2][125 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x2549 = Rows::load(args[2] + 125 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/micro.cpp":107:0)
   auto x2550 = x2362 * x2549;
   // loc("zirgen/circuit/recursion/micro.cpp":109:0)
@@ -5152,21 +5169,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":114:0)
   auto x2559 = x2518 - x2558;
   // loc("zirgen/circuit/recursion/micro.cpp":114:0)
-  MixState x2560{x2402.tot + x2402.mul * x2559, x2402.mul * (*mix)};
+  MixState<Rows> x2560{x2402.tot + mixPows[2] * x2559};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2561{x2560.tot + x2560.mul * x2385, x2560.mul * (*mix)};
+  MixState<Rows> x2561{x2560.tot + mixPows[3] * x2385};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2562 = x2387 - x2558;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2563{x2561.tot + x2561.mul * x2562, x2561.mul * (*mix)};
+  MixState<Rows> x2563{x2561.tot + mixPows[4] * x2562};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2564{x2563.tot + x2563.mul * x2390, x2563.mul * (*mix)};
+  MixState<Rows> x2564{x2563.tot + mixPows[5] * x2390};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2565{x2564.tot + x2564.mul * x2393, x2564.mul * (*mix)};
+  MixState<Rows> x2565{x2564.tot + mixPows[6] * x2393};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2566{x2565.tot + x2565.mul * x2396, x2565.mul * (*mix)};
+  MixState<Rows> x2566{x2565.tot + mixPows[7] * x2396};
   // loc("zirgen/circuit/recursion/micro.cpp":98:0)
-  MixState x2567{x2548.tot + x2349 * x2566.tot * x2548.mul, x2548.mul * x2566.mul};
+  MixState<Rows> x2567{x2548.tot + x2349 * x2566.tot * mixPows[95]};
   // loc("zirgen/circuit/recursion/micro.cpp":119:0)
   auto x2568 = x2362 * x2366;
   // loc("zirgen/circuit/recursion/micro.cpp":119:0)
@@ -5174,27 +5191,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2570 = x2374 - x2569;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2571{x2400.tot + x2400.mul * x2570, x2400.mul * (*mix)};
+  MixState<Rows> x2571{x2400.tot + mixPows[1] * x2570};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2572{x2571.tot + x2571.mul * x2385, x2571.mul * (*mix)};
+  MixState<Rows> x2572{x2571.tot + mixPows[2] * x2385};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2573 = x2387 - x2376;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2574{x2572.tot + x2572.mul * x2573, x2572.mul * (*mix)};
+  MixState<Rows> x2574{x2572.tot + mixPows[3] * x2573};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2575 = x2390 - x2378;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2576{x2574.tot + x2574.mul * x2575, x2574.mul * (*mix)};
+  MixState<Rows> x2576{x2574.tot + mixPows[4] * x2575};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2577 = x2393 - x2380;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2578{x2576.tot + x2576.mul * x2577, x2576.mul * (*mix)};
+  MixState<Rows> x2578{x2576.tot + mixPows[5] * x2577};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2579 = x2396 - x2382;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2580{x2578.tot + x2578.mul * x2579, x2578.mul * (*mix)};
+  MixState<Rows> x2580{x2578.tot + mixPows[6] * x2579};
   // loc("zirgen/circuit/recursion/micro.cpp":117:0)
-  MixState x2581{x2567.tot + x2352 * x2580.tot * x2567.mul, x2567.mul * x2580.mul};
+  MixState<Rows> x2581{x2567.tot + x2352 * x2580.tot * mixPows[103]};
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
   auto x2582 = x1 - x2362;
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
@@ -5220,75 +5237,75 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
   auto x2593 = x2592 + x2584;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2594{x2475.tot + x2475.mul * x2385, x2475.mul * (*mix)};
+  MixState<Rows> x2594{x2475.tot + mixPows[6] * x2385};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2595 = x2387 - x2593;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2596{x2594.tot + x2594.mul * x2595, x2594.mul * (*mix)};
+  MixState<Rows> x2596{x2594.tot + mixPows[7] * x2595};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2597{x2596.tot + x2596.mul * x2390, x2596.mul * (*mix)};
+  MixState<Rows> x2597{x2596.tot + mixPows[8] * x2390};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2598{x2597.tot + x2597.mul * x2393, x2597.mul * (*mix)};
+  MixState<Rows> x2598{x2597.tot + mixPows[9] * x2393};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2599{x2598.tot + x2598.mul * x2396, x2598.mul * (*mix)};
+  MixState<Rows> x2599{x2598.tot + mixPows[10] * x2396};
   // loc("zirgen/circuit/recursion/micro.cpp":129:0)
-  MixState x2600{x2581.tot + x2355 * x2599.tot * x2581.mul, x2581.mul * x2599.mul};
+  MixState<Rows> x2600{x2581.tot + x2355 * x2599.tot * mixPows[110]};
   // loc("zirgen/circuit/recursion/micro.cpp":151:0)
   auto x2601 = x2328 + x1;
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[1](recursion::MicroInst)/opcode(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x2602 = args[0][11 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2602 = Rows::load(args[0] + 11 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/add(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2603 = args[2][103 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2603 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/sub(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2604 = args[2][104 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2604 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2605 = x2604 * x2;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2606 = x2603 + x2605;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/mul(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2607 = args[2][105 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2607 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2608 = x2607 * x3;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2609 = x2606 + x2608;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/inv(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2610 = args[2][106 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2610 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2611 = x2610 * x4;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2612 = x2609 + x2611;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/eq(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2613 = args[2][107 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2613 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2614 = x2613 * x5;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2615 = x2612 + x2614;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/read_iop_header(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2616 = args[2][108 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2616 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2617 = x2616 * x6;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2618 = x2615 + x2617;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/read_iop_body(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2619 = args[2][109 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2619 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2620 = x2619 * x7;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2621 = x2618 + x2620;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/mix_rng(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2622 = args[2][110 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2622 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2623 = x2622 * x8;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2624 = x2621 + x2623;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/select(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2625 = args[2][111 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2625 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2626 = x2625 * x9;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2627 = x2624 + x2626;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/extract(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2628 = args[2][112 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2628 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2629 = x2628 * x10;
   // loc("./zirgen/components/onehot.h":46:0)
@@ -5296,93 +5313,93 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":40:0)
   auto x2631 = x2630 - x2602;
   // loc("./zirgen/components/onehot.h":40:0)
-  MixState x2632{x2600.tot + x2600.mul * x2631, x2600.mul * (*mix)};
+  MixState<Rows> x2632{x2600.tot + mixPows[121] * x2631};
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[1](recursion::MicroInst)/operand[0](Reg)"("zirgen/circuit/recursion/micro.cpp":14:0))
-  auto x2633 = args[0][12 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2633 = Rows::load(args[0] + 12 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[1](recursion::MicroInst)/operand[1](Reg)"("zirgen/circuit/recursion/micro.cpp":15:0))
-  auto x2634 = args[0][13 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2634 = Rows::load(args[0] + 13 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[1](recursion::MicroInst)/operand[2](Reg)"("zirgen/circuit/recursion/micro.cpp":16:0))
-  auto x2635 = args[0][14 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2635 = Rows::load(args[0] + 14 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/decode(OneHot)/constop(Reg)"("zirgen/circuit/recursion/micro.cpp":19:0))
-  auto x2636 = args[2][102 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2636 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  auto x2637 = args[2][20 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2637 = Rows::load(args[2] + 20 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2638{x2326.tot + x2326.mul * x2637, x2326.mul * (*mix)};
+  MixState<Rows> x2638{x2326.tot + mixPows[0] * x2637};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2639 = args[2][21 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2639 = Rows::load(args[2] + 21 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2640{x2638.tot + x2638.mul * x2639, x2638.mul * (*mix)};
+  MixState<Rows> x2640{x2638.tot + mixPows[1] * x2639};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2641 = args[2][22 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2641 = Rows::load(args[2] + 22 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2642{x2640.tot + x2640.mul * x2641, x2640.mul * (*mix)};
+  MixState<Rows> x2642{x2640.tot + mixPows[2] * x2641};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2643 = args[2][23 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2643 = Rows::load(args[2] + 23 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2644{x2642.tot + x2642.mul * x2643, x2642.mul * (*mix)};
+  MixState<Rows> x2644{x2642.tot + mixPows[3] * x2643};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2645 = args[2][24 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2645 = Rows::load(args[2] + 24 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2646{x2644.tot + x2644.mul * x2645, x2644.mul * (*mix)};
+  MixState<Rows> x2646{x2644.tot + mixPows[4] * x2645};
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  auto x2647 = args[2][25 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2647 = Rows::load(args[2] + 25 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2648{x2646.tot + x2646.mul * x2647, x2646.mul * (*mix)};
+  MixState<Rows> x2648{x2646.tot + mixPows[5] * x2647};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2649 = args[2][26 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2649 = Rows::load(args[2] + 26 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2650{x2648.tot + x2648.mul * x2649, x2648.mul * (*mix)};
+  MixState<Rows> x2650{x2648.tot + mixPows[6] * x2649};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2651 = args[2][27 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2651 = Rows::load(args[2] + 27 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2652{x2650.tot + x2650.mul * x2651, x2650.mul * (*mix)};
+  MixState<Rows> x2652{x2650.tot + mixPows[7] * x2651};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2653 = args[2][28 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2653 = Rows::load(args[2] + 28 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2654{x2652.tot + x2652.mul * x2653, x2652.mul * (*mix)};
+  MixState<Rows> x2654{x2652.tot + mixPows[8] * x2653};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2655 = args[2][29 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2655 = Rows::load(args[2] + 29 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2656{x2654.tot + x2654.mul * x2655, x2654.mul * (*mix)};
+  MixState<Rows> x2656{x2654.tot + mixPows[9] * x2655};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  auto x2657 = args[2][30 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2657 = Rows::load(args[2] + 30 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x2658 = x2657 - x2601;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2659{x2656.tot + x2656.mul * x2658, x2656.mul * (*mix)};
+  MixState<Rows> x2659{x2656.tot + mixPows[10] * x2658};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2660 = args[2][31 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2660 = Rows::load(args[2] + 31 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2661 = x2660 - x2633;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2662{x2659.tot + x2659.mul * x2661, x2659.mul * (*mix)};
+  MixState<Rows> x2662{x2659.tot + mixPows[11] * x2661};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2663 = args[2][32 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2663 = Rows::load(args[2] + 32 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2664 = x2663 - x2634;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2665{x2662.tot + x2662.mul * x2664, x2662.mul * (*mix)};
+  MixState<Rows> x2665{x2662.tot + mixPows[12] * x2664};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2666 = args[2][33 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2666 = Rows::load(args[2] + 33 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2667 = x2666 - x2635;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2668{x2665.tot + x2665.mul * x2667, x2665.mul * (*mix)};
+  MixState<Rows> x2668{x2665.tot + mixPows[13] * x2667};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2669 = args[2][34 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2669 = Rows::load(args[2] + 34 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2670{x2668.tot + x2668.mul * x2669, x2668.mul * (*mix)};
+  MixState<Rows> x2670{x2668.tot + mixPows[14] * x2669};
   // loc("zirgen/circuit/recursion/micro.cpp":19:0)
-  MixState x2671{x2632.tot + x2636 * x2670.tot * x2632.mul, x2632.mul * x2670.mul};
+  MixState<Rows> x2671{x2632.tot + x2636 * x2670.tot * mixPows[122]};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2672 = x2637 - x2633;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2673{x2326.tot + x2326.mul * x2672, x2326.mul * (*mix)};
+  MixState<Rows> x2673{x2326.tot + mixPows[0] * x2672};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2674 = x2647 - x2634;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2675{x2673.tot + x2673.mul * x2674, x2673.mul * (*mix)};
+  MixState<Rows> x2675{x2673.tot + mixPows[1] * x2674};
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
   auto x2676 = x2639 + x2649;
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
@@ -5392,25 +5409,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
   auto x2679 = x2645 + x2655;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2680{x2675.tot + x2675.mul * x2658, x2675.mul * (*mix)};
+  MixState<Rows> x2680{x2675.tot + mixPows[2] * x2658};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2681 = x2660 - x2676;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2682{x2680.tot + x2680.mul * x2681, x2680.mul * (*mix)};
+  MixState<Rows> x2682{x2680.tot + mixPows[3] * x2681};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2683 = x2663 - x2677;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2684{x2682.tot + x2682.mul * x2683, x2682.mul * (*mix)};
+  MixState<Rows> x2684{x2682.tot + mixPows[4] * x2683};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2685 = x2666 - x2678;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2686{x2684.tot + x2684.mul * x2685, x2684.mul * (*mix)};
+  MixState<Rows> x2686{x2684.tot + mixPows[5] * x2685};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2687 = x2669 - x2679;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2688{x2686.tot + x2686.mul * x2687, x2686.mul * (*mix)};
+  MixState<Rows> x2688{x2686.tot + mixPows[6] * x2687};
   // loc("zirgen/circuit/recursion/micro.cpp":25:0)
-  MixState x2689{x2671.tot + x2603 * x2688.tot * x2671.mul, x2671.mul * x2688.mul};
+  MixState<Rows> x2689{x2671.tot + x2603 * x2688.tot * mixPows[137]};
   // loc("zirgen/circuit/recursion/micro.cpp":34:0)
   auto x2690 = x2639 - x2649;
   // loc("zirgen/circuit/recursion/micro.cpp":34:0)
@@ -5422,21 +5439,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2694 = x2660 - x2690;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2695{x2680.tot + x2680.mul * x2694, x2680.mul * (*mix)};
+  MixState<Rows> x2695{x2680.tot + mixPows[3] * x2694};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2696 = x2663 - x2691;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2697{x2695.tot + x2695.mul * x2696, x2695.mul * (*mix)};
+  MixState<Rows> x2697{x2695.tot + mixPows[4] * x2696};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2698 = x2666 - x2692;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2699{x2697.tot + x2697.mul * x2698, x2697.mul * (*mix)};
+  MixState<Rows> x2699{x2697.tot + mixPows[5] * x2698};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2700 = x2669 - x2693;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2701{x2699.tot + x2699.mul * x2700, x2699.mul * (*mix)};
+  MixState<Rows> x2701{x2699.tot + mixPows[6] * x2700};
   // loc("zirgen/circuit/recursion/micro.cpp":31:0)
-  MixState x2702{x2689.tot + x2604 * x2701.tot * x2689.mul, x2689.mul * x2701.mul};
+  MixState<Rows> x2702{x2689.tot + x2604 * x2701.tot * mixPows[144]};
   // loc("zirgen/circuit/recursion/micro.cpp":40:0)
   auto x2703 = x2645 * x2651;
   // loc("zirgen/circuit/recursion/micro.cpp":40:0)
@@ -5502,33 +5519,33 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2734 = x2660 - x2710;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2735{x2680.tot + x2680.mul * x2734, x2680.mul * (*mix)};
+  MixState<Rows> x2735{x2680.tot + mixPows[3] * x2734};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2736 = x2663 - x2718;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2737{x2735.tot + x2735.mul * x2736, x2735.mul * (*mix)};
+  MixState<Rows> x2737{x2735.tot + mixPows[4] * x2736};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2738 = x2666 - x2726;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2739{x2737.tot + x2737.mul * x2738, x2737.mul * (*mix)};
+  MixState<Rows> x2739{x2737.tot + mixPows[5] * x2738};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2740 = x2669 - x2733;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2741{x2739.tot + x2739.mul * x2740, x2739.mul * (*mix)};
+  MixState<Rows> x2741{x2739.tot + mixPows[6] * x2740};
   // loc("zirgen/circuit/recursion/micro.cpp":37:0)
-  MixState x2742{x2702.tot + x2607 * x2741.tot * x2702.mul, x2702.mul * x2741.mul};
+  MixState<Rows> x2742{x2702.tot + x2607 * x2741.tot * mixPows[151]};
   // loc("zirgen/circuit/recursion/micro.cpp":43:0)
   auto x2743 = x2610 * x2634;
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2744{x2673.tot + x2673.mul * x2647, x2673.mul * (*mix)};
+  MixState<Rows> x2744{x2673.tot + mixPows[1] * x2647};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2745{x2744.tot + x2744.mul * x2649, x2744.mul * (*mix)};
+  MixState<Rows> x2745{x2744.tot + mixPows[2] * x2649};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2746{x2745.tot + x2745.mul * x2651, x2745.mul * (*mix)};
+  MixState<Rows> x2746{x2745.tot + mixPows[3] * x2651};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2747{x2746.tot + x2746.mul * x2653, x2746.mul * (*mix)};
+  MixState<Rows> x2747{x2746.tot + mixPows[4] * x2653};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2748{x2747.tot + x2747.mul * x2655, x2747.mul * (*mix)};
+  MixState<Rows> x2748{x2747.tot + mixPows[5] * x2655};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2749 = x2645 * x2663;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
@@ -5594,89 +5611,89 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2780 = x1 - x2756;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2781{x2748.tot + x2748.mul * x2780, x2748.mul * (*mix)};
+  MixState<Rows> x2781{x2748.tot + mixPows[6] * x2780};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2782 = x0 - x2764;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2783{x2781.tot + x2781.mul * x2782, x2781.mul * (*mix)};
+  MixState<Rows> x2783{x2781.tot + mixPows[7] * x2782};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2784 = x0 - x2772;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2785{x2783.tot + x2783.mul * x2784, x2783.mul * (*mix)};
+  MixState<Rows> x2785{x2783.tot + mixPows[8] * x2784};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x2786 = x0 - x2779;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x2787{x2785.tot + x2785.mul * x2786, x2785.mul * (*mix)};
+  MixState<Rows> x2787{x2785.tot + mixPows[9] * x2786};
   // loc("zirgen/circuit/recursion/micro.cpp":43:0)
-  MixState x2788{x2742.tot + x2743 * x2787.tot * x2742.mul, x2742.mul * x2787.mul};
+  MixState<Rows> x2788{x2742.tot + x2743 * x2787.tot * mixPows[158]};
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
   auto x2789 = x1 - x2634;
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
   auto x2790 = x2610 * x2789;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/extra(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x2791 = args[2][113 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2791 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
   auto x2792 = x1 - x2660;
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
   auto x2793 = x2660 * x2792;
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
-  MixState x2794{x2748.tot + x2748.mul * x2793, x2748.mul * (*mix)};
+  MixState<Rows> x2794{x2748.tot + mixPows[6] * x2793};
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
   auto x2795 = x2791 * x2639;
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
   auto x2796 = x2795 - x2792;
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
-  MixState x2797{x2794.tot + x2794.mul * x2796, x2794.mul * (*mix)};
+  MixState<Rows> x2797{x2794.tot + mixPows[7] * x2796};
   // loc("zirgen/circuit/recursion/micro.cpp":65:0)
   auto x2798 = x2660 * x2639;
   // loc("zirgen/circuit/recursion/micro.cpp":65:0)
-  MixState x2799{x2797.tot + x2797.mul * x2798, x2797.mul * (*mix)};
+  MixState<Rows> x2799{x2797.tot + mixPows[8] * x2798};
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
-  MixState x2800{x2788.tot + x2790 * x2799.tot * x2788.mul, x2788.mul * x2799.mul};
+  MixState<Rows> x2800{x2788.tot + x2790 * x2799.tot * mixPows[168]};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2801 = x0 - x2660;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2802{x2701.tot + x2701.mul * x2801, x2701.mul * (*mix)};
+  MixState<Rows> x2802{x2701.tot + mixPows[7] * x2801};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2803 = x0 - x2663;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2804{x2802.tot + x2802.mul * x2803, x2802.mul * (*mix)};
+  MixState<Rows> x2804{x2802.tot + mixPows[8] * x2803};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2805 = x0 - x2666;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2806{x2804.tot + x2804.mul * x2805, x2804.mul * (*mix)};
+  MixState<Rows> x2806{x2804.tot + mixPows[9] * x2805};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x2807 = x0 - x2669;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x2808{x2806.tot + x2806.mul * x2807, x2806.mul * (*mix)};
+  MixState<Rows> x2808{x2806.tot + mixPows[10] * x2807};
   // loc("zirgen/circuit/recursion/micro.cpp":68:0)
-  MixState x2809{x2800.tot + x2613 * x2808.tot * x2800.mul, x2800.mul * x2808.mul};
+  MixState<Rows> x2809{x2800.tot + x2613 * x2808.tot * mixPows[177]};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2810{x2659.tot + x2659.mul * x2660, x2659.mul * (*mix)};
+  MixState<Rows> x2810{x2659.tot + mixPows[11] * x2660};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2811{x2810.tot + x2810.mul * x2663, x2810.mul * (*mix)};
+  MixState<Rows> x2811{x2810.tot + mixPows[12] * x2663};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2812{x2811.tot + x2811.mul * x2666, x2811.mul * (*mix)};
+  MixState<Rows> x2812{x2811.tot + mixPows[13] * x2666};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2813{x2812.tot + x2812.mul * x2669, x2812.mul * (*mix)};
+  MixState<Rows> x2813{x2812.tot + mixPows[14] * x2669};
   // loc("zirgen/circuit/recursion/micro.cpp":75:0)
-  MixState x2814{x2809.tot + x2616 * x2813.tot * x2809.mul, x2809.mul * x2813.mul};
+  MixState<Rows> x2814{x2809.tot + x2616 * x2813.tot * mixPows[188]};
   // loc("zirgen/circuit/recursion/micro.cpp":94:0)
   auto x2815 = x2633 * x2663;
   // loc("zirgen/circuit/recursion/micro.cpp":94:0)
-  MixState x2816{x2656.tot + x2656.mul * x2815, x2656.mul * (*mix)};
+  MixState<Rows> x2816{x2656.tot + mixPows[10] * x2815};
   // loc("zirgen/circuit/recursion/micro.cpp":95:0)
   auto x2817 = x2634 * x2666;
   // loc("zirgen/circuit/recursion/micro.cpp":95:0)
-  MixState x2818{x2816.tot + x2816.mul * x2817, x2816.mul * (*mix)};
+  MixState<Rows> x2818{x2816.tot + mixPows[11] * x2817};
   // loc("zirgen/circuit/recursion/micro.cpp":96:0)
   auto x2819 = x2634 * x2669;
   // loc("zirgen/circuit/recursion/micro.cpp":96:0)
-  MixState x2820{x2818.tot + x2818.mul * x2819, x2818.mul * (*mix)};
+  MixState<Rows> x2820{x2818.tot + mixPows[12] * x2819};
   // loc("zirgen/circuit/recursion/micro.cpp":82:0)
-  MixState x2821{x2814.tot + x2619 * x2820.tot * x2814.mul, x2814.mul * x2820.mul};
+  MixState<Rows> x2821{x2814.tot + x2619 * x2820.tot * mixPows[203]};
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[0](recursion::MicroOp)/extra(Reg)"("zirgen/circuit/recursion/micro.cpp":107:0))
-  auto x2822 = args[2][101 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2822 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/micro.cpp":107:0)
   auto x2823 = x2635 * x2822;
   // loc("zirgen/circuit/recursion/micro.cpp":109:0)
@@ -5698,21 +5715,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":114:0)
   auto x2832 = x2791 - x2831;
   // loc("zirgen/circuit/recursion/micro.cpp":114:0)
-  MixState x2833{x2675.tot + x2675.mul * x2832, x2675.mul * (*mix)};
+  MixState<Rows> x2833{x2675.tot + mixPows[2] * x2832};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2834{x2833.tot + x2833.mul * x2658, x2833.mul * (*mix)};
+  MixState<Rows> x2834{x2833.tot + mixPows[3] * x2658};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2835 = x2660 - x2831;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2836{x2834.tot + x2834.mul * x2835, x2834.mul * (*mix)};
+  MixState<Rows> x2836{x2834.tot + mixPows[4] * x2835};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2837{x2836.tot + x2836.mul * x2663, x2836.mul * (*mix)};
+  MixState<Rows> x2837{x2836.tot + mixPows[5] * x2663};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2838{x2837.tot + x2837.mul * x2666, x2837.mul * (*mix)};
+  MixState<Rows> x2838{x2837.tot + mixPows[6] * x2666};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2839{x2838.tot + x2838.mul * x2669, x2838.mul * (*mix)};
+  MixState<Rows> x2839{x2838.tot + mixPows[7] * x2669};
   // loc("zirgen/circuit/recursion/micro.cpp":98:0)
-  MixState x2840{x2821.tot + x2622 * x2839.tot * x2821.mul, x2821.mul * x2839.mul};
+  MixState<Rows> x2840{x2821.tot + x2622 * x2839.tot * mixPows[216]};
   // loc("zirgen/circuit/recursion/micro.cpp":119:0)
   auto x2841 = x2635 * x2639;
   // loc("zirgen/circuit/recursion/micro.cpp":119:0)
@@ -5720,27 +5737,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2843 = x2647 - x2842;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2844{x2673.tot + x2673.mul * x2843, x2673.mul * (*mix)};
+  MixState<Rows> x2844{x2673.tot + mixPows[1] * x2843};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2845{x2844.tot + x2844.mul * x2658, x2844.mul * (*mix)};
+  MixState<Rows> x2845{x2844.tot + mixPows[2] * x2658};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2846 = x2660 - x2649;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2847{x2845.tot + x2845.mul * x2846, x2845.mul * (*mix)};
+  MixState<Rows> x2847{x2845.tot + mixPows[3] * x2846};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2848 = x2663 - x2651;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2849{x2847.tot + x2847.mul * x2848, x2847.mul * (*mix)};
+  MixState<Rows> x2849{x2847.tot + mixPows[4] * x2848};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2850 = x2666 - x2653;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2851{x2849.tot + x2849.mul * x2850, x2849.mul * (*mix)};
+  MixState<Rows> x2851{x2849.tot + mixPows[5] * x2850};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2852 = x2669 - x2655;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2853{x2851.tot + x2851.mul * x2852, x2851.mul * (*mix)};
+  MixState<Rows> x2853{x2851.tot + mixPows[6] * x2852};
   // loc("zirgen/circuit/recursion/micro.cpp":117:0)
-  MixState x2854{x2840.tot + x2625 * x2853.tot * x2840.mul, x2840.mul * x2853.mul};
+  MixState<Rows> x2854{x2840.tot + x2625 * x2853.tot * mixPows[224]};
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
   auto x2855 = x1 - x2635;
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
@@ -5766,75 +5783,75 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
   auto x2866 = x2865 + x2857;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2867{x2748.tot + x2748.mul * x2658, x2748.mul * (*mix)};
+  MixState<Rows> x2867{x2748.tot + mixPows[6] * x2658};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2868 = x2660 - x2866;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2869{x2867.tot + x2867.mul * x2868, x2867.mul * (*mix)};
+  MixState<Rows> x2869{x2867.tot + mixPows[7] * x2868};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2870{x2869.tot + x2869.mul * x2663, x2869.mul * (*mix)};
+  MixState<Rows> x2870{x2869.tot + mixPows[8] * x2663};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2871{x2870.tot + x2870.mul * x2666, x2870.mul * (*mix)};
+  MixState<Rows> x2871{x2870.tot + mixPows[9] * x2666};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2872{x2871.tot + x2871.mul * x2669, x2871.mul * (*mix)};
+  MixState<Rows> x2872{x2871.tot + mixPows[10] * x2669};
   // loc("zirgen/circuit/recursion/micro.cpp":129:0)
-  MixState x2873{x2854.tot + x2628 * x2872.tot * x2854.mul, x2854.mul * x2872.mul};
+  MixState<Rows> x2873{x2854.tot + x2628 * x2872.tot * mixPows[231]};
   // loc("zirgen/circuit/recursion/micro.cpp":151:0)
   auto x2874 = x2328 + x2;
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[2](recursion::MicroInst)/opcode(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x2875 = args[0][15 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2875 = Rows::load(args[0] + 15 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/add(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2876 = args[2][115 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2876 = Rows::load(args[2] + 115 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/sub(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2877 = args[2][116 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2877 = Rows::load(args[2] + 116 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2878 = x2877 * x2;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2879 = x2876 + x2878;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/mul(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2880 = args[2][117 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2880 = Rows::load(args[2] + 117 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2881 = x2880 * x3;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2882 = x2879 + x2881;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/inv(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2883 = args[2][118 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2883 = Rows::load(args[2] + 118 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2884 = x2883 * x4;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2885 = x2882 + x2884;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/eq(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2886 = args[2][119 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2886 = Rows::load(args[2] + 119 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2887 = x2886 * x5;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2888 = x2885 + x2887;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/read_iop_header(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2889 = args[2][120 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2889 = Rows::load(args[2] + 120 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2890 = x2889 * x6;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2891 = x2888 + x2890;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/read_iop_body(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2892 = args[2][121 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2892 = Rows::load(args[2] + 121 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2893 = x2892 * x7;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2894 = x2891 + x2893;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/mix_rng(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2895 = args[2][122 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2895 = Rows::load(args[2] + 122 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2896 = x2895 * x8;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2897 = x2894 + x2896;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/select(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2898 = args[2][123 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2898 = Rows::load(args[2] + 123 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2899 = x2898 * x9;
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2900 = x2897 + x2899;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/extract(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x2901 = args[2][124 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2901 = Rows::load(args[2] + 124 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/onehot.h":46:0)
   auto x2902 = x2901 * x10;
   // loc("./zirgen/components/onehot.h":46:0)
@@ -5842,93 +5859,93 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":40:0)
   auto x2904 = x2903 - x2875;
   // loc("./zirgen/components/onehot.h":40:0)
-  MixState x2905{x2873.tot + x2873.mul * x2904, x2873.mul * (*mix)};
+  MixState<Rows> x2905{x2873.tot + mixPows[242] * x2904};
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[2](recursion::MicroInst)/operand[0](Reg)"("zirgen/circuit/recursion/micro.cpp":14:0))
-  auto x2906 = args[0][16 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2906 = Rows::load(args[0] + 16 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[2](recursion::MicroInst)/operand[1](Reg)"("zirgen/circuit/recursion/micro.cpp":15:0))
-  auto x2907 = args[0][17 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2907 = Rows::load(args[0] + 17 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/micro_ops(recursion::MicroInsts)/inst[2](recursion::MicroInst)/operand[2](Reg)"("zirgen/circuit/recursion/micro.cpp":16:0))
-  auto x2908 = args[0][18 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2908 = Rows::load(args[0] + 18 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/decode(OneHot)/constop(Reg)"("zirgen/circuit/recursion/micro.cpp":19:0))
-  auto x2909 = args[2][114 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2909 = Rows::load(args[2] + 114 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  auto x2910 = args[2][35 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2910 = Rows::load(args[2] + 35 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2911{x2326.tot + x2326.mul * x2910, x2326.mul * (*mix)};
+  MixState<Rows> x2911{x2326.tot + mixPows[0] * x2910};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2912 = args[2][36 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2912 = Rows::load(args[2] + 36 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2913{x2911.tot + x2911.mul * x2912, x2911.mul * (*mix)};
+  MixState<Rows> x2913{x2911.tot + mixPows[1] * x2912};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2914 = args[2][37 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2914 = Rows::load(args[2] + 37 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2915{x2913.tot + x2913.mul * x2914, x2913.mul * (*mix)};
+  MixState<Rows> x2915{x2913.tot + mixPows[2] * x2914};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2916 = args[2][38 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2916 = Rows::load(args[2] + 38 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2917{x2915.tot + x2915.mul * x2916, x2915.mul * (*mix)};
+  MixState<Rows> x2917{x2915.tot + mixPows[3] * x2916};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2918 = args[2][39 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2918 = Rows::load(args[2] + 39 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2919{x2917.tot + x2917.mul * x2918, x2917.mul * (*mix)};
+  MixState<Rows> x2919{x2917.tot + mixPows[4] * x2918};
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  auto x2920 = args[2][40 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2920 = Rows::load(args[2] + 40 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x2921{x2919.tot + x2919.mul * x2920, x2919.mul * (*mix)};
+  MixState<Rows> x2921{x2919.tot + mixPows[5] * x2920};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2922 = args[2][41 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2922 = Rows::load(args[2] + 41 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2923{x2921.tot + x2921.mul * x2922, x2921.mul * (*mix)};
+  MixState<Rows> x2923{x2921.tot + mixPows[6] * x2922};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2924 = args[2][42 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2924 = Rows::load(args[2] + 42 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2925{x2923.tot + x2923.mul * x2924, x2923.mul * (*mix)};
+  MixState<Rows> x2925{x2923.tot + mixPows[7] * x2924};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2926 = args[2][43 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2926 = Rows::load(args[2] + 43 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2927{x2925.tot + x2925.mul * x2926, x2925.mul * (*mix)};
+  MixState<Rows> x2927{x2925.tot + mixPows[8] * x2926};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2928 = args[2][44 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2928 = Rows::load(args[2] + 44 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2929{x2927.tot + x2927.mul * x2928, x2927.mul * (*mix)};
+  MixState<Rows> x2929{x2927.tot + mixPows[9] * x2928};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  auto x2930 = args[2][45 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2930 = Rows::load(args[2] + 45 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x2931 = x2930 - x2874;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2932{x2929.tot + x2929.mul * x2931, x2929.mul * (*mix)};
+  MixState<Rows> x2932{x2929.tot + mixPows[10] * x2931};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2933 = args[2][46 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2933 = Rows::load(args[2] + 46 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2934 = x2933 - x2906;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2935{x2932.tot + x2932.mul * x2934, x2932.mul * (*mix)};
+  MixState<Rows> x2935{x2932.tot + mixPows[11] * x2934};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2936 = args[2][47 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2936 = Rows::load(args[2] + 47 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2937 = x2936 - x2907;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2938{x2935.tot + x2935.mul * x2937, x2935.mul * (*mix)};
+  MixState<Rows> x2938{x2935.tot + mixPows[12] * x2937};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2939 = args[2][48 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2939 = Rows::load(args[2] + 48 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2940 = x2939 - x2908;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2941{x2938.tot + x2938.mul * x2940, x2938.mul * (*mix)};
+  MixState<Rows> x2941{x2938.tot + mixPows[13] * x2940};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  auto x2942 = args[2][49 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x2942 = Rows::load(args[2] + 49 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2943{x2941.tot + x2941.mul * x2942, x2941.mul * (*mix)};
+  MixState<Rows> x2943{x2941.tot + mixPows[14] * x2942};
   // loc("zirgen/circuit/recursion/micro.cpp":19:0)
-  MixState x2944{x2905.tot + x2909 * x2943.tot * x2905.mul, x2905.mul * x2943.mul};
+  MixState<Rows> x2944{x2905.tot + x2909 * x2943.tot * mixPows[243]};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2945 = x2910 - x2906;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2946{x2326.tot + x2326.mul * x2945, x2326.mul * (*mix)};
+  MixState<Rows> x2946{x2326.tot + mixPows[0] * x2945};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x2947 = x2920 - x2907;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x2948{x2946.tot + x2946.mul * x2947, x2946.mul * (*mix)};
+  MixState<Rows> x2948{x2946.tot + mixPows[1] * x2947};
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
   auto x2949 = x2912 + x2922;
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
@@ -5938,25 +5955,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":28:0)
   auto x2952 = x2918 + x2928;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x2953{x2948.tot + x2948.mul * x2931, x2948.mul * (*mix)};
+  MixState<Rows> x2953{x2948.tot + mixPows[2] * x2931};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2954 = x2933 - x2949;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2955{x2953.tot + x2953.mul * x2954, x2953.mul * (*mix)};
+  MixState<Rows> x2955{x2953.tot + mixPows[3] * x2954};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2956 = x2936 - x2950;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2957{x2955.tot + x2955.mul * x2956, x2955.mul * (*mix)};
+  MixState<Rows> x2957{x2955.tot + mixPows[4] * x2956};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2958 = x2939 - x2951;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2959{x2957.tot + x2957.mul * x2958, x2957.mul * (*mix)};
+  MixState<Rows> x2959{x2957.tot + mixPows[5] * x2958};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2960 = x2942 - x2952;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2961{x2959.tot + x2959.mul * x2960, x2959.mul * (*mix)};
+  MixState<Rows> x2961{x2959.tot + mixPows[6] * x2960};
   // loc("zirgen/circuit/recursion/micro.cpp":25:0)
-  MixState x2962{x2944.tot + x2876 * x2961.tot * x2944.mul, x2944.mul * x2961.mul};
+  MixState<Rows> x2962{x2944.tot + x2876 * x2961.tot * mixPows[258]};
   // loc("zirgen/circuit/recursion/micro.cpp":34:0)
   auto x2963 = x2912 - x2922;
   // loc("zirgen/circuit/recursion/micro.cpp":34:0)
@@ -5968,21 +5985,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2967 = x2933 - x2963;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2968{x2953.tot + x2953.mul * x2967, x2953.mul * (*mix)};
+  MixState<Rows> x2968{x2953.tot + mixPows[3] * x2967};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2969 = x2936 - x2964;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2970{x2968.tot + x2968.mul * x2969, x2968.mul * (*mix)};
+  MixState<Rows> x2970{x2968.tot + mixPows[4] * x2969};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2971 = x2939 - x2965;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2972{x2970.tot + x2970.mul * x2971, x2970.mul * (*mix)};
+  MixState<Rows> x2972{x2970.tot + mixPows[5] * x2971};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x2973 = x2942 - x2966;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x2974{x2972.tot + x2972.mul * x2973, x2972.mul * (*mix)};
+  MixState<Rows> x2974{x2972.tot + mixPows[6] * x2973};
   // loc("zirgen/circuit/recursion/micro.cpp":31:0)
-  MixState x2975{x2962.tot + x2877 * x2974.tot * x2962.mul, x2962.mul * x2974.mul};
+  MixState<Rows> x2975{x2962.tot + x2877 * x2974.tot * mixPows[265]};
   // loc("zirgen/circuit/recursion/micro.cpp":40:0)
   auto x2976 = x2918 * x2924;
   // loc("zirgen/circuit/recursion/micro.cpp":40:0)
@@ -6048,33 +6065,33 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3007 = x2933 - x2983;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3008{x2953.tot + x2953.mul * x3007, x2953.mul * (*mix)};
+  MixState<Rows> x3008{x2953.tot + mixPows[3] * x3007};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3009 = x2936 - x2991;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3010{x3008.tot + x3008.mul * x3009, x3008.mul * (*mix)};
+  MixState<Rows> x3010{x3008.tot + mixPows[4] * x3009};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3011 = x2939 - x2999;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3012{x3010.tot + x3010.mul * x3011, x3010.mul * (*mix)};
+  MixState<Rows> x3012{x3010.tot + mixPows[5] * x3011};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3013 = x2942 - x3006;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3014{x3012.tot + x3012.mul * x3013, x3012.mul * (*mix)};
+  MixState<Rows> x3014{x3012.tot + mixPows[6] * x3013};
   // loc("zirgen/circuit/recursion/micro.cpp":37:0)
-  MixState x3015{x2975.tot + x2880 * x3014.tot * x2975.mul, x2975.mul * x3014.mul};
+  MixState<Rows> x3015{x2975.tot + x2880 * x3014.tot * mixPows[272]};
   // loc("zirgen/circuit/recursion/micro.cpp":43:0)
   auto x3016 = x2883 * x2907;
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x3017{x2946.tot + x2946.mul * x2920, x2946.mul * (*mix)};
+  MixState<Rows> x3017{x2946.tot + mixPows[1] * x2920};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3018{x3017.tot + x3017.mul * x2922, x3017.mul * (*mix)};
+  MixState<Rows> x3018{x3017.tot + mixPows[2] * x2922};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3019{x3018.tot + x3018.mul * x2924, x3018.mul * (*mix)};
+  MixState<Rows> x3019{x3018.tot + mixPows[3] * x2924};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3020{x3019.tot + x3019.mul * x2926, x3019.mul * (*mix)};
+  MixState<Rows> x3020{x3019.tot + mixPows[4] * x2926};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3021{x3020.tot + x3020.mul * x2928, x3020.mul * (*mix)};
+  MixState<Rows> x3021{x3020.tot + mixPows[5] * x2928};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x3022 = x2918 * x2936;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
@@ -6140,89 +6157,89 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x3053 = x1 - x3029;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x3054{x3021.tot + x3021.mul * x3053, x3021.mul * (*mix)};
+  MixState<Rows> x3054{x3021.tot + mixPows[6] * x3053};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x3055 = x0 - x3037;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x3056{x3054.tot + x3054.mul * x3055, x3054.mul * (*mix)};
+  MixState<Rows> x3056{x3054.tot + mixPows[7] * x3055};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x3057 = x0 - x3045;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x3058{x3056.tot + x3056.mul * x3057, x3056.mul * (*mix)};
+  MixState<Rows> x3058{x3056.tot + mixPows[8] * x3057};
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
   auto x3059 = x0 - x3052;
   // loc("zirgen/circuit/recursion/micro.cpp":48:0)
-  MixState x3060{x3058.tot + x3058.mul * x3059, x3058.mul * (*mix)};
+  MixState<Rows> x3060{x3058.tot + mixPows[9] * x3059};
   // loc("zirgen/circuit/recursion/micro.cpp":43:0)
-  MixState x3061{x3015.tot + x3016 * x3060.tot * x3015.mul, x3015.mul * x3060.mul};
+  MixState<Rows> x3061{x3015.tot + x3016 * x3060.tot * mixPows[279]};
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
   auto x3062 = x1 - x2907;
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
   auto x3063 = x2883 * x3062;
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[2](recursion::MicroOp)/extra(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3064 = args[2][125 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3064 = Rows::load(args[2] + 125 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
   auto x3065 = x1 - x2933;
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
   auto x3066 = x2933 * x3065;
   // loc("zirgen/circuit/recursion/micro.cpp":61:0)
-  MixState x3067{x3021.tot + x3021.mul * x3066, x3021.mul * (*mix)};
+  MixState<Rows> x3067{x3021.tot + mixPows[6] * x3066};
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
   auto x3068 = x3064 * x2912;
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
   auto x3069 = x3068 - x3065;
   // loc("zirgen/circuit/recursion/micro.cpp":63:0)
-  MixState x3070{x3067.tot + x3067.mul * x3069, x3067.mul * (*mix)};
+  MixState<Rows> x3070{x3067.tot + mixPows[7] * x3069};
   // loc("zirgen/circuit/recursion/micro.cpp":65:0)
   auto x3071 = x2933 * x2912;
   // loc("zirgen/circuit/recursion/micro.cpp":65:0)
-  MixState x3072{x3070.tot + x3070.mul * x3071, x3070.mul * (*mix)};
+  MixState<Rows> x3072{x3070.tot + mixPows[8] * x3071};
   // loc("zirgen/circuit/recursion/micro.cpp":50:0)
-  MixState x3073{x3061.tot + x3063 * x3072.tot * x3061.mul, x3061.mul * x3072.mul};
+  MixState<Rows> x3073{x3061.tot + x3063 * x3072.tot * mixPows[289]};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x3074 = x0 - x2933;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x3075{x2974.tot + x2974.mul * x3074, x2974.mul * (*mix)};
+  MixState<Rows> x3075{x2974.tot + mixPows[7] * x3074};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x3076 = x0 - x2936;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x3077{x3075.tot + x3075.mul * x3076, x3075.mul * (*mix)};
+  MixState<Rows> x3077{x3075.tot + mixPows[8] * x3076};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x3078 = x0 - x2939;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x3079{x3077.tot + x3077.mul * x3078, x3077.mul * (*mix)};
+  MixState<Rows> x3079{x3077.tot + mixPows[9] * x3078};
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
   auto x3080 = x0 - x2942;
   // loc("zirgen/circuit/recursion/micro.cpp":73:0)
-  MixState x3081{x3079.tot + x3079.mul * x3080, x3079.mul * (*mix)};
+  MixState<Rows> x3081{x3079.tot + mixPows[10] * x3080};
   // loc("zirgen/circuit/recursion/micro.cpp":68:0)
-  MixState x3082{x3073.tot + x2886 * x3081.tot * x3073.mul, x3073.mul * x3081.mul};
+  MixState<Rows> x3082{x3073.tot + x2886 * x3081.tot * mixPows[298]};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3083{x2932.tot + x2932.mul * x2933, x2932.mul * (*mix)};
+  MixState<Rows> x3083{x2932.tot + mixPows[11] * x2933};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3084{x3083.tot + x3083.mul * x2936, x3083.mul * (*mix)};
+  MixState<Rows> x3084{x3083.tot + mixPows[12] * x2936};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3085{x3084.tot + x3084.mul * x2939, x3084.mul * (*mix)};
+  MixState<Rows> x3085{x3084.tot + mixPows[13] * x2939};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3086{x3085.tot + x3085.mul * x2942, x3085.mul * (*mix)};
+  MixState<Rows> x3086{x3085.tot + mixPows[14] * x2942};
   // loc("zirgen/circuit/recursion/micro.cpp":75:0)
-  MixState x3087{x3082.tot + x2889 * x3086.tot * x3082.mul, x3082.mul * x3086.mul};
+  MixState<Rows> x3087{x3082.tot + x2889 * x3086.tot * mixPows[309]};
   // loc("zirgen/circuit/recursion/micro.cpp":94:0)
   auto x3088 = x2906 * x2936;
   // loc("zirgen/circuit/recursion/micro.cpp":94:0)
-  MixState x3089{x2929.tot + x2929.mul * x3088, x2929.mul * (*mix)};
+  MixState<Rows> x3089{x2929.tot + mixPows[10] * x3088};
   // loc("zirgen/circuit/recursion/micro.cpp":95:0)
   auto x3090 = x2907 * x2939;
   // loc("zirgen/circuit/recursion/micro.cpp":95:0)
-  MixState x3091{x3089.tot + x3089.mul * x3090, x3089.mul * (*mix)};
+  MixState<Rows> x3091{x3089.tot + mixPows[11] * x3090};
   // loc("zirgen/circuit/recursion/micro.cpp":96:0)
   auto x3092 = x2907 * x2942;
   // loc("zirgen/circuit/recursion/micro.cpp":96:0)
-  MixState x3093{x3091.tot + x3091.mul * x3092, x3091.mul * (*mix)};
+  MixState<Rows> x3093{x3091.tot + mixPows[12] * x3092};
   // loc("zirgen/circuit/recursion/micro.cpp":82:0)
-  MixState x3094{x3087.tot + x2892 * x3093.tot * x3087.mul, x3087.mul * x3093.mul};
+  MixState<Rows> x3094{x3087.tot + x2892 * x3093.tot * mixPows[324]};
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/op[1](recursion::MicroOp)/extra(Reg)"("zirgen/circuit/recursion/micro.cpp":107:0))
-  auto x3095 = args[2][113 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3095 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/micro.cpp":107:0)
   auto x3096 = x2908 * x3095;
   // loc("zirgen/circuit/recursion/micro.cpp":109:0)
@@ -6244,21 +6261,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":114:0)
   auto x3105 = x3064 - x3104;
   // loc("zirgen/circuit/recursion/micro.cpp":114:0)
-  MixState x3106{x2948.tot + x2948.mul * x3105, x2948.mul * (*mix)};
+  MixState<Rows> x3106{x2948.tot + mixPows[2] * x3105};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x3107{x3106.tot + x3106.mul * x2931, x3106.mul * (*mix)};
+  MixState<Rows> x3107{x3106.tot + mixPows[3] * x2931};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3108 = x2933 - x3104;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3109{x3107.tot + x3107.mul * x3108, x3107.mul * (*mix)};
+  MixState<Rows> x3109{x3107.tot + mixPows[4] * x3108};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3110{x3109.tot + x3109.mul * x2936, x3109.mul * (*mix)};
+  MixState<Rows> x3110{x3109.tot + mixPows[5] * x2936};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3111{x3110.tot + x3110.mul * x2939, x3110.mul * (*mix)};
+  MixState<Rows> x3111{x3110.tot + mixPows[6] * x2939};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3112{x3111.tot + x3111.mul * x2942, x3111.mul * (*mix)};
+  MixState<Rows> x3112{x3111.tot + mixPows[7] * x2942};
   // loc("zirgen/circuit/recursion/micro.cpp":98:0)
-  MixState x3113{x3094.tot + x2895 * x3112.tot * x3094.mul, x3094.mul * x3112.mul};
+  MixState<Rows> x3113{x3094.tot + x2895 * x3112.tot * mixPows[337]};
   // loc("zirgen/circuit/recursion/micro.cpp":119:0)
   auto x3114 = x2908 * x2912;
   // loc("zirgen/circuit/recursion/micro.cpp":119:0)
@@ -6266,27 +6283,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x3116 = x2920 - x3115;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x3117{x2946.tot + x2946.mul * x3116, x2946.mul * (*mix)};
+  MixState<Rows> x3117{x2946.tot + mixPows[1] * x3116};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x3118{x3117.tot + x3117.mul * x2931, x3117.mul * (*mix)};
+  MixState<Rows> x3118{x3117.tot + mixPows[2] * x2931};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3119 = x2933 - x2922;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3120{x3118.tot + x3118.mul * x3119, x3118.mul * (*mix)};
+  MixState<Rows> x3120{x3118.tot + mixPows[3] * x3119};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3121 = x2936 - x2924;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3122{x3120.tot + x3120.mul * x3121, x3120.mul * (*mix)};
+  MixState<Rows> x3122{x3120.tot + mixPows[4] * x3121};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3123 = x2939 - x2926;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3124{x3122.tot + x3122.mul * x3123, x3122.mul * (*mix)};
+  MixState<Rows> x3124{x3122.tot + mixPows[5] * x3123};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3125 = x2942 - x2928;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3126{x3124.tot + x3124.mul * x3125, x3124.mul * (*mix)};
+  MixState<Rows> x3126{x3124.tot + mixPows[6] * x3125};
   // loc("zirgen/circuit/recursion/micro.cpp":117:0)
-  MixState x3127{x3113.tot + x2898 * x3126.tot * x3113.mul, x3113.mul * x3126.mul};
+  MixState<Rows> x3127{x3113.tot + x2898 * x3126.tot * mixPows[345]};
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
   auto x3128 = x1 - x2908;
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
@@ -6312,47 +6329,47 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/micro.cpp":135:0)
   auto x3139 = x3138 + x3130;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x3140{x3021.tot + x3021.mul * x2931, x3021.mul * (*mix)};
+  MixState<Rows> x3140{x3021.tot + mixPows[6] * x2931};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3141 = x2933 - x3139;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3142{x3140.tot + x3140.mul * x3141, x3140.mul * (*mix)};
+  MixState<Rows> x3142{x3140.tot + mixPows[7] * x3141};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3143{x3142.tot + x3142.mul * x2936, x3142.mul * (*mix)};
+  MixState<Rows> x3143{x3142.tot + mixPows[8] * x2936};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3144{x3143.tot + x3143.mul * x2939, x3143.mul * (*mix)};
+  MixState<Rows> x3144{x3143.tot + mixPows[9] * x2939};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3145{x3144.tot + x3144.mul * x2942, x3144.mul * (*mix)};
+  MixState<Rows> x3145{x3144.tot + mixPows[10] * x2942};
   // loc("zirgen/circuit/recursion/micro.cpp":129:0)
-  MixState x3146{x3127.tot + x2901 * x3145.tot * x3127.mul, x3127.mul * x3145.mul};
+  MixState<Rows> x3146{x3127.tot + x2901 * x3145.tot * mixPows[352]};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x3147{x2326.tot + x2327 * x3146.tot * x2326.mul, x2326.mul * x3146.mul};
+  MixState<Rows> x3147{x2326.tot + x2327 * x3146.tot * mixPows[0]};
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/macro_ops(Reg)"("./zirgen/components/mux.h":49:0))
-  auto x3148 = args[0][2 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3148 = Rows::load(args[0] + 2 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x3149{x2326.tot + x2360 * x2326.tot * x2326.mul, x2326.mul * x2326.mul};
+  MixState<Rows> x3149{x2326.tot + x2360 * x2326.tot * mixPows[0]};
   // loc("zirgen/circuit/recursion/wom.cpp":17:0)
   auto x3150 = x2376 - x2328;
   // loc("zirgen/circuit/recursion/wom.cpp":17:0)
-  MixState x3151{x2326.tot + x2326.mul * x3150, x2326.mul * (*mix)};
+  MixState<Rows> x3151{x2326.tot + mixPows[0] * x3150};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3152{x3151.tot + x3151.mul * x2378, x3151.mul * (*mix)};
+  MixState<Rows> x3152{x3151.tot + mixPows[1] * x2378};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3153{x3152.tot + x3152.mul * x2380, x3152.mul * (*mix)};
+  MixState<Rows> x3153{x3152.tot + mixPows[2] * x2380};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3154{x3153.tot + x3153.mul * x2382, x3153.mul * (*mix)};
+  MixState<Rows> x3154{x3153.tot + mixPows[3] * x2382};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3155{x3154.tot + x3154.mul * x2384, x3154.mul * (*mix)};
+  MixState<Rows> x3155{x3154.tot + mixPows[4] * x2384};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x3156{x3149.tot + x2361 * x3155.tot * x3149.mul, x3149.mul * x3155.mul};
+  MixState<Rows> x3156{x3149.tot + x2361 * x3155.tot * mixPows[0]};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x3157 = x2376 - x2907;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x3158{x2326.tot + x2326.mul * x3157, x2326.mul * (*mix)};
+  MixState<Rows> x3158{x2326.tot + mixPows[0] * x3157};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x3159 = x2387 - x2908;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x3160{x3158.tot + x3158.mul * x3159, x3158.mul * (*mix)};
+  MixState<Rows> x3160{x3158.tot + mixPows[1] * x3159};
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3161 = x2912 * x2914;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
@@ -6440,13 +6457,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3203 = x3196 + x3202;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3204 = args[2][50 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3204 = Rows::load(args[2] + 50 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3205 = x3204 * x17;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3206 = x3198 + x3205;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3207 = args[2][51 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3207 = Rows::load(args[2] + 51 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3208 = x3207 * x17;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6458,13 +6475,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3212 = x3203 + x3211;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3213 = args[2][52 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3213 = Rows::load(args[2] + 52 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3214 = x3213 * x18;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3215 = x3206 + x3214;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3216 = args[2][53 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3216 = Rows::load(args[2] + 53 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3217 = x3216 * x18;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6476,13 +6493,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3221 = x3212 + x3220;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3222 = args[2][54 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3222 = Rows::load(args[2] + 54 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3223 = x3222 * x20;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3224 = x3215 + x3223;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3225 = args[2][55 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3225 = Rows::load(args[2] + 55 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3226 = x3225 * x20;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6494,13 +6511,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3230 = x3221 + x3229;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3231 = args[2][56 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3231 = Rows::load(args[2] + 56 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3232 = x3231 * x21;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3233 = x3224 + x3232;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3234 = args[2][57 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3234 = Rows::load(args[2] + 57 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3235 = x3234 * x21;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6512,13 +6529,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3239 = x3230 + x3238;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3240 = args[2][58 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3240 = Rows::load(args[2] + 58 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3241 = x3240 * x22;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3242 = x3233 + x3241;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3243 = args[2][59 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3243 = Rows::load(args[2] + 59 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3244 = x3243 * x22;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6530,13 +6547,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3248 = x3239 + x3247;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3249 = args[2][60 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3249 = Rows::load(args[2] + 60 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3250 = x3249 * x23;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3251 = x3242 + x3250;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3252 = args[2][61 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3252 = Rows::load(args[2] + 61 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3253 = x3252 * x23;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6548,13 +6565,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3257 = x3248 + x3256;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3258 = args[2][62 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3258 = Rows::load(args[2] + 62 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3259 = x3258 * x24;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3260 = x3251 + x3259;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3261 = args[2][63 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3261 = Rows::load(args[2] + 63 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3262 = x3261 * x24;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6566,13 +6583,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3266 = x3257 + x3265;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3267 = args[2][64 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3267 = Rows::load(args[2] + 64 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3268 = x3267 * x25;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3269 = x3260 + x3268;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3270 = args[2][65 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3270 = Rows::load(args[2] + 65 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3271 = x3270 * x25;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6584,13 +6601,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3275 = x3266 + x3274;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3276 = args[2][66 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3276 = Rows::load(args[2] + 66 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3277 = x3276 * x26;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3278 = x3269 + x3277;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3279 = args[2][67 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3279 = Rows::load(args[2] + 67 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3280 = x3279 * x26;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6602,13 +6619,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3284 = x3275 + x3283;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3285 = args[2][68 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3285 = Rows::load(args[2] + 68 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3286 = x3285 * x12;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3287 = x3278 + x3286;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3288 = args[2][69 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3288 = Rows::load(args[2] + 69 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3289 = x3288 * x12;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6620,13 +6637,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3293 = x3284 + x3292;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3294 = args[2][70 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3294 = Rows::load(args[2] + 70 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3295 = x3294 * x28;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3296 = x3287 + x3295;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3297 = args[2][71 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3297 = Rows::load(args[2] + 71 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3298 = x3297 * x28;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6638,13 +6655,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3302 = x3293 + x3301;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3303 = args[2][72 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3303 = Rows::load(args[2] + 72 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3304 = x3303 * x29;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3305 = x3296 + x3304;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3306 = args[2][73 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3306 = Rows::load(args[2] + 73 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3307 = x3306 * x29;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6656,13 +6673,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3311 = x3302 + x3310;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3312 = args[2][74 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3312 = Rows::load(args[2] + 74 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3313 = x3312 * x30;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3314 = x3305 + x3313;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3315 = args[2][75 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3315 = Rows::load(args[2] + 75 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3316 = x3315 * x30;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6674,13 +6691,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3320 = x3311 + x3319;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3321 = args[2][76 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3321 = Rows::load(args[2] + 76 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3322 = x3321 * x31;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3323 = x3314 + x3322;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3324 = args[2][77 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3324 = Rows::load(args[2] + 77 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3325 = x3324 * x31;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6692,13 +6709,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3329 = x3320 + x3328;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3330 = args[2][78 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3330 = Rows::load(args[2] + 78 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3331 = x3330 * x32;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3332 = x3323 + x3331;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3333 = args[2][79 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3333 = Rows::load(args[2] + 79 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3334 = x3333 * x32;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6710,13 +6727,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3338 = x3329 + x3337;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3339 = args[2][80 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3339 = Rows::load(args[2] + 80 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3340 = x3339 * x33;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3341 = x3332 + x3340;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3342 = args[2][81 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3342 = Rows::load(args[2] + 81 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3343 = x3342 * x33;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6728,13 +6745,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3347 = x3338 + x3346;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3348 = args[2][82 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3348 = Rows::load(args[2] + 82 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3349 = x3348 * x34;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3350 = x3341 + x3349;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3351 = args[2][83 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3351 = Rows::load(args[2] + 83 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3352 = x3351 * x34;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6746,13 +6763,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3356 = x3347 + x3355;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3357 = args[2][84 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3357 = Rows::load(args[2] + 84 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3358 = x3357 * x35;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3359 = x3350 + x3358;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3360 = args[2][85 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3360 = Rows::load(args[2] + 85 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3361 = x3360 * x35;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6764,13 +6781,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3365 = x3356 + x3364;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3366 = args[2][86 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3366 = Rows::load(args[2] + 86 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3367 = x3366 * x36;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3368 = x3359 + x3367;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3369 = args[2][87 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3369 = Rows::load(args[2] + 87 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3370 = x3369 * x36;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6782,13 +6799,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":80:0)
   auto x3374 = x3365 + x3373;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_a[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3375 = args[2][88 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3375 = Rows::load(args[2] + 88 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3376 = x3375 * x37;
   // loc("zirgen/circuit/recursion/bits.cpp":78:0)
   auto x3377 = x3368 + x3376;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/bits_b[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3378 = args[2][89 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3378 = Rows::load(args[2] + 89 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
   auto x3379 = x3378 * x37;
   // loc("zirgen/circuit/recursion/bits.cpp":79:0)
@@ -6858,29 +6875,29 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":82:0)
   auto x3412 = x3406 - x2378;
   // loc("zirgen/circuit/recursion/bits.cpp":82:0)
-  MixState x3413{x3160.tot + x3160.mul * x3412, x3160.mul * (*mix)};
+  MixState<Rows> x3413{x3160.tot + mixPows[2] * x3412};
   // loc("zirgen/circuit/recursion/bits.cpp":83:0)
   auto x3414 = x3408 - x2390;
   // loc("zirgen/circuit/recursion/bits.cpp":83:0)
-  MixState x3415{x3413.tot + x3413.mul * x3414, x3413.mul * (*mix)};
+  MixState<Rows> x3415{x3413.tot + mixPows[3] * x3414};
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x3416 = x2639 - x2328;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x3417{x3415.tot + x3415.mul * x3416, x3415.mul * (*mix)};
+  MixState<Rows> x3417{x3415.tot + mixPows[4] * x3416};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3418 = x2641 - x3411;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3419{x3417.tot + x3417.mul * x3418, x3417.mul * (*mix)};
+  MixState<Rows> x3419{x3417.tot + mixPows[5] * x3418};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3420{x3419.tot + x3419.mul * x2643, x3419.mul * (*mix)};
+  MixState<Rows> x3420{x3419.tot + mixPows[6] * x2643};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3421{x3420.tot + x3420.mul * x2645, x3420.mul * (*mix)};
+  MixState<Rows> x3421{x3420.tot + mixPows[7] * x2645};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3422{x3421.tot + x3421.mul * x2647, x3421.mul * (*mix)};
+  MixState<Rows> x3422{x3421.tot + mixPows[8] * x2647};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x3423{x3156.tot + x2362 * x3422.tot * x3156.mul, x3156.mul * x3422.mul};
+  MixState<Rows> x3423{x3156.tot + x2362 * x3422.tot * mixPows[5]};
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/macro_ops(recursion::MacroInst)/operand[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3424 = args[0][19 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x3424 = Rows::load(args[0] + 19 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/bits.cpp":36:0)
   auto x3425 = x2912 * x3285;
   // loc("zirgen/circuit/recursion/bits.cpp":34:0)
@@ -7096,11 +7113,11 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":38:0)
   auto x3531 = x3525 - x2378;
   // loc("zirgen/circuit/recursion/bits.cpp":38:0)
-  MixState x3532{x3160.tot + x3160.mul * x3531, x3160.mul * (*mix)};
+  MixState<Rows> x3532{x3160.tot + mixPows[2] * x3531};
   // loc("zirgen/circuit/recursion/bits.cpp":39:0)
   auto x3533 = x3527 - x2390;
   // loc("zirgen/circuit/recursion/bits.cpp":39:0)
-  MixState x3534{x3532.tot + x3532.mul * x3533, x3532.mul * (*mix)};
+  MixState<Rows> x3534{x3532.tot + mixPows[3] * x3533};
   // loc("zirgen/circuit/recursion/bits.cpp":36:0)
   auto x3535 = x3213 * x3357;
   // loc("zirgen/circuit/recursion/bits.cpp":34:0)
@@ -7314,29 +7331,29 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/bits.cpp":38:0)
   auto x3640 = x3634 - x2380;
   // loc("zirgen/circuit/recursion/bits.cpp":38:0)
-  MixState x3641{x3534.tot + x3534.mul * x3640, x3534.mul * (*mix)};
+  MixState<Rows> x3641{x3534.tot + mixPows[4] * x3640};
   // loc("zirgen/circuit/recursion/bits.cpp":39:0)
   auto x3642 = x3636 - x2393;
   // loc("zirgen/circuit/recursion/bits.cpp":39:0)
-  MixState x3643{x3641.tot + x3641.mul * x3642, x3641.mul * (*mix)};
+  MixState<Rows> x3643{x3641.tot + mixPows[5] * x3642};
   // loc("zirgen/circuit/recursion/bits.cpp":44:0)
   auto x3644 = x3639 * x12;
   // loc("zirgen/circuit/recursion/bits.cpp":44:0)
   auto x3645 = x3644 + x3530;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x3646{x2326.tot + x2326.mul * x3416, x2326.mul * (*mix)};
+  MixState<Rows> x3646{x2326.tot + mixPows[0] * x3416};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3647 = x2641 - x3645;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3648{x3646.tot + x3646.mul * x3647, x3646.mul * (*mix)};
+  MixState<Rows> x3648{x3646.tot + mixPows[1] * x3647};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3649{x3648.tot + x3648.mul * x2643, x3648.mul * (*mix)};
+  MixState<Rows> x3649{x3648.tot + mixPows[2] * x2643};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3650{x3649.tot + x3649.mul * x2645, x3649.mul * (*mix)};
+  MixState<Rows> x3650{x3649.tot + mixPows[3] * x2645};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3651{x3650.tot + x3650.mul * x2647, x3650.mul * (*mix)};
+  MixState<Rows> x3651{x3650.tot + mixPows[4] * x2647};
   // loc("zirgen/circuit/recursion/bits.cpp":42:0)
-  MixState x3652{x3643.tot + x3424 * x3651.tot * x3643.mul, x3643.mul * x3651.mul};
+  MixState<Rows> x3652{x3643.tot + x3424 * x3651.tot * mixPows[6]};
   // loc("zirgen/circuit/recursion/bits.cpp":47:0)
   auto x3653 = x1 - x3424;
   // loc("zirgen/circuit/recursion/bits.cpp":50:0)
@@ -7354,19 +7371,19 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3660 = x2641 - x3656;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3661{x3646.tot + x3646.mul * x3660, x3646.mul * (*mix)};
+  MixState<Rows> x3661{x3646.tot + mixPows[1] * x3660};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x3662 = x2643 - x3659;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3663{x3661.tot + x3661.mul * x3662, x3661.mul * (*mix)};
+  MixState<Rows> x3663{x3661.tot + mixPows[2] * x3662};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3664{x3663.tot + x3663.mul * x2645, x3663.mul * (*mix)};
+  MixState<Rows> x3664{x3663.tot + mixPows[3] * x2645};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x3665{x3664.tot + x3664.mul * x2647, x3664.mul * (*mix)};
+  MixState<Rows> x3665{x3664.tot + mixPows[4] * x2647};
   // loc("zirgen/circuit/recursion/bits.cpp":47:0)
-  MixState x3666{x3652.tot + x3653 * x3665.tot * x3652.mul, x3652.mul * x3665.mul};
+  MixState<Rows> x3666{x3652.tot + x3653 * x3665.tot * mixPows[11]};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x3667{x3423.tot + x2602 * x3666.tot * x3423.mul, x3423.mul * x3666.mul};
+  MixState<Rows> x3667{x3423.tot + x2602 * x3666.tot * mixPows[14]};
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
   auto x3668 = x2340 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -7440,7 +7457,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x3703 = x3701 * x3702;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x3704{x3160.tot + x3160.mul * x3703, x3160.mul * (*mix)};
+  MixState<Rows> x3704{x3160.tot + mixPows[2] * x3703};
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
   auto x3705 = x2625 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -7514,7 +7531,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x3740 = x3738 * x3739;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x3741{x3704.tot + x3704.mul * x3740, x3704.mul * (*mix)};
+  MixState<Rows> x3741{x3704.tot + mixPows[3] * x3740};
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
   auto x3742 = x2651 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -7588,7 +7605,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x3777 = x3775 * x3776;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x3778{x3741.tot + x3741.mul * x3777, x3741.mul * (*mix)};
+  MixState<Rows> x3778{x3741.tot + mixPows[4] * x3777};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x3779 = x2380 + x3773;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -7660,7 +7677,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x3813 = x3811 * x3812;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x3814{x3778.tot + x3778.mul * x3813, x3778.mul * (*mix)};
+  MixState<Rows> x3814{x3778.tot + mixPows[5] * x3813};
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
   auto x3815 = x3252 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -7734,7 +7751,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x3850 = x3848 * x3849;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x3851{x3814.tot + x3814.mul * x3850, x3814.mul * (*mix)};
+  MixState<Rows> x3851{x3814.tot + mixPows[6] * x3850};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x3852 = x2393 + x3846;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -7810,77 +7827,77 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x3888 = x3886 * x3887;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x3889{x3851.tot + x3851.mul * x3888, x3851.mul * (*mix)};
+  MixState<Rows> x3889{x3851.tot + mixPows[7] * x3888};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x3890{x3667.tot + x2633 * x3889.tot * x3667.mul, x3667.mul * x3889.mul};
+  MixState<Rows> x3890{x3667.tot + x2633 * x3889.tot * mixPows[30]};
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x3891{x2326.tot + x2326.mul * x3703, x2326.mul * (*mix)};
+  MixState<Rows> x3891{x2326.tot + mixPows[0] * x3703};
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x3892{x3891.tot + x3891.mul * x3740, x3891.mul * (*mix)};
+  MixState<Rows> x3892{x3891.tot + mixPows[1] * x3740};
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3893 = args[2][26 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3893 = Rows::load(args[2] + 26 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3894 = args[2][27 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3894 = Rows::load(args[2] + 27 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3895 = args[2][28 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3895 = Rows::load(args[2] + 28 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3896 = args[2][29 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3896 = Rows::load(args[2] + 29 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3897 = args[2][30 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3897 = Rows::load(args[2] + 30 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3898 = args[2][31 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3898 = Rows::load(args[2] + 31 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3899 = args[2][32 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3899 = Rows::load(args[2] + 32 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3900 = args[2][33 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3900 = Rows::load(args[2] + 33 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3901 = args[2][34 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3901 = Rows::load(args[2] + 34 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3902 = args[2][35 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3902 = Rows::load(args[2] + 35 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3903 = args[2][36 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3903 = Rows::load(args[2] + 36 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3904 = args[2][37 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3904 = Rows::load(args[2] + 37 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3905 = args[2][38 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3905 = Rows::load(args[2] + 38 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3906 = args[2][39 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3906 = Rows::load(args[2] + 39 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3907 = args[2][40 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3907 = Rows::load(args[2] + 40 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3908 = args[2][41 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3908 = Rows::load(args[2] + 41 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3909 = args[2][42 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3909 = Rows::load(args[2] + 42 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3910 = args[2][43 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3910 = Rows::load(args[2] + 43 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3911 = args[2][44 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3911 = Rows::load(args[2] + 44 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3912 = args[2][45 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3912 = Rows::load(args[2] + 45 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3913 = args[2][46 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3913 = Rows::load(args[2] + 46 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3914 = args[2][47 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3914 = Rows::load(args[2] + 47 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3915 = args[2][48 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3915 = Rows::load(args[2] + 48 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3916 = args[2][49 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3916 = Rows::load(args[2] + 49 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3917 = args[2][50 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3917 = Rows::load(args[2] + 50 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3918 = args[2][51 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3918 = Rows::load(args[2] + 51 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3919 = args[2][52 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3919 = Rows::load(args[2] + 52 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3920 = args[2][53 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3920 = Rows::load(args[2] + 53 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3921 = args[2][54 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3921 = Rows::load(args[2] + 54 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3922 = args[2][55 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3922 = Rows::load(args[2] + 55 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3923 = args[2][56 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3923 = Rows::load(args[2] + 56 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3924 = args[2][57 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x3924 = Rows::load(args[2] + 57 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
   auto x3925 = x3894 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
@@ -8002,69 +8019,69 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
   auto x3984 = x3982 + x3983;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3985 = args[2][26 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3985 = Rows::load(args[2] + 26 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3986 = args[2][27 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3986 = Rows::load(args[2] + 27 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3987 = args[2][28 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3987 = Rows::load(args[2] + 28 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3988 = args[2][29 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3988 = Rows::load(args[2] + 29 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3989 = args[2][30 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3989 = Rows::load(args[2] + 30 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3990 = args[2][31 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3990 = Rows::load(args[2] + 31 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3991 = args[2][32 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3991 = Rows::load(args[2] + 32 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3992 = args[2][33 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3992 = Rows::load(args[2] + 33 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3993 = args[2][34 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3993 = Rows::load(args[2] + 34 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3994 = args[2][35 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3994 = Rows::load(args[2] + 35 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3995 = args[2][36 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3995 = Rows::load(args[2] + 36 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3996 = args[2][37 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3996 = Rows::load(args[2] + 37 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3997 = args[2][38 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3997 = Rows::load(args[2] + 38 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3998 = args[2][39 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3998 = Rows::load(args[2] + 39 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x3999 = args[2][40 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x3999 = Rows::load(args[2] + 40 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4000 = args[2][41 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4000 = Rows::load(args[2] + 41 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4001 = args[2][42 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4001 = Rows::load(args[2] + 42 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4002 = args[2][43 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4002 = Rows::load(args[2] + 43 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4003 = args[2][44 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4003 = Rows::load(args[2] + 44 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4004 = args[2][45 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4004 = Rows::load(args[2] + 45 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4005 = args[2][46 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4005 = Rows::load(args[2] + 46 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4006 = args[2][47 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4006 = Rows::load(args[2] + 47 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4007 = args[2][48 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4007 = Rows::load(args[2] + 48 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4008 = args[2][49 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4008 = Rows::load(args[2] + 49 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4009 = args[2][50 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4009 = Rows::load(args[2] + 50 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4010 = args[2][51 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4010 = Rows::load(args[2] + 51 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4011 = args[2][52 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4011 = Rows::load(args[2] + 52 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4012 = args[2][53 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4012 = Rows::load(args[2] + 53 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4013 = args[2][54 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4013 = Rows::load(args[2] + 54 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4014 = args[2][55 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4014 = Rows::load(args[2] + 55 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4015 = args[2][56 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4015 = Rows::load(args[2] + 56 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4016 = args[2][57 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4016 = Rows::load(args[2] + 57 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
   auto x4017 = x3986 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
@@ -8202,7 +8219,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x4084 = x4082 * x4083;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x4085{x3892.tot + x3892.mul * x4084, x3892.mul * (*mix)};
+  MixState<Rows> x4085{x3892.tot + mixPows[2] * x4084};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x4086 = x4078 + x4080;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -8218,71 +8235,71 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x4092 = x4090 * x4091;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x4093{x4085.tot + x4085.mul * x4092, x4085.mul * (*mix)};
+  MixState<Rows> x4093{x4085.tot + mixPows[3] * x4092};
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4094 = args[2][60 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4094 = Rows::load(args[2] + 60 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4095 = args[2][61 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4095 = Rows::load(args[2] + 61 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4096 = args[2][62 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4096 = Rows::load(args[2] + 62 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4097 = args[2][63 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4097 = Rows::load(args[2] + 63 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4098 = args[2][64 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4098 = Rows::load(args[2] + 64 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4099 = args[2][65 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4099 = Rows::load(args[2] + 65 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4100 = args[2][66 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4100 = Rows::load(args[2] + 66 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4101 = args[2][67 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4101 = Rows::load(args[2] + 67 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4102 = args[2][68 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4102 = Rows::load(args[2] + 68 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4103 = args[2][69 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4103 = Rows::load(args[2] + 69 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4104 = args[2][70 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4104 = Rows::load(args[2] + 70 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4105 = args[2][71 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4105 = Rows::load(args[2] + 71 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4106 = args[2][72 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4106 = Rows::load(args[2] + 72 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4107 = args[2][73 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4107 = Rows::load(args[2] + 73 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4108 = args[2][74 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4108 = Rows::load(args[2] + 74 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4109 = args[2][75 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4109 = Rows::load(args[2] + 75 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4110 = args[2][76 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4110 = Rows::load(args[2] + 76 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4111 = args[2][77 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4111 = Rows::load(args[2] + 77 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4112 = args[2][78 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4112 = Rows::load(args[2] + 78 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4113 = args[2][79 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4113 = Rows::load(args[2] + 79 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4114 = args[2][80 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4114 = Rows::load(args[2] + 80 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4115 = args[2][81 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4115 = Rows::load(args[2] + 81 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4116 = args[2][82 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4116 = Rows::load(args[2] + 82 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4117 = args[2][83 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4117 = Rows::load(args[2] + 83 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4118 = args[2][84 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4118 = Rows::load(args[2] + 84 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4119 = args[2][85 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4119 = Rows::load(args[2] + 85 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4120 = args[2][86 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4120 = Rows::load(args[2] + 86 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4121 = args[2][87 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4121 = Rows::load(args[2] + 87 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4122 = args[2][88 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4122 = Rows::load(args[2] + 88 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4123 = args[2][89 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4123 = Rows::load(args[2] + 89 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4124 = args[2][90 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4124 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4125 = args[2][91 * steps + ((cycle - kInvRate * 68) & mask)];
+  auto x4125 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 68) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
   auto x4126 = x4095 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
@@ -8404,69 +8421,69 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
   auto x4185 = x4183 + x4184;
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4186 = args[2][60 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4186 = Rows::load(args[2] + 60 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4187 = args[2][61 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4187 = Rows::load(args[2] + 61 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4188 = args[2][62 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4188 = Rows::load(args[2] + 62 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4189 = args[2][63 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4189 = Rows::load(args[2] + 63 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4190 = args[2][64 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4190 = Rows::load(args[2] + 64 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4191 = args[2][65 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4191 = Rows::load(args[2] + 65 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4192 = args[2][66 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4192 = Rows::load(args[2] + 66 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4193 = args[2][67 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4193 = Rows::load(args[2] + 67 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4194 = args[2][68 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4194 = Rows::load(args[2] + 68 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4195 = args[2][69 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4195 = Rows::load(args[2] + 69 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4196 = args[2][70 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4196 = Rows::load(args[2] + 70 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4197 = args[2][71 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4197 = Rows::load(args[2] + 71 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4198 = args[2][72 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4198 = Rows::load(args[2] + 72 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4199 = args[2][73 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4199 = Rows::load(args[2] + 73 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4200 = args[2][74 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4200 = Rows::load(args[2] + 74 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4201 = args[2][75 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4201 = Rows::load(args[2] + 75 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4202 = args[2][76 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4202 = Rows::load(args[2] + 76 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4203 = args[2][77 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4203 = Rows::load(args[2] + 77 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4204 = args[2][78 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4204 = Rows::load(args[2] + 78 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4205 = args[2][79 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4205 = Rows::load(args[2] + 79 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4206 = args[2][80 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4206 = Rows::load(args[2] + 80 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4207 = args[2][81 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4207 = Rows::load(args[2] + 81 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4208 = args[2][82 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4208 = Rows::load(args[2] + 82 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4209 = args[2][83 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4209 = Rows::load(args[2] + 83 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4210 = args[2][84 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4210 = Rows::load(args[2] + 84 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4211 = args[2][85 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4211 = Rows::load(args[2] + 85 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4212 = args[2][86 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4212 = Rows::load(args[2] + 86 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4213 = args[2][87 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4213 = Rows::load(args[2] + 87 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4214 = args[2][88 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4214 = Rows::load(args[2] + 88 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4215 = args[2][89 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4215 = Rows::load(args[2] + 89 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4216 = args[2][90 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4216 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4217 = args[2][91 * steps + ((cycle - kInvRate * 4) & mask)];
+  auto x4217 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 4) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
   auto x4218 = x4187 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":74:0)
@@ -8604,7 +8621,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x4285 = x4283 * x4284;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x4286{x4093.tot + x4093.mul * x4285, x4093.mul * (*mix)};
+  MixState<Rows> x4286{x4093.tot + mixPows[4] * x4285};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x4287 = x4279 + x4281;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -8620,7 +8637,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x4293 = x4291 * x4292;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x4294{x4286.tot + x4286.mul * x4293, x4286.mul * (*mix)};
+  MixState<Rows> x4294{x4286.tot + mixPows[5] * x4293};
   // loc("zirgen/circuit/recursion/sha.cpp":115:0)
   auto x4295 = x2910 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":115:0)
@@ -8686,19 +8703,19 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":248:0)
   auto x4326 = x4308 + x4325;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x4327{x4294.tot + x4294.mul * x3157, x4294.mul * (*mix)};
+  MixState<Rows> x4327{x4294.tot + mixPows[6] * x3157};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x4328 = x2378 - x4324;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4329{x4327.tot + x4327.mul * x4328, x4327.mul * (*mix)};
+  MixState<Rows> x4329{x4327.tot + mixPows[7] * x4328};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x4330 = x2380 - x4326;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4331{x4329.tot + x4329.mul * x4330, x4329.mul * (*mix)};
+  MixState<Rows> x4331{x4329.tot + mixPows[8] * x4330};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4332{x4331.tot + x4331.mul * x2382, x4331.mul * (*mix)};
+  MixState<Rows> x4332{x4331.tot + mixPows[9] * x2382};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4333{x4332.tot + x4332.mul * x2384, x4332.mul * (*mix)};
+  MixState<Rows> x4333{x4332.tot + mixPows[10] * x2384};
   // loc("zirgen/circuit/recursion/sha.cpp":249:0)
   auto x4334 = x3866 * x18;
   // loc("zirgen/circuit/recursion/sha.cpp":249:0)
@@ -8708,21 +8725,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":249:0)
   auto x4337 = x3471 + x4336;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x4338{x4333.tot + x4333.mul * x3159, x4333.mul * (*mix)};
+  MixState<Rows> x4338{x4333.tot + mixPows[11] * x3159};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x4339 = x2390 - x4335;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4340{x4338.tot + x4338.mul * x4339, x4338.mul * (*mix)};
+  MixState<Rows> x4340{x4338.tot + mixPows[12] * x4339};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x4341 = x2393 - x4337;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4342{x4340.tot + x4340.mul * x4341, x4340.mul * (*mix)};
+  MixState<Rows> x4342{x4340.tot + mixPows[13] * x4341};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4343{x4342.tot + x4342.mul * x2396, x4342.mul * (*mix)};
+  MixState<Rows> x4343{x4342.tot + mixPows[14] * x2396};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x4344{x4343.tot + x4343.mul * x2637, x4343.mul * (*mix)};
+  MixState<Rows> x4344{x4343.tot + mixPows[15] * x2637};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x4345{x3890.tot + x2634 * x4344.tot * x3890.mul, x3890.mul * x4344.mul};
+  MixState<Rows> x4345{x3890.tot + x2634 * x4344.tot * mixPows[38]};
   // loc("zirgen/circuit/recursion/sha.cpp":179:0)
   auto x4346 = x2378 * x42;
   // loc("zirgen/circuit/recursion/sha.cpp":104:0)
@@ -8798,7 +8815,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
   auto x4382 = x4381 * x19;
   // loc("zirgen/circuit/recursion/sha.cpp":184:0)
-  MixState x4383{x2326.tot + x2326.mul * x4382, x2326.mul * (*mix)};
+  MixState<Rows> x4383{x2326.tot + mixPows[0] * x4382};
   // loc("zirgen/circuit/recursion/sha.cpp":193:0)
   auto x4384 = x2346 + x2349;
   // loc("zirgen/circuit/recursion/sha.cpp":193:0)
@@ -8862,11 +8879,11 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":214:0)
   auto x4414 = x4413 * x4412;
   // loc("zirgen/circuit/recursion/sha.cpp":214:0)
-  MixState x4415{x4383.tot + x4383.mul * x4414, x4383.mul * (*mix)};
+  MixState<Rows> x4415{x4383.tot + mixPows[1] * x4414};
   // loc("zirgen/circuit/recursion/sha.cpp":216:0)
-  MixState x4416{x4415.tot + x4415.mul * x2518, x4415.mul * (*mix)};
+  MixState<Rows> x4416{x4415.tot + mixPows[2] * x2518};
   // loc("zirgen/circuit/recursion/sha.cpp":177:0)
-  MixState x4417{x3160.tot + x3653 * x4416.tot * x3160.mul, x3160.mul * x4416.mul};
+  MixState<Rows> x4417{x3160.tot + x3653 * x4416.tot * mixPows[2]};
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
   auto x4418 = x2378 - x4360;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -8878,7 +8895,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":134:0)
   auto x4422 = x0 - x4421;
   // loc("zirgen/circuit/recursion/sha.cpp":134:0)
-  MixState x4423{x2326.tot + x2326.mul * x4422, x2326.mul * (*mix)};
+  MixState<Rows> x4423{x2326.tot + mixPows[0] * x4422};
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
   auto x4424 = x2380 - x4378;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -8890,397 +8907,397 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":135:0)
   auto x4428 = x0 - x4427;
   // loc("zirgen/circuit/recursion/sha.cpp":135:0)
-  MixState x4429{x4423.tot + x4423.mul * x4428, x4423.mul * (*mix)};
+  MixState<Rows> x4429{x4423.tot + mixPows[1] * x4428};
   // loc("./zirgen/components/bits.h":68:0)
-  MixState x4430{x4429.tot + x4429.mul * x2372, x4429.mul * (*mix)};
+  MixState<Rows> x4430{x4429.tot + mixPows[2] * x2372};
   // loc("zirgen/circuit/recursion/sha.cpp":218:0)
-  MixState x4431{x4417.tot + x3424 * x4430.tot * x4417.mul, x4417.mul * x4430.mul};
+  MixState<Rows> x4431{x4417.tot + x3424 * x4430.tot * mixPows[5]};
   // loc("./zirgen/components/bits.h":68:0)
-  MixState x4432{x4431.tot + x4431.mul * x2374, x4431.mul * (*mix)};
+  MixState<Rows> x4432{x4431.tot + mixPows[8] * x2374};
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4433 = args[2][26 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4433 = Rows::load(args[2] + 26 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4434 = args[2][27 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4434 = Rows::load(args[2] + 27 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4435 = args[2][28 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4435 = Rows::load(args[2] + 28 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4436 = args[2][29 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4436 = Rows::load(args[2] + 29 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4437 = args[2][30 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4437 = Rows::load(args[2] + 30 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4438 = args[2][31 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4438 = Rows::load(args[2] + 31 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4439 = args[2][32 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4439 = Rows::load(args[2] + 32 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4440 = args[2][33 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4440 = Rows::load(args[2] + 33 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4441 = args[2][34 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4441 = Rows::load(args[2] + 34 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4442 = args[2][35 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4442 = Rows::load(args[2] + 35 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4443 = args[2][36 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4443 = Rows::load(args[2] + 36 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4444 = args[2][37 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4444 = Rows::load(args[2] + 37 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4445 = args[2][38 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4445 = Rows::load(args[2] + 38 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4446 = args[2][39 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4446 = Rows::load(args[2] + 39 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4447 = args[2][40 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4447 = Rows::load(args[2] + 40 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4448 = args[2][41 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4448 = Rows::load(args[2] + 41 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4449 = args[2][42 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4449 = Rows::load(args[2] + 42 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4450 = args[2][43 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4450 = Rows::load(args[2] + 43 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4451 = args[2][44 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4451 = Rows::load(args[2] + 44 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4452 = args[2][45 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4452 = Rows::load(args[2] + 45 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4453 = args[2][46 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4453 = Rows::load(args[2] + 46 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4454 = args[2][47 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4454 = Rows::load(args[2] + 47 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4455 = args[2][48 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4455 = Rows::load(args[2] + 48 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4456 = args[2][49 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4456 = Rows::load(args[2] + 49 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4457 = args[2][50 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4457 = Rows::load(args[2] + 50 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4458 = args[2][51 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4458 = Rows::load(args[2] + 51 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4459 = args[2][52 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4459 = Rows::load(args[2] + 52 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4460 = args[2][53 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4460 = Rows::load(args[2] + 53 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4461 = args[2][54 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4461 = Rows::load(args[2] + 54 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4462 = args[2][55 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4462 = Rows::load(args[2] + 55 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4463 = args[2][56 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4463 = Rows::load(args[2] + 56 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4464 = args[2][57 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4464 = Rows::load(args[2] + 57 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4465 = args[2][26 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4465 = Rows::load(args[2] + 26 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4466 = args[2][27 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4466 = Rows::load(args[2] + 27 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4467 = args[2][28 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4467 = Rows::load(args[2] + 28 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4468 = args[2][29 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4468 = Rows::load(args[2] + 29 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4469 = args[2][30 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4469 = Rows::load(args[2] + 30 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4470 = args[2][31 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4470 = Rows::load(args[2] + 31 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4471 = args[2][32 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4471 = Rows::load(args[2] + 32 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4472 = args[2][33 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4472 = Rows::load(args[2] + 33 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4473 = args[2][34 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4473 = Rows::load(args[2] + 34 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4474 = args[2][35 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4474 = Rows::load(args[2] + 35 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4475 = args[2][36 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4475 = Rows::load(args[2] + 36 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4476 = args[2][37 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4476 = Rows::load(args[2] + 37 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4477 = args[2][38 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4477 = Rows::load(args[2] + 38 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4478 = args[2][39 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4478 = Rows::load(args[2] + 39 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4479 = args[2][40 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4479 = Rows::load(args[2] + 40 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4480 = args[2][41 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4480 = Rows::load(args[2] + 41 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4481 = args[2][42 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4481 = Rows::load(args[2] + 42 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4482 = args[2][43 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4482 = Rows::load(args[2] + 43 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4483 = args[2][44 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4483 = Rows::load(args[2] + 44 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4484 = args[2][45 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4484 = Rows::load(args[2] + 45 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4485 = args[2][46 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4485 = Rows::load(args[2] + 46 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4486 = args[2][47 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4486 = Rows::load(args[2] + 47 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4487 = args[2][48 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4487 = Rows::load(args[2] + 48 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4488 = args[2][49 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4488 = Rows::load(args[2] + 49 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4489 = args[2][50 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4489 = Rows::load(args[2] + 50 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4490 = args[2][51 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4490 = Rows::load(args[2] + 51 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4491 = args[2][52 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4491 = Rows::load(args[2] + 52 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4492 = args[2][53 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4492 = Rows::load(args[2] + 53 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4493 = args[2][54 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4493 = Rows::load(args[2] + 54 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4494 = args[2][55 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4494 = Rows::load(args[2] + 55 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4495 = args[2][56 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4495 = Rows::load(args[2] + 56 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4496 = args[2][57 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4496 = Rows::load(args[2] + 57 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4497 = args[2][26 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4497 = Rows::load(args[2] + 26 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4498 = args[2][27 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4498 = Rows::load(args[2] + 27 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4499 = args[2][28 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4499 = Rows::load(args[2] + 28 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4500 = args[2][29 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4500 = Rows::load(args[2] + 29 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4501 = args[2][30 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4501 = Rows::load(args[2] + 30 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4502 = args[2][31 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4502 = Rows::load(args[2] + 31 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4503 = args[2][32 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4503 = Rows::load(args[2] + 32 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4504 = args[2][33 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4504 = Rows::load(args[2] + 33 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4505 = args[2][34 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4505 = Rows::load(args[2] + 34 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4506 = args[2][35 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4506 = Rows::load(args[2] + 35 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4507 = args[2][36 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4507 = Rows::load(args[2] + 36 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4508 = args[2][37 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4508 = Rows::load(args[2] + 37 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4509 = args[2][38 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4509 = Rows::load(args[2] + 38 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4510 = args[2][39 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4510 = Rows::load(args[2] + 39 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4511 = args[2][40 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4511 = Rows::load(args[2] + 40 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4512 = args[2][41 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4512 = Rows::load(args[2] + 41 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4513 = args[2][42 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4513 = Rows::load(args[2] + 42 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4514 = args[2][43 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4514 = Rows::load(args[2] + 43 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4515 = args[2][44 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4515 = Rows::load(args[2] + 44 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4516 = args[2][45 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4516 = Rows::load(args[2] + 45 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4517 = args[2][46 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4517 = Rows::load(args[2] + 46 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4518 = args[2][47 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4518 = Rows::load(args[2] + 47 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4519 = args[2][48 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4519 = Rows::load(args[2] + 48 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4520 = args[2][49 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4520 = Rows::load(args[2] + 49 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4521 = args[2][50 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4521 = Rows::load(args[2] + 50 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4522 = args[2][51 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4522 = Rows::load(args[2] + 51 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4523 = args[2][52 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4523 = Rows::load(args[2] + 52 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4524 = args[2][53 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4524 = Rows::load(args[2] + 53 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4525 = args[2][54 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4525 = Rows::load(args[2] + 54 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4526 = args[2][55 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4526 = Rows::load(args[2] + 55 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4527 = args[2][56 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4527 = Rows::load(args[2] + 56 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/a[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4528 = args[2][57 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4528 = Rows::load(args[2] + 57 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4529 = args[2][60 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4529 = Rows::load(args[2] + 60 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4530 = args[2][61 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4530 = Rows::load(args[2] + 61 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4531 = args[2][62 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4531 = Rows::load(args[2] + 62 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4532 = args[2][63 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4532 = Rows::load(args[2] + 63 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4533 = args[2][64 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4533 = Rows::load(args[2] + 64 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4534 = args[2][65 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4534 = Rows::load(args[2] + 65 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4535 = args[2][66 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4535 = Rows::load(args[2] + 66 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4536 = args[2][67 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4536 = Rows::load(args[2] + 67 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4537 = args[2][68 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4537 = Rows::load(args[2] + 68 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4538 = args[2][69 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4538 = Rows::load(args[2] + 69 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4539 = args[2][70 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4539 = Rows::load(args[2] + 70 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4540 = args[2][71 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4540 = Rows::load(args[2] + 71 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4541 = args[2][72 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4541 = Rows::load(args[2] + 72 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4542 = args[2][73 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4542 = Rows::load(args[2] + 73 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4543 = args[2][74 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4543 = Rows::load(args[2] + 74 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4544 = args[2][75 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4544 = Rows::load(args[2] + 75 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4545 = args[2][76 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4545 = Rows::load(args[2] + 76 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4546 = args[2][77 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4546 = Rows::load(args[2] + 77 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4547 = args[2][78 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4547 = Rows::load(args[2] + 78 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4548 = args[2][79 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4548 = Rows::load(args[2] + 79 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4549 = args[2][80 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4549 = Rows::load(args[2] + 80 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4550 = args[2][81 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4550 = Rows::load(args[2] + 81 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4551 = args[2][82 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4551 = Rows::load(args[2] + 82 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4552 = args[2][83 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4552 = Rows::load(args[2] + 83 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4553 = args[2][84 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4553 = Rows::load(args[2] + 84 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4554 = args[2][85 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4554 = Rows::load(args[2] + 85 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4555 = args[2][86 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4555 = Rows::load(args[2] + 86 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4556 = args[2][87 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4556 = Rows::load(args[2] + 87 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4557 = args[2][88 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4557 = Rows::load(args[2] + 88 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4558 = args[2][89 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4558 = Rows::load(args[2] + 89 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4559 = args[2][90 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4559 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4560 = args[2][91 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x4560 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4561 = args[2][60 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4561 = Rows::load(args[2] + 60 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4562 = args[2][61 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4562 = Rows::load(args[2] + 61 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4563 = args[2][62 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4563 = Rows::load(args[2] + 62 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4564 = args[2][63 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4564 = Rows::load(args[2] + 63 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4565 = args[2][64 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4565 = Rows::load(args[2] + 64 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4566 = args[2][65 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4566 = Rows::load(args[2] + 65 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4567 = args[2][66 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4567 = Rows::load(args[2] + 66 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4568 = args[2][67 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4568 = Rows::load(args[2] + 67 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4569 = args[2][68 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4569 = Rows::load(args[2] + 68 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4570 = args[2][69 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4570 = Rows::load(args[2] + 69 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4571 = args[2][70 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4571 = Rows::load(args[2] + 70 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4572 = args[2][71 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4572 = Rows::load(args[2] + 71 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4573 = args[2][72 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4573 = Rows::load(args[2] + 72 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4574 = args[2][73 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4574 = Rows::load(args[2] + 73 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4575 = args[2][74 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4575 = Rows::load(args[2] + 74 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4576 = args[2][75 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4576 = Rows::load(args[2] + 75 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4577 = args[2][76 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4577 = Rows::load(args[2] + 76 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4578 = args[2][77 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4578 = Rows::load(args[2] + 77 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4579 = args[2][78 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4579 = Rows::load(args[2] + 78 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4580 = args[2][79 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4580 = Rows::load(args[2] + 79 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4581 = args[2][80 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4581 = Rows::load(args[2] + 80 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4582 = args[2][81 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4582 = Rows::load(args[2] + 81 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4583 = args[2][82 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4583 = Rows::load(args[2] + 82 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4584 = args[2][83 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4584 = Rows::load(args[2] + 83 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4585 = args[2][84 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4585 = Rows::load(args[2] + 84 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4586 = args[2][85 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4586 = Rows::load(args[2] + 85 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4587 = args[2][86 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4587 = Rows::load(args[2] + 86 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4588 = args[2][87 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4588 = Rows::load(args[2] + 87 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4589 = args[2][88 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4589 = Rows::load(args[2] + 88 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4590 = args[2][89 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4590 = Rows::load(args[2] + 89 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4591 = args[2][90 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4591 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4592 = args[2][91 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x4592 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4593 = args[2][60 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4593 = Rows::load(args[2] + 60 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4594 = args[2][61 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4594 = Rows::load(args[2] + 61 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4595 = args[2][62 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4595 = Rows::load(args[2] + 62 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4596 = args[2][63 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4596 = Rows::load(args[2] + 63 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4597 = args[2][64 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4597 = Rows::load(args[2] + 64 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4598 = args[2][65 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4598 = Rows::load(args[2] + 65 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4599 = args[2][66 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4599 = Rows::load(args[2] + 66 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4600 = args[2][67 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4600 = Rows::load(args[2] + 67 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4601 = args[2][68 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4601 = Rows::load(args[2] + 68 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4602 = args[2][69 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4602 = Rows::load(args[2] + 69 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4603 = args[2][70 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4603 = Rows::load(args[2] + 70 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4604 = args[2][71 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4604 = Rows::load(args[2] + 71 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4605 = args[2][72 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4605 = Rows::load(args[2] + 72 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4606 = args[2][73 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4606 = Rows::load(args[2] + 73 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4607 = args[2][74 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4607 = Rows::load(args[2] + 74 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4608 = args[2][75 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4608 = Rows::load(args[2] + 75 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4609 = args[2][76 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4609 = Rows::load(args[2] + 76 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4610 = args[2][77 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4610 = Rows::load(args[2] + 77 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4611 = args[2][78 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4611 = Rows::load(args[2] + 78 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4612 = args[2][79 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4612 = Rows::load(args[2] + 79 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4613 = args[2][80 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4613 = Rows::load(args[2] + 80 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4614 = args[2][81 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4614 = Rows::load(args[2] + 81 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4615 = args[2][82 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4615 = Rows::load(args[2] + 82 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4616 = args[2][83 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4616 = Rows::load(args[2] + 83 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4617 = args[2][84 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4617 = Rows::load(args[2] + 84 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4618 = args[2][85 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4618 = Rows::load(args[2] + 85 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4619 = args[2][86 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4619 = Rows::load(args[2] + 86 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4620 = args[2][87 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4620 = Rows::load(args[2] + 87 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4621 = args[2][88 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4621 = Rows::load(args[2] + 88 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4622 = args[2][89 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4622 = Rows::load(args[2] + 89 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4623 = args[2][90 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4623 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/e[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x4624 = args[2][91 * steps + ((cycle - kInvRate * 3) & mask)];
+  auto x4624 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 3) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":47:0)
   auto x4625 = x4446 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":47:0)
@@ -11776,19 +11793,19 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":290:0)
   auto x5871 = x3240 - x5867;
   // loc("zirgen/circuit/recursion/sha.cpp":290:0)
-  MixState x5872{x4432.tot + x4432.mul * x5871, x4432.mul * (*mix)};
+  MixState<Rows> x5872{x4432.tot + mixPows[9] * x5871};
   // loc("zirgen/circuit/recursion/sha.cpp":291:0)
   auto x5873 = x2331 - x5869;
   // loc("zirgen/circuit/recursion/sha.cpp":291:0)
-  MixState x5874{x5872.tot + x5872.mul * x5873, x5872.mul * (*mix)};
+  MixState<Rows> x5874{x5872.tot + mixPows[10] * x5873};
   // loc("zirgen/circuit/recursion/sha.cpp":290:0)
   auto x5875 = x3243 - x5868;
   // loc("zirgen/circuit/recursion/sha.cpp":290:0)
-  MixState x5876{x5874.tot + x5874.mul * x5875, x5874.mul * (*mix)};
+  MixState<Rows> x5876{x5874.tot + mixPows[11] * x5875};
   // loc("zirgen/circuit/recursion/sha.cpp":291:0)
   auto x5877 = x2334 - x5870;
   // loc("zirgen/circuit/recursion/sha.cpp":291:0)
-  MixState x5878{x5876.tot + x5876.mul * x5877, x5876.mul * (*mix)};
+  MixState<Rows> x5878{x5876.tot + mixPows[12] * x5877};
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
   auto x5879 = x3240 - x3771;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -11802,7 +11819,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x5884 = x5882 * x5883;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x5885{x5878.tot + x5878.mul * x5884, x5878.mul * (*mix)};
+  MixState<Rows> x5885{x5878.tot + mixPows[13] * x5884};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x5886 = x3243 + x5880;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -11818,7 +11835,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x5892 = x5890 * x5891;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x5893{x5885.tot + x5885.mul * x5892, x5885.mul * (*mix)};
+  MixState<Rows> x5893{x5885.tot + mixPows[14] * x5892};
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
   auto x5894 = x2331 - x3844;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -11832,7 +11849,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x5899 = x5897 * x5898;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x5900{x5893.tot + x5893.mul * x5899, x5893.mul * (*mix)};
+  MixState<Rows> x5900{x5893.tot + mixPows[15] * x5899};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x5901 = x2334 + x5895;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -11848,277 +11865,277 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x5907 = x5905 * x5906;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x5908{x5900.tot + x5900.mul * x5907, x5900.mul * (*mix)};
+  MixState<Rows> x5908{x5900.tot + mixPows[16] * x5907};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x5909{x4345.tot + x2635 * x5908.tot * x4345.mul, x4345.mul * x5908.mul};
+  MixState<Rows> x5909{x4345.tot + x2635 * x5908.tot * mixPows[54]};
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x5910{x2326.tot + x2326.mul * x2376, x2326.mul * (*mix)};
+  MixState<Rows> x5910{x2326.tot + mixPows[0] * x2376};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x5911{x5910.tot + x5910.mul * x2378, x5910.mul * (*mix)};
+  MixState<Rows> x5911{x5910.tot + mixPows[1] * x2378};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x5912{x5911.tot + x5911.mul * x2380, x5911.mul * (*mix)};
+  MixState<Rows> x5912{x5911.tot + mixPows[2] * x2380};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x5913{x5912.tot + x5912.mul * x2382, x5912.mul * (*mix)};
+  MixState<Rows> x5913{x5912.tot + mixPows[3] * x2382};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x5914{x5913.tot + x5913.mul * x2384, x5913.mul * (*mix)};
+  MixState<Rows> x5914{x5913.tot + mixPows[4] * x2384};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x5915{x5914.tot + x5914.mul * x3159, x5914.mul * (*mix)};
+  MixState<Rows> x5915{x5914.tot + mixPows[5] * x3159};
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5916 = args[2][94 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5916 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5917 = args[2][95 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5917 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5918 = args[2][96 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5918 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5919 = args[2][97 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5919 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5920 = args[2][98 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5920 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5921 = args[2][99 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5921 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5922 = args[2][100 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5922 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5923 = args[2][101 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5923 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5924 = args[2][102 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5924 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5925 = args[2][103 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5925 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5926 = args[2][104 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5926 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5927 = args[2][105 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5927 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5928 = args[2][106 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5928 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5929 = args[2][107 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5929 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5930 = args[2][108 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5930 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5931 = args[2][109 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5931 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5932 = args[2][110 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5932 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5933 = args[2][111 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5933 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5934 = args[2][112 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5934 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5935 = args[2][113 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5935 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5936 = args[2][114 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5936 = Rows::load(args[2] + 114 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5937 = args[2][115 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5937 = Rows::load(args[2] + 115 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5938 = args[2][116 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5938 = Rows::load(args[2] + 116 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5939 = args[2][117 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5939 = Rows::load(args[2] + 117 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5940 = args[2][118 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5940 = Rows::load(args[2] + 118 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5941 = args[2][119 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5941 = Rows::load(args[2] + 119 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5942 = args[2][120 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5942 = Rows::load(args[2] + 120 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5943 = args[2][121 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5943 = Rows::load(args[2] + 121 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5944 = args[2][122 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5944 = Rows::load(args[2] + 122 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5945 = args[2][123 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5945 = Rows::load(args[2] + 123 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5946 = args[2][124 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5946 = Rows::load(args[2] + 124 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5947 = args[2][125 * steps + ((cycle - kInvRate * 2) & mask)];
+  auto x5947 = Rows::load(args[2] + 125 * steps, (cycle - kInvRate * 2) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5948 = args[2][94 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5948 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5949 = args[2][95 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5949 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5950 = args[2][96 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5950 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5951 = args[2][97 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5951 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5952 = args[2][98 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5952 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5953 = args[2][99 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5953 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5954 = args[2][100 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5954 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5955 = args[2][101 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5955 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5956 = args[2][102 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5956 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5957 = args[2][103 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5957 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5958 = args[2][104 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5958 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5959 = args[2][105 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5959 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5960 = args[2][106 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5960 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5961 = args[2][107 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5961 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5962 = args[2][108 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5962 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5963 = args[2][109 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5963 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5964 = args[2][110 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5964 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5965 = args[2][111 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5965 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5966 = args[2][112 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5966 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5967 = args[2][113 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5967 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5968 = args[2][114 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5968 = Rows::load(args[2] + 114 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5969 = args[2][115 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5969 = Rows::load(args[2] + 115 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5970 = args[2][116 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5970 = Rows::load(args[2] + 116 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5971 = args[2][117 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5971 = Rows::load(args[2] + 117 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5972 = args[2][118 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5972 = Rows::load(args[2] + 118 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5973 = args[2][119 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5973 = Rows::load(args[2] + 119 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5974 = args[2][120 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5974 = Rows::load(args[2] + 120 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5975 = args[2][121 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5975 = Rows::load(args[2] + 121 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5976 = args[2][122 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5976 = Rows::load(args[2] + 122 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5977 = args[2][123 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5977 = Rows::load(args[2] + 123 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5978 = args[2][124 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5978 = Rows::load(args[2] + 124 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5979 = args[2][125 * steps + ((cycle - kInvRate * 7) & mask)];
+  auto x5979 = Rows::load(args[2] + 125 * steps, (cycle - kInvRate * 7) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5980 = args[2][94 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5980 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5981 = args[2][95 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5981 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5982 = args[2][96 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5982 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5983 = args[2][97 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5983 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5984 = args[2][98 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5984 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5985 = args[2][99 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5985 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5986 = args[2][100 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5986 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5987 = args[2][101 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5987 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5988 = args[2][102 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5988 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5989 = args[2][103 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5989 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5990 = args[2][104 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5990 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5991 = args[2][105 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5991 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5992 = args[2][106 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5992 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5993 = args[2][107 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5993 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5994 = args[2][108 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5994 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5995 = args[2][109 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5995 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5996 = args[2][110 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5996 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5997 = args[2][111 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5997 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5998 = args[2][112 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5998 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x5999 = args[2][113 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x5999 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6000 = args[2][114 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6000 = Rows::load(args[2] + 114 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6001 = args[2][115 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6001 = Rows::load(args[2] + 115 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6002 = args[2][116 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6002 = Rows::load(args[2] + 116 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6003 = args[2][117 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6003 = Rows::load(args[2] + 117 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6004 = args[2][118 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6004 = Rows::load(args[2] + 118 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6005 = args[2][119 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6005 = Rows::load(args[2] + 119 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6006 = args[2][120 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6006 = Rows::load(args[2] + 120 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6007 = args[2][121 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6007 = Rows::load(args[2] + 121 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6008 = args[2][122 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6008 = Rows::load(args[2] + 122 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6009 = args[2][123 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6009 = Rows::load(args[2] + 123 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6010 = args[2][124 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6010 = Rows::load(args[2] + 124 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6011 = args[2][125 * steps + ((cycle - kInvRate * 15) & mask)];
+  auto x6011 = Rows::load(args[2] + 125 * steps, (cycle - kInvRate * 15) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[0](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6012 = args[2][94 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6012 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[1](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6013 = args[2][95 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6013 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[2](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6014 = args[2][96 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6014 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[3](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6015 = args[2][97 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6015 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[4](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6016 = args[2][98 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6016 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[5](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6017 = args[2][99 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6017 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[6](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6018 = args[2][100 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6018 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[7](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6019 = args[2][101 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6019 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[8](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6020 = args[2][102 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6020 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[9](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6021 = args[2][103 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6021 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[10](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6022 = args[2][104 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6022 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[11](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6023 = args[2][105 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6023 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[12](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6024 = args[2][106 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6024 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[13](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6025 = args[2][107 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6025 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[14](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6026 = args[2][108 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6026 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[15](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6027 = args[2][109 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6027 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[16](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6028 = args[2][110 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6028 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[17](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6029 = args[2][111 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6029 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[18](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6030 = args[2][112 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6030 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[19](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6031 = args[2][113 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6031 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[20](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6032 = args[2][114 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6032 = Rows::load(args[2] + 114 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[21](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6033 = args[2][115 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6033 = Rows::load(args[2] + 115 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[22](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6034 = args[2][116 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6034 = Rows::load(args[2] + 116 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[23](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6035 = args[2][117 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6035 = Rows::load(args[2] + 117 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[24](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6036 = args[2][118 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6036 = Rows::load(args[2] + 118 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[25](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6037 = args[2][119 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6037 = Rows::load(args[2] + 119 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[26](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6038 = args[2][120 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6038 = Rows::load(args[2] + 120 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[27](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6039 = args[2][121 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6039 = Rows::load(args[2] + 121 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[28](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6040 = args[2][122 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6040 = Rows::load(args[2] + 122 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[29](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6041 = args[2][123 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6041 = Rows::load(args[2] + 123 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[30](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6042 = args[2][124 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6042 = Rows::load(args[2] + 124 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/w[31](Bit)/bit(Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6043 = args[2][125 * steps + ((cycle - kInvRate * 16) & mask)];
+  auto x6043 = Rows::load(args[2] + 125 * steps, (cycle - kInvRate * 16) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":47:0)
   auto x6044 = x5998 * x2;
   // loc("zirgen/circuit/recursion/sha.cpp":47:0)
@@ -13430,17 +13447,17 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":83:0)
   auto x6698 = x6696 + x6636;
   // loc("zirgen/circuit/recursion/sha.cpp":261:0)
-  auto x6699 = args[2][126 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x6699 = Rows::load(args[2] + 126 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":261:0)
   auto x6700 = x6699 - x6697;
   // loc("zirgen/circuit/recursion/sha.cpp":261:0)
-  MixState x6701{x5915.tot + x5915.mul * x6700, x5915.mul * (*mix)};
+  MixState<Rows> x6701{x5915.tot + mixPows[6] * x6700};
   // loc("zirgen/circuit/recursion/sha.cpp":261:0)
-  auto x6702 = args[2][127 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x6702 = Rows::load(args[2] + 127 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/sha.cpp":261:0)
   auto x6703 = x6702 - x6698;
   // loc("zirgen/circuit/recursion/sha.cpp":261:0)
-  MixState x6704{x6701.tot + x6701.mul * x6703, x6701.mul * (*mix)};
+  MixState<Rows> x6704{x6701.tot + mixPows[7] * x6703};
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
   auto x6705 = x6699 - x3697;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -13454,7 +13471,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
   auto x6710 = x6708 * x6709;
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x6711{x6704.tot + x6704.mul * x6710, x6704.mul * (*mix)};
+  MixState<Rows> x6711{x6704.tot + mixPows[8] * x6710};
   // loc("zirgen/circuit/recursion/sha.cpp":127:0)
   auto x6712 = x6702 + x6706;
   // loc("zirgen/circuit/recursion/sha.cpp":106:0)
@@ -13470,25 +13487,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
   auto x6718 = x6716 * x6717;
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x6719{x6711.tot + x6711.mul * x6718, x6711.mul * (*mix)};
+  MixState<Rows> x6719{x6711.tot + mixPows[9] * x6718};
   // loc("zirgen/circuit/recursion/sha.cpp":290:0)
-  MixState x6720{x6719.tot + x6719.mul * x5871, x6719.mul * (*mix)};
+  MixState<Rows> x6720{x6719.tot + mixPows[10] * x5871};
   // loc("zirgen/circuit/recursion/sha.cpp":291:0)
-  MixState x6721{x6720.tot + x6720.mul * x5873, x6720.mul * (*mix)};
+  MixState<Rows> x6721{x6720.tot + mixPows[11] * x5873};
   // loc("zirgen/circuit/recursion/sha.cpp":290:0)
-  MixState x6722{x6721.tot + x6721.mul * x5875, x6721.mul * (*mix)};
+  MixState<Rows> x6722{x6721.tot + mixPows[12] * x5875};
   // loc("zirgen/circuit/recursion/sha.cpp":291:0)
-  MixState x6723{x6722.tot + x6722.mul * x5877, x6722.mul * (*mix)};
+  MixState<Rows> x6723{x6722.tot + mixPows[13] * x5877};
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x6724{x6723.tot + x6723.mul * x5884, x6723.mul * (*mix)};
+  MixState<Rows> x6724{x6723.tot + mixPows[14] * x5884};
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x6725{x6724.tot + x6724.mul * x5892, x6724.mul * (*mix)};
+  MixState<Rows> x6725{x6724.tot + mixPows[15] * x5892};
   // loc("zirgen/circuit/recursion/sha.cpp":126:0)
-  MixState x6726{x6725.tot + x6725.mul * x5899, x6725.mul * (*mix)};
+  MixState<Rows> x6726{x6725.tot + mixPows[16] * x5899};
   // loc("zirgen/circuit/recursion/sha.cpp":130:0)
-  MixState x6727{x6726.tot + x6726.mul * x5907, x6726.mul * (*mix)};
+  MixState<Rows> x6727{x6726.tot + mixPows[17] * x5907};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x6728{x5909.tot + x2875 * x6727.tot * x5909.mul, x5909.mul * x6727.mul};
+  MixState<Rows> x6728{x5909.tot + x2875 * x6727.tot * mixPows[71]};
   // loc("./zirgen/components/onehot.h":46:0)
   auto x6729 = x2380 * x2;
   // loc("./zirgen/components/onehot.h":46:0)
@@ -13500,253 +13517,253 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":40:0)
   auto x6733 = x6732 - x2908;
   // loc("./zirgen/components/onehot.h":40:0)
-  MixState x6734{x2326.tot + x2326.mul * x6733, x2326.mul * (*mix)};
+  MixState<Rows> x6734{x2326.tot + mixPows[0] * x6733};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6735 = x2384 - x2907;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6736{x2326.tot + x2326.mul * x6735, x2326.mul * (*mix)};
+  MixState<Rows> x6736{x2326.tot + mixPows[0] * x6735};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6737 = args[1][0];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6738 = x6737 - x2387;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6739{x6736.tot + x6736.mul * x6738, x6736.mul * (*mix)};
+  MixState<Rows> x6739{x6736.tot + mixPows[1] * x6738};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6740 = args[1][1];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6741 = x6740 - x2390;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6742{x6739.tot + x6739.mul * x6741, x6739.mul * (*mix)};
+  MixState<Rows> x6742{x6739.tot + mixPows[2] * x6741};
   // loc("zirgen/circuit/recursion/macro.cpp":37:0)
   auto x6743 = x2907 + x1;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6744 = x2637 - x6743;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6745{x6742.tot + x6742.mul * x6744, x6742.mul * (*mix)};
+  MixState<Rows> x6745{x6742.tot + mixPows[3] * x6744};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6746 = args[1][2];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6747 = x6746 - x2639;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6748{x6745.tot + x6745.mul * x6747, x6745.mul * (*mix)};
+  MixState<Rows> x6748{x6745.tot + mixPows[4] * x6747};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6749 = args[1][3];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6750 = x6749 - x2641;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6751{x6748.tot + x6748.mul * x6750, x6748.mul * (*mix)};
+  MixState<Rows> x6751{x6748.tot + mixPows[5] * x6750};
   // loc("zirgen/circuit/recursion/macro.cpp":37:0)
   auto x6752 = x2907 + x2;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6753 = x2647 - x6752;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6754{x6751.tot + x6751.mul * x6753, x6751.mul * (*mix)};
+  MixState<Rows> x6754{x6751.tot + mixPows[6] * x6753};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6755 = args[1][4];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6756 = x6755 - x2649;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6757{x6754.tot + x6754.mul * x6756, x6754.mul * (*mix)};
+  MixState<Rows> x6757{x6754.tot + mixPows[7] * x6756};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6758 = args[1][5];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6759 = x6758 - x2651;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6760{x6757.tot + x6757.mul * x6759, x6757.mul * (*mix)};
+  MixState<Rows> x6760{x6757.tot + mixPows[8] * x6759};
   // loc("zirgen/circuit/recursion/macro.cpp":37:0)
   auto x6761 = x2907 + x3;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6762 = x2657 - x6761;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6763{x6760.tot + x6760.mul * x6762, x6760.mul * (*mix)};
+  MixState<Rows> x6763{x6760.tot + mixPows[9] * x6762};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6764 = args[1][6];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6765 = x6764 - x2660;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6766{x6763.tot + x6763.mul * x6765, x6763.mul * (*mix)};
+  MixState<Rows> x6766{x6763.tot + mixPows[10] * x6765};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6767 = args[1][7];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6768 = x6767 - x2663;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6769{x6766.tot + x6766.mul * x6768, x6766.mul * (*mix)};
+  MixState<Rows> x6769{x6766.tot + mixPows[11] * x6768};
   // loc("zirgen/circuit/recursion/macro.cpp":35:0)
-  MixState x6770{x6734.tot + x2376 * x6769.tot * x6734.mul, x6734.mul * x6769.mul};
+  MixState<Rows> x6770{x6734.tot + x2376 * x6769.tot * mixPows[1]};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6771 = args[1][8];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6772 = x6771 - x2387;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6773{x6736.tot + x6736.mul * x6772, x6736.mul * (*mix)};
+  MixState<Rows> x6773{x6736.tot + mixPows[1] * x6772};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6774 = args[1][9];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6775 = x6774 - x2390;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6776{x6773.tot + x6773.mul * x6775, x6773.mul * (*mix)};
+  MixState<Rows> x6776{x6773.tot + mixPows[2] * x6775};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6777{x6776.tot + x6776.mul * x6744, x6776.mul * (*mix)};
+  MixState<Rows> x6777{x6776.tot + mixPows[3] * x6744};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6778 = args[1][10];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6779 = x6778 - x2639;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6780{x6777.tot + x6777.mul * x6779, x6777.mul * (*mix)};
+  MixState<Rows> x6780{x6777.tot + mixPows[4] * x6779};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6781 = args[1][11];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6782 = x6781 - x2641;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6783{x6780.tot + x6780.mul * x6782, x6780.mul * (*mix)};
+  MixState<Rows> x6783{x6780.tot + mixPows[5] * x6782};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6784{x6783.tot + x6783.mul * x6753, x6783.mul * (*mix)};
+  MixState<Rows> x6784{x6783.tot + mixPows[6] * x6753};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6785 = args[1][12];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6786 = x6785 - x2649;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6787{x6784.tot + x6784.mul * x6786, x6784.mul * (*mix)};
+  MixState<Rows> x6787{x6784.tot + mixPows[7] * x6786};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6788 = args[1][13];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6789 = x6788 - x2651;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6790{x6787.tot + x6787.mul * x6789, x6787.mul * (*mix)};
+  MixState<Rows> x6790{x6787.tot + mixPows[8] * x6789};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6791{x6790.tot + x6790.mul * x6762, x6790.mul * (*mix)};
+  MixState<Rows> x6791{x6790.tot + mixPows[9] * x6762};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6792 = args[1][14];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6793 = x6792 - x2660;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6794{x6791.tot + x6791.mul * x6793, x6791.mul * (*mix)};
+  MixState<Rows> x6794{x6791.tot + mixPows[10] * x6793};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6795 = args[1][15];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6796 = x6795 - x2663;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6797{x6794.tot + x6794.mul * x6796, x6794.mul * (*mix)};
+  MixState<Rows> x6797{x6794.tot + mixPows[11] * x6796};
   // loc("zirgen/circuit/recursion/macro.cpp":35:0)
-  MixState x6798{x6770.tot + x2378 * x6797.tot * x6770.mul, x6770.mul * x6797.mul};
+  MixState<Rows> x6798{x6770.tot + x2378 * x6797.tot * mixPows[13]};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6799 = args[1][16];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6800 = x6799 - x2387;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6801{x6736.tot + x6736.mul * x6800, x6736.mul * (*mix)};
+  MixState<Rows> x6801{x6736.tot + mixPows[1] * x6800};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6802 = args[1][17];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6803 = x6802 - x2390;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6804{x6801.tot + x6801.mul * x6803, x6801.mul * (*mix)};
+  MixState<Rows> x6804{x6801.tot + mixPows[2] * x6803};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6805{x6804.tot + x6804.mul * x6744, x6804.mul * (*mix)};
+  MixState<Rows> x6805{x6804.tot + mixPows[3] * x6744};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6806 = args[1][18];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6807 = x6806 - x2639;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6808{x6805.tot + x6805.mul * x6807, x6805.mul * (*mix)};
+  MixState<Rows> x6808{x6805.tot + mixPows[4] * x6807};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6809 = args[1][19];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6810 = x6809 - x2641;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6811{x6808.tot + x6808.mul * x6810, x6808.mul * (*mix)};
+  MixState<Rows> x6811{x6808.tot + mixPows[5] * x6810};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6812{x6811.tot + x6811.mul * x6753, x6811.mul * (*mix)};
+  MixState<Rows> x6812{x6811.tot + mixPows[6] * x6753};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6813 = args[1][20];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6814 = x6813 - x2649;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6815{x6812.tot + x6812.mul * x6814, x6812.mul * (*mix)};
+  MixState<Rows> x6815{x6812.tot + mixPows[7] * x6814};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6816 = args[1][21];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6817 = x6816 - x2651;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6818{x6815.tot + x6815.mul * x6817, x6815.mul * (*mix)};
+  MixState<Rows> x6818{x6815.tot + mixPows[8] * x6817};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6819{x6818.tot + x6818.mul * x6762, x6818.mul * (*mix)};
+  MixState<Rows> x6819{x6818.tot + mixPows[9] * x6762};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6820 = args[1][22];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6821 = x6820 - x2660;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6822{x6819.tot + x6819.mul * x6821, x6819.mul * (*mix)};
+  MixState<Rows> x6822{x6819.tot + mixPows[10] * x6821};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6823 = args[1][23];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6824 = x6823 - x2663;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6825{x6822.tot + x6822.mul * x6824, x6822.mul * (*mix)};
+  MixState<Rows> x6825{x6822.tot + mixPows[11] * x6824};
   // loc("zirgen/circuit/recursion/macro.cpp":35:0)
-  MixState x6826{x6798.tot + x2380 * x6825.tot * x6798.mul, x6798.mul * x6825.mul};
+  MixState<Rows> x6826{x6798.tot + x2380 * x6825.tot * mixPows[25]};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6827 = args[1][24];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6828 = x6827 - x2387;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6829{x6736.tot + x6736.mul * x6828, x6736.mul * (*mix)};
+  MixState<Rows> x6829{x6736.tot + mixPows[1] * x6828};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6830 = args[1][25];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6831 = x6830 - x2390;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6832{x6829.tot + x6829.mul * x6831, x6829.mul * (*mix)};
+  MixState<Rows> x6832{x6829.tot + mixPows[2] * x6831};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6833{x6832.tot + x6832.mul * x6744, x6832.mul * (*mix)};
+  MixState<Rows> x6833{x6832.tot + mixPows[3] * x6744};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6834 = args[1][26];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6835 = x6834 - x2639;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6836{x6833.tot + x6833.mul * x6835, x6833.mul * (*mix)};
+  MixState<Rows> x6836{x6833.tot + mixPows[4] * x6835};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6837 = args[1][27];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6838 = x6837 - x2641;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6839{x6836.tot + x6836.mul * x6838, x6836.mul * (*mix)};
+  MixState<Rows> x6839{x6836.tot + mixPows[5] * x6838};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6840{x6839.tot + x6839.mul * x6753, x6839.mul * (*mix)};
+  MixState<Rows> x6840{x6839.tot + mixPows[6] * x6753};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6841 = args[1][28];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6842 = x6841 - x2649;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6843{x6840.tot + x6840.mul * x6842, x6840.mul * (*mix)};
+  MixState<Rows> x6843{x6840.tot + mixPows[7] * x6842};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6844 = args[1][29];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6845 = x6844 - x2651;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6846{x6843.tot + x6843.mul * x6845, x6843.mul * (*mix)};
+  MixState<Rows> x6846{x6843.tot + mixPows[8] * x6845};
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6847{x6846.tot + x6846.mul * x6762, x6846.mul * (*mix)};
+  MixState<Rows> x6847{x6846.tot + mixPows[9] * x6762};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6848 = args[1][30];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6849 = x6848 - x2660;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6850{x6847.tot + x6847.mul * x6849, x6847.mul * (*mix)};
+  MixState<Rows> x6850{x6847.tot + mixPows[10] * x6849};
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6851 = args[1][31];
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
   auto x6852 = x6851 - x2663;
   // loc("zirgen/circuit/recursion/macro.cpp":40:0)
-  MixState x6853{x6850.tot + x6850.mul * x6852, x6850.mul * (*mix)};
+  MixState<Rows> x6853{x6850.tot + mixPows[11] * x6852};
   // loc("zirgen/circuit/recursion/macro.cpp":35:0)
-  MixState x6854{x6826.tot + x2382 * x6853.tot * x6826.mul, x6826.mul * x6853.mul};
+  MixState<Rows> x6854{x6826.tot + x2382 * x6853.tot * mixPows[37]};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x6855{x6728.tot + x2906 * x6854.tot * x6728.mul, x6728.mul * x6854.mul};
+  MixState<Rows> x6855{x6728.tot + x2906 * x6854.tot * mixPows[89]};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x6856{x3147.tot + x3148 * x6855.tot * x3147.mul, x3147.mul * x6855.mul};
+  MixState<Rows> x6856{x3147.tot + x3148 * x6855.tot * mixPows[363]};
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_load(Reg)"("./zirgen/components/mux.h":49:0))
-  auto x6857 = args[0][3 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x6857 = Rows::load(args[0] + 3 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":22:0)
   auto x6858 = x1 - x2329;
   // loc("zirgen/circuit/recursion/poseidon.cpp":22:0)
@@ -13756,51 +13773,51 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6861 = x2364 - x2634;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6862{x2326.tot + x2326.mul * x6861, x2326.mul * (*mix)};
+  MixState<Rows> x6862{x2326.tot + mixPows[0] * x6861};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6863 = x2366 * x6860;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6864 = x2374 - x2635;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6865{x6862.tot + x6862.mul * x6864, x6862.mul * (*mix)};
+  MixState<Rows> x6865{x6862.tot + mixPows[1] * x6864};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6866 = x2376 * x6860;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6867 = x2384 - x2875;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6868{x6865.tot + x6865.mul * x6867, x6865.mul * (*mix)};
+  MixState<Rows> x6868{x6865.tot + mixPows[2] * x6867};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6869 = x2387 * x6860;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6870 = x2637 - x2906;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6871{x6868.tot + x6868.mul * x6870, x6868.mul * (*mix)};
+  MixState<Rows> x6871{x6868.tot + mixPows[3] * x6870};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6872 = x2639 * x6860;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6873 = x2647 - x2907;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6874{x6871.tot + x6871.mul * x6873, x6871.mul * (*mix)};
+  MixState<Rows> x6874{x6871.tot + mixPows[4] * x6873};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6875 = x2649 * x6860;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6876 = x2657 - x2908;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6877{x6874.tot + x6874.mul * x6876, x6874.mul * (*mix)};
+  MixState<Rows> x6877{x6874.tot + mixPows[5] * x6876};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6878 = x2660 * x6860;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6879 = x2910 - x3424;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6880{x6877.tot + x6877.mul * x6879, x6877.mul * (*mix)};
+  MixState<Rows> x6880{x6877.tot + mixPows[6] * x6879};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6881 = x2912 * x6860;
   // loc("top(recursion::Top)/code(recursion::Code)/inst(Mux)/poseidon_load(recursion::PoseidonMemInst)/inputs[7](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
-  auto x6882 = args[0][20 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x6882 = Rows::load(args[0] + 20 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
   auto x6883 = x2920 - x6882;
   // loc("zirgen/circuit/recursion/wom.cpp":80:0)
-  MixState x6884{x6880.tot + x6880.mul * x6883, x6880.mul * (*mix)};
+  MixState<Rows> x6884{x6880.tot + mixPows[7] * x6883};
   // loc("zirgen/circuit/recursion/poseidon.cpp":24:0)
   auto x6885 = x2922 * x6860;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
@@ -13808,7 +13825,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6887 = x2362 * x6863;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6888 = args[2][90 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6888 = Rows::load(args[2] + 90 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6889 = x2360 * x6888;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13818,13 +13835,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6892 = x2363 - x6891;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6893{x6884.tot + x6884.mul * x6892, x6884.mul * (*mix)};
+  MixState<Rows> x6893{x6884.tot + mixPows[8] * x6892};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6894 = x2361 * x45;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6895 = x2362 * x6866;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6896 = args[2][91 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6896 = Rows::load(args[2] + 91 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6897 = x2360 * x6896;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13834,13 +13851,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6900 = x2330 - x6899;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6901{x6893.tot + x6893.mul * x6900, x6893.mul * (*mix)};
+  MixState<Rows> x6901{x6893.tot + mixPows[9] * x6900};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6902 = x2361 * x46;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6903 = x2362 * x6869;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6904 = args[2][92 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6904 = Rows::load(args[2] + 92 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6905 = x2360 * x6904;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13850,13 +13867,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6908 = x2331 - x6907;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6909{x6901.tot + x6901.mul * x6908, x6901.mul * (*mix)};
+  MixState<Rows> x6909{x6901.tot + mixPows[10] * x6908};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6910 = x2361 * x47;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6911 = x2362 * x6872;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6912 = args[2][93 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6912 = Rows::load(args[2] + 93 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6913 = x2360 * x6912;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13866,13 +13883,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6916 = x2334 - x6915;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6917{x6909.tot + x6909.mul * x6916, x6909.mul * (*mix)};
+  MixState<Rows> x6917{x6909.tot + mixPows[11] * x6916};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6918 = x2361 * x48;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6919 = x2362 * x6875;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6920 = args[2][94 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6920 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6921 = x2360 * x6920;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13882,13 +13899,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6924 = x2337 - x6923;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6925{x6917.tot + x6917.mul * x6924, x6917.mul * (*mix)};
+  MixState<Rows> x6925{x6917.tot + mixPows[12] * x6924};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6926 = x2361 * x49;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6927 = x2362 * x6878;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6928 = args[2][95 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6928 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6929 = x2360 * x6928;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13898,13 +13915,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6932 = x2340 - x6931;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6933{x6925.tot + x6925.mul * x6932, x6925.mul * (*mix)};
+  MixState<Rows> x6933{x6925.tot + mixPows[13] * x6932};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6934 = x2361 * x50;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6935 = x2362 * x6881;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6936 = args[2][96 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6936 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6937 = x2360 * x6936;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13914,13 +13931,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6940 = x2343 - x6939;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6941{x6933.tot + x6933.mul * x6940, x6933.mul * (*mix)};
+  MixState<Rows> x6941{x6933.tot + mixPows[14] * x6940};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6942 = x2361 * x51;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6943 = x2362 * x6885;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6944 = args[2][97 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6944 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6945 = x2360 * x6944;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13930,13 +13947,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6948 = x2346 - x6947;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6949{x6941.tot + x6941.mul * x6948, x6941.mul * (*mix)};
+  MixState<Rows> x6949{x6941.tot + mixPows[15] * x6948};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6950 = x2361 * x52;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6951 = x2602 * x6863;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6952 = args[2][98 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6952 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6953 = x2360 * x6952;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13946,13 +13963,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6956 = x2349 - x6955;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6957{x6949.tot + x6949.mul * x6956, x6949.mul * (*mix)};
+  MixState<Rows> x6957{x6949.tot + mixPows[16] * x6956};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6958 = x2361 * x53;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6959 = x2602 * x6866;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6960 = args[2][99 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6960 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6961 = x2360 * x6960;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13962,13 +13979,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6964 = x2352 - x6963;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6965{x6957.tot + x6957.mul * x6964, x6957.mul * (*mix)};
+  MixState<Rows> x6965{x6957.tot + mixPows[17] * x6964};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6966 = x2361 * x54;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6967 = x2602 * x6869;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6968 = args[2][100 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6968 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6969 = x2360 * x6968;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13978,13 +13995,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6972 = x2355 - x6971;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6973{x6965.tot + x6965.mul * x6972, x6965.mul * (*mix)};
+  MixState<Rows> x6973{x6965.tot + mixPows[18] * x6972};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6974 = x2361 * x55;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6975 = x2602 * x6872;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6976 = args[2][101 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6976 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6977 = x2360 * x6976;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -13994,13 +14011,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6980 = x2518 - x6979;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6981{x6973.tot + x6973.mul * x6980, x6973.mul * (*mix)};
+  MixState<Rows> x6981{x6973.tot + mixPows[19] * x6980};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6982 = x2361 * x56;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6983 = x2602 * x6875;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6984 = args[2][102 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6984 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6985 = x2360 * x6984;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14010,13 +14027,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6988 = x2636 - x6987;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6989{x6981.tot + x6981.mul * x6988, x6981.mul * (*mix)};
+  MixState<Rows> x6989{x6981.tot + mixPows[20] * x6988};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6990 = x2361 * x57;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6991 = x2602 * x6878;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x6992 = args[2][103 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x6992 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x6993 = x2360 * x6992;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14026,13 +14043,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6996 = x2603 - x6995;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x6997{x6989.tot + x6989.mul * x6996, x6989.mul * (*mix)};
+  MixState<Rows> x6997{x6989.tot + mixPows[21] * x6996};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x6998 = x2361 * x58;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x6999 = x2602 * x6881;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7000 = args[2][104 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7000 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7001 = x2360 * x7000;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14042,13 +14059,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7004 = x2604 - x7003;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7005{x6997.tot + x6997.mul * x7004, x6997.mul * (*mix)};
+  MixState<Rows> x7005{x6997.tot + mixPows[22] * x7004};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7006 = x2361 * x59;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7007 = x2602 * x6885;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7008 = args[2][105 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7008 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7009 = x2360 * x7008;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14058,13 +14075,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7012 = x2607 - x7011;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7013{x7005.tot + x7005.mul * x7012, x7005.mul * (*mix)};
+  MixState<Rows> x7013{x7005.tot + mixPows[23] * x7012};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7014 = x2361 * x60;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7015 = x2633 * x6863;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7016 = args[2][106 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7016 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7017 = x2360 * x7016;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14074,13 +14091,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7020 = x2610 - x7019;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7021{x7013.tot + x7013.mul * x7020, x7013.mul * (*mix)};
+  MixState<Rows> x7021{x7013.tot + mixPows[24] * x7020};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7022 = x2361 * x61;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7023 = x2633 * x6866;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7024 = args[2][107 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7024 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7025 = x2360 * x7024;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14090,13 +14107,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7028 = x2613 - x7027;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7029{x7021.tot + x7021.mul * x7028, x7021.mul * (*mix)};
+  MixState<Rows> x7029{x7021.tot + mixPows[25] * x7028};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7030 = x2361 * x62;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7031 = x2633 * x6869;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7032 = args[2][108 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7032 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7033 = x2360 * x7032;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14106,13 +14123,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7036 = x2616 - x7035;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7037{x7029.tot + x7029.mul * x7036, x7029.mul * (*mix)};
+  MixState<Rows> x7037{x7029.tot + mixPows[26] * x7036};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7038 = x2361 * x63;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7039 = x2633 * x6872;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7040 = args[2][109 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7040 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7041 = x2360 * x7040;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14122,13 +14139,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7044 = x2619 - x7043;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7045{x7037.tot + x7037.mul * x7044, x7037.mul * (*mix)};
+  MixState<Rows> x7045{x7037.tot + mixPows[27] * x7044};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7046 = x2361 * x64;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7047 = x2633 * x6875;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7048 = args[2][110 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7048 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7049 = x2360 * x7048;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14138,13 +14155,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7052 = x2622 - x7051;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7053{x7045.tot + x7045.mul * x7052, x7045.mul * (*mix)};
+  MixState<Rows> x7053{x7045.tot + mixPows[28] * x7052};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7054 = x2361 * x65;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7055 = x2633 * x6878;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7056 = args[2][111 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7056 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7057 = x2360 * x7056;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14154,13 +14171,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7060 = x2625 - x7059;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7061{x7053.tot + x7053.mul * x7060, x7053.mul * (*mix)};
+  MixState<Rows> x7061{x7053.tot + mixPows[29] * x7060};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7062 = x2361 * x66;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7063 = x2633 * x6881;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7064 = args[2][112 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7064 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7065 = x2360 * x7064;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14170,13 +14187,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7068 = x2628 - x7067;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7069{x7061.tot + x7061.mul * x7068, x7061.mul * (*mix)};
+  MixState<Rows> x7069{x7061.tot + mixPows[30] * x7068};
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7070 = x2361 * x67;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
   auto x7071 = x2633 * x6885;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/Reg"("zirgen/circuit/recursion/poseidon.cpp":28:0))
-  auto x7072 = args[2][113 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7072 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":28:0)
   auto x7073 = x2360 * x7072;
   // loc("zirgen/circuit/recursion/poseidon.cpp":29:0)
@@ -14186,11 +14203,11 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
   auto x7076 = x2791 - x7075;
   // loc("zirgen/circuit/recursion/poseidon.cpp":30:0)
-  MixState x7077{x7069.tot + x7069.mul * x7076, x7069.mul * (*mix)};
+  MixState<Rows> x7077{x7069.tot + mixPows[31] * x7076};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x7078{x6856.tot + x6857 * x7077.tot * x6856.mul, x6856.mul * x7077.mul};
+  MixState<Rows> x7078{x6856.tot + x6857 * x7077.tot * mixPows[501]};
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_full(Reg)"("./zirgen/components/mux.h":49:0))
-  auto x7079 = args[0][4 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x7079 = Rows::load(args[0] + 4 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7080 = x4559 * x4559;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14198,7 +14215,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7082 = x2364 - x7081;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7083{x2326.tot + x2326.mul * x7082, x2326.mul * (*mix)};
+  MixState<Rows> x7083{x2326.tot + mixPows[0] * x7082};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7084 = x2364 * x7080;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -14210,13 +14227,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7088 = x2366 - x7087;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7089{x7083.tot + x7083.mul * x7088, x7083.mul * (*mix)};
+  MixState<Rows> x7089{x7083.tot + mixPows[1] * x7088};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7090 = x2366 * x7086;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7091 = x7090 * x4560;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7092 = args[2][92 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7092 = Rows::load(args[2] + 92 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7093 = x7092 * x7092;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14224,13 +14241,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7095 = x2368 - x7094;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7096{x7089.tot + x7089.mul * x7095, x7089.mul * (*mix)};
+  MixState<Rows> x7096{x7089.tot + mixPows[2] * x7095};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7097 = x2368 * x7093;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7098 = x7097 * x7092;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7099 = args[2][93 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7099 = Rows::load(args[2] + 93 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7100 = x7099 * x7099;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14238,13 +14255,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7102 = x2370 - x7101;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7103{x7096.tot + x7096.mul * x7102, x7096.mul * (*mix)};
+  MixState<Rows> x7103{x7096.tot + mixPows[3] * x7102};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7104 = x2370 * x7100;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7105 = x7104 * x7099;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7106 = args[2][94 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7106 = Rows::load(args[2] + 94 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7107 = x7106 * x7106;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14252,13 +14269,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7109 = x2372 - x7108;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7110{x7103.tot + x7103.mul * x7109, x7103.mul * (*mix)};
+  MixState<Rows> x7110{x7103.tot + mixPows[4] * x7109};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7111 = x2372 * x7107;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7112 = x7111 * x7106;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7113 = args[2][95 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7113 = Rows::load(args[2] + 95 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7114 = x7113 * x7113;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14266,13 +14283,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7116 = x2374 - x7115;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7117{x7110.tot + x7110.mul * x7116, x7110.mul * (*mix)};
+  MixState<Rows> x7117{x7110.tot + mixPows[5] * x7116};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7118 = x2374 * x7114;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7119 = x7118 * x7113;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7120 = args[2][96 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7120 = Rows::load(args[2] + 96 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7121 = x7120 * x7120;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14280,13 +14297,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7123 = x2376 - x7122;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7124{x7117.tot + x7117.mul * x7123, x7117.mul * (*mix)};
+  MixState<Rows> x7124{x7117.tot + mixPows[6] * x7123};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7125 = x2376 * x7121;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7126 = x7125 * x7120;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7127 = args[2][97 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7127 = Rows::load(args[2] + 97 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7128 = x7127 * x7127;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14294,13 +14311,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7130 = x2378 - x7129;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7131{x7124.tot + x7124.mul * x7130, x7124.mul * (*mix)};
+  MixState<Rows> x7131{x7124.tot + mixPows[7] * x7130};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7132 = x2378 * x7128;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7133 = x7132 * x7127;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7134 = args[2][98 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7134 = Rows::load(args[2] + 98 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7135 = x7134 * x7134;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14308,13 +14325,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7137 = x2380 - x7136;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7138{x7131.tot + x7131.mul * x7137, x7131.mul * (*mix)};
+  MixState<Rows> x7138{x7131.tot + mixPows[8] * x7137};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7139 = x2380 * x7135;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7140 = x7139 * x7134;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7141 = args[2][99 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7141 = Rows::load(args[2] + 99 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7142 = x7141 * x7141;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14322,13 +14339,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7144 = x2382 - x7143;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7145{x7138.tot + x7138.mul * x7144, x7138.mul * (*mix)};
+  MixState<Rows> x7145{x7138.tot + mixPows[9] * x7144};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7146 = x2382 * x7142;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7147 = x7146 * x7141;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7148 = args[2][100 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7148 = Rows::load(args[2] + 100 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7149 = x7148 * x7148;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14336,13 +14353,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7151 = x2384 - x7150;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7152{x7145.tot + x7145.mul * x7151, x7145.mul * (*mix)};
+  MixState<Rows> x7152{x7145.tot + mixPows[10] * x7151};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7153 = x2384 * x7149;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7154 = x7153 * x7148;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7155 = args[2][101 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7155 = Rows::load(args[2] + 101 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7156 = x7155 * x7155;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14350,13 +14367,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7158 = x2387 - x7157;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7159{x7152.tot + x7152.mul * x7158, x7152.mul * (*mix)};
+  MixState<Rows> x7159{x7152.tot + mixPows[11] * x7158};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7160 = x2387 * x7156;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7161 = x7160 * x7155;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7162 = args[2][102 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7162 = Rows::load(args[2] + 102 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7163 = x7162 * x7162;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14364,13 +14381,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7165 = x2390 - x7164;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7166{x7159.tot + x7159.mul * x7165, x7159.mul * (*mix)};
+  MixState<Rows> x7166{x7159.tot + mixPows[12] * x7165};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7167 = x2390 * x7163;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7168 = x7167 * x7162;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7169 = args[2][103 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7169 = Rows::load(args[2] + 103 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7170 = x7169 * x7169;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14378,13 +14395,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7172 = x2393 - x7171;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7173{x7166.tot + x7166.mul * x7172, x7166.mul * (*mix)};
+  MixState<Rows> x7173{x7166.tot + mixPows[13] * x7172};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7174 = x2393 * x7170;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7175 = x7174 * x7169;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7176 = args[2][104 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7176 = Rows::load(args[2] + 104 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7177 = x7176 * x7176;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14392,13 +14409,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7179 = x2396 - x7178;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7180{x7173.tot + x7173.mul * x7179, x7173.mul * (*mix)};
+  MixState<Rows> x7180{x7173.tot + mixPows[14] * x7179};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7181 = x2396 * x7177;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7182 = x7181 * x7176;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7183 = args[2][105 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7183 = Rows::load(args[2] + 105 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7184 = x7183 * x7183;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14406,13 +14423,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7186 = x2637 - x7185;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7187{x7180.tot + x7180.mul * x7186, x7180.mul * (*mix)};
+  MixState<Rows> x7187{x7180.tot + mixPows[15] * x7186};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7188 = x2637 * x7184;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7189 = x7188 * x7183;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7190 = args[2][106 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7190 = Rows::load(args[2] + 106 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7191 = x7190 * x7190;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14420,13 +14437,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7193 = x2639 - x7192;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7194{x7187.tot + x7187.mul * x7193, x7187.mul * (*mix)};
+  MixState<Rows> x7194{x7187.tot + mixPows[16] * x7193};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7195 = x2639 * x7191;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7196 = x7195 * x7190;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7197 = args[2][107 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7197 = Rows::load(args[2] + 107 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7198 = x7197 * x7197;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14434,13 +14451,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7200 = x2641 - x7199;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7201{x7194.tot + x7194.mul * x7200, x7194.mul * (*mix)};
+  MixState<Rows> x7201{x7194.tot + mixPows[17] * x7200};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7202 = x2641 * x7198;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7203 = x7202 * x7197;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7204 = args[2][108 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7204 = Rows::load(args[2] + 108 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7205 = x7204 * x7204;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14448,13 +14465,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7207 = x2643 - x7206;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7208{x7201.tot + x7201.mul * x7207, x7201.mul * (*mix)};
+  MixState<Rows> x7208{x7201.tot + mixPows[18] * x7207};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7209 = x2643 * x7205;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7210 = x7209 * x7204;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7211 = args[2][109 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7211 = Rows::load(args[2] + 109 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7212 = x7211 * x7211;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14462,13 +14479,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7214 = x2645 - x7213;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7215{x7208.tot + x7208.mul * x7214, x7208.mul * (*mix)};
+  MixState<Rows> x7215{x7208.tot + mixPows[19] * x7214};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7216 = x2645 * x7212;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7217 = x7216 * x7211;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7218 = args[2][110 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7218 = Rows::load(args[2] + 110 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7219 = x7218 * x7218;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14476,13 +14493,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7221 = x2647 - x7220;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7222{x7215.tot + x7215.mul * x7221, x7215.mul * (*mix)};
+  MixState<Rows> x7222{x7215.tot + mixPows[20] * x7221};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7223 = x2647 * x7219;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7224 = x7223 * x7218;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7225 = args[2][111 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7225 = Rows::load(args[2] + 111 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7226 = x7225 * x7225;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14490,13 +14507,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7228 = x2649 - x7227;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7229{x7222.tot + x7222.mul * x7228, x7222.mul * (*mix)};
+  MixState<Rows> x7229{x7222.tot + mixPows[21] * x7228};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7230 = x2649 * x7226;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7231 = x7230 * x7225;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7232 = args[2][112 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7232 = Rows::load(args[2] + 112 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7233 = x7232 * x7232;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14504,13 +14521,13 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7235 = x2651 - x7234;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7236{x7229.tot + x7229.mul * x7235, x7229.mul * (*mix)};
+  MixState<Rows> x7236{x7229.tot + mixPows[22] * x7235};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7237 = x2651 * x7233;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7238 = x7237 * x7232;
   // loc("top(recursion::Top)/mux(Mux)/poseidon_full(recursion::PoseidonFull)/Reg"("zirgen/circuit/recursion/poseidon.cpp":57:0))
-  auto x7239 = args[2][113 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x7239 = Rows::load(args[2] + 113 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x7240 = x7239 * x7239;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -14518,7 +14535,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x7242 = x2653 - x7241;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x7243{x7236.tot + x7236.mul * x7242, x7236.mul * (*mix)};
+  MixState<Rows> x7243{x7236.tot + mixPows[23] * x7242};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x7244 = x2653 * x7240;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17120,7 +17137,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8543 = x2655 - x8542;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8544{x7243.tot + x7243.mul * x8543, x7243.mul * (*mix)};
+  MixState<Rows> x8544{x7243.tot + mixPows[24] * x8543};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8545 = x2655 * x2655;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17128,7 +17145,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8547 = x3216 - x8546;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8548{x8544.tot + x8544.mul * x8547, x8544.mul * (*mix)};
+  MixState<Rows> x8548{x8544.tot + mixPows[25] * x8547};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8549 = x3216 * x8545;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17138,7 +17155,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8552 = x2657 - x8551;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8553{x8548.tot + x8548.mul * x8552, x8548.mul * (*mix)};
+  MixState<Rows> x8553{x8548.tot + mixPows[26] * x8552};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8554 = x2657 * x2657;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17146,7 +17163,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8556 = x3222 - x8555;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8557{x8553.tot + x8553.mul * x8556, x8553.mul * (*mix)};
+  MixState<Rows> x8557{x8553.tot + mixPows[27] * x8556};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8558 = x3222 * x8554;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17156,7 +17173,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8561 = x2660 - x8560;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8562{x8557.tot + x8557.mul * x8561, x8557.mul * (*mix)};
+  MixState<Rows> x8562{x8557.tot + mixPows[28] * x8561};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8563 = x2660 * x2660;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17164,7 +17181,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8565 = x3225 - x8564;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8566{x8562.tot + x8562.mul * x8565, x8562.mul * (*mix)};
+  MixState<Rows> x8566{x8562.tot + mixPows[29] * x8565};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8567 = x3225 * x8563;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17174,7 +17191,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8570 = x2663 - x8569;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8571{x8566.tot + x8566.mul * x8570, x8566.mul * (*mix)};
+  MixState<Rows> x8571{x8566.tot + mixPows[30] * x8570};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8572 = x2663 * x2663;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17182,7 +17199,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8574 = x3231 - x8573;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8575{x8571.tot + x8571.mul * x8574, x8571.mul * (*mix)};
+  MixState<Rows> x8575{x8571.tot + mixPows[31] * x8574};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8576 = x3231 * x8572;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17192,7 +17209,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8579 = x2666 - x8578;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8580{x8575.tot + x8575.mul * x8579, x8575.mul * (*mix)};
+  MixState<Rows> x8580{x8575.tot + mixPows[32] * x8579};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8581 = x2666 * x2666;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17200,7 +17217,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8583 = x3234 - x8582;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8584{x8580.tot + x8580.mul * x8583, x8580.mul * (*mix)};
+  MixState<Rows> x8584{x8580.tot + mixPows[33] * x8583};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8585 = x3234 * x8581;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17210,7 +17227,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8588 = x2669 - x8587;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8589{x8584.tot + x8584.mul * x8588, x8584.mul * (*mix)};
+  MixState<Rows> x8589{x8584.tot + mixPows[34] * x8588};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8590 = x2669 * x2669;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17218,7 +17235,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8592 = x3240 - x8591;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8593{x8589.tot + x8589.mul * x8592, x8589.mul * (*mix)};
+  MixState<Rows> x8593{x8589.tot + mixPows[35] * x8592};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8594 = x3240 * x8590;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17228,7 +17245,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8597 = x2910 - x8596;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8598{x8593.tot + x8593.mul * x8597, x8593.mul * (*mix)};
+  MixState<Rows> x8598{x8593.tot + mixPows[36] * x8597};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8599 = x2910 * x2910;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17236,7 +17253,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8601 = x3243 - x8600;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8602{x8598.tot + x8598.mul * x8601, x8598.mul * (*mix)};
+  MixState<Rows> x8602{x8598.tot + mixPows[37] * x8601};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8603 = x3243 * x8599;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17246,7 +17263,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8606 = x2912 - x8605;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8607{x8602.tot + x8602.mul * x8606, x8602.mul * (*mix)};
+  MixState<Rows> x8607{x8602.tot + mixPows[38] * x8606};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8608 = x2912 * x2912;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17254,7 +17271,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8610 = x3249 - x8609;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8611{x8607.tot + x8607.mul * x8610, x8607.mul * (*mix)};
+  MixState<Rows> x8611{x8607.tot + mixPows[39] * x8610};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8612 = x3249 * x8608;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17264,7 +17281,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8615 = x2914 - x8614;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8616{x8611.tot + x8611.mul * x8615, x8611.mul * (*mix)};
+  MixState<Rows> x8616{x8611.tot + mixPows[40] * x8615};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8617 = x2914 * x2914;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17272,7 +17289,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8619 = x3252 - x8618;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8620{x8616.tot + x8616.mul * x8619, x8616.mul * (*mix)};
+  MixState<Rows> x8620{x8616.tot + mixPows[41] * x8619};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8621 = x3252 * x8617;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17282,7 +17299,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8624 = x2916 - x8623;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8625{x8620.tot + x8620.mul * x8624, x8620.mul * (*mix)};
+  MixState<Rows> x8625{x8620.tot + mixPows[42] * x8624};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8626 = x2916 * x2916;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17290,7 +17307,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8628 = x3258 - x8627;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8629{x8625.tot + x8625.mul * x8628, x8625.mul * (*mix)};
+  MixState<Rows> x8629{x8625.tot + mixPows[43] * x8628};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8630 = x3258 * x8626;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17300,7 +17317,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8633 = x2918 - x8632;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8634{x8629.tot + x8629.mul * x8633, x8629.mul * (*mix)};
+  MixState<Rows> x8634{x8629.tot + mixPows[44] * x8633};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8635 = x2918 * x2918;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17308,7 +17325,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8637 = x3261 - x8636;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8638{x8634.tot + x8634.mul * x8637, x8634.mul * (*mix)};
+  MixState<Rows> x8638{x8634.tot + mixPows[45] * x8637};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8639 = x3261 * x8635;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17318,7 +17335,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8642 = x2920 - x8641;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8643{x8638.tot + x8638.mul * x8642, x8638.mul * (*mix)};
+  MixState<Rows> x8643{x8638.tot + mixPows[46] * x8642};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8644 = x2920 * x2920;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17326,7 +17343,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8646 = x3267 - x8645;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8647{x8643.tot + x8643.mul * x8646, x8643.mul * (*mix)};
+  MixState<Rows> x8647{x8643.tot + mixPows[47] * x8646};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8648 = x3267 * x8644;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17336,7 +17353,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8651 = x2922 - x8650;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8652{x8647.tot + x8647.mul * x8651, x8647.mul * (*mix)};
+  MixState<Rows> x8652{x8647.tot + mixPows[48] * x8651};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8653 = x2922 * x2922;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17344,7 +17361,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8655 = x3270 - x8654;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8656{x8652.tot + x8652.mul * x8655, x8652.mul * (*mix)};
+  MixState<Rows> x8656{x8652.tot + mixPows[49] * x8655};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8657 = x3270 * x8653;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17354,7 +17371,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8660 = x2924 - x8659;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8661{x8656.tot + x8656.mul * x8660, x8656.mul * (*mix)};
+  MixState<Rows> x8661{x8656.tot + mixPows[50] * x8660};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8662 = x2924 * x2924;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17362,7 +17379,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8664 = x3276 - x8663;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8665{x8661.tot + x8661.mul * x8664, x8661.mul * (*mix)};
+  MixState<Rows> x8665{x8661.tot + mixPows[51] * x8664};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8666 = x3276 * x8662;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17372,7 +17389,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8669 = x2926 - x8668;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8670{x8665.tot + x8665.mul * x8669, x8665.mul * (*mix)};
+  MixState<Rows> x8670{x8665.tot + mixPows[52] * x8669};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8671 = x2926 * x2926;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17380,7 +17397,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8673 = x3279 - x8672;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8674{x8670.tot + x8670.mul * x8673, x8670.mul * (*mix)};
+  MixState<Rows> x8674{x8670.tot + mixPows[53] * x8673};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8675 = x3279 * x8671;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17390,7 +17407,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8678 = x2928 - x8677;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8679{x8674.tot + x8674.mul * x8678, x8674.mul * (*mix)};
+  MixState<Rows> x8679{x8674.tot + mixPows[54] * x8678};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8680 = x2928 * x2928;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17398,7 +17415,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8682 = x3285 - x8681;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8683{x8679.tot + x8679.mul * x8682, x8679.mul * (*mix)};
+  MixState<Rows> x8683{x8679.tot + mixPows[55] * x8682};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8684 = x3285 * x8680;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17408,7 +17425,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8687 = x2930 - x8686;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8688{x8683.tot + x8683.mul * x8687, x8683.mul * (*mix)};
+  MixState<Rows> x8688{x8683.tot + mixPows[56] * x8687};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8689 = x2930 * x2930;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17416,7 +17433,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8691 = x3288 - x8690;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8692{x8688.tot + x8688.mul * x8691, x8688.mul * (*mix)};
+  MixState<Rows> x8692{x8688.tot + mixPows[57] * x8691};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8693 = x3288 * x8689;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17426,7 +17443,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8696 = x2933 - x8695;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8697{x8692.tot + x8692.mul * x8696, x8692.mul * (*mix)};
+  MixState<Rows> x8697{x8692.tot + mixPows[58] * x8696};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8698 = x2933 * x2933;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17434,7 +17451,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8700 = x3294 - x8699;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8701{x8697.tot + x8697.mul * x8700, x8697.mul * (*mix)};
+  MixState<Rows> x8701{x8697.tot + mixPows[59] * x8700};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8702 = x3294 * x8698;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17444,7 +17461,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8705 = x2936 - x8704;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8706{x8701.tot + x8701.mul * x8705, x8701.mul * (*mix)};
+  MixState<Rows> x8706{x8701.tot + mixPows[60] * x8705};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8707 = x2936 * x2936;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17452,7 +17469,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8709 = x3297 - x8708;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8710{x8706.tot + x8706.mul * x8709, x8706.mul * (*mix)};
+  MixState<Rows> x8710{x8706.tot + mixPows[61] * x8709};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8711 = x3297 * x8707;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17462,7 +17479,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8714 = x2939 - x8713;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8715{x8710.tot + x8710.mul * x8714, x8710.mul * (*mix)};
+  MixState<Rows> x8715{x8710.tot + mixPows[62] * x8714};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8716 = x2939 * x2939;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17470,7 +17487,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8718 = x3303 - x8717;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8719{x8715.tot + x8715.mul * x8718, x8715.mul * (*mix)};
+  MixState<Rows> x8719{x8715.tot + mixPows[63] * x8718};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8720 = x3303 * x8716;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17480,7 +17497,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8723 = x2942 - x8722;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8724{x8719.tot + x8719.mul * x8723, x8719.mul * (*mix)};
+  MixState<Rows> x8724{x8719.tot + mixPows[64] * x8723};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8725 = x2942 * x2942;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17488,7 +17505,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8727 = x3306 - x8726;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8728{x8724.tot + x8724.mul * x8727, x8724.mul * (*mix)};
+  MixState<Rows> x8728{x8724.tot + mixPows[65] * x8727};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8729 = x3306 * x8725;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17498,7 +17515,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8732 = x3204 - x8731;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8733{x8728.tot + x8728.mul * x8732, x8728.mul * (*mix)};
+  MixState<Rows> x8733{x8728.tot + mixPows[66] * x8732};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8734 = x3204 * x3204;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17506,7 +17523,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8736 = x3312 - x8735;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8737{x8733.tot + x8733.mul * x8736, x8733.mul * (*mix)};
+  MixState<Rows> x8737{x8733.tot + mixPows[67] * x8736};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8738 = x3312 * x8734;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17516,7 +17533,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8741 = x3207 - x8740;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8742{x8737.tot + x8737.mul * x8741, x8737.mul * (*mix)};
+  MixState<Rows> x8742{x8737.tot + mixPows[68] * x8741};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8743 = x3207 * x3207;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17524,7 +17541,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8745 = x3315 - x8744;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8746{x8742.tot + x8742.mul * x8745, x8742.mul * (*mix)};
+  MixState<Rows> x8746{x8742.tot + mixPows[69] * x8745};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8747 = x3315 * x8743;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -17534,7 +17551,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
   auto x8750 = x3213 - x8749;
   // loc("zirgen/circuit/recursion/poseidon.cpp":95:0)
-  MixState x8751{x8746.tot + x8746.mul * x8750, x8746.mul * (*mix)};
+  MixState<Rows> x8751{x8746.tot + mixPows[70] * x8750};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x8752 = x3213 * x3213;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -17542,7 +17559,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x8754 = x3321 - x8753;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x8755{x8751.tot + x8751.mul * x8754, x8751.mul * (*mix)};
+  MixState<Rows> x8755{x8751.tot + mixPows[71] * x8754};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x8756 = x3321 * x8752;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -19952,155 +19969,155 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9959 = x2363 - x9958;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9960{x8755.tot + x8755.mul * x9959, x8755.mul * (*mix)};
+  MixState<Rows> x9960{x8755.tot + mixPows[72] * x9959};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9961 = x8851 + x9891;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9962 = x2330 - x9961;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9963{x9960.tot + x9960.mul * x9962, x9960.mul * (*mix)};
+  MixState<Rows> x9963{x9960.tot + mixPows[73] * x9962};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9964 = x8898 + x9894;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9965 = x2331 - x9964;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9966{x9963.tot + x9963.mul * x9965, x9963.mul * (*mix)};
+  MixState<Rows> x9966{x9963.tot + mixPows[74] * x9965};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9967 = x8945 + x9897;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9968 = x2334 - x9967;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9969{x9966.tot + x9966.mul * x9968, x9966.mul * (*mix)};
+  MixState<Rows> x9969{x9966.tot + mixPows[75] * x9968};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9970 = x8992 + x9900;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9971 = x2337 - x9970;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9972{x9969.tot + x9969.mul * x9971, x9969.mul * (*mix)};
+  MixState<Rows> x9972{x9969.tot + mixPows[76] * x9971};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9973 = x9039 + x9903;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9974 = x2340 - x9973;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9975{x9972.tot + x9972.mul * x9974, x9972.mul * (*mix)};
+  MixState<Rows> x9975{x9972.tot + mixPows[77] * x9974};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9976 = x9086 + x9906;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9977 = x2343 - x9976;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9978{x9975.tot + x9975.mul * x9977, x9975.mul * (*mix)};
+  MixState<Rows> x9978{x9975.tot + mixPows[78] * x9977};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9979 = x9133 + x9909;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9980 = x2346 - x9979;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9981{x9978.tot + x9978.mul * x9980, x9978.mul * (*mix)};
+  MixState<Rows> x9981{x9978.tot + mixPows[79] * x9980};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9982 = x9180 + x9912;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9983 = x2349 - x9982;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9984{x9981.tot + x9981.mul * x9983, x9981.mul * (*mix)};
+  MixState<Rows> x9984{x9981.tot + mixPows[80] * x9983};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9985 = x9227 + x9915;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9986 = x2352 - x9985;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9987{x9984.tot + x9984.mul * x9986, x9984.mul * (*mix)};
+  MixState<Rows> x9987{x9984.tot + mixPows[81] * x9986};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9988 = x9274 + x9918;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9989 = x2355 - x9988;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9990{x9987.tot + x9987.mul * x9989, x9987.mul * (*mix)};
+  MixState<Rows> x9990{x9987.tot + mixPows[82] * x9989};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9991 = x9321 + x9921;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9992 = x2518 - x9991;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9993{x9990.tot + x9990.mul * x9992, x9990.mul * (*mix)};
+  MixState<Rows> x9993{x9990.tot + mixPows[83] * x9992};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9994 = x9368 + x9924;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9995 = x2636 - x9994;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9996{x9993.tot + x9993.mul * x9995, x9993.mul * (*mix)};
+  MixState<Rows> x9996{x9993.tot + mixPows[84] * x9995};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9997 = x9415 + x9927;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x9998 = x2603 - x9997;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x9999{x9996.tot + x9996.mul * x9998, x9996.mul * (*mix)};
+  MixState<Rows> x9999{x9996.tot + mixPows[85] * x9998};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10000 = x9462 + x9930;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10001 = x2604 - x10000;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10002{x9999.tot + x9999.mul * x10001, x9999.mul * (*mix)};
+  MixState<Rows> x10002{x9999.tot + mixPows[86] * x10001};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10003 = x9509 + x9933;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10004 = x2607 - x10003;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10005{x10002.tot + x10002.mul * x10004, x10002.mul * (*mix)};
+  MixState<Rows> x10005{x10002.tot + mixPows[87] * x10004};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10006 = x9556 + x9936;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10007 = x2610 - x10006;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10008{x10005.tot + x10005.mul * x10007, x10005.mul * (*mix)};
+  MixState<Rows> x10008{x10005.tot + mixPows[88] * x10007};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10009 = x9603 + x9939;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10010 = x2613 - x10009;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10011{x10008.tot + x10008.mul * x10010, x10008.mul * (*mix)};
+  MixState<Rows> x10011{x10008.tot + mixPows[89] * x10010};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10012 = x9650 + x9942;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10013 = x2616 - x10012;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10014{x10011.tot + x10011.mul * x10013, x10011.mul * (*mix)};
+  MixState<Rows> x10014{x10011.tot + mixPows[90] * x10013};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10015 = x9697 + x9945;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10016 = x2619 - x10015;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10017{x10014.tot + x10014.mul * x10016, x10014.mul * (*mix)};
+  MixState<Rows> x10017{x10014.tot + mixPows[91] * x10016};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10018 = x9744 + x9948;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10019 = x2622 - x10018;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10020{x10017.tot + x10017.mul * x10019, x10017.mul * (*mix)};
+  MixState<Rows> x10020{x10017.tot + mixPows[92] * x10019};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10021 = x9791 + x9951;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10022 = x2625 - x10021;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10023{x10020.tot + x10020.mul * x10022, x10020.mul * (*mix)};
+  MixState<Rows> x10023{x10020.tot + mixPows[93] * x10022};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10024 = x9838 + x9954;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10025 = x2628 - x10024;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10026{x10023.tot + x10023.mul * x10025, x10023.mul * (*mix)};
+  MixState<Rows> x10026{x10023.tot + mixPows[94] * x10025};
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10027 = x9885 + x9957;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
   auto x10028 = x2791 - x10027;
   // loc("zirgen/circuit/recursion/poseidon.cpp":101:0)
-  MixState x10029{x10026.tot + x10026.mul * x10028, x10026.mul * (*mix)};
+  MixState<Rows> x10029{x10026.tot + mixPows[95] * x10028};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x10030{x7078.tot + x7079 * x10029.tot * x7078.mul, x7078.mul * x10029.mul};
+  MixState<Rows> x10030{x7078.tot + x7079 * x10029.tot * mixPows[533]};
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_partial(Reg)"("./zirgen/components/mux.h":49:0))
-  auto x10031 = args[0][5 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x10031 = Rows::load(args[0] + 5 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":122:0)
   auto x10032 = x4559 + x788;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10033 = x2364 - x10032;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10034{x2326.tot + x2326.mul * x10033, x2326.mul * (*mix)};
+  MixState<Rows> x10034{x2326.tot + mixPows[0] * x10033};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10035 = x2364 * x2364;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20108,7 +20125,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10037 = x2655 - x10036;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10038{x10034.tot + x10034.mul * x10037, x10034.mul * (*mix)};
+  MixState<Rows> x10038{x10034.tot + mixPows[1] * x10037};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10039 = x2655 * x10035;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20212,7 +20229,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10089 = x2366 - x10088;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10090{x10038.tot + x10038.mul * x10089, x10038.mul * (*mix)};
+  MixState<Rows> x10090{x10038.tot + mixPows[2] * x10089};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10091 = x2366 * x2366;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20220,7 +20237,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10093 = x2657 - x10092;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10094{x10090.tot + x10090.mul * x10093, x10090.mul * (*mix)};
+  MixState<Rows> x10094{x10090.tot + mixPows[3] * x10093};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10095 = x2657 * x10091;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20328,7 +20345,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10147 = x2368 - x10146;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10148{x10094.tot + x10094.mul * x10147, x10094.mul * (*mix)};
+  MixState<Rows> x10148{x10094.tot + mixPows[4] * x10147};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10149 = x2368 * x2368;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20336,7 +20353,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10151 = x2660 - x10150;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10152{x10148.tot + x10148.mul * x10151, x10148.mul * (*mix)};
+  MixState<Rows> x10152{x10148.tot + mixPows[5] * x10151};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10153 = x2660 * x10149;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20448,7 +20465,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10207 = x2370 - x10206;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10208{x10152.tot + x10152.mul * x10207, x10152.mul * (*mix)};
+  MixState<Rows> x10208{x10152.tot + mixPows[6] * x10207};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10209 = x2370 * x2370;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20456,7 +20473,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10211 = x2663 - x10210;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10212{x10208.tot + x10208.mul * x10211, x10208.mul * (*mix)};
+  MixState<Rows> x10212{x10208.tot + mixPows[7] * x10211};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10213 = x2663 * x10209;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20572,7 +20589,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10269 = x2372 - x10268;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10270{x10212.tot + x10212.mul * x10269, x10212.mul * (*mix)};
+  MixState<Rows> x10270{x10212.tot + mixPows[8] * x10269};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10271 = x2372 * x2372;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20580,7 +20597,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10273 = x2666 - x10272;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10274{x10270.tot + x10270.mul * x10273, x10270.mul * (*mix)};
+  MixState<Rows> x10274{x10270.tot + mixPows[9] * x10273};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10275 = x2666 * x10271;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20700,7 +20717,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10333 = x2374 - x10332;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10334{x10274.tot + x10274.mul * x10333, x10274.mul * (*mix)};
+  MixState<Rows> x10334{x10274.tot + mixPows[10] * x10333};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10335 = x2374 * x2374;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20708,7 +20725,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10337 = x2669 - x10336;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10338{x10334.tot + x10334.mul * x10337, x10334.mul * (*mix)};
+  MixState<Rows> x10338{x10334.tot + mixPows[11] * x10337};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10339 = x2669 * x10335;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20832,7 +20849,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10399 = x2376 - x10398;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10400{x10338.tot + x10338.mul * x10399, x10338.mul * (*mix)};
+  MixState<Rows> x10400{x10338.tot + mixPows[12] * x10399};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10401 = x2376 * x2376;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20840,7 +20857,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10403 = x2910 - x10402;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10404{x10400.tot + x10400.mul * x10403, x10400.mul * (*mix)};
+  MixState<Rows> x10404{x10400.tot + mixPows[13] * x10403};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10405 = x2910 * x10401;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -20968,7 +20985,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10467 = x2378 - x10466;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10468{x10404.tot + x10404.mul * x10467, x10404.mul * (*mix)};
+  MixState<Rows> x10468{x10404.tot + mixPows[14] * x10467};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10469 = x2378 * x2378;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -20976,7 +20993,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10471 = x2912 - x10470;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10472{x10468.tot + x10468.mul * x10471, x10468.mul * (*mix)};
+  MixState<Rows> x10472{x10468.tot + mixPows[15] * x10471};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10473 = x2912 * x10469;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -21108,7 +21125,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10537 = x2380 - x10536;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10538{x10472.tot + x10472.mul * x10537, x10472.mul * (*mix)};
+  MixState<Rows> x10538{x10472.tot + mixPows[16] * x10537};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10539 = x2380 * x2380;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -21116,7 +21133,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10541 = x2914 - x10540;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10542{x10538.tot + x10538.mul * x10541, x10538.mul * (*mix)};
+  MixState<Rows> x10542{x10538.tot + mixPows[17] * x10541};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10543 = x2914 * x10539;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -21252,7 +21269,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10609 = x2382 - x10608;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10610{x10542.tot + x10542.mul * x10609, x10542.mul * (*mix)};
+  MixState<Rows> x10610{x10542.tot + mixPows[18] * x10609};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10611 = x2382 * x2382;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -21260,7 +21277,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10613 = x2916 - x10612;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10614{x10610.tot + x10610.mul * x10613, x10610.mul * (*mix)};
+  MixState<Rows> x10614{x10610.tot + mixPows[19] * x10613};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10615 = x2916 * x10611;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -21400,7 +21417,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10683 = x2384 - x10682;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10684{x10614.tot + x10614.mul * x10683, x10614.mul * (*mix)};
+  MixState<Rows> x10684{x10614.tot + mixPows[20] * x10683};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10685 = x2384 * x2384;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -21408,7 +21425,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10687 = x2918 - x10686;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10688{x10684.tot + x10684.mul * x10687, x10684.mul * (*mix)};
+  MixState<Rows> x10688{x10684.tot + mixPows[21] * x10687};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10689 = x2918 * x10685;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -21552,7 +21569,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10759 = x2387 - x10758;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10760{x10688.tot + x10688.mul * x10759, x10688.mul * (*mix)};
+  MixState<Rows> x10760{x10688.tot + mixPows[22] * x10759};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10761 = x2387 * x2387;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -21560,7 +21577,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10763 = x2920 - x10762;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10764{x10760.tot + x10760.mul * x10763, x10760.mul * (*mix)};
+  MixState<Rows> x10764{x10760.tot + mixPows[23] * x10763};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10765 = x2920 * x10761;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -21708,7 +21725,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10837 = x2390 - x10836;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10838{x10764.tot + x10764.mul * x10837, x10764.mul * (*mix)};
+  MixState<Rows> x10838{x10764.tot + mixPows[24] * x10837};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10839 = x2390 * x2390;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -21716,7 +21733,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10841 = x2922 - x10840;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10842{x10838.tot + x10838.mul * x10841, x10838.mul * (*mix)};
+  MixState<Rows> x10842{x10838.tot + mixPows[25] * x10841};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10843 = x2922 * x10839;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -21868,7 +21885,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10917 = x2393 - x10916;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x10918{x10842.tot + x10842.mul * x10917, x10842.mul * (*mix)};
+  MixState<Rows> x10918{x10842.tot + mixPows[26] * x10917};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x10919 = x2393 * x2393;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -21876,7 +21893,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x10921 = x2924 - x10920;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x10922{x10918.tot + x10918.mul * x10921, x10918.mul * (*mix)};
+  MixState<Rows> x10922{x10918.tot + mixPows[27] * x10921};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x10923 = x2924 * x10919;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -22032,7 +22049,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x10999 = x2396 - x10998;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11000{x10922.tot + x10922.mul * x10999, x10922.mul * (*mix)};
+  MixState<Rows> x11000{x10922.tot + mixPows[28] * x10999};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11001 = x2396 * x2396;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -22040,7 +22057,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11003 = x2926 - x11002;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11004{x11000.tot + x11000.mul * x11003, x11000.mul * (*mix)};
+  MixState<Rows> x11004{x11000.tot + mixPows[29] * x11003};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11005 = x2926 * x11001;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -22200,7 +22217,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x11083 = x2637 - x11082;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11084{x11004.tot + x11004.mul * x11083, x11004.mul * (*mix)};
+  MixState<Rows> x11084{x11004.tot + mixPows[30] * x11083};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11085 = x2637 * x2637;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -22208,7 +22225,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11087 = x2928 - x11086;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11088{x11084.tot + x11084.mul * x11087, x11084.mul * (*mix)};
+  MixState<Rows> x11088{x11084.tot + mixPows[31] * x11087};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11089 = x2928 * x11085;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -22372,7 +22389,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x11169 = x2639 - x11168;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11170{x11088.tot + x11088.mul * x11169, x11088.mul * (*mix)};
+  MixState<Rows> x11170{x11088.tot + mixPows[32] * x11169};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11171 = x2639 * x2639;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -22380,7 +22397,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11173 = x2930 - x11172;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11174{x11170.tot + x11170.mul * x11173, x11170.mul * (*mix)};
+  MixState<Rows> x11174{x11170.tot + mixPows[33] * x11173};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11175 = x2930 * x11171;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -22548,7 +22565,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x11257 = x2641 - x11256;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11258{x11174.tot + x11174.mul * x11257, x11174.mul * (*mix)};
+  MixState<Rows> x11258{x11174.tot + mixPows[34] * x11257};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11259 = x2641 * x2641;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -22556,7 +22573,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11261 = x2933 - x11260;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11262{x11258.tot + x11258.mul * x11261, x11258.mul * (*mix)};
+  MixState<Rows> x11262{x11258.tot + mixPows[35] * x11261};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11263 = x2933 * x11259;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -22728,7 +22745,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x11347 = x2643 - x11346;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11348{x11262.tot + x11262.mul * x11347, x11262.mul * (*mix)};
+  MixState<Rows> x11348{x11262.tot + mixPows[36] * x11347};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11349 = x2643 * x2643;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -22736,7 +22753,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11351 = x2936 - x11350;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11352{x11348.tot + x11348.mul * x11351, x11348.mul * (*mix)};
+  MixState<Rows> x11352{x11348.tot + mixPows[37] * x11351};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11353 = x2936 * x11349;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -22912,7 +22929,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x11439 = x2645 - x11438;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11440{x11352.tot + x11352.mul * x11439, x11352.mul * (*mix)};
+  MixState<Rows> x11440{x11352.tot + mixPows[38] * x11439};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11441 = x2645 * x2645;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -22920,7 +22937,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11443 = x2939 - x11442;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11444{x11440.tot + x11440.mul * x11443, x11440.mul * (*mix)};
+  MixState<Rows> x11444{x11440.tot + mixPows[39] * x11443};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11445 = x2939 * x11441;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -23100,7 +23117,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
   auto x11533 = x2647 - x11532;
   // loc("zirgen/circuit/recursion/poseidon.cpp":128:0)
-  MixState x11534{x11444.tot + x11444.mul * x11533, x11444.mul * (*mix)};
+  MixState<Rows> x11534{x11444.tot + mixPows[40] * x11533};
   // loc("zirgen/circuit/recursion/poseidon.cpp":58:0)
   auto x11535 = x2647 * x2647;
   // loc("zirgen/circuit/recursion/poseidon.cpp":59:0)
@@ -23108,7 +23125,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
   auto x11537 = x2942 - x11536;
   // loc("zirgen/circuit/recursion/poseidon.cpp":60:0)
-  MixState x11538{x11534.tot + x11534.mul * x11537, x11534.mul * (*mix)};
+  MixState<Rows> x11538{x11534.tot + mixPows[41] * x11537};
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
   auto x11539 = x2942 * x11535;
   // loc("zirgen/circuit/recursion/poseidon.cpp":62:0)
@@ -23294,7 +23311,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x11630 = x2363 - x11629;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x11631{x11538.tot + x11538.mul * x11630, x11538.mul * (*mix)};
+  MixState<Rows> x11631{x11538.tot + mixPows[42] * x11630};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x11632 = x4560 * x1292;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -23476,7 +23493,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x11721 = x2330 - x11720;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x11722{x11631.tot + x11631.mul * x11721, x11631.mul * (*mix)};
+  MixState<Rows> x11722{x11631.tot + mixPows[43] * x11721};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x11723 = x4560 * x1337;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -23658,7 +23675,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x11812 = x2331 - x11811;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x11813{x11722.tot + x11722.mul * x11812, x11722.mul * (*mix)};
+  MixState<Rows> x11813{x11722.tot + mixPows[44] * x11812};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x11814 = x4560 * x1382;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -23840,7 +23857,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x11903 = x2334 - x11902;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x11904{x11813.tot + x11813.mul * x11903, x11813.mul * (*mix)};
+  MixState<Rows> x11904{x11813.tot + mixPows[45] * x11903};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x11905 = x4560 * x1427;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -24022,7 +24039,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x11994 = x2337 - x11993;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x11995{x11904.tot + x11904.mul * x11994, x11904.mul * (*mix)};
+  MixState<Rows> x11995{x11904.tot + mixPows[46] * x11994};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x11996 = x4560 * x1472;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -24204,7 +24221,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12085 = x2340 - x12084;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12086{x11995.tot + x11995.mul * x12085, x11995.mul * (*mix)};
+  MixState<Rows> x12086{x11995.tot + mixPows[47] * x12085};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12087 = x4560 * x1517;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -24386,7 +24403,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12176 = x2343 - x12175;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12177{x12086.tot + x12086.mul * x12176, x12086.mul * (*mix)};
+  MixState<Rows> x12177{x12086.tot + mixPows[48] * x12176};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12178 = x4560 * x1562;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -24568,7 +24585,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12267 = x2346 - x12266;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12268{x12177.tot + x12177.mul * x12267, x12177.mul * (*mix)};
+  MixState<Rows> x12268{x12177.tot + mixPows[49] * x12267};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12269 = x4560 * x1607;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -24750,7 +24767,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12358 = x2349 - x12357;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12359{x12268.tot + x12268.mul * x12358, x12268.mul * (*mix)};
+  MixState<Rows> x12359{x12268.tot + mixPows[50] * x12358};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12360 = x4560 * x1652;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -24932,7 +24949,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12449 = x2352 - x12448;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12450{x12359.tot + x12359.mul * x12449, x12359.mul * (*mix)};
+  MixState<Rows> x12450{x12359.tot + mixPows[51] * x12449};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12451 = x4560 * x1697;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -25114,7 +25131,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12540 = x2355 - x12539;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12541{x12450.tot + x12450.mul * x12540, x12450.mul * (*mix)};
+  MixState<Rows> x12541{x12450.tot + mixPows[52] * x12540};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12542 = x4560 * x1742;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -25296,7 +25313,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12631 = x2518 - x12630;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12632{x12541.tot + x12541.mul * x12631, x12541.mul * (*mix)};
+  MixState<Rows> x12632{x12541.tot + mixPows[53] * x12631};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12633 = x4560 * x1787;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -25478,7 +25495,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12722 = x2636 - x12721;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12723{x12632.tot + x12632.mul * x12722, x12632.mul * (*mix)};
+  MixState<Rows> x12723{x12632.tot + mixPows[54] * x12722};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12724 = x4560 * x1832;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -25660,7 +25677,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12813 = x2603 - x12812;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12814{x12723.tot + x12723.mul * x12813, x12723.mul * (*mix)};
+  MixState<Rows> x12814{x12723.tot + mixPows[55] * x12813};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12815 = x4560 * x1877;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -25842,7 +25859,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12904 = x2604 - x12903;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12905{x12814.tot + x12814.mul * x12904, x12814.mul * (*mix)};
+  MixState<Rows> x12905{x12814.tot + mixPows[56] * x12904};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12906 = x4560 * x1922;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -26024,7 +26041,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x12995 = x2607 - x12994;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x12996{x12905.tot + x12905.mul * x12995, x12905.mul * (*mix)};
+  MixState<Rows> x12996{x12905.tot + mixPows[57] * x12995};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x12997 = x4560 * x1967;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -26206,7 +26223,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13086 = x2610 - x13085;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13087{x12996.tot + x12996.mul * x13086, x12996.mul * (*mix)};
+  MixState<Rows> x13087{x12996.tot + mixPows[58] * x13086};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13088 = x4560 * x2012;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -26388,7 +26405,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13177 = x2613 - x13176;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13178{x13087.tot + x13087.mul * x13177, x13087.mul * (*mix)};
+  MixState<Rows> x13178{x13087.tot + mixPows[59] * x13177};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13179 = x4560 * x2057;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -26570,7 +26587,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13268 = x2616 - x13267;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13269{x13178.tot + x13178.mul * x13268, x13178.mul * (*mix)};
+  MixState<Rows> x13269{x13178.tot + mixPows[60] * x13268};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13270 = x4560 * x2102;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -26752,7 +26769,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13359 = x2619 - x13358;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13360{x13269.tot + x13269.mul * x13359, x13269.mul * (*mix)};
+  MixState<Rows> x13360{x13269.tot + mixPows[61] * x13359};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13361 = x4560 * x2147;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -26934,7 +26951,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13450 = x2622 - x13449;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13451{x13360.tot + x13360.mul * x13450, x13360.mul * (*mix)};
+  MixState<Rows> x13451{x13360.tot + mixPows[62] * x13450};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13452 = x4560 * x2192;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -27116,7 +27133,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13541 = x2625 - x13540;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13542{x13451.tot + x13451.mul * x13541, x13451.mul * (*mix)};
+  MixState<Rows> x13542{x13451.tot + mixPows[63] * x13541};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13543 = x4560 * x2237;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -27298,7 +27315,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13632 = x2628 - x13631;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13633{x13542.tot + x13542.mul * x13632, x13542.mul * (*mix)};
+  MixState<Rows> x13633{x13542.tot + mixPows[64] * x13632};
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
   auto x13634 = x4560 * x2282;
   // loc("zirgen/circuit/recursion/poseidon.cpp":135:0)
@@ -27480,11 +27497,11 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
   auto x13723 = x2791 - x13722;
   // loc("zirgen/circuit/recursion/poseidon.cpp":141:0)
-  MixState x13724{x13633.tot + x13633.mul * x13723, x13633.mul * (*mix)};
+  MixState<Rows> x13724{x13633.tot + mixPows[65] * x13723};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x13725{x10030.tot + x10031 * x13724.tot * x10030.mul, x10030.mul * x13724.mul};
+  MixState<Rows> x13725{x10030.tot + x10031 * x13724.tot * mixPows[629]};
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_store(Reg)"("./zirgen/components/mux.h":49:0))
-  auto x13726 = args[0][6 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x13726 = Rows::load(args[0] + 6 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/poseidon.cpp":162:0)
   auto x13727 = x2362 * x4559;
   // loc("zirgen/circuit/recursion/poseidon.cpp":162:0)
@@ -27574,49 +27591,49 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13770 = x2364 - x2328;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13771{x2326.tot + x2326.mul * x13770, x2326.mul * (*mix)};
+  MixState<Rows> x13771{x2326.tot + mixPows[0] * x13770};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13772 = x2366 - x13769;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13773{x13771.tot + x13771.mul * x13772, x13771.mul * (*mix)};
+  MixState<Rows> x13773{x13771.tot + mixPows[1] * x13772};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13774{x13773.tot + x13773.mul * x2368, x13773.mul * (*mix)};
+  MixState<Rows> x13774{x13773.tot + mixPows[2] * x2368};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13775{x13774.tot + x13774.mul * x2370, x13774.mul * (*mix)};
+  MixState<Rows> x13775{x13774.tot + mixPows[3] * x2370};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13776{x13775.tot + x13775.mul * x2372, x13775.mul * (*mix)};
+  MixState<Rows> x13776{x13775.tot + mixPows[4] * x2372};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13777 = x13754 * x13768;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13778 = x2374 - x2601;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13779{x13776.tot + x13776.mul * x13778, x13776.mul * (*mix)};
+  MixState<Rows> x13779{x13776.tot + mixPows[5] * x13778};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13780 = x2376 - x13777;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13781{x13779.tot + x13779.mul * x13780, x13779.mul * (*mix)};
+  MixState<Rows> x13781{x13779.tot + mixPows[6] * x13780};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13782{x13781.tot + x13781.mul * x2378, x13781.mul * (*mix)};
+  MixState<Rows> x13782{x13781.tot + mixPows[7] * x2378};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13783{x13782.tot + x13782.mul * x2380, x13782.mul * (*mix)};
+  MixState<Rows> x13783{x13782.tot + mixPows[8] * x2380};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13784{x13783.tot + x13783.mul * x2382, x13783.mul * (*mix)};
+  MixState<Rows> x13784{x13783.tot + mixPows[9] * x2382};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13785 = x13756 * x13768;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13786 = x2384 - x2874;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13787{x13784.tot + x13784.mul * x13786, x13784.mul * (*mix)};
+  MixState<Rows> x13787{x13784.tot + mixPows[10] * x13786};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13788 = x2387 - x13785;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13789{x13787.tot + x13787.mul * x13788, x13787.mul * (*mix)};
+  MixState<Rows> x13789{x13787.tot + mixPows[11] * x13788};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13790{x13789.tot + x13789.mul * x2390, x13789.mul * (*mix)};
+  MixState<Rows> x13790{x13789.tot + mixPows[12] * x2390};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13791{x13790.tot + x13790.mul * x2393, x13790.mul * (*mix)};
+  MixState<Rows> x13791{x13790.tot + mixPows[13] * x2393};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13792{x13791.tot + x13791.mul * x2396, x13791.mul * (*mix)};
+  MixState<Rows> x13792{x13791.tot + mixPows[14] * x2396};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13793 = x13758 * x13768;
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
@@ -27624,17 +27641,17 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13795 = x2637 - x13794;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13796{x13792.tot + x13792.mul * x13795, x13792.mul * (*mix)};
+  MixState<Rows> x13796{x13792.tot + mixPows[15] * x13795};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13797 = x2639 - x13793;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13798{x13796.tot + x13796.mul * x13797, x13796.mul * (*mix)};
+  MixState<Rows> x13798{x13796.tot + mixPows[16] * x13797};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13799{x13798.tot + x13798.mul * x2641, x13798.mul * (*mix)};
+  MixState<Rows> x13799{x13798.tot + mixPows[17] * x2641};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13800{x13799.tot + x13799.mul * x2643, x13799.mul * (*mix)};
+  MixState<Rows> x13800{x13799.tot + mixPows[18] * x2643};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13801{x13800.tot + x13800.mul * x2645, x13800.mul * (*mix)};
+  MixState<Rows> x13801{x13800.tot + mixPows[19] * x2645};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13802 = x13760 * x13768;
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
@@ -27642,17 +27659,17 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13804 = x2647 - x13803;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13805{x13801.tot + x13801.mul * x13804, x13801.mul * (*mix)};
+  MixState<Rows> x13805{x13801.tot + mixPows[20] * x13804};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13806 = x2649 - x13802;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13807{x13805.tot + x13805.mul * x13806, x13805.mul * (*mix)};
+  MixState<Rows> x13807{x13805.tot + mixPows[21] * x13806};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13808{x13807.tot + x13807.mul * x2651, x13807.mul * (*mix)};
+  MixState<Rows> x13808{x13807.tot + mixPows[22] * x2651};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13809{x13808.tot + x13808.mul * x2653, x13808.mul * (*mix)};
+  MixState<Rows> x13809{x13808.tot + mixPows[23] * x2653};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13810{x13809.tot + x13809.mul * x2655, x13809.mul * (*mix)};
+  MixState<Rows> x13810{x13809.tot + mixPows[24] * x2655};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13811 = x13762 * x13768;
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
@@ -27660,17 +27677,17 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13813 = x2657 - x13812;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13814{x13810.tot + x13810.mul * x13813, x13810.mul * (*mix)};
+  MixState<Rows> x13814{x13810.tot + mixPows[25] * x13813};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13815 = x2660 - x13811;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13816{x13814.tot + x13814.mul * x13815, x13814.mul * (*mix)};
+  MixState<Rows> x13816{x13814.tot + mixPows[26] * x13815};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13817{x13816.tot + x13816.mul * x2663, x13816.mul * (*mix)};
+  MixState<Rows> x13817{x13816.tot + mixPows[27] * x2663};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13818{x13817.tot + x13817.mul * x2666, x13817.mul * (*mix)};
+  MixState<Rows> x13818{x13817.tot + mixPows[28] * x2666};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13819{x13818.tot + x13818.mul * x2669, x13818.mul * (*mix)};
+  MixState<Rows> x13819{x13818.tot + mixPows[29] * x2669};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13820 = x13764 * x13768;
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
@@ -27678,17 +27695,17 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13822 = x2910 - x13821;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13823{x13819.tot + x13819.mul * x13822, x13819.mul * (*mix)};
+  MixState<Rows> x13823{x13819.tot + mixPows[30] * x13822};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13824 = x2912 - x13820;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13825{x13823.tot + x13823.mul * x13824, x13823.mul * (*mix)};
+  MixState<Rows> x13825{x13823.tot + mixPows[31] * x13824};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13826{x13825.tot + x13825.mul * x2914, x13825.mul * (*mix)};
+  MixState<Rows> x13826{x13825.tot + mixPows[32] * x2914};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13827{x13826.tot + x13826.mul * x2916, x13826.mul * (*mix)};
+  MixState<Rows> x13827{x13826.tot + mixPows[33] * x2916};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13828{x13827.tot + x13827.mul * x2918, x13827.mul * (*mix)};
+  MixState<Rows> x13828{x13827.tot + mixPows[34] * x2918};
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
   auto x13829 = x13766 * x13768;
   // loc("zirgen/circuit/recursion/poseidon.cpp":166:0)
@@ -27696,157 +27713,157 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
   auto x13831 = x2920 - x13830;
   // loc("zirgen/circuit/recursion/wom.cpp":85:0)
-  MixState x13832{x13828.tot + x13828.mul * x13831, x13828.mul * (*mix)};
+  MixState<Rows> x13832{x13828.tot + mixPows[35] * x13831};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
   auto x13833 = x2922 - x13829;
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13834{x13832.tot + x13832.mul * x13833, x13832.mul * (*mix)};
+  MixState<Rows> x13834{x13832.tot + mixPows[36] * x13833};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13835{x13834.tot + x13834.mul * x2924, x13834.mul * (*mix)};
+  MixState<Rows> x13835{x13834.tot + mixPows[37] * x2924};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13836{x13835.tot + x13835.mul * x2926, x13835.mul * (*mix)};
+  MixState<Rows> x13836{x13835.tot + mixPows[38] * x2926};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x13837{x13836.tot + x13836.mul * x2928, x13836.mul * (*mix)};
+  MixState<Rows> x13837{x13836.tot + mixPows[39] * x2928};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13838 = x2363 - x4559;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13839{x13837.tot + x13837.mul * x13838, x13837.mul * (*mix)};
+  MixState<Rows> x13839{x13837.tot + mixPows[40] * x13838};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13840 = x2330 - x4560;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13841{x13839.tot + x13839.mul * x13840, x13839.mul * (*mix)};
+  MixState<Rows> x13841{x13839.tot + mixPows[41] * x13840};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13842 = x2331 - x7092;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13843{x13841.tot + x13841.mul * x13842, x13841.mul * (*mix)};
+  MixState<Rows> x13843{x13841.tot + mixPows[42] * x13842};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13844 = x2334 - x7099;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13845{x13843.tot + x13843.mul * x13844, x13843.mul * (*mix)};
+  MixState<Rows> x13845{x13843.tot + mixPows[43] * x13844};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13846 = x2337 - x7106;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13847{x13845.tot + x13845.mul * x13846, x13845.mul * (*mix)};
+  MixState<Rows> x13847{x13845.tot + mixPows[44] * x13846};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13848 = x2340 - x7113;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13849{x13847.tot + x13847.mul * x13848, x13847.mul * (*mix)};
+  MixState<Rows> x13849{x13847.tot + mixPows[45] * x13848};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13850 = x2343 - x7120;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13851{x13849.tot + x13849.mul * x13850, x13849.mul * (*mix)};
+  MixState<Rows> x13851{x13849.tot + mixPows[46] * x13850};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13852 = x2346 - x7127;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13853{x13851.tot + x13851.mul * x13852, x13851.mul * (*mix)};
+  MixState<Rows> x13853{x13851.tot + mixPows[47] * x13852};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13854 = x2349 - x7134;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13855{x13853.tot + x13853.mul * x13854, x13853.mul * (*mix)};
+  MixState<Rows> x13855{x13853.tot + mixPows[48] * x13854};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13856 = x2352 - x7141;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13857{x13855.tot + x13855.mul * x13856, x13855.mul * (*mix)};
+  MixState<Rows> x13857{x13855.tot + mixPows[49] * x13856};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13858 = x2355 - x7148;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13859{x13857.tot + x13857.mul * x13858, x13857.mul * (*mix)};
+  MixState<Rows> x13859{x13857.tot + mixPows[50] * x13858};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13860 = x2518 - x7155;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13861{x13859.tot + x13859.mul * x13860, x13859.mul * (*mix)};
+  MixState<Rows> x13861{x13859.tot + mixPows[51] * x13860};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13862 = x2636 - x7162;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13863{x13861.tot + x13861.mul * x13862, x13861.mul * (*mix)};
+  MixState<Rows> x13863{x13861.tot + mixPows[52] * x13862};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13864 = x2603 - x7169;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13865{x13863.tot + x13863.mul * x13864, x13863.mul * (*mix)};
+  MixState<Rows> x13865{x13863.tot + mixPows[53] * x13864};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13866 = x2604 - x7176;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13867{x13865.tot + x13865.mul * x13866, x13865.mul * (*mix)};
+  MixState<Rows> x13867{x13865.tot + mixPows[54] * x13866};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13868 = x2607 - x7183;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13869{x13867.tot + x13867.mul * x13868, x13867.mul * (*mix)};
+  MixState<Rows> x13869{x13867.tot + mixPows[55] * x13868};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13870 = x2610 - x7190;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13871{x13869.tot + x13869.mul * x13870, x13869.mul * (*mix)};
+  MixState<Rows> x13871{x13869.tot + mixPows[56] * x13870};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13872 = x2613 - x7197;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13873{x13871.tot + x13871.mul * x13872, x13871.mul * (*mix)};
+  MixState<Rows> x13873{x13871.tot + mixPows[57] * x13872};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13874 = x2616 - x7204;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13875{x13873.tot + x13873.mul * x13874, x13873.mul * (*mix)};
+  MixState<Rows> x13875{x13873.tot + mixPows[58] * x13874};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13876 = x2619 - x7211;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13877{x13875.tot + x13875.mul * x13876, x13875.mul * (*mix)};
+  MixState<Rows> x13877{x13875.tot + mixPows[59] * x13876};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13878 = x2622 - x7218;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13879{x13877.tot + x13877.mul * x13878, x13877.mul * (*mix)};
+  MixState<Rows> x13879{x13877.tot + mixPows[60] * x13878};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13880 = x2625 - x7225;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13881{x13879.tot + x13879.mul * x13880, x13879.mul * (*mix)};
+  MixState<Rows> x13881{x13879.tot + mixPows[61] * x13880};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13882 = x2628 - x7232;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13883{x13881.tot + x13881.mul * x13882, x13881.mul * (*mix)};
+  MixState<Rows> x13883{x13881.tot + mixPows[62] * x13882};
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
   auto x13884 = x2791 - x7239;
   // loc("zirgen/circuit/recursion/poseidon.cpp":169:0)
-  MixState x13885{x13883.tot + x13883.mul * x13884, x13883.mul * (*mix)};
+  MixState<Rows> x13885{x13883.tot + mixPows[63] * x13884};
   // loc("./zirgen/components/mux.h":49:0)
-  MixState x13886{x13725.tot + x13726 * x13885.tot * x13725.mul, x13725.mul * x13885.mul};
+  MixState<Rows> x13886{x13725.tot + x13726 * x13885.tot * mixPows[695]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13887{x2326.tot + x2329 * x2326.tot * x2326.mul, x2326.mul * x2326.mul};
+  MixState<Rows> x13887{x2326.tot + x2329 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13888{x13887.tot + x2360 * x2326.tot * x13887.mul, x13887.mul * x2326.mul};
+  MixState<Rows> x13888{x13887.tot + x2360 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13889{x13888.tot + x2361 * x2326.tot * x13888.mul, x13888.mul * x2326.mul};
+  MixState<Rows> x13889{x13888.tot + x2361 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13890{x13889.tot + x2362 * x2326.tot * x13889.mul, x13889.mul * x2326.mul};
+  MixState<Rows> x13890{x13889.tot + x2362 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13891{x13890.tot + x2602 * x2326.tot * x13890.mul, x13890.mul * x2326.mul};
+  MixState<Rows> x13891{x13890.tot + x2602 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13892{x13891.tot + x2906 * x2326.tot * x13891.mul, x13891.mul * x2326.mul};
+  MixState<Rows> x13892{x13891.tot + x2906 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13893{x13886.tot + x3148 * x13892.tot * x13886.mul, x13886.mul * x13892.mul};
+  MixState<Rows> x13893{x13886.tot + x3148 * x13892.tot * mixPows[759]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13894{x13893.tot + x6857 * x2326.tot * x13893.mul, x13893.mul * x2326.mul};
+  MixState<Rows> x13894{x13893.tot + x6857 * x2326.tot * mixPows[759]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13895{x13894.tot + x13726 * x2326.tot * x13894.mul, x13894.mul * x2326.mul};
+  MixState<Rows> x13895{x13894.tot + x13726 * x2326.tot * mixPows[759]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13896{x13895.tot + x2327 * x2326.tot * x13895.mul, x13895.mul * x2326.mul};
+  MixState<Rows> x13896{x13895.tot + x2327 * x2326.tot * mixPows[759]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13897{x2326.tot + x2362 * x2326.tot * x2326.mul, x2326.mul * x2326.mul};
+  MixState<Rows> x13897{x2326.tot + x2362 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13898{x13897.tot + x2602 * x2326.tot * x13897.mul, x13897.mul * x2326.mul};
+  MixState<Rows> x13898{x13897.tot + x2602 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13899{x13898.tot + x2633 * x2326.tot * x13898.mul, x13898.mul * x2326.mul};
+  MixState<Rows> x13899{x13898.tot + x2633 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13900{x13899.tot + x2634 * x2326.tot * x13899.mul, x13899.mul * x2326.mul};
+  MixState<Rows> x13900{x13899.tot + x2634 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13901{x13900.tot + x2635 * x2326.tot * x13900.mul, x13900.mul * x2326.mul};
+  MixState<Rows> x13901{x13900.tot + x2635 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13902{x13901.tot + x2875 * x2326.tot * x13901.mul, x13901.mul * x2326.mul};
+  MixState<Rows> x13902{x13901.tot + x2875 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13903{x13902.tot + x2906 * x2326.tot * x13902.mul, x13902.mul * x2326.mul};
+  MixState<Rows> x13903{x13902.tot + x2906 * x2326.tot * mixPows[0]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13904{x13896.tot + x3148 * x13903.tot * x13896.mul, x13896.mul * x13903.mul};
+  MixState<Rows> x13904{x13896.tot + x3148 * x13903.tot * mixPows[759]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13905{x13904.tot + x6857 * x2326.tot * x13904.mul, x13904.mul * x2326.mul};
+  MixState<Rows> x13905{x13904.tot + x6857 * x2326.tot * mixPows[759]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x13906{x13905.tot + x13726 * x2326.tot * x13905.mul, x13905.mul * x2326.mul};
+  MixState<Rows> x13906{x13905.tot + x13726 * x2326.tot * mixPows[759]};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":59:0))
-  auto x13907 = args[2][0 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x13907 = Rows::load(args[2] + 0 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13908 = x3204 - x13907;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -27854,33 +27871,33 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13910 = x13908 * x13909;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13911{x2326.tot + x2326.mul * x13910, x2326.mul * (*mix)};
+  MixState<Rows> x13911{x2326.tot + mixPows[0] * x13910};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x13912 = args[2][1 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x13912 = Rows::load(args[2] + 1 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13913 = x13912 - x3207;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13914{x2326.tot + x2326.mul * x13913, x2326.mul * (*mix)};
+  MixState<Rows> x13914{x2326.tot + mixPows[0] * x13913};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x13915 = args[2][2 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x13915 = Rows::load(args[2] + 2 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13916 = x13915 - x3213;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13917{x13914.tot + x13914.mul * x13916, x13914.mul * (*mix)};
+  MixState<Rows> x13917{x13914.tot + mixPows[1] * x13916};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x13918 = args[2][3 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x13918 = Rows::load(args[2] + 3 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13919 = x13918 - x3216;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13920{x13917.tot + x13917.mul * x13919, x13917.mul * (*mix)};
+  MixState<Rows> x13920{x13917.tot + mixPows[2] * x13919};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x13921 = args[2][4 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x13921 = Rows::load(args[2] + 4 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13922 = x13921 - x3222;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13923{x13920.tot + x13920.mul * x13922, x13920.mul * (*mix)};
+  MixState<Rows> x13923{x13920.tot + mixPows[3] * x13922};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x13924{x13911.tot + x13909 * x13923.tot * x13911.mul, x13911.mul * x13923.mul};
+  MixState<Rows> x13924{x13911.tot + x13909 * x13923.tot * mixPows[1]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13925 = x3225 - x3204;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -27888,25 +27905,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13927 = x13925 * x13926;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13928{x13924.tot + x13924.mul * x13927, x13924.mul * (*mix)};
+  MixState<Rows> x13928{x13924.tot + mixPows[5] * x13927};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13929 = x3207 - x3231;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13930{x2326.tot + x2326.mul * x13929, x2326.mul * (*mix)};
+  MixState<Rows> x13930{x2326.tot + mixPows[0] * x13929};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13931 = x3213 - x3234;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13932{x13930.tot + x13930.mul * x13931, x13930.mul * (*mix)};
+  MixState<Rows> x13932{x13930.tot + mixPows[1] * x13931};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13933 = x3216 - x3240;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13934{x13932.tot + x13932.mul * x13933, x13932.mul * (*mix)};
+  MixState<Rows> x13934{x13932.tot + mixPows[2] * x13933};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13935 = x3222 - x3243;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13936{x13934.tot + x13934.mul * x13935, x13934.mul * (*mix)};
+  MixState<Rows> x13936{x13934.tot + mixPows[3] * x13935};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x13937{x13928.tot + x13926 * x13936.tot * x13928.mul, x13928.mul * x13936.mul};
+  MixState<Rows> x13937{x13928.tot + x13926 * x13936.tot * mixPows[6]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13938 = x3249 - x3225;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -27914,25 +27931,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13940 = x13938 * x13939;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13941{x13937.tot + x13937.mul * x13940, x13937.mul * (*mix)};
+  MixState<Rows> x13941{x13937.tot + mixPows[10] * x13940};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13942 = x3231 - x3252;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13943{x2326.tot + x2326.mul * x13942, x2326.mul * (*mix)};
+  MixState<Rows> x13943{x2326.tot + mixPows[0] * x13942};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13944 = x3234 - x3258;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13945{x13943.tot + x13943.mul * x13944, x13943.mul * (*mix)};
+  MixState<Rows> x13945{x13943.tot + mixPows[1] * x13944};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13946 = x3240 - x3261;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13947{x13945.tot + x13945.mul * x13946, x13945.mul * (*mix)};
+  MixState<Rows> x13947{x13945.tot + mixPows[2] * x13946};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13948 = x3243 - x3267;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13949{x13947.tot + x13947.mul * x13948, x13947.mul * (*mix)};
+  MixState<Rows> x13949{x13947.tot + mixPows[3] * x13948};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x13950{x13941.tot + x13939 * x13949.tot * x13941.mul, x13941.mul * x13949.mul};
+  MixState<Rows> x13950{x13941.tot + x13939 * x13949.tot * mixPows[11]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13951 = x3270 - x3249;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -27940,25 +27957,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13953 = x13951 * x13952;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13954{x13950.tot + x13950.mul * x13953, x13950.mul * (*mix)};
+  MixState<Rows> x13954{x13950.tot + mixPows[15] * x13953};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13955 = x3252 - x3276;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13956{x2326.tot + x2326.mul * x13955, x2326.mul * (*mix)};
+  MixState<Rows> x13956{x2326.tot + mixPows[0] * x13955};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13957 = x3258 - x3279;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13958{x13956.tot + x13956.mul * x13957, x13956.mul * (*mix)};
+  MixState<Rows> x13958{x13956.tot + mixPows[1] * x13957};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13959 = x3261 - x3285;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13960{x13958.tot + x13958.mul * x13959, x13958.mul * (*mix)};
+  MixState<Rows> x13960{x13958.tot + mixPows[2] * x13959};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13961 = x3267 - x3288;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13962{x13960.tot + x13960.mul * x13961, x13960.mul * (*mix)};
+  MixState<Rows> x13962{x13960.tot + mixPows[3] * x13961};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x13963{x13954.tot + x13952 * x13962.tot * x13954.mul, x13954.mul * x13962.mul};
+  MixState<Rows> x13963{x13954.tot + x13952 * x13962.tot * mixPows[16]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13964 = x3294 - x3270;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -27966,25 +27983,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13966 = x13964 * x13965;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13967{x13963.tot + x13963.mul * x13966, x13963.mul * (*mix)};
+  MixState<Rows> x13967{x13963.tot + mixPows[20] * x13966};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13968 = x3276 - x3297;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13969{x2326.tot + x2326.mul * x13968, x2326.mul * (*mix)};
+  MixState<Rows> x13969{x2326.tot + mixPows[0] * x13968};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13970 = x3279 - x3303;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13971{x13969.tot + x13969.mul * x13970, x13969.mul * (*mix)};
+  MixState<Rows> x13971{x13969.tot + mixPows[1] * x13970};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13972 = x3285 - x3306;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13973{x13971.tot + x13971.mul * x13972, x13971.mul * (*mix)};
+  MixState<Rows> x13973{x13971.tot + mixPows[2] * x13972};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13974 = x3288 - x3312;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13975{x13973.tot + x13973.mul * x13974, x13973.mul * (*mix)};
+  MixState<Rows> x13975{x13973.tot + mixPows[3] * x13974};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x13976{x13967.tot + x13965 * x13975.tot * x13967.mul, x13967.mul * x13975.mul};
+  MixState<Rows> x13976{x13967.tot + x13965 * x13975.tot * mixPows[21]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13977 = x3315 - x3294;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -27992,25 +28009,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13979 = x13977 * x13978;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13980{x13976.tot + x13976.mul * x13979, x13976.mul * (*mix)};
+  MixState<Rows> x13980{x13976.tot + mixPows[25] * x13979};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13981 = x3297 - x3321;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13982{x2326.tot + x2326.mul * x13981, x2326.mul * (*mix)};
+  MixState<Rows> x13982{x2326.tot + mixPows[0] * x13981};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13983 = x3303 - x3324;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13984{x13982.tot + x13982.mul * x13983, x13982.mul * (*mix)};
+  MixState<Rows> x13984{x13982.tot + mixPows[1] * x13983};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13985 = x3306 - x3330;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13986{x13984.tot + x13984.mul * x13985, x13984.mul * (*mix)};
+  MixState<Rows> x13986{x13984.tot + mixPows[2] * x13985};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13987 = x3312 - x3333;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13988{x13986.tot + x13986.mul * x13987, x13986.mul * (*mix)};
+  MixState<Rows> x13988{x13986.tot + mixPows[3] * x13987};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x13989{x13980.tot + x13978 * x13988.tot * x13980.mul, x13980.mul * x13988.mul};
+  MixState<Rows> x13989{x13980.tot + x13978 * x13988.tot * mixPows[26]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x13990 = x3339 - x3315;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28018,25 +28035,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x13992 = x13990 * x13991;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x13993{x13989.tot + x13989.mul * x13992, x13989.mul * (*mix)};
+  MixState<Rows> x13993{x13989.tot + mixPows[30] * x13992};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13994 = x3321 - x3342;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13995{x2326.tot + x2326.mul * x13994, x2326.mul * (*mix)};
+  MixState<Rows> x13995{x2326.tot + mixPows[0] * x13994};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13996 = x3324 - x3348;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13997{x13995.tot + x13995.mul * x13996, x13995.mul * (*mix)};
+  MixState<Rows> x13997{x13995.tot + mixPows[1] * x13996};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x13998 = x3330 - x3351;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x13999{x13997.tot + x13997.mul * x13998, x13997.mul * (*mix)};
+  MixState<Rows> x13999{x13997.tot + mixPows[2] * x13998};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14000 = x3333 - x3357;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14001{x13999.tot + x13999.mul * x14000, x13999.mul * (*mix)};
+  MixState<Rows> x14001{x13999.tot + mixPows[3] * x14000};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14002{x13993.tot + x13991 * x14001.tot * x13993.mul, x13993.mul * x14001.mul};
+  MixState<Rows> x14002{x13993.tot + x13991 * x14001.tot * mixPows[31]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14003 = x3360 - x3339;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28044,27 +28061,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14005 = x14003 * x14004;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14006{x14002.tot + x14002.mul * x14005, x14002.mul * (*mix)};
+  MixState<Rows> x14006{x14002.tot + mixPows[35] * x14005};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14007 = x3342 - x3366;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14008{x2326.tot + x2326.mul * x14007, x2326.mul * (*mix)};
+  MixState<Rows> x14008{x2326.tot + mixPows[0] * x14007};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14009 = x3348 - x3369;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14010{x14008.tot + x14008.mul * x14009, x14008.mul * (*mix)};
+  MixState<Rows> x14010{x14008.tot + mixPows[1] * x14009};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14011 = x3351 - x3375;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14012{x14010.tot + x14010.mul * x14011, x14010.mul * (*mix)};
+  MixState<Rows> x14012{x14010.tot + mixPows[2] * x14011};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14013 = x3357 - x3378;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14014{x14012.tot + x14012.mul * x14013, x14012.mul * (*mix)};
+  MixState<Rows> x14014{x14012.tot + mixPows[3] * x14013};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14015{x14006.tot + x14004 * x14014.tot * x14006.mul, x14006.mul * x14014.mul};
+  MixState<Rows> x14015{x14006.tot + x14004 * x14014.tot * mixPows[36]};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("./zirgen/compiler/edsl/edsl.h":117:0))
-  auto x14016 = args[2][0 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x14016 = Rows::load(args[2] + 0 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14017 = x14016 - x3360;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28072,47 +28089,47 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14019 = x14017 * x14018;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14020{x14015.tot + x14015.mul * x14019, x14015.mul * (*mix)};
+  MixState<Rows> x14020{x14015.tot + mixPows[40] * x14019};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x14021 = args[2][1 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x14021 = Rows::load(args[2] + 1 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14022 = x3366 - x14021;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14023{x2326.tot + x2326.mul * x14022, x2326.mul * (*mix)};
+  MixState<Rows> x14023{x2326.tot + mixPows[0] * x14022};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x14024 = args[2][2 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x14024 = Rows::load(args[2] + 2 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14025 = x3369 - x14024;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14026{x14023.tot + x14023.mul * x14025, x14023.mul * (*mix)};
+  MixState<Rows> x14026{x14023.tot + mixPows[1] * x14025};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x14027 = args[2][3 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x14027 = Rows::load(args[2] + 3 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14028 = x3375 - x14027;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14029{x14026.tot + x14026.mul * x14028, x14026.mul * (*mix)};
+  MixState<Rows> x14029{x14026.tot + mixPows[2] * x14028};
   // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":66:0))
-  auto x14030 = args[2][4 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x14030 = Rows::load(args[2] + 4 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14031 = x3378 - x14030;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14032{x14029.tot + x14029.mul * x14031, x14029.mul * (*mix)};
+  MixState<Rows> x14032{x14029.tot + mixPows[3] * x14031};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14033{x14020.tot + x14018 * x14032.tot * x14020.mul, x14020.mul * x14032.mul};
+  MixState<Rows> x14033{x14020.tot + x14018 * x14032.tot * mixPows[41]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14034{x13906.tot + x2327 * x14033.tot * x13906.mul, x13906.mul * x14033.mul};
+  MixState<Rows> x14034{x13906.tot + x2327 * x14033.tot * mixPows[759]};
   // loc("zirgen/circuit/recursion/wom.cpp":12:0)
-  MixState x14035{x2326.tot + x2326.mul * x14016, x2326.mul * (*mix)};
+  MixState<Rows> x14035{x2326.tot + mixPows[0] * x14016};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x14036{x14035.tot + x14035.mul * x14021, x14035.mul * (*mix)};
+  MixState<Rows> x14036{x14035.tot + mixPows[1] * x14021};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x14037{x14036.tot + x14036.mul * x14024, x14036.mul * (*mix)};
+  MixState<Rows> x14037{x14036.tot + mixPows[2] * x14024};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x14038{x14037.tot + x14037.mul * x14027, x14037.mul * (*mix)};
+  MixState<Rows> x14038{x14037.tot + mixPows[3] * x14027};
   // loc("zirgen/circuit/recursion/wom.cpp":49:0)
-  MixState x14039{x14038.tot + x14038.mul * x14030, x14038.mul * (*mix)};
+  MixState<Rows> x14039{x14038.tot + mixPows[4] * x14030};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14040{x2326.tot + x2360 * x14039.tot * x2326.mul, x2326.mul * x14039.mul};
+  MixState<Rows> x14040{x2326.tot + x2360 * x14039.tot * mixPows[0]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14041 = x2376 - x13907;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28120,27 +28137,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14043 = x14041 * x14042;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14044{x2326.tot + x2326.mul * x14043, x2326.mul * (*mix)};
+  MixState<Rows> x14044{x2326.tot + mixPows[0] * x14043};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14045 = x13912 - x2378;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14046{x2326.tot + x2326.mul * x14045, x2326.mul * (*mix)};
+  MixState<Rows> x14046{x2326.tot + mixPows[0] * x14045};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14047 = x13915 - x2380;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14048{x14046.tot + x14046.mul * x14047, x14046.mul * (*mix)};
+  MixState<Rows> x14048{x14046.tot + mixPows[1] * x14047};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14049 = x13918 - x2382;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14050{x14048.tot + x14048.mul * x14049, x14048.mul * (*mix)};
+  MixState<Rows> x14050{x14048.tot + mixPows[2] * x14049};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14051 = x13921 - x2384;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14052{x14050.tot + x14050.mul * x14051, x14050.mul * (*mix)};
+  MixState<Rows> x14052{x14050.tot + mixPows[3] * x14051};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14053{x14044.tot + x14042 * x14052.tot * x14044.mul, x14044.mul * x14052.mul};
+  MixState<Rows> x14053{x14044.tot + x14042 * x14052.tot * mixPows[1]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14054{x14040.tot + x2361 * x14053.tot * x14040.mul, x14040.mul * x14053.mul};
+  MixState<Rows> x14054{x14040.tot + x2361 * x14053.tot * mixPows[5]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14055 = x2649 - x13907;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28148,49 +28165,49 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14057 = x14055 * x14056;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14058{x2326.tot + x2326.mul * x14057, x2326.mul * (*mix)};
+  MixState<Rows> x14058{x2326.tot + mixPows[0] * x14057};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14059 = x13912 - x2651;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14060{x2326.tot + x2326.mul * x14059, x2326.mul * (*mix)};
+  MixState<Rows> x14060{x2326.tot + mixPows[0] * x14059};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14061 = x13915 - x2653;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14062{x14060.tot + x14060.mul * x14061, x14060.mul * (*mix)};
+  MixState<Rows> x14062{x14060.tot + mixPows[1] * x14061};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14063 = x13918 - x2655;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14064{x14062.tot + x14062.mul * x14063, x14062.mul * (*mix)};
+  MixState<Rows> x14064{x14062.tot + mixPows[2] * x14063};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14065 = x13921 - x2657;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14066{x14064.tot + x14064.mul * x14065, x14064.mul * (*mix)};
+  MixState<Rows> x14066{x14064.tot + mixPows[3] * x14065};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14067{x14058.tot + x14056 * x14066.tot * x14058.mul, x14058.mul * x14066.mul};
+  MixState<Rows> x14067{x14058.tot + x14056 * x14066.tot * mixPows[1]};
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14068 = x1 - x2846;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14069 = x2846 * x14068;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14070{x14067.tot + x14067.mul * x14069, x14067.mul * (*mix)};
+  MixState<Rows> x14070{x14067.tot + mixPows[5] * x14069};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14071 = x2651 - x2663;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14072{x2326.tot + x2326.mul * x14071, x2326.mul * (*mix)};
+  MixState<Rows> x14072{x2326.tot + mixPows[0] * x14071};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14073 = x2653 - x2666;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14074{x14072.tot + x14072.mul * x14073, x14072.mul * (*mix)};
+  MixState<Rows> x14074{x14072.tot + mixPows[1] * x14073};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14075 = x2655 - x2669;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14076{x14074.tot + x14074.mul * x14075, x14074.mul * (*mix)};
+  MixState<Rows> x14076{x14074.tot + mixPows[2] * x14075};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14077 = x2657 - x2910;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14078{x14076.tot + x14076.mul * x14077, x14076.mul * (*mix)};
+  MixState<Rows> x14078{x14076.tot + mixPows[3] * x14077};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14079{x14070.tot + x14068 * x14078.tot * x14070.mul, x14070.mul * x14078.mul};
+  MixState<Rows> x14079{x14070.tot + x14068 * x14078.tot * mixPows[6]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14080 = x14016 - x2660;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28198,29 +28215,29 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14082 = x14080 * x14081;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14083{x14079.tot + x14079.mul * x14082, x14079.mul * (*mix)};
+  MixState<Rows> x14083{x14079.tot + mixPows[10] * x14082};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14084 = x2663 - x14021;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14085{x2326.tot + x2326.mul * x14084, x2326.mul * (*mix)};
+  MixState<Rows> x14085{x2326.tot + mixPows[0] * x14084};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14086 = x2666 - x14024;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14087{x14085.tot + x14085.mul * x14086, x14085.mul * (*mix)};
+  MixState<Rows> x14087{x14085.tot + mixPows[1] * x14086};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14088 = x2669 - x14027;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14089{x14087.tot + x14087.mul * x14088, x14087.mul * (*mix)};
+  MixState<Rows> x14089{x14087.tot + mixPows[2] * x14088};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14090 = x2910 - x14030;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14091{x14089.tot + x14089.mul * x14090, x14089.mul * (*mix)};
+  MixState<Rows> x14091{x14089.tot + mixPows[3] * x14090};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14092{x14083.tot + x14081 * x14091.tot * x14083.mul, x14083.mul * x14091.mul};
+  MixState<Rows> x14092{x14083.tot + x14081 * x14091.tot * mixPows[11]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14093{x14054.tot + x2362 * x14092.tot * x14054.mul, x14054.mul * x14092.mul};
+  MixState<Rows> x14093{x14054.tot + x2362 * x14092.tot * mixPows[10]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14094{x14093.tot + x2602 * x14092.tot * x14093.mul, x14093.mul * x14092.mul};
+  MixState<Rows> x14094{x14093.tot + x2602 * x14092.tot * mixPows[25]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14095 = x2639 - x13907;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28228,25 +28245,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14097 = x14095 * x14096;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14098{x2326.tot + x2326.mul * x14097, x2326.mul * (*mix)};
+  MixState<Rows> x14098{x2326.tot + mixPows[0] * x14097};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14099 = x13912 - x2641;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14100{x2326.tot + x2326.mul * x14099, x2326.mul * (*mix)};
+  MixState<Rows> x14100{x2326.tot + mixPows[0] * x14099};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14101 = x13915 - x2643;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14102{x14100.tot + x14100.mul * x14101, x14100.mul * (*mix)};
+  MixState<Rows> x14102{x14100.tot + mixPows[1] * x14101};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14103 = x13918 - x2645;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14104{x14102.tot + x14102.mul * x14103, x14102.mul * (*mix)};
+  MixState<Rows> x14104{x14102.tot + mixPows[2] * x14103};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14105 = x13921 - x2647;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14106{x14104.tot + x14104.mul * x14105, x14104.mul * (*mix)};
+  MixState<Rows> x14106{x14104.tot + mixPows[3] * x14105};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14107{x14098.tot + x14096 * x14106.tot * x14098.mul, x14098.mul * x14106.mul};
+  MixState<Rows> x14107{x14098.tot + x14096 * x14106.tot * mixPows[1]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14108 = x14016 - x2639;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28254,33 +28271,33 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14110 = x14108 * x14109;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14111{x14107.tot + x14107.mul * x14110, x14107.mul * (*mix)};
+  MixState<Rows> x14111{x14107.tot + mixPows[5] * x14110};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14112 = x2641 - x14021;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14113{x2326.tot + x2326.mul * x14112, x2326.mul * (*mix)};
+  MixState<Rows> x14113{x2326.tot + mixPows[0] * x14112};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14114 = x2643 - x14024;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14115{x14113.tot + x14113.mul * x14114, x14113.mul * (*mix)};
+  MixState<Rows> x14115{x14113.tot + mixPows[1] * x14114};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14116 = x2645 - x14027;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14117{x14115.tot + x14115.mul * x14116, x14115.mul * (*mix)};
+  MixState<Rows> x14117{x14115.tot + mixPows[2] * x14116};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14118 = x2647 - x14030;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14119{x14117.tot + x14117.mul * x14118, x14117.mul * (*mix)};
+  MixState<Rows> x14119{x14117.tot + mixPows[3] * x14118};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14120{x14111.tot + x14109 * x14119.tot * x14111.mul, x14111.mul * x14119.mul};
+  MixState<Rows> x14120{x14111.tot + x14109 * x14119.tot * mixPows[6]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14121{x14094.tot + x2633 * x14120.tot * x14094.mul, x14094.mul * x14120.mul};
+  MixState<Rows> x14121{x14094.tot + x2633 * x14120.tot * mixPows[40]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14122{x14121.tot + x2634 * x14120.tot * x14121.mul, x14121.mul * x14120.mul};
+  MixState<Rows> x14122{x14121.tot + x2634 * x14120.tot * mixPows[50]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14123{x14122.tot + x2635 * x14120.tot * x14122.mul, x14122.mul * x14120.mul};
+  MixState<Rows> x14123{x14122.tot + x2635 * x14120.tot * mixPows[60]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14124{x14123.tot + x2875 * x14120.tot * x14123.mul, x14123.mul * x14120.mul};
+  MixState<Rows> x14124{x14123.tot + x2875 * x14120.tot * mixPows[70]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14125 = x2910 - x13907;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28288,25 +28305,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14127 = x14125 * x14126;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14128{x2326.tot + x2326.mul * x14127, x2326.mul * (*mix)};
+  MixState<Rows> x14128{x2326.tot + mixPows[0] * x14127};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14129 = x13912 - x2912;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14130{x2326.tot + x2326.mul * x14129, x2326.mul * (*mix)};
+  MixState<Rows> x14130{x2326.tot + mixPows[0] * x14129};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14131 = x13915 - x2914;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14132{x14130.tot + x14130.mul * x14131, x14130.mul * (*mix)};
+  MixState<Rows> x14132{x14130.tot + mixPows[1] * x14131};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14133 = x13918 - x2916;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14134{x14132.tot + x14132.mul * x14133, x14132.mul * (*mix)};
+  MixState<Rows> x14134{x14132.tot + mixPows[2] * x14133};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14135 = x13921 - x2918;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14136{x14134.tot + x14134.mul * x14135, x14134.mul * (*mix)};
+  MixState<Rows> x14136{x14134.tot + mixPows[3] * x14135};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14137{x14128.tot + x14126 * x14136.tot * x14128.mul, x14128.mul * x14136.mul};
+  MixState<Rows> x14137{x14128.tot + x14126 * x14136.tot * mixPows[1]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14138 = x2920 - x2910;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28314,17 +28331,17 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14140 = x14138 * x14139;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14141{x14137.tot + x14137.mul * x14140, x14137.mul * (*mix)};
+  MixState<Rows> x14141{x14137.tot + mixPows[5] * x14140};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14142{x2326.tot + x2326.mul * x2963, x2326.mul * (*mix)};
+  MixState<Rows> x14142{x2326.tot + mixPows[0] * x2963};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14143{x14142.tot + x14142.mul * x2964, x14142.mul * (*mix)};
+  MixState<Rows> x14143{x14142.tot + mixPows[1] * x2964};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14144{x14143.tot + x14143.mul * x2965, x14143.mul * (*mix)};
+  MixState<Rows> x14144{x14143.tot + mixPows[2] * x2965};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14145{x14144.tot + x14144.mul * x2966, x14144.mul * (*mix)};
+  MixState<Rows> x14145{x14144.tot + mixPows[3] * x2966};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14146{x14141.tot + x14139 * x14145.tot * x14141.mul, x14141.mul * x14145.mul};
+  MixState<Rows> x14146{x14141.tot + x14139 * x14145.tot * mixPows[6]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14147 = x2930 - x2920;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28332,25 +28349,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14149 = x14147 * x14148;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14150{x14146.tot + x14146.mul * x14149, x14146.mul * (*mix)};
+  MixState<Rows> x14150{x14146.tot + mixPows[10] * x14149};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14151 = x2922 - x2933;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14152{x2326.tot + x2326.mul * x14151, x2326.mul * (*mix)};
+  MixState<Rows> x14152{x2326.tot + mixPows[0] * x14151};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14153 = x2924 - x2936;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14154{x14152.tot + x14152.mul * x14153, x14152.mul * (*mix)};
+  MixState<Rows> x14154{x14152.tot + mixPows[1] * x14153};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14155 = x2926 - x2939;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14156{x14154.tot + x14154.mul * x14155, x14154.mul * (*mix)};
+  MixState<Rows> x14156{x14154.tot + mixPows[2] * x14155};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14157 = x2928 - x2942;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14158{x14156.tot + x14156.mul * x14157, x14156.mul * (*mix)};
+  MixState<Rows> x14158{x14156.tot + mixPows[3] * x14157};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14159{x14150.tot + x14148 * x14158.tot * x14150.mul, x14150.mul * x14158.mul};
+  MixState<Rows> x14159{x14150.tot + x14148 * x14158.tot * mixPows[11]};
   // loc("zirgen/circuit/recursion/wom.cpp":60:0)
   auto x14160 = x14016 - x2930;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
@@ -28358,69 +28375,69 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
   auto x14162 = x14160 * x14161;
   // loc("zirgen/circuit/recursion/wom.cpp":62:0)
-  MixState x14163{x14159.tot + x14159.mul * x14162, x14159.mul * (*mix)};
+  MixState<Rows> x14163{x14159.tot + mixPows[15] * x14162};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14164 = x2933 - x14021;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14165{x2326.tot + x2326.mul * x14164, x2326.mul * (*mix)};
+  MixState<Rows> x14165{x2326.tot + mixPows[0] * x14164};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14166 = x2936 - x14024;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14167{x14165.tot + x14165.mul * x14166, x14165.mul * (*mix)};
+  MixState<Rows> x14167{x14165.tot + mixPows[1] * x14166};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14168 = x2939 - x14027;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14169{x14167.tot + x14167.mul * x14168, x14167.mul * (*mix)};
+  MixState<Rows> x14169{x14167.tot + mixPows[2] * x14168};
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
   auto x14170 = x2942 - x14030;
   // loc("zirgen/circuit/recursion/wom.cpp":66:0)
-  MixState x14171{x14169.tot + x14169.mul * x14170, x14169.mul * (*mix)};
+  MixState<Rows> x14171{x14169.tot + mixPows[3] * x14170};
   // loc("zirgen/circuit/recursion/wom.cpp":64:0)
-  MixState x14172{x14163.tot + x14161 * x14171.tot * x14163.mul, x14163.mul * x14171.mul};
+  MixState<Rows> x14172{x14163.tot + x14161 * x14171.tot * mixPows[16]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14173{x14124.tot + x2906 * x14172.tot * x14124.mul, x14124.mul * x14172.mul};
+  MixState<Rows> x14173{x14124.tot + x2906 * x14172.tot * mixPows[80]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14174{x14034.tot + x3148 * x14173.tot * x14034.mul, x14034.mul * x14173.mul};
+  MixState<Rows> x14174{x14034.tot + x3148 * x14173.tot * mixPows[804]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14175{x14174.tot + x6857 * x14033.tot * x14174.mul, x14174.mul * x14033.mul};
+  MixState<Rows> x14175{x14174.tot + x6857 * x14033.tot * mixPows[904]};
   // loc("zirgen/circuit/recursion/wom.cpp":29:0)
   auto x14176 = x14016 - x13907;
   // loc("zirgen/circuit/recursion/wom.cpp":29:0)
-  MixState x14177{x2326.tot + x2326.mul * x14176, x2326.mul * (*mix)};
+  MixState<Rows> x14177{x2326.tot + mixPows[0] * x14176};
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
   auto x14178 = x14021 - x13912;
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
-  MixState x14179{x14177.tot + x14177.mul * x14178, x14177.mul * (*mix)};
+  MixState<Rows> x14179{x14177.tot + mixPows[1] * x14178};
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
   auto x14180 = x14024 - x13915;
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
-  MixState x14181{x14179.tot + x14179.mul * x14180, x14179.mul * (*mix)};
+  MixState<Rows> x14181{x14179.tot + mixPows[2] * x14180};
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
   auto x14182 = x14027 - x13918;
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
-  MixState x14183{x14181.tot + x14181.mul * x14182, x14181.mul * (*mix)};
+  MixState<Rows> x14183{x14181.tot + mixPows[3] * x14182};
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
   auto x14184 = x14030 - x13921;
   // loc("zirgen/circuit/recursion/wom.cpp":31:0)
-  MixState x14185{x14183.tot + x14183.mul * x14184, x14183.mul * (*mix)};
+  MixState<Rows> x14185{x14183.tot + mixPows[4] * x14184};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14186{x14175.tot + x7079 * x14185.tot * x14175.mul, x14175.mul * x14185.mul};
+  MixState<Rows> x14186{x14175.tot + x7079 * x14185.tot * mixPows[949]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14187{x14186.tot + x10031 * x14185.tot * x14186.mul, x14186.mul * x14185.mul};
+  MixState<Rows> x14187{x14186.tot + x10031 * x14185.tot * mixPows[954]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14188{x14187.tot + x13726 * x14033.tot * x14187.mul, x14187.mul * x14033.mul};
+  MixState<Rows> x14188{x14187.tot + x13726 * x14033.tot * mixPows[959]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14189{x14188.tot + x2327 * x2326.tot * x14188.mul, x14188.mul * x2326.mul};
+  MixState<Rows> x14189{x14188.tot + x2327 * x2326.tot * mixPows[1004]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14190{x14189.tot + x3148 * x13903.tot * x14189.mul, x14189.mul * x13903.mul};
+  MixState<Rows> x14190{x14189.tot + x3148 * x13903.tot * mixPows[1004]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14191{x14190.tot + x6857 * x2326.tot * x14190.mul, x14190.mul * x2326.mul};
+  MixState<Rows> x14191{x14190.tot + x6857 * x2326.tot * mixPows[1004]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14192{x14191.tot + x7079 * x2326.tot * x14191.mul, x14191.mul * x2326.mul};
+  MixState<Rows> x14192{x14191.tot + x7079 * x2326.tot * mixPows[1004]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14193{x14192.tot + x10031 * x2326.tot * x14192.mul, x14192.mul * x2326.mul};
+  MixState<Rows> x14193{x14192.tot + x10031 * x2326.tot * mixPows[1004]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x14194{x14193.tot + x13726 * x2326.tot * x14193.mul, x14193.mul * x2326.mul};
+  MixState<Rows> x14194{x14193.tot + x13726 * x2326.tot * mixPows[1004]};
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
   auto x14195 = args[3][0];
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -30538,21 +30555,21 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":220:0)
   auto x15252 = x15251 + x15246;
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":283:0))
-  auto x15253 = args[4][0 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x15253 = Rows::load(args[4] + 0 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":283:0))
-  auto x15254 = args[4][1 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x15254 = Rows::load(args[4] + 1 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[2](Reg)"("./zirgen/components/plonk.h":283:0))
-  auto x15255 = args[4][2 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x15255 = Rows::load(args[4] + 2 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[3](Reg)"("./zirgen/components/plonk.h":283:0))
-  auto x15256 = args[4][3 * steps + ((cycle - kInvRate * 1) & mask)];
+  auto x15256 = Rows::load(args[4] + 3 * steps, (cycle - kInvRate * 1) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15257 = args[4][4 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15257 = Rows::load(args[4] + 4 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15258 = args[4][5 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15258 = Rows::load(args[4] + 5 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[2](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15259 = args[4][6 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15259 = Rows::load(args[4] + 6 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[3](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15260 = args[4][7 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15260 = Rows::load(args[4] + 7 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15261 = x15260 * x14891;
   // loc("./zirgen/components/plonk.h":286:0)
@@ -30680,27 +30697,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15323 = x15299 - x15268;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15324{x2326.tot + x2326.mul * x15323, x2326.mul * (*mix)};
+  MixState<Rows> x15324{x2326.tot + mixPows[0] * x15323};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15325 = x15307 - x15276;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15326{x15324.tot + x15324.mul * x15325, x15324.mul * (*mix)};
+  MixState<Rows> x15326{x15324.tot + mixPows[1] * x15325};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15327 = x15315 - x15284;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15328{x15326.tot + x15326.mul * x15327, x15326.mul * (*mix)};
+  MixState<Rows> x15328{x15326.tot + mixPows[2] * x15327};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15329 = x15322 - x15291;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15330{x15328.tot + x15328.mul * x15329, x15328.mul * (*mix)};
+  MixState<Rows> x15330{x15328.tot + mixPows[3] * x15329};
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15331 = args[4][8 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15331 = Rows::load(args[4] + 8 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15332 = args[4][9 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15332 = Rows::load(args[4] + 9 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[2](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15333 = args[4][10 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15333 = Rows::load(args[4] + 10 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/FpExtReg/elem[3](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15334 = args[4][11 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15334 = Rows::load(args[4] + 11 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15335 = x15334 * x15064;
   // loc("./zirgen/components/plonk.h":286:0)
@@ -30828,27 +30845,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15397 = x15373 - x15342;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15398{x15330.tot + x15330.mul * x15397, x15330.mul * (*mix)};
+  MixState<Rows> x15398{x15330.tot + mixPows[4] * x15397};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15399 = x15381 - x15350;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15400{x15398.tot + x15398.mul * x15399, x15398.mul * (*mix)};
+  MixState<Rows> x15400{x15398.tot + mixPows[5] * x15399};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15401 = x15389 - x15358;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15402{x15400.tot + x15400.mul * x15401, x15400.mul * (*mix)};
+  MixState<Rows> x15402{x15400.tot + mixPows[6] * x15401};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15403 = x15396 - x15365;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15404{x15402.tot + x15402.mul * x15403, x15402.mul * (*mix)};
+  MixState<Rows> x15404{x15402.tot + mixPows[7] * x15403};
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15405 = args[4][0 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15405 = Rows::load(args[4] + 0 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15406 = args[4][1 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15406 = Rows::load(args[4] + 1 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[2](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15407 = args[4][2 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15407 = Rows::load(args[4] + 2 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[3](Reg)"("./zirgen/components/plonk.h":285:0))
-  auto x15408 = args[4][3 * steps + ((cycle - kInvRate * 0) & mask)];
+  auto x15408 = Rows::load(args[4] + 3 * steps, (cycle - kInvRate * 0) & mask, mask);
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15409 = x15408 * x15237;
   // loc("./zirgen/components/plonk.h":286:0)
@@ -30976,45 +30993,45 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15471 = x15447 - x15416;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15472{x15404.tot + x15404.mul * x15471, x15404.mul * (*mix)};
+  MixState<Rows> x15472{x15404.tot + mixPows[8] * x15471};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15473 = x15455 - x15424;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15474{x15472.tot + x15472.mul * x15473, x15472.mul * (*mix)};
+  MixState<Rows> x15474{x15472.tot + mixPows[9] * x15473};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15475 = x15463 - x15432;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15476{x15474.tot + x15474.mul * x15475, x15474.mul * (*mix)};
+  MixState<Rows> x15476{x15474.tot + mixPows[10] * x15475};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15477 = x15470 - x15439;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15478{x15476.tot + x15476.mul * x15477, x15476.mul * (*mix)};
+  MixState<Rows> x15478{x15476.tot + mixPows[11] * x15477};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15479{x14194.tot + x2327 * x15478.tot * x14194.mul, x14194.mul * x15478.mul};
+  MixState<Rows> x15479{x14194.tot + x2327 * x15478.tot * mixPows[1004]};
   // loc("zirgen/components/fpext.cpp":28:0)
   auto x15480 = x15405 - x1;
   // loc("zirgen/components/fpext.cpp":28:0)
-  MixState x15481{x2326.tot + x2326.mul * x15480, x2326.mul * (*mix)};
+  MixState<Rows> x15481{x2326.tot + mixPows[0] * x15480};
   // loc("zirgen/components/fpext.cpp":28:0)
-  MixState x15482{x15481.tot + x15481.mul * x15406, x15481.mul * (*mix)};
+  MixState<Rows> x15482{x15481.tot + mixPows[1] * x15406};
   // loc("zirgen/components/fpext.cpp":28:0)
-  MixState x15483{x15482.tot + x15482.mul * x15407, x15482.mul * (*mix)};
+  MixState<Rows> x15483{x15482.tot + mixPows[2] * x15407};
   // loc("zirgen/components/fpext.cpp":28:0)
-  MixState x15484{x15483.tot + x15483.mul * x15408, x15483.mul * (*mix)};
+  MixState<Rows> x15484{x15483.tot + mixPows[3] * x15408};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15485{x2326.tot + x2360 * x15484.tot * x2326.mul, x2326.mul * x15484.mul};
+  MixState<Rows> x15485{x2326.tot + x2360 * x15484.tot * mixPows[0]};
   // loc("./zirgen/components/plonk.h":122:0)
   auto x15486 = x15253 - x1;
   // loc("./zirgen/components/plonk.h":122:0)
-  MixState x15487{x2326.tot + x2326.mul * x15486, x2326.mul * (*mix)};
+  MixState<Rows> x15487{x2326.tot + mixPows[0] * x15486};
   // loc("./zirgen/components/plonk.h":122:0)
-  MixState x15488{x15487.tot + x15487.mul * x15254, x15487.mul * (*mix)};
+  MixState<Rows> x15488{x15487.tot + mixPows[1] * x15254};
   // loc("./zirgen/components/plonk.h":122:0)
-  MixState x15489{x15488.tot + x15488.mul * x15255, x15488.mul * (*mix)};
+  MixState<Rows> x15489{x15488.tot + mixPows[2] * x15255};
   // loc("./zirgen/components/plonk.h":122:0)
-  MixState x15490{x15489.tot + x15489.mul * x15256, x15489.mul * (*mix)};
+  MixState<Rows> x15490{x15489.tot + mixPows[3] * x15256};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15491{x15485.tot + x2361 * x15490.tot * x15485.mul, x15485.mul * x15490.mul};
+  MixState<Rows> x15491{x15485.tot + x2361 * x15490.tot * mixPows[4]};
   // loc("./zirgen/components/plonk.h":218:0)
   auto x15492 = x14195 * x2376;
   // loc("./zirgen/components/plonk.h":218:0)
@@ -31636,19 +31653,19 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15801 = x15777 - x15746;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15802{x2326.tot + x2326.mul * x15801, x2326.mul * (*mix)};
+  MixState<Rows> x15802{x2326.tot + mixPows[0] * x15801};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15803 = x15785 - x15754;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15804{x15802.tot + x15802.mul * x15803, x15802.mul * (*mix)};
+  MixState<Rows> x15804{x15802.tot + mixPows[1] * x15803};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15805 = x15793 - x15762;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15806{x15804.tot + x15804.mul * x15805, x15804.mul * (*mix)};
+  MixState<Rows> x15806{x15804.tot + mixPows[2] * x15805};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15807 = x15800 - x15769;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15808{x15806.tot + x15806.mul * x15807, x15806.mul * (*mix)};
+  MixState<Rows> x15808{x15806.tot + mixPows[3] * x15807};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15809 = x15408 * x15219;
   // loc("./zirgen/components/plonk.h":286:0)
@@ -31776,23 +31793,23 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15871 = x15847 - x15816;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15872{x15808.tot + x15808.mul * x15871, x15808.mul * (*mix)};
+  MixState<Rows> x15872{x15808.tot + mixPows[4] * x15871};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15873 = x15855 - x15824;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15874{x15872.tot + x15872.mul * x15873, x15872.mul * (*mix)};
+  MixState<Rows> x15874{x15872.tot + mixPows[5] * x15873};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15875 = x15863 - x15832;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15876{x15874.tot + x15874.mul * x15875, x15874.mul * (*mix)};
+  MixState<Rows> x15876{x15874.tot + mixPows[6] * x15875};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15877 = x15870 - x15839;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15878{x15876.tot + x15876.mul * x15877, x15876.mul * (*mix)};
+  MixState<Rows> x15878{x15876.tot + mixPows[7] * x15877};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15879{x15491.tot + x2362 * x15878.tot * x15491.mul, x15491.mul * x15878.mul};
+  MixState<Rows> x15879{x15491.tot + x2362 * x15878.tot * mixPows[8]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15880{x15879.tot + x2602 * x15878.tot * x15879.mul, x15879.mul * x15878.mul};
+  MixState<Rows> x15880{x15879.tot + x2602 * x15878.tot * mixPows[16]};
   // loc("./zirgen/components/plonk.h":220:0)
   auto x15881 = x15633 * x15219;
   // loc("./zirgen/components/plonk.h":220:0)
@@ -31920,27 +31937,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15943 = x15777 - x15919;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15944{x2326.tot + x2326.mul * x15943, x2326.mul * (*mix)};
+  MixState<Rows> x15944{x2326.tot + mixPows[0] * x15943};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15945 = x15785 - x15927;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15946{x15944.tot + x15944.mul * x15945, x15944.mul * (*mix)};
+  MixState<Rows> x15946{x15944.tot + mixPows[1] * x15945};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15947 = x15793 - x15935;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15948{x15946.tot + x15946.mul * x15947, x15946.mul * (*mix)};
+  MixState<Rows> x15948{x15946.tot + mixPows[2] * x15947};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x15949 = x15800 - x15942;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x15950{x15948.tot + x15948.mul * x15949, x15948.mul * (*mix)};
+  MixState<Rows> x15950{x15948.tot + mixPows[3] * x15949};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15951{x15880.tot + x2633 * x15950.tot * x15880.mul, x15880.mul * x15950.mul};
+  MixState<Rows> x15951{x15880.tot + x2633 * x15950.tot * mixPows[24]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15952{x15951.tot + x2634 * x15950.tot * x15951.mul, x15951.mul * x15950.mul};
+  MixState<Rows> x15952{x15951.tot + x2634 * x15950.tot * mixPows[28]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15953{x15952.tot + x2635 * x15950.tot * x15952.mul, x15952.mul * x15950.mul};
+  MixState<Rows> x15953{x15952.tot + x2635 * x15950.tot * mixPows[32]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x15954{x15953.tot + x2875 * x15950.tot * x15953.mul, x15953.mul * x15950.mul};
+  MixState<Rows> x15954{x15953.tot + x2875 * x15950.tot * mixPows[36]};
   // loc("./zirgen/components/plonk.h":220:0)
   auto x15955 = x14356 * x14422;
   // loc("./zirgen/components/plonk.h":220:0)
@@ -32254,19 +32271,19 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16110 = x16086 - x16055;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16111{x2326.tot + x2326.mul * x16110, x2326.mul * (*mix)};
+  MixState<Rows> x16111{x2326.tot + mixPows[0] * x16110};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16112 = x16094 - x16063;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16113{x16111.tot + x16111.mul * x16112, x16111.mul * (*mix)};
+  MixState<Rows> x16113{x16111.tot + mixPows[1] * x16112};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16114 = x16102 - x16071;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16115{x16113.tot + x16113.mul * x16114, x16113.mul * (*mix)};
+  MixState<Rows> x16115{x16113.tot + mixPows[2] * x16114};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16116 = x16109 - x16078;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16117{x16115.tot + x16115.mul * x16116, x16115.mul * (*mix)};
+  MixState<Rows> x16117{x16115.tot + mixPows[3] * x16116};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16118 = x15408 * x16032;
   // loc("./zirgen/components/plonk.h":286:0)
@@ -32394,57 +32411,57 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16180 = x16156 - x16125;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16181{x16117.tot + x16117.mul * x16180, x16117.mul * (*mix)};
+  MixState<Rows> x16181{x16117.tot + mixPows[4] * x16180};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16182 = x16164 - x16133;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16183{x16181.tot + x16181.mul * x16182, x16181.mul * (*mix)};
+  MixState<Rows> x16183{x16181.tot + mixPows[5] * x16182};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16184 = x16172 - x16141;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16185{x16183.tot + x16183.mul * x16184, x16183.mul * (*mix)};
+  MixState<Rows> x16185{x16183.tot + mixPows[6] * x16184};
   // loc("./zirgen/components/plonk.h":286:0)
   auto x16186 = x16179 - x16148;
   // loc("./zirgen/components/plonk.h":286:0)
-  MixState x16187{x16185.tot + x16185.mul * x16186, x16185.mul * (*mix)};
+  MixState<Rows> x16187{x16185.tot + mixPows[7] * x16186};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16188{x15954.tot + x2906 * x16187.tot * x15954.mul, x15954.mul * x16187.mul};
+  MixState<Rows> x16188{x15954.tot + x2906 * x16187.tot * mixPows[40]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16189{x15479.tot + x3148 * x16188.tot * x15479.mul, x15479.mul * x16188.mul};
+  MixState<Rows> x16189{x15479.tot + x3148 * x16188.tot * mixPows[1016]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16190{x16189.tot + x6857 * x15478.tot * x16189.mul, x16189.mul * x15478.mul};
+  MixState<Rows> x16190{x16189.tot + x6857 * x15478.tot * mixPows[1064]};
   // loc("./zirgen/components/plonk.h":101:0)
   auto x16191 = x15405 - x15253;
   // loc("./zirgen/components/plonk.h":101:0)
-  MixState x16192{x2326.tot + x2326.mul * x16191, x2326.mul * (*mix)};
+  MixState<Rows> x16192{x2326.tot + mixPows[0] * x16191};
   // loc("./zirgen/components/plonk.h":101:0)
   auto x16193 = x15406 - x15254;
   // loc("./zirgen/components/plonk.h":101:0)
-  MixState x16194{x16192.tot + x16192.mul * x16193, x16192.mul * (*mix)};
+  MixState<Rows> x16194{x16192.tot + mixPows[1] * x16193};
   // loc("./zirgen/components/plonk.h":101:0)
   auto x16195 = x15407 - x15255;
   // loc("./zirgen/components/plonk.h":101:0)
-  MixState x16196{x16194.tot + x16194.mul * x16195, x16194.mul * (*mix)};
+  MixState<Rows> x16196{x16194.tot + mixPows[2] * x16195};
   // loc("./zirgen/components/plonk.h":101:0)
   auto x16197 = x15408 - x15256;
   // loc("./zirgen/components/plonk.h":101:0)
-  MixState x16198{x16196.tot + x16196.mul * x16197, x16196.mul * (*mix)};
+  MixState<Rows> x16198{x16196.tot + mixPows[3] * x16197};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16199{x16190.tot + x7079 * x16198.tot * x16190.mul, x16190.mul * x16198.mul};
+  MixState<Rows> x16199{x16190.tot + x7079 * x16198.tot * mixPows[1076]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16200{x16199.tot + x10031 * x16198.tot * x16199.mul, x16199.mul * x16198.mul};
+  MixState<Rows> x16200{x16199.tot + x10031 * x16198.tot * mixPows[1080]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16201{x16200.tot + x13726 * x15478.tot * x16200.mul, x16200.mul * x15478.mul};
+  MixState<Rows> x16201{x16200.tot + x13726 * x15478.tot * mixPows[1084]};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16202 = x2362 * x2582;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16203{x2326.tot + x2326.mul * x16202, x2326.mul * (*mix)};
+  MixState<Rows> x16203{x2326.tot + mixPows[0] * x16202};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16204 = x1 - x2602;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16205 = x2602 * x16204;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16206{x16203.tot + x16203.mul * x16205, x16203.mul * (*mix)};
+  MixState<Rows> x16206{x16203.tot + mixPows[1] * x16205};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16207 = x2362 + x2602;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32452,29 +32469,29 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16209 = x2633 * x16208;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16210{x16206.tot + x16206.mul * x16209, x16206.mul * (*mix)};
+  MixState<Rows> x16210{x16206.tot + mixPows[2] * x16209};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16211 = x16207 + x2633;
   // loc("./zirgen/components/onehot.h":31:0)
   auto x16212 = x16211 - x1;
   // loc("./zirgen/components/onehot.h":31:0)
-  MixState x16213{x16210.tot + x16210.mul * x16212, x16210.mul * (*mix)};
+  MixState<Rows> x16213{x16210.tot + mixPows[3] * x16212};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16214{x16201.tot + x6857 * x16213.tot * x16201.mul, x16201.mul * x16213.mul};
+  MixState<Rows> x16214{x16201.tot + x6857 * x16213.tot * mixPows[1096]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16215{x16214.tot + x13726 * x16213.tot * x16214.mul, x16214.mul * x16213.mul};
+  MixState<Rows> x16215{x16214.tot + x13726 * x16213.tot * mixPows[1100]};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16216 = x1 - x2363;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16217 = x2363 * x16216;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16218{x2326.tot + x2326.mul * x16217, x2326.mul * (*mix)};
+  MixState<Rows> x16218{x2326.tot + mixPows[0] * x16217};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16219 = x1 - x2330;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16220 = x2330 * x16219;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16221{x16218.tot + x16218.mul * x16220, x16218.mul * (*mix)};
+  MixState<Rows> x16221{x16218.tot + mixPows[1] * x16220};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16222 = x2363 + x2330;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32482,7 +32499,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16224 = x2331 * x16223;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16225{x16221.tot + x16221.mul * x16224, x16221.mul * (*mix)};
+  MixState<Rows> x16225{x16221.tot + mixPows[2] * x16224};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16226 = x16222 + x2331;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32490,7 +32507,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16228 = x2334 * x16227;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16229{x16225.tot + x16225.mul * x16228, x16225.mul * (*mix)};
+  MixState<Rows> x16229{x16225.tot + mixPows[3] * x16228};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16230 = x16226 + x2334;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32498,7 +32515,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16232 = x2337 * x16231;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16233{x16229.tot + x16229.mul * x16232, x16229.mul * (*mix)};
+  MixState<Rows> x16233{x16229.tot + mixPows[4] * x16232};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16234 = x16230 + x2337;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32506,7 +32523,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16236 = x2340 * x16235;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16237{x16233.tot + x16233.mul * x16236, x16233.mul * (*mix)};
+  MixState<Rows> x16237{x16233.tot + mixPows[5] * x16236};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16238 = x16234 + x2340;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32514,7 +32531,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16240 = x2343 * x16239;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16241{x16237.tot + x16237.mul * x16240, x16237.mul * (*mix)};
+  MixState<Rows> x16241{x16237.tot + mixPows[6] * x16240};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16242 = x16238 + x2343;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32522,7 +32539,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16244 = x2346 * x16243;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16245{x16241.tot + x16241.mul * x16244, x16241.mul * (*mix)};
+  MixState<Rows> x16245{x16241.tot + mixPows[7] * x16244};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16246 = x16242 + x2346;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32530,7 +32547,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16248 = x2349 * x16247;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16249{x16245.tot + x16245.mul * x16248, x16245.mul * (*mix)};
+  MixState<Rows> x16249{x16245.tot + mixPows[8] * x16248};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16250 = x16246 + x2349;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32538,7 +32555,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16252 = x2352 * x16251;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16253{x16249.tot + x16249.mul * x16252, x16249.mul * (*mix)};
+  MixState<Rows> x16253{x16249.tot + mixPows[9] * x16252};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16254 = x16250 + x2352;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32546,25 +32563,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16256 = x2355 * x16255;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16257{x16253.tot + x16253.mul * x16256, x16253.mul * (*mix)};
+  MixState<Rows> x16257{x16253.tot + mixPows[10] * x16256};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16258 = x16254 + x2355;
   // loc("./zirgen/components/onehot.h":31:0)
   auto x16259 = x16258 - x1;
   // loc("./zirgen/components/onehot.h":31:0)
-  MixState x16260{x16257.tot + x16257.mul * x16259, x16257.mul * (*mix)};
+  MixState<Rows> x16260{x16257.tot + mixPows[11] * x16259};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16261 = x1 - x2636;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16262 = x2636 * x16261;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16263{x16260.tot + x16260.mul * x16262, x16260.mul * (*mix)};
+  MixState<Rows> x16263{x16260.tot + mixPows[12] * x16262};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16264 = x1 - x2603;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16265 = x2603 * x16264;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16266{x16263.tot + x16263.mul * x16265, x16263.mul * (*mix)};
+  MixState<Rows> x16266{x16263.tot + mixPows[13] * x16265};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16267 = x2636 + x2603;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32572,7 +32589,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16269 = x2604 * x16268;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16270{x16266.tot + x16266.mul * x16269, x16266.mul * (*mix)};
+  MixState<Rows> x16270{x16266.tot + mixPows[14] * x16269};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16271 = x16267 + x2604;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32580,7 +32597,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16273 = x2607 * x16272;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16274{x16270.tot + x16270.mul * x16273, x16270.mul * (*mix)};
+  MixState<Rows> x16274{x16270.tot + mixPows[15] * x16273};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16275 = x16271 + x2607;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32588,7 +32605,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16277 = x2610 * x16276;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16278{x16274.tot + x16274.mul * x16277, x16274.mul * (*mix)};
+  MixState<Rows> x16278{x16274.tot + mixPows[16] * x16277};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16279 = x16275 + x2610;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32596,7 +32613,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16281 = x2613 * x16280;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16282{x16278.tot + x16278.mul * x16281, x16278.mul * (*mix)};
+  MixState<Rows> x16282{x16278.tot + mixPows[17] * x16281};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16283 = x16279 + x2613;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32604,7 +32621,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16285 = x2616 * x16284;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16286{x16282.tot + x16282.mul * x16285, x16282.mul * (*mix)};
+  MixState<Rows> x16286{x16282.tot + mixPows[18] * x16285};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16287 = x16283 + x2616;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32612,7 +32629,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16289 = x2619 * x16288;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16290{x16286.tot + x16286.mul * x16289, x16286.mul * (*mix)};
+  MixState<Rows> x16290{x16286.tot + mixPows[19] * x16289};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16291 = x16287 + x2619;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32620,7 +32637,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16293 = x2622 * x16292;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16294{x16290.tot + x16290.mul * x16293, x16290.mul * (*mix)};
+  MixState<Rows> x16294{x16290.tot + mixPows[20] * x16293};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16295 = x16291 + x2622;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32628,7 +32645,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16297 = x2625 * x16296;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16298{x16294.tot + x16294.mul * x16297, x16294.mul * (*mix)};
+  MixState<Rows> x16298{x16294.tot + mixPows[21] * x16297};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16299 = x16295 + x2625;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32636,25 +32653,25 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16301 = x2628 * x16300;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16302{x16298.tot + x16298.mul * x16301, x16298.mul * (*mix)};
+  MixState<Rows> x16302{x16298.tot + mixPows[22] * x16301};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16303 = x16299 + x2628;
   // loc("./zirgen/components/onehot.h":31:0)
   auto x16304 = x16303 - x1;
   // loc("./zirgen/components/onehot.h":31:0)
-  MixState x16305{x16302.tot + x16302.mul * x16304, x16302.mul * (*mix)};
+  MixState<Rows> x16305{x16302.tot + mixPows[23] * x16304};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16306 = x1 - x2909;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16307 = x2909 * x16306;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16308{x16305.tot + x16305.mul * x16307, x16305.mul * (*mix)};
+  MixState<Rows> x16308{x16305.tot + mixPows[24] * x16307};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16309 = x1 - x2876;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16310 = x2876 * x16309;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16311{x16308.tot + x16308.mul * x16310, x16308.mul * (*mix)};
+  MixState<Rows> x16311{x16308.tot + mixPows[25] * x16310};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16312 = x2909 + x2876;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32662,7 +32679,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16314 = x2877 * x16313;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16315{x16311.tot + x16311.mul * x16314, x16311.mul * (*mix)};
+  MixState<Rows> x16315{x16311.tot + mixPows[26] * x16314};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16316 = x16312 + x2877;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32670,7 +32687,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16318 = x2880 * x16317;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16319{x16315.tot + x16315.mul * x16318, x16315.mul * (*mix)};
+  MixState<Rows> x16319{x16315.tot + mixPows[27] * x16318};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16320 = x16316 + x2880;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32678,7 +32695,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16322 = x2883 * x16321;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16323{x16319.tot + x16319.mul * x16322, x16319.mul * (*mix)};
+  MixState<Rows> x16323{x16319.tot + mixPows[28] * x16322};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16324 = x16320 + x2883;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32686,7 +32703,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16326 = x2886 * x16325;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16327{x16323.tot + x16323.mul * x16326, x16323.mul * (*mix)};
+  MixState<Rows> x16327{x16323.tot + mixPows[29] * x16326};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16328 = x16324 + x2886;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32694,7 +32711,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16330 = x2889 * x16329;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16331{x16327.tot + x16327.mul * x16330, x16327.mul * (*mix)};
+  MixState<Rows> x16331{x16327.tot + mixPows[30] * x16330};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16332 = x16328 + x2889;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32702,7 +32719,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16334 = x2892 * x16333;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16335{x16331.tot + x16331.mul * x16334, x16331.mul * (*mix)};
+  MixState<Rows> x16335{x16331.tot + mixPows[31] * x16334};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16336 = x16332 + x2892;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32710,7 +32727,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16338 = x2895 * x16337;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16339{x16335.tot + x16335.mul * x16338, x16335.mul * (*mix)};
+  MixState<Rows> x16339{x16335.tot + mixPows[32] * x16338};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16340 = x16336 + x2895;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32718,7 +32735,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16342 = x2898 * x16341;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16343{x16339.tot + x16339.mul * x16342, x16339.mul * (*mix)};
+  MixState<Rows> x16343{x16339.tot + mixPows[33] * x16342};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16344 = x16340 + x2898;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -32726,15 +32743,15 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16346 = x2901 * x16345;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16347{x16343.tot + x16343.mul * x16346, x16343.mul * (*mix)};
+  MixState<Rows> x16347{x16343.tot + mixPows[34] * x16346};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16348 = x16344 + x2901;
   // loc("./zirgen/components/onehot.h":31:0)
   auto x16349 = x16348 - x1;
   // loc("./zirgen/components/onehot.h":31:0)
-  MixState x16350{x16347.tot + x16347.mul * x16349, x16347.mul * (*mix)};
+  MixState<Rows> x16350{x16347.tot + mixPows[35] * x16349};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16351{x16215.tot + x2327 * x16350.tot * x16215.mul, x16215.mul * x16350.mul};
+  MixState<Rows> x16351{x16215.tot + x2327 * x16350.tot * mixPows[1104]};
   // loc("./zirgen/components/bits.h":55:0)
   auto x16352 = x3 - x2364;
   // loc("./zirgen/components/bits.h":55:0)
@@ -32748,7 +32765,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/bits.h":55:0)
   auto x16357 = x16356 * x16352;
   // loc("./zirgen/components/bits.h":55:0)
-  MixState x16358{x2326.tot + x2326.mul * x16357, x2326.mul * (*mix)};
+  MixState<Rows> x16358{x2326.tot + mixPows[0] * x16357};
   // loc("./zirgen/components/bits.h":55:0)
   auto x16359 = x3 - x2366;
   // loc("./zirgen/components/bits.h":55:0)
@@ -32762,7 +32779,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/bits.h":55:0)
   auto x16364 = x16363 * x16359;
   // loc("./zirgen/components/bits.h":55:0)
-  MixState x16365{x16358.tot + x16358.mul * x16364, x16358.mul * (*mix)};
+  MixState<Rows> x16365{x16358.tot + mixPows[1] * x16364};
   // loc("./zirgen/components/bits.h":55:0)
   auto x16366 = x3 - x2368;
   // loc("./zirgen/components/bits.h":55:0)
@@ -32776,7 +32793,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/bits.h":55:0)
   auto x16371 = x16370 * x16366;
   // loc("./zirgen/components/bits.h":55:0)
-  MixState x16372{x16365.tot + x16365.mul * x16371, x16365.mul * (*mix)};
+  MixState<Rows> x16372{x16365.tot + mixPows[2] * x16371};
   // loc("./zirgen/components/bits.h":55:0)
   auto x16373 = x3 - x2370;
   // loc("./zirgen/components/bits.h":55:0)
@@ -32790,7 +32807,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/bits.h":55:0)
   auto x16378 = x16377 * x16373;
   // loc("./zirgen/components/bits.h":55:0)
-  MixState x16379{x16372.tot + x16372.mul * x16378, x16372.mul * (*mix)};
+  MixState<Rows> x16379{x16372.tot + mixPows[3] * x16378};
   // loc("./zirgen/components/bits.h":55:0)
   auto x16380 = x3 - x2372;
   // loc("./zirgen/components/bits.h":55:0)
@@ -32804,7 +32821,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/bits.h":55:0)
   auto x16385 = x16384 * x16380;
   // loc("./zirgen/components/bits.h":55:0)
-  MixState x16386{x16379.tot + x16379.mul * x16385, x16379.mul * (*mix)};
+  MixState<Rows> x16386{x16379.tot + mixPows[4] * x16385};
   // loc("./zirgen/components/bits.h":55:0)
   auto x16387 = x3 - x2374;
   // loc("./zirgen/components/bits.h":55:0)
@@ -32818,611 +32835,611 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/bits.h":55:0)
   auto x16392 = x16391 * x16387;
   // loc("./zirgen/components/bits.h":55:0)
-  MixState x16393{x16386.tot + x16386.mul * x16392, x16386.mul * (*mix)};
+  MixState<Rows> x16393{x16386.tot + mixPows[5] * x16392};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16394 = x1 - x2912;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16395 = x2912 * x16394;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16396{x2326.tot + x2326.mul * x16395, x2326.mul * (*mix)};
+  MixState<Rows> x16396{x2326.tot + mixPows[0] * x16395};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16397 = x1 - x2914;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16398 = x2914 * x16397;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16399{x16396.tot + x16396.mul * x16398, x16396.mul * (*mix)};
+  MixState<Rows> x16399{x16396.tot + mixPows[1] * x16398};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16400 = x1 - x2916;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16401 = x2916 * x16400;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16402{x16399.tot + x16399.mul * x16401, x16399.mul * (*mix)};
+  MixState<Rows> x16402{x16399.tot + mixPows[2] * x16401};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16403 = x1 - x2918;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16404 = x2918 * x16403;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16405{x16402.tot + x16402.mul * x16404, x16402.mul * (*mix)};
+  MixState<Rows> x16405{x16402.tot + mixPows[3] * x16404};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16406 = x1 - x2920;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16407 = x2920 * x16406;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16408{x16405.tot + x16405.mul * x16407, x16405.mul * (*mix)};
+  MixState<Rows> x16408{x16405.tot + mixPows[4] * x16407};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16409 = x1 - x2922;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16410 = x2922 * x16409;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16411{x16408.tot + x16408.mul * x16410, x16408.mul * (*mix)};
+  MixState<Rows> x16411{x16408.tot + mixPows[5] * x16410};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16412 = x1 - x2924;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16413 = x2924 * x16412;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16414{x16411.tot + x16411.mul * x16413, x16411.mul * (*mix)};
+  MixState<Rows> x16414{x16411.tot + mixPows[6] * x16413};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16415 = x1 - x2926;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16416 = x2926 * x16415;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16417{x16414.tot + x16414.mul * x16416, x16414.mul * (*mix)};
+  MixState<Rows> x16417{x16414.tot + mixPows[7] * x16416};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16418 = x1 - x2928;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16419 = x2928 * x16418;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16420{x16417.tot + x16417.mul * x16419, x16417.mul * (*mix)};
+  MixState<Rows> x16420{x16417.tot + mixPows[8] * x16419};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16421 = x1 - x2930;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16422 = x2930 * x16421;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16423{x16420.tot + x16420.mul * x16422, x16420.mul * (*mix)};
+  MixState<Rows> x16423{x16420.tot + mixPows[9] * x16422};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16424{x16423.tot + x16423.mul * x3066, x16423.mul * (*mix)};
+  MixState<Rows> x16424{x16423.tot + mixPows[10] * x3066};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16425 = x1 - x2936;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16426 = x2936 * x16425;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16427{x16424.tot + x16424.mul * x16426, x16424.mul * (*mix)};
+  MixState<Rows> x16427{x16424.tot + mixPows[11] * x16426};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16428 = x1 - x2939;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16429 = x2939 * x16428;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16430{x16427.tot + x16427.mul * x16429, x16427.mul * (*mix)};
+  MixState<Rows> x16430{x16427.tot + mixPows[12] * x16429};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16431 = x1 - x2942;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16432 = x2942 * x16431;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16433{x16430.tot + x16430.mul * x16432, x16430.mul * (*mix)};
+  MixState<Rows> x16433{x16430.tot + mixPows[13] * x16432};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16434 = x1 - x3204;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16435 = x3204 * x16434;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16436{x16433.tot + x16433.mul * x16435, x16433.mul * (*mix)};
+  MixState<Rows> x16436{x16433.tot + mixPows[14] * x16435};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16437 = x1 - x3207;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16438 = x3207 * x16437;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16439{x16436.tot + x16436.mul * x16438, x16436.mul * (*mix)};
+  MixState<Rows> x16439{x16436.tot + mixPows[15] * x16438};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16440 = x1 - x3213;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16441 = x3213 * x16440;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16442{x16439.tot + x16439.mul * x16441, x16439.mul * (*mix)};
+  MixState<Rows> x16442{x16439.tot + mixPows[16] * x16441};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16443 = x1 - x3216;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16444 = x3216 * x16443;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16445{x16442.tot + x16442.mul * x16444, x16442.mul * (*mix)};
+  MixState<Rows> x16445{x16442.tot + mixPows[17] * x16444};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16446 = x1 - x3222;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16447 = x3222 * x16446;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16448{x16445.tot + x16445.mul * x16447, x16445.mul * (*mix)};
+  MixState<Rows> x16448{x16445.tot + mixPows[18] * x16447};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16449 = x1 - x3225;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16450 = x3225 * x16449;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16451{x16448.tot + x16448.mul * x16450, x16448.mul * (*mix)};
+  MixState<Rows> x16451{x16448.tot + mixPows[19] * x16450};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16452 = x1 - x3231;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16453 = x3231 * x16452;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16454{x16451.tot + x16451.mul * x16453, x16451.mul * (*mix)};
+  MixState<Rows> x16454{x16451.tot + mixPows[20] * x16453};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16455 = x1 - x3234;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16456 = x3234 * x16455;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16457{x16454.tot + x16454.mul * x16456, x16454.mul * (*mix)};
+  MixState<Rows> x16457{x16454.tot + mixPows[21] * x16456};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16458 = x1 - x3240;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16459 = x3240 * x16458;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16460{x16457.tot + x16457.mul * x16459, x16457.mul * (*mix)};
+  MixState<Rows> x16460{x16457.tot + mixPows[22] * x16459};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16461 = x1 - x3243;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16462 = x3243 * x16461;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16463{x16460.tot + x16460.mul * x16462, x16460.mul * (*mix)};
+  MixState<Rows> x16463{x16460.tot + mixPows[23] * x16462};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16464 = x1 - x3249;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16465 = x3249 * x16464;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16466{x16463.tot + x16463.mul * x16465, x16463.mul * (*mix)};
+  MixState<Rows> x16466{x16463.tot + mixPows[24] * x16465};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16467 = x1 - x3252;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16468 = x3252 * x16467;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16469{x16466.tot + x16466.mul * x16468, x16466.mul * (*mix)};
+  MixState<Rows> x16469{x16466.tot + mixPows[25] * x16468};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16470 = x1 - x3258;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16471 = x3258 * x16470;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16472{x16469.tot + x16469.mul * x16471, x16469.mul * (*mix)};
+  MixState<Rows> x16472{x16469.tot + mixPows[26] * x16471};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16473 = x1 - x3261;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16474 = x3261 * x16473;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16475{x16472.tot + x16472.mul * x16474, x16472.mul * (*mix)};
+  MixState<Rows> x16475{x16472.tot + mixPows[27] * x16474};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16476 = x1 - x3267;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16477 = x3267 * x16476;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16478{x16475.tot + x16475.mul * x16477, x16475.mul * (*mix)};
+  MixState<Rows> x16478{x16475.tot + mixPows[28] * x16477};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16479 = x1 - x3270;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16480 = x3270 * x16479;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16481{x16478.tot + x16478.mul * x16480, x16478.mul * (*mix)};
+  MixState<Rows> x16481{x16478.tot + mixPows[29] * x16480};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16482 = x1 - x3276;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16483 = x3276 * x16482;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16484{x16481.tot + x16481.mul * x16483, x16481.mul * (*mix)};
+  MixState<Rows> x16484{x16481.tot + mixPows[30] * x16483};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16485 = x1 - x3279;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16486 = x3279 * x16485;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16487{x16484.tot + x16484.mul * x16486, x16484.mul * (*mix)};
+  MixState<Rows> x16487{x16484.tot + mixPows[31] * x16486};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16488 = x1 - x3285;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16489 = x3285 * x16488;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16490{x16487.tot + x16487.mul * x16489, x16487.mul * (*mix)};
+  MixState<Rows> x16490{x16487.tot + mixPows[32] * x16489};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16491 = x1 - x3288;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16492 = x3288 * x16491;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16493{x16490.tot + x16490.mul * x16492, x16490.mul * (*mix)};
+  MixState<Rows> x16493{x16490.tot + mixPows[33] * x16492};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16494 = x1 - x3294;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16495 = x3294 * x16494;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16496{x16493.tot + x16493.mul * x16495, x16493.mul * (*mix)};
+  MixState<Rows> x16496{x16493.tot + mixPows[34] * x16495};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16497 = x1 - x3297;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16498 = x3297 * x16497;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16499{x16496.tot + x16496.mul * x16498, x16496.mul * (*mix)};
+  MixState<Rows> x16499{x16496.tot + mixPows[35] * x16498};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16500 = x1 - x3303;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16501 = x3303 * x16500;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16502{x16499.tot + x16499.mul * x16501, x16499.mul * (*mix)};
+  MixState<Rows> x16502{x16499.tot + mixPows[36] * x16501};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16503 = x1 - x3306;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16504 = x3306 * x16503;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16505{x16502.tot + x16502.mul * x16504, x16502.mul * (*mix)};
+  MixState<Rows> x16505{x16502.tot + mixPows[37] * x16504};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16506 = x1 - x3312;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16507 = x3312 * x16506;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16508{x16505.tot + x16505.mul * x16507, x16505.mul * (*mix)};
+  MixState<Rows> x16508{x16505.tot + mixPows[38] * x16507};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16509 = x1 - x3315;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16510 = x3315 * x16509;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16511{x16508.tot + x16508.mul * x16510, x16508.mul * (*mix)};
+  MixState<Rows> x16511{x16508.tot + mixPows[39] * x16510};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16512 = x1 - x3321;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16513 = x3321 * x16512;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16514{x16511.tot + x16511.mul * x16513, x16511.mul * (*mix)};
+  MixState<Rows> x16514{x16511.tot + mixPows[40] * x16513};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16515 = x1 - x3324;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16516 = x3324 * x16515;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16517{x16514.tot + x16514.mul * x16516, x16514.mul * (*mix)};
+  MixState<Rows> x16517{x16514.tot + mixPows[41] * x16516};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16518 = x1 - x3330;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16519 = x3330 * x16518;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16520{x16517.tot + x16517.mul * x16519, x16517.mul * (*mix)};
+  MixState<Rows> x16520{x16517.tot + mixPows[42] * x16519};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16521 = x1 - x3333;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16522 = x3333 * x16521;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16523{x16520.tot + x16520.mul * x16522, x16520.mul * (*mix)};
+  MixState<Rows> x16523{x16520.tot + mixPows[43] * x16522};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16524 = x1 - x3339;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16525 = x3339 * x16524;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16526{x16523.tot + x16523.mul * x16525, x16523.mul * (*mix)};
+  MixState<Rows> x16526{x16523.tot + mixPows[44] * x16525};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16527 = x1 - x3342;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16528 = x3342 * x16527;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16529{x16526.tot + x16526.mul * x16528, x16526.mul * (*mix)};
+  MixState<Rows> x16529{x16526.tot + mixPows[45] * x16528};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16530 = x1 - x3348;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16531 = x3348 * x16530;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16532{x16529.tot + x16529.mul * x16531, x16529.mul * (*mix)};
+  MixState<Rows> x16532{x16529.tot + mixPows[46] * x16531};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16533 = x1 - x3351;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16534 = x3351 * x16533;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16535{x16532.tot + x16532.mul * x16534, x16532.mul * (*mix)};
+  MixState<Rows> x16535{x16532.tot + mixPows[47] * x16534};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16536 = x1 - x3357;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16537 = x3357 * x16536;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16538{x16535.tot + x16535.mul * x16537, x16535.mul * (*mix)};
+  MixState<Rows> x16538{x16535.tot + mixPows[48] * x16537};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16539 = x1 - x3360;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16540 = x3360 * x16539;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16541{x16538.tot + x16538.mul * x16540, x16538.mul * (*mix)};
+  MixState<Rows> x16541{x16538.tot + mixPows[49] * x16540};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16542 = x1 - x3366;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16543 = x3366 * x16542;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16544{x16541.tot + x16541.mul * x16543, x16541.mul * (*mix)};
+  MixState<Rows> x16544{x16541.tot + mixPows[50] * x16543};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16545 = x1 - x3369;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16546 = x3369 * x16545;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16547{x16544.tot + x16544.mul * x16546, x16544.mul * (*mix)};
+  MixState<Rows> x16547{x16544.tot + mixPows[51] * x16546};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16548 = x1 - x3375;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16549 = x3375 * x16548;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16550{x16547.tot + x16547.mul * x16549, x16547.mul * (*mix)};
+  MixState<Rows> x16550{x16547.tot + mixPows[52] * x16549};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16551 = x1 - x3378;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16552 = x3378 * x16551;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16553{x16550.tot + x16550.mul * x16552, x16550.mul * (*mix)};
+  MixState<Rows> x16553{x16550.tot + mixPows[53] * x16552};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16554{x16553.tot + x16553.mul * x16217, x16553.mul * (*mix)};
+  MixState<Rows> x16554{x16553.tot + mixPows[54] * x16217};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16555{x16554.tot + x16554.mul * x16220, x16554.mul * (*mix)};
+  MixState<Rows> x16555{x16554.tot + mixPows[55] * x16220};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16556{x16555.tot + x16555.mul * x16224, x16555.mul * (*mix)};
+  MixState<Rows> x16556{x16555.tot + mixPows[56] * x16224};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16557{x16556.tot + x16556.mul * x16228, x16556.mul * (*mix)};
+  MixState<Rows> x16557{x16556.tot + mixPows[57] * x16228};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16558{x16557.tot + x16557.mul * x16232, x16557.mul * (*mix)};
+  MixState<Rows> x16558{x16557.tot + mixPows[58] * x16232};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16559{x16558.tot + x16558.mul * x16236, x16558.mul * (*mix)};
+  MixState<Rows> x16559{x16558.tot + mixPows[59] * x16236};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16560{x16559.tot + x16559.mul * x16240, x16559.mul * (*mix)};
+  MixState<Rows> x16560{x16559.tot + mixPows[60] * x16240};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16561{x16560.tot + x16560.mul * x16244, x16560.mul * (*mix)};
+  MixState<Rows> x16561{x16560.tot + mixPows[61] * x16244};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16562{x16393.tot + x2362 * x16561.tot * x16393.mul, x16393.mul * x16561.mul};
+  MixState<Rows> x16562{x16393.tot + x2362 * x16561.tot * mixPows[6]};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16563{x16561.tot + x16561.mul * x16248, x16561.mul * (*mix)};
+  MixState<Rows> x16563{x16561.tot + mixPows[62] * x16248};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16564{x16563.tot + x16563.mul * x16252, x16563.mul * (*mix)};
+  MixState<Rows> x16564{x16563.tot + mixPows[63] * x16252};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16565{x16562.tot + x2602 * x16564.tot * x16562.mul, x16562.mul * x16564.mul};
+  MixState<Rows> x16565{x16562.tot + x2602 * x16564.tot * mixPows[68]};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16566 = x1 - x2649;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16567 = x2649 * x16566;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16568{x2326.tot + x2326.mul * x16567, x2326.mul * (*mix)};
+  MixState<Rows> x16568{x2326.tot + mixPows[0] * x16567};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16569 = x1 - x2651;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16570 = x2651 * x16569;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16571{x16568.tot + x16568.mul * x16570, x16568.mul * (*mix)};
+  MixState<Rows> x16571{x16568.tot + mixPows[1] * x16570};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16572 = x1 - x2653;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16573 = x2653 * x16572;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16574{x16571.tot + x16571.mul * x16573, x16571.mul * (*mix)};
+  MixState<Rows> x16574{x16571.tot + mixPows[2] * x16573};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16575 = x1 - x2655;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16576 = x2655 * x16575;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16577{x16574.tot + x16574.mul * x16576, x16574.mul * (*mix)};
+  MixState<Rows> x16577{x16574.tot + mixPows[3] * x16576};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16578 = x1 - x2657;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16579 = x2657 * x16578;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16580{x16577.tot + x16577.mul * x16579, x16577.mul * (*mix)};
+  MixState<Rows> x16580{x16577.tot + mixPows[4] * x16579};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16581{x16580.tot + x16580.mul * x2793, x16580.mul * (*mix)};
+  MixState<Rows> x16581{x16580.tot + mixPows[5] * x2793};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16582 = x1 - x2663;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16583 = x2663 * x16582;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16584{x16581.tot + x16581.mul * x16583, x16581.mul * (*mix)};
+  MixState<Rows> x16584{x16581.tot + mixPows[6] * x16583};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16585 = x1 - x2666;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16586 = x2666 * x16585;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16587{x16584.tot + x16584.mul * x16586, x16584.mul * (*mix)};
+  MixState<Rows> x16587{x16584.tot + mixPows[7] * x16586};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16588 = x1 - x2669;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16589 = x2669 * x16588;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16590{x16587.tot + x16587.mul * x16589, x16587.mul * (*mix)};
+  MixState<Rows> x16590{x16587.tot + mixPows[8] * x16589};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16591 = x1 - x2910;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16592 = x2910 * x16591;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16593{x16590.tot + x16590.mul * x16592, x16590.mul * (*mix)};
+  MixState<Rows> x16593{x16590.tot + mixPows[9] * x16592};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16594{x16593.tot + x16593.mul * x16395, x16593.mul * (*mix)};
+  MixState<Rows> x16594{x16593.tot + mixPows[10] * x16395};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16595{x16594.tot + x16594.mul * x16398, x16594.mul * (*mix)};
+  MixState<Rows> x16595{x16594.tot + mixPows[11] * x16398};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16596{x16595.tot + x16595.mul * x16401, x16595.mul * (*mix)};
+  MixState<Rows> x16596{x16595.tot + mixPows[12] * x16401};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16597{x16596.tot + x16596.mul * x16404, x16596.mul * (*mix)};
+  MixState<Rows> x16597{x16596.tot + mixPows[13] * x16404};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16598{x16597.tot + x16597.mul * x16407, x16597.mul * (*mix)};
+  MixState<Rows> x16598{x16597.tot + mixPows[14] * x16407};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16599{x16598.tot + x16598.mul * x16410, x16598.mul * (*mix)};
+  MixState<Rows> x16599{x16598.tot + mixPows[15] * x16410};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16600{x16599.tot + x16599.mul * x16413, x16599.mul * (*mix)};
+  MixState<Rows> x16600{x16599.tot + mixPows[16] * x16413};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16601{x16600.tot + x16600.mul * x16416, x16600.mul * (*mix)};
+  MixState<Rows> x16601{x16600.tot + mixPows[17] * x16416};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16602{x16601.tot + x16601.mul * x16419, x16601.mul * (*mix)};
+  MixState<Rows> x16602{x16601.tot + mixPows[18] * x16419};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16603{x16602.tot + x16602.mul * x16422, x16602.mul * (*mix)};
+  MixState<Rows> x16603{x16602.tot + mixPows[19] * x16422};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16604{x16603.tot + x16603.mul * x3066, x16603.mul * (*mix)};
+  MixState<Rows> x16604{x16603.tot + mixPows[20] * x3066};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16605{x16604.tot + x16604.mul * x16426, x16604.mul * (*mix)};
+  MixState<Rows> x16605{x16604.tot + mixPows[21] * x16426};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16606{x16605.tot + x16605.mul * x16429, x16605.mul * (*mix)};
+  MixState<Rows> x16606{x16605.tot + mixPows[22] * x16429};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16607{x16606.tot + x16606.mul * x16432, x16606.mul * (*mix)};
+  MixState<Rows> x16607{x16606.tot + mixPows[23] * x16432};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16608{x16607.tot + x16607.mul * x16435, x16607.mul * (*mix)};
+  MixState<Rows> x16608{x16607.tot + mixPows[24] * x16435};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16609{x16608.tot + x16608.mul * x16438, x16608.mul * (*mix)};
+  MixState<Rows> x16609{x16608.tot + mixPows[25] * x16438};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16610{x16609.tot + x16609.mul * x16441, x16609.mul * (*mix)};
+  MixState<Rows> x16610{x16609.tot + mixPows[26] * x16441};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16611{x16610.tot + x16610.mul * x16444, x16610.mul * (*mix)};
+  MixState<Rows> x16611{x16610.tot + mixPows[27] * x16444};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16612{x16611.tot + x16611.mul * x16447, x16611.mul * (*mix)};
+  MixState<Rows> x16612{x16611.tot + mixPows[28] * x16447};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16613{x16612.tot + x16612.mul * x16450, x16612.mul * (*mix)};
+  MixState<Rows> x16613{x16612.tot + mixPows[29] * x16450};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16614{x16613.tot + x16613.mul * x16453, x16613.mul * (*mix)};
+  MixState<Rows> x16614{x16613.tot + mixPows[30] * x16453};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16615{x16614.tot + x16614.mul * x16456, x16614.mul * (*mix)};
+  MixState<Rows> x16615{x16614.tot + mixPows[31] * x16456};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16616{x16615.tot + x16615.mul * x16465, x16615.mul * (*mix)};
+  MixState<Rows> x16616{x16615.tot + mixPows[32] * x16465};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16617{x16616.tot + x16616.mul * x16468, x16616.mul * (*mix)};
+  MixState<Rows> x16617{x16616.tot + mixPows[33] * x16468};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16618{x16617.tot + x16617.mul * x16471, x16617.mul * (*mix)};
+  MixState<Rows> x16618{x16617.tot + mixPows[34] * x16471};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16619{x16618.tot + x16618.mul * x16474, x16618.mul * (*mix)};
+  MixState<Rows> x16619{x16618.tot + mixPows[35] * x16474};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16620{x16619.tot + x16619.mul * x16477, x16619.mul * (*mix)};
+  MixState<Rows> x16620{x16619.tot + mixPows[36] * x16477};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16621{x16620.tot + x16620.mul * x16480, x16620.mul * (*mix)};
+  MixState<Rows> x16621{x16620.tot + mixPows[37] * x16480};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16622{x16621.tot + x16621.mul * x16483, x16621.mul * (*mix)};
+  MixState<Rows> x16622{x16621.tot + mixPows[38] * x16483};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16623{x16622.tot + x16622.mul * x16486, x16622.mul * (*mix)};
+  MixState<Rows> x16623{x16622.tot + mixPows[39] * x16486};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16624{x16623.tot + x16623.mul * x16489, x16623.mul * (*mix)};
+  MixState<Rows> x16624{x16623.tot + mixPows[40] * x16489};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16625{x16624.tot + x16624.mul * x16492, x16624.mul * (*mix)};
+  MixState<Rows> x16625{x16624.tot + mixPows[41] * x16492};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16626{x16625.tot + x16625.mul * x16495, x16625.mul * (*mix)};
+  MixState<Rows> x16626{x16625.tot + mixPows[42] * x16495};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16627{x16626.tot + x16626.mul * x16498, x16626.mul * (*mix)};
+  MixState<Rows> x16627{x16626.tot + mixPows[43] * x16498};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16628{x16627.tot + x16627.mul * x16501, x16627.mul * (*mix)};
+  MixState<Rows> x16628{x16627.tot + mixPows[44] * x16501};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16629{x16628.tot + x16628.mul * x16504, x16628.mul * (*mix)};
+  MixState<Rows> x16629{x16628.tot + mixPows[45] * x16504};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16630{x16629.tot + x16629.mul * x16507, x16629.mul * (*mix)};
+  MixState<Rows> x16630{x16629.tot + mixPows[46] * x16507};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16631{x16630.tot + x16630.mul * x16510, x16630.mul * (*mix)};
+  MixState<Rows> x16631{x16630.tot + mixPows[47] * x16510};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16632{x16631.tot + x16631.mul * x16513, x16631.mul * (*mix)};
+  MixState<Rows> x16632{x16631.tot + mixPows[48] * x16513};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16633{x16632.tot + x16632.mul * x16516, x16632.mul * (*mix)};
+  MixState<Rows> x16633{x16632.tot + mixPows[49] * x16516};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16634{x16633.tot + x16633.mul * x16519, x16633.mul * (*mix)};
+  MixState<Rows> x16634{x16633.tot + mixPows[50] * x16519};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16635{x16634.tot + x16634.mul * x16522, x16634.mul * (*mix)};
+  MixState<Rows> x16635{x16634.tot + mixPows[51] * x16522};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16636{x16635.tot + x16635.mul * x16525, x16635.mul * (*mix)};
+  MixState<Rows> x16636{x16635.tot + mixPows[52] * x16525};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16637{x16636.tot + x16636.mul * x16528, x16636.mul * (*mix)};
+  MixState<Rows> x16637{x16636.tot + mixPows[53] * x16528};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16638{x16637.tot + x16637.mul * x16531, x16637.mul * (*mix)};
+  MixState<Rows> x16638{x16637.tot + mixPows[54] * x16531};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16639{x16638.tot + x16638.mul * x16534, x16638.mul * (*mix)};
+  MixState<Rows> x16639{x16638.tot + mixPows[55] * x16534};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16640{x16639.tot + x16639.mul * x16537, x16639.mul * (*mix)};
+  MixState<Rows> x16640{x16639.tot + mixPows[56] * x16537};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16641{x16640.tot + x16640.mul * x16540, x16640.mul * (*mix)};
+  MixState<Rows> x16641{x16640.tot + mixPows[57] * x16540};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16642{x16641.tot + x16641.mul * x16543, x16641.mul * (*mix)};
+  MixState<Rows> x16642{x16641.tot + mixPows[58] * x16543};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16643{x16642.tot + x16642.mul * x16546, x16642.mul * (*mix)};
+  MixState<Rows> x16643{x16642.tot + mixPows[59] * x16546};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16644{x16643.tot + x16643.mul * x16549, x16643.mul * (*mix)};
+  MixState<Rows> x16644{x16643.tot + mixPows[60] * x16549};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16645{x16644.tot + x16644.mul * x16552, x16644.mul * (*mix)};
+  MixState<Rows> x16645{x16644.tot + mixPows[61] * x16552};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16646{x16645.tot + x16645.mul * x16217, x16645.mul * (*mix)};
+  MixState<Rows> x16646{x16645.tot + mixPows[62] * x16217};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16647{x16646.tot + x16646.mul * x16220, x16646.mul * (*mix)};
+  MixState<Rows> x16647{x16646.tot + mixPows[63] * x16220};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16648{x16647.tot + x16647.mul * x16232, x16647.mul * (*mix)};
+  MixState<Rows> x16648{x16647.tot + mixPows[64] * x16232};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16649{x16648.tot + x16648.mul * x16236, x16648.mul * (*mix)};
+  MixState<Rows> x16649{x16648.tot + mixPows[65] * x16236};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16650{x16649.tot + x16649.mul * x16240, x16649.mul * (*mix)};
+  MixState<Rows> x16650{x16649.tot + mixPows[66] * x16240};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16651{x16650.tot + x16650.mul * x16244, x16650.mul * (*mix)};
+  MixState<Rows> x16651{x16650.tot + mixPows[67] * x16244};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16652{x16651.tot + x16651.mul * x16248, x16651.mul * (*mix)};
+  MixState<Rows> x16652{x16651.tot + mixPows[68] * x16248};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16653{x16652.tot + x16652.mul * x16252, x16652.mul * (*mix)};
+  MixState<Rows> x16653{x16652.tot + mixPows[69] * x16252};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16654{x16653.tot + x16653.mul * x16256, x16653.mul * (*mix)};
+  MixState<Rows> x16654{x16653.tot + mixPows[70] * x16256};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16655 = x1 - x2518;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16656 = x2518 * x16655;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16657{x16654.tot + x16654.mul * x16656, x16654.mul * (*mix)};
+  MixState<Rows> x16657{x16654.tot + mixPows[71] * x16656};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16658{x16657.tot + x16657.mul * x16262, x16657.mul * (*mix)};
+  MixState<Rows> x16658{x16657.tot + mixPows[72] * x16262};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16659{x16658.tot + x16658.mul * x16265, x16658.mul * (*mix)};
+  MixState<Rows> x16659{x16658.tot + mixPows[73] * x16265};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16660{x16659.tot + x16659.mul * x16269, x16659.mul * (*mix)};
+  MixState<Rows> x16660{x16659.tot + mixPows[74] * x16269};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16661{x16660.tot + x16660.mul * x16273, x16660.mul * (*mix)};
+  MixState<Rows> x16661{x16660.tot + mixPows[75] * x16273};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16662{x16661.tot + x16661.mul * x16277, x16661.mul * (*mix)};
+  MixState<Rows> x16662{x16661.tot + mixPows[76] * x16277};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16663{x16662.tot + x16662.mul * x16281, x16662.mul * (*mix)};
+  MixState<Rows> x16663{x16662.tot + mixPows[77] * x16281};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16664{x16663.tot + x16663.mul * x16285, x16663.mul * (*mix)};
+  MixState<Rows> x16664{x16663.tot + mixPows[78] * x16285};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16665{x16664.tot + x16664.mul * x16289, x16664.mul * (*mix)};
+  MixState<Rows> x16665{x16664.tot + mixPows[79] * x16289};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16666{x16665.tot + x16665.mul * x16293, x16665.mul * (*mix)};
+  MixState<Rows> x16666{x16665.tot + mixPows[80] * x16293};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16667{x16666.tot + x16666.mul * x16297, x16666.mul * (*mix)};
+  MixState<Rows> x16667{x16666.tot + mixPows[81] * x16297};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16668{x16667.tot + x16667.mul * x16301, x16667.mul * (*mix)};
+  MixState<Rows> x16668{x16667.tot + mixPows[82] * x16301};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16669 = x1 - x2791;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16670 = x2791 * x16669;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16671{x16668.tot + x16668.mul * x16670, x16668.mul * (*mix)};
+  MixState<Rows> x16671{x16668.tot + mixPows[83] * x16670};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16672{x16671.tot + x16671.mul * x16307, x16671.mul * (*mix)};
+  MixState<Rows> x16672{x16671.tot + mixPows[84] * x16307};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16673{x16672.tot + x16672.mul * x16310, x16672.mul * (*mix)};
+  MixState<Rows> x16673{x16672.tot + mixPows[85] * x16310};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16674{x16673.tot + x16673.mul * x16314, x16673.mul * (*mix)};
+  MixState<Rows> x16674{x16673.tot + mixPows[86] * x16314};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16675{x16674.tot + x16674.mul * x16318, x16674.mul * (*mix)};
+  MixState<Rows> x16675{x16674.tot + mixPows[87] * x16318};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16676{x16675.tot + x16675.mul * x16322, x16675.mul * (*mix)};
+  MixState<Rows> x16676{x16675.tot + mixPows[88] * x16322};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16677{x16676.tot + x16676.mul * x16326, x16676.mul * (*mix)};
+  MixState<Rows> x16677{x16676.tot + mixPows[89] * x16326};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16678{x16677.tot + x16677.mul * x16330, x16677.mul * (*mix)};
+  MixState<Rows> x16678{x16677.tot + mixPows[90] * x16330};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16679{x16678.tot + x16678.mul * x16334, x16678.mul * (*mix)};
+  MixState<Rows> x16679{x16678.tot + mixPows[91] * x16334};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16680{x16679.tot + x16679.mul * x16338, x16679.mul * (*mix)};
+  MixState<Rows> x16680{x16679.tot + mixPows[92] * x16338};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16681{x16680.tot + x16680.mul * x16342, x16680.mul * (*mix)};
+  MixState<Rows> x16681{x16680.tot + mixPows[93] * x16342};
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16682{x16681.tot + x16681.mul * x16346, x16681.mul * (*mix)};
+  MixState<Rows> x16682{x16681.tot + mixPows[94] * x16346};
   // loc("./zirgen/components/bits.h":24:0)
   auto x16683 = x1 - x3064;
   // loc("./zirgen/components/bits.h":24:0)
   auto x16684 = x3064 * x16683;
   // loc("./zirgen/components/bits.h":24:0)
-  MixState x16685{x16682.tot + x16682.mul * x16684, x16682.mul * (*mix)};
+  MixState<Rows> x16685{x16682.tot + mixPows[95] * x16684};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16686{x16565.tot + x2633 * x16685.tot * x16565.mul, x16565.mul * x16685.mul};
+  MixState<Rows> x16686{x16565.tot + x2633 * x16685.tot * mixPows[132]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16687{x16686.tot + x2634 * x16685.tot * x16686.mul, x16686.mul * x16685.mul};
+  MixState<Rows> x16687{x16686.tot + x2634 * x16685.tot * mixPows[228]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16688{x16687.tot + x2635 * x16685.tot * x16687.mul, x16687.mul * x16685.mul};
+  MixState<Rows> x16688{x16687.tot + x2635 * x16685.tot * mixPows[324]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16689{x16688.tot + x2875 * x16685.tot * x16688.mul, x16688.mul * x16685.mul};
+  MixState<Rows> x16689{x16688.tot + x2875 * x16685.tot * mixPows[420]};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16690 = x1 - x2376;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16691 = x2376 * x16690;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16692{x2326.tot + x2326.mul * x16691, x2326.mul * (*mix)};
+  MixState<Rows> x16692{x2326.tot + mixPows[0] * x16691};
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16693 = x1 - x2378;
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16694 = x2378 * x16693;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16695{x16692.tot + x16692.mul * x16694, x16692.mul * (*mix)};
+  MixState<Rows> x16695{x16692.tot + mixPows[1] * x16694};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16696 = x2376 + x2378;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -33430,7 +33447,7 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16698 = x2380 * x16697;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16699{x16695.tot + x16695.mul * x16698, x16695.mul * (*mix)};
+  MixState<Rows> x16699{x16695.tot + mixPows[2] * x16698};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16700 = x16696 + x2380;
   // loc("./zirgen/components/onehot.h":28:0)
@@ -33438,19 +33455,27 @@ Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {
   // loc("./zirgen/components/onehot.h":28:0)
   auto x16702 = x2382 * x16701;
   // loc("./zirgen/components/onehot.h":28:0)
-  MixState x16703{x16699.tot + x16699.mul * x16702, x16699.mul * (*mix)};
+  MixState<Rows> x16703{x16699.tot + mixPows[3] * x16702};
   // loc("./zirgen/components/onehot.h":29:0)
   auto x16704 = x16700 + x2382;
   // loc("./zirgen/components/onehot.h":31:0)
   auto x16705 = x16704 - x1;
   // loc("./zirgen/components/onehot.h":31:0)
-  MixState x16706{x16703.tot + x16703.mul * x16705, x16703.mul * (*mix)};
+  MixState<Rows> x16706{x16703.tot + mixPows[4] * x16705};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16707{x16689.tot + x2906 * x16706.tot * x16689.mul, x16689.mul * x16706.mul};
+  MixState<Rows> x16707{x16689.tot + x2906 * x16706.tot * mixPows[516]};
   // loc("zirgen/compiler/edsl/component.cpp":39:0)
-  MixState x16708{x16351.tot + x3148 * x16707.tot * x16351.mul, x16351.mul * x16707.mul};
+  MixState<Rows> x16708{x16351.tot + x3148 * x16707.tot * mixPows[1140]};
   return x16708.tot;
 }
 
+Fp4 poly_fp(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args) {
+  return polyFp<OneRow>(cycle, steps, mixPows, args);
+}
+
+Fp4Vec<kFpVecLanes> poly_fp_batch(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args) {
+  return polyFp<LaneRows>(cycle, steps, mixPows, args);
+}
+
 } // namespace risc0::circuit::recursion
 // clang-format on
@@ -12,24 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "ffi.h"
 #include "fp.h"
 
 #include <array>
-#include <cassert>
-#include <stdexcept>
 
 // clang-format off
-namespace risc0::circuit::recursion {
+namespace risc0::circuit::recursion::RISC0_STEP_VARIANT {
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
-Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args) {
+Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err) {
   size_t mask = steps - 1;
   std::array<Fp, 96> host_args;
   std::array<Fp, 32> host_outs;
@@ -43,39 +41,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
   Fp x3(0);
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/micro_ops(Reg)"("./zirgen/components/mux.h":49:0))
   auto x4 = args[0][1 * steps + ((cycle - 0) & mask)];
-  assert(x4 != Fp::invalid());
+  if (kCheckRegs && x4 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/micro_ops(Reg) (args[0][1], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/macro_ops(Reg)"("./zirgen/components/mux.h":49:0))
   auto x5 = args[0][2 * steps + ((cycle - 0) & mask)];
-  assert(x5 != Fp::invalid());
+  if (kCheckRegs && x5 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/macro_ops(Reg) (args[0][2], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_load(Reg)"("./zirgen/components/mux.h":49:0))
   auto x6 = args[0][3 * steps + ((cycle - 0) & mask)];
-  assert(x6 != Fp::invalid());
+  if (kCheckRegs && x6 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_load(Reg) (args[0][3], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_full(Reg)"("./zirgen/components/mux.h":49:0))
   auto x7 = args[0][4 * steps + ((cycle - 0) & mask)];
-  assert(x7 != Fp::invalid());
+  if (kCheckRegs && x7 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_full(Reg) (args[0][4], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_partial(Reg)"("./zirgen/components/mux.h":49:0))
   auto x8 = args[0][5 * steps + ((cycle - 0) & mask)];
-  assert(x8 != Fp::invalid());
+  if (kCheckRegs && x8 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_partial(Reg) (args[0][5], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_store(Reg)"("./zirgen/components/mux.h":49:0))
   auto x9 = args[0][6 * steps + ((cycle - 0) & mask)];
-  assert(x9 != Fp::invalid());
+  if (kCheckRegs && x9 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_store(Reg) (args[0][6], back 0)");
   if (x4 != 0) {
     {
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x10 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x10 != Fp::invalid());
+      if (kCheckRegs && x10 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][5], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x11 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x11 != Fp::invalid());
+      if (kCheckRegs && x11 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][6], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x12 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x12 != Fp::invalid());
+      if (kCheckRegs && x12 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][7], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x13 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x13 != Fp::invalid());
+      if (kCheckRegs && x13 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][8], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x14 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x14 != Fp::invalid());
+      if (kCheckRegs && x14 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][9], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x15 = args[3][0];
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -192,19 +190,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x71 = x59 + x67;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x72 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x72 != Fp::invalid());
+      if (kCheckRegs && x72 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][10], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x73 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x73 != Fp::invalid());
+      if (kCheckRegs && x73 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][11], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x74 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x74 != Fp::invalid());
+      if (kCheckRegs && x74 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][12], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x75 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x75 != Fp::invalid());
+      if (kCheckRegs && x75 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][13], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x76 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x76 != Fp::invalid());
+      if (kCheckRegs && x76 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x77 = x15 * x72;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -343,19 +341,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x144 = x143 + x138;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x145 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x145 != Fp::invalid());
+      if (kCheckRegs && x145 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][15], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x146 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x146 != Fp::invalid());
+      if (kCheckRegs && x146 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][16], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x147 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x147 != Fp::invalid());
+      if (kCheckRegs && x147 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][17], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x148 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x148 != Fp::invalid());
+      if (kCheckRegs && x148 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][18], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x149 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x149 != Fp::invalid());
+      if (kCheckRegs && x149 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][19], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x150 = x15 * x145;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -494,19 +492,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x217 = x216 + x211;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x218 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x218 != Fp::invalid());
+      if (kCheckRegs && x218 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x219 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x219 != Fp::invalid());
+      if (kCheckRegs && x219 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x220 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x220 != Fp::invalid());
+      if (kCheckRegs && x220 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x221 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x221 != Fp::invalid());
+      if (kCheckRegs && x221 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x222 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x222 != Fp::invalid());
+      if (kCheckRegs && x222 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x223 = x15 * x218;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -583,19 +581,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x259 = x251 + x255;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x260 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x260 != Fp::invalid());
+      if (kCheckRegs && x260 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x261 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x261 != Fp::invalid());
+      if (kCheckRegs && x261 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x262 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x262 != Fp::invalid());
+      if (kCheckRegs && x262 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x263 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x263 != Fp::invalid());
+      if (kCheckRegs && x263 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x264 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x264 != Fp::invalid());
+      if (kCheckRegs && x264 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x265 = x15 * x260;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -734,19 +732,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x332 = x331 + x326;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x333 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x333 != Fp::invalid());
+      if (kCheckRegs && x333 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x334 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x334 != Fp::invalid());
+      if (kCheckRegs && x334 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x335 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x335 != Fp::invalid());
+      if (kCheckRegs && x335 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x336 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x336 != Fp::invalid());
+      if (kCheckRegs && x336 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x337 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x337 != Fp::invalid());
+      if (kCheckRegs && x337 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x338 = x15 * x333;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -885,19 +883,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x405 = x404 + x399;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x406 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x406 != Fp::invalid());
+      if (kCheckRegs && x406 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x407 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x407 != Fp::invalid());
+      if (kCheckRegs && x407 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x408 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x408 != Fp::invalid());
+      if (kCheckRegs && x408 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x409 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x409 != Fp::invalid());
+      if (kCheckRegs && x409 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x410 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x410 != Fp::invalid());
+      if (kCheckRegs && x410 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x411 = x15 * x406;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -974,19 +972,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x447 = x439 + x443;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x448 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x448 != Fp::invalid());
+      if (kCheckRegs && x448 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x449 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x449 != Fp::invalid());
+      if (kCheckRegs && x449 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x450 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x450 != Fp::invalid());
+      if (kCheckRegs && x450 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x451 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x451 != Fp::invalid());
+      if (kCheckRegs && x451 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x452 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x452 != Fp::invalid());
+      if (kCheckRegs && x452 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x453 = x15 * x448;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1125,19 +1123,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x520 = x519 + x514;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x521 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x521 != Fp::invalid());
+      if (kCheckRegs && x521 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x522 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x522 != Fp::invalid());
+      if (kCheckRegs && x522 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x523 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x523 != Fp::invalid());
+      if (kCheckRegs && x523 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x524 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x524 != Fp::invalid());
+      if (kCheckRegs && x524 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x525 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x525 != Fp::invalid());
+      if (kCheckRegs && x525 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x526 = x15 * x521;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1276,19 +1274,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x593 = x592 + x587;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x594 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x594 != Fp::invalid());
+      if (kCheckRegs && x594 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][50], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x595 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x595 != Fp::invalid());
+      if (kCheckRegs && x595 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][51], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x596 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x596 != Fp::invalid());
+      if (kCheckRegs && x596 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][52], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x597 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x597 != Fp::invalid());
+      if (kCheckRegs && x597 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][53], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x598 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x598 != Fp::invalid());
+      if (kCheckRegs && x598 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x599 = x15 * x594;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1365,19 +1363,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x635 = x627 + x631;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x636 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x636 != Fp::invalid());
+      if (kCheckRegs && x636 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][55], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x637 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x637 != Fp::invalid());
+      if (kCheckRegs && x637 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][56], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x638 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x638 != Fp::invalid());
+      if (kCheckRegs && x638 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][57], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x639 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x639 != Fp::invalid());
+      if (kCheckRegs && x639 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][58], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x640 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x640 != Fp::invalid());
+      if (kCheckRegs && x640 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][59], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x641 = x15 * x636;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1516,19 +1514,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x708 = x707 + x702;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x709 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x709 != Fp::invalid());
+      if (kCheckRegs && x709 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][60], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x710 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x710 != Fp::invalid());
+      if (kCheckRegs && x710 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][61], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x711 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x711 != Fp::invalid());
+      if (kCheckRegs && x711 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][62], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x712 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x712 != Fp::invalid());
+      if (kCheckRegs && x712 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][63], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x713 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x713 != Fp::invalid());
+      if (kCheckRegs && x713 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x714 = x15 * x709;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1667,19 +1665,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x781 = x780 + x775;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x782 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x782 != Fp::invalid());
+      if (kCheckRegs && x782 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][65], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x783 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x783 != Fp::invalid());
+      if (kCheckRegs && x783 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][66], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x784 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x784 != Fp::invalid());
+      if (kCheckRegs && x784 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][67], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x785 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x785 != Fp::invalid());
+      if (kCheckRegs && x785 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][68], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x786 = args[2][69 * steps + ((cycle - 0) & mask)];
-      assert(x786 != Fp::invalid());
+      if (kCheckRegs && x786 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][69], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x787 = x15 * x782;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1756,19 +1754,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x823 = x815 + x819;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x824 = args[2][70 * steps + ((cycle - 0) & mask)];
-      assert(x824 != Fp::invalid());
+      if (kCheckRegs && x824 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][70], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x825 = args[2][71 * steps + ((cycle - 0) & mask)];
-      assert(x825 != Fp::invalid());
+      if (kCheckRegs && x825 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][71], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x826 = args[2][72 * steps + ((cycle - 0) & mask)];
-      assert(x826 != Fp::invalid());
+      if (kCheckRegs && x826 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][72], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x827 = args[2][73 * steps + ((cycle - 0) & mask)];
-      assert(x827 != Fp::invalid());
+      if (kCheckRegs && x827 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][73], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x828 = args[2][74 * steps + ((cycle - 0) & mask)];
-      assert(x828 != Fp::invalid());
+      if (kCheckRegs && x828 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][74], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x829 = x15 * x824;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1907,19 +1905,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x896 = x895 + x890;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x897 = args[2][75 * steps + ((cycle - 0) & mask)];
-      assert(x897 != Fp::invalid());
+      if (kCheckRegs && x897 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][75], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x898 = args[2][76 * steps + ((cycle - 0) & mask)];
-      assert(x898 != Fp::invalid());
+      if (kCheckRegs && x898 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][76], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x899 = args[2][77 * steps + ((cycle - 0) & mask)];
-      assert(x899 != Fp::invalid());
+      if (kCheckRegs && x899 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][77], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x900 = args[2][78 * steps + ((cycle - 0) & mask)];
-      assert(x900 != Fp::invalid());
+      if (kCheckRegs && x900 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][78], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x901 = args[2][79 * steps + ((cycle - 0) & mask)];
-      assert(x901 != Fp::invalid());
+      if (kCheckRegs && x901 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][79], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x902 = x15 * x897;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2058,19 +2056,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x969 = x968 + x963;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x970 = args[2][80 * steps + ((cycle - 0) & mask)];
-      assert(x970 != Fp::invalid());
+      if (kCheckRegs && x970 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][80], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x971 = args[2][81 * steps + ((cycle - 0) & mask)];
-      assert(x971 != Fp::invalid());
+      if (kCheckRegs && x971 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][81], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x972 = args[2][82 * steps + ((cycle - 0) & mask)];
-      assert(x972 != Fp::invalid());
+      if (kCheckRegs && x972 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][82], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x973 = args[2][83 * steps + ((cycle - 0) & mask)];
-      assert(x973 != Fp::invalid());
+      if (kCheckRegs && x973 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][83], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x974 = args[2][84 * steps + ((cycle - 0) & mask)];
-      assert(x974 != Fp::invalid());
+      if (kCheckRegs && x974 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][84], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x975 = x15 * x970;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2147,19 +2145,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1011 = x1003 + x1007;
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1012 = args[2][85 * steps + ((cycle - 0) & mask)];
-      assert(x1012 != Fp::invalid());
+      if (kCheckRegs && x1012 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][85], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1013 = args[2][86 * steps + ((cycle - 0) & mask)];
-      assert(x1013 != Fp::invalid());
+      if (kCheckRegs && x1013 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][86], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1014 = args[2][87 * steps + ((cycle - 0) & mask)];
-      assert(x1014 != Fp::invalid());
+      if (kCheckRegs && x1014 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][87], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1015 = args[2][88 * steps + ((cycle - 0) & mask)];
-      assert(x1015 != Fp::invalid());
+      if (kCheckRegs && x1015 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][88], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1016 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x1016 != Fp::invalid());
+      if (kCheckRegs && x1016 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][89], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1017 = x15 * x1012;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2298,19 +2296,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1084 = x1083 + x1078;
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1085 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x1085 != Fp::invalid());
+      if (kCheckRegs && x1085 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1086 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x1086 != Fp::invalid());
+      if (kCheckRegs && x1086 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1087 = args[2][2 * steps + ((cycle - 0) & mask)];
-      assert(x1087 != Fp::invalid());
+      if (kCheckRegs && x1087 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1088 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x1088 != Fp::invalid());
+      if (kCheckRegs && x1088 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1089 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x1089 != Fp::invalid());
+      if (kCheckRegs && x1089 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1090 = x15 * x1085;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2979,34 +2977,34 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1422 = x1421 + x1418;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x1423 = x1422 + x1417;
-      host_args.at(0) = x1400;
-      host_args.at(1) = x1408;
-      host_args.at(2) = x1416;
-      host_args.at(3) = x1423;
-      host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x1400;
+      host_args[1] = x1408;
+      host_args[2] = x1416;
+      host_args[3] = x1423;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x5 != 0) {
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1424 = args[0][10 * steps + ((cycle - 0) & mask)];
-    assert(x1424 != Fp::invalid());
+    if (kCheckRegs && x1424 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][10], back 0)");
     if (x1424 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1425 = args[2][11 * steps + ((cycle - 0) & mask)];
-        assert(x1425 != Fp::invalid());
+        if (kCheckRegs && x1425 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][11], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1426 = args[2][12 * steps + ((cycle - 0) & mask)];
-        assert(x1426 != Fp::invalid());
+        if (kCheckRegs && x1426 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][12], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1427 = args[2][13 * steps + ((cycle - 0) & mask)];
-        assert(x1427 != Fp::invalid());
+        if (kCheckRegs && x1427 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][13], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1428 = args[2][14 * steps + ((cycle - 0) & mask)];
-        assert(x1428 != Fp::invalid());
+        if (kCheckRegs && x1428 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][14], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1429 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x1429 != Fp::invalid());
+        if (kCheckRegs && x1429 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x1430 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -3123,19 +3121,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1486 = x1474 + x1482;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1487 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x1487 != Fp::invalid());
+        if (kCheckRegs && x1487 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1488 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x1488 != Fp::invalid());
+        if (kCheckRegs && x1488 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1489 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x1489 != Fp::invalid());
+        if (kCheckRegs && x1489 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1490 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x1490 != Fp::invalid());
+        if (kCheckRegs && x1490 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1491 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x1491 != Fp::invalid());
+        if (kCheckRegs && x1491 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][20], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x1492 = x1430 * x1487;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -3274,19 +3272,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1559 = x1558 + x1553;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1560 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x1560 != Fp::invalid());
+        if (kCheckRegs && x1560 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1561 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x1561 != Fp::invalid());
+        if (kCheckRegs && x1561 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1562 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x1562 != Fp::invalid());
+        if (kCheckRegs && x1562 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1563 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x1563 != Fp::invalid());
+        if (kCheckRegs && x1563 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1564 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x1564 != Fp::invalid());
+        if (kCheckRegs && x1564 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x1565 = x1430 * x1560;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -3363,19 +3361,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1601 = x1593 + x1597;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1602 = args[2][26 * steps + ((cycle - 0) & mask)];
-        assert(x1602 != Fp::invalid());
+        if (kCheckRegs && x1602 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][26], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1603 = args[2][27 * steps + ((cycle - 0) & mask)];
-        assert(x1603 != Fp::invalid());
+        if (kCheckRegs && x1603 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][27], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1604 = args[2][28 * steps + ((cycle - 0) & mask)];
-        assert(x1604 != Fp::invalid());
+        if (kCheckRegs && x1604 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][28], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1605 = args[2][29 * steps + ((cycle - 0) & mask)];
-        assert(x1605 != Fp::invalid());
+        if (kCheckRegs && x1605 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][29], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1606 = args[2][30 * steps + ((cycle - 0) & mask)];
-        assert(x1606 != Fp::invalid());
+        if (kCheckRegs && x1606 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][30], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x1607 = x1430 * x1602;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -3452,19 +3450,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1643 = x1635 + x1639;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1644 = args[2][31 * steps + ((cycle - 0) & mask)];
-        assert(x1644 != Fp::invalid());
+        if (kCheckRegs && x1644 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][31], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1645 = args[2][32 * steps + ((cycle - 0) & mask)];
-        assert(x1645 != Fp::invalid());
+        if (kCheckRegs && x1645 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][32], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1646 = args[2][33 * steps + ((cycle - 0) & mask)];
-        assert(x1646 != Fp::invalid());
+        if (kCheckRegs && x1646 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][33], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1647 = args[2][34 * steps + ((cycle - 0) & mask)];
-        assert(x1647 != Fp::invalid());
+        if (kCheckRegs && x1647 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][34], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1648 = args[2][35 * steps + ((cycle - 0) & mask)];
-        assert(x1648 != Fp::invalid());
+        if (kCheckRegs && x1648 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][35], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x1649 = x1430 * x1644;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -3603,19 +3601,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1716 = x1715 + x1710;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1717 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x1717 != Fp::invalid());
+        if (kCheckRegs && x1717 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1718 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x1718 != Fp::invalid());
+        if (kCheckRegs && x1718 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1719 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x1719 != Fp::invalid());
+        if (kCheckRegs && x1719 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1720 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x1720 != Fp::invalid());
+        if (kCheckRegs && x1720 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1721 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x1721 != Fp::invalid());
+        if (kCheckRegs && x1721 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x1722 = x1430 * x1717;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -4024,33 +4022,33 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1924 = x1923 + x1920;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x1925 = x1924 + x1919;
-        host_args.at(0) = x1902;
-        host_args.at(1) = x1910;
-        host_args.at(2) = x1918;
-        host_args.at(3) = x1925;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x1902;
+        host_args[1] = x1910;
+        host_args[2] = x1918;
+        host_args[3] = x1925;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1926 = args[0][11 * steps + ((cycle - 0) & mask)];
-    assert(x1926 != Fp::invalid());
+    if (kCheckRegs && x1926 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][11], back 0)");
     if (x1926 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1927 = args[2][11 * steps + ((cycle - 0) & mask)];
-        assert(x1927 != Fp::invalid());
+        if (kCheckRegs && x1927 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][11], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1928 = args[2][12 * steps + ((cycle - 0) & mask)];
-        assert(x1928 != Fp::invalid());
+        if (kCheckRegs && x1928 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][12], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1929 = args[2][13 * steps + ((cycle - 0) & mask)];
-        assert(x1929 != Fp::invalid());
+        if (kCheckRegs && x1929 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][13], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1930 = args[2][14 * steps + ((cycle - 0) & mask)];
-        assert(x1930 != Fp::invalid());
+        if (kCheckRegs && x1930 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][14], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1931 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x1931 != Fp::invalid());
+        if (kCheckRegs && x1931 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x1932 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -4167,19 +4165,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x1988 = x1976 + x1984;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x1989 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x1989 != Fp::invalid());
+        if (kCheckRegs && x1989 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1990 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x1990 != Fp::invalid());
+        if (kCheckRegs && x1990 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1991 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x1991 != Fp::invalid());
+        if (kCheckRegs && x1991 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1992 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x1992 != Fp::invalid());
+        if (kCheckRegs && x1992 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x1993 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x1993 != Fp::invalid());
+        if (kCheckRegs && x1993 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][20], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x1994 = x1932 * x1989;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -4318,19 +4316,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2061 = x2060 + x2055;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2062 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x2062 != Fp::invalid());
+        if (kCheckRegs && x2062 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2063 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x2063 != Fp::invalid());
+        if (kCheckRegs && x2063 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2064 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x2064 != Fp::invalid());
+        if (kCheckRegs && x2064 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2065 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x2065 != Fp::invalid());
+        if (kCheckRegs && x2065 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2066 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x2066 != Fp::invalid());
+        if (kCheckRegs && x2066 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2067 = x1932 * x2062;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -4407,19 +4405,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2103 = x2095 + x2099;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2104 = args[2][26 * steps + ((cycle - 0) & mask)];
-        assert(x2104 != Fp::invalid());
+        if (kCheckRegs && x2104 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][26], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2105 = args[2][27 * steps + ((cycle - 0) & mask)];
-        assert(x2105 != Fp::invalid());
+        if (kCheckRegs && x2105 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][27], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2106 = args[2][28 * steps + ((cycle - 0) & mask)];
-        assert(x2106 != Fp::invalid());
+        if (kCheckRegs && x2106 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][28], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2107 = args[2][29 * steps + ((cycle - 0) & mask)];
-        assert(x2107 != Fp::invalid());
+        if (kCheckRegs && x2107 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][29], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2108 = args[2][30 * steps + ((cycle - 0) & mask)];
-        assert(x2108 != Fp::invalid());
+        if (kCheckRegs && x2108 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][30], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2109 = x1932 * x2104;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -4496,19 +4494,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2145 = x2137 + x2141;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2146 = args[2][31 * steps + ((cycle - 0) & mask)];
-        assert(x2146 != Fp::invalid());
+        if (kCheckRegs && x2146 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][31], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2147 = args[2][32 * steps + ((cycle - 0) & mask)];
-        assert(x2147 != Fp::invalid());
+        if (kCheckRegs && x2147 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][32], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2148 = args[2][33 * steps + ((cycle - 0) & mask)];
-        assert(x2148 != Fp::invalid());
+        if (kCheckRegs && x2148 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][33], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2149 = args[2][34 * steps + ((cycle - 0) & mask)];
-        assert(x2149 != Fp::invalid());
+        if (kCheckRegs && x2149 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][34], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2150 = args[2][35 * steps + ((cycle - 0) & mask)];
-        assert(x2150 != Fp::invalid());
+        if (kCheckRegs && x2150 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][35], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2151 = x1932 * x2146;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -4647,19 +4645,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2218 = x2217 + x2212;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2219 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x2219 != Fp::invalid());
+        if (kCheckRegs && x2219 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2220 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x2220 != Fp::invalid());
+        if (kCheckRegs && x2220 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2221 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x2221 != Fp::invalid());
+        if (kCheckRegs && x2221 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2222 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x2222 != Fp::invalid());
+        if (kCheckRegs && x2222 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2223 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x2223 != Fp::invalid());
+        if (kCheckRegs && x2223 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2224 = x1932 * x2219;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -5068,33 +5066,33 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2426 = x2425 + x2422;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x2427 = x2426 + x2421;
-        host_args.at(0) = x2404;
-        host_args.at(1) = x2412;
-        host_args.at(2) = x2420;
-        host_args.at(3) = x2427;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x2404;
+        host_args[1] = x2412;
+        host_args[2] = x2420;
+        host_args[3] = x2427;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x2428 = args[0][12 * steps + ((cycle - 0) & mask)];
-    assert(x2428 != Fp::invalid());
+    if (kCheckRegs && x2428 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][12], back 0)");
     if (x2428 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2429 = args[2][11 * steps + ((cycle - 0) & mask)];
-        assert(x2429 != Fp::invalid());
+        if (kCheckRegs && x2429 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][11], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2430 = args[2][12 * steps + ((cycle - 0) & mask)];
-        assert(x2430 != Fp::invalid());
+        if (kCheckRegs && x2430 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][12], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2431 = args[2][13 * steps + ((cycle - 0) & mask)];
-        assert(x2431 != Fp::invalid());
+        if (kCheckRegs && x2431 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][13], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2432 = args[2][14 * steps + ((cycle - 0) & mask)];
-        assert(x2432 != Fp::invalid());
+        if (kCheckRegs && x2432 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][14], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2433 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x2433 != Fp::invalid());
+        if (kCheckRegs && x2433 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x2434 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -5211,19 +5209,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2490 = x2478 + x2486;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2491 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x2491 != Fp::invalid());
+        if (kCheckRegs && x2491 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2492 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x2492 != Fp::invalid());
+        if (kCheckRegs && x2492 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2493 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x2493 != Fp::invalid());
+        if (kCheckRegs && x2493 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2494 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x2494 != Fp::invalid());
+        if (kCheckRegs && x2494 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2495 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x2495 != Fp::invalid());
+        if (kCheckRegs && x2495 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][20], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2496 = x2434 * x2491;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -5362,19 +5360,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2563 = x2562 + x2557;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2564 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x2564 != Fp::invalid());
+        if (kCheckRegs && x2564 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2565 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x2565 != Fp::invalid());
+        if (kCheckRegs && x2565 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2566 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x2566 != Fp::invalid());
+        if (kCheckRegs && x2566 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2567 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x2567 != Fp::invalid());
+        if (kCheckRegs && x2567 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2568 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x2568 != Fp::invalid());
+        if (kCheckRegs && x2568 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_init(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2569 = x2434 * x2564;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -5451,19 +5449,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2605 = x2597 + x2601;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2606 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x2606 != Fp::invalid());
+        if (kCheckRegs && x2606 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2607 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x2607 != Fp::invalid());
+        if (kCheckRegs && x2607 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2608 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x2608 != Fp::invalid());
+        if (kCheckRegs && x2608 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2609 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x2609 != Fp::invalid());
+        if (kCheckRegs && x2609 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2610 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x2610 != Fp::invalid());
+        if (kCheckRegs && x2610 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2611 = x2434 * x2606;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -5736,33 +5734,33 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2745 = x2744 + x2741;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x2746 = x2745 + x2740;
-        host_args.at(0) = x2723;
-        host_args.at(1) = x2731;
-        host_args.at(2) = x2739;
-        host_args.at(3) = x2746;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x2723;
+        host_args[1] = x2731;
+        host_args[2] = x2739;
+        host_args[3] = x2746;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x2747 = args[0][13 * steps + ((cycle - 0) & mask)];
-    assert(x2747 != Fp::invalid());
+    if (kCheckRegs && x2747 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][13], back 0)");
     if (x2747 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2748 = args[2][11 * steps + ((cycle - 0) & mask)];
-        assert(x2748 != Fp::invalid());
+        if (kCheckRegs && x2748 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][11], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2749 = args[2][12 * steps + ((cycle - 0) & mask)];
-        assert(x2749 != Fp::invalid());
+        if (kCheckRegs && x2749 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][12], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2750 = args[2][13 * steps + ((cycle - 0) & mask)];
-        assert(x2750 != Fp::invalid());
+        if (kCheckRegs && x2750 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][13], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2751 = args[2][14 * steps + ((cycle - 0) & mask)];
-        assert(x2751 != Fp::invalid());
+        if (kCheckRegs && x2751 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][14], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2752 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x2752 != Fp::invalid());
+        if (kCheckRegs && x2752 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x2753 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -5879,19 +5877,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2809 = x2797 + x2805;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2810 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x2810 != Fp::invalid());
+        if (kCheckRegs && x2810 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2811 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x2811 != Fp::invalid());
+        if (kCheckRegs && x2811 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2812 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x2812 != Fp::invalid());
+        if (kCheckRegs && x2812 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2813 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x2813 != Fp::invalid());
+        if (kCheckRegs && x2813 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2814 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x2814 != Fp::invalid());
+        if (kCheckRegs && x2814 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][20], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2815 = x2753 * x2810;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -6030,19 +6028,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2882 = x2881 + x2876;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2883 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x2883 != Fp::invalid());
+        if (kCheckRegs && x2883 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2884 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x2884 != Fp::invalid());
+        if (kCheckRegs && x2884 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2885 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x2885 != Fp::invalid());
+        if (kCheckRegs && x2885 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2886 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x2886 != Fp::invalid());
+        if (kCheckRegs && x2886 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2887 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x2887 != Fp::invalid());
+        if (kCheckRegs && x2887 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_fini(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2888 = x2753 * x2883;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -6119,19 +6117,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x2924 = x2916 + x2920;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x2925 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x2925 != Fp::invalid());
+        if (kCheckRegs && x2925 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2926 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x2926 != Fp::invalid());
+        if (kCheckRegs && x2926 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2927 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x2927 != Fp::invalid());
+        if (kCheckRegs && x2927 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2928 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x2928 != Fp::invalid());
+        if (kCheckRegs && x2928 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x2929 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x2929 != Fp::invalid());
+        if (kCheckRegs && x2929 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x2930 = x2753 * x2925;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -6404,33 +6402,33 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3064 = x3063 + x3060;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x3065 = x3064 + x3059;
-        host_args.at(0) = x3042;
-        host_args.at(1) = x3050;
-        host_args.at(2) = x3058;
-        host_args.at(3) = x3065;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3042;
+        host_args[1] = x3050;
+        host_args[2] = x3058;
+        host_args[3] = x3065;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x3066 = args[0][14 * steps + ((cycle - 0) & mask)];
-    assert(x3066 != Fp::invalid());
+    if (kCheckRegs && x3066 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][14], back 0)");
     if (x3066 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3067 = args[2][11 * steps + ((cycle - 0) & mask)];
-        assert(x3067 != Fp::invalid());
+        if (kCheckRegs && x3067 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][11], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3068 = args[2][12 * steps + ((cycle - 0) & mask)];
-        assert(x3068 != Fp::invalid());
+        if (kCheckRegs && x3068 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][12], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3069 = args[2][13 * steps + ((cycle - 0) & mask)];
-        assert(x3069 != Fp::invalid());
+        if (kCheckRegs && x3069 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][13], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3070 = args[2][14 * steps + ((cycle - 0) & mask)];
-        assert(x3070 != Fp::invalid());
+        if (kCheckRegs && x3070 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][14], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3071 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x3071 != Fp::invalid());
+        if (kCheckRegs && x3071 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x3072 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -6547,19 +6545,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3128 = x3116 + x3124;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3129 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x3129 != Fp::invalid());
+        if (kCheckRegs && x3129 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3130 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x3130 != Fp::invalid());
+        if (kCheckRegs && x3130 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3131 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x3131 != Fp::invalid());
+        if (kCheckRegs && x3131 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3132 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x3132 != Fp::invalid());
+        if (kCheckRegs && x3132 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3133 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x3133 != Fp::invalid());
+        if (kCheckRegs && x3133 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][20], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3134 = x3072 * x3129;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -6698,19 +6696,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3201 = x3200 + x3195;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3202 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x3202 != Fp::invalid());
+        if (kCheckRegs && x3202 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3203 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x3203 != Fp::invalid());
+        if (kCheckRegs && x3203 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3204 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x3204 != Fp::invalid());
+        if (kCheckRegs && x3204 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3205 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x3205 != Fp::invalid());
+        if (kCheckRegs && x3205 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3206 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x3206 != Fp::invalid());
+        if (kCheckRegs && x3206 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_load(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3207 = x3072 * x3202;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -6787,19 +6785,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3243 = x3235 + x3239;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3244 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x3244 != Fp::invalid());
+        if (kCheckRegs && x3244 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3245 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x3245 != Fp::invalid());
+        if (kCheckRegs && x3245 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3246 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x3246 != Fp::invalid());
+        if (kCheckRegs && x3246 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3247 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x3247 != Fp::invalid());
+        if (kCheckRegs && x3247 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3248 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x3248 != Fp::invalid());
+        if (kCheckRegs && x3248 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3249 = x3072 * x3244;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -7072,33 +7070,33 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3383 = x3382 + x3379;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x3384 = x3383 + x3378;
-        host_args.at(0) = x3361;
-        host_args.at(1) = x3369;
-        host_args.at(2) = x3377;
-        host_args.at(3) = x3384;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3361;
+        host_args[1] = x3369;
+        host_args[2] = x3377;
+        host_args[3] = x3384;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x3385 = args[0][15 * steps + ((cycle - 0) & mask)];
-    assert(x3385 != Fp::invalid());
+    if (kCheckRegs && x3385 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][15], back 0)");
     if (x3385 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3386 = args[2][11 * steps + ((cycle - 0) & mask)];
-        assert(x3386 != Fp::invalid());
+        if (kCheckRegs && x3386 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][11], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3387 = args[2][12 * steps + ((cycle - 0) & mask)];
-        assert(x3387 != Fp::invalid());
+        if (kCheckRegs && x3387 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][12], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3388 = args[2][13 * steps + ((cycle - 0) & mask)];
-        assert(x3388 != Fp::invalid());
+        if (kCheckRegs && x3388 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][13], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3389 = args[2][14 * steps + ((cycle - 0) & mask)];
-        assert(x3389 != Fp::invalid());
+        if (kCheckRegs && x3389 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][14], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3390 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x3390 != Fp::invalid());
+        if (kCheckRegs && x3390 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x3391 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -7215,19 +7213,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3447 = x3435 + x3443;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3448 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x3448 != Fp::invalid());
+        if (kCheckRegs && x3448 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3449 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x3449 != Fp::invalid());
+        if (kCheckRegs && x3449 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3450 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x3450 != Fp::invalid());
+        if (kCheckRegs && x3450 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3451 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x3451 != Fp::invalid());
+        if (kCheckRegs && x3451 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3452 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x3452 != Fp::invalid());
+        if (kCheckRegs && x3452 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][20], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3453 = x3391 * x3448;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -7366,19 +7364,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3520 = x3519 + x3514;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3521 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x3521 != Fp::invalid());
+        if (kCheckRegs && x3521 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3522 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x3522 != Fp::invalid());
+        if (kCheckRegs && x3522 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3523 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x3523 != Fp::invalid());
+        if (kCheckRegs && x3523 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3524 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x3524 != Fp::invalid());
+        if (kCheckRegs && x3524 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3525 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x3525 != Fp::invalid());
+        if (kCheckRegs && x3525 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/sha_mix(recursion::ShaWrap)/sha_cycle(recursion::ShaCycle)/recursion::WomBody/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3526 = x3391 * x3521;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -7455,19 +7453,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3562 = x3554 + x3558;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3563 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x3563 != Fp::invalid());
+        if (kCheckRegs && x3563 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3564 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x3564 != Fp::invalid());
+        if (kCheckRegs && x3564 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3565 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x3565 != Fp::invalid());
+        if (kCheckRegs && x3565 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3566 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x3566 != Fp::invalid());
+        if (kCheckRegs && x3566 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3567 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x3567 != Fp::invalid());
+        if (kCheckRegs && x3567 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3568 = x3391 * x3563;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -7740,33 +7738,33 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3702 = x3701 + x3698;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x3703 = x3702 + x3697;
-        host_args.at(0) = x3680;
-        host_args.at(1) = x3688;
-        host_args.at(2) = x3696;
-        host_args.at(3) = x3703;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3680;
+        host_args[1] = x3688;
+        host_args[2] = x3696;
+        host_args[3] = x3703;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x3704 = args[0][16 * steps + ((cycle - 0) & mask)];
-    assert(x3704 != Fp::invalid());
+    if (kCheckRegs && x3704 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][16], back 0)");
     if (x3704 != 0) {
       {
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3705 = args[2][15 * steps + ((cycle - 0) & mask)];
-        assert(x3705 != Fp::invalid());
+        if (kCheckRegs && x3705 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][15], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3706 = args[2][16 * steps + ((cycle - 0) & mask)];
-        assert(x3706 != Fp::invalid());
+        if (kCheckRegs && x3706 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][16], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3707 = args[2][17 * steps + ((cycle - 0) & mask)];
-        assert(x3707 != Fp::invalid());
+        if (kCheckRegs && x3707 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][17], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3708 = args[2][18 * steps + ((cycle - 0) & mask)];
-        assert(x3708 != Fp::invalid());
+        if (kCheckRegs && x3708 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][18], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3709 = args[2][19 * steps + ((cycle - 0) & mask)];
-        assert(x3709 != Fp::invalid());
+        if (kCheckRegs && x3709 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][19], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x3710 = args[3][0];
         // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -7883,19 +7881,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3766 = x3754 + x3762;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3767 = args[2][20 * steps + ((cycle - 0) & mask)];
-        assert(x3767 != Fp::invalid());
+        if (kCheckRegs && x3767 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3768 = args[2][21 * steps + ((cycle - 0) & mask)];
-        assert(x3768 != Fp::invalid());
+        if (kCheckRegs && x3768 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3769 = args[2][22 * steps + ((cycle - 0) & mask)];
-        assert(x3769 != Fp::invalid());
+        if (kCheckRegs && x3769 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3770 = args[2][23 * steps + ((cycle - 0) & mask)];
-        assert(x3770 != Fp::invalid());
+        if (kCheckRegs && x3770 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3771 = args[2][24 * steps + ((cycle - 0) & mask)];
-        assert(x3771 != Fp::invalid());
+        if (kCheckRegs && x3771 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3772 = x3710 * x3767;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -8034,19 +8032,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3839 = x3838 + x3833;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3840 = args[2][25 * steps + ((cycle - 0) & mask)];
-        assert(x3840 != Fp::invalid());
+        if (kCheckRegs && x3840 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3841 = args[2][26 * steps + ((cycle - 0) & mask)];
-        assert(x3841 != Fp::invalid());
+        if (kCheckRegs && x3841 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3842 = args[2][27 * steps + ((cycle - 0) & mask)];
-        assert(x3842 != Fp::invalid());
+        if (kCheckRegs && x3842 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3843 = args[2][28 * steps + ((cycle - 0) & mask)];
-        assert(x3843 != Fp::invalid());
+        if (kCheckRegs && x3843 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3844 = args[2][29 * steps + ((cycle - 0) & mask)];
-        assert(x3844 != Fp::invalid());
+        if (kCheckRegs && x3844 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3845 = x3710 * x3840;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -8123,19 +8121,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3881 = x3873 + x3877;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3882 = args[2][30 * steps + ((cycle - 0) & mask)];
-        assert(x3882 != Fp::invalid());
+        if (kCheckRegs && x3882 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3883 = args[2][31 * steps + ((cycle - 0) & mask)];
-        assert(x3883 != Fp::invalid());
+        if (kCheckRegs && x3883 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3884 = args[2][32 * steps + ((cycle - 0) & mask)];
-        assert(x3884 != Fp::invalid());
+        if (kCheckRegs && x3884 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3885 = args[2][33 * steps + ((cycle - 0) & mask)];
-        assert(x3885 != Fp::invalid());
+        if (kCheckRegs && x3885 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3886 = args[2][34 * steps + ((cycle - 0) & mask)];
-        assert(x3886 != Fp::invalid());
+        if (kCheckRegs && x3886 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3887 = x3710 * x3882;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -8274,19 +8272,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3954 = x3953 + x3948;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3955 = args[2][35 * steps + ((cycle - 0) & mask)];
-        assert(x3955 != Fp::invalid());
+        if (kCheckRegs && x3955 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3956 = args[2][36 * steps + ((cycle - 0) & mask)];
-        assert(x3956 != Fp::invalid());
+        if (kCheckRegs && x3956 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3957 = args[2][37 * steps + ((cycle - 0) & mask)];
-        assert(x3957 != Fp::invalid());
+        if (kCheckRegs && x3957 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3958 = args[2][38 * steps + ((cycle - 0) & mask)];
-        assert(x3958 != Fp::invalid());
+        if (kCheckRegs && x3958 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3959 = args[2][39 * steps + ((cycle - 0) & mask)];
-        assert(x3959 != Fp::invalid());
+        if (kCheckRegs && x3959 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x3960 = x3710 * x3955;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -8363,19 +8361,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x3996 = x3988 + x3992;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x3997 = args[2][40 * steps + ((cycle - 0) & mask)];
-        assert(x3997 != Fp::invalid());
+        if (kCheckRegs && x3997 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3998 = args[2][41 * steps + ((cycle - 0) & mask)];
-        assert(x3998 != Fp::invalid());
+        if (kCheckRegs && x3998 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x3999 = args[2][42 * steps + ((cycle - 0) & mask)];
-        assert(x3999 != Fp::invalid());
+        if (kCheckRegs && x3999 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4000 = args[2][43 * steps + ((cycle - 0) & mask)];
-        assert(x4000 != Fp::invalid());
+        if (kCheckRegs && x4000 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4001 = args[2][44 * steps + ((cycle - 0) & mask)];
-        assert(x4001 != Fp::invalid());
+        if (kCheckRegs && x4001 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x4002 = x3710 * x3997;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -8514,19 +8512,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x4069 = x4068 + x4063;
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x4070 = args[2][45 * steps + ((cycle - 0) & mask)];
-        assert(x4070 != Fp::invalid());
+        if (kCheckRegs && x4070 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4071 = args[2][46 * steps + ((cycle - 0) & mask)];
-        assert(x4071 != Fp::invalid());
+        if (kCheckRegs && x4071 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4072 = args[2][47 * steps + ((cycle - 0) & mask)];
-        assert(x4072 != Fp::invalid());
+        if (kCheckRegs && x4072 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4073 = args[2][48 * steps + ((cycle - 0) & mask)];
-        assert(x4073 != Fp::invalid());
+        if (kCheckRegs && x4073 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
         // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4074 = args[2][49 * steps + ((cycle - 0) & mask)];
-        assert(x4074 != Fp::invalid());
+        if (kCheckRegs && x4074 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x4075 = x3710 * x4070;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -8603,19 +8601,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x4111 = x4103 + x4107;
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
         auto x4112 = args[2][0 * steps + ((cycle - 0) & mask)];
-        assert(x4112 != Fp::invalid());
+        if (kCheckRegs && x4112 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4113 = args[2][1 * steps + ((cycle - 0) & mask)];
-        assert(x4113 != Fp::invalid());
+        if (kCheckRegs && x4113 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4114 = args[2][2 * steps + ((cycle - 0) & mask)];
-        assert(x4114 != Fp::invalid());
+        if (kCheckRegs && x4114 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4115 = args[2][3 * steps + ((cycle - 0) & mask)];
-        assert(x4115 != Fp::invalid());
+        if (kCheckRegs && x4115 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
         // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
         auto x4116 = args[2][4 * steps + ((cycle - 0) & mask)];
-        assert(x4116 != Fp::invalid());
+        if (kCheckRegs && x4116 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x4117 = x3710 * x4112;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -9086,11 +9084,11 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x4350 = x4349 + x4346;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x4351 = x4350 + x4345;
-        host_args.at(0) = x4328;
-        host_args.at(1) = x4336;
-        host_args.at(2) = x4344;
-        host_args.at(3) = x4351;
-        host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x4328;
+        host_args[1] = x4336;
+        host_args[2] = x4344;
+        host_args[3] = x4351;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
   }
@@ -9098,19 +9096,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
     {
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4352 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x4352 != Fp::invalid());
+      if (kCheckRegs && x4352 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][5], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4353 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x4353 != Fp::invalid());
+      if (kCheckRegs && x4353 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][6], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4354 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x4354 != Fp::invalid());
+      if (kCheckRegs && x4354 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][7], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4355 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x4355 != Fp::invalid());
+      if (kCheckRegs && x4355 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][8], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4356 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x4356 != Fp::invalid());
+      if (kCheckRegs && x4356 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][9], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x4357 = args[3][0];
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -9227,19 +9225,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4413 = x4401 + x4409;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4414 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x4414 != Fp::invalid());
+      if (kCheckRegs && x4414 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][10], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4415 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x4415 != Fp::invalid());
+      if (kCheckRegs && x4415 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][11], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4416 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x4416 != Fp::invalid());
+      if (kCheckRegs && x4416 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][12], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4417 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x4417 != Fp::invalid());
+      if (kCheckRegs && x4417 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][13], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4418 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x4418 != Fp::invalid());
+      if (kCheckRegs && x4418 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4419 = x4357 * x4414;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9378,19 +9376,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4486 = x4485 + x4480;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4487 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x4487 != Fp::invalid());
+      if (kCheckRegs && x4487 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][15], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4488 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x4488 != Fp::invalid());
+      if (kCheckRegs && x4488 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][16], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4489 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x4489 != Fp::invalid());
+      if (kCheckRegs && x4489 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][17], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4490 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x4490 != Fp::invalid());
+      if (kCheckRegs && x4490 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][18], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4491 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x4491 != Fp::invalid());
+      if (kCheckRegs && x4491 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][19], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4492 = x4357 * x4487;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9529,19 +9527,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4559 = x4558 + x4553;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4560 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x4560 != Fp::invalid());
+      if (kCheckRegs && x4560 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4561 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x4561 != Fp::invalid());
+      if (kCheckRegs && x4561 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4562 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x4562 != Fp::invalid());
+      if (kCheckRegs && x4562 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4563 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x4563 != Fp::invalid());
+      if (kCheckRegs && x4563 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4564 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x4564 != Fp::invalid());
+      if (kCheckRegs && x4564 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4565 = x4357 * x4560;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9618,19 +9616,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4601 = x4593 + x4597;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4602 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x4602 != Fp::invalid());
+      if (kCheckRegs && x4602 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4603 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x4603 != Fp::invalid());
+      if (kCheckRegs && x4603 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4604 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x4604 != Fp::invalid());
+      if (kCheckRegs && x4604 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4605 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x4605 != Fp::invalid());
+      if (kCheckRegs && x4605 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4606 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x4606 != Fp::invalid());
+      if (kCheckRegs && x4606 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4607 = x4357 * x4602;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9769,19 +9767,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4674 = x4673 + x4668;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4675 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x4675 != Fp::invalid());
+      if (kCheckRegs && x4675 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4676 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x4676 != Fp::invalid());
+      if (kCheckRegs && x4676 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4677 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x4677 != Fp::invalid());
+      if (kCheckRegs && x4677 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4678 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x4678 != Fp::invalid());
+      if (kCheckRegs && x4678 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4679 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x4679 != Fp::invalid());
+      if (kCheckRegs && x4679 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4680 = x4357 * x4675;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9920,19 +9918,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4747 = x4746 + x4741;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4748 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x4748 != Fp::invalid());
+      if (kCheckRegs && x4748 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4749 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x4749 != Fp::invalid());
+      if (kCheckRegs && x4749 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4750 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x4750 != Fp::invalid());
+      if (kCheckRegs && x4750 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4751 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x4751 != Fp::invalid());
+      if (kCheckRegs && x4751 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4752 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x4752 != Fp::invalid());
+      if (kCheckRegs && x4752 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4753 = x4357 * x4748;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10009,19 +10007,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4789 = x4781 + x4785;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4790 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x4790 != Fp::invalid());
+      if (kCheckRegs && x4790 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4791 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x4791 != Fp::invalid());
+      if (kCheckRegs && x4791 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4792 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x4792 != Fp::invalid());
+      if (kCheckRegs && x4792 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4793 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x4793 != Fp::invalid());
+      if (kCheckRegs && x4793 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4794 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x4794 != Fp::invalid());
+      if (kCheckRegs && x4794 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4795 = x4357 * x4790;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10160,19 +10158,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4862 = x4861 + x4856;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4863 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x4863 != Fp::invalid());
+      if (kCheckRegs && x4863 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4864 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x4864 != Fp::invalid());
+      if (kCheckRegs && x4864 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4865 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x4865 != Fp::invalid());
+      if (kCheckRegs && x4865 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4866 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x4866 != Fp::invalid());
+      if (kCheckRegs && x4866 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4867 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x4867 != Fp::invalid());
+      if (kCheckRegs && x4867 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4868 = x4357 * x4863;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10311,19 +10309,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4935 = x4934 + x4929;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4936 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x4936 != Fp::invalid());
+      if (kCheckRegs && x4936 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][50], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4937 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x4937 != Fp::invalid());
+      if (kCheckRegs && x4937 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][51], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4938 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x4938 != Fp::invalid());
+      if (kCheckRegs && x4938 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][52], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4939 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x4939 != Fp::invalid());
+      if (kCheckRegs && x4939 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][53], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4940 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x4940 != Fp::invalid());
+      if (kCheckRegs && x4940 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4941 = x4357 * x4936;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10400,19 +10398,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4977 = x4969 + x4973;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x4978 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x4978 != Fp::invalid());
+      if (kCheckRegs && x4978 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][55], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4979 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x4979 != Fp::invalid());
+      if (kCheckRegs && x4979 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][56], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4980 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x4980 != Fp::invalid());
+      if (kCheckRegs && x4980 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][57], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4981 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x4981 != Fp::invalid());
+      if (kCheckRegs && x4981 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][58], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x4982 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x4982 != Fp::invalid());
+      if (kCheckRegs && x4982 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][59], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4983 = x4357 * x4978;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10551,19 +10549,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5050 = x5049 + x5044;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5051 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x5051 != Fp::invalid());
+      if (kCheckRegs && x5051 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][60], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5052 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x5052 != Fp::invalid());
+      if (kCheckRegs && x5052 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][61], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5053 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x5053 != Fp::invalid());
+      if (kCheckRegs && x5053 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][62], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5054 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x5054 != Fp::invalid());
+      if (kCheckRegs && x5054 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][63], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5055 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x5055 != Fp::invalid());
+      if (kCheckRegs && x5055 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5056 = x4357 * x5051;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10702,19 +10700,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5123 = x5122 + x5117;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5124 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x5124 != Fp::invalid());
+      if (kCheckRegs && x5124 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][65], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5125 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x5125 != Fp::invalid());
+      if (kCheckRegs && x5125 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][66], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5126 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x5126 != Fp::invalid());
+      if (kCheckRegs && x5126 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][67], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5127 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x5127 != Fp::invalid());
+      if (kCheckRegs && x5127 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][68], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5128 = args[2][69 * steps + ((cycle - 0) & mask)];
-      assert(x5128 != Fp::invalid());
+      if (kCheckRegs && x5128 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][69], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5129 = x4357 * x5124;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10791,19 +10789,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5165 = x5157 + x5161;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5166 = args[2][70 * steps + ((cycle - 0) & mask)];
-      assert(x5166 != Fp::invalid());
+      if (kCheckRegs && x5166 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][70], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5167 = args[2][71 * steps + ((cycle - 0) & mask)];
-      assert(x5167 != Fp::invalid());
+      if (kCheckRegs && x5167 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][71], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5168 = args[2][72 * steps + ((cycle - 0) & mask)];
-      assert(x5168 != Fp::invalid());
+      if (kCheckRegs && x5168 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][72], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5169 = args[2][73 * steps + ((cycle - 0) & mask)];
-      assert(x5169 != Fp::invalid());
+      if (kCheckRegs && x5169 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][73], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5170 = args[2][74 * steps + ((cycle - 0) & mask)];
-      assert(x5170 != Fp::invalid());
+      if (kCheckRegs && x5170 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][74], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5171 = x4357 * x5166;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10942,19 +10940,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5238 = x5237 + x5232;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5239 = args[2][75 * steps + ((cycle - 0) & mask)];
-      assert(x5239 != Fp::invalid());
+      if (kCheckRegs && x5239 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][75], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5240 = args[2][76 * steps + ((cycle - 0) & mask)];
-      assert(x5240 != Fp::invalid());
+      if (kCheckRegs && x5240 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][76], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5241 = args[2][77 * steps + ((cycle - 0) & mask)];
-      assert(x5241 != Fp::invalid());
+      if (kCheckRegs && x5241 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][77], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5242 = args[2][78 * steps + ((cycle - 0) & mask)];
-      assert(x5242 != Fp::invalid());
+      if (kCheckRegs && x5242 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][78], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5243 = args[2][79 * steps + ((cycle - 0) & mask)];
-      assert(x5243 != Fp::invalid());
+      if (kCheckRegs && x5243 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][79], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5244 = x4357 * x5239;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -11093,19 +11091,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5311 = x5310 + x5305;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5312 = args[2][80 * steps + ((cycle - 0) & mask)];
-      assert(x5312 != Fp::invalid());
+      if (kCheckRegs && x5312 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][80], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5313 = args[2][81 * steps + ((cycle - 0) & mask)];
-      assert(x5313 != Fp::invalid());
+      if (kCheckRegs && x5313 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][81], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5314 = args[2][82 * steps + ((cycle - 0) & mask)];
-      assert(x5314 != Fp::invalid());
+      if (kCheckRegs && x5314 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][82], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5315 = args[2][83 * steps + ((cycle - 0) & mask)];
-      assert(x5315 != Fp::invalid());
+      if (kCheckRegs && x5315 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][83], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5316 = args[2][84 * steps + ((cycle - 0) & mask)];
-      assert(x5316 != Fp::invalid());
+      if (kCheckRegs && x5316 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][84], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5317 = x4357 * x5312;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -11182,19 +11180,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5353 = x5345 + x5349;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5354 = args[2][85 * steps + ((cycle - 0) & mask)];
-      assert(x5354 != Fp::invalid());
+      if (kCheckRegs && x5354 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][85], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5355 = args[2][86 * steps + ((cycle - 0) & mask)];
-      assert(x5355 != Fp::invalid());
+      if (kCheckRegs && x5355 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][86], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5356 = args[2][87 * steps + ((cycle - 0) & mask)];
-      assert(x5356 != Fp::invalid());
+      if (kCheckRegs && x5356 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][87], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5357 = args[2][88 * steps + ((cycle - 0) & mask)];
-      assert(x5357 != Fp::invalid());
+      if (kCheckRegs && x5357 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][88], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5358 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x5358 != Fp::invalid());
+      if (kCheckRegs && x5358 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][89], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5359 = x4357 * x5354;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -11333,19 +11331,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5426 = x5425 + x5420;
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5427 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x5427 != Fp::invalid());
+      if (kCheckRegs && x5427 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5428 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x5428 != Fp::invalid());
+      if (kCheckRegs && x5428 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5429 = args[2][2 * steps + ((cycle - 0) & mask)];
-      assert(x5429 != Fp::invalid());
+      if (kCheckRegs && x5429 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5430 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x5430 != Fp::invalid());
+      if (kCheckRegs && x5430 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5431 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x5431 != Fp::invalid());
+      if (kCheckRegs && x5431 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5432 = x4357 * x5427;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12014,48 +12012,48 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5764 = x5763 + x5760;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x5765 = x5764 + x5759;
-      host_args.at(0) = x5742;
-      host_args.at(1) = x5750;
-      host_args.at(2) = x5758;
-      host_args.at(3) = x5765;
-      host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x5742;
+      host_args[1] = x5750;
+      host_args[2] = x5758;
+      host_args[3] = x5765;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x7 != 0) {
     {
-      host_args.at(0) = x2;
-      host_args.at(1) = x3;
-      host_args.at(2) = x3;
-      host_args.at(3) = x3;
-      host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x2;
+      host_args[1] = x3;
+      host_args[2] = x3;
+      host_args[3] = x3;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x8 != 0) {
     {
-      host_args.at(0) = x2;
-      host_args.at(1) = x3;
-      host_args.at(2) = x3;
-      host_args.at(3) = x3;
-      host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x2;
+      host_args[1] = x3;
+      host_args[2] = x3;
+      host_args[3] = x3;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x9 != 0) {
     {
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5766 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x5766 != Fp::invalid());
+      if (kCheckRegs && x5766 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][5], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5767 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x5767 != Fp::invalid());
+      if (kCheckRegs && x5767 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][6], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5768 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x5768 != Fp::invalid());
+      if (kCheckRegs && x5768 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][7], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5769 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x5769 != Fp::invalid());
+      if (kCheckRegs && x5769 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][8], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5770 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x5770 != Fp::invalid());
+      if (kCheckRegs && x5770 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][9], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x5771 = args[3][0];
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -12172,19 +12170,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5827 = x5815 + x5823;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5828 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x5828 != Fp::invalid());
+      if (kCheckRegs && x5828 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][10], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5829 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x5829 != Fp::invalid());
+      if (kCheckRegs && x5829 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][11], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5830 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x5830 != Fp::invalid());
+      if (kCheckRegs && x5830 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][12], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5831 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x5831 != Fp::invalid());
+      if (kCheckRegs && x5831 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][13], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5832 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x5832 != Fp::invalid());
+      if (kCheckRegs && x5832 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5833 = x5771 * x5828;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12323,19 +12321,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5900 = x5899 + x5894;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5901 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x5901 != Fp::invalid());
+      if (kCheckRegs && x5901 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][15], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5902 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x5902 != Fp::invalid());
+      if (kCheckRegs && x5902 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][16], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5903 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x5903 != Fp::invalid());
+      if (kCheckRegs && x5903 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][17], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5904 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x5904 != Fp::invalid());
+      if (kCheckRegs && x5904 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][18], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5905 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x5905 != Fp::invalid());
+      if (kCheckRegs && x5905 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][19], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5906 = x5771 * x5901;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12474,19 +12472,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5973 = x5972 + x5967;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x5974 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x5974 != Fp::invalid());
+      if (kCheckRegs && x5974 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5975 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x5975 != Fp::invalid());
+      if (kCheckRegs && x5975 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5976 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x5976 != Fp::invalid());
+      if (kCheckRegs && x5976 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5977 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x5977 != Fp::invalid());
+      if (kCheckRegs && x5977 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x5978 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x5978 != Fp::invalid());
+      if (kCheckRegs && x5978 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5979 = x5771 * x5974;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12563,19 +12561,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6015 = x6007 + x6011;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6016 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x6016 != Fp::invalid());
+      if (kCheckRegs && x6016 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6017 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x6017 != Fp::invalid());
+      if (kCheckRegs && x6017 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6018 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x6018 != Fp::invalid());
+      if (kCheckRegs && x6018 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6019 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x6019 != Fp::invalid());
+      if (kCheckRegs && x6019 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6020 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x6020 != Fp::invalid());
+      if (kCheckRegs && x6020 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6021 = x5771 * x6016;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12714,19 +12712,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6088 = x6087 + x6082;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6089 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x6089 != Fp::invalid());
+      if (kCheckRegs && x6089 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6090 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x6090 != Fp::invalid());
+      if (kCheckRegs && x6090 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6091 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x6091 != Fp::invalid());
+      if (kCheckRegs && x6091 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6092 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x6092 != Fp::invalid());
+      if (kCheckRegs && x6092 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6093 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x6093 != Fp::invalid());
+      if (kCheckRegs && x6093 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6094 = x5771 * x6089;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12865,19 +12863,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6161 = x6160 + x6155;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6162 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x6162 != Fp::invalid());
+      if (kCheckRegs && x6162 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6163 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x6163 != Fp::invalid());
+      if (kCheckRegs && x6163 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6164 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x6164 != Fp::invalid());
+      if (kCheckRegs && x6164 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6165 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x6165 != Fp::invalid());
+      if (kCheckRegs && x6165 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6166 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x6166 != Fp::invalid());
+      if (kCheckRegs && x6166 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6167 = x5771 * x6162;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12954,19 +12952,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6203 = x6195 + x6199;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6204 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x6204 != Fp::invalid());
+      if (kCheckRegs && x6204 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6205 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x6205 != Fp::invalid());
+      if (kCheckRegs && x6205 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6206 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x6206 != Fp::invalid());
+      if (kCheckRegs && x6206 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6207 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x6207 != Fp::invalid());
+      if (kCheckRegs && x6207 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6208 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x6208 != Fp::invalid());
+      if (kCheckRegs && x6208 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6209 = x5771 * x6204;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13105,19 +13103,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6276 = x6275 + x6270;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6277 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x6277 != Fp::invalid());
+      if (kCheckRegs && x6277 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6278 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x6278 != Fp::invalid());
+      if (kCheckRegs && x6278 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6279 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x6279 != Fp::invalid());
+      if (kCheckRegs && x6279 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6280 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x6280 != Fp::invalid());
+      if (kCheckRegs && x6280 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6281 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x6281 != Fp::invalid());
+      if (kCheckRegs && x6281 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6282 = x5771 * x6277;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13256,19 +13254,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6349 = x6348 + x6343;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6350 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x6350 != Fp::invalid());
+      if (kCheckRegs && x6350 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][50], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6351 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x6351 != Fp::invalid());
+      if (kCheckRegs && x6351 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][51], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6352 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x6352 != Fp::invalid());
+      if (kCheckRegs && x6352 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][52], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6353 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x6353 != Fp::invalid());
+      if (kCheckRegs && x6353 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][53], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6354 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x6354 != Fp::invalid());
+      if (kCheckRegs && x6354 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6355 = x5771 * x6350;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13345,19 +13343,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6391 = x6383 + x6387;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6392 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x6392 != Fp::invalid());
+      if (kCheckRegs && x6392 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][55], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6393 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x6393 != Fp::invalid());
+      if (kCheckRegs && x6393 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][56], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6394 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x6394 != Fp::invalid());
+      if (kCheckRegs && x6394 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][57], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6395 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x6395 != Fp::invalid());
+      if (kCheckRegs && x6395 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][58], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6396 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x6396 != Fp::invalid());
+      if (kCheckRegs && x6396 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][59], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6397 = x5771 * x6392;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13496,19 +13494,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6464 = x6463 + x6458;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6465 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x6465 != Fp::invalid());
+      if (kCheckRegs && x6465 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][60], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6466 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x6466 != Fp::invalid());
+      if (kCheckRegs && x6466 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][61], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6467 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x6467 != Fp::invalid());
+      if (kCheckRegs && x6467 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][62], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6468 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x6468 != Fp::invalid());
+      if (kCheckRegs && x6468 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][63], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6469 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x6469 != Fp::invalid());
+      if (kCheckRegs && x6469 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6470 = x5771 * x6465;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13647,19 +13645,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6537 = x6536 + x6531;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6538 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x6538 != Fp::invalid());
+      if (kCheckRegs && x6538 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][65], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6539 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x6539 != Fp::invalid());
+      if (kCheckRegs && x6539 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][66], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6540 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x6540 != Fp::invalid());
+      if (kCheckRegs && x6540 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][67], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6541 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x6541 != Fp::invalid());
+      if (kCheckRegs && x6541 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][68], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6542 = args[2][69 * steps + ((cycle - 0) & mask)];
-      assert(x6542 != Fp::invalid());
+      if (kCheckRegs && x6542 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][69], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6543 = x5771 * x6538;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13736,19 +13734,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6579 = x6571 + x6575;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6580 = args[2][70 * steps + ((cycle - 0) & mask)];
-      assert(x6580 != Fp::invalid());
+      if (kCheckRegs && x6580 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][70], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6581 = args[2][71 * steps + ((cycle - 0) & mask)];
-      assert(x6581 != Fp::invalid());
+      if (kCheckRegs && x6581 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][71], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6582 = args[2][72 * steps + ((cycle - 0) & mask)];
-      assert(x6582 != Fp::invalid());
+      if (kCheckRegs && x6582 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][72], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6583 = args[2][73 * steps + ((cycle - 0) & mask)];
-      assert(x6583 != Fp::invalid());
+      if (kCheckRegs && x6583 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][73], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6584 = args[2][74 * steps + ((cycle - 0) & mask)];
-      assert(x6584 != Fp::invalid());
+      if (kCheckRegs && x6584 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][74], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6585 = x5771 * x6580;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13887,19 +13885,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6652 = x6651 + x6646;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6653 = args[2][75 * steps + ((cycle - 0) & mask)];
-      assert(x6653 != Fp::invalid());
+      if (kCheckRegs && x6653 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][75], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6654 = args[2][76 * steps + ((cycle - 0) & mask)];
-      assert(x6654 != Fp::invalid());
+      if (kCheckRegs && x6654 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][76], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6655 = args[2][77 * steps + ((cycle - 0) & mask)];
-      assert(x6655 != Fp::invalid());
+      if (kCheckRegs && x6655 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][77], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6656 = args[2][78 * steps + ((cycle - 0) & mask)];
-      assert(x6656 != Fp::invalid());
+      if (kCheckRegs && x6656 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][78], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6657 = args[2][79 * steps + ((cycle - 0) & mask)];
-      assert(x6657 != Fp::invalid());
+      if (kCheckRegs && x6657 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][79], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6658 = x5771 * x6653;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14038,19 +14036,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6725 = x6724 + x6719;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6726 = args[2][80 * steps + ((cycle - 0) & mask)];
-      assert(x6726 != Fp::invalid());
+      if (kCheckRegs && x6726 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][80], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6727 = args[2][81 * steps + ((cycle - 0) & mask)];
-      assert(x6727 != Fp::invalid());
+      if (kCheckRegs && x6727 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][81], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6728 = args[2][82 * steps + ((cycle - 0) & mask)];
-      assert(x6728 != Fp::invalid());
+      if (kCheckRegs && x6728 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][82], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6729 = args[2][83 * steps + ((cycle - 0) & mask)];
-      assert(x6729 != Fp::invalid());
+      if (kCheckRegs && x6729 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][83], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6730 = args[2][84 * steps + ((cycle - 0) & mask)];
-      assert(x6730 != Fp::invalid());
+      if (kCheckRegs && x6730 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][84], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6731 = x5771 * x6726;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14127,19 +14125,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6767 = x6759 + x6763;
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6768 = args[2][85 * steps + ((cycle - 0) & mask)];
-      assert(x6768 != Fp::invalid());
+      if (kCheckRegs && x6768 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][85], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6769 = args[2][86 * steps + ((cycle - 0) & mask)];
-      assert(x6769 != Fp::invalid());
+      if (kCheckRegs && x6769 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][86], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6770 = args[2][87 * steps + ((cycle - 0) & mask)];
-      assert(x6770 != Fp::invalid());
+      if (kCheckRegs && x6770 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][87], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6771 = args[2][88 * steps + ((cycle - 0) & mask)];
-      assert(x6771 != Fp::invalid());
+      if (kCheckRegs && x6771 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][88], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6772 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x6772 != Fp::invalid());
+      if (kCheckRegs && x6772 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][89], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6773 = x5771 * x6768;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14278,19 +14276,19 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6840 = x6839 + x6834;
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x6841 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x6841 != Fp::invalid());
+      if (kCheckRegs && x6841 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6842 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x6842 != Fp::invalid());
+      if (kCheckRegs && x6842 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6843 = args[2][2 * steps + ((cycle - 0) & mask)];
-      assert(x6843 != Fp::invalid());
+      if (kCheckRegs && x6843 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6844 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x6844 != Fp::invalid());
+      if (kCheckRegs && x6844 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x6845 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x6845 != Fp::invalid());
+      if (kCheckRegs && x6845 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6846 = x5771 * x6841;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14959,15 +14957,15 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7178 = x7177 + x7174;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x7179 = x7178 + x7173;
-      host_args.at(0) = x7156;
-      host_args.at(1) = x7164;
-      host_args.at(2) = x7172;
-      host_args.at(3) = x7179;
-      host(ctx, "plonkWriteAccum", "wom", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x7156;
+      host_args[1] = x7164;
+      host_args[2] = x7172;
+      host_args[3] = x7179;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraWom, "wom", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   return x3;
 }
 
-} // namespace risc0::circuit::recursion
+} // namespace risc0::circuit::recursion::RISC0_STEP_VARIANT
 // clang-format on
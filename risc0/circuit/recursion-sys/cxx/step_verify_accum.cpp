@@ -12,24 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "ffi.h"
 #include "fp.h"
 
 #include <array>
-#include <cassert>
-#include <stdexcept>
 
 // clang-format off
-namespace risc0::circuit::recursion {
+namespace risc0::circuit::recursion::RISC0_STEP_VARIANT {
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
-Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args) {
+Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err) {
   size_t mask = steps - 1;
   std::array<Fp, 96> host_args;
   std::array<Fp, 32> host_outs;
@@ -43,22 +41,22 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   Fp x3(0);
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/micro_ops(Reg)"("./zirgen/components/mux.h":49:0))
   auto x4 = args[0][1 * steps + ((cycle - 0) & mask)];
-  assert(x4 != Fp::invalid());
+  if (kCheckRegs && x4 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/micro_ops(Reg) (args[0][1], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/macro_ops(Reg)"("./zirgen/components/mux.h":49:0))
   auto x5 = args[0][2 * steps + ((cycle - 0) & mask)];
-  assert(x5 != Fp::invalid());
+  if (kCheckRegs && x5 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/macro_ops(Reg) (args[0][2], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_load(Reg)"("./zirgen/components/mux.h":49:0))
   auto x6 = args[0][3 * steps + ((cycle - 0) & mask)];
-  assert(x6 != Fp::invalid());
+  if (kCheckRegs && x6 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_load(Reg) (args[0][3], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_full(Reg)"("./zirgen/components/mux.h":49:0))
   auto x7 = args[0][4 * steps + ((cycle - 0) & mask)];
-  assert(x7 != Fp::invalid());
+  if (kCheckRegs && x7 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_full(Reg) (args[0][4], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_partial(Reg)"("./zirgen/components/mux.h":49:0))
   auto x8 = args[0][5 * steps + ((cycle - 0) & mask)];
-  assert(x8 != Fp::invalid());
+  if (kCheckRegs && x8 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_partial(Reg) (args[0][5], back 0)");
   // loc("top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_store(Reg)"("./zirgen/components/mux.h":49:0))
   auto x9 = args[0][6 * steps + ((cycle - 0) & mask)];
-  assert(x9 != Fp::invalid());
+  if (kCheckRegs && x9 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/code(recursion::Code)/select(OneHot)/poseidon_store(Reg) (args[0][6], back 0)");
   if (x4 != 0) {
     // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
     auto x10 = args[3][0];
@@ -102,19 +100,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x29 = args[3][19];
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x30 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x30 != Fp::invalid());
+    if (kCheckRegs && x30 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x31 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x31 != Fp::invalid());
+    if (kCheckRegs && x31 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x32 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x32 != Fp::invalid());
+    if (kCheckRegs && x32 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x33 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x33 != Fp::invalid());
+    if (kCheckRegs && x33 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x34 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x34 != Fp::invalid());
+    if (kCheckRegs && x34 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x35 = x10 * x30;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -191,19 +189,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x71 = x63 + x67;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x72 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x72 != Fp::invalid());
+    if (kCheckRegs && x72 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x73 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x73 != Fp::invalid());
+    if (kCheckRegs && x73 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x74 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x74 != Fp::invalid());
+    if (kCheckRegs && x74 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x75 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x75 != Fp::invalid());
+    if (kCheckRegs && x75 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x76 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x76 != Fp::invalid());
+    if (kCheckRegs && x76 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x77 = x10 * x72;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -342,19 +340,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x144 = x143 + x138;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x145 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x145 != Fp::invalid());
+    if (kCheckRegs && x145 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x146 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x146 != Fp::invalid());
+    if (kCheckRegs && x146 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x147 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x147 != Fp::invalid());
+    if (kCheckRegs && x147 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x148 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x148 != Fp::invalid());
+    if (kCheckRegs && x148 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x149 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x149 != Fp::invalid());
+    if (kCheckRegs && x149 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x150 = x10 * x145;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -493,19 +491,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x217 = x216 + x211;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x218 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x218 != Fp::invalid());
+    if (kCheckRegs && x218 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x219 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x219 != Fp::invalid());
+    if (kCheckRegs && x219 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x220 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x220 != Fp::invalid());
+    if (kCheckRegs && x220 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x221 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x221 != Fp::invalid());
+    if (kCheckRegs && x221 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x222 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x222 != Fp::invalid());
+    if (kCheckRegs && x222 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x223 = x10 * x218;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -582,19 +580,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x259 = x251 + x255;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x260 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x260 != Fp::invalid());
+    if (kCheckRegs && x260 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x261 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x261 != Fp::invalid());
+    if (kCheckRegs && x261 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x262 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x262 != Fp::invalid());
+    if (kCheckRegs && x262 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x263 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x263 != Fp::invalid());
+    if (kCheckRegs && x263 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x264 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x264 != Fp::invalid());
+    if (kCheckRegs && x264 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x265 = x10 * x260;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -733,19 +731,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x332 = x331 + x326;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x333 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x333 != Fp::invalid());
+    if (kCheckRegs && x333 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x334 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x334 != Fp::invalid());
+    if (kCheckRegs && x334 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x335 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x335 != Fp::invalid());
+    if (kCheckRegs && x335 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x336 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x336 != Fp::invalid());
+    if (kCheckRegs && x336 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x337 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x337 != Fp::invalid());
+    if (kCheckRegs && x337 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x338 = x10 * x333;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -884,19 +882,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x405 = x404 + x399;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x406 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x406 != Fp::invalid());
+    if (kCheckRegs && x406 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][65], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x407 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x407 != Fp::invalid());
+    if (kCheckRegs && x407 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][66], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x408 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x408 != Fp::invalid());
+    if (kCheckRegs && x408 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][67], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x409 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x409 != Fp::invalid());
+    if (kCheckRegs && x409 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][68], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x410 = args[2][69 * steps + ((cycle - 0) & mask)];
-    assert(x410 != Fp::invalid());
+    if (kCheckRegs && x410 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][69], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x411 = x10 * x406;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -973,19 +971,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x447 = x439 + x443;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x448 = args[2][70 * steps + ((cycle - 0) & mask)];
-    assert(x448 != Fp::invalid());
+    if (kCheckRegs && x448 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][70], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x449 = args[2][71 * steps + ((cycle - 0) & mask)];
-    assert(x449 != Fp::invalid());
+    if (kCheckRegs && x449 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][71], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x450 = args[2][72 * steps + ((cycle - 0) & mask)];
-    assert(x450 != Fp::invalid());
+    if (kCheckRegs && x450 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][72], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x451 = args[2][73 * steps + ((cycle - 0) & mask)];
-    assert(x451 != Fp::invalid());
+    if (kCheckRegs && x451 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][73], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x452 = args[2][74 * steps + ((cycle - 0) & mask)];
-    assert(x452 != Fp::invalid());
+    if (kCheckRegs && x452 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][74], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x453 = x10 * x448;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1124,19 +1122,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x520 = x519 + x514;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x521 = args[2][75 * steps + ((cycle - 0) & mask)];
-    assert(x521 != Fp::invalid());
+    if (kCheckRegs && x521 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][75], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x522 = args[2][76 * steps + ((cycle - 0) & mask)];
-    assert(x522 != Fp::invalid());
+    if (kCheckRegs && x522 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][76], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x523 = args[2][77 * steps + ((cycle - 0) & mask)];
-    assert(x523 != Fp::invalid());
+    if (kCheckRegs && x523 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][77], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x524 = args[2][78 * steps + ((cycle - 0) & mask)];
-    assert(x524 != Fp::invalid());
+    if (kCheckRegs && x524 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][78], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x525 = args[2][79 * steps + ((cycle - 0) & mask)];
-    assert(x525 != Fp::invalid());
+    if (kCheckRegs && x525 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][79], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x526 = x10 * x521;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1275,19 +1273,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x593 = x592 + x587;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x594 = args[2][80 * steps + ((cycle - 0) & mask)];
-    assert(x594 != Fp::invalid());
+    if (kCheckRegs && x594 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][80], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x595 = args[2][81 * steps + ((cycle - 0) & mask)];
-    assert(x595 != Fp::invalid());
+    if (kCheckRegs && x595 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][81], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x596 = args[2][82 * steps + ((cycle - 0) & mask)];
-    assert(x596 != Fp::invalid());
+    if (kCheckRegs && x596 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][82], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x597 = args[2][83 * steps + ((cycle - 0) & mask)];
-    assert(x597 != Fp::invalid());
+    if (kCheckRegs && x597 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][83], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x598 = args[2][84 * steps + ((cycle - 0) & mask)];
-    assert(x598 != Fp::invalid());
+    if (kCheckRegs && x598 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][84], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x599 = x10 * x594;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1364,19 +1362,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x635 = x627 + x631;
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x636 = args[2][85 * steps + ((cycle - 0) & mask)];
-    assert(x636 != Fp::invalid());
+    if (kCheckRegs && x636 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][85], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x637 = args[2][86 * steps + ((cycle - 0) & mask)];
-    assert(x637 != Fp::invalid());
+    if (kCheckRegs && x637 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][86], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x638 = args[2][87 * steps + ((cycle - 0) & mask)];
-    assert(x638 != Fp::invalid());
+    if (kCheckRegs && x638 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][87], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x639 = args[2][88 * steps + ((cycle - 0) & mask)];
-    assert(x639 != Fp::invalid());
+    if (kCheckRegs && x639 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][88], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x640 = args[2][89 * steps + ((cycle - 0) & mask)];
-    assert(x640 != Fp::invalid());
+    if (kCheckRegs && x640 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/micro_ops(recursion::MicroOps)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][89], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x641 = x10 * x636;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1515,19 +1513,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x708 = x707 + x702;
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x709 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x709 != Fp::invalid());
+    if (kCheckRegs && x709 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x710 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x710 != Fp::invalid());
+    if (kCheckRegs && x710 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x711 = args[2][2 * steps + ((cycle - 0) & mask)];
-    assert(x711 != Fp::invalid());
+    if (kCheckRegs && x711 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x712 = args[2][3 * steps + ((cycle - 0) & mask)];
-    assert(x712 != Fp::invalid());
+    if (kCheckRegs && x712 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x713 = args[2][4 * steps + ((cycle - 0) & mask)];
-    assert(x713 != Fp::invalid());
+    if (kCheckRegs && x713 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x714 = x10 * x709;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1665,33 +1663,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x781 = x780 + x775;
     {
-      host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-      auto x782 = host_outs.at(0);
-      auto x783 = host_outs.at(1);
-      auto x784 = host_outs.at(2);
-      auto x785 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x782 = host_outs[0];
+      auto x783 = host_outs[1];
+      auto x784 = host_outs[2];
+      auto x785 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x782);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x782) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x782;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x783);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x783) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x783;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x784);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x784) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x784;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x785);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x785) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x785;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -1895,25 +1893,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x861);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x861) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x861;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x869);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x869) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x869;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x877);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x877) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x877;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x884);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x884) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x884;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -2117,25 +2115,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x960);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x960) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x960;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x968);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x968) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x968;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x976);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x976) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x976;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x983);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x983) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x983;
       }
     }
@@ -2143,36 +2141,36 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   if (x5 != 0) {
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x984 = args[0][8 * steps + ((cycle - 0) & mask)];
-    assert(x984 != Fp::invalid());
+    if (kCheckRegs && x984 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][8], back 0)");
     if (x984 != 0) {
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x2;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x3;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x3;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x3;
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x985 = args[0][10 * steps + ((cycle - 0) & mask)];
-    assert(x985 != Fp::invalid());
+    if (kCheckRegs && x985 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][10], back 0)");
     if (x985 != 0) {
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x986 = args[3][0];
@@ -2216,19 +2214,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1005 = args[3][19];
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1006 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x1006 != Fp::invalid());
+      if (kCheckRegs && x1006 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1007 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x1007 != Fp::invalid());
+      if (kCheckRegs && x1007 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1008 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x1008 != Fp::invalid());
+      if (kCheckRegs && x1008 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1009 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x1009 != Fp::invalid());
+      if (kCheckRegs && x1009 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1010 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x1010 != Fp::invalid());
+      if (kCheckRegs && x1010 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_and_elem(recursion::BitAndElem)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1011 = x986 * x1006;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2305,19 +2303,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1047 = x1039 + x1043;
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1048 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x1048 != Fp::invalid());
+      if (kCheckRegs && x1048 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1049 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x1049 != Fp::invalid());
+      if (kCheckRegs && x1049 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1050 = args[2][2 * steps + ((cycle - 0) & mask)];
-      assert(x1050 != Fp::invalid());
+      if (kCheckRegs && x1050 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1051 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x1051 != Fp::invalid());
+      if (kCheckRegs && x1051 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1052 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x1052 != Fp::invalid());
+      if (kCheckRegs && x1052 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1053 = x986 * x1048;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2393,33 +2391,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1089 = x1081 + x1085;
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1090 = host_outs.at(0);
-        auto x1091 = host_outs.at(1);
-        auto x1092 = host_outs.at(2);
-        auto x1093 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1090 = host_outs[0];
+        auto x1091 = host_outs[1];
+        auto x1092 = host_outs[2];
+        auto x1093 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1090);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1090) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1090;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1091);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1091) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1091;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1092);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1092) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1092;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1093);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1093) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1093;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -2623,32 +2621,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][4 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1169);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1169) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
           reg = x1169;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][5 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1177);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1177) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
           reg = x1177;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][6 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1185);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1185) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
           reg = x1185;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][7 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1192);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1192) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
           reg = x1192;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1193 = args[0][11 * steps + ((cycle - 0) & mask)];
-    assert(x1193 != Fp::invalid());
+    if (kCheckRegs && x1193 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][11], back 0)");
     if (x1193 != 0) {
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x1194 = args[3][0];
@@ -2692,19 +2690,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1213 = args[3][19];
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1214 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x1214 != Fp::invalid());
+      if (kCheckRegs && x1214 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][21], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1215 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x1215 != Fp::invalid());
+      if (kCheckRegs && x1215 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][22], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1216 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x1216 != Fp::invalid());
+      if (kCheckRegs && x1216 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][23], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1217 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x1217 != Fp::invalid());
+      if (kCheckRegs && x1217 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][24], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1218 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x1218 != Fp::invalid());
+      if (kCheckRegs && x1218 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/bit_op_shorts(recursion::BitOpShorts)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][25], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1219 = x1194 * x1214;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2781,19 +2779,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1255 = x1247 + x1251;
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1256 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x1256 != Fp::invalid());
+      if (kCheckRegs && x1256 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1257 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x1257 != Fp::invalid());
+      if (kCheckRegs && x1257 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1258 = args[2][2 * steps + ((cycle - 0) & mask)];
-      assert(x1258 != Fp::invalid());
+      if (kCheckRegs && x1258 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1259 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x1259 != Fp::invalid());
+      if (kCheckRegs && x1259 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1260 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x1260 != Fp::invalid());
+      if (kCheckRegs && x1260 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1261 = x1194 * x1256;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2869,33 +2867,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1297 = x1289 + x1293;
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1298 = host_outs.at(0);
-        auto x1299 = host_outs.at(1);
-        auto x1300 = host_outs.at(2);
-        auto x1301 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1298 = host_outs[0];
+        auto x1299 = host_outs[1];
+        auto x1300 = host_outs[2];
+        auto x1301 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1298);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1298) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1298;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1299);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1299) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1299;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1300);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1300) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1300;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1301);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1301) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1301;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -3099,176 +3097,176 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][4 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1377);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1377) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
           reg = x1377;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][5 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1385);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1385) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
           reg = x1385;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][6 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1393);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1393) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
           reg = x1393;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][7 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1400);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1400) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
           reg = x1400;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1401 = args[0][12 * steps + ((cycle - 0) & mask)];
-    assert(x1401 != Fp::invalid());
+    if (kCheckRegs && x1401 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][12], back 0)");
     if (x1401 != 0) {
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1402 = host_outs.at(0);
-        auto x1403 = host_outs.at(1);
-        auto x1404 = host_outs.at(2);
-        auto x1405 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1402 = host_outs[0];
+        auto x1403 = host_outs[1];
+        auto x1404 = host_outs[2];
+        auto x1405 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1402);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1402) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1402;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1403);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1403) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1403;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1404);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1404) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1404;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1405);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1405) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1405;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1406 = args[0][13 * steps + ((cycle - 0) & mask)];
-    assert(x1406 != Fp::invalid());
+    if (kCheckRegs && x1406 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][13], back 0)");
     if (x1406 != 0) {
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1407 = host_outs.at(0);
-        auto x1408 = host_outs.at(1);
-        auto x1409 = host_outs.at(2);
-        auto x1410 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1407 = host_outs[0];
+        auto x1408 = host_outs[1];
+        auto x1409 = host_outs[2];
+        auto x1410 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1407);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1407) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1407;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1408);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1408) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1408;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1409);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1409) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1409;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1410);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1410) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1410;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1411 = args[0][14 * steps + ((cycle - 0) & mask)];
-    assert(x1411 != Fp::invalid());
+    if (kCheckRegs && x1411 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][14], back 0)");
     if (x1411 != 0) {
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1412 = host_outs.at(0);
-        auto x1413 = host_outs.at(1);
-        auto x1414 = host_outs.at(2);
-        auto x1415 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1412 = host_outs[0];
+        auto x1413 = host_outs[1];
+        auto x1414 = host_outs[2];
+        auto x1415 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1412);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1412) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1412;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1413);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1413) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1413;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1414);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1414) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1414;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1415);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1415) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1415;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1416 = args[0][15 * steps + ((cycle - 0) & mask)];
-    assert(x1416 != Fp::invalid());
+    if (kCheckRegs && x1416 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][15], back 0)");
     if (x1416 != 0) {
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1417 = host_outs.at(0);
-        auto x1418 = host_outs.at(1);
-        auto x1419 = host_outs.at(2);
-        auto x1420 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1417 = host_outs[0];
+        auto x1418 = host_outs[1];
+        auto x1419 = host_outs[2];
+        auto x1420 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1417);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1417) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1417;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1418);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1418) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1418;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1419);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1419) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1419;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1420);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1420) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1420;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x1421 = args[0][16 * steps + ((cycle - 0) & mask)];
-    assert(x1421 != Fp::invalid());
+    if (kCheckRegs && x1421 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[0][16], back 0)");
     if (x1421 != 0) {
       // loc("top(recursion::Top)/recursion::WomHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x1422 = args[3][0];
@@ -3312,19 +3310,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1441 = args[3][19];
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1442 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x1442 != Fp::invalid());
+      if (kCheckRegs && x1442 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1443 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x1443 != Fp::invalid());
+      if (kCheckRegs && x1443 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1444 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x1444 != Fp::invalid());
+      if (kCheckRegs && x1444 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1445 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x1445 != Fp::invalid());
+      if (kCheckRegs && x1445 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1446 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x1446 != Fp::invalid());
+      if (kCheckRegs && x1446 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1447 = x1422 * x1442;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -3401,19 +3399,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1483 = x1475 + x1479;
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1484 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x1484 != Fp::invalid());
+      if (kCheckRegs && x1484 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1485 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x1485 != Fp::invalid());
+      if (kCheckRegs && x1485 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1486 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x1486 != Fp::invalid());
+      if (kCheckRegs && x1486 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1487 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x1487 != Fp::invalid());
+      if (kCheckRegs && x1487 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1488 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x1488 != Fp::invalid());
+      if (kCheckRegs && x1488 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1489 = x1422 * x1484;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -3552,19 +3550,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1556 = x1555 + x1550;
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1557 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x1557 != Fp::invalid());
+      if (kCheckRegs && x1557 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1558 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x1558 != Fp::invalid());
+      if (kCheckRegs && x1558 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1559 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x1559 != Fp::invalid());
+      if (kCheckRegs && x1559 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1560 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x1560 != Fp::invalid());
+      if (kCheckRegs && x1560 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
       // loc("top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1561 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x1561 != Fp::invalid());
+      if (kCheckRegs && x1561 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/macro_ops(recursion::MacroOp)/mux(Mux)/set_global(recursion::SetGlobal)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1562 = x1422 * x1557;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -3641,19 +3639,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x1598 = x1590 + x1594;
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
       auto x1599 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x1599 != Fp::invalid());
+      if (kCheckRegs && x1599 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1600 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x1600 != Fp::invalid());
+      if (kCheckRegs && x1600 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1601 = args[2][2 * steps + ((cycle - 0) & mask)];
-      assert(x1601 != Fp::invalid());
+      if (kCheckRegs && x1601 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1602 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x1602 != Fp::invalid());
+      if (kCheckRegs && x1602 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
       // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
       auto x1603 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x1603 != Fp::invalid());
+      if (kCheckRegs && x1603 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1604 = x1422 * x1599;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -3791,33 +3789,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x1671 = x1670 + x1665;
       {
-        host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-        auto x1672 = host_outs.at(0);
-        auto x1673 = host_outs.at(1);
-        auto x1674 = host_outs.at(2);
-        auto x1675 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x1672 = host_outs[0];
+        auto x1673 = host_outs[1];
+        auto x1674 = host_outs[2];
+        auto x1675 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][0 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1672);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1672) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
           reg = x1672;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][1 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1673);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1673) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
           reg = x1673;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][2 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1674);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1674) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
           reg = x1674;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][3 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1675);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1675) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
           reg = x1675;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -4021,25 +4019,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][4 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1751);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1751) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
           reg = x1751;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][5 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1759);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1759) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
           reg = x1759;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][6 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1767);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1767) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
           reg = x1767;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][7 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x1774);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x1774) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
           reg = x1774;
         }
       }
@@ -4088,19 +4086,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1794 = args[3][19];
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x1795 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x1795 != Fp::invalid());
+    if (kCheckRegs && x1795 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1796 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x1796 != Fp::invalid());
+    if (kCheckRegs && x1796 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1797 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x1797 != Fp::invalid());
+    if (kCheckRegs && x1797 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1798 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x1798 != Fp::invalid());
+    if (kCheckRegs && x1798 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1799 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x1799 != Fp::invalid());
+    if (kCheckRegs && x1799 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1800 = x1775 * x1795;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4177,19 +4175,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1836 = x1828 + x1832;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x1837 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x1837 != Fp::invalid());
+    if (kCheckRegs && x1837 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1838 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x1838 != Fp::invalid());
+    if (kCheckRegs && x1838 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1839 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x1839 != Fp::invalid());
+    if (kCheckRegs && x1839 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1840 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x1840 != Fp::invalid());
+    if (kCheckRegs && x1840 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1841 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x1841 != Fp::invalid());
+    if (kCheckRegs && x1841 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1842 = x1775 * x1837;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4328,19 +4326,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1909 = x1908 + x1903;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x1910 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x1910 != Fp::invalid());
+    if (kCheckRegs && x1910 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1911 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x1911 != Fp::invalid());
+    if (kCheckRegs && x1911 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1912 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x1912 != Fp::invalid());
+    if (kCheckRegs && x1912 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1913 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x1913 != Fp::invalid());
+    if (kCheckRegs && x1913 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1914 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x1914 != Fp::invalid());
+    if (kCheckRegs && x1914 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1915 = x1775 * x1910;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4479,19 +4477,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1982 = x1981 + x1976;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x1983 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x1983 != Fp::invalid());
+    if (kCheckRegs && x1983 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1984 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x1984 != Fp::invalid());
+    if (kCheckRegs && x1984 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1985 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x1985 != Fp::invalid());
+    if (kCheckRegs && x1985 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1986 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x1986 != Fp::invalid());
+    if (kCheckRegs && x1986 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x1987 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x1987 != Fp::invalid());
+    if (kCheckRegs && x1987 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1988 = x1775 * x1983;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4568,19 +4566,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2024 = x2016 + x2020;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2025 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x2025 != Fp::invalid());
+    if (kCheckRegs && x2025 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2026 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x2026 != Fp::invalid());
+    if (kCheckRegs && x2026 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2027 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x2027 != Fp::invalid());
+    if (kCheckRegs && x2027 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2028 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x2028 != Fp::invalid());
+    if (kCheckRegs && x2028 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2029 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x2029 != Fp::invalid());
+    if (kCheckRegs && x2029 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2030 = x1775 * x2025;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4719,19 +4717,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2097 = x2096 + x2091;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2098 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x2098 != Fp::invalid());
+    if (kCheckRegs && x2098 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2099 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x2099 != Fp::invalid());
+    if (kCheckRegs && x2099 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2100 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x2100 != Fp::invalid());
+    if (kCheckRegs && x2100 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2101 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x2101 != Fp::invalid());
+    if (kCheckRegs && x2101 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2102 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x2102 != Fp::invalid());
+    if (kCheckRegs && x2102 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2103 = x1775 * x2098;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4870,19 +4868,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2170 = x2169 + x2164;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2171 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x2171 != Fp::invalid());
+    if (kCheckRegs && x2171 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][65], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2172 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x2172 != Fp::invalid());
+    if (kCheckRegs && x2172 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][66], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2173 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x2173 != Fp::invalid());
+    if (kCheckRegs && x2173 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][67], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2174 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x2174 != Fp::invalid());
+    if (kCheckRegs && x2174 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][68], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2175 = args[2][69 * steps + ((cycle - 0) & mask)];
-    assert(x2175 != Fp::invalid());
+    if (kCheckRegs && x2175 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][69], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2176 = x1775 * x2171;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4959,19 +4957,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2212 = x2204 + x2208;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2213 = args[2][70 * steps + ((cycle - 0) & mask)];
-    assert(x2213 != Fp::invalid());
+    if (kCheckRegs && x2213 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][70], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2214 = args[2][71 * steps + ((cycle - 0) & mask)];
-    assert(x2214 != Fp::invalid());
+    if (kCheckRegs && x2214 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][71], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2215 = args[2][72 * steps + ((cycle - 0) & mask)];
-    assert(x2215 != Fp::invalid());
+    if (kCheckRegs && x2215 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][72], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2216 = args[2][73 * steps + ((cycle - 0) & mask)];
-    assert(x2216 != Fp::invalid());
+    if (kCheckRegs && x2216 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][73], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2217 = args[2][74 * steps + ((cycle - 0) & mask)];
-    assert(x2217 != Fp::invalid());
+    if (kCheckRegs && x2217 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][74], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2218 = x1775 * x2213;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5110,19 +5108,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2285 = x2284 + x2279;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2286 = args[2][75 * steps + ((cycle - 0) & mask)];
-    assert(x2286 != Fp::invalid());
+    if (kCheckRegs && x2286 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][75], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2287 = args[2][76 * steps + ((cycle - 0) & mask)];
-    assert(x2287 != Fp::invalid());
+    if (kCheckRegs && x2287 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][76], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2288 = args[2][77 * steps + ((cycle - 0) & mask)];
-    assert(x2288 != Fp::invalid());
+    if (kCheckRegs && x2288 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][77], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2289 = args[2][78 * steps + ((cycle - 0) & mask)];
-    assert(x2289 != Fp::invalid());
+    if (kCheckRegs && x2289 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][78], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2290 = args[2][79 * steps + ((cycle - 0) & mask)];
-    assert(x2290 != Fp::invalid());
+    if (kCheckRegs && x2290 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][79], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2291 = x1775 * x2286;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5261,19 +5259,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2358 = x2357 + x2352;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2359 = args[2][80 * steps + ((cycle - 0) & mask)];
-    assert(x2359 != Fp::invalid());
+    if (kCheckRegs && x2359 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][80], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2360 = args[2][81 * steps + ((cycle - 0) & mask)];
-    assert(x2360 != Fp::invalid());
+    if (kCheckRegs && x2360 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][81], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2361 = args[2][82 * steps + ((cycle - 0) & mask)];
-    assert(x2361 != Fp::invalid());
+    if (kCheckRegs && x2361 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][82], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2362 = args[2][83 * steps + ((cycle - 0) & mask)];
-    assert(x2362 != Fp::invalid());
+    if (kCheckRegs && x2362 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][83], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2363 = args[2][84 * steps + ((cycle - 0) & mask)];
-    assert(x2363 != Fp::invalid());
+    if (kCheckRegs && x2363 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][84], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2364 = x1775 * x2359;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5350,19 +5348,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2400 = x2392 + x2396;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2401 = args[2][85 * steps + ((cycle - 0) & mask)];
-    assert(x2401 != Fp::invalid());
+    if (kCheckRegs && x2401 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][85], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2402 = args[2][86 * steps + ((cycle - 0) & mask)];
-    assert(x2402 != Fp::invalid());
+    if (kCheckRegs && x2402 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][86], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2403 = args[2][87 * steps + ((cycle - 0) & mask)];
-    assert(x2403 != Fp::invalid());
+    if (kCheckRegs && x2403 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][87], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2404 = args[2][88 * steps + ((cycle - 0) & mask)];
-    assert(x2404 != Fp::invalid());
+    if (kCheckRegs && x2404 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][88], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2405 = args[2][89 * steps + ((cycle - 0) & mask)];
-    assert(x2405 != Fp::invalid());
+    if (kCheckRegs && x2405 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_load(recursion::PoseidonLoad)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][89], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2406 = x1775 * x2401;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5501,19 +5499,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2473 = x2472 + x2467;
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2474 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x2474 != Fp::invalid());
+    if (kCheckRegs && x2474 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2475 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x2475 != Fp::invalid());
+    if (kCheckRegs && x2475 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2476 = args[2][2 * steps + ((cycle - 0) & mask)];
-    assert(x2476 != Fp::invalid());
+    if (kCheckRegs && x2476 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2477 = args[2][3 * steps + ((cycle - 0) & mask)];
-    assert(x2477 != Fp::invalid());
+    if (kCheckRegs && x2477 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2478 = args[2][4 * steps + ((cycle - 0) & mask)];
-    assert(x2478 != Fp::invalid());
+    if (kCheckRegs && x2478 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2479 = x1775 * x2474;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5651,33 +5649,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x2546 = x2545 + x2540;
     {
-      host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-      auto x2547 = host_outs.at(0);
-      auto x2548 = host_outs.at(1);
-      auto x2549 = host_outs.at(2);
-      auto x2550 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x2547 = host_outs[0];
+      auto x2548 = host_outs[1];
+      auto x2549 = host_outs[2];
+      auto x2550 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2547);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2547) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x2547;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2548);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2548) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x2548;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2549);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2549) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x2549;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2550);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2550) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x2550;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -5881,25 +5879,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2626);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2626) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x2626;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2634);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2634) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x2634;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2642);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2642) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x2642;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2649);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2649) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x2649;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -6103,91 +6101,91 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2725);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2725) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x2725;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2733);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2733) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x2733;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2741);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2741) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x2741;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2748);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2748) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x2748;
       }
     }
   }
   if (x7 != 0) {
     {
-      host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-      auto x2749 = host_outs.at(0);
-      auto x2750 = host_outs.at(1);
-      auto x2751 = host_outs.at(2);
-      auto x2752 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x2749 = host_outs[0];
+      auto x2750 = host_outs[1];
+      auto x2751 = host_outs[2];
+      auto x2752 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2749);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2749) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x2749;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2750);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2750) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x2750;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2751);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2751) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x2751;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2752);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2752) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x2752;
       }
     }
   }
   if (x8 != 0) {
     {
-      host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-      auto x2753 = host_outs.at(0);
-      auto x2754 = host_outs.at(1);
-      auto x2755 = host_outs.at(2);
-      auto x2756 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x2753 = host_outs[0];
+      auto x2754 = host_outs[1];
+      auto x2755 = host_outs[2];
+      auto x2756 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2753);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2753) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x2753;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2754);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2754) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x2754;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2755);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2755) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x2755;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2756);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2756) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x2756;
       }
     }
@@ -6235,19 +6233,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2776 = args[3][19];
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2777 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x2777 != Fp::invalid());
+    if (kCheckRegs && x2777 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][20], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2778 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x2778 != Fp::invalid());
+    if (kCheckRegs && x2778 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][21], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2779 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x2779 != Fp::invalid());
+    if (kCheckRegs && x2779 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][22], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2780 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x2780 != Fp::invalid());
+    if (kCheckRegs && x2780 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][23], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2781 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x2781 != Fp::invalid());
+    if (kCheckRegs && x2781 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2782 = x2757 * x2777;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6324,19 +6322,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2818 = x2810 + x2814;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2819 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x2819 != Fp::invalid());
+    if (kCheckRegs && x2819 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][25], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2820 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x2820 != Fp::invalid());
+    if (kCheckRegs && x2820 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][26], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2821 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x2821 != Fp::invalid());
+    if (kCheckRegs && x2821 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][27], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2822 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x2822 != Fp::invalid());
+    if (kCheckRegs && x2822 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][28], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2823 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x2823 != Fp::invalid());
+    if (kCheckRegs && x2823 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][29], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2824 = x2757 * x2819;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6475,19 +6473,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2891 = x2890 + x2885;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2892 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x2892 != Fp::invalid());
+    if (kCheckRegs && x2892 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][30], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2893 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x2893 != Fp::invalid());
+    if (kCheckRegs && x2893 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][31], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2894 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x2894 != Fp::invalid());
+    if (kCheckRegs && x2894 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][32], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2895 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x2895 != Fp::invalid());
+    if (kCheckRegs && x2895 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][33], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2896 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x2896 != Fp::invalid());
+    if (kCheckRegs && x2896 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2897 = x2757 * x2892;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6626,19 +6624,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2964 = x2963 + x2958;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x2965 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x2965 != Fp::invalid());
+    if (kCheckRegs && x2965 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][35], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2966 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x2966 != Fp::invalid());
+    if (kCheckRegs && x2966 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][36], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2967 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x2967 != Fp::invalid());
+    if (kCheckRegs && x2967 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][37], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2968 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x2968 != Fp::invalid());
+    if (kCheckRegs && x2968 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][38], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x2969 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x2969 != Fp::invalid());
+    if (kCheckRegs && x2969 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][39], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2970 = x2757 * x2965;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6715,19 +6713,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3006 = x2998 + x3002;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3007 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x3007 != Fp::invalid());
+    if (kCheckRegs && x3007 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][40], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3008 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x3008 != Fp::invalid());
+    if (kCheckRegs && x3008 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][41], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3009 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x3009 != Fp::invalid());
+    if (kCheckRegs && x3009 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][42], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3010 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x3010 != Fp::invalid());
+    if (kCheckRegs && x3010 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][43], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3011 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x3011 != Fp::invalid());
+    if (kCheckRegs && x3011 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3012 = x2757 * x3007;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6866,19 +6864,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3079 = x3078 + x3073;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3080 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x3080 != Fp::invalid());
+    if (kCheckRegs && x3080 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][45], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3081 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x3081 != Fp::invalid());
+    if (kCheckRegs && x3081 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][46], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3082 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x3082 != Fp::invalid());
+    if (kCheckRegs && x3082 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][47], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3083 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x3083 != Fp::invalid());
+    if (kCheckRegs && x3083 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][48], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3084 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x3084 != Fp::invalid());
+    if (kCheckRegs && x3084 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][49], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3085 = x2757 * x3080;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7017,19 +7015,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3152 = x3151 + x3146;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3153 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x3153 != Fp::invalid());
+    if (kCheckRegs && x3153 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][65], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3154 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x3154 != Fp::invalid());
+    if (kCheckRegs && x3154 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][66], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3155 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x3155 != Fp::invalid());
+    if (kCheckRegs && x3155 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][67], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3156 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x3156 != Fp::invalid());
+    if (kCheckRegs && x3156 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][68], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3157 = args[2][69 * steps + ((cycle - 0) & mask)];
-    assert(x3157 != Fp::invalid());
+    if (kCheckRegs && x3157 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][69], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3158 = x2757 * x3153;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7106,19 +7104,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3194 = x3186 + x3190;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3195 = args[2][70 * steps + ((cycle - 0) & mask)];
-    assert(x3195 != Fp::invalid());
+    if (kCheckRegs && x3195 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][70], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3196 = args[2][71 * steps + ((cycle - 0) & mask)];
-    assert(x3196 != Fp::invalid());
+    if (kCheckRegs && x3196 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][71], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3197 = args[2][72 * steps + ((cycle - 0) & mask)];
-    assert(x3197 != Fp::invalid());
+    if (kCheckRegs && x3197 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][72], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3198 = args[2][73 * steps + ((cycle - 0) & mask)];
-    assert(x3198 != Fp::invalid());
+    if (kCheckRegs && x3198 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][73], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3199 = args[2][74 * steps + ((cycle - 0) & mask)];
-    assert(x3199 != Fp::invalid());
+    if (kCheckRegs && x3199 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][74], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3200 = x2757 * x3195;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7257,19 +7255,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3267 = x3266 + x3261;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3268 = args[2][75 * steps + ((cycle - 0) & mask)];
-    assert(x3268 != Fp::invalid());
+    if (kCheckRegs && x3268 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][75], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3269 = args[2][76 * steps + ((cycle - 0) & mask)];
-    assert(x3269 != Fp::invalid());
+    if (kCheckRegs && x3269 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][76], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3270 = args[2][77 * steps + ((cycle - 0) & mask)];
-    assert(x3270 != Fp::invalid());
+    if (kCheckRegs && x3270 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][77], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3271 = args[2][78 * steps + ((cycle - 0) & mask)];
-    assert(x3271 != Fp::invalid());
+    if (kCheckRegs && x3271 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][78], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3272 = args[2][79 * steps + ((cycle - 0) & mask)];
-    assert(x3272 != Fp::invalid());
+    if (kCheckRegs && x3272 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][79], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3273 = x2757 * x3268;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7408,19 +7406,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3340 = x3339 + x3334;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3341 = args[2][80 * steps + ((cycle - 0) & mask)];
-    assert(x3341 != Fp::invalid());
+    if (kCheckRegs && x3341 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][80], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3342 = args[2][81 * steps + ((cycle - 0) & mask)];
-    assert(x3342 != Fp::invalid());
+    if (kCheckRegs && x3342 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][81], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3343 = args[2][82 * steps + ((cycle - 0) & mask)];
-    assert(x3343 != Fp::invalid());
+    if (kCheckRegs && x3343 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][82], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3344 = args[2][83 * steps + ((cycle - 0) & mask)];
-    assert(x3344 != Fp::invalid());
+    if (kCheckRegs && x3344 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][83], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3345 = args[2][84 * steps + ((cycle - 0) & mask)];
-    assert(x3345 != Fp::invalid());
+    if (kCheckRegs && x3345 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][84], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3346 = x2757 * x3341;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7497,19 +7495,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3382 = x3374 + x3378;
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3383 = args[2][85 * steps + ((cycle - 0) & mask)];
-    assert(x3383 != Fp::invalid());
+    if (kCheckRegs && x3383 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/addr(Reg) (args[2][85], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3384 = args[2][86 * steps + ((cycle - 0) & mask)];
-    assert(x3384 != Fp::invalid());
+    if (kCheckRegs && x3384 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][86], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3385 = args[2][87 * steps + ((cycle - 0) & mask)];
-    assert(x3385 != Fp::invalid());
+    if (kCheckRegs && x3385 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][87], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3386 = args[2][88 * steps + ((cycle - 0) & mask)];
-    assert(x3386 != Fp::invalid());
+    if (kCheckRegs && x3386 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][88], back 0)");
     // loc("top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3387 = args[2][89 * steps + ((cycle - 0) & mask)];
-    assert(x3387 != Fp::invalid());
+    if (kCheckRegs && x3387 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/mux(Mux)/poseidon_store(recursion::PoseidonStore)/wom_body(recursion::WomBody)/plonk_body(PlonkBody)/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][89], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3388 = x2757 * x3383;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7648,19 +7646,19 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3455 = x3454 + x3449;
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg)"("zirgen/circuit/recursion/wom.cpp":22:0))
     auto x3456 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x3456 != Fp::invalid());
+    if (kCheckRegs && x3456 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/addr(Reg) (args[2][0], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3457 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x3457 != Fp::invalid());
+    if (kCheckRegs && x3457 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[0](Reg) (args[2][1], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3458 = args[2][2 * steps + ((cycle - 0) & mask)];
-    assert(x3458 != Fp::invalid());
+    if (kCheckRegs && x3458 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[1](Reg) (args[2][2], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3459 = args[2][3 * steps + ((cycle - 0) & mask)];
-    assert(x3459 != Fp::invalid());
+    if (kCheckRegs && x3459 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[2](Reg) (args[2][3], back 0)");
     // loc("top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg)"("zirgen/circuit/recursion/wom.cpp":42:0))
     auto x3460 = args[2][4 * steps + ((cycle - 0) & mask)];
-    assert(x3460 != Fp::invalid());
+    if (kCheckRegs && x3460 == Fp::invalid()) return stepFailed(err, "read of unset register top(recursion::Top)/recursion::WomHeader/recursion::impl::WomPlonkElement/data[3](Reg) (args[2][4], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3461 = x2757 * x3456;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7798,33 +7796,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x3528 = x3527 + x3522;
     {
-      host(ctx, "plonkReadAccum", "wom", host_args.data(), 0, host_outs.data(), 4);
-      auto x3529 = host_outs.at(0);
-      auto x3530 = host_outs.at(1);
-      auto x3531 = host_outs.at(2);
-      auto x3532 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraWom, "wom", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x3529 = host_outs[0];
+      auto x3530 = host_outs[1];
+      auto x3531 = host_outs[2];
+      auto x3532 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3529);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3529) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x3529;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3530);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3530) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x3530;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3531);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3531) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x3531;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3532);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3532) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x3532;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -8028,25 +8026,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3608);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3608) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x3608;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3616);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3616) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x3616;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3624);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3624) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x3624;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3631);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3631) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x3631;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -8250,25 +8248,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3707);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3707) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x3707;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3715);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3715) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x3715;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3723);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3723) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x3723;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3730);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3730) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x3730;
       }
     }
@@ -8276,5 +8274,5 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   return x3;
 }
 
-} // namespace risc0::circuit::recursion
+} // namespace risc0::circuit::recursion::RISC0_STEP_VARIANT
 // clang-format on
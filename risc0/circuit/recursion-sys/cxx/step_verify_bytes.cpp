@@ -12,24 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "ffi.h"
 #include "fp.h"
 
 #include <array>
-#include <cassert>
-#include <stdexcept>
 
 // clang-format off
-namespace risc0::circuit::recursion {
+namespace risc0::circuit::recursion::RISC0_STEP_VARIANT {
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
-Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args) {
+Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err) {
   size_t mask = steps - 1;
   std::array<Fp, 96> host_args;
   std::array<Fp, 32> host_outs;
@@ -38,5 +36,5 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   return x0;
 }
 
-} // namespace risc0::circuit::recursion
+} // namespace risc0::circuit::recursion::RISC0_STEP_VARIANT
 // clang-format on
@@ -22,6 +22,7 @@ use risc0_core::field::baby_bear::{BabyBearElem, BabyBearExtElem};
 
 pub type Callback = unsafe extern "C" fn(
     ctx: *mut c_void,
+    cycle: usize,
     name: *const c_char,
     extra: *const c_char,
     args_ptr: *const BabyBearElem,
@@ -30,6 +31,39 @@ pub type Callback = unsafe extern "C" fn(
     outs_len: usize,
 ) -> bool;
 
+pub type ExternCallback = unsafe extern "C" fn(
+    ctx: *mut c_void,
+    cycle: usize,
+    extra_id: u32,
+    extra: *const c_char,
+    args_ptr: *const BabyBearElem,
+    args_len: usize,
+    outs_ptr: *mut BabyBearElem,
+    outs_len: usize,
+) -> bool;
+
+/// Number of extern ids known to the generated code; see `ExternId` in
+/// `cxx/ffi.h`.
+pub const EXTERN_COUNT: usize = 21;
+
+/// Number of powers of `poly_mix`, starting at `poly_mix^0`, that the
+/// `poly_fp` functions read; see `kPolyMixPows` in `cxx/ffi.h`.
+pub const POLY_MIX_POWS: usize = 1141;
+
+/// Plonk kinds are interned by the generated code as these extra ids; see
+/// `ExtraId` in `cxx/ffi.h`.
+const EXTRA_KINDS: [&str; 4] = ["", "bytes", "ram", "wom"];
+
+/// Dispatch table handed to the step functions.
+///
+/// Externs with an entry in `externs` are called by id; all others fall back to
+/// the string-keyed `callback`.
+#[repr(C)]
+pub struct HostTable {
+    pub callback: Callback,
+    pub externs: [Option<ExternCallback>; EXTERN_COUNT],
+}
+
 pub enum RawString {}
 
 #[repr(C)]
@@ -50,90 +84,221 @@ extern "C" {
 
     pub fn risc0_circuit_recursion_string_free(str: *const RawString);
 
+    /// Selects the checked build of the step functions, which fails a step on a
+    /// read of an unset register or a conflicting write instead of skipping
+    /// those checks.
+    pub fn risc0_circuit_recursion_set_checked(checked: bool);
+
+    /// Selects whether the step functions call the `log` externs.
+    pub fn risc0_circuit_recursion_set_log(enabled: bool);
+
     pub fn risc0_circuit_recursion_step_compute_accum(
         err: *mut RawError,
         ctx: *mut c_void,
-        cb: Callback,
+        table: *const HostTable,
         steps: usize,
         cycle: usize,
         args_ptr: *const *mut BabyBearElem,
         args_len: usize,
     ) -> BabyBearElem;
 
+    pub fn risc0_circuit_recursion_step_compute_accum_range(
+        err: *mut RawError,
+        ctx: *mut c_void,
+        table: *const HostTable,
+        steps: usize,
+        begin: usize,
+        end: usize,
+        args_ptr: *const *mut BabyBearElem,
+        args_len: usize,
+    ) -> BabyBearElem;
+
     pub fn risc0_circuit_recursion_step_verify_accum(
         err: *mut RawError,
         ctx: *mut c_void,
-        cb: Callback,
+        table: *const HostTable,
         steps: usize,
         cycle: usize,
         args_ptr: *const *mut BabyBearElem,
         args_len: usize,
     ) -> BabyBearElem;
 
+    pub fn risc0_circuit_recursion_step_verify_accum_range(
+        err: *mut RawError,
+        ctx: *mut c_void,
+        table: *const HostTable,
+        steps: usize,
+        begin: usize,
+        end: usize,
+        args_ptr: *const *mut BabyBearElem,
+        args_len: usize,
+    ) -> BabyBearElem;
+
     pub fn risc0_circuit_recursion_step_exec(
         err: *mut RawError,
         ctx: *mut c_void,
-        cb: Callback,
+        table: *const HostTable,
         steps: usize,
         cycle: usize,
         args_ptr: *const *mut BabyBearElem,
         args_len: usize,
     ) -> BabyBearElem;
 
+    pub fn risc0_circuit_recursion_step_exec_range(
+        err: *mut RawError,
+        ctx: *mut c_void,
+        table: *const HostTable,
+        steps: usize,
+        begin: usize,
+        end: usize,
+        args_ptr: *const *mut BabyBearElem,
+        args_len: usize,
+    ) -> BabyBearElem;
+
     pub fn risc0_circuit_recursion_step_verify_bytes(
         err: *mut RawError,
         ctx: *mut c_void,
-        cb: Callback,
+        table: *const HostTable,
         steps: usize,
         cycle: usize,
         args_ptr: *const *mut BabyBearElem,
         args_len: usize,
     ) -> BabyBearElem;
 
+    pub fn risc0_circuit_recursion_step_verify_bytes_range(
+        err: *mut RawError,
+        ctx: *mut c_void,
+        table: *const HostTable,
+        steps: usize,
+        begin: usize,
+        end: usize,
+        args_ptr: *const *mut BabyBearElem,
+        args_len: usize,
+    ) -> BabyBearElem;
+
     pub fn risc0_circuit_recursion_step_verify_mem(
         err: *mut RawError,
         ctx: *mut c_void,
-        cb: Callback,
+        table: *const HostTable,
         steps: usize,
         cycle: usize,
         args_ptr: *const *mut BabyBearElem,
         args_len: usize,
     ) -> BabyBearElem;
 
+    pub fn risc0_circuit_recursion_step_verify_mem_range(
+        err: *mut RawError,
+        ctx: *mut c_void,
+        table: *const HostTable,
+        steps: usize,
+        begin: usize,
+        end: usize,
+        args_ptr: *const *mut BabyBearElem,
+        args_len: usize,
+    ) -> BabyBearElem;
+
     pub fn risc0_circuit_recursion_poly_fp(
         cycle: usize,
         steps: usize,
-        poly_mix: *const BabyBearExtElem,
+        mix_pows: *const BabyBearExtElem,
         args_ptr: *const *const BabyBearElem,
         args_len: usize,
     ) -> BabyBearExtElem;
+
+    pub fn risc0_circuit_recursion_poly_fp_batch(
+        cycle: usize,
+        count: usize,
+        steps: usize,
+        mix_pows: *const BabyBearExtElem,
+        args: *const *const BabyBearElem,
+        out: *mut BabyBearExtElem,
+    );
 }
 
-pub fn get_trampoline<F>(_closure: &F) -> Callback
-where
-    F: FnMut(&str, &str, &[BabyBearElem], &mut [BabyBearElem]) -> bool,
-{
-    trampoline::<F>
+/// Receives the extern calls made by a step function.
+pub trait HostBridge {
+    /// Called for externs that are dispatched by name.
+    fn call(
+        &mut self,
+        cycle: usize,
+        name: &str,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> bool;
+
+    /// Called for externs that are dispatched by id.
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: u32,
+        extra_id: u32,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> bool;
+}
+
+macro_rules! extern_table {
+    ($host:ty; $($id:literal),*) => {
+        [$(Some(extern_trampoline::<$host, $id> as ExternCallback)),*]
+    };
 }
 
-extern "C" fn trampoline<F>(
+/// Builds the dispatch table for `H`.
+///
+/// When `typed` is false every extern falls back to [HostBridge::call].
+pub fn get_host_table<H: HostBridge>(_host: &H, typed: bool) -> HostTable {
+    let externs = if typed {
+        extern_table!(H; 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20)
+    } else {
+        [None; EXTERN_COUNT]
+    };
+    HostTable {
+        callback: trampoline::<H>,
+        externs,
+    }
+}
+
+extern "C" fn trampoline<H: HostBridge>(
     ctx: *mut c_void,
+    cycle: usize,
     name: *const c_char,
     extra: *const c_char,
     args_ptr: *const BabyBearElem,
     args_len: usize,
     outs_ptr: *mut BabyBearElem,
     outs_len: usize,
-) -> bool
-where
-    F: FnMut(&str, &str, &[BabyBearElem], &mut [BabyBearElem]) -> bool,
-{
+) -> bool {
     unsafe {
         let name = CStr::from_ptr(name).to_str().unwrap();
         let extra = CStr::from_ptr(extra).to_str().unwrap();
         let args = slice::from_raw_parts(args_ptr, args_len);
         let outs = slice::from_raw_parts_mut(outs_ptr, outs_len);
-        let callback = &mut *(ctx as *mut F);
-        callback(name, extra, args, outs)
+        let host = &mut *(ctx as *mut H);
+        host.call(cycle, name, extra, args, outs)
+    }
+}
+
+extern "C" fn extern_trampoline<H: HostBridge, const ID: u32>(
+    ctx: *mut c_void,
+    cycle: usize,
+    extra_id: u32,
+    extra: *const c_char,
+    args_ptr: *const BabyBearElem,
+    args_len: usize,
+    outs_ptr: *mut BabyBearElem,
+    outs_len: usize,
+) -> bool {
+    unsafe {
+        // Interned plonk kinds don't need to be decoded.
+        let extra = match EXTRA_KINDS.get(extra_id as usize) {
+            Some(kind) => *kind,
+            None => CStr::from_ptr(extra).to_str().unwrap(),
+        };
+        let args = slice::from_raw_parts(args_ptr, args_len);
+        let outs = slice::from_raw_parts_mut(outs_ptr, outs_len);
+        let host = &mut *(ctx as *mut H);
+        host.call_extern(cycle, ID, extra_id, extra, args, outs)
     }
 }
@@ -12,23 +12,57 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use core::ffi::{c_void, CStr};
+use core::{
+    ffi::{c_void, CStr},
+    ops::Range,
+};
 
 use anyhow::{anyhow, Result};
 use risc0_circuit_recursion_sys::ffi::{
-    get_trampoline, risc0_circuit_recursion_poly_fp, risc0_circuit_recursion_step_compute_accum,
-    risc0_circuit_recursion_step_exec, risc0_circuit_recursion_step_verify_accum,
-    risc0_circuit_recursion_step_verify_bytes, risc0_circuit_recursion_step_verify_mem,
-    risc0_circuit_recursion_string_free, risc0_circuit_recursion_string_ptr, Callback, RawError,
+    get_host_table, risc0_circuit_recursion_poly_fp, risc0_circuit_recursion_poly_fp_batch,
+    risc0_circuit_recursion_set_checked, risc0_circuit_recursion_set_log,
+    risc0_circuit_recursion_step_compute_accum, risc0_circuit_recursion_step_compute_accum_range,
+    risc0_circuit_recursion_step_exec, risc0_circuit_recursion_step_exec_range,
+    risc0_circuit_recursion_step_verify_accum, risc0_circuit_recursion_step_verify_accum_range,
+    risc0_circuit_recursion_step_verify_bytes, risc0_circuit_recursion_step_verify_bytes_range,
+    risc0_circuit_recursion_step_verify_mem, risc0_circuit_recursion_step_verify_mem_range,
+    risc0_circuit_recursion_string_free, risc0_circuit_recursion_string_ptr, HostBridge, HostTable,
+    RawError, POLY_MIX_POWS,
 };
 use risc0_zkp::{
-    adapter::{CircuitProveDef, CircuitStep, CircuitStepContext, CircuitStepHandler, PolyFp},
-    field::baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem},
+    adapter::{
+        CircuitProveDef, CircuitStep, CircuitStepContext, CircuitStepHandler, ExternId, ExtraId,
+        PolyFp,
+    },
+    field::{
+        baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem},
+        Elem,
+    },
     hal::cpu::SyncSlice,
 };
 
 use crate::CircuitImpl;
 
+/// Selects which build of the generated step functions runs.
+///
+/// The default build skips the register checks.  The checked build fails a
+/// step that reads an unset register or overwrites one with a different value,
+/// and names the register in the error, which helps to diagnose a misbehaving
+/// segment.  The setting applies to the whole process.
+pub fn set_checked_steps(checked: bool) {
+    unsafe { risc0_circuit_recursion_set_checked(checked) }
+}
+
+/// Selects whether the generated step functions call the `log` externs.
+///
+/// Those report the micro-ops the circuit runs and are only useful when
+/// tracing a misbehaving recursion program.  They are off by default, in which
+/// case the step functions skip them without packing their arguments or
+/// calling into the handler.  The setting applies to the whole process.
+pub fn set_log_externs(enabled: bool) {
+    unsafe { risc0_circuit_recursion_set_log(enabled) }
+}
+
 impl CircuitStep<BabyBearElem> for CircuitImpl {
     fn step_compute_accum<S: CircuitStepHandler<BabyBearElem>>(
         &self,
@@ -40,9 +74,9 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_recursion_step_compute_accum(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
                 )
             },
         )
@@ -58,9 +92,9 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_recursion_step_verify_accum(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
                 )
             },
         )
@@ -76,10 +110,8 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
-                risc0_circuit_recursion_step_exec(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
-                )
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
+                risc0_circuit_recursion_step_exec(err, ctx, table, size, cycle, args_ptr, args_len)
             },
         )
     }
@@ -94,9 +126,9 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_recursion_step_verify_bytes(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
                 )
             },
         )
@@ -112,9 +144,109 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_recursion_step_verify_mem(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_compute_accum_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_recursion_step_compute_accum_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_verify_accum_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_recursion_step_verify_accum_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_exec_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_recursion_step_exec_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_verify_bytes_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_recursion_step_verify_bytes_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_verify_mem_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_recursion_step_verify_mem_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
                 )
             },
         )
@@ -122,28 +254,112 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
 }
 
 impl PolyFp<BabyBear> for CircuitImpl {
+    fn poly_mix_pows(&self, mix: &BabyBearExtElem) -> Vec<BabyBearExtElem> {
+        let mut pow = BabyBearExtElem::ONE;
+        (0..POLY_MIX_POWS)
+            .map(|_| {
+                let cur = pow;
+                pow *= *mix;
+                cur
+            })
+            .collect()
+    }
+
     fn poly_fp(
         &self,
         cycle: usize,
         steps: usize,
-        mix: &BabyBearExtElem,
+        mix_pows: &[BabyBearExtElem],
         args: &[&[BabyBearElem]],
     ) -> BabyBearExtElem {
+        assert!(mix_pows.len() >= POLY_MIX_POWS);
         let args: Vec<*const BabyBearElem> = args.iter().map(|x| (*x).as_ptr()).collect();
         unsafe {
             risc0_circuit_recursion_poly_fp(
                 cycle,
                 steps,
-                mix as *const BabyBearExtElem,
+                mix_pows.as_ptr(),
                 args.as_ptr(),
                 args.len(),
             )
         }
     }
+
+    fn poly_fp_batch(
+        &self,
+        cycle: usize,
+        steps: usize,
+        mix_pows: &[BabyBearExtElem],
+        args: &[&[BabyBearElem]],
+        out: &mut [BabyBearExtElem],
+    ) {
+        assert!(mix_pows.len() >= POLY_MIX_POWS);
+        let args: Vec<*const BabyBearElem> = args.iter().map(|x| (*x).as_ptr()).collect();
+        unsafe {
+            risc0_circuit_recursion_poly_fp_batch(
+                cycle,
+                out.len(),
+                steps,
+                mix_pows.as_ptr(),
+                args.as_ptr(),
+                out.as_mut_ptr(),
+            )
+        }
+    }
 }
 
 impl CircuitProveDef<BabyBear> for CircuitImpl {}
 
+/// Forwards extern calls from a step function to a [CircuitStepHandler].
+struct StepBridge<'a, S> {
+    handler: &'a mut S,
+    last_err: Option<anyhow::Error>,
+}
+
+impl<'a, S> StepBridge<'a, S> {
+    fn check(&mut self, result: Result<()>) -> bool {
+        match result {
+            Ok(()) => true,
+            Err(err) => {
+                self.last_err = Some(err);
+                false
+            }
+        }
+    }
+}
+
+impl<'a, S: CircuitStepHandler<BabyBearElem>> HostBridge for StepBridge<'a, S> {
+    fn call(
+        &mut self,
+        cycle: usize,
+        name: &str,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> bool {
+        let result = self.handler.call(cycle, name, extra, args, outs);
+        self.check(result)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: u32,
+        extra_id: u32,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> bool {
+        let result = match ExternId::from_u32(id) {
+            Some(id) => self
+                .handler
+                .call_extern(cycle, id, ExtraId(extra_id), extra, args, outs),
+            None => Err(anyhow!("Unknown extern id: {id}")),
+        };
+        self.check(result)
+    }
+}
+
 pub(crate) fn call_step<S, F>(
     ctx: &CircuitStepContext,
     handler: &mut S,
@@ -155,37 +371,85 @@ where
     F: FnOnce(
         *mut RawError,
         *mut c_void,
-        Callback,
+        *const HostTable,
         usize,
         usize,
         *const *mut BabyBearElem,
         usize,
     ) -> BabyBearElem,
 {
-    let mut last_err = None;
-    let mut call =
-        |name: &str, extra: &str, args: &[BabyBearElem], outs: &mut [BabyBearElem]| match handler
-            .call(ctx.cycle, name, extra, args, outs)
-        {
-            Ok(()) => true,
-            Err(err) => {
-                last_err = Some(err);
-                false
-            }
-        };
-    let trampoline = get_trampoline(&call);
+    call_bridge(handler, args, |err, bridge, table, args_ptr, args_len| {
+        inner(err, bridge, table, ctx.size, ctx.cycle, args_ptr, args_len)
+    })
+}
+
+pub(crate) fn call_step_range<S, F>(
+    size: usize,
+    cycles: Range<usize>,
+    handler: &mut S,
+    args: &[SyncSlice<BabyBearElem>],
+    inner: F,
+) -> Result<BabyBearElem>
+where
+    S: CircuitStepHandler<BabyBearElem>,
+    F: FnOnce(
+        *mut RawError,
+        *mut c_void,
+        *const HostTable,
+        usize,
+        usize,
+        usize,
+        *const *mut BabyBearElem,
+        usize,
+    ) -> BabyBearElem,
+{
+    if cycles.is_empty() {
+        return Ok(BabyBearElem::ZERO);
+    }
+    call_bridge(handler, args, |err, bridge, table, args_ptr, args_len| {
+        inner(
+            err,
+            bridge,
+            table,
+            size,
+            cycles.start,
+            cycles.end,
+            args_ptr,
+            args_len,
+        )
+    })
+}
+
+fn call_bridge<S, F>(
+    handler: &mut S,
+    args: &[SyncSlice<BabyBearElem>],
+    inner: F,
+) -> Result<BabyBearElem>
+where
+    S: CircuitStepHandler<BabyBearElem>,
+    F: FnOnce(
+        *mut RawError,
+        *mut c_void,
+        *const HostTable,
+        *const *mut BabyBearElem,
+        usize,
+    ) -> BabyBearElem,
+{
+    let mut bridge = StepBridge {
+        handler,
+        last_err: None,
+    };
+    let table = get_host_table(&bridge, S::TYPED_EXTERNS);
     let mut err = RawError::default();
     let args: Vec<*mut BabyBearElem> = args.iter().map(SyncSlice::get_ptr).collect();
     let result = inner(
         &mut err,
-        &mut call as *mut _ as *mut c_void,
-        trampoline,
-        ctx.size,
-        ctx.cycle,
+        &mut bridge as *mut _ as *mut c_void,
+        &table,
         args.as_ptr(),
         args.len(),
     );
-    if let Some(err) = last_err {
+    if let Some(err) = bridge.last_err {
         return Err(err);
     }
     if err.msg.is_null() {
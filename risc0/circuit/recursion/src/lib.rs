@@ -30,6 +30,8 @@ mod taps;
 #[cfg(feature = "prove")]
 pub mod zkr;
 
+#[cfg(feature = "prove")]
+pub use cpp::{set_checked_steps, set_log_externs};
 use risc0_core::field::baby_bear::{BabyBearElem, BabyBearExtElem};
 use risc0_zkp::{
     adapter::{CircuitCoreDef, TapsProvider},
@@ -0,0 +1,281 @@
+#!/usr/bin/env python
+
+# Rewrites the C++ the circuit compiler emits into the sources under
+# <circuit>-sys/cxx.  Run it on a fresh compiler output after regenerating a
+# circuit, instead of editing poly_fp.cpp or the step_*.cpp files by hand:
+#
+#   python risc0/circuit/rewrite-cxx.py rv32im <compiler output dir>
+#
+# The compiler output uses exceptions, asserts and externs called by name.
+# The rewritten sources:
+#
+# - report failures through `stepFailed`/`hostFailed` and a status instead of
+#   throwing;
+# - call externs by `ExternId`, with an `ExtraId` for the extra argument.  The
+#   log formats are numbered from `kExtraFirstLog` in order of appearance;
+# - skip the log externs unless `logExterns` is set;
+# - are built twice, in the `fast` and `checked` namespaces, and only check
+#   register reads and writes when `kCheckRegs` is set;
+# - have `poly_fp` read the powers of poly_mix from the table the caller
+#   passes in, and evaluate it one row at a time or kFpVecLanes rows at once
+#   from the same template.
+#
+# The number of powers poly_fp reads is written to `kPolyMixPows` in
+# cxx/ffi.h and `POLY_MIX_POWS` in src/ffi.rs.
+
+import re
+import sys
+from pathlib import Path
+
+STEPS = [
+    'step_compute_accum',
+    'step_exec',
+    'step_verify_accum',
+    'step_verify_bytes',
+    'step_verify_mem',
+]
+
+GENERATED = '// This code is automatically generated'
+REWRITTEN = '// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.'
+
+EXTRA_IDS = {
+    '': 'kExtraNone',
+    'bytes': 'kExtraBytes',
+    'ram': 'kExtraRam',
+    'wom': 'kExtraWom',
+}
+FIRST_LOG_ID = 4
+
+LOC_NAMED_RE = re.compile(r'^\s*// loc\("([^"]*)"\("([^"]*)":(\d+):\d+\)\)$')
+LOC_RE = re.compile(r'^\s*// loc\("([^"]*)":(\d+):\d+\)$')
+READ_RE = re.compile(
+    r'^\s*auto (x\d+) = args\[(\d+)\]\[(\d+) \* steps \+ \(\(cycle - (\d+)\) & mask\)\];$')
+READ_CHECK_RE = re.compile(r'^(\s*)assert\((x\d+) != Fp::invalid\(\)\);$')
+WRITE_RE = re.compile(r'^\s*auto& reg = args\[(\d+)\]\[(\d+) \* steps \+ cycle\];$')
+WRITE_CHECK_RE = re.compile(r'^(\s*)assert\(reg == Fp::invalid\(\) \|\| reg == (x\d+)\);$')
+THROW_RE = re.compile(r'throw std::runtime_error\(("(?:[^"\\]|\\.)*")\);$')
+HOST_RE = re.compile(r'^(\s*)host\(ctx, "(\w+)", ("(?:[^"\\]|\\.)*"), (.*)\);$')
+HOST_ARG_RE = re.compile(r'^\s*host_args\[\d+\] = x\d+;$')
+AT_RE = re.compile(r'(host_args|host_outs)\.at\((\d+)\)')
+SIGNATURE_RE = re.compile(r'^(Fp step_\w+\(.*, Fp\*\* args)\) \{$')
+
+POLY_READ_RE = re.compile(
+    r'^(\s*)auto (x\d+) = args\[(\d+)\]\[(\d+) \* steps \+ \(\((cycle - kInvRate \* \d+)\) & mask\)\];$')
+MIX_INIT_RE = re.compile(r'^(\s*)MixState (x\d+)\{Fp4\(0\), Fp4\(1\)\};$')
+MIX_ADD_RE = re.compile(
+    r'^(\s*)MixState (x\d+)\{(x\d+)\.tot \+ \3\.mul \* (x\d+), \3\.mul \* \(\*mix\)\};$')
+MIX_AND_RE = re.compile(
+    r'^(\s*)MixState (x\d+)\{(x\d+)\.tot \+ (x\d+) \* (x\d+)\.tot \* \3\.mul, \3\.mul \* \5\.mul\};$')
+
+
+def fail(path, lineno, msg):
+    sys.exit(f'{path}:{lineno}: {msg}')
+
+
+def rewrite_header(lines, path):
+    if GENERATED not in lines:
+        fail(path, 0, 'not circuit compiler output')
+    lines[lines.index(GENERATED)] = REWRITTEN
+    return [line for line in lines if line not in ('#include <cassert>', '#include <stdexcept>')]
+
+
+def extern_id(name):
+    return 'ExternId::' + name[0].upper() + name[1:]
+
+
+class LogIds:
+    def __init__(self):
+        self.ids = {}
+
+    def get(self, fmt):
+        return self.ids.setdefault(fmt, FIRST_LOG_ID + len(self.ids))
+
+
+class RegChecks:
+    """Turns the asserts on register reads and writes into checks of the
+    checked build.  The fast build compiles them out through kCheckRegs.  A
+    failed check names the register, from the location comment the compiler
+    emits before the read or write."""
+
+    def __init__(self):
+        self.loc = None
+        self.reads = {}
+        self.write = None
+
+    def rewrite(self, line, path, lineno):
+        if m := LOC_NAMED_RE.match(line):
+            self.loc = (m[1], f'{m[2]}:{m[3]}')
+        elif m := LOC_RE.match(line):
+            self.loc = (None, f'{m[1]}:{m[2]}')
+        elif m := READ_RE.match(line):
+            name = self.loc[0] or self.loc[1]
+            self.reads[m[1]] = f'{name} (args[{m[2]}][{m[3]}], back {m[4]})'
+        elif m := READ_CHECK_RE.match(line):
+            if m[2] not in self.reads:
+                fail(path, lineno, f'check of {m[2]}, which is not a register read')
+            msg = f'read of unset register {self.reads[m[2]]}'
+            return f'{m[1]}if (kCheckRegs && {m[2]} == Fp::invalid()) return stepFailed(err, "{msg}");'
+        elif m := WRITE_RE.match(line):
+            self.write = f'conflicting write at {self.loc[1]} (args[{m[1]}][{m[2]}])'
+        elif m := WRITE_CHECK_RE.match(line):
+            if self.write is None:
+                fail(path, lineno, 'check of a write outside a register write')
+            msg, self.write = self.write, None
+            return (f'{m[1]}if (kCheckRegs && reg != Fp::invalid() && reg != {m[2]}) '
+                    f'return stepFailed(err, "{msg}");')
+        return None
+
+
+def rewrite_step(circuit, path, log_ids):
+    lines = rewrite_header(path.read_text().splitlines(), path)
+    namespace = f'namespace risc0::circuit::{circuit}'
+    out = []
+    reg_checks = RegChecks()
+    for lineno, line in enumerate(lines, 1):
+        line = AT_RE.sub(r'\1[\2]', line)
+
+        if line == namespace + ' {':
+            line = namespace + '::RISC0_STEP_VARIANT {'
+        elif line == '} // ' + namespace:
+            line += '::RISC0_STEP_VARIANT'
+        elif m := SIGNATURE_RE.match(line):
+            line = m[1] + ', const char** err) {'
+        elif checked := reg_checks.rewrite(line, path, lineno):
+            line = checked
+        elif m := THROW_RE.search(line):
+            line = line[:m.start()] + f'return stepFailed(err, {m[1]});'
+        elif m := HOST_RE.match(line):
+            indent, name, extra, rest = m[1], m[2], m[3], m[4]
+            if name == 'log':
+                extra_id = str(log_ids.get(extra))
+            elif extra[1:-1] in EXTRA_IDS:
+                extra_id = EXTRA_IDS[extra[1:-1]]
+            else:
+                fail(path, lineno, f'unknown extern argument {extra}')
+            call = f'if (!host(ctx, {extern_id(name)}, {extra_id}, {extra}, {rest})) return hostFailed(err);'
+            if name == 'log':
+                # Move the arguments of the call under the guard too.
+                args = []
+                while out and HOST_ARG_RE.match(out[-1]) and out[-1].startswith(indent + 'h'):
+                    args.insert(0, out.pop())
+                out.append(f'{indent}if (logs) {{')
+                out.extend('  ' + arg for arg in args)
+                out.append(f'{indent}  {call}')
+                out.append(f'{indent}}}')
+                continue
+            line = indent + call
+
+        if 'assert(' in line or 'throw ' in line or 'host(ctx, "' in line:
+            fail(path, lineno, f'unhandled line: {line.strip()}')
+        out.append(line)
+
+    if any('ExternId::Log' in line for line in out):
+        at = next(i for i, line in enumerate(out) if 'std::array<Fp, ' in line and 'host_outs' in line)
+        out.insert(at + 1, '  bool logs = logExterns.load(std::memory_order_relaxed);')
+    return out
+
+
+def rewrite_poly_fp(circuit, path):
+    lines = rewrite_header(path.read_text().splitlines(), path)
+    out = []
+    pows = {}
+    max_pow = 0
+    for lineno, line in enumerate(lines, 1):
+        if line == '#include "fp4.h"':
+            out.extend([line, '#include "fpvec.h"'])
+            continue
+        if line == 'struct MixState {':
+            out.extend([
+                '/// Reads the rows of one cycle.',
+                'struct OneRow {',
+                '  using Ext = Fp4;',
+                '',
+                '  static Fp load(const Fp* col, size_t row, size_t /*mask*/) { return col[row]; }',
+                '};',
+                '',
+                '/// Reads the rows of kFpVecLanes consecutive cycles.',
+                'struct LaneRows {',
+                '  using Ext = Fp4Vec<kFpVecLanes>;',
+                '',
+                '  static FpVec<kFpVecLanes> load(const Fp* col, size_t row, size_t mask) {',
+                '    return FpVec<kFpVecLanes>::loadRows(col, row, mask);',
+                '  }',
+                '};',
+                '',
+                'template <typename Rows> struct MixState {',
+                '  typename Rows::Ext tot;',
+            ])
+            continue
+        if line in ('  Fp4 tot;', '  Fp4 mul;'):
+            continue
+        if line == 'Fp4 poly_fp(size_t cycle, size_t steps, Fp4* mix, Fp** args) {':
+            out.extend([
+                'template <typename Rows>',
+                'typename Rows::Ext polyFp(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args) {',
+            ])
+            continue
+        if line == '}' and out[-1].startswith('  return '):
+            out.extend([
+                line,
+                '',
+                'Fp4 poly_fp(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args) {',
+                '  return polyFp<OneRow>(cycle, steps, mixPows, args);',
+                '}',
+                '',
+                'Fp4Vec<kFpVecLanes> poly_fp_batch(size_t cycle, size_t steps, const Fp4* mixPows, Fp** args) {',
+                '  return polyFp<LaneRows>(cycle, steps, mixPows, args);',
+                '}',
+            ])
+            continue
+
+        # A MixState's `mul` is always a power of poly_mix; track the exponent
+        # and read the power from the table instead.
+        if m := POLY_READ_RE.match(line):
+            line = f'{m[1]}auto {m[2]} = Rows::load(args[{m[3]}] + {m[4]} * steps, ({m[5]}) & mask, mask);'
+        elif m := MIX_INIT_RE.match(line):
+            pows[m[2]] = 0
+            line = f'{m[1]}MixState<Rows> {m[2]}{{Fp4(0)}};'
+        elif m := MIX_ADD_RE.match(line):
+            pow = pows[m[3]]
+            pows[m[2]] = pow + 1
+            max_pow = max(max_pow, pow)
+            line = f'{m[1]}MixState<Rows> {m[2]}{{{m[3]}.tot + mixPows[{pow}] * {m[4]}}};'
+        elif m := MIX_AND_RE.match(line):
+            pow = pows[m[3]]
+            pows[m[2]] = pow + pows[m[5]]
+            max_pow = max(max_pow, pow)
+            line = f'{m[1]}MixState<Rows> {m[2]}{{{m[3]}.tot + {m[4]} * {m[5]}.tot * mixPows[{pow}]}};'
+        elif 'MixState' in line or '(*mix)' in line:
+            fail(path, lineno, f'unhandled line: {line.strip()}')
+        out.append(line)
+    return out, max_pow + 1
+
+
+def replace_const(path, pattern, value):
+    text = path.read_text()
+    text, count = re.subn(pattern, lambda m: m[1] + str(value), text)
+    if count != 1:
+        sys.exit(f'{path}: expected one match of {pattern}')
+    path.write_text(text)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(f'usage: {sys.argv[0]} <circuit> <compiler output dir>')
+    circuit, generated = sys.argv[1], Path(sys.argv[2])
+    crate = Path(__file__).parent / f'{circuit}-sys'
+    cxx = crate / 'cxx'
+
+    log_ids = LogIds()
+    for step in STEPS:
+        out = rewrite_step(circuit, generated / f'{step}.cpp', log_ids)
+        (cxx / f'{step}.cpp').write_text('\n'.join(out) + '\n')
+
+    out, mix_pows = rewrite_poly_fp(circuit, generated / 'poly_fp.cpp')
+    (cxx / 'poly_fp.cpp').write_text('\n'.join(out) + '\n')
+    replace_const(cxx / 'ffi.h', r'(constexpr size_t kPolyMixPows = )\d+', mix_pows)
+    replace_const(crate / 'src' / 'ffi.rs', r'(pub const POLY_MIX_POWS: usize = )\d+', mix_pows)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,198 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ffi.h"
+#include "fp.h"
+#include "fp4.h"
+#include "fpvec.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace risc0;
+
+/// The taps of one row group: for each of its `cols` columns, the furthest back any tap reads.
+struct GroupBacks {
+  const uint32_t* back;
+  size_t cols;
+};
+
+namespace {
+
+constexpr size_t kInvRate = 4;
+
+// ROU_FWD[2], a primitive kInvRate-th root of unity.  For `x = ROU_FWD[po2 + 2]^cycle` we have
+// `x^steps = kRouInvRate^cycle`, so the zerofier only takes kInvRate distinct values.
+constexpr uint32_t kRouInvRate = 284861408;
+
+// Rows of a staged tile.  A power of two, so that poly_fp's `& mask` leaves tile rows alone.
+constexpr size_t kTileRows = 1024;
+
+// Tiling is only worth it when the halo leaves at least this many rows to evaluate in a tile.
+constexpr size_t kMinTileCycles = kTileRows / 2;
+
+constexpr size_t kNumArgs = 5;
+
+struct EvalCheckContext {
+  Fp* check;
+  Fp* args[kNumArgs];
+  const Fp4* mixPows;
+  size_t domain;
+  Fp zerofierInv[kInvRate];
+  // In tiled mode, the taps of the arguments that are row groups (and null for the globals).
+  const GroupBacks* backs[kNumArgs] = {};
+  bool tiled = false;
+  // Rows staged in front of the first cycle of a tile, enough for the furthest back tap.
+  size_t halo = 0;
+  // Number of cycles staged in a tile.
+  size_t tileCycles = 0;
+
+  void enableTiling(const GroupBacks* groups) {
+    if (domain <= kTileRows) {
+      return;
+    }
+    size_t maxBack = 0;
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t col = 0; col < groups[i].cols; col++) {
+        maxBack = std::max<size_t>(maxBack, groups[i].back[col]);
+      }
+    }
+    if (kInvRate * maxBack + kMinTileCycles > kTileRows) {
+      return;
+    }
+    // Same order as the CPU HAL passes code, data and accum to poly_fp.
+    backs[0] = &groups[0];
+    backs[2] = &groups[1];
+    backs[4] = &groups[2];
+    tiled = true;
+    halo = kInvRate * maxBack;
+    tileCycles = (kTileRows - halo) / kFpVecLanes * kFpVecLanes;
+  }
+
+  // Evaluates cycles [begin, end), reading cycle `c` from row `c - begin + first` of `rows`.
+  void evalChunk(Fp** rows, size_t rowsSteps, size_t first, size_t begin, size_t end) {
+    size_t cycle = begin;
+    for (; cycle + kFpVecLanes <= end; cycle += kFpVecLanes) {
+      Fp4Vec<kFpVecLanes> tot =
+          circuit::rv32im::poly_fp_batch(cycle - begin + first, rowsSteps, mixPows, rows);
+      for (size_t lane = 0; lane < kFpVecLanes; lane++) {
+        store(cycle + lane, tot.get(lane));
+      }
+    }
+    for (; cycle < end; cycle++) {
+      store(cycle, circuit::rv32im::poly_fp(cycle - begin + first, rowsSteps, mixPows, rows));
+    }
+  }
+
+  // Copies the rows that cycles [begin, end) read into column-major tiles of kTileRows rows, with
+  // cycle `begin` at row `halo`.  Each column only brings along the rows its own taps reach.
+  void stageTile(std::vector<Fp>* tiles, Fp** rows, size_t begin, size_t end) {
+    for (size_t arg = 0; arg < kNumArgs; arg++) {
+      if (!backs[arg]) {
+        rows[arg] = args[arg];
+        continue;
+      }
+      rows[arg] = tiles[arg].data();
+      const GroupBacks& group = *backs[arg];
+      for (size_t col = 0; col < group.cols; col++) {
+        size_t back = kInvRate * group.back[col];
+        size_t count = end - begin + back;
+        size_t src = (begin + domain - back) & (domain - 1);
+        const Fp* srcCol = args[arg] + col * domain;
+        Fp* dstCol = rows[arg] + col * kTileRows + halo - back;
+        size_t head = std::min(count, domain - src);
+        std::copy_n(srcCol + src, head, dstCol);
+        std::copy_n(srcCol, count - head, dstCol + head);
+      }
+    }
+  }
+
+  void store(size_t cycle, Fp4 tot) {
+    Fp4 ret = tot * zerofierInv[cycle % kInvRate];
+    for (size_t i = 0; i < 4; i++) {
+      check[i * domain + cycle] = ret.elems[i];
+    }
+  }
+
+  // Evaluates cycles [begin, end).
+  void run(size_t begin, size_t end) {
+    if (!tiled) {
+      evalChunk(args, domain, begin, begin, end);
+      return;
+    }
+    std::vector<Fp> tiles[kNumArgs];
+    Fp* rows[kNumArgs];
+    for (size_t arg = 0; arg < kNumArgs; arg++) {
+      if (backs[arg]) {
+        tiles[arg].resize(backs[arg]->cols * kTileRows);
+      }
+    }
+    for (size_t tile = begin; tile < end; tile += tileCycles) {
+      size_t tileEnd = std::min(tile + tileCycles, end);
+      stageTile(tiles, rows, tile, tileEnd);
+      evalChunk(rows, kTileRows, halo, tile, tileEnd);
+    }
+  }
+};
+
+} // namespace
+
+/// Evaluates the constraint polynomial divided by the zerofier over cycles [begin, end) of the
+/// `kInvRate * steps` domain, writing element `i` of row `cycle` to `check[i * domain + cycle]`.
+/// `mix_pows` holds the kPolyMixPows powers of poly_mix.
+///
+/// This runs on the calling thread only; the caller splits the domain between its own workers.
+///
+/// If `backs` (the taps of the code, data and accum groups, in that order) is given, large domains
+/// are evaluated tile by tile: the rows a tile of cycles reads are staged into a small
+/// column-major buffer first, so that the constraints are evaluated out of cache instead of
+/// striding across hundreds of `domain`-sized columns.
+extern "C" void risc0_circuit_rv32im_eval_check(Fp* check,
+                                                Fp* code,
+                                                Fp* data,
+                                                Fp* accum,
+                                                Fp* mix,
+                                                Fp* out,
+                                                const Fp4* mix_pows,
+                                                size_t po2,
+                                                size_t steps,
+                                                const GroupBacks* backs,
+                                                size_t begin,
+                                                size_t end) {
+  EvalCheckContext ctx;
+  ctx.check = check;
+  // Same order as the CPU HAL passes them to poly_fp.
+  ctx.args[0] = code;
+  ctx.args[1] = out;
+  ctx.args[2] = data;
+  ctx.args[3] = mix;
+  ctx.args[4] = accum;
+  ctx.mixPows = mix_pows;
+  ctx.domain = steps * kInvRate;
+
+  if (backs) {
+    ctx.enableTiling(backs);
+  }
+
+  // y = (3 * x)^steps = 3^steps * kRouInvRate^(cycle % kInvRate)
+  Fp threePow = pow(Fp(3), size_t(1) << po2);
+  Fp rouPow(1);
+  for (size_t k = 0; k < kInvRate; k++) {
+    ctx.zerofierInv[k] = inv(threePow * rouPow - Fp(1));
+    rouPow *= Fp(kRouInvRate);
+  }
+
+  ctx.run(begin, end);
+}
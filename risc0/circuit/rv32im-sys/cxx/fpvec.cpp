@@ -0,0 +1,85 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Element-wise entry points over Fp4, FpVec and Fp4Vec, so that the host can check them against its
+// own field implementation.
+
+#include "fpvec.h"
+
+#include <cstdint>
+
+using namespace risc0;
+
+using Vec = FpVec<kFpVecLanes>;
+using Vec4 = Fp4Vec<kFpVecLanes>;
+
+enum class FpVecOp : uint32_t {
+  Add = 0,
+  Sub = 1,
+  Mul = 2,
+  Neg = 3,
+};
+
+static Vec apply(FpVecOp op, Vec a, Vec b) {
+  switch (op) {
+  case FpVecOp::Add:
+    return a + b;
+  case FpVecOp::Sub:
+    return a - b;
+  case FpVecOp::Mul:
+    return a * b;
+  case FpVecOp::Neg:
+    return -a;
+  }
+  return Vec(Fp::invalid());
+}
+
+extern "C" size_t risc0_circuit_rv32im_fpvec_lanes() {
+  return kFpVecLanes;
+}
+
+/// Applies `op` to `count` elements of `a` and `b`.  `count` must be a multiple of the lane count.
+extern "C" void risc0_circuit_rv32im_fpvec_eltwise(
+    uint32_t op, Fp* out, const Fp* a, const Fp* b, size_t count) {
+  for (size_t i = 0; i < count; i += kFpVecLanes) {
+    apply(FpVecOp(op), Vec::load(a + i), Vec::load(b + i)).store(out + i);
+  }
+}
+
+/// Multiplies `count` elements of `a` and `b`, where the right hand side is either a vector of Fp4
+/// (`b4`) or of Fp (`b`).  `count` must be a multiple of the lane count.
+extern "C" void risc0_circuit_rv32im_fp4vec_mul(
+    Fp4* out, const Fp4* a, const Fp4* b4, const Fp* b, size_t count) {
+  for (size_t i = 0; i < count; i += kFpVecLanes) {
+    Vec4 lhs;
+    Vec4 rhs;
+    for (size_t j = 0; j < kFpVecLanes; j++) {
+      lhs.set(j, a[i + j]);
+      if (b4) {
+        rhs.set(j, b4[i + j]);
+      }
+    }
+    Vec4 result = b4 ? lhs * rhs : lhs * Vec::load(b + i);
+    for (size_t j = 0; j < kFpVecLanes; j++) {
+      out[i + j] = result.get(j);
+    }
+  }
+}
+
+/// Multiplies `count` elements of `a` and `b` with the scalar Fp4 multiply.
+extern "C" void risc0_circuit_rv32im_fp4_mul(Fp4* out, const Fp4* a, const Fp4* b, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    out[i] = a[i] * b[i];
+  }
+}
@@ -12,24 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "ffi.h"
 #include "fp.h"
 
 #include <array>
-#include <cassert>
-#include <stdexcept>
 
 // clang-format off
-namespace risc0::circuit::rv32im {
+namespace risc0::circuit::rv32im::RISC0_STEP_VARIANT {
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
-Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args) {
+Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err) {
   size_t mask = steps - 1;
   std::array<Fp, 96> host_args;
   std::array<Fp, 32> host_outs;
@@ -43,30 +41,30 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
   Fp x3(1);
   // loc("Top/Code/OneHot/hot[1](Reg)"("./zirgen/components/mux.h":49:0))
   auto x4 = args[0][2 * steps + ((cycle - 0) & mask)];
-  assert(x4 != Fp::invalid());
+  if (kCheckRegs && x4 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[1](Reg) (args[0][2], back 0)");
   // loc("Top/Code/OneHot/hot[3](Reg)"("./zirgen/components/mux.h":49:0))
   auto x5 = args[0][4 * steps + ((cycle - 0) & mask)];
-  assert(x5 != Fp::invalid());
+  if (kCheckRegs && x5 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[3](Reg) (args[0][4], back 0)");
   // loc("Top/Code/OneHot/hot[4](Reg)"("./zirgen/components/mux.h":49:0))
   auto x6 = args[0][5 * steps + ((cycle - 0) & mask)];
-  assert(x6 != Fp::invalid());
+  if (kCheckRegs && x6 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[4](Reg) (args[0][5], back 0)");
   // loc("Top/Code/OneHot/hot[5](Reg)"("./zirgen/components/mux.h":49:0))
   auto x7 = args[0][6 * steps + ((cycle - 0) & mask)];
-  assert(x7 != Fp::invalid());
+  if (kCheckRegs && x7 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[5](Reg) (args[0][6], back 0)");
   // loc("Top/Code/OneHot/hot[6](Reg)"("./zirgen/components/mux.h":49:0))
   auto x8 = args[0][7 * steps + ((cycle - 0) & mask)];
-  assert(x8 != Fp::invalid());
+  if (kCheckRegs && x8 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[6](Reg) (args[0][7], back 0)");
   // loc("Top/Code/OneHot/hot[2](Reg)"("zirgen/circuit/rv32im/top.cpp":78:0))
   auto x9 = args[0][3 * steps + ((cycle - 0) & mask)];
-  assert(x9 != Fp::invalid());
+  if (kCheckRegs && x9 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[2](Reg) (args[0][3], back 0)");
   if (x4 != 0) {
     {
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x10 != Fp::invalid());
+      if (kCheckRegs && x10 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][3], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x11 != Fp::invalid());
+      if (kCheckRegs && x11 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][4], back 0)");
       // loc("Top/BytesHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x12 = args[3][0];
       // loc("Top/BytesHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -111,10 +109,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x32 = x19 + x28;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x33 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x33 != Fp::invalid());
+      if (kCheckRegs && x33 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][5], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x34 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x34 != Fp::invalid());
+      if (kCheckRegs && x34 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][6], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x35 = x12 * x33;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -205,10 +203,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x78 = x77 + x72;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x79 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x79 != Fp::invalid());
+      if (kCheckRegs && x79 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][7], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x80 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x80 != Fp::invalid());
+      if (kCheckRegs && x80 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][8], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x81 = x12 * x79;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -299,10 +297,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x124 = x123 + x118;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x125 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x125 != Fp::invalid());
+      if (kCheckRegs && x125 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x126 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x126 != Fp::invalid());
+      if (kCheckRegs && x126 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x127 = x12 * x125;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -331,10 +329,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x139 = x130 + x135;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x140 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x140 != Fp::invalid());
+      if (kCheckRegs && x140 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x141 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x141 != Fp::invalid());
+      if (kCheckRegs && x141 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x142 = x12 * x140;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -425,10 +423,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x185 = x184 + x179;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x186 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x186 != Fp::invalid());
+      if (kCheckRegs && x186 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x187 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x187 != Fp::invalid());
+      if (kCheckRegs && x187 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x188 = x12 * x186;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -519,10 +517,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x231 = x230 + x225;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x232 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x232 != Fp::invalid());
+      if (kCheckRegs && x232 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x233 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x233 != Fp::invalid());
+      if (kCheckRegs && x233 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x234 = x12 * x232;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -551,10 +549,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x246 = x237 + x242;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x247 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x247 != Fp::invalid());
+      if (kCheckRegs && x247 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x248 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x248 != Fp::invalid());
+      if (kCheckRegs && x248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x249 = x12 * x247;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -645,10 +643,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x292 = x291 + x286;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x293 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x293 != Fp::invalid());
+      if (kCheckRegs && x293 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x294 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x294 != Fp::invalid());
+      if (kCheckRegs && x294 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x295 = x12 * x293;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -739,10 +737,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x338 = x337 + x332;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x339 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x339 != Fp::invalid());
+      if (kCheckRegs && x339 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x340 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x340 != Fp::invalid());
+      if (kCheckRegs && x340 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x341 = x12 * x339;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -771,10 +769,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x353 = x344 + x349;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x354 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x354 != Fp::invalid());
+      if (kCheckRegs && x354 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x355 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x355 != Fp::invalid());
+      if (kCheckRegs && x355 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x356 = x12 * x354;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -865,10 +863,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x399 = x398 + x393;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x400 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x400 != Fp::invalid());
+      if (kCheckRegs && x400 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x401 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x401 != Fp::invalid());
+      if (kCheckRegs && x401 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x402 = x12 * x400;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -959,10 +957,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x445 = x444 + x439;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x446 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x446 != Fp::invalid());
+      if (kCheckRegs && x446 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x447 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x447 != Fp::invalid());
+      if (kCheckRegs && x447 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x448 = x12 * x446;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -991,10 +989,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x460 = x451 + x456;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x461 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x461 != Fp::invalid());
+      if (kCheckRegs && x461 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x462 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x462 != Fp::invalid());
+      if (kCheckRegs && x462 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x463 = x12 * x461;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1085,10 +1083,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x506 = x505 + x500;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x507 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x507 != Fp::invalid());
+      if (kCheckRegs && x507 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x508 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x508 != Fp::invalid());
+      if (kCheckRegs && x508 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x509 = x12 * x507;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1179,10 +1177,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x552 = x551 + x546;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x553 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x553 != Fp::invalid());
+      if (kCheckRegs && x553 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x554 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x554 != Fp::invalid());
+      if (kCheckRegs && x554 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x555 = x12 * x553;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1211,10 +1209,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x567 = x558 + x563;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x568 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x568 != Fp::invalid());
+      if (kCheckRegs && x568 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x569 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x569 != Fp::invalid());
+      if (kCheckRegs && x569 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x570 = x12 * x568;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1305,10 +1303,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x613 = x612 + x607;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x614 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x614 != Fp::invalid());
+      if (kCheckRegs && x614 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x615 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x615 != Fp::invalid());
+      if (kCheckRegs && x615 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x616 = x12 * x614;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1399,10 +1397,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x659 = x658 + x653;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x660 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x660 != Fp::invalid());
+      if (kCheckRegs && x660 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x661 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x661 != Fp::invalid());
+      if (kCheckRegs && x661 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x662 = x12 * x660;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1431,10 +1429,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x674 = x665 + x670;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x675 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x675 != Fp::invalid());
+      if (kCheckRegs && x675 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x676 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x676 != Fp::invalid());
+      if (kCheckRegs && x676 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x677 = x12 * x675;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1525,10 +1523,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x720 = x719 + x714;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x721 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x721 != Fp::invalid());
+      if (kCheckRegs && x721 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x722 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x722 != Fp::invalid());
+      if (kCheckRegs && x722 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x723 = x12 * x721;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1619,10 +1617,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x766 = x765 + x760;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x767 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x767 != Fp::invalid());
+      if (kCheckRegs && x767 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x768 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x768 != Fp::invalid());
+      if (kCheckRegs && x768 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x769 = x12 * x767;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1651,10 +1649,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x781 = x772 + x777;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x782 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x782 != Fp::invalid());
+      if (kCheckRegs && x782 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x783 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x783 != Fp::invalid());
+      if (kCheckRegs && x783 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x784 = x12 * x782;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1745,10 +1743,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x827 = x826 + x821;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x828 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x828 != Fp::invalid());
+      if (kCheckRegs && x828 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x829 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x829 != Fp::invalid());
+      if (kCheckRegs && x829 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x830 = x12 * x828;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1839,10 +1837,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x873 = x872 + x867;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x874 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x874 != Fp::invalid());
+      if (kCheckRegs && x874 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x875 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x875 != Fp::invalid());
+      if (kCheckRegs && x875 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x876 = x12 * x874;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1871,10 +1869,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x888 = x879 + x884;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x889 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x889 != Fp::invalid());
+      if (kCheckRegs && x889 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x890 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x890 != Fp::invalid());
+      if (kCheckRegs && x890 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x891 = x12 * x889;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -1965,10 +1963,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x934 = x933 + x928;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x935 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x935 != Fp::invalid());
+      if (kCheckRegs && x935 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x936 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x936 != Fp::invalid());
+      if (kCheckRegs && x936 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x937 = x12 * x935;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2059,10 +2057,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x980 = x979 + x974;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x981 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x981 != Fp::invalid());
+      if (kCheckRegs && x981 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x982 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x982 != Fp::invalid());
+      if (kCheckRegs && x982 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x983 = x12 * x981;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2091,10 +2089,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x995 = x986 + x991;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x996 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x996 != Fp::invalid());
+      if (kCheckRegs && x996 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x997 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x997 != Fp::invalid());
+      if (kCheckRegs && x997 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x998 = x12 * x996;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2185,10 +2183,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1041 = x1040 + x1035;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1042 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x1042 != Fp::invalid());
+      if (kCheckRegs && x1042 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1043 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x1043 != Fp::invalid());
+      if (kCheckRegs && x1043 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1044 = x12 * x1042;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2279,10 +2277,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1087 = x1086 + x1081;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1088 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x1088 != Fp::invalid());
+      if (kCheckRegs && x1088 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1089 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x1089 != Fp::invalid());
+      if (kCheckRegs && x1089 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1090 = x12 * x1088;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2311,10 +2309,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1102 = x1093 + x1098;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1103 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x1103 != Fp::invalid());
+      if (kCheckRegs && x1103 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1104 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x1104 != Fp::invalid());
+      if (kCheckRegs && x1104 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1105 = x12 * x1103;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2405,10 +2403,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1148 = x1147 + x1142;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1149 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x1149 != Fp::invalid());
+      if (kCheckRegs && x1149 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1150 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x1150 != Fp::invalid());
+      if (kCheckRegs && x1150 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1151 = x12 * x1149;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2499,10 +2497,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1194 = x1193 + x1188;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1195 = args[2][69 * steps + ((cycle - 0) & mask)];
-      assert(x1195 != Fp::invalid());
+      if (kCheckRegs && x1195 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][69], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1196 = args[2][70 * steps + ((cycle - 0) & mask)];
-      assert(x1196 != Fp::invalid());
+      if (kCheckRegs && x1196 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][70], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1197 = x12 * x1195;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2531,10 +2529,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1209 = x1200 + x1205;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1210 = args[2][71 * steps + ((cycle - 0) & mask)];
-      assert(x1210 != Fp::invalid());
+      if (kCheckRegs && x1210 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][71], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1211 = args[2][72 * steps + ((cycle - 0) & mask)];
-      assert(x1211 != Fp::invalid());
+      if (kCheckRegs && x1211 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][72], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1212 = x12 * x1210;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2625,10 +2623,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1255 = x1254 + x1249;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1256 = args[2][73 * steps + ((cycle - 0) & mask)];
-      assert(x1256 != Fp::invalid());
+      if (kCheckRegs && x1256 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][73], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1257 = args[2][74 * steps + ((cycle - 0) & mask)];
-      assert(x1257 != Fp::invalid());
+      if (kCheckRegs && x1257 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][74], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1258 = x12 * x1256;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2719,10 +2717,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1301 = x1300 + x1295;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1302 = args[2][75 * steps + ((cycle - 0) & mask)];
-      assert(x1302 != Fp::invalid());
+      if (kCheckRegs && x1302 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][75], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1303 = args[2][76 * steps + ((cycle - 0) & mask)];
-      assert(x1303 != Fp::invalid());
+      if (kCheckRegs && x1303 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][76], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1304 = x12 * x1302;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2751,10 +2749,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1316 = x1307 + x1312;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1317 = args[2][77 * steps + ((cycle - 0) & mask)];
-      assert(x1317 != Fp::invalid());
+      if (kCheckRegs && x1317 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][77], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1318 = args[2][78 * steps + ((cycle - 0) & mask)];
-      assert(x1318 != Fp::invalid());
+      if (kCheckRegs && x1318 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][78], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1319 = x12 * x1317;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2845,10 +2843,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1362 = x1361 + x1356;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1363 = args[2][79 * steps + ((cycle - 0) & mask)];
-      assert(x1363 != Fp::invalid());
+      if (kCheckRegs && x1363 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][79], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1364 = args[2][80 * steps + ((cycle - 0) & mask)];
-      assert(x1364 != Fp::invalid());
+      if (kCheckRegs && x1364 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][80], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1365 = x12 * x1363;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2939,10 +2937,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1408 = x1407 + x1402;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1409 = args[2][81 * steps + ((cycle - 0) & mask)];
-      assert(x1409 != Fp::invalid());
+      if (kCheckRegs && x1409 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][81], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1410 = args[2][82 * steps + ((cycle - 0) & mask)];
-      assert(x1410 != Fp::invalid());
+      if (kCheckRegs && x1410 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][82], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1411 = x12 * x1409;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -2971,10 +2969,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1423 = x1414 + x1419;
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1424 = args[2][83 * steps + ((cycle - 0) & mask)];
-      assert(x1424 != Fp::invalid());
+      if (kCheckRegs && x1424 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][83], back 0)");
       // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1425 = args[2][84 * steps + ((cycle - 0) & mask)];
-      assert(x1425 != Fp::invalid());
+      if (kCheckRegs && x1425 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][84], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1426 = x12 * x1424;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -3065,10 +3063,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x1469 = x1468 + x1463;
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1470 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x1470 != Fp::invalid());
+      if (kCheckRegs && x1470 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x1471 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x1471 != Fp::invalid());
+      if (kCheckRegs && x1471 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x1472 = x12 * x1470;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4481,21 +4479,21 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2176 = x2175 + x2172;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x2177 = x2176 + x2171;
-      host_args.at(0) = x2154;
-      host_args.at(1) = x2162;
-      host_args.at(2) = x2170;
-      host_args.at(3) = x2177;
-      host(ctx, "plonkWriteAccum", "bytes", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x2154;
+      host_args[1] = x2162;
+      host_args[2] = x2170;
+      host_args[3] = x2177;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraBytes, "bytes", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x9 != 0) {
     {
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2178 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x2178 != Fp::invalid());
+      if (kCheckRegs && x2178 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][3], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2179 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x2179 != Fp::invalid());
+      if (kCheckRegs && x2179 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][4], back 0)");
       // loc("Top/BytesHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x2180 = args[3][0];
       // loc("Top/BytesHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -4540,10 +4538,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2200 = x2187 + x2196;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2201 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x2201 != Fp::invalid());
+      if (kCheckRegs && x2201 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][5], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2202 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x2202 != Fp::invalid());
+      if (kCheckRegs && x2202 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][6], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2203 = x2180 * x2201;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4634,10 +4632,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2246 = x2245 + x2240;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2247 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x2247 != Fp::invalid());
+      if (kCheckRegs && x2247 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][7], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2248 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x2248 != Fp::invalid());
+      if (kCheckRegs && x2248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][8], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2249 = x2180 * x2247;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4728,10 +4726,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2292 = x2291 + x2286;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2293 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x2293 != Fp::invalid());
+      if (kCheckRegs && x2293 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2294 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x2294 != Fp::invalid());
+      if (kCheckRegs && x2294 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2295 = x2180 * x2293;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4760,10 +4758,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2307 = x2298 + x2303;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2308 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x2308 != Fp::invalid());
+      if (kCheckRegs && x2308 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2309 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x2309 != Fp::invalid());
+      if (kCheckRegs && x2309 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2310 = x2180 * x2308;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4854,10 +4852,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2353 = x2352 + x2347;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2354 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x2354 != Fp::invalid());
+      if (kCheckRegs && x2354 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2355 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x2355 != Fp::invalid());
+      if (kCheckRegs && x2355 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2356 = x2180 * x2354;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4948,10 +4946,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2399 = x2398 + x2393;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2400 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x2400 != Fp::invalid());
+      if (kCheckRegs && x2400 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2401 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x2401 != Fp::invalid());
+      if (kCheckRegs && x2401 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2402 = x2180 * x2400;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -4980,10 +4978,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2414 = x2405 + x2410;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2415 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x2415 != Fp::invalid());
+      if (kCheckRegs && x2415 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2416 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x2416 != Fp::invalid());
+      if (kCheckRegs && x2416 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2417 = x2180 * x2415;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5074,10 +5072,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2460 = x2459 + x2454;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2461 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x2461 != Fp::invalid());
+      if (kCheckRegs && x2461 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2462 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x2462 != Fp::invalid());
+      if (kCheckRegs && x2462 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2463 = x2180 * x2461;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5168,10 +5166,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2506 = x2505 + x2500;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2507 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x2507 != Fp::invalid());
+      if (kCheckRegs && x2507 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2508 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x2508 != Fp::invalid());
+      if (kCheckRegs && x2508 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2509 = x2180 * x2507;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5200,10 +5198,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2521 = x2512 + x2517;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2522 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x2522 != Fp::invalid());
+      if (kCheckRegs && x2522 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2523 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x2523 != Fp::invalid());
+      if (kCheckRegs && x2523 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2524 = x2180 * x2522;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5294,10 +5292,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2567 = x2566 + x2561;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2568 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x2568 != Fp::invalid());
+      if (kCheckRegs && x2568 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2569 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x2569 != Fp::invalid());
+      if (kCheckRegs && x2569 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2570 = x2180 * x2568;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5388,10 +5386,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2613 = x2612 + x2607;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2614 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x2614 != Fp::invalid());
+      if (kCheckRegs && x2614 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2615 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x2615 != Fp::invalid());
+      if (kCheckRegs && x2615 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2616 = x2180 * x2614;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5420,10 +5418,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2628 = x2619 + x2624;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2629 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x2629 != Fp::invalid());
+      if (kCheckRegs && x2629 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2630 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x2630 != Fp::invalid());
+      if (kCheckRegs && x2630 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2631 = x2180 * x2629;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5514,10 +5512,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2674 = x2673 + x2668;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2675 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x2675 != Fp::invalid());
+      if (kCheckRegs && x2675 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2676 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x2676 != Fp::invalid());
+      if (kCheckRegs && x2676 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2677 = x2180 * x2675;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5608,10 +5606,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2720 = x2719 + x2714;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2721 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x2721 != Fp::invalid());
+      if (kCheckRegs && x2721 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2722 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x2722 != Fp::invalid());
+      if (kCheckRegs && x2722 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2723 = x2180 * x2721;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5640,10 +5638,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2735 = x2726 + x2731;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2736 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x2736 != Fp::invalid());
+      if (kCheckRegs && x2736 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2737 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x2737 != Fp::invalid());
+      if (kCheckRegs && x2737 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2738 = x2180 * x2736;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5734,10 +5732,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2781 = x2780 + x2775;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2782 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x2782 != Fp::invalid());
+      if (kCheckRegs && x2782 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2783 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x2783 != Fp::invalid());
+      if (kCheckRegs && x2783 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2784 = x2180 * x2782;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5766,10 +5764,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2796 = x2787 + x2792;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2797 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x2797 != Fp::invalid());
+      if (kCheckRegs && x2797 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2798 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x2798 != Fp::invalid());
+      if (kCheckRegs && x2798 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2799 = x2180 * x2797;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5860,10 +5858,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2842 = x2841 + x2836;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2843 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x2843 != Fp::invalid());
+      if (kCheckRegs && x2843 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2844 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x2844 != Fp::invalid());
+      if (kCheckRegs && x2844 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2845 = x2180 * x2843;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5954,10 +5952,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2888 = x2887 + x2882;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2889 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x2889 != Fp::invalid());
+      if (kCheckRegs && x2889 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2890 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x2890 != Fp::invalid());
+      if (kCheckRegs && x2890 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2891 = x2180 * x2889;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -5986,10 +5984,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2903 = x2894 + x2899;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2904 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x2904 != Fp::invalid());
+      if (kCheckRegs && x2904 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2905 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x2905 != Fp::invalid());
+      if (kCheckRegs && x2905 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2906 = x2180 * x2904;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6080,10 +6078,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2949 = x2948 + x2943;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2950 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x2950 != Fp::invalid());
+      if (kCheckRegs && x2950 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2951 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x2951 != Fp::invalid());
+      if (kCheckRegs && x2951 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2952 = x2180 * x2950;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6174,10 +6172,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x2995 = x2994 + x2989;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2996 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x2996 != Fp::invalid());
+      if (kCheckRegs && x2996 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x2997 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x2997 != Fp::invalid());
+      if (kCheckRegs && x2997 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x2998 = x2180 * x2996;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6206,10 +6204,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3010 = x3001 + x3006;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3011 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x3011 != Fp::invalid());
+      if (kCheckRegs && x3011 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3012 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x3012 != Fp::invalid());
+      if (kCheckRegs && x3012 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3013 = x2180 * x3011;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6300,10 +6298,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3056 = x3055 + x3050;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3057 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x3057 != Fp::invalid());
+      if (kCheckRegs && x3057 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3058 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x3058 != Fp::invalid());
+      if (kCheckRegs && x3058 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3059 = x2180 * x3057;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6394,10 +6392,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3102 = x3101 + x3096;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3103 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x3103 != Fp::invalid());
+      if (kCheckRegs && x3103 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3104 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x3104 != Fp::invalid());
+      if (kCheckRegs && x3104 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3105 = x2180 * x3103;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6426,10 +6424,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3117 = x3108 + x3113;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3118 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x3118 != Fp::invalid());
+      if (kCheckRegs && x3118 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3119 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x3119 != Fp::invalid());
+      if (kCheckRegs && x3119 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3120 = x2180 * x3118;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6520,10 +6518,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3163 = x3162 + x3157;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3164 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x3164 != Fp::invalid());
+      if (kCheckRegs && x3164 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3165 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x3165 != Fp::invalid());
+      if (kCheckRegs && x3165 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3166 = x2180 * x3164;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6614,10 +6612,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3209 = x3208 + x3203;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3210 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x3210 != Fp::invalid());
+      if (kCheckRegs && x3210 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3211 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x3211 != Fp::invalid());
+      if (kCheckRegs && x3211 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3212 = x2180 * x3210;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6646,10 +6644,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3224 = x3215 + x3220;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3225 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x3225 != Fp::invalid());
+      if (kCheckRegs && x3225 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3226 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x3226 != Fp::invalid());
+      if (kCheckRegs && x3226 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3227 = x2180 * x3225;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6740,10 +6738,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3270 = x3269 + x3264;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3271 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x3271 != Fp::invalid());
+      if (kCheckRegs && x3271 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3272 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x3272 != Fp::invalid());
+      if (kCheckRegs && x3272 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3273 = x2180 * x3271;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6834,10 +6832,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3316 = x3315 + x3310;
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3317 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x3317 != Fp::invalid());
+      if (kCheckRegs && x3317 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
       // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3318 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x3318 != Fp::invalid());
+      if (kCheckRegs && x3318 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3319 = x2180 * x3317;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -6866,10 +6864,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3331 = x3322 + x3327;
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3332 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x3332 != Fp::invalid());
+      if (kCheckRegs && x3332 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3333 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x3333 != Fp::invalid());
+      if (kCheckRegs && x3333 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3334 = x2180 * x3332;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8084,21 +8082,21 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3939 = x3938 + x3935;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x3940 = x3939 + x3934;
-      host_args.at(0) = x3917;
-      host_args.at(1) = x3925;
-      host_args.at(2) = x3933;
-      host_args.at(3) = x3940;
-      host(ctx, "plonkWriteAccum", "bytes", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x3917;
+      host_args[1] = x3925;
+      host_args[2] = x3933;
+      host_args[3] = x3940;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraBytes, "bytes", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x5 != 0) {
     {
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3941 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x3941 != Fp::invalid());
+      if (kCheckRegs && x3941 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][3], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3942 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x3942 != Fp::invalid());
+      if (kCheckRegs && x3942 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][4], back 0)");
       // loc("Top/BytesHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x3943 = args[3][0];
       // loc("Top/BytesHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -8143,10 +8141,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x3963 = x3950 + x3959;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3964 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x3964 != Fp::invalid());
+      if (kCheckRegs && x3964 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][5], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x3965 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x3965 != Fp::invalid());
+      if (kCheckRegs && x3965 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][6], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x3966 = x3943 * x3964;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8237,10 +8235,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4009 = x4008 + x4003;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4010 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x4010 != Fp::invalid());
+      if (kCheckRegs && x4010 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][7], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4011 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x4011 != Fp::invalid());
+      if (kCheckRegs && x4011 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][8], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4012 = x3943 * x4010;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8331,10 +8329,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4055 = x4054 + x4049;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4056 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x4056 != Fp::invalid());
+      if (kCheckRegs && x4056 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4057 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x4057 != Fp::invalid());
+      if (kCheckRegs && x4057 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4058 = x3943 * x4056;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8363,10 +8361,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4070 = x4061 + x4066;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4071 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x4071 != Fp::invalid());
+      if (kCheckRegs && x4071 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4072 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x4072 != Fp::invalid());
+      if (kCheckRegs && x4072 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4073 = x3943 * x4071;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8457,10 +8455,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4116 = x4115 + x4110;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4117 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x4117 != Fp::invalid());
+      if (kCheckRegs && x4117 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4118 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x4118 != Fp::invalid());
+      if (kCheckRegs && x4118 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4119 = x3943 * x4117;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8551,10 +8549,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4162 = x4161 + x4156;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4163 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x4163 != Fp::invalid());
+      if (kCheckRegs && x4163 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4164 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x4164 != Fp::invalid());
+      if (kCheckRegs && x4164 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4165 = x3943 * x4163;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8583,10 +8581,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4177 = x4168 + x4173;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4178 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x4178 != Fp::invalid());
+      if (kCheckRegs && x4178 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4179 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x4179 != Fp::invalid());
+      if (kCheckRegs && x4179 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4180 = x3943 * x4178;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8677,10 +8675,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4223 = x4222 + x4217;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4224 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x4224 != Fp::invalid());
+      if (kCheckRegs && x4224 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4225 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x4225 != Fp::invalid());
+      if (kCheckRegs && x4225 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4226 = x3943 * x4224;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8771,10 +8769,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4269 = x4268 + x4263;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4270 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x4270 != Fp::invalid());
+      if (kCheckRegs && x4270 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4271 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x4271 != Fp::invalid());
+      if (kCheckRegs && x4271 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4272 = x3943 * x4270;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8803,10 +8801,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4284 = x4275 + x4280;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4285 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x4285 != Fp::invalid());
+      if (kCheckRegs && x4285 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4286 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x4286 != Fp::invalid());
+      if (kCheckRegs && x4286 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4287 = x3943 * x4285;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8897,10 +8895,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4330 = x4329 + x4324;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4331 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x4331 != Fp::invalid());
+      if (kCheckRegs && x4331 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4332 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x4332 != Fp::invalid());
+      if (kCheckRegs && x4332 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4333 = x3943 * x4331;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -8991,10 +8989,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4376 = x4375 + x4370;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4377 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x4377 != Fp::invalid());
+      if (kCheckRegs && x4377 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4378 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x4378 != Fp::invalid());
+      if (kCheckRegs && x4378 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4379 = x3943 * x4377;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9023,10 +9021,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4391 = x4382 + x4387;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4392 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x4392 != Fp::invalid());
+      if (kCheckRegs && x4392 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4393 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x4393 != Fp::invalid());
+      if (kCheckRegs && x4393 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4394 = x3943 * x4392;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9117,10 +9115,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4437 = x4436 + x4431;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4438 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x4438 != Fp::invalid());
+      if (kCheckRegs && x4438 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4439 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x4439 != Fp::invalid());
+      if (kCheckRegs && x4439 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4440 = x3943 * x4438;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9211,10 +9209,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4483 = x4482 + x4477;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4484 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x4484 != Fp::invalid());
+      if (kCheckRegs && x4484 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4485 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x4485 != Fp::invalid());
+      if (kCheckRegs && x4485 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4486 = x3943 * x4484;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9243,10 +9241,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4498 = x4489 + x4494;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4499 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x4499 != Fp::invalid());
+      if (kCheckRegs && x4499 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4500 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x4500 != Fp::invalid());
+      if (kCheckRegs && x4500 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4501 = x3943 * x4499;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9337,10 +9335,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4544 = x4543 + x4538;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4545 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x4545 != Fp::invalid());
+      if (kCheckRegs && x4545 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4546 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x4546 != Fp::invalid());
+      if (kCheckRegs && x4546 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4547 = x3943 * x4545;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9369,10 +9367,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4559 = x4550 + x4555;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4560 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x4560 != Fp::invalid());
+      if (kCheckRegs && x4560 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4561 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x4561 != Fp::invalid());
+      if (kCheckRegs && x4561 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4562 = x3943 * x4560;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9463,10 +9461,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4605 = x4604 + x4599;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4606 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x4606 != Fp::invalid());
+      if (kCheckRegs && x4606 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4607 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x4607 != Fp::invalid());
+      if (kCheckRegs && x4607 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4608 = x3943 * x4606;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9557,10 +9555,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4651 = x4650 + x4645;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4652 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x4652 != Fp::invalid());
+      if (kCheckRegs && x4652 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4653 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x4653 != Fp::invalid());
+      if (kCheckRegs && x4653 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4654 = x3943 * x4652;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9589,10 +9587,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4666 = x4657 + x4662;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4667 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x4667 != Fp::invalid());
+      if (kCheckRegs && x4667 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4668 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x4668 != Fp::invalid());
+      if (kCheckRegs && x4668 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4669 = x3943 * x4667;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9683,10 +9681,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4712 = x4711 + x4706;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4713 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x4713 != Fp::invalid());
+      if (kCheckRegs && x4713 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4714 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x4714 != Fp::invalid());
+      if (kCheckRegs && x4714 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4715 = x3943 * x4713;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9777,10 +9775,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4758 = x4757 + x4752;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4759 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x4759 != Fp::invalid());
+      if (kCheckRegs && x4759 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4760 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x4760 != Fp::invalid());
+      if (kCheckRegs && x4760 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4761 = x3943 * x4759;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9809,10 +9807,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4773 = x4764 + x4769;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4774 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x4774 != Fp::invalid());
+      if (kCheckRegs && x4774 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4775 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x4775 != Fp::invalid());
+      if (kCheckRegs && x4775 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4776 = x3943 * x4774;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9903,10 +9901,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4819 = x4818 + x4813;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4820 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x4820 != Fp::invalid());
+      if (kCheckRegs && x4820 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4821 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x4821 != Fp::invalid());
+      if (kCheckRegs && x4821 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4822 = x3943 * x4820;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -9997,10 +9995,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4865 = x4864 + x4859;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4866 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x4866 != Fp::invalid());
+      if (kCheckRegs && x4866 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4867 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x4867 != Fp::invalid());
+      if (kCheckRegs && x4867 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4868 = x3943 * x4866;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10029,10 +10027,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4880 = x4871 + x4876;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4881 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x4881 != Fp::invalid());
+      if (kCheckRegs && x4881 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4882 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x4882 != Fp::invalid());
+      if (kCheckRegs && x4882 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4883 = x3943 * x4881;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10123,10 +10121,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4926 = x4925 + x4920;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4927 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x4927 != Fp::invalid());
+      if (kCheckRegs && x4927 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4928 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x4928 != Fp::invalid());
+      if (kCheckRegs && x4928 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4929 = x3943 * x4927;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10217,10 +10215,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4972 = x4971 + x4966;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4973 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x4973 != Fp::invalid());
+      if (kCheckRegs && x4973 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4974 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x4974 != Fp::invalid());
+      if (kCheckRegs && x4974 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4975 = x3943 * x4973;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10249,10 +10247,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x4987 = x4978 + x4983;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4988 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x4988 != Fp::invalid());
+      if (kCheckRegs && x4988 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x4989 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x4989 != Fp::invalid());
+      if (kCheckRegs && x4989 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x4990 = x3943 * x4988;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10343,10 +10341,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5033 = x5032 + x5027;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5034 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x5034 != Fp::invalid());
+      if (kCheckRegs && x5034 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5035 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x5035 != Fp::invalid());
+      if (kCheckRegs && x5035 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5036 = x3943 * x5034;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10437,10 +10435,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5079 = x5078 + x5073;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5080 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x5080 != Fp::invalid());
+      if (kCheckRegs && x5080 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5081 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x5081 != Fp::invalid());
+      if (kCheckRegs && x5081 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5082 = x3943 * x5080;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -10469,10 +10467,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5094 = x5085 + x5090;
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5095 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x5095 != Fp::invalid());
+      if (kCheckRegs && x5095 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5096 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x5096 != Fp::invalid());
+      if (kCheckRegs && x5096 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5097 = x3943 * x5095;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -11687,34 +11685,34 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5702 = x5701 + x5698;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x5703 = x5702 + x5697;
-      host_args.at(0) = x5680;
-      host_args.at(1) = x5688;
-      host_args.at(2) = x5696;
-      host_args.at(3) = x5703;
-      host(ctx, "plonkWriteAccum", "bytes", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x5680;
+      host_args[1] = x5688;
+      host_args[2] = x5696;
+      host_args[3] = x5703;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraBytes, "bytes", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
     {
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5704 = args[2][114 * steps + ((cycle - 0) & mask)];
-      assert(x5704 != Fp::invalid());
+      if (kCheckRegs && x5704 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][114], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5705 = args[2][115 * steps + ((cycle - 0) & mask)];
-      assert(x5705 != Fp::invalid());
+      if (kCheckRegs && x5705 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][115], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5706 = args[2][116 * steps + ((cycle - 0) & mask)];
-      assert(x5706 != Fp::invalid());
+      if (kCheckRegs && x5706 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5707 = args[2][117 * steps + ((cycle - 0) & mask)];
-      assert(x5707 != Fp::invalid());
+      if (kCheckRegs && x5707 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][117], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5708 = args[2][118 * steps + ((cycle - 0) & mask)];
-      assert(x5708 != Fp::invalid());
+      if (kCheckRegs && x5708 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][118], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5709 = args[2][119 * steps + ((cycle - 0) & mask)];
-      assert(x5709 != Fp::invalid());
+      if (kCheckRegs && x5709 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][119], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5710 = args[2][120 * steps + ((cycle - 0) & mask)];
-      assert(x5710 != Fp::invalid());
+      if (kCheckRegs && x5710 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][120], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x5711 = args[3][8];
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -11879,25 +11877,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5791 = x5779 + x5787;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5792 = args[2][121 * steps + ((cycle - 0) & mask)];
-      assert(x5792 != Fp::invalid());
+      if (kCheckRegs && x5792 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][121], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5793 = args[2][122 * steps + ((cycle - 0) & mask)];
-      assert(x5793 != Fp::invalid());
+      if (kCheckRegs && x5793 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][122], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5794 = args[2][123 * steps + ((cycle - 0) & mask)];
-      assert(x5794 != Fp::invalid());
+      if (kCheckRegs && x5794 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5795 = args[2][124 * steps + ((cycle - 0) & mask)];
-      assert(x5795 != Fp::invalid());
+      if (kCheckRegs && x5795 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][124], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5796 = args[2][125 * steps + ((cycle - 0) & mask)];
-      assert(x5796 != Fp::invalid());
+      if (kCheckRegs && x5796 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][125], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5797 = args[2][126 * steps + ((cycle - 0) & mask)];
-      assert(x5797 != Fp::invalid());
+      if (kCheckRegs && x5797 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][126], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5798 = args[2][127 * steps + ((cycle - 0) & mask)];
-      assert(x5798 != Fp::invalid());
+      if (kCheckRegs && x5798 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][127], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5799 = x5711 * x5792;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12068,25 +12066,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5882 = x5881 + x5876;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5883 = args[2][128 * steps + ((cycle - 0) & mask)];
-      assert(x5883 != Fp::invalid());
+      if (kCheckRegs && x5883 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][128], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5884 = args[2][129 * steps + ((cycle - 0) & mask)];
-      assert(x5884 != Fp::invalid());
+      if (kCheckRegs && x5884 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][129], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5885 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x5885 != Fp::invalid());
+      if (kCheckRegs && x5885 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5886 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x5886 != Fp::invalid());
+      if (kCheckRegs && x5886 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][131], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5887 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x5887 != Fp::invalid());
+      if (kCheckRegs && x5887 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][132], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5888 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x5888 != Fp::invalid());
+      if (kCheckRegs && x5888 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5889 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x5889 != Fp::invalid());
+      if (kCheckRegs && x5889 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][134], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5890 = x5711 * x5883;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12195,25 +12193,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x5942 = x5934 + x5938;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5943 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x5943 != Fp::invalid());
+      if (kCheckRegs && x5943 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][135], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5944 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x5944 != Fp::invalid());
+      if (kCheckRegs && x5944 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][136], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5945 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x5945 != Fp::invalid());
+      if (kCheckRegs && x5945 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5946 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x5946 != Fp::invalid());
+      if (kCheckRegs && x5946 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][138], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5947 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x5947 != Fp::invalid());
+      if (kCheckRegs && x5947 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][139], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5948 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x5948 != Fp::invalid());
+      if (kCheckRegs && x5948 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x5949 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x5949 != Fp::invalid());
+      if (kCheckRegs && x5949 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][141], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x5950 = x5711 * x5943;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12384,25 +12382,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6033 = x6032 + x6027;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6034 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x6034 != Fp::invalid());
+      if (kCheckRegs && x6034 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][142], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6035 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x6035 != Fp::invalid());
+      if (kCheckRegs && x6035 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][143], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6036 = args[2][144 * steps + ((cycle - 0) & mask)];
-      assert(x6036 != Fp::invalid());
+      if (kCheckRegs && x6036 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6037 = args[2][145 * steps + ((cycle - 0) & mask)];
-      assert(x6037 != Fp::invalid());
+      if (kCheckRegs && x6037 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][145], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6038 = args[2][146 * steps + ((cycle - 0) & mask)];
-      assert(x6038 != Fp::invalid());
+      if (kCheckRegs && x6038 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][146], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6039 = args[2][147 * steps + ((cycle - 0) & mask)];
-      assert(x6039 != Fp::invalid());
+      if (kCheckRegs && x6039 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][147], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6040 = args[2][148 * steps + ((cycle - 0) & mask)];
-      assert(x6040 != Fp::invalid());
+      if (kCheckRegs && x6040 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][148], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6041 = x5711 * x6034;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12511,25 +12509,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6093 = x6085 + x6089;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6094 = args[2][149 * steps + ((cycle - 0) & mask)];
-      assert(x6094 != Fp::invalid());
+      if (kCheckRegs && x6094 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][149], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6095 = args[2][150 * steps + ((cycle - 0) & mask)];
-      assert(x6095 != Fp::invalid());
+      if (kCheckRegs && x6095 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][150], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6096 = args[2][151 * steps + ((cycle - 0) & mask)];
-      assert(x6096 != Fp::invalid());
+      if (kCheckRegs && x6096 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6097 = args[2][152 * steps + ((cycle - 0) & mask)];
-      assert(x6097 != Fp::invalid());
+      if (kCheckRegs && x6097 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][152], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6098 = args[2][153 * steps + ((cycle - 0) & mask)];
-      assert(x6098 != Fp::invalid());
+      if (kCheckRegs && x6098 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][153], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6099 = args[2][154 * steps + ((cycle - 0) & mask)];
-      assert(x6099 != Fp::invalid());
+      if (kCheckRegs && x6099 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][154], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6100 = args[2][155 * steps + ((cycle - 0) & mask)];
-      assert(x6100 != Fp::invalid());
+      if (kCheckRegs && x6100 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][155], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6101 = x5711 * x6094;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12700,25 +12698,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6184 = x6183 + x6178;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6185 = args[2][156 * steps + ((cycle - 0) & mask)];
-      assert(x6185 != Fp::invalid());
+      if (kCheckRegs && x6185 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][156], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6186 = args[2][157 * steps + ((cycle - 0) & mask)];
-      assert(x6186 != Fp::invalid());
+      if (kCheckRegs && x6186 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][157], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6187 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x6187 != Fp::invalid());
+      if (kCheckRegs && x6187 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6188 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x6188 != Fp::invalid());
+      if (kCheckRegs && x6188 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][159], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6189 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x6189 != Fp::invalid());
+      if (kCheckRegs && x6189 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][160], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6190 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x6190 != Fp::invalid());
+      if (kCheckRegs && x6190 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6191 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x6191 != Fp::invalid());
+      if (kCheckRegs && x6191 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][162], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6192 = x5711 * x6185;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -12827,25 +12825,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6244 = x6236 + x6240;
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6245 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x6245 != Fp::invalid());
+      if (kCheckRegs && x6245 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6246 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x6246 != Fp::invalid());
+      if (kCheckRegs && x6246 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6247 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x6247 != Fp::invalid());
+      if (kCheckRegs && x6247 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6248 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x6248 != Fp::invalid());
+      if (kCheckRegs && x6248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6249 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x6249 != Fp::invalid());
+      if (kCheckRegs && x6249 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6250 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x6250 != Fp::invalid());
+      if (kCheckRegs && x6250 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6251 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x6251 != Fp::invalid());
+      if (kCheckRegs && x6251 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6252 = x5711 * x6245;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13348,21 +13346,21 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6501 = x6500 + x6497;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x6502 = x6501 + x6496;
-      host_args.at(0) = x6479;
-      host_args.at(1) = x6487;
-      host_args.at(2) = x6495;
-      host_args.at(3) = x6502;
-      host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x6479;
+      host_args[1] = x6487;
+      host_args[2] = x6495;
+      host_args[3] = x6502;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x6 != 0) {
     {
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6503 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x6503 != Fp::invalid());
+      if (kCheckRegs && x6503 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][3], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6504 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x6504 != Fp::invalid());
+      if (kCheckRegs && x6504 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][4], back 0)");
       // loc("Top/BytesHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x6505 = args[3][0];
       // loc("Top/BytesHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -13407,10 +13405,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6525 = x6512 + x6521;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6526 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x6526 != Fp::invalid());
+      if (kCheckRegs && x6526 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][5], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6527 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x6527 != Fp::invalid());
+      if (kCheckRegs && x6527 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][6], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6528 = x6505 * x6526;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13501,10 +13499,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6571 = x6570 + x6565;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6572 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x6572 != Fp::invalid());
+      if (kCheckRegs && x6572 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][7], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6573 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x6573 != Fp::invalid());
+      if (kCheckRegs && x6573 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][8], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6574 = x6505 * x6572;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13595,10 +13593,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6617 = x6616 + x6611;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6618 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x6618 != Fp::invalid());
+      if (kCheckRegs && x6618 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6619 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x6619 != Fp::invalid());
+      if (kCheckRegs && x6619 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6620 = x6505 * x6618;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13627,10 +13625,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6632 = x6623 + x6628;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6633 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x6633 != Fp::invalid());
+      if (kCheckRegs && x6633 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6634 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x6634 != Fp::invalid());
+      if (kCheckRegs && x6634 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6635 = x6505 * x6633;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13721,10 +13719,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6678 = x6677 + x6672;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6679 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x6679 != Fp::invalid());
+      if (kCheckRegs && x6679 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6680 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x6680 != Fp::invalid());
+      if (kCheckRegs && x6680 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6681 = x6505 * x6679;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13815,10 +13813,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6724 = x6723 + x6718;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6725 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x6725 != Fp::invalid());
+      if (kCheckRegs && x6725 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6726 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x6726 != Fp::invalid());
+      if (kCheckRegs && x6726 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6727 = x6505 * x6725;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13847,10 +13845,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6739 = x6730 + x6735;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6740 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x6740 != Fp::invalid());
+      if (kCheckRegs && x6740 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6741 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x6741 != Fp::invalid());
+      if (kCheckRegs && x6741 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6742 = x6505 * x6740;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -13941,10 +13939,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6785 = x6784 + x6779;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6786 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x6786 != Fp::invalid());
+      if (kCheckRegs && x6786 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6787 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x6787 != Fp::invalid());
+      if (kCheckRegs && x6787 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6788 = x6505 * x6786;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14035,10 +14033,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6831 = x6830 + x6825;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6832 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x6832 != Fp::invalid());
+      if (kCheckRegs && x6832 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6833 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x6833 != Fp::invalid());
+      if (kCheckRegs && x6833 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6834 = x6505 * x6832;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14067,10 +14065,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6846 = x6837 + x6842;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6847 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x6847 != Fp::invalid());
+      if (kCheckRegs && x6847 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6848 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x6848 != Fp::invalid());
+      if (kCheckRegs && x6848 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6849 = x6505 * x6847;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14161,10 +14159,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6892 = x6891 + x6886;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6893 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x6893 != Fp::invalid());
+      if (kCheckRegs && x6893 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6894 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x6894 != Fp::invalid());
+      if (kCheckRegs && x6894 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6895 = x6505 * x6893;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14255,10 +14253,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6938 = x6937 + x6932;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6939 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x6939 != Fp::invalid());
+      if (kCheckRegs && x6939 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6940 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x6940 != Fp::invalid());
+      if (kCheckRegs && x6940 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6941 = x6505 * x6939;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14287,10 +14285,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6953 = x6944 + x6949;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6954 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x6954 != Fp::invalid());
+      if (kCheckRegs && x6954 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x6955 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x6955 != Fp::invalid());
+      if (kCheckRegs && x6955 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x6956 = x6505 * x6954;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14381,10 +14379,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x6999 = x6998 + x6993;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7000 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x7000 != Fp::invalid());
+      if (kCheckRegs && x7000 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7001 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x7001 != Fp::invalid());
+      if (kCheckRegs && x7001 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7002 = x6505 * x7000;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14475,10 +14473,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7045 = x7044 + x7039;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7046 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x7046 != Fp::invalid());
+      if (kCheckRegs && x7046 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7047 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x7047 != Fp::invalid());
+      if (kCheckRegs && x7047 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7048 = x6505 * x7046;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14507,10 +14505,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7060 = x7051 + x7056;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7061 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x7061 != Fp::invalid());
+      if (kCheckRegs && x7061 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7062 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x7062 != Fp::invalid());
+      if (kCheckRegs && x7062 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7063 = x6505 * x7061;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14601,10 +14599,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7106 = x7105 + x7100;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7107 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x7107 != Fp::invalid());
+      if (kCheckRegs && x7107 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7108 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x7108 != Fp::invalid());
+      if (kCheckRegs && x7108 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7109 = x6505 * x7107;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14633,10 +14631,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7121 = x7112 + x7117;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7122 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x7122 != Fp::invalid());
+      if (kCheckRegs && x7122 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7123 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x7123 != Fp::invalid());
+      if (kCheckRegs && x7123 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7124 = x6505 * x7122;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14727,10 +14725,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7167 = x7166 + x7161;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7168 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x7168 != Fp::invalid());
+      if (kCheckRegs && x7168 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7169 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x7169 != Fp::invalid());
+      if (kCheckRegs && x7169 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7170 = x6505 * x7168;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14821,10 +14819,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7213 = x7212 + x7207;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7214 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x7214 != Fp::invalid());
+      if (kCheckRegs && x7214 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7215 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x7215 != Fp::invalid());
+      if (kCheckRegs && x7215 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7216 = x6505 * x7214;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14853,10 +14851,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7228 = x7219 + x7224;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7229 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x7229 != Fp::invalid());
+      if (kCheckRegs && x7229 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7230 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x7230 != Fp::invalid());
+      if (kCheckRegs && x7230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7231 = x6505 * x7229;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -14947,10 +14945,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7274 = x7273 + x7268;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7275 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x7275 != Fp::invalid());
+      if (kCheckRegs && x7275 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7276 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x7276 != Fp::invalid());
+      if (kCheckRegs && x7276 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7277 = x6505 * x7275;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15041,10 +15039,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7320 = x7319 + x7314;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7321 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x7321 != Fp::invalid());
+      if (kCheckRegs && x7321 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7322 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x7322 != Fp::invalid());
+      if (kCheckRegs && x7322 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7323 = x6505 * x7321;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15073,10 +15071,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7335 = x7326 + x7331;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7336 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x7336 != Fp::invalid());
+      if (kCheckRegs && x7336 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7337 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x7337 != Fp::invalid());
+      if (kCheckRegs && x7337 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7338 = x6505 * x7336;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15167,10 +15165,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7381 = x7380 + x7375;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7382 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x7382 != Fp::invalid());
+      if (kCheckRegs && x7382 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7383 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x7383 != Fp::invalid());
+      if (kCheckRegs && x7383 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7384 = x6505 * x7382;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15261,10 +15259,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7427 = x7426 + x7421;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7428 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x7428 != Fp::invalid());
+      if (kCheckRegs && x7428 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7429 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x7429 != Fp::invalid());
+      if (kCheckRegs && x7429 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7430 = x6505 * x7428;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15293,10 +15291,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7442 = x7433 + x7438;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7443 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x7443 != Fp::invalid());
+      if (kCheckRegs && x7443 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7444 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x7444 != Fp::invalid());
+      if (kCheckRegs && x7444 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7445 = x6505 * x7443;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15387,10 +15385,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7488 = x7487 + x7482;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7489 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x7489 != Fp::invalid());
+      if (kCheckRegs && x7489 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7490 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x7490 != Fp::invalid());
+      if (kCheckRegs && x7490 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7491 = x6505 * x7489;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15481,10 +15479,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7534 = x7533 + x7528;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7535 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x7535 != Fp::invalid());
+      if (kCheckRegs && x7535 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7536 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x7536 != Fp::invalid());
+      if (kCheckRegs && x7536 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7537 = x6505 * x7535;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15513,10 +15511,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7549 = x7540 + x7545;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7550 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x7550 != Fp::invalid());
+      if (kCheckRegs && x7550 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7551 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x7551 != Fp::invalid());
+      if (kCheckRegs && x7551 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7552 = x6505 * x7550;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15607,10 +15605,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7595 = x7594 + x7589;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7596 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x7596 != Fp::invalid());
+      if (kCheckRegs && x7596 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7597 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x7597 != Fp::invalid());
+      if (kCheckRegs && x7597 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7598 = x6505 * x7596;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15701,10 +15699,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7641 = x7640 + x7635;
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7642 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x7642 != Fp::invalid());
+      if (kCheckRegs && x7642 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7643 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x7643 != Fp::invalid());
+      if (kCheckRegs && x7643 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7644 = x6505 * x7642;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -15733,10 +15731,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x7656 = x7647 + x7652;
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7657 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x7657 != Fp::invalid());
+      if (kCheckRegs && x7657 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x7658 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x7658 != Fp::invalid());
+      if (kCheckRegs && x7658 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x7659 = x6505 * x7657;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -16951,34 +16949,34 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8264 = x8263 + x8260;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x8265 = x8264 + x8259;
-      host_args.at(0) = x8242;
-      host_args.at(1) = x8250;
-      host_args.at(2) = x8258;
-      host_args.at(3) = x8265;
-      host(ctx, "plonkWriteAccum", "bytes", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x8242;
+      host_args[1] = x8250;
+      host_args[2] = x8258;
+      host_args[3] = x8265;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraBytes, "bytes", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
     {
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8266 = args[2][114 * steps + ((cycle - 0) & mask)];
-      assert(x8266 != Fp::invalid());
+      if (kCheckRegs && x8266 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][114], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8267 = args[2][115 * steps + ((cycle - 0) & mask)];
-      assert(x8267 != Fp::invalid());
+      if (kCheckRegs && x8267 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][115], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8268 = args[2][116 * steps + ((cycle - 0) & mask)];
-      assert(x8268 != Fp::invalid());
+      if (kCheckRegs && x8268 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8269 = args[2][117 * steps + ((cycle - 0) & mask)];
-      assert(x8269 != Fp::invalid());
+      if (kCheckRegs && x8269 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][117], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8270 = args[2][118 * steps + ((cycle - 0) & mask)];
-      assert(x8270 != Fp::invalid());
+      if (kCheckRegs && x8270 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][118], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8271 = args[2][119 * steps + ((cycle - 0) & mask)];
-      assert(x8271 != Fp::invalid());
+      if (kCheckRegs && x8271 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][119], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8272 = args[2][120 * steps + ((cycle - 0) & mask)];
-      assert(x8272 != Fp::invalid());
+      if (kCheckRegs && x8272 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][120], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x8273 = args[3][8];
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -17143,25 +17141,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8353 = x8341 + x8349;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8354 = args[2][121 * steps + ((cycle - 0) & mask)];
-      assert(x8354 != Fp::invalid());
+      if (kCheckRegs && x8354 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][121], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8355 = args[2][122 * steps + ((cycle - 0) & mask)];
-      assert(x8355 != Fp::invalid());
+      if (kCheckRegs && x8355 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][122], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8356 = args[2][123 * steps + ((cycle - 0) & mask)];
-      assert(x8356 != Fp::invalid());
+      if (kCheckRegs && x8356 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8357 = args[2][124 * steps + ((cycle - 0) & mask)];
-      assert(x8357 != Fp::invalid());
+      if (kCheckRegs && x8357 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][124], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8358 = args[2][125 * steps + ((cycle - 0) & mask)];
-      assert(x8358 != Fp::invalid());
+      if (kCheckRegs && x8358 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][125], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8359 = args[2][126 * steps + ((cycle - 0) & mask)];
-      assert(x8359 != Fp::invalid());
+      if (kCheckRegs && x8359 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][126], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8360 = args[2][127 * steps + ((cycle - 0) & mask)];
-      assert(x8360 != Fp::invalid());
+      if (kCheckRegs && x8360 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][127], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8361 = x8273 * x8354;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -17332,25 +17330,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8444 = x8443 + x8438;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8445 = args[2][128 * steps + ((cycle - 0) & mask)];
-      assert(x8445 != Fp::invalid());
+      if (kCheckRegs && x8445 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][128], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8446 = args[2][129 * steps + ((cycle - 0) & mask)];
-      assert(x8446 != Fp::invalid());
+      if (kCheckRegs && x8446 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][129], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8447 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x8447 != Fp::invalid());
+      if (kCheckRegs && x8447 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8448 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x8448 != Fp::invalid());
+      if (kCheckRegs && x8448 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][131], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8449 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x8449 != Fp::invalid());
+      if (kCheckRegs && x8449 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][132], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8450 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x8450 != Fp::invalid());
+      if (kCheckRegs && x8450 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8451 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x8451 != Fp::invalid());
+      if (kCheckRegs && x8451 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][134], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8452 = x8273 * x8445;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -17459,25 +17457,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8504 = x8496 + x8500;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8505 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x8505 != Fp::invalid());
+      if (kCheckRegs && x8505 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][135], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8506 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x8506 != Fp::invalid());
+      if (kCheckRegs && x8506 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][136], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8507 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x8507 != Fp::invalid());
+      if (kCheckRegs && x8507 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8508 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x8508 != Fp::invalid());
+      if (kCheckRegs && x8508 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][138], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8509 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x8509 != Fp::invalid());
+      if (kCheckRegs && x8509 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][139], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8510 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x8510 != Fp::invalid());
+      if (kCheckRegs && x8510 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8511 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x8511 != Fp::invalid());
+      if (kCheckRegs && x8511 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][141], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8512 = x8273 * x8505;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -17648,25 +17646,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8595 = x8594 + x8589;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8596 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x8596 != Fp::invalid());
+      if (kCheckRegs && x8596 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][142], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8597 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x8597 != Fp::invalid());
+      if (kCheckRegs && x8597 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][143], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8598 = args[2][144 * steps + ((cycle - 0) & mask)];
-      assert(x8598 != Fp::invalid());
+      if (kCheckRegs && x8598 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8599 = args[2][145 * steps + ((cycle - 0) & mask)];
-      assert(x8599 != Fp::invalid());
+      if (kCheckRegs && x8599 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][145], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8600 = args[2][146 * steps + ((cycle - 0) & mask)];
-      assert(x8600 != Fp::invalid());
+      if (kCheckRegs && x8600 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][146], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8601 = args[2][147 * steps + ((cycle - 0) & mask)];
-      assert(x8601 != Fp::invalid());
+      if (kCheckRegs && x8601 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][147], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8602 = args[2][148 * steps + ((cycle - 0) & mask)];
-      assert(x8602 != Fp::invalid());
+      if (kCheckRegs && x8602 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][148], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8603 = x8273 * x8596;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -17775,25 +17773,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8655 = x8647 + x8651;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8656 = args[2][149 * steps + ((cycle - 0) & mask)];
-      assert(x8656 != Fp::invalid());
+      if (kCheckRegs && x8656 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][149], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8657 = args[2][150 * steps + ((cycle - 0) & mask)];
-      assert(x8657 != Fp::invalid());
+      if (kCheckRegs && x8657 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][150], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8658 = args[2][151 * steps + ((cycle - 0) & mask)];
-      assert(x8658 != Fp::invalid());
+      if (kCheckRegs && x8658 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8659 = args[2][152 * steps + ((cycle - 0) & mask)];
-      assert(x8659 != Fp::invalid());
+      if (kCheckRegs && x8659 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][152], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8660 = args[2][153 * steps + ((cycle - 0) & mask)];
-      assert(x8660 != Fp::invalid());
+      if (kCheckRegs && x8660 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][153], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8661 = args[2][154 * steps + ((cycle - 0) & mask)];
-      assert(x8661 != Fp::invalid());
+      if (kCheckRegs && x8661 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][154], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8662 = args[2][155 * steps + ((cycle - 0) & mask)];
-      assert(x8662 != Fp::invalid());
+      if (kCheckRegs && x8662 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][155], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8663 = x8273 * x8656;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -17964,25 +17962,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8746 = x8745 + x8740;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8747 = args[2][156 * steps + ((cycle - 0) & mask)];
-      assert(x8747 != Fp::invalid());
+      if (kCheckRegs && x8747 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][156], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8748 = args[2][157 * steps + ((cycle - 0) & mask)];
-      assert(x8748 != Fp::invalid());
+      if (kCheckRegs && x8748 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][157], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8749 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x8749 != Fp::invalid());
+      if (kCheckRegs && x8749 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8750 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x8750 != Fp::invalid());
+      if (kCheckRegs && x8750 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][159], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8751 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x8751 != Fp::invalid());
+      if (kCheckRegs && x8751 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][160], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8752 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x8752 != Fp::invalid());
+      if (kCheckRegs && x8752 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8753 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x8753 != Fp::invalid());
+      if (kCheckRegs && x8753 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][162], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8754 = x8273 * x8747;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18091,25 +18089,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x8806 = x8798 + x8802;
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8807 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x8807 != Fp::invalid());
+      if (kCheckRegs && x8807 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8808 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x8808 != Fp::invalid());
+      if (kCheckRegs && x8808 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8809 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x8809 != Fp::invalid());
+      if (kCheckRegs && x8809 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8810 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x8810 != Fp::invalid());
+      if (kCheckRegs && x8810 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8811 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x8811 != Fp::invalid());
+      if (kCheckRegs && x8811 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8812 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x8812 != Fp::invalid());
+      if (kCheckRegs && x8812 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8813 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x8813 != Fp::invalid());
+      if (kCheckRegs && x8813 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8814 = x8273 * x8807;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18612,21 +18610,21 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9063 = x9062 + x9059;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x9064 = x9063 + x9058;
-      host_args.at(0) = x9041;
-      host_args.at(1) = x9049;
-      host_args.at(2) = x9057;
-      host_args.at(3) = x9064;
-      host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x9041;
+      host_args[1] = x9049;
+      host_args[2] = x9057;
+      host_args[3] = x9064;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   if (x7 != 0) {
     {
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9065 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x9065 != Fp::invalid());
+      if (kCheckRegs && x9065 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][3], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9066 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x9066 != Fp::invalid());
+      if (kCheckRegs && x9066 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][4], back 0)");
       // loc("Top/BytesHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x9067 = args[3][0];
       // loc("Top/BytesHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -18671,10 +18669,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9087 = x9074 + x9083;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9088 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x9088 != Fp::invalid());
+      if (kCheckRegs && x9088 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][5], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9089 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x9089 != Fp::invalid());
+      if (kCheckRegs && x9089 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][6], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9090 = x9067 * x9088;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18765,10 +18763,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9133 = x9132 + x9127;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9134 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x9134 != Fp::invalid());
+      if (kCheckRegs && x9134 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][7], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9135 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x9135 != Fp::invalid());
+      if (kCheckRegs && x9135 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][8], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9136 = x9067 * x9134;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18859,10 +18857,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9179 = x9178 + x9173;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9180 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x9180 != Fp::invalid());
+      if (kCheckRegs && x9180 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9181 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x9181 != Fp::invalid());
+      if (kCheckRegs && x9181 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9182 = x9067 * x9180;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18891,10 +18889,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9194 = x9185 + x9190;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9195 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x9195 != Fp::invalid());
+      if (kCheckRegs && x9195 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9196 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x9196 != Fp::invalid());
+      if (kCheckRegs && x9196 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9197 = x9067 * x9195;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18985,10 +18983,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9240 = x9239 + x9234;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9241 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x9241 != Fp::invalid());
+      if (kCheckRegs && x9241 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9242 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x9242 != Fp::invalid());
+      if (kCheckRegs && x9242 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9243 = x9067 * x9241;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19079,10 +19077,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9286 = x9285 + x9280;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9287 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x9287 != Fp::invalid());
+      if (kCheckRegs && x9287 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9288 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x9288 != Fp::invalid());
+      if (kCheckRegs && x9288 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9289 = x9067 * x9287;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19111,10 +19109,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9301 = x9292 + x9297;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9302 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x9302 != Fp::invalid());
+      if (kCheckRegs && x9302 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9303 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x9303 != Fp::invalid());
+      if (kCheckRegs && x9303 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9304 = x9067 * x9302;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19205,10 +19203,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9347 = x9346 + x9341;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9348 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x9348 != Fp::invalid());
+      if (kCheckRegs && x9348 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9349 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x9349 != Fp::invalid());
+      if (kCheckRegs && x9349 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9350 = x9067 * x9348;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19299,10 +19297,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9393 = x9392 + x9387;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9394 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x9394 != Fp::invalid());
+      if (kCheckRegs && x9394 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9395 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x9395 != Fp::invalid());
+      if (kCheckRegs && x9395 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9396 = x9067 * x9394;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19331,10 +19329,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9408 = x9399 + x9404;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9409 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x9409 != Fp::invalid());
+      if (kCheckRegs && x9409 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9410 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x9410 != Fp::invalid());
+      if (kCheckRegs && x9410 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9411 = x9067 * x9409;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19425,10 +19423,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9454 = x9453 + x9448;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9455 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x9455 != Fp::invalid());
+      if (kCheckRegs && x9455 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9456 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x9456 != Fp::invalid());
+      if (kCheckRegs && x9456 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9457 = x9067 * x9455;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19519,10 +19517,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9500 = x9499 + x9494;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9501 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x9501 != Fp::invalid());
+      if (kCheckRegs && x9501 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9502 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x9502 != Fp::invalid());
+      if (kCheckRegs && x9502 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9503 = x9067 * x9501;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19551,10 +19549,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9515 = x9506 + x9511;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9516 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x9516 != Fp::invalid());
+      if (kCheckRegs && x9516 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9517 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x9517 != Fp::invalid());
+      if (kCheckRegs && x9517 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9518 = x9067 * x9516;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19645,10 +19643,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9561 = x9560 + x9555;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9562 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x9562 != Fp::invalid());
+      if (kCheckRegs && x9562 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9563 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x9563 != Fp::invalid());
+      if (kCheckRegs && x9563 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9564 = x9067 * x9562;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19739,10 +19737,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9607 = x9606 + x9601;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9608 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x9608 != Fp::invalid());
+      if (kCheckRegs && x9608 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9609 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x9609 != Fp::invalid());
+      if (kCheckRegs && x9609 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9610 = x9067 * x9608;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19771,10 +19769,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9622 = x9613 + x9618;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9623 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x9623 != Fp::invalid());
+      if (kCheckRegs && x9623 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9624 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x9624 != Fp::invalid());
+      if (kCheckRegs && x9624 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9625 = x9067 * x9623;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19865,10 +19863,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9668 = x9667 + x9662;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9669 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x9669 != Fp::invalid());
+      if (kCheckRegs && x9669 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9670 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x9670 != Fp::invalid());
+      if (kCheckRegs && x9670 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9671 = x9067 * x9669;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19897,10 +19895,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9683 = x9674 + x9679;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9684 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x9684 != Fp::invalid());
+      if (kCheckRegs && x9684 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9685 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x9685 != Fp::invalid());
+      if (kCheckRegs && x9685 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9686 = x9067 * x9684;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19991,10 +19989,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9729 = x9728 + x9723;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9730 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x9730 != Fp::invalid());
+      if (kCheckRegs && x9730 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9731 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x9731 != Fp::invalid());
+      if (kCheckRegs && x9731 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9732 = x9067 * x9730;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20085,10 +20083,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9775 = x9774 + x9769;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9776 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x9776 != Fp::invalid());
+      if (kCheckRegs && x9776 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9777 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x9777 != Fp::invalid());
+      if (kCheckRegs && x9777 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9778 = x9067 * x9776;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20117,10 +20115,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9790 = x9781 + x9786;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9791 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x9791 != Fp::invalid());
+      if (kCheckRegs && x9791 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9792 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x9792 != Fp::invalid());
+      if (kCheckRegs && x9792 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9793 = x9067 * x9791;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20211,10 +20209,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9836 = x9835 + x9830;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9837 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x9837 != Fp::invalid());
+      if (kCheckRegs && x9837 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9838 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x9838 != Fp::invalid());
+      if (kCheckRegs && x9838 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9839 = x9067 * x9837;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20305,10 +20303,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9882 = x9881 + x9876;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9883 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x9883 != Fp::invalid());
+      if (kCheckRegs && x9883 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9884 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x9884 != Fp::invalid());
+      if (kCheckRegs && x9884 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9885 = x9067 * x9883;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20337,10 +20335,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9897 = x9888 + x9893;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9898 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x9898 != Fp::invalid());
+      if (kCheckRegs && x9898 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9899 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x9899 != Fp::invalid());
+      if (kCheckRegs && x9899 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9900 = x9067 * x9898;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20431,10 +20429,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9943 = x9942 + x9937;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9944 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x9944 != Fp::invalid());
+      if (kCheckRegs && x9944 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9945 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x9945 != Fp::invalid());
+      if (kCheckRegs && x9945 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9946 = x9067 * x9944;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20525,10 +20523,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x9989 = x9988 + x9983;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9990 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x9990 != Fp::invalid());
+      if (kCheckRegs && x9990 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9991 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x9991 != Fp::invalid());
+      if (kCheckRegs && x9991 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9992 = x9067 * x9990;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20557,10 +20555,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10004 = x9995 + x10000;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10005 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x10005 != Fp::invalid());
+      if (kCheckRegs && x10005 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10006 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x10006 != Fp::invalid());
+      if (kCheckRegs && x10006 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10007 = x9067 * x10005;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20651,10 +20649,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10050 = x10049 + x10044;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10051 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x10051 != Fp::invalid());
+      if (kCheckRegs && x10051 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10052 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x10052 != Fp::invalid());
+      if (kCheckRegs && x10052 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10053 = x9067 * x10051;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20745,10 +20743,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10096 = x10095 + x10090;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10097 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x10097 != Fp::invalid());
+      if (kCheckRegs && x10097 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10098 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x10098 != Fp::invalid());
+      if (kCheckRegs && x10098 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10099 = x9067 * x10097;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20777,10 +20775,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10111 = x10102 + x10107;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10112 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x10112 != Fp::invalid());
+      if (kCheckRegs && x10112 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10113 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x10113 != Fp::invalid());
+      if (kCheckRegs && x10113 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10114 = x9067 * x10112;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20871,10 +20869,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10157 = x10156 + x10151;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10158 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x10158 != Fp::invalid());
+      if (kCheckRegs && x10158 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10159 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x10159 != Fp::invalid());
+      if (kCheckRegs && x10159 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10160 = x9067 * x10158;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20965,10 +20963,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10203 = x10202 + x10197;
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10204 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x10204 != Fp::invalid());
+      if (kCheckRegs && x10204 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10205 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x10205 != Fp::invalid());
+      if (kCheckRegs && x10205 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10206 = x9067 * x10204;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20997,10 +20995,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10218 = x10209 + x10214;
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10219 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x10219 != Fp::invalid());
+      if (kCheckRegs && x10219 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10220 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x10220 != Fp::invalid());
+      if (kCheckRegs && x10220 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10221 = x9067 * x10219;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -22215,38 +22213,38 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x10826 = x10825 + x10822;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x10827 = x10826 + x10821;
-      host_args.at(0) = x10804;
-      host_args.at(1) = x10812;
-      host_args.at(2) = x10820;
-      host_args.at(3) = x10827;
-      host(ctx, "plonkWriteAccum", "bytes", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x10804;
+      host_args[1] = x10812;
+      host_args[2] = x10820;
+      host_args[3] = x10827;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraBytes, "bytes", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x10828 = args[2][100 * steps + ((cycle - 0) & mask)];
-    assert(x10828 != Fp::invalid());
+    if (kCheckRegs && x10828 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][100], back 0)");
     if (x10828 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10829 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x10829 != Fp::invalid());
+        if (kCheckRegs && x10829 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10830 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x10830 != Fp::invalid());
+        if (kCheckRegs && x10830 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10831 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x10831 != Fp::invalid());
+        if (kCheckRegs && x10831 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10832 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x10832 != Fp::invalid());
+        if (kCheckRegs && x10832 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10833 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x10833 != Fp::invalid());
+        if (kCheckRegs && x10833 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10834 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x10834 != Fp::invalid());
+        if (kCheckRegs && x10834 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10835 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x10835 != Fp::invalid());
+        if (kCheckRegs && x10835 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x10836 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -22411,25 +22409,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x10916 = x10904 + x10912;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10917 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x10917 != Fp::invalid());
+        if (kCheckRegs && x10917 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10918 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x10918 != Fp::invalid());
+        if (kCheckRegs && x10918 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10919 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x10919 != Fp::invalid());
+        if (kCheckRegs && x10919 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10920 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x10920 != Fp::invalid());
+        if (kCheckRegs && x10920 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10921 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x10921 != Fp::invalid());
+        if (kCheckRegs && x10921 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10922 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x10922 != Fp::invalid());
+        if (kCheckRegs && x10922 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x10923 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x10923 != Fp::invalid());
+        if (kCheckRegs && x10923 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x10924 = x10836 * x10917;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -22600,25 +22598,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11007 = x11006 + x11001;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11008 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x11008 != Fp::invalid());
+        if (kCheckRegs && x11008 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11009 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x11009 != Fp::invalid());
+        if (kCheckRegs && x11009 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11010 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x11010 != Fp::invalid());
+        if (kCheckRegs && x11010 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11011 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x11011 != Fp::invalid());
+        if (kCheckRegs && x11011 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11012 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x11012 != Fp::invalid());
+        if (kCheckRegs && x11012 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11013 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x11013 != Fp::invalid());
+        if (kCheckRegs && x11013 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11014 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x11014 != Fp::invalid());
+        if (kCheckRegs && x11014 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11015 = x10836 * x11008;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -22727,25 +22725,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11067 = x11059 + x11063;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11068 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x11068 != Fp::invalid());
+        if (kCheckRegs && x11068 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11069 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x11069 != Fp::invalid());
+        if (kCheckRegs && x11069 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11070 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x11070 != Fp::invalid());
+        if (kCheckRegs && x11070 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11071 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x11071 != Fp::invalid());
+        if (kCheckRegs && x11071 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11072 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x11072 != Fp::invalid());
+        if (kCheckRegs && x11072 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11073 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x11073 != Fp::invalid());
+        if (kCheckRegs && x11073 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11074 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x11074 != Fp::invalid());
+        if (kCheckRegs && x11074 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11075 = x10836 * x11068;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -22916,25 +22914,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11158 = x11157 + x11152;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11159 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x11159 != Fp::invalid());
+        if (kCheckRegs && x11159 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11160 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x11160 != Fp::invalid());
+        if (kCheckRegs && x11160 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11161 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x11161 != Fp::invalid());
+        if (kCheckRegs && x11161 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11162 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x11162 != Fp::invalid());
+        if (kCheckRegs && x11162 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11163 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x11163 != Fp::invalid());
+        if (kCheckRegs && x11163 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11164 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x11164 != Fp::invalid());
+        if (kCheckRegs && x11164 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11165 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x11165 != Fp::invalid());
+        if (kCheckRegs && x11165 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11166 = x10836 * x11159;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -23043,25 +23041,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11218 = x11210 + x11214;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11219 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x11219 != Fp::invalid());
+        if (kCheckRegs && x11219 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11220 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x11220 != Fp::invalid());
+        if (kCheckRegs && x11220 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11221 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x11221 != Fp::invalid());
+        if (kCheckRegs && x11221 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11222 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x11222 != Fp::invalid());
+        if (kCheckRegs && x11222 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11223 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x11223 != Fp::invalid());
+        if (kCheckRegs && x11223 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11224 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x11224 != Fp::invalid());
+        if (kCheckRegs && x11224 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11225 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x11225 != Fp::invalid());
+        if (kCheckRegs && x11225 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11226 = x10836 * x11219;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -23232,25 +23230,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11309 = x11308 + x11303;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11310 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x11310 != Fp::invalid());
+        if (kCheckRegs && x11310 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11311 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x11311 != Fp::invalid());
+        if (kCheckRegs && x11311 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11312 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x11312 != Fp::invalid());
+        if (kCheckRegs && x11312 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11313 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x11313 != Fp::invalid());
+        if (kCheckRegs && x11313 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11314 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x11314 != Fp::invalid());
+        if (kCheckRegs && x11314 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11315 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x11315 != Fp::invalid());
+        if (kCheckRegs && x11315 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11316 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x11316 != Fp::invalid());
+        if (kCheckRegs && x11316 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11317 = x10836 * x11310;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -23359,25 +23357,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11369 = x11361 + x11365;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11370 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x11370 != Fp::invalid());
+        if (kCheckRegs && x11370 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11371 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x11371 != Fp::invalid());
+        if (kCheckRegs && x11371 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11372 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x11372 != Fp::invalid());
+        if (kCheckRegs && x11372 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11373 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x11373 != Fp::invalid());
+        if (kCheckRegs && x11373 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11374 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x11374 != Fp::invalid());
+        if (kCheckRegs && x11374 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11375 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x11375 != Fp::invalid());
+        if (kCheckRegs && x11375 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11376 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x11376 != Fp::invalid());
+        if (kCheckRegs && x11376 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11377 = x10836 * x11370;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -23880,39 +23878,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11626 = x11625 + x11622;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x11627 = x11626 + x11621;
-        host_args.at(0) = x11604;
-        host_args.at(1) = x11612;
-        host_args.at(2) = x11620;
-        host_args.at(3) = x11627;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x11604;
+        host_args[1] = x11612;
+        host_args[2] = x11620;
+        host_args[3] = x11627;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x11628 = args[2][101 * steps + ((cycle - 0) & mask)];
-    assert(x11628 != Fp::invalid());
+    if (kCheckRegs && x11628 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][101], back 0)");
     if (x11628 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11629 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x11629 != Fp::invalid());
+        if (kCheckRegs && x11629 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11630 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x11630 != Fp::invalid());
+        if (kCheckRegs && x11630 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11631 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x11631 != Fp::invalid());
+        if (kCheckRegs && x11631 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11632 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x11632 != Fp::invalid());
+        if (kCheckRegs && x11632 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11633 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x11633 != Fp::invalid());
+        if (kCheckRegs && x11633 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11634 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x11634 != Fp::invalid());
+        if (kCheckRegs && x11634 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11635 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x11635 != Fp::invalid());
+        if (kCheckRegs && x11635 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x11636 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -24077,25 +24075,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11716 = x11704 + x11712;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11717 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x11717 != Fp::invalid());
+        if (kCheckRegs && x11717 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11718 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x11718 != Fp::invalid());
+        if (kCheckRegs && x11718 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11719 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x11719 != Fp::invalid());
+        if (kCheckRegs && x11719 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11720 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x11720 != Fp::invalid());
+        if (kCheckRegs && x11720 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11721 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x11721 != Fp::invalid());
+        if (kCheckRegs && x11721 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11722 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x11722 != Fp::invalid());
+        if (kCheckRegs && x11722 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11723 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x11723 != Fp::invalid());
+        if (kCheckRegs && x11723 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11724 = x11636 * x11717;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -24266,25 +24264,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11807 = x11806 + x11801;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11808 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x11808 != Fp::invalid());
+        if (kCheckRegs && x11808 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11809 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x11809 != Fp::invalid());
+        if (kCheckRegs && x11809 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11810 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x11810 != Fp::invalid());
+        if (kCheckRegs && x11810 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11811 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x11811 != Fp::invalid());
+        if (kCheckRegs && x11811 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11812 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x11812 != Fp::invalid());
+        if (kCheckRegs && x11812 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11813 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x11813 != Fp::invalid());
+        if (kCheckRegs && x11813 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11814 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x11814 != Fp::invalid());
+        if (kCheckRegs && x11814 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11815 = x11636 * x11808;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -24393,25 +24391,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11867 = x11859 + x11863;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11868 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x11868 != Fp::invalid());
+        if (kCheckRegs && x11868 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11869 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x11869 != Fp::invalid());
+        if (kCheckRegs && x11869 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11870 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x11870 != Fp::invalid());
+        if (kCheckRegs && x11870 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11871 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x11871 != Fp::invalid());
+        if (kCheckRegs && x11871 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11872 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x11872 != Fp::invalid());
+        if (kCheckRegs && x11872 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11873 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x11873 != Fp::invalid());
+        if (kCheckRegs && x11873 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11874 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x11874 != Fp::invalid());
+        if (kCheckRegs && x11874 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11875 = x11636 * x11868;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -24582,25 +24580,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x11958 = x11957 + x11952;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11959 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x11959 != Fp::invalid());
+        if (kCheckRegs && x11959 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11960 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x11960 != Fp::invalid());
+        if (kCheckRegs && x11960 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11961 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x11961 != Fp::invalid());
+        if (kCheckRegs && x11961 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11962 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x11962 != Fp::invalid());
+        if (kCheckRegs && x11962 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11963 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x11963 != Fp::invalid());
+        if (kCheckRegs && x11963 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11964 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x11964 != Fp::invalid());
+        if (kCheckRegs && x11964 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x11965 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x11965 != Fp::invalid());
+        if (kCheckRegs && x11965 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x11966 = x11636 * x11959;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -24709,25 +24707,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12018 = x12010 + x12014;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12019 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x12019 != Fp::invalid());
+        if (kCheckRegs && x12019 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12020 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x12020 != Fp::invalid());
+        if (kCheckRegs && x12020 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12021 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x12021 != Fp::invalid());
+        if (kCheckRegs && x12021 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12022 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x12022 != Fp::invalid());
+        if (kCheckRegs && x12022 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12023 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x12023 != Fp::invalid());
+        if (kCheckRegs && x12023 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12024 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x12024 != Fp::invalid());
+        if (kCheckRegs && x12024 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12025 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x12025 != Fp::invalid());
+        if (kCheckRegs && x12025 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12026 = x11636 * x12019;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -24898,25 +24896,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12109 = x12108 + x12103;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12110 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x12110 != Fp::invalid());
+        if (kCheckRegs && x12110 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12111 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x12111 != Fp::invalid());
+        if (kCheckRegs && x12111 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12112 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x12112 != Fp::invalid());
+        if (kCheckRegs && x12112 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12113 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x12113 != Fp::invalid());
+        if (kCheckRegs && x12113 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12114 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x12114 != Fp::invalid());
+        if (kCheckRegs && x12114 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12115 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x12115 != Fp::invalid());
+        if (kCheckRegs && x12115 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12116 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x12116 != Fp::invalid());
+        if (kCheckRegs && x12116 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12117 = x11636 * x12110;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -25025,25 +25023,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12169 = x12161 + x12165;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12170 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x12170 != Fp::invalid());
+        if (kCheckRegs && x12170 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12171 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x12171 != Fp::invalid());
+        if (kCheckRegs && x12171 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12172 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x12172 != Fp::invalid());
+        if (kCheckRegs && x12172 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12173 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x12173 != Fp::invalid());
+        if (kCheckRegs && x12173 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12174 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x12174 != Fp::invalid());
+        if (kCheckRegs && x12174 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12175 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x12175 != Fp::invalid());
+        if (kCheckRegs && x12175 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12176 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x12176 != Fp::invalid());
+        if (kCheckRegs && x12176 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12177 = x11636 * x12170;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -25546,39 +25544,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12426 = x12425 + x12422;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x12427 = x12426 + x12421;
-        host_args.at(0) = x12404;
-        host_args.at(1) = x12412;
-        host_args.at(2) = x12420;
-        host_args.at(3) = x12427;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x12404;
+        host_args[1] = x12412;
+        host_args[2] = x12420;
+        host_args[3] = x12427;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12428 = args[2][102 * steps + ((cycle - 0) & mask)];
-    assert(x12428 != Fp::invalid());
+    if (kCheckRegs && x12428 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][102], back 0)");
     if (x12428 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12429 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x12429 != Fp::invalid());
+        if (kCheckRegs && x12429 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12430 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x12430 != Fp::invalid());
+        if (kCheckRegs && x12430 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12431 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x12431 != Fp::invalid());
+        if (kCheckRegs && x12431 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12432 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x12432 != Fp::invalid());
+        if (kCheckRegs && x12432 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12433 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x12433 != Fp::invalid());
+        if (kCheckRegs && x12433 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12434 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x12434 != Fp::invalid());
+        if (kCheckRegs && x12434 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12435 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x12435 != Fp::invalid());
+        if (kCheckRegs && x12435 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x12436 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -25743,25 +25741,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12516 = x12504 + x12512;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12517 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x12517 != Fp::invalid());
+        if (kCheckRegs && x12517 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12518 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x12518 != Fp::invalid());
+        if (kCheckRegs && x12518 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12519 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x12519 != Fp::invalid());
+        if (kCheckRegs && x12519 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12520 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x12520 != Fp::invalid());
+        if (kCheckRegs && x12520 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12521 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x12521 != Fp::invalid());
+        if (kCheckRegs && x12521 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12522 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x12522 != Fp::invalid());
+        if (kCheckRegs && x12522 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12523 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x12523 != Fp::invalid());
+        if (kCheckRegs && x12523 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12524 = x12436 * x12517;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -25932,25 +25930,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12607 = x12606 + x12601;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12608 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x12608 != Fp::invalid());
+        if (kCheckRegs && x12608 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12609 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x12609 != Fp::invalid());
+        if (kCheckRegs && x12609 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12610 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x12610 != Fp::invalid());
+        if (kCheckRegs && x12610 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12611 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x12611 != Fp::invalid());
+        if (kCheckRegs && x12611 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12612 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x12612 != Fp::invalid());
+        if (kCheckRegs && x12612 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12613 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x12613 != Fp::invalid());
+        if (kCheckRegs && x12613 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12614 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x12614 != Fp::invalid());
+        if (kCheckRegs && x12614 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12615 = x12436 * x12608;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -26059,25 +26057,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12667 = x12659 + x12663;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12668 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x12668 != Fp::invalid());
+        if (kCheckRegs && x12668 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12669 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x12669 != Fp::invalid());
+        if (kCheckRegs && x12669 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12670 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x12670 != Fp::invalid());
+        if (kCheckRegs && x12670 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12671 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x12671 != Fp::invalid());
+        if (kCheckRegs && x12671 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12672 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x12672 != Fp::invalid());
+        if (kCheckRegs && x12672 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12673 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x12673 != Fp::invalid());
+        if (kCheckRegs && x12673 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12674 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x12674 != Fp::invalid());
+        if (kCheckRegs && x12674 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12675 = x12436 * x12668;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -26248,25 +26246,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12758 = x12757 + x12752;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12759 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x12759 != Fp::invalid());
+        if (kCheckRegs && x12759 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12760 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x12760 != Fp::invalid());
+        if (kCheckRegs && x12760 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12761 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x12761 != Fp::invalid());
+        if (kCheckRegs && x12761 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12762 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x12762 != Fp::invalid());
+        if (kCheckRegs && x12762 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12763 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x12763 != Fp::invalid());
+        if (kCheckRegs && x12763 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12764 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x12764 != Fp::invalid());
+        if (kCheckRegs && x12764 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12765 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x12765 != Fp::invalid());
+        if (kCheckRegs && x12765 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12766 = x12436 * x12759;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -26375,25 +26373,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12818 = x12810 + x12814;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12819 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x12819 != Fp::invalid());
+        if (kCheckRegs && x12819 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12820 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x12820 != Fp::invalid());
+        if (kCheckRegs && x12820 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12821 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x12821 != Fp::invalid());
+        if (kCheckRegs && x12821 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12822 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x12822 != Fp::invalid());
+        if (kCheckRegs && x12822 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12823 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x12823 != Fp::invalid());
+        if (kCheckRegs && x12823 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12824 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x12824 != Fp::invalid());
+        if (kCheckRegs && x12824 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12825 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x12825 != Fp::invalid());
+        if (kCheckRegs && x12825 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12826 = x12436 * x12819;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -26564,25 +26562,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12909 = x12908 + x12903;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12910 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x12910 != Fp::invalid());
+        if (kCheckRegs && x12910 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12911 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x12911 != Fp::invalid());
+        if (kCheckRegs && x12911 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12912 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x12912 != Fp::invalid());
+        if (kCheckRegs && x12912 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12913 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x12913 != Fp::invalid());
+        if (kCheckRegs && x12913 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12914 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x12914 != Fp::invalid());
+        if (kCheckRegs && x12914 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12915 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x12915 != Fp::invalid());
+        if (kCheckRegs && x12915 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12916 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x12916 != Fp::invalid());
+        if (kCheckRegs && x12916 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12917 = x12436 * x12910;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -26691,25 +26689,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x12969 = x12961 + x12965;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12970 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x12970 != Fp::invalid());
+        if (kCheckRegs && x12970 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12971 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x12971 != Fp::invalid());
+        if (kCheckRegs && x12971 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12972 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x12972 != Fp::invalid());
+        if (kCheckRegs && x12972 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12973 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x12973 != Fp::invalid());
+        if (kCheckRegs && x12973 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12974 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x12974 != Fp::invalid());
+        if (kCheckRegs && x12974 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12975 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x12975 != Fp::invalid());
+        if (kCheckRegs && x12975 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x12976 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x12976 != Fp::invalid());
+        if (kCheckRegs && x12976 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x12977 = x12436 * x12970;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -27212,39 +27210,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13226 = x13225 + x13222;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x13227 = x13226 + x13221;
-        host_args.at(0) = x13204;
-        host_args.at(1) = x13212;
-        host_args.at(2) = x13220;
-        host_args.at(3) = x13227;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x13204;
+        host_args[1] = x13212;
+        host_args[2] = x13220;
+        host_args[3] = x13227;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x13228 = args[2][103 * steps + ((cycle - 0) & mask)];
-    assert(x13228 != Fp::invalid());
+    if (kCheckRegs && x13228 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][103], back 0)");
     if (x13228 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13229 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x13229 != Fp::invalid());
+        if (kCheckRegs && x13229 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13230 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x13230 != Fp::invalid());
+        if (kCheckRegs && x13230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13231 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x13231 != Fp::invalid());
+        if (kCheckRegs && x13231 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13232 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x13232 != Fp::invalid());
+        if (kCheckRegs && x13232 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13233 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x13233 != Fp::invalid());
+        if (kCheckRegs && x13233 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13234 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x13234 != Fp::invalid());
+        if (kCheckRegs && x13234 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13235 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x13235 != Fp::invalid());
+        if (kCheckRegs && x13235 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x13236 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -27409,25 +27407,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13316 = x13304 + x13312;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13317 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x13317 != Fp::invalid());
+        if (kCheckRegs && x13317 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13318 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x13318 != Fp::invalid());
+        if (kCheckRegs && x13318 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13319 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x13319 != Fp::invalid());
+        if (kCheckRegs && x13319 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13320 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x13320 != Fp::invalid());
+        if (kCheckRegs && x13320 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13321 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x13321 != Fp::invalid());
+        if (kCheckRegs && x13321 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13322 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x13322 != Fp::invalid());
+        if (kCheckRegs && x13322 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13323 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x13323 != Fp::invalid());
+        if (kCheckRegs && x13323 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13324 = x13236 * x13317;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -27598,25 +27596,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13407 = x13406 + x13401;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13408 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x13408 != Fp::invalid());
+        if (kCheckRegs && x13408 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13409 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x13409 != Fp::invalid());
+        if (kCheckRegs && x13409 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13410 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x13410 != Fp::invalid());
+        if (kCheckRegs && x13410 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13411 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x13411 != Fp::invalid());
+        if (kCheckRegs && x13411 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13412 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x13412 != Fp::invalid());
+        if (kCheckRegs && x13412 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13413 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x13413 != Fp::invalid());
+        if (kCheckRegs && x13413 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13414 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x13414 != Fp::invalid());
+        if (kCheckRegs && x13414 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13415 = x13236 * x13408;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -27725,25 +27723,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13467 = x13459 + x13463;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13468 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x13468 != Fp::invalid());
+        if (kCheckRegs && x13468 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13469 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x13469 != Fp::invalid());
+        if (kCheckRegs && x13469 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13470 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x13470 != Fp::invalid());
+        if (kCheckRegs && x13470 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13471 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x13471 != Fp::invalid());
+        if (kCheckRegs && x13471 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13472 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x13472 != Fp::invalid());
+        if (kCheckRegs && x13472 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13473 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x13473 != Fp::invalid());
+        if (kCheckRegs && x13473 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13474 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x13474 != Fp::invalid());
+        if (kCheckRegs && x13474 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13475 = x13236 * x13468;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -27914,25 +27912,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13558 = x13557 + x13552;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13559 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x13559 != Fp::invalid());
+        if (kCheckRegs && x13559 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13560 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x13560 != Fp::invalid());
+        if (kCheckRegs && x13560 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13561 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x13561 != Fp::invalid());
+        if (kCheckRegs && x13561 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13562 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x13562 != Fp::invalid());
+        if (kCheckRegs && x13562 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13563 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x13563 != Fp::invalid());
+        if (kCheckRegs && x13563 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13564 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x13564 != Fp::invalid());
+        if (kCheckRegs && x13564 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13565 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x13565 != Fp::invalid());
+        if (kCheckRegs && x13565 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13566 = x13236 * x13559;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -28041,25 +28039,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13618 = x13610 + x13614;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13619 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x13619 != Fp::invalid());
+        if (kCheckRegs && x13619 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13620 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x13620 != Fp::invalid());
+        if (kCheckRegs && x13620 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13621 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x13621 != Fp::invalid());
+        if (kCheckRegs && x13621 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13622 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x13622 != Fp::invalid());
+        if (kCheckRegs && x13622 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13623 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x13623 != Fp::invalid());
+        if (kCheckRegs && x13623 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13624 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x13624 != Fp::invalid());
+        if (kCheckRegs && x13624 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13625 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x13625 != Fp::invalid());
+        if (kCheckRegs && x13625 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13626 = x13236 * x13619;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -28168,25 +28166,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13678 = x13670 + x13674;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13679 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x13679 != Fp::invalid());
+        if (kCheckRegs && x13679 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13680 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x13680 != Fp::invalid());
+        if (kCheckRegs && x13680 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13681 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x13681 != Fp::invalid());
+        if (kCheckRegs && x13681 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13682 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x13682 != Fp::invalid());
+        if (kCheckRegs && x13682 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13683 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x13683 != Fp::invalid());
+        if (kCheckRegs && x13683 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13684 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x13684 != Fp::invalid());
+        if (kCheckRegs && x13684 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13685 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x13685 != Fp::invalid());
+        if (kCheckRegs && x13685 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13686 = x13236 * x13679;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -28357,25 +28355,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13769 = x13768 + x13763;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13770 = args[2][165 * steps + ((cycle - 0) & mask)];
-        assert(x13770 != Fp::invalid());
+        if (kCheckRegs && x13770 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][165], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13771 = args[2][166 * steps + ((cycle - 0) & mask)];
-        assert(x13771 != Fp::invalid());
+        if (kCheckRegs && x13771 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][166], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13772 = args[2][167 * steps + ((cycle - 0) & mask)];
-        assert(x13772 != Fp::invalid());
+        if (kCheckRegs && x13772 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][167], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13773 = args[2][168 * steps + ((cycle - 0) & mask)];
-        assert(x13773 != Fp::invalid());
+        if (kCheckRegs && x13773 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][168], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13774 = args[2][169 * steps + ((cycle - 0) & mask)];
-        assert(x13774 != Fp::invalid());
+        if (kCheckRegs && x13774 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][169], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13775 = args[2][170 * steps + ((cycle - 0) & mask)];
-        assert(x13775 != Fp::invalid());
+        if (kCheckRegs && x13775 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][170], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13776 = args[2][171 * steps + ((cycle - 0) & mask)];
-        assert(x13776 != Fp::invalid());
+        if (kCheckRegs && x13776 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][171], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13777 = x13236 * x13770;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -28484,25 +28482,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13829 = x13821 + x13825;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13830 = args[2][172 * steps + ((cycle - 0) & mask)];
-        assert(x13830 != Fp::invalid());
+        if (kCheckRegs && x13830 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][172], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13831 = args[2][173 * steps + ((cycle - 0) & mask)];
-        assert(x13831 != Fp::invalid());
+        if (kCheckRegs && x13831 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][173], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13832 = args[2][174 * steps + ((cycle - 0) & mask)];
-        assert(x13832 != Fp::invalid());
+        if (kCheckRegs && x13832 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][174], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13833 = args[2][175 * steps + ((cycle - 0) & mask)];
-        assert(x13833 != Fp::invalid());
+        if (kCheckRegs && x13833 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][175], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13834 = args[2][176 * steps + ((cycle - 0) & mask)];
-        assert(x13834 != Fp::invalid());
+        if (kCheckRegs && x13834 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][176], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13835 = args[2][177 * steps + ((cycle - 0) & mask)];
-        assert(x13835 != Fp::invalid());
+        if (kCheckRegs && x13835 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][177], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13836 = args[2][178 * steps + ((cycle - 0) & mask)];
-        assert(x13836 != Fp::invalid());
+        if (kCheckRegs && x13836 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][178], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13837 = x13236 * x13830;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -28673,25 +28671,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x13920 = x13919 + x13914;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13921 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x13921 != Fp::invalid());
+        if (kCheckRegs && x13921 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13922 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x13922 != Fp::invalid());
+        if (kCheckRegs && x13922 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13923 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x13923 != Fp::invalid());
+        if (kCheckRegs && x13923 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13924 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x13924 != Fp::invalid());
+        if (kCheckRegs && x13924 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13925 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x13925 != Fp::invalid());
+        if (kCheckRegs && x13925 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13926 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x13926 != Fp::invalid());
+        if (kCheckRegs && x13926 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x13927 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x13927 != Fp::invalid());
+        if (kCheckRegs && x13927 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x13928 = x13236 * x13921;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -29330,39 +29328,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14245 = x14244 + x14241;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x14246 = x14245 + x14240;
-        host_args.at(0) = x14223;
-        host_args.at(1) = x14231;
-        host_args.at(2) = x14239;
-        host_args.at(3) = x14246;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x14223;
+        host_args[1] = x14231;
+        host_args[2] = x14239;
+        host_args[3] = x14246;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x14247 = args[2][104 * steps + ((cycle - 0) & mask)];
-    assert(x14247 != Fp::invalid());
+    if (kCheckRegs && x14247 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][104], back 0)");
     if (x14247 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14248 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x14248 != Fp::invalid());
+        if (kCheckRegs && x14248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14249 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x14249 != Fp::invalid());
+        if (kCheckRegs && x14249 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14250 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x14250 != Fp::invalid());
+        if (kCheckRegs && x14250 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14251 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x14251 != Fp::invalid());
+        if (kCheckRegs && x14251 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14252 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x14252 != Fp::invalid());
+        if (kCheckRegs && x14252 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14253 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x14253 != Fp::invalid());
+        if (kCheckRegs && x14253 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14254 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x14254 != Fp::invalid());
+        if (kCheckRegs && x14254 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x14255 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -29527,25 +29525,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14335 = x14323 + x14331;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14336 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x14336 != Fp::invalid());
+        if (kCheckRegs && x14336 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14337 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x14337 != Fp::invalid());
+        if (kCheckRegs && x14337 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14338 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x14338 != Fp::invalid());
+        if (kCheckRegs && x14338 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14339 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x14339 != Fp::invalid());
+        if (kCheckRegs && x14339 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14340 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x14340 != Fp::invalid());
+        if (kCheckRegs && x14340 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14341 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x14341 != Fp::invalid());
+        if (kCheckRegs && x14341 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14342 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x14342 != Fp::invalid());
+        if (kCheckRegs && x14342 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14343 = x14255 * x14336;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -29716,25 +29714,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14426 = x14425 + x14420;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14427 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x14427 != Fp::invalid());
+        if (kCheckRegs && x14427 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14428 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x14428 != Fp::invalid());
+        if (kCheckRegs && x14428 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14429 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x14429 != Fp::invalid());
+        if (kCheckRegs && x14429 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14430 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x14430 != Fp::invalid());
+        if (kCheckRegs && x14430 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14431 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x14431 != Fp::invalid());
+        if (kCheckRegs && x14431 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14432 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x14432 != Fp::invalid());
+        if (kCheckRegs && x14432 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14433 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x14433 != Fp::invalid());
+        if (kCheckRegs && x14433 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14434 = x14255 * x14427;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -29843,25 +29841,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14486 = x14478 + x14482;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14487 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x14487 != Fp::invalid());
+        if (kCheckRegs && x14487 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14488 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x14488 != Fp::invalid());
+        if (kCheckRegs && x14488 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14489 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x14489 != Fp::invalid());
+        if (kCheckRegs && x14489 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14490 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x14490 != Fp::invalid());
+        if (kCheckRegs && x14490 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14491 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x14491 != Fp::invalid());
+        if (kCheckRegs && x14491 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14492 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x14492 != Fp::invalid());
+        if (kCheckRegs && x14492 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14493 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x14493 != Fp::invalid());
+        if (kCheckRegs && x14493 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14494 = x14255 * x14487;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -30032,25 +30030,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14577 = x14576 + x14571;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14578 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x14578 != Fp::invalid());
+        if (kCheckRegs && x14578 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14579 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x14579 != Fp::invalid());
+        if (kCheckRegs && x14579 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14580 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x14580 != Fp::invalid());
+        if (kCheckRegs && x14580 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14581 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x14581 != Fp::invalid());
+        if (kCheckRegs && x14581 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14582 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x14582 != Fp::invalid());
+        if (kCheckRegs && x14582 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14583 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x14583 != Fp::invalid());
+        if (kCheckRegs && x14583 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14584 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x14584 != Fp::invalid());
+        if (kCheckRegs && x14584 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14585 = x14255 * x14578;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -30159,25 +30157,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14637 = x14629 + x14633;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14638 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x14638 != Fp::invalid());
+        if (kCheckRegs && x14638 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14639 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x14639 != Fp::invalid());
+        if (kCheckRegs && x14639 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14640 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x14640 != Fp::invalid());
+        if (kCheckRegs && x14640 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14641 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x14641 != Fp::invalid());
+        if (kCheckRegs && x14641 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14642 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x14642 != Fp::invalid());
+        if (kCheckRegs && x14642 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14643 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x14643 != Fp::invalid());
+        if (kCheckRegs && x14643 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14644 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x14644 != Fp::invalid());
+        if (kCheckRegs && x14644 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14645 = x14255 * x14638;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -30348,25 +30346,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14728 = x14727 + x14722;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14729 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x14729 != Fp::invalid());
+        if (kCheckRegs && x14729 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14730 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x14730 != Fp::invalid());
+        if (kCheckRegs && x14730 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14731 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x14731 != Fp::invalid());
+        if (kCheckRegs && x14731 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14732 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x14732 != Fp::invalid());
+        if (kCheckRegs && x14732 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14733 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x14733 != Fp::invalid());
+        if (kCheckRegs && x14733 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14734 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x14734 != Fp::invalid());
+        if (kCheckRegs && x14734 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14735 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x14735 != Fp::invalid());
+        if (kCheckRegs && x14735 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14736 = x14255 * x14729;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -30475,25 +30473,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x14788 = x14780 + x14784;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14789 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x14789 != Fp::invalid());
+        if (kCheckRegs && x14789 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14790 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x14790 != Fp::invalid());
+        if (kCheckRegs && x14790 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14791 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x14791 != Fp::invalid());
+        if (kCheckRegs && x14791 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14792 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x14792 != Fp::invalid());
+        if (kCheckRegs && x14792 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14793 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x14793 != Fp::invalid());
+        if (kCheckRegs && x14793 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14794 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x14794 != Fp::invalid());
+        if (kCheckRegs && x14794 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x14795 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x14795 != Fp::invalid());
+        if (kCheckRegs && x14795 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x14796 = x14255 * x14789;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -30996,39 +30994,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15045 = x15044 + x15041;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x15046 = x15045 + x15040;
-        host_args.at(0) = x15023;
-        host_args.at(1) = x15031;
-        host_args.at(2) = x15039;
-        host_args.at(3) = x15046;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x15023;
+        host_args[1] = x15031;
+        host_args[2] = x15039;
+        host_args[3] = x15046;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x15047 = args[2][105 * steps + ((cycle - 0) & mask)];
-    assert(x15047 != Fp::invalid());
+    if (kCheckRegs && x15047 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][105], back 0)");
     if (x15047 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15048 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x15048 != Fp::invalid());
+        if (kCheckRegs && x15048 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15049 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x15049 != Fp::invalid());
+        if (kCheckRegs && x15049 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15050 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x15050 != Fp::invalid());
+        if (kCheckRegs && x15050 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15051 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x15051 != Fp::invalid());
+        if (kCheckRegs && x15051 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15052 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x15052 != Fp::invalid());
+        if (kCheckRegs && x15052 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15053 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x15053 != Fp::invalid());
+        if (kCheckRegs && x15053 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15054 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x15054 != Fp::invalid());
+        if (kCheckRegs && x15054 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x15055 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -31193,25 +31191,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15135 = x15123 + x15131;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15136 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x15136 != Fp::invalid());
+        if (kCheckRegs && x15136 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15137 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x15137 != Fp::invalid());
+        if (kCheckRegs && x15137 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15138 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x15138 != Fp::invalid());
+        if (kCheckRegs && x15138 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15139 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x15139 != Fp::invalid());
+        if (kCheckRegs && x15139 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15140 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x15140 != Fp::invalid());
+        if (kCheckRegs && x15140 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15141 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x15141 != Fp::invalid());
+        if (kCheckRegs && x15141 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15142 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x15142 != Fp::invalid());
+        if (kCheckRegs && x15142 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15143 = x15055 * x15136;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -31382,25 +31380,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15226 = x15225 + x15220;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15227 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x15227 != Fp::invalid());
+        if (kCheckRegs && x15227 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15228 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x15228 != Fp::invalid());
+        if (kCheckRegs && x15228 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15229 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x15229 != Fp::invalid());
+        if (kCheckRegs && x15229 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15230 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x15230 != Fp::invalid());
+        if (kCheckRegs && x15230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15231 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x15231 != Fp::invalid());
+        if (kCheckRegs && x15231 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15232 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x15232 != Fp::invalid());
+        if (kCheckRegs && x15232 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15233 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x15233 != Fp::invalid());
+        if (kCheckRegs && x15233 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15234 = x15055 * x15227;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -31509,25 +31507,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15286 = x15278 + x15282;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15287 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x15287 != Fp::invalid());
+        if (kCheckRegs && x15287 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15288 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x15288 != Fp::invalid());
+        if (kCheckRegs && x15288 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15289 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x15289 != Fp::invalid());
+        if (kCheckRegs && x15289 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15290 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x15290 != Fp::invalid());
+        if (kCheckRegs && x15290 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15291 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x15291 != Fp::invalid());
+        if (kCheckRegs && x15291 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15292 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x15292 != Fp::invalid());
+        if (kCheckRegs && x15292 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15293 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x15293 != Fp::invalid());
+        if (kCheckRegs && x15293 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15294 = x15055 * x15287;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -31698,25 +31696,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15377 = x15376 + x15371;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15378 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x15378 != Fp::invalid());
+        if (kCheckRegs && x15378 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15379 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x15379 != Fp::invalid());
+        if (kCheckRegs && x15379 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15380 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x15380 != Fp::invalid());
+        if (kCheckRegs && x15380 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15381 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x15381 != Fp::invalid());
+        if (kCheckRegs && x15381 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15382 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x15382 != Fp::invalid());
+        if (kCheckRegs && x15382 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15383 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x15383 != Fp::invalid());
+        if (kCheckRegs && x15383 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15384 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x15384 != Fp::invalid());
+        if (kCheckRegs && x15384 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15385 = x15055 * x15378;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -31825,25 +31823,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15437 = x15429 + x15433;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15438 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x15438 != Fp::invalid());
+        if (kCheckRegs && x15438 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15439 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x15439 != Fp::invalid());
+        if (kCheckRegs && x15439 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15440 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x15440 != Fp::invalid());
+        if (kCheckRegs && x15440 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15441 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x15441 != Fp::invalid());
+        if (kCheckRegs && x15441 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15442 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x15442 != Fp::invalid());
+        if (kCheckRegs && x15442 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15443 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x15443 != Fp::invalid());
+        if (kCheckRegs && x15443 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15444 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x15444 != Fp::invalid());
+        if (kCheckRegs && x15444 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15445 = x15055 * x15438;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -32014,25 +32012,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15528 = x15527 + x15522;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15529 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x15529 != Fp::invalid());
+        if (kCheckRegs && x15529 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15530 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x15530 != Fp::invalid());
+        if (kCheckRegs && x15530 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15531 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x15531 != Fp::invalid());
+        if (kCheckRegs && x15531 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15532 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x15532 != Fp::invalid());
+        if (kCheckRegs && x15532 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15533 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x15533 != Fp::invalid());
+        if (kCheckRegs && x15533 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15534 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x15534 != Fp::invalid());
+        if (kCheckRegs && x15534 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15535 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x15535 != Fp::invalid());
+        if (kCheckRegs && x15535 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15536 = x15055 * x15529;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -32141,25 +32139,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15588 = x15580 + x15584;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15589 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x15589 != Fp::invalid());
+        if (kCheckRegs && x15589 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15590 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x15590 != Fp::invalid());
+        if (kCheckRegs && x15590 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15591 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x15591 != Fp::invalid());
+        if (kCheckRegs && x15591 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15592 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x15592 != Fp::invalid());
+        if (kCheckRegs && x15592 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15593 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x15593 != Fp::invalid());
+        if (kCheckRegs && x15593 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15594 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x15594 != Fp::invalid());
+        if (kCheckRegs && x15594 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15595 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x15595 != Fp::invalid());
+        if (kCheckRegs && x15595 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15596 = x15055 * x15589;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -32662,63 +32660,63 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15845 = x15844 + x15841;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x15846 = x15845 + x15840;
-        host_args.at(0) = x15823;
-        host_args.at(1) = x15831;
-        host_args.at(2) = x15839;
-        host_args.at(3) = x15846;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x15823;
+        host_args[1] = x15831;
+        host_args[2] = x15839;
+        host_args[3] = x15846;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x15847 = args[2][106 * steps + ((cycle - 0) & mask)];
-    assert(x15847 != Fp::invalid());
+    if (kCheckRegs && x15847 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][106], back 0)");
     if (x15847 != 0) {
       {
-        host_args.at(0) = x3;
-        host_args.at(1) = x2;
-        host_args.at(2) = x2;
-        host_args.at(3) = x2;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3;
+        host_args[1] = x2;
+        host_args[2] = x2;
+        host_args[3] = x2;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x15848 = args[2][107 * steps + ((cycle - 0) & mask)];
-    assert(x15848 != Fp::invalid());
+    if (kCheckRegs && x15848 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][107], back 0)");
     if (x15848 != 0) {
       {
-        host_args.at(0) = x3;
-        host_args.at(1) = x2;
-        host_args.at(2) = x2;
-        host_args.at(3) = x2;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3;
+        host_args[1] = x2;
+        host_args[2] = x2;
+        host_args[3] = x2;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x15849 = args[2][108 * steps + ((cycle - 0) & mask)];
-    assert(x15849 != Fp::invalid());
+    if (kCheckRegs && x15849 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][108], back 0)");
     if (x15849 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15850 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x15850 != Fp::invalid());
+        if (kCheckRegs && x15850 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15851 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x15851 != Fp::invalid());
+        if (kCheckRegs && x15851 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15852 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x15852 != Fp::invalid());
+        if (kCheckRegs && x15852 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15853 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x15853 != Fp::invalid());
+        if (kCheckRegs && x15853 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15854 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x15854 != Fp::invalid());
+        if (kCheckRegs && x15854 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15855 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x15855 != Fp::invalid());
+        if (kCheckRegs && x15855 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15856 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x15856 != Fp::invalid());
+        if (kCheckRegs && x15856 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x15857 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -32883,25 +32881,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x15937 = x15925 + x15933;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15938 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x15938 != Fp::invalid());
+        if (kCheckRegs && x15938 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15939 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x15939 != Fp::invalid());
+        if (kCheckRegs && x15939 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15940 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x15940 != Fp::invalid());
+        if (kCheckRegs && x15940 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15941 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x15941 != Fp::invalid());
+        if (kCheckRegs && x15941 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15942 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x15942 != Fp::invalid());
+        if (kCheckRegs && x15942 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15943 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x15943 != Fp::invalid());
+        if (kCheckRegs && x15943 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x15944 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x15944 != Fp::invalid());
+        if (kCheckRegs && x15944 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x15945 = x15857 * x15938;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33072,25 +33070,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16028 = x16027 + x16022;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16029 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x16029 != Fp::invalid());
+        if (kCheckRegs && x16029 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16030 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x16030 != Fp::invalid());
+        if (kCheckRegs && x16030 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16031 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x16031 != Fp::invalid());
+        if (kCheckRegs && x16031 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16032 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x16032 != Fp::invalid());
+        if (kCheckRegs && x16032 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16033 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x16033 != Fp::invalid());
+        if (kCheckRegs && x16033 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16034 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x16034 != Fp::invalid());
+        if (kCheckRegs && x16034 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16035 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x16035 != Fp::invalid());
+        if (kCheckRegs && x16035 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16036 = x15857 * x16029;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33199,25 +33197,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16088 = x16080 + x16084;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16089 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x16089 != Fp::invalid());
+        if (kCheckRegs && x16089 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16090 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x16090 != Fp::invalid());
+        if (kCheckRegs && x16090 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16091 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x16091 != Fp::invalid());
+        if (kCheckRegs && x16091 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16092 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x16092 != Fp::invalid());
+        if (kCheckRegs && x16092 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16093 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x16093 != Fp::invalid());
+        if (kCheckRegs && x16093 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16094 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x16094 != Fp::invalid());
+        if (kCheckRegs && x16094 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16095 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x16095 != Fp::invalid());
+        if (kCheckRegs && x16095 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16096 = x15857 * x16089;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33388,25 +33386,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16179 = x16178 + x16173;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16180 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x16180 != Fp::invalid());
+        if (kCheckRegs && x16180 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16181 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x16181 != Fp::invalid());
+        if (kCheckRegs && x16181 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16182 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x16182 != Fp::invalid());
+        if (kCheckRegs && x16182 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16183 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x16183 != Fp::invalid());
+        if (kCheckRegs && x16183 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16184 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x16184 != Fp::invalid());
+        if (kCheckRegs && x16184 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16185 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x16185 != Fp::invalid());
+        if (kCheckRegs && x16185 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16186 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x16186 != Fp::invalid());
+        if (kCheckRegs && x16186 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16187 = x15857 * x16180;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33515,25 +33513,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16239 = x16231 + x16235;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16240 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x16240 != Fp::invalid());
+        if (kCheckRegs && x16240 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16241 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x16241 != Fp::invalid());
+        if (kCheckRegs && x16241 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16242 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x16242 != Fp::invalid());
+        if (kCheckRegs && x16242 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16243 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x16243 != Fp::invalid());
+        if (kCheckRegs && x16243 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16244 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x16244 != Fp::invalid());
+        if (kCheckRegs && x16244 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16245 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x16245 != Fp::invalid());
+        if (kCheckRegs && x16245 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16246 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x16246 != Fp::invalid());
+        if (kCheckRegs && x16246 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16247 = x15857 * x16240;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33642,25 +33640,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16299 = x16291 + x16295;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16300 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x16300 != Fp::invalid());
+        if (kCheckRegs && x16300 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16301 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x16301 != Fp::invalid());
+        if (kCheckRegs && x16301 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16302 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x16302 != Fp::invalid());
+        if (kCheckRegs && x16302 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16303 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x16303 != Fp::invalid());
+        if (kCheckRegs && x16303 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16304 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x16304 != Fp::invalid());
+        if (kCheckRegs && x16304 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16305 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x16305 != Fp::invalid());
+        if (kCheckRegs && x16305 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16306 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x16306 != Fp::invalid());
+        if (kCheckRegs && x16306 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16307 = x15857 * x16300;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33831,25 +33829,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16390 = x16389 + x16384;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16391 = args[2][165 * steps + ((cycle - 0) & mask)];
-        assert(x16391 != Fp::invalid());
+        if (kCheckRegs && x16391 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][165], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16392 = args[2][166 * steps + ((cycle - 0) & mask)];
-        assert(x16392 != Fp::invalid());
+        if (kCheckRegs && x16392 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][166], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16393 = args[2][167 * steps + ((cycle - 0) & mask)];
-        assert(x16393 != Fp::invalid());
+        if (kCheckRegs && x16393 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][167], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16394 = args[2][168 * steps + ((cycle - 0) & mask)];
-        assert(x16394 != Fp::invalid());
+        if (kCheckRegs && x16394 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][168], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16395 = args[2][169 * steps + ((cycle - 0) & mask)];
-        assert(x16395 != Fp::invalid());
+        if (kCheckRegs && x16395 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][169], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16396 = args[2][170 * steps + ((cycle - 0) & mask)];
-        assert(x16396 != Fp::invalid());
+        if (kCheckRegs && x16396 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][170], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16397 = args[2][171 * steps + ((cycle - 0) & mask)];
-        assert(x16397 != Fp::invalid());
+        if (kCheckRegs && x16397 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][171], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16398 = x15857 * x16391;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -33958,25 +33956,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16450 = x16442 + x16446;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16451 = args[2][172 * steps + ((cycle - 0) & mask)];
-        assert(x16451 != Fp::invalid());
+        if (kCheckRegs && x16451 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][172], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16452 = args[2][173 * steps + ((cycle - 0) & mask)];
-        assert(x16452 != Fp::invalid());
+        if (kCheckRegs && x16452 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][173], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16453 = args[2][174 * steps + ((cycle - 0) & mask)];
-        assert(x16453 != Fp::invalid());
+        if (kCheckRegs && x16453 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][174], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16454 = args[2][175 * steps + ((cycle - 0) & mask)];
-        assert(x16454 != Fp::invalid());
+        if (kCheckRegs && x16454 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][175], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16455 = args[2][176 * steps + ((cycle - 0) & mask)];
-        assert(x16455 != Fp::invalid());
+        if (kCheckRegs && x16455 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][176], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16456 = args[2][177 * steps + ((cycle - 0) & mask)];
-        assert(x16456 != Fp::invalid());
+        if (kCheckRegs && x16456 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][177], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16457 = args[2][178 * steps + ((cycle - 0) & mask)];
-        assert(x16457 != Fp::invalid());
+        if (kCheckRegs && x16457 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][178], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16458 = x15857 * x16451;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -34147,25 +34145,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16541 = x16540 + x16535;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16542 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x16542 != Fp::invalid());
+        if (kCheckRegs && x16542 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16543 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x16543 != Fp::invalid());
+        if (kCheckRegs && x16543 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16544 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x16544 != Fp::invalid());
+        if (kCheckRegs && x16544 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16545 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x16545 != Fp::invalid());
+        if (kCheckRegs && x16545 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16546 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x16546 != Fp::invalid());
+        if (kCheckRegs && x16546 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16547 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x16547 != Fp::invalid());
+        if (kCheckRegs && x16547 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16548 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x16548 != Fp::invalid());
+        if (kCheckRegs && x16548 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16549 = x15857 * x16542;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -34804,39 +34802,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16866 = x16865 + x16862;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x16867 = x16866 + x16861;
-        host_args.at(0) = x16844;
-        host_args.at(1) = x16852;
-        host_args.at(2) = x16860;
-        host_args.at(3) = x16867;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x16844;
+        host_args[1] = x16852;
+        host_args[2] = x16860;
+        host_args[3] = x16867;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x16868 = args[2][109 * steps + ((cycle - 0) & mask)];
-    assert(x16868 != Fp::invalid());
+    if (kCheckRegs && x16868 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][109], back 0)");
     if (x16868 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16869 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x16869 != Fp::invalid());
+        if (kCheckRegs && x16869 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16870 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x16870 != Fp::invalid());
+        if (kCheckRegs && x16870 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16871 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x16871 != Fp::invalid());
+        if (kCheckRegs && x16871 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16872 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x16872 != Fp::invalid());
+        if (kCheckRegs && x16872 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16873 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x16873 != Fp::invalid());
+        if (kCheckRegs && x16873 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16874 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x16874 != Fp::invalid());
+        if (kCheckRegs && x16874 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16875 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x16875 != Fp::invalid());
+        if (kCheckRegs && x16875 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x16876 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -35001,25 +34999,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x16956 = x16944 + x16952;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16957 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x16957 != Fp::invalid());
+        if (kCheckRegs && x16957 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16958 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x16958 != Fp::invalid());
+        if (kCheckRegs && x16958 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16959 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x16959 != Fp::invalid());
+        if (kCheckRegs && x16959 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16960 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x16960 != Fp::invalid());
+        if (kCheckRegs && x16960 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16961 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x16961 != Fp::invalid());
+        if (kCheckRegs && x16961 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16962 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x16962 != Fp::invalid());
+        if (kCheckRegs && x16962 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x16963 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x16963 != Fp::invalid());
+        if (kCheckRegs && x16963 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x16964 = x16876 * x16957;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -35190,25 +35188,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17047 = x17046 + x17041;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17048 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x17048 != Fp::invalid());
+        if (kCheckRegs && x17048 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17049 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x17049 != Fp::invalid());
+        if (kCheckRegs && x17049 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17050 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x17050 != Fp::invalid());
+        if (kCheckRegs && x17050 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17051 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x17051 != Fp::invalid());
+        if (kCheckRegs && x17051 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17052 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x17052 != Fp::invalid());
+        if (kCheckRegs && x17052 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17053 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x17053 != Fp::invalid());
+        if (kCheckRegs && x17053 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17054 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x17054 != Fp::invalid());
+        if (kCheckRegs && x17054 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/9(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17055 = x16876 * x17048;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -35317,25 +35315,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17107 = x17099 + x17103;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17108 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x17108 != Fp::invalid());
+        if (kCheckRegs && x17108 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17109 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x17109 != Fp::invalid());
+        if (kCheckRegs && x17109 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17110 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x17110 != Fp::invalid());
+        if (kCheckRegs && x17110 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17111 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x17111 != Fp::invalid());
+        if (kCheckRegs && x17111 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17112 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x17112 != Fp::invalid());
+        if (kCheckRegs && x17112 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17113 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x17113 != Fp::invalid());
+        if (kCheckRegs && x17113 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17114 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x17114 != Fp::invalid());
+        if (kCheckRegs && x17114 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17115 = x16876 * x17108;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -35640,39 +35638,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17265 = x17264 + x17261;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x17266 = x17265 + x17260;
-        host_args.at(0) = x17243;
-        host_args.at(1) = x17251;
-        host_args.at(2) = x17259;
-        host_args.at(3) = x17266;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x17243;
+        host_args[1] = x17251;
+        host_args[2] = x17259;
+        host_args[3] = x17266;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x17267 = args[2][110 * steps + ((cycle - 0) & mask)];
-    assert(x17267 != Fp::invalid());
+    if (kCheckRegs && x17267 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][110], back 0)");
     if (x17267 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17268 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x17268 != Fp::invalid());
+        if (kCheckRegs && x17268 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17269 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x17269 != Fp::invalid());
+        if (kCheckRegs && x17269 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17270 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x17270 != Fp::invalid());
+        if (kCheckRegs && x17270 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17271 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x17271 != Fp::invalid());
+        if (kCheckRegs && x17271 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17272 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x17272 != Fp::invalid());
+        if (kCheckRegs && x17272 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17273 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x17273 != Fp::invalid());
+        if (kCheckRegs && x17273 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17274 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x17274 != Fp::invalid());
+        if (kCheckRegs && x17274 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x17275 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -35837,25 +35835,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17355 = x17343 + x17351;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17356 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x17356 != Fp::invalid());
+        if (kCheckRegs && x17356 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17357 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x17357 != Fp::invalid());
+        if (kCheckRegs && x17357 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17358 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x17358 != Fp::invalid());
+        if (kCheckRegs && x17358 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17359 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x17359 != Fp::invalid());
+        if (kCheckRegs && x17359 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17360 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x17360 != Fp::invalid());
+        if (kCheckRegs && x17360 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17361 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x17361 != Fp::invalid());
+        if (kCheckRegs && x17361 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17362 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x17362 != Fp::invalid());
+        if (kCheckRegs && x17362 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17363 = x17275 * x17356;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -36026,25 +36024,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17446 = x17445 + x17440;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17447 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x17447 != Fp::invalid());
+        if (kCheckRegs && x17447 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17448 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x17448 != Fp::invalid());
+        if (kCheckRegs && x17448 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17449 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x17449 != Fp::invalid());
+        if (kCheckRegs && x17449 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17450 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x17450 != Fp::invalid());
+        if (kCheckRegs && x17450 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17451 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x17451 != Fp::invalid());
+        if (kCheckRegs && x17451 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17452 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x17452 != Fp::invalid());
+        if (kCheckRegs && x17452 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17453 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x17453 != Fp::invalid());
+        if (kCheckRegs && x17453 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/10(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17454 = x17275 * x17447;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -36153,25 +36151,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17506 = x17498 + x17502;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17507 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x17507 != Fp::invalid());
+        if (kCheckRegs && x17507 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17508 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x17508 != Fp::invalid());
+        if (kCheckRegs && x17508 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17509 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x17509 != Fp::invalid());
+        if (kCheckRegs && x17509 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17510 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x17510 != Fp::invalid());
+        if (kCheckRegs && x17510 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17511 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x17511 != Fp::invalid());
+        if (kCheckRegs && x17511 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17512 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x17512 != Fp::invalid());
+        if (kCheckRegs && x17512 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17513 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x17513 != Fp::invalid());
+        if (kCheckRegs && x17513 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17514 = x17275 * x17507;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -36476,39 +36474,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17664 = x17663 + x17660;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x17665 = x17664 + x17659;
-        host_args.at(0) = x17642;
-        host_args.at(1) = x17650;
-        host_args.at(2) = x17658;
-        host_args.at(3) = x17665;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x17642;
+        host_args[1] = x17650;
+        host_args[2] = x17658;
+        host_args[3] = x17665;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x17666 = args[2][111 * steps + ((cycle - 0) & mask)];
-    assert(x17666 != Fp::invalid());
+    if (kCheckRegs && x17666 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][111], back 0)");
     if (x17666 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17667 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x17667 != Fp::invalid());
+        if (kCheckRegs && x17667 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17668 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x17668 != Fp::invalid());
+        if (kCheckRegs && x17668 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17669 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x17669 != Fp::invalid());
+        if (kCheckRegs && x17669 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17670 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x17670 != Fp::invalid());
+        if (kCheckRegs && x17670 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17671 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x17671 != Fp::invalid());
+        if (kCheckRegs && x17671 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17672 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x17672 != Fp::invalid());
+        if (kCheckRegs && x17672 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17673 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x17673 != Fp::invalid());
+        if (kCheckRegs && x17673 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x17674 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -36673,25 +36671,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17754 = x17742 + x17750;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17755 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x17755 != Fp::invalid());
+        if (kCheckRegs && x17755 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17756 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x17756 != Fp::invalid());
+        if (kCheckRegs && x17756 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17757 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x17757 != Fp::invalid());
+        if (kCheckRegs && x17757 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17758 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x17758 != Fp::invalid());
+        if (kCheckRegs && x17758 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17759 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x17759 != Fp::invalid());
+        if (kCheckRegs && x17759 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17760 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x17760 != Fp::invalid());
+        if (kCheckRegs && x17760 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17761 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x17761 != Fp::invalid());
+        if (kCheckRegs && x17761 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17762 = x17674 * x17755;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -36862,25 +36860,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17845 = x17844 + x17839;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17846 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x17846 != Fp::invalid());
+        if (kCheckRegs && x17846 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17847 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x17847 != Fp::invalid());
+        if (kCheckRegs && x17847 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17848 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x17848 != Fp::invalid());
+        if (kCheckRegs && x17848 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17849 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x17849 != Fp::invalid());
+        if (kCheckRegs && x17849 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17850 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x17850 != Fp::invalid());
+        if (kCheckRegs && x17850 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17851 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x17851 != Fp::invalid());
+        if (kCheckRegs && x17851 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17852 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x17852 != Fp::invalid());
+        if (kCheckRegs && x17852 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/11(ShaWrap)/ShaCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17853 = x17674 * x17846;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -36989,25 +36987,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x17905 = x17897 + x17901;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17906 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x17906 != Fp::invalid());
+        if (kCheckRegs && x17906 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17907 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x17907 != Fp::invalid());
+        if (kCheckRegs && x17907 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17908 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x17908 != Fp::invalid());
+        if (kCheckRegs && x17908 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17909 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x17909 != Fp::invalid());
+        if (kCheckRegs && x17909 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17910 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x17910 != Fp::invalid());
+        if (kCheckRegs && x17910 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17911 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x17911 != Fp::invalid());
+        if (kCheckRegs && x17911 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x17912 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x17912 != Fp::invalid());
+        if (kCheckRegs && x17912 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x17913 = x17674 * x17906;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -37312,51 +37310,51 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18063 = x18062 + x18059;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x18064 = x18063 + x18058;
-        host_args.at(0) = x18041;
-        host_args.at(1) = x18049;
-        host_args.at(2) = x18057;
-        host_args.at(3) = x18064;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x18041;
+        host_args[1] = x18049;
+        host_args[2] = x18057;
+        host_args[3] = x18064;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x18065 = args[2][112 * steps + ((cycle - 0) & mask)];
-    assert(x18065 != Fp::invalid());
+    if (kCheckRegs && x18065 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][112], back 0)");
     if (x18065 != 0) {
       {
-        host_args.at(0) = x3;
-        host_args.at(1) = x2;
-        host_args.at(2) = x2;
-        host_args.at(3) = x2;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3;
+        host_args[1] = x2;
+        host_args[2] = x2;
+        host_args[3] = x2;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x18066 = args[2][113 * steps + ((cycle - 0) & mask)];
-    assert(x18066 != Fp::invalid());
+    if (kCheckRegs && x18066 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][113], back 0)");
     if (x18066 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18067 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x18067 != Fp::invalid());
+        if (kCheckRegs && x18067 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18068 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x18068 != Fp::invalid());
+        if (kCheckRegs && x18068 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18069 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x18069 != Fp::invalid());
+        if (kCheckRegs && x18069 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18070 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x18070 != Fp::invalid());
+        if (kCheckRegs && x18070 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18071 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x18071 != Fp::invalid());
+        if (kCheckRegs && x18071 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18072 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x18072 != Fp::invalid());
+        if (kCheckRegs && x18072 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18073 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x18073 != Fp::invalid());
+        if (kCheckRegs && x18073 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x18074 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -37521,25 +37519,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18154 = x18142 + x18150;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18155 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x18155 != Fp::invalid());
+        if (kCheckRegs && x18155 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18156 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x18156 != Fp::invalid());
+        if (kCheckRegs && x18156 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18157 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x18157 != Fp::invalid());
+        if (kCheckRegs && x18157 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18158 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x18158 != Fp::invalid());
+        if (kCheckRegs && x18158 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18159 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x18159 != Fp::invalid());
+        if (kCheckRegs && x18159 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18160 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x18160 != Fp::invalid());
+        if (kCheckRegs && x18160 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18161 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x18161 != Fp::invalid());
+        if (kCheckRegs && x18161 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18162 = x18074 * x18155;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -37710,25 +37708,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18245 = x18244 + x18239;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18246 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x18246 != Fp::invalid());
+        if (kCheckRegs && x18246 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18247 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x18247 != Fp::invalid());
+        if (kCheckRegs && x18247 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18248 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x18248 != Fp::invalid());
+        if (kCheckRegs && x18248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18249 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x18249 != Fp::invalid());
+        if (kCheckRegs && x18249 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18250 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x18250 != Fp::invalid());
+        if (kCheckRegs && x18250 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18251 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x18251 != Fp::invalid());
+        if (kCheckRegs && x18251 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18252 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x18252 != Fp::invalid());
+        if (kCheckRegs && x18252 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18253 = x18074 * x18246;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -37837,25 +37835,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18305 = x18297 + x18301;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18306 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x18306 != Fp::invalid());
+        if (kCheckRegs && x18306 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18307 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x18307 != Fp::invalid());
+        if (kCheckRegs && x18307 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18308 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x18308 != Fp::invalid());
+        if (kCheckRegs && x18308 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18309 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x18309 != Fp::invalid());
+        if (kCheckRegs && x18309 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18310 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x18310 != Fp::invalid());
+        if (kCheckRegs && x18310 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18311 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x18311 != Fp::invalid());
+        if (kCheckRegs && x18311 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18312 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x18312 != Fp::invalid());
+        if (kCheckRegs && x18312 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18313 = x18074 * x18306;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -38026,25 +38024,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18396 = x18395 + x18390;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18397 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x18397 != Fp::invalid());
+        if (kCheckRegs && x18397 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18398 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x18398 != Fp::invalid());
+        if (kCheckRegs && x18398 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18399 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x18399 != Fp::invalid());
+        if (kCheckRegs && x18399 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18400 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x18400 != Fp::invalid());
+        if (kCheckRegs && x18400 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18401 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x18401 != Fp::invalid());
+        if (kCheckRegs && x18401 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18402 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x18402 != Fp::invalid());
+        if (kCheckRegs && x18402 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18403 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x18403 != Fp::invalid());
+        if (kCheckRegs && x18403 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18404 = x18074 * x18397;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -38153,25 +38151,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18456 = x18448 + x18452;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18457 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x18457 != Fp::invalid());
+        if (kCheckRegs && x18457 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18458 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x18458 != Fp::invalid());
+        if (kCheckRegs && x18458 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18459 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x18459 != Fp::invalid());
+        if (kCheckRegs && x18459 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18460 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x18460 != Fp::invalid());
+        if (kCheckRegs && x18460 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18461 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x18461 != Fp::invalid());
+        if (kCheckRegs && x18461 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18462 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x18462 != Fp::invalid());
+        if (kCheckRegs && x18462 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18463 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x18463 != Fp::invalid());
+        if (kCheckRegs && x18463 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18464 = x18074 * x18457;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -38342,25 +38340,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18547 = x18546 + x18541;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18548 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x18548 != Fp::invalid());
+        if (kCheckRegs && x18548 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18549 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x18549 != Fp::invalid());
+        if (kCheckRegs && x18549 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18550 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x18550 != Fp::invalid());
+        if (kCheckRegs && x18550 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18551 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x18551 != Fp::invalid());
+        if (kCheckRegs && x18551 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18552 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x18552 != Fp::invalid());
+        if (kCheckRegs && x18552 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18553 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x18553 != Fp::invalid());
+        if (kCheckRegs && x18553 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18554 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x18554 != Fp::invalid());
+        if (kCheckRegs && x18554 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18555 = x18074 * x18548;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -38469,25 +38467,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18607 = x18599 + x18603;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18608 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x18608 != Fp::invalid());
+        if (kCheckRegs && x18608 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18609 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x18609 != Fp::invalid());
+        if (kCheckRegs && x18609 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18610 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x18610 != Fp::invalid());
+        if (kCheckRegs && x18610 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18611 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x18611 != Fp::invalid());
+        if (kCheckRegs && x18611 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18612 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x18612 != Fp::invalid());
+        if (kCheckRegs && x18612 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18613 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x18613 != Fp::invalid());
+        if (kCheckRegs && x18613 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18614 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x18614 != Fp::invalid());
+        if (kCheckRegs && x18614 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18615 = x18074 * x18608;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -38990,39 +38988,39 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18864 = x18863 + x18860;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x18865 = x18864 + x18859;
-        host_args.at(0) = x18842;
-        host_args.at(1) = x18850;
-        host_args.at(2) = x18858;
-        host_args.at(3) = x18865;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x18842;
+        host_args[1] = x18850;
+        host_args[2] = x18858;
+        host_args[3] = x18865;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x18866 = args[2][114 * steps + ((cycle - 0) & mask)];
-    assert(x18866 != Fp::invalid());
+    if (kCheckRegs && x18866 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][114], back 0)");
     if (x18866 != 0) {
       {
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18867 = args[2][116 * steps + ((cycle - 0) & mask)];
-        assert(x18867 != Fp::invalid());
+        if (kCheckRegs && x18867 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][116], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18868 = args[2][117 * steps + ((cycle - 0) & mask)];
-        assert(x18868 != Fp::invalid());
+        if (kCheckRegs && x18868 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][117], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18869 = args[2][118 * steps + ((cycle - 0) & mask)];
-        assert(x18869 != Fp::invalid());
+        if (kCheckRegs && x18869 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][118], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18870 = args[2][119 * steps + ((cycle - 0) & mask)];
-        assert(x18870 != Fp::invalid());
+        if (kCheckRegs && x18870 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][119], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18871 = args[2][120 * steps + ((cycle - 0) & mask)];
-        assert(x18871 != Fp::invalid());
+        if (kCheckRegs && x18871 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][120], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18872 = args[2][121 * steps + ((cycle - 0) & mask)];
-        assert(x18872 != Fp::invalid());
+        if (kCheckRegs && x18872 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][121], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18873 = args[2][122 * steps + ((cycle - 0) & mask)];
-        assert(x18873 != Fp::invalid());
+        if (kCheckRegs && x18873 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][122], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
         auto x18874 = args[3][8];
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -39187,25 +39185,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x18954 = x18942 + x18950;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18955 = args[2][123 * steps + ((cycle - 0) & mask)];
-        assert(x18955 != Fp::invalid());
+        if (kCheckRegs && x18955 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][123], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18956 = args[2][124 * steps + ((cycle - 0) & mask)];
-        assert(x18956 != Fp::invalid());
+        if (kCheckRegs && x18956 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][124], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18957 = args[2][125 * steps + ((cycle - 0) & mask)];
-        assert(x18957 != Fp::invalid());
+        if (kCheckRegs && x18957 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][125], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18958 = args[2][126 * steps + ((cycle - 0) & mask)];
-        assert(x18958 != Fp::invalid());
+        if (kCheckRegs && x18958 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][126], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18959 = args[2][127 * steps + ((cycle - 0) & mask)];
-        assert(x18959 != Fp::invalid());
+        if (kCheckRegs && x18959 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][127], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18960 = args[2][128 * steps + ((cycle - 0) & mask)];
-        assert(x18960 != Fp::invalid());
+        if (kCheckRegs && x18960 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][128], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x18961 = args[2][129 * steps + ((cycle - 0) & mask)];
-        assert(x18961 != Fp::invalid());
+        if (kCheckRegs && x18961 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][129], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x18962 = x18874 * x18955;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -39376,25 +39374,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19045 = x19044 + x19039;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19046 = args[2][130 * steps + ((cycle - 0) & mask)];
-        assert(x19046 != Fp::invalid());
+        if (kCheckRegs && x19046 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19047 = args[2][131 * steps + ((cycle - 0) & mask)];
-        assert(x19047 != Fp::invalid());
+        if (kCheckRegs && x19047 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19048 = args[2][132 * steps + ((cycle - 0) & mask)];
-        assert(x19048 != Fp::invalid());
+        if (kCheckRegs && x19048 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19049 = args[2][133 * steps + ((cycle - 0) & mask)];
-        assert(x19049 != Fp::invalid());
+        if (kCheckRegs && x19049 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19050 = args[2][134 * steps + ((cycle - 0) & mask)];
-        assert(x19050 != Fp::invalid());
+        if (kCheckRegs && x19050 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19051 = args[2][135 * steps + ((cycle - 0) & mask)];
-        assert(x19051 != Fp::invalid());
+        if (kCheckRegs && x19051 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19052 = args[2][136 * steps + ((cycle - 0) & mask)];
-        assert(x19052 != Fp::invalid());
+        if (kCheckRegs && x19052 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x19053 = x18874 * x19046;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -39503,25 +39501,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19105 = x19097 + x19101;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19106 = args[2][137 * steps + ((cycle - 0) & mask)];
-        assert(x19106 != Fp::invalid());
+        if (kCheckRegs && x19106 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19107 = args[2][138 * steps + ((cycle - 0) & mask)];
-        assert(x19107 != Fp::invalid());
+        if (kCheckRegs && x19107 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19108 = args[2][139 * steps + ((cycle - 0) & mask)];
-        assert(x19108 != Fp::invalid());
+        if (kCheckRegs && x19108 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19109 = args[2][140 * steps + ((cycle - 0) & mask)];
-        assert(x19109 != Fp::invalid());
+        if (kCheckRegs && x19109 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19110 = args[2][141 * steps + ((cycle - 0) & mask)];
-        assert(x19110 != Fp::invalid());
+        if (kCheckRegs && x19110 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19111 = args[2][142 * steps + ((cycle - 0) & mask)];
-        assert(x19111 != Fp::invalid());
+        if (kCheckRegs && x19111 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19112 = args[2][143 * steps + ((cycle - 0) & mask)];
-        assert(x19112 != Fp::invalid());
+        if (kCheckRegs && x19112 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x19113 = x18874 * x19106;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -39692,25 +39690,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19196 = x19195 + x19190;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19197 = args[2][144 * steps + ((cycle - 0) & mask)];
-        assert(x19197 != Fp::invalid());
+        if (kCheckRegs && x19197 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19198 = args[2][145 * steps + ((cycle - 0) & mask)];
-        assert(x19198 != Fp::invalid());
+        if (kCheckRegs && x19198 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19199 = args[2][146 * steps + ((cycle - 0) & mask)];
-        assert(x19199 != Fp::invalid());
+        if (kCheckRegs && x19199 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19200 = args[2][147 * steps + ((cycle - 0) & mask)];
-        assert(x19200 != Fp::invalid());
+        if (kCheckRegs && x19200 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19201 = args[2][148 * steps + ((cycle - 0) & mask)];
-        assert(x19201 != Fp::invalid());
+        if (kCheckRegs && x19201 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19202 = args[2][149 * steps + ((cycle - 0) & mask)];
-        assert(x19202 != Fp::invalid());
+        if (kCheckRegs && x19202 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19203 = args[2][150 * steps + ((cycle - 0) & mask)];
-        assert(x19203 != Fp::invalid());
+        if (kCheckRegs && x19203 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x19204 = x18874 * x19197;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -39819,25 +39817,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19256 = x19248 + x19252;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19257 = args[2][151 * steps + ((cycle - 0) & mask)];
-        assert(x19257 != Fp::invalid());
+        if (kCheckRegs && x19257 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][151], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19258 = args[2][152 * steps + ((cycle - 0) & mask)];
-        assert(x19258 != Fp::invalid());
+        if (kCheckRegs && x19258 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][152], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19259 = args[2][153 * steps + ((cycle - 0) & mask)];
-        assert(x19259 != Fp::invalid());
+        if (kCheckRegs && x19259 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][153], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19260 = args[2][154 * steps + ((cycle - 0) & mask)];
-        assert(x19260 != Fp::invalid());
+        if (kCheckRegs && x19260 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][154], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19261 = args[2][155 * steps + ((cycle - 0) & mask)];
-        assert(x19261 != Fp::invalid());
+        if (kCheckRegs && x19261 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][155], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19262 = args[2][156 * steps + ((cycle - 0) & mask)];
-        assert(x19262 != Fp::invalid());
+        if (kCheckRegs && x19262 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][156], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19263 = args[2][157 * steps + ((cycle - 0) & mask)];
-        assert(x19263 != Fp::invalid());
+        if (kCheckRegs && x19263 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][157], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x19264 = x18874 * x19257;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -40008,25 +40006,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19347 = x19346 + x19341;
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19348 = args[2][158 * steps + ((cycle - 0) & mask)];
-        assert(x19348 != Fp::invalid());
+        if (kCheckRegs && x19348 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19349 = args[2][159 * steps + ((cycle - 0) & mask)];
-        assert(x19349 != Fp::invalid());
+        if (kCheckRegs && x19349 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19350 = args[2][160 * steps + ((cycle - 0) & mask)];
-        assert(x19350 != Fp::invalid());
+        if (kCheckRegs && x19350 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19351 = args[2][161 * steps + ((cycle - 0) & mask)];
-        assert(x19351 != Fp::invalid());
+        if (kCheckRegs && x19351 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19352 = args[2][162 * steps + ((cycle - 0) & mask)];
-        assert(x19352 != Fp::invalid());
+        if (kCheckRegs && x19352 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19353 = args[2][163 * steps + ((cycle - 0) & mask)];
-        assert(x19353 != Fp::invalid());
+        if (kCheckRegs && x19353 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19354 = args[2][164 * steps + ((cycle - 0) & mask)];
-        assert(x19354 != Fp::invalid());
+        if (kCheckRegs && x19354 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x19355 = x18874 * x19348;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -40135,25 +40133,25 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19407 = x19399 + x19403;
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19408 = args[2][89 * steps + ((cycle - 0) & mask)];
-        assert(x19408 != Fp::invalid());
+        if (kCheckRegs && x19408 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19409 = args[2][90 * steps + ((cycle - 0) & mask)];
-        assert(x19409 != Fp::invalid());
+        if (kCheckRegs && x19409 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19410 = args[2][91 * steps + ((cycle - 0) & mask)];
-        assert(x19410 != Fp::invalid());
+        if (kCheckRegs && x19410 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19411 = args[2][92 * steps + ((cycle - 0) & mask)];
-        assert(x19411 != Fp::invalid());
+        if (kCheckRegs && x19411 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19412 = args[2][93 * steps + ((cycle - 0) & mask)];
-        assert(x19412 != Fp::invalid());
+        if (kCheckRegs && x19412 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19413 = args[2][94 * steps + ((cycle - 0) & mask)];
-        assert(x19413 != Fp::invalid());
+        if (kCheckRegs && x19413 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
         // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
         auto x19414 = args[2][95 * steps + ((cycle - 0) & mask)];
-        assert(x19414 != Fp::invalid());
+        if (kCheckRegs && x19414 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
         // loc("./zirgen/components/plonk.h":218:0)
         auto x19415 = x18874 * x19408;
         // loc("./zirgen/components/plonk.h":218:0)
@@ -40656,23 +40654,23 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
         auto x19664 = x19663 + x19660;
         // loc("./zirgen/components/plonk.h":262:0)
         auto x19665 = x19664 + x19659;
-        host_args.at(0) = x19642;
-        host_args.at(1) = x19650;
-        host_args.at(2) = x19658;
-        host_args.at(3) = x19665;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x19642;
+        host_args[1] = x19650;
+        host_args[2] = x19658;
+        host_args[3] = x19665;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x19666 = args[2][115 * steps + ((cycle - 0) & mask)];
-    assert(x19666 != Fp::invalid());
+    if (kCheckRegs && x19666 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][115], back 0)");
     if (x19666 != 0) {
       {
-        host_args.at(0) = x3;
-        host_args.at(1) = x2;
-        host_args.at(2) = x2;
-        host_args.at(3) = x2;
-        host(ctx, "plonkWriteAccum", "ram", host_args.data(), 4, host_outs.data(), 0);
+        host_args[0] = x3;
+        host_args[1] = x2;
+        host_args[2] = x2;
+        host_args[3] = x2;
+        if (!host(ctx, ExternId::PlonkWriteAccum, kExtraRam, "ram", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
       }
     }
   }
@@ -40680,10 +40678,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
     {
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19667 = args[2][3 * steps + ((cycle - 0) & mask)];
-      assert(x19667 != Fp::invalid());
+      if (kCheckRegs && x19667 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][3], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19668 = args[2][4 * steps + ((cycle - 0) & mask)];
-      assert(x19668 != Fp::invalid());
+      if (kCheckRegs && x19668 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][4], back 0)");
       // loc("Top/BytesHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x19669 = args[3][0];
       // loc("Top/BytesHeader/FpExtReg/elem[1](Reg)"("./zirgen/components/plonk.h":218:0))
@@ -40728,10 +40726,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19689 = x19676 + x19685;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19690 = args[2][5 * steps + ((cycle - 0) & mask)];
-      assert(x19690 != Fp::invalid());
+      if (kCheckRegs && x19690 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][5], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19691 = args[2][6 * steps + ((cycle - 0) & mask)];
-      assert(x19691 != Fp::invalid());
+      if (kCheckRegs && x19691 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][6], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19692 = x19669 * x19690;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -40822,10 +40820,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19735 = x19734 + x19729;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19736 = args[2][7 * steps + ((cycle - 0) & mask)];
-      assert(x19736 != Fp::invalid());
+      if (kCheckRegs && x19736 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][7], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19737 = args[2][8 * steps + ((cycle - 0) & mask)];
-      assert(x19737 != Fp::invalid());
+      if (kCheckRegs && x19737 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][8], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19738 = x19669 * x19736;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -40916,10 +40914,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19781 = x19780 + x19775;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19782 = args[2][9 * steps + ((cycle - 0) & mask)];
-      assert(x19782 != Fp::invalid());
+      if (kCheckRegs && x19782 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19783 = args[2][10 * steps + ((cycle - 0) & mask)];
-      assert(x19783 != Fp::invalid());
+      if (kCheckRegs && x19783 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19784 = x19669 * x19782;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -40948,10 +40946,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19796 = x19787 + x19792;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19797 = args[2][11 * steps + ((cycle - 0) & mask)];
-      assert(x19797 != Fp::invalid());
+      if (kCheckRegs && x19797 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19798 = args[2][12 * steps + ((cycle - 0) & mask)];
-      assert(x19798 != Fp::invalid());
+      if (kCheckRegs && x19798 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19799 = x19669 * x19797;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41042,10 +41040,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19842 = x19841 + x19836;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19843 = args[2][13 * steps + ((cycle - 0) & mask)];
-      assert(x19843 != Fp::invalid());
+      if (kCheckRegs && x19843 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19844 = args[2][14 * steps + ((cycle - 0) & mask)];
-      assert(x19844 != Fp::invalid());
+      if (kCheckRegs && x19844 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19845 = x19669 * x19843;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41136,10 +41134,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19888 = x19887 + x19882;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19889 = args[2][15 * steps + ((cycle - 0) & mask)];
-      assert(x19889 != Fp::invalid());
+      if (kCheckRegs && x19889 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19890 = args[2][16 * steps + ((cycle - 0) & mask)];
-      assert(x19890 != Fp::invalid());
+      if (kCheckRegs && x19890 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19891 = x19669 * x19889;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41168,10 +41166,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19903 = x19894 + x19899;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19904 = args[2][17 * steps + ((cycle - 0) & mask)];
-      assert(x19904 != Fp::invalid());
+      if (kCheckRegs && x19904 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19905 = args[2][18 * steps + ((cycle - 0) & mask)];
-      assert(x19905 != Fp::invalid());
+      if (kCheckRegs && x19905 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19906 = x19669 * x19904;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41262,10 +41260,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19949 = x19948 + x19943;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19950 = args[2][19 * steps + ((cycle - 0) & mask)];
-      assert(x19950 != Fp::invalid());
+      if (kCheckRegs && x19950 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19951 = args[2][20 * steps + ((cycle - 0) & mask)];
-      assert(x19951 != Fp::invalid());
+      if (kCheckRegs && x19951 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19952 = x19669 * x19950;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41356,10 +41354,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x19995 = x19994 + x19989;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19996 = args[2][21 * steps + ((cycle - 0) & mask)];
-      assert(x19996 != Fp::invalid());
+      if (kCheckRegs && x19996 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x19997 = args[2][22 * steps + ((cycle - 0) & mask)];
-      assert(x19997 != Fp::invalid());
+      if (kCheckRegs && x19997 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x19998 = x19669 * x19996;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41388,10 +41386,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20010 = x20001 + x20006;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20011 = args[2][23 * steps + ((cycle - 0) & mask)];
-      assert(x20011 != Fp::invalid());
+      if (kCheckRegs && x20011 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20012 = args[2][24 * steps + ((cycle - 0) & mask)];
-      assert(x20012 != Fp::invalid());
+      if (kCheckRegs && x20012 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20013 = x19669 * x20011;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41482,10 +41480,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20056 = x20055 + x20050;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20057 = args[2][25 * steps + ((cycle - 0) & mask)];
-      assert(x20057 != Fp::invalid());
+      if (kCheckRegs && x20057 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20058 = args[2][26 * steps + ((cycle - 0) & mask)];
-      assert(x20058 != Fp::invalid());
+      if (kCheckRegs && x20058 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20059 = x19669 * x20057;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41576,10 +41574,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20102 = x20101 + x20096;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20103 = args[2][27 * steps + ((cycle - 0) & mask)];
-      assert(x20103 != Fp::invalid());
+      if (kCheckRegs && x20103 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20104 = args[2][28 * steps + ((cycle - 0) & mask)];
-      assert(x20104 != Fp::invalid());
+      if (kCheckRegs && x20104 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20105 = x19669 * x20103;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41608,10 +41606,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20117 = x20108 + x20113;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20118 = args[2][29 * steps + ((cycle - 0) & mask)];
-      assert(x20118 != Fp::invalid());
+      if (kCheckRegs && x20118 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20119 = args[2][30 * steps + ((cycle - 0) & mask)];
-      assert(x20119 != Fp::invalid());
+      if (kCheckRegs && x20119 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20120 = x19669 * x20118;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41702,10 +41700,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20163 = x20162 + x20157;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20164 = args[2][31 * steps + ((cycle - 0) & mask)];
-      assert(x20164 != Fp::invalid());
+      if (kCheckRegs && x20164 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20165 = args[2][32 * steps + ((cycle - 0) & mask)];
-      assert(x20165 != Fp::invalid());
+      if (kCheckRegs && x20165 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20166 = x19669 * x20164;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41796,10 +41794,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20209 = x20208 + x20203;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20210 = args[2][33 * steps + ((cycle - 0) & mask)];
-      assert(x20210 != Fp::invalid());
+      if (kCheckRegs && x20210 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20211 = args[2][34 * steps + ((cycle - 0) & mask)];
-      assert(x20211 != Fp::invalid());
+      if (kCheckRegs && x20211 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20212 = x19669 * x20210;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41828,10 +41826,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20224 = x20215 + x20220;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20225 = args[2][35 * steps + ((cycle - 0) & mask)];
-      assert(x20225 != Fp::invalid());
+      if (kCheckRegs && x20225 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20226 = args[2][36 * steps + ((cycle - 0) & mask)];
-      assert(x20226 != Fp::invalid());
+      if (kCheckRegs && x20226 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20227 = x19669 * x20225;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41922,10 +41920,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20270 = x20269 + x20264;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20271 = args[2][37 * steps + ((cycle - 0) & mask)];
-      assert(x20271 != Fp::invalid());
+      if (kCheckRegs && x20271 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20272 = args[2][38 * steps + ((cycle - 0) & mask)];
-      assert(x20272 != Fp::invalid());
+      if (kCheckRegs && x20272 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20273 = x19669 * x20271;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -41954,10 +41952,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20285 = x20276 + x20281;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20286 = args[2][39 * steps + ((cycle - 0) & mask)];
-      assert(x20286 != Fp::invalid());
+      if (kCheckRegs && x20286 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20287 = args[2][40 * steps + ((cycle - 0) & mask)];
-      assert(x20287 != Fp::invalid());
+      if (kCheckRegs && x20287 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20288 = x19669 * x20286;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42048,10 +42046,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20331 = x20330 + x20325;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20332 = args[2][41 * steps + ((cycle - 0) & mask)];
-      assert(x20332 != Fp::invalid());
+      if (kCheckRegs && x20332 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20333 = args[2][42 * steps + ((cycle - 0) & mask)];
-      assert(x20333 != Fp::invalid());
+      if (kCheckRegs && x20333 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20334 = x19669 * x20332;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42142,10 +42140,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20377 = x20376 + x20371;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20378 = args[2][43 * steps + ((cycle - 0) & mask)];
-      assert(x20378 != Fp::invalid());
+      if (kCheckRegs && x20378 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20379 = args[2][44 * steps + ((cycle - 0) & mask)];
-      assert(x20379 != Fp::invalid());
+      if (kCheckRegs && x20379 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20380 = x19669 * x20378;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42174,10 +42172,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20392 = x20383 + x20388;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20393 = args[2][45 * steps + ((cycle - 0) & mask)];
-      assert(x20393 != Fp::invalid());
+      if (kCheckRegs && x20393 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20394 = args[2][46 * steps + ((cycle - 0) & mask)];
-      assert(x20394 != Fp::invalid());
+      if (kCheckRegs && x20394 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20395 = x19669 * x20393;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42268,10 +42266,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20438 = x20437 + x20432;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20439 = args[2][47 * steps + ((cycle - 0) & mask)];
-      assert(x20439 != Fp::invalid());
+      if (kCheckRegs && x20439 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20440 = args[2][48 * steps + ((cycle - 0) & mask)];
-      assert(x20440 != Fp::invalid());
+      if (kCheckRegs && x20440 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20441 = x19669 * x20439;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42362,10 +42360,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20484 = x20483 + x20478;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20485 = args[2][49 * steps + ((cycle - 0) & mask)];
-      assert(x20485 != Fp::invalid());
+      if (kCheckRegs && x20485 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20486 = args[2][50 * steps + ((cycle - 0) & mask)];
-      assert(x20486 != Fp::invalid());
+      if (kCheckRegs && x20486 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20487 = x19669 * x20485;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42394,10 +42392,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20499 = x20490 + x20495;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20500 = args[2][51 * steps + ((cycle - 0) & mask)];
-      assert(x20500 != Fp::invalid());
+      if (kCheckRegs && x20500 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20501 = args[2][52 * steps + ((cycle - 0) & mask)];
-      assert(x20501 != Fp::invalid());
+      if (kCheckRegs && x20501 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20502 = x19669 * x20500;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42488,10 +42486,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20545 = x20544 + x20539;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20546 = args[2][53 * steps + ((cycle - 0) & mask)];
-      assert(x20546 != Fp::invalid());
+      if (kCheckRegs && x20546 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20547 = args[2][54 * steps + ((cycle - 0) & mask)];
-      assert(x20547 != Fp::invalid());
+      if (kCheckRegs && x20547 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20548 = x19669 * x20546;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42582,10 +42580,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20591 = x20590 + x20585;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20592 = args[2][55 * steps + ((cycle - 0) & mask)];
-      assert(x20592 != Fp::invalid());
+      if (kCheckRegs && x20592 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20593 = args[2][56 * steps + ((cycle - 0) & mask)];
-      assert(x20593 != Fp::invalid());
+      if (kCheckRegs && x20593 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20594 = x19669 * x20592;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42614,10 +42612,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20606 = x20597 + x20602;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20607 = args[2][57 * steps + ((cycle - 0) & mask)];
-      assert(x20607 != Fp::invalid());
+      if (kCheckRegs && x20607 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20608 = args[2][58 * steps + ((cycle - 0) & mask)];
-      assert(x20608 != Fp::invalid());
+      if (kCheckRegs && x20608 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20609 = x19669 * x20607;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42708,10 +42706,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20652 = x20651 + x20646;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20653 = args[2][59 * steps + ((cycle - 0) & mask)];
-      assert(x20653 != Fp::invalid());
+      if (kCheckRegs && x20653 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20654 = args[2][60 * steps + ((cycle - 0) & mask)];
-      assert(x20654 != Fp::invalid());
+      if (kCheckRegs && x20654 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20655 = x19669 * x20653;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42802,10 +42800,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20698 = x20697 + x20692;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20699 = args[2][61 * steps + ((cycle - 0) & mask)];
-      assert(x20699 != Fp::invalid());
+      if (kCheckRegs && x20699 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20700 = args[2][62 * steps + ((cycle - 0) & mask)];
-      assert(x20700 != Fp::invalid());
+      if (kCheckRegs && x20700 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20701 = x19669 * x20699;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42834,10 +42832,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20713 = x20704 + x20709;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20714 = args[2][63 * steps + ((cycle - 0) & mask)];
-      assert(x20714 != Fp::invalid());
+      if (kCheckRegs && x20714 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20715 = args[2][64 * steps + ((cycle - 0) & mask)];
-      assert(x20715 != Fp::invalid());
+      if (kCheckRegs && x20715 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20716 = x19669 * x20714;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -42928,10 +42926,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20759 = x20758 + x20753;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20760 = args[2][65 * steps + ((cycle - 0) & mask)];
-      assert(x20760 != Fp::invalid());
+      if (kCheckRegs && x20760 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20761 = args[2][66 * steps + ((cycle - 0) & mask)];
-      assert(x20761 != Fp::invalid());
+      if (kCheckRegs && x20761 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20762 = x19669 * x20760;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -43022,10 +43020,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20805 = x20804 + x20799;
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20806 = args[2][67 * steps + ((cycle - 0) & mask)];
-      assert(x20806 != Fp::invalid());
+      if (kCheckRegs && x20806 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
       // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20807 = args[2][68 * steps + ((cycle - 0) & mask)];
-      assert(x20807 != Fp::invalid());
+      if (kCheckRegs && x20807 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20808 = x19669 * x20806;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -43054,10 +43052,10 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x20820 = x20811 + x20816;
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20821 = args[2][0 * steps + ((cycle - 0) & mask)];
-      assert(x20821 != Fp::invalid());
+      if (kCheckRegs && x20821 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
       // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x20822 = args[2][1 * steps + ((cycle - 0) & mask)];
-      assert(x20822 != Fp::invalid());
+      if (kCheckRegs && x20822 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x20823 = x19669 * x20821;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -44272,15 +44270,15 @@ Fp step_compute_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp
       auto x21428 = x21427 + x21424;
       // loc("./zirgen/components/plonk.h":262:0)
       auto x21429 = x21428 + x21423;
-      host_args.at(0) = x21406;
-      host_args.at(1) = x21414;
-      host_args.at(2) = x21422;
-      host_args.at(3) = x21429;
-      host(ctx, "plonkWriteAccum", "bytes", host_args.data(), 4, host_outs.data(), 0);
+      host_args[0] = x21406;
+      host_args[1] = x21414;
+      host_args[2] = x21422;
+      host_args[3] = x21429;
+      if (!host(ctx, ExternId::PlonkWriteAccum, kExtraBytes, "bytes", host_args.data(), 4, host_outs.data(), 0)) return hostFailed(err);
     }
   }
   return x2;
 }
 
-} // namespace risc0::circuit::rv32im
+} // namespace risc0::circuit::rv32im::RISC0_STEP_VARIANT
 // clang-format on
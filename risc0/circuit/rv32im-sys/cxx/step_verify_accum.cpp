@@ -12,24 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "ffi.h"
 #include "fp.h"
 
 #include <array>
-#include <cassert>
-#include <stdexcept>
 
 // clang-format off
-namespace risc0::circuit::rv32im {
+namespace risc0::circuit::rv32im::RISC0_STEP_VARIANT {
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
-Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args) {
+Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err) {
   size_t mask = steps - 1;
   std::array<Fp, 96> host_args;
   std::array<Fp, 32> host_outs;
@@ -43,48 +41,48 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   Fp x3(1);
   // loc("Top/Code/OneHot/hot[1](Reg)"("./zirgen/components/mux.h":49:0))
   auto x4 = args[0][2 * steps + ((cycle - 0) & mask)];
-  assert(x4 != Fp::invalid());
+  if (kCheckRegs && x4 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[1](Reg) (args[0][2], back 0)");
   // loc("Top/Code/OneHot/hot[3](Reg)"("./zirgen/components/mux.h":49:0))
   auto x5 = args[0][4 * steps + ((cycle - 0) & mask)];
-  assert(x5 != Fp::invalid());
+  if (kCheckRegs && x5 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[3](Reg) (args[0][4], back 0)");
   // loc("Top/Code/OneHot/hot[4](Reg)"("./zirgen/components/mux.h":49:0))
   auto x6 = args[0][5 * steps + ((cycle - 0) & mask)];
-  assert(x6 != Fp::invalid());
+  if (kCheckRegs && x6 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[4](Reg) (args[0][5], back 0)");
   // loc("Top/Code/OneHot/hot[5](Reg)"("./zirgen/components/mux.h":49:0))
   auto x7 = args[0][6 * steps + ((cycle - 0) & mask)];
-  assert(x7 != Fp::invalid());
+  if (kCheckRegs && x7 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[5](Reg) (args[0][6], back 0)");
   // loc("Top/Code/OneHot/hot[6](Reg)"("./zirgen/components/mux.h":49:0))
   auto x8 = args[0][7 * steps + ((cycle - 0) & mask)];
-  assert(x8 != Fp::invalid());
+  if (kCheckRegs && x8 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[6](Reg) (args[0][7], back 0)");
   // loc("Top/Code/OneHot/hot[0](Reg)"("zirgen/circuit/rv32im/top.cpp":78:0))
   auto x9 = args[0][1 * steps + ((cycle - 0) & mask)];
-  assert(x9 != Fp::invalid());
+  if (kCheckRegs && x9 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[0](Reg) (args[0][1], back 0)");
   // loc("Top/Code/OneHot/hot[2](Reg)"("zirgen/circuit/rv32im/top.cpp":78:0))
   auto x10 = args[0][3 * steps + ((cycle - 0) & mask)];
-  assert(x10 != Fp::invalid());
+  if (kCheckRegs && x10 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[2](Reg) (args[0][3], back 0)");
   if (x9 != 0) {
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][0 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x3);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
       reg = x3;
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][1 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x2);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
       reg = x2;
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][2 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x2);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
       reg = x2;
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][3 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x2);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
       reg = x2;
     }
   }
@@ -107,10 +105,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x18 = args[3][7];
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x19 = args[2][9 * steps + ((cycle - 0) & mask)];
-    assert(x19 != Fp::invalid());
+    if (kCheckRegs && x19 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x20 = args[2][10 * steps + ((cycle - 0) & mask)];
-    assert(x20 != Fp::invalid());
+    if (kCheckRegs && x20 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x21 = x11 * x19;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -139,10 +137,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x33 = x24 + x29;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x34 = args[2][11 * steps + ((cycle - 0) & mask)];
-    assert(x34 != Fp::invalid());
+    if (kCheckRegs && x34 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x35 = args[2][12 * steps + ((cycle - 0) & mask)];
-    assert(x35 != Fp::invalid());
+    if (kCheckRegs && x35 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x36 = x11 * x34;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -233,10 +231,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x79 = x78 + x73;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x80 = args[2][13 * steps + ((cycle - 0) & mask)];
-    assert(x80 != Fp::invalid());
+    if (kCheckRegs && x80 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x81 = args[2][14 * steps + ((cycle - 0) & mask)];
-    assert(x81 != Fp::invalid());
+    if (kCheckRegs && x81 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x82 = x11 * x80;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -327,10 +325,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x125 = x124 + x119;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x126 = args[2][15 * steps + ((cycle - 0) & mask)];
-    assert(x126 != Fp::invalid());
+    if (kCheckRegs && x126 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x127 = args[2][16 * steps + ((cycle - 0) & mask)];
-    assert(x127 != Fp::invalid());
+    if (kCheckRegs && x127 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x128 = x11 * x126;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -359,10 +357,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x140 = x131 + x136;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x141 = args[2][17 * steps + ((cycle - 0) & mask)];
-    assert(x141 != Fp::invalid());
+    if (kCheckRegs && x141 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x142 = args[2][18 * steps + ((cycle - 0) & mask)];
-    assert(x142 != Fp::invalid());
+    if (kCheckRegs && x142 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x143 = x11 * x141;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -453,10 +451,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x186 = x185 + x180;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x187 = args[2][19 * steps + ((cycle - 0) & mask)];
-    assert(x187 != Fp::invalid());
+    if (kCheckRegs && x187 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x188 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x188 != Fp::invalid());
+    if (kCheckRegs && x188 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x189 = x11 * x187;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -547,10 +545,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x232 = x231 + x226;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x233 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x233 != Fp::invalid());
+    if (kCheckRegs && x233 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x234 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x234 != Fp::invalid());
+    if (kCheckRegs && x234 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x235 = x11 * x233;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -579,10 +577,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x247 = x238 + x243;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x248 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x248 != Fp::invalid());
+    if (kCheckRegs && x248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x249 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x249 != Fp::invalid());
+    if (kCheckRegs && x249 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x250 = x11 * x248;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -673,10 +671,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x293 = x292 + x287;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x294 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x294 != Fp::invalid());
+    if (kCheckRegs && x294 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x295 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x295 != Fp::invalid());
+    if (kCheckRegs && x295 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x296 = x11 * x294;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -767,10 +765,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x339 = x338 + x333;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x340 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x340 != Fp::invalid());
+    if (kCheckRegs && x340 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x341 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x341 != Fp::invalid());
+    if (kCheckRegs && x341 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x342 = x11 * x340;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -799,10 +797,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x354 = x345 + x350;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x355 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x355 != Fp::invalid());
+    if (kCheckRegs && x355 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x356 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x356 != Fp::invalid());
+    if (kCheckRegs && x356 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x357 = x11 * x355;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -893,10 +891,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x400 = x399 + x394;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x401 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x401 != Fp::invalid());
+    if (kCheckRegs && x401 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x402 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x402 != Fp::invalid());
+    if (kCheckRegs && x402 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x403 = x11 * x401;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -987,10 +985,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x446 = x445 + x440;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x447 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x447 != Fp::invalid());
+    if (kCheckRegs && x447 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x448 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x448 != Fp::invalid());
+    if (kCheckRegs && x448 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x449 = x11 * x447;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1019,10 +1017,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x461 = x452 + x457;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x462 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x462 != Fp::invalid());
+    if (kCheckRegs && x462 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x463 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x463 != Fp::invalid());
+    if (kCheckRegs && x463 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x464 = x11 * x462;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1113,10 +1111,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x507 = x506 + x501;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x508 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x508 != Fp::invalid());
+    if (kCheckRegs && x508 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x509 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x509 != Fp::invalid());
+    if (kCheckRegs && x509 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x510 = x11 * x508;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1207,10 +1205,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x553 = x552 + x547;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x554 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x554 != Fp::invalid());
+    if (kCheckRegs && x554 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x555 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x555 != Fp::invalid());
+    if (kCheckRegs && x555 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x556 = x11 * x554;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1239,10 +1237,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x568 = x559 + x564;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x569 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x569 != Fp::invalid());
+    if (kCheckRegs && x569 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x570 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x570 != Fp::invalid());
+    if (kCheckRegs && x570 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x571 = x11 * x569;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1333,10 +1331,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x614 = x613 + x608;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x615 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x615 != Fp::invalid());
+    if (kCheckRegs && x615 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x616 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x616 != Fp::invalid());
+    if (kCheckRegs && x616 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x617 = x11 * x615;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1427,10 +1425,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x660 = x659 + x654;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x661 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x661 != Fp::invalid());
+    if (kCheckRegs && x661 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x662 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x662 != Fp::invalid());
+    if (kCheckRegs && x662 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x663 = x11 * x661;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1459,10 +1457,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x675 = x666 + x671;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x676 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x676 != Fp::invalid());
+    if (kCheckRegs && x676 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x677 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x677 != Fp::invalid());
+    if (kCheckRegs && x677 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x678 = x11 * x676;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1553,10 +1551,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x721 = x720 + x715;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x722 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x722 != Fp::invalid());
+    if (kCheckRegs && x722 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x723 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x723 != Fp::invalid());
+    if (kCheckRegs && x723 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x724 = x11 * x722;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1647,10 +1645,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x767 = x766 + x761;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x768 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x768 != Fp::invalid());
+    if (kCheckRegs && x768 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x769 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x769 != Fp::invalid());
+    if (kCheckRegs && x769 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x770 = x11 * x768;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1679,10 +1677,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x782 = x773 + x778;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x783 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x783 != Fp::invalid());
+    if (kCheckRegs && x783 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x784 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x784 != Fp::invalid());
+    if (kCheckRegs && x784 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x785 = x11 * x783;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1773,10 +1771,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x828 = x827 + x822;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x829 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x829 != Fp::invalid());
+    if (kCheckRegs && x829 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x830 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x830 != Fp::invalid());
+    if (kCheckRegs && x830 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x831 = x11 * x829;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1867,10 +1865,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x874 = x873 + x868;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x875 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x875 != Fp::invalid());
+    if (kCheckRegs && x875 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x876 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x876 != Fp::invalid());
+    if (kCheckRegs && x876 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x877 = x11 * x875;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1899,10 +1897,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x889 = x880 + x885;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x890 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x890 != Fp::invalid());
+    if (kCheckRegs && x890 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x891 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x891 != Fp::invalid());
+    if (kCheckRegs && x891 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x892 = x11 * x890;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -1993,10 +1991,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x935 = x934 + x929;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x936 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x936 != Fp::invalid());
+    if (kCheckRegs && x936 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x937 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x937 != Fp::invalid());
+    if (kCheckRegs && x937 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x938 = x11 * x936;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2087,10 +2085,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x981 = x980 + x975;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x982 = args[2][69 * steps + ((cycle - 0) & mask)];
-    assert(x982 != Fp::invalid());
+    if (kCheckRegs && x982 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][69], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x983 = args[2][70 * steps + ((cycle - 0) & mask)];
-    assert(x983 != Fp::invalid());
+    if (kCheckRegs && x983 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][70], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x984 = x11 * x982;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2119,10 +2117,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x996 = x987 + x992;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x997 = args[2][71 * steps + ((cycle - 0) & mask)];
-    assert(x997 != Fp::invalid());
+    if (kCheckRegs && x997 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][71], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x998 = args[2][72 * steps + ((cycle - 0) & mask)];
-    assert(x998 != Fp::invalid());
+    if (kCheckRegs && x998 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][72], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x999 = x11 * x997;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2213,10 +2211,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1042 = x1041 + x1036;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1043 = args[2][73 * steps + ((cycle - 0) & mask)];
-    assert(x1043 != Fp::invalid());
+    if (kCheckRegs && x1043 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][73], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1044 = args[2][74 * steps + ((cycle - 0) & mask)];
-    assert(x1044 != Fp::invalid());
+    if (kCheckRegs && x1044 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][74], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1045 = x11 * x1043;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2307,10 +2305,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1088 = x1087 + x1082;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1089 = args[2][75 * steps + ((cycle - 0) & mask)];
-    assert(x1089 != Fp::invalid());
+    if (kCheckRegs && x1089 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][75], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1090 = args[2][76 * steps + ((cycle - 0) & mask)];
-    assert(x1090 != Fp::invalid());
+    if (kCheckRegs && x1090 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][76], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1091 = x11 * x1089;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2339,10 +2337,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1103 = x1094 + x1099;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1104 = args[2][77 * steps + ((cycle - 0) & mask)];
-    assert(x1104 != Fp::invalid());
+    if (kCheckRegs && x1104 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][77], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1105 = args[2][78 * steps + ((cycle - 0) & mask)];
-    assert(x1105 != Fp::invalid());
+    if (kCheckRegs && x1105 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][78], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1106 = x11 * x1104;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2433,10 +2431,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1149 = x1148 + x1143;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1150 = args[2][79 * steps + ((cycle - 0) & mask)];
-    assert(x1150 != Fp::invalid());
+    if (kCheckRegs && x1150 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][79], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1151 = args[2][80 * steps + ((cycle - 0) & mask)];
-    assert(x1151 != Fp::invalid());
+    if (kCheckRegs && x1151 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][80], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1152 = x11 * x1150;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2527,10 +2525,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1195 = x1194 + x1189;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1196 = args[2][81 * steps + ((cycle - 0) & mask)];
-    assert(x1196 != Fp::invalid());
+    if (kCheckRegs && x1196 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][81], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1197 = args[2][82 * steps + ((cycle - 0) & mask)];
-    assert(x1197 != Fp::invalid());
+    if (kCheckRegs && x1197 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][82], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1198 = x11 * x1196;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2559,10 +2557,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1210 = x1201 + x1206;
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1211 = args[2][83 * steps + ((cycle - 0) & mask)];
-    assert(x1211 != Fp::invalid());
+    if (kCheckRegs && x1211 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][83], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1212 = args[2][84 * steps + ((cycle - 0) & mask)];
-    assert(x1212 != Fp::invalid());
+    if (kCheckRegs && x1212 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][84], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1213 = x11 * x1211;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2653,10 +2651,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1256 = x1255 + x1250;
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1257 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x1257 != Fp::invalid());
+    if (kCheckRegs && x1257 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1258 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x1258 != Fp::invalid());
+    if (kCheckRegs && x1258 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1259 = x11 * x1257;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -2746,33 +2744,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x1302 = x1301 + x1296;
     {
-      host(ctx, "plonkReadAccum", "bytes", host_args.data(), 0, host_outs.data(), 4);
-      auto x1303 = host_outs.at(0);
-      auto x1304 = host_outs.at(1);
-      auto x1305 = host_outs.at(2);
-      auto x1306 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x1303 = host_outs[0];
+      auto x1304 = host_outs[1];
+      auto x1305 = host_outs[2];
+      auto x1306 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1303);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1303) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x1303;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1304);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1304) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x1304;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1305);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1305) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x1305;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1306);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1306) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x1306;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -2976,25 +2974,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][24 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1382);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1382) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
         reg = x1382;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][25 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1390);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1390) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
         reg = x1390;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][26 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1398);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1398) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
         reg = x1398;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][27 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1405);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1405) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
         reg = x1405;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -3198,25 +3196,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][20 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1481);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1481) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][20])");
         reg = x1481;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][21 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1489);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1489) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][21])");
         reg = x1489;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][22 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1497);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1497) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][22])");
         reg = x1497;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][23 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1504);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1504) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][23])");
         reg = x1504;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -3420,25 +3418,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][16 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1580);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1580) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][16])");
         reg = x1580;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][17 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1588);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1588) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][17])");
         reg = x1588;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][18 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1596);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1596) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][18])");
         reg = x1596;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][19 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1603);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1603) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][19])");
         reg = x1603;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -3642,25 +3640,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][12 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1679);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1679) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][12])");
         reg = x1679;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][13 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1687);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1687) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][13])");
         reg = x1687;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][14 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1695);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1695) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][14])");
         reg = x1695;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][15 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1702);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1702) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][15])");
         reg = x1702;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -3864,25 +3862,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1778);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1778) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x1778;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1786);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1786) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x1786;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1794);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1794) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x1794;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1801);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1801) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x1801;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -4086,25 +4084,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1877);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1877) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x1877;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1885);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1885) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x1885;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1893);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1893) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x1893;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1900);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1900) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x1900;
       }
     }
@@ -4128,10 +4126,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1908 = args[3][7];
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1909 = args[2][9 * steps + ((cycle - 0) & mask)];
-    assert(x1909 != Fp::invalid());
+    if (kCheckRegs && x1909 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1910 = args[2][10 * steps + ((cycle - 0) & mask)];
-    assert(x1910 != Fp::invalid());
+    if (kCheckRegs && x1910 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1911 = x1901 * x1909;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4160,10 +4158,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1923 = x1914 + x1919;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1924 = args[2][11 * steps + ((cycle - 0) & mask)];
-    assert(x1924 != Fp::invalid());
+    if (kCheckRegs && x1924 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1925 = args[2][12 * steps + ((cycle - 0) & mask)];
-    assert(x1925 != Fp::invalid());
+    if (kCheckRegs && x1925 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1926 = x1901 * x1924;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4254,10 +4252,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x1969 = x1968 + x1963;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1970 = args[2][13 * steps + ((cycle - 0) & mask)];
-    assert(x1970 != Fp::invalid());
+    if (kCheckRegs && x1970 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1971 = args[2][14 * steps + ((cycle - 0) & mask)];
-    assert(x1971 != Fp::invalid());
+    if (kCheckRegs && x1971 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x1972 = x1901 * x1970;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4348,10 +4346,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2015 = x2014 + x2009;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2016 = args[2][15 * steps + ((cycle - 0) & mask)];
-    assert(x2016 != Fp::invalid());
+    if (kCheckRegs && x2016 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2017 = args[2][16 * steps + ((cycle - 0) & mask)];
-    assert(x2017 != Fp::invalid());
+    if (kCheckRegs && x2017 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2018 = x1901 * x2016;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4380,10 +4378,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2030 = x2021 + x2026;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2031 = args[2][17 * steps + ((cycle - 0) & mask)];
-    assert(x2031 != Fp::invalid());
+    if (kCheckRegs && x2031 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2032 = args[2][18 * steps + ((cycle - 0) & mask)];
-    assert(x2032 != Fp::invalid());
+    if (kCheckRegs && x2032 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2033 = x1901 * x2031;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4474,10 +4472,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2076 = x2075 + x2070;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2077 = args[2][19 * steps + ((cycle - 0) & mask)];
-    assert(x2077 != Fp::invalid());
+    if (kCheckRegs && x2077 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2078 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x2078 != Fp::invalid());
+    if (kCheckRegs && x2078 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2079 = x1901 * x2077;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4568,10 +4566,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2122 = x2121 + x2116;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2123 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x2123 != Fp::invalid());
+    if (kCheckRegs && x2123 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2124 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x2124 != Fp::invalid());
+    if (kCheckRegs && x2124 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2125 = x1901 * x2123;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4600,10 +4598,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2137 = x2128 + x2133;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2138 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x2138 != Fp::invalid());
+    if (kCheckRegs && x2138 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2139 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x2139 != Fp::invalid());
+    if (kCheckRegs && x2139 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2140 = x1901 * x2138;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4694,10 +4692,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2183 = x2182 + x2177;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2184 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x2184 != Fp::invalid());
+    if (kCheckRegs && x2184 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2185 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x2185 != Fp::invalid());
+    if (kCheckRegs && x2185 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2186 = x1901 * x2184;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4788,10 +4786,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2229 = x2228 + x2223;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2230 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x2230 != Fp::invalid());
+    if (kCheckRegs && x2230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2231 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x2231 != Fp::invalid());
+    if (kCheckRegs && x2231 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2232 = x1901 * x2230;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4820,10 +4818,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2244 = x2235 + x2240;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2245 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x2245 != Fp::invalid());
+    if (kCheckRegs && x2245 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2246 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x2246 != Fp::invalid());
+    if (kCheckRegs && x2246 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2247 = x1901 * x2245;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -4914,10 +4912,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2290 = x2289 + x2284;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2291 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x2291 != Fp::invalid());
+    if (kCheckRegs && x2291 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2292 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x2292 != Fp::invalid());
+    if (kCheckRegs && x2292 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2293 = x1901 * x2291;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5008,10 +5006,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2336 = x2335 + x2330;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2337 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x2337 != Fp::invalid());
+    if (kCheckRegs && x2337 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2338 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x2338 != Fp::invalid());
+    if (kCheckRegs && x2338 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2339 = x1901 * x2337;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5040,10 +5038,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2351 = x2342 + x2347;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2352 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x2352 != Fp::invalid());
+    if (kCheckRegs && x2352 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2353 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x2353 != Fp::invalid());
+    if (kCheckRegs && x2353 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2354 = x1901 * x2352;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5134,10 +5132,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2397 = x2396 + x2391;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2398 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x2398 != Fp::invalid());
+    if (kCheckRegs && x2398 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2399 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x2399 != Fp::invalid());
+    if (kCheckRegs && x2399 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2400 = x1901 * x2398;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5166,10 +5164,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2412 = x2403 + x2408;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2413 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x2413 != Fp::invalid());
+    if (kCheckRegs && x2413 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2414 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x2414 != Fp::invalid());
+    if (kCheckRegs && x2414 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2415 = x1901 * x2413;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5260,10 +5258,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2458 = x2457 + x2452;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2459 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x2459 != Fp::invalid());
+    if (kCheckRegs && x2459 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2460 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x2460 != Fp::invalid());
+    if (kCheckRegs && x2460 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2461 = x1901 * x2459;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5354,10 +5352,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2504 = x2503 + x2498;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2505 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x2505 != Fp::invalid());
+    if (kCheckRegs && x2505 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2506 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x2506 != Fp::invalid());
+    if (kCheckRegs && x2506 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2507 = x1901 * x2505;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5386,10 +5384,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2519 = x2510 + x2515;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2520 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x2520 != Fp::invalid());
+    if (kCheckRegs && x2520 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2521 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x2521 != Fp::invalid());
+    if (kCheckRegs && x2521 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2522 = x1901 * x2520;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5480,10 +5478,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2565 = x2564 + x2559;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2566 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x2566 != Fp::invalid());
+    if (kCheckRegs && x2566 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2567 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x2567 != Fp::invalid());
+    if (kCheckRegs && x2567 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2568 = x1901 * x2566;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5574,10 +5572,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2611 = x2610 + x2605;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2612 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x2612 != Fp::invalid());
+    if (kCheckRegs && x2612 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2613 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x2613 != Fp::invalid());
+    if (kCheckRegs && x2613 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2614 = x1901 * x2612;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5606,10 +5604,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2626 = x2617 + x2622;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2627 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x2627 != Fp::invalid());
+    if (kCheckRegs && x2627 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2628 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x2628 != Fp::invalid());
+    if (kCheckRegs && x2628 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2629 = x1901 * x2627;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5700,10 +5698,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2672 = x2671 + x2666;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2673 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x2673 != Fp::invalid());
+    if (kCheckRegs && x2673 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2674 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x2674 != Fp::invalid());
+    if (kCheckRegs && x2674 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2675 = x1901 * x2673;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5794,10 +5792,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2718 = x2717 + x2712;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2719 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x2719 != Fp::invalid());
+    if (kCheckRegs && x2719 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2720 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x2720 != Fp::invalid());
+    if (kCheckRegs && x2720 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2721 = x1901 * x2719;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5826,10 +5824,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2733 = x2724 + x2729;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2734 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x2734 != Fp::invalid());
+    if (kCheckRegs && x2734 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2735 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x2735 != Fp::invalid());
+    if (kCheckRegs && x2735 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2736 = x1901 * x2734;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -5920,10 +5918,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2779 = x2778 + x2773;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2780 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x2780 != Fp::invalid());
+    if (kCheckRegs && x2780 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2781 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x2781 != Fp::invalid());
+    if (kCheckRegs && x2781 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2782 = x1901 * x2780;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6014,10 +6012,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2825 = x2824 + x2819;
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2826 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x2826 != Fp::invalid());
+    if (kCheckRegs && x2826 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2827 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x2827 != Fp::invalid());
+    if (kCheckRegs && x2827 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2828 = x1901 * x2826;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6046,10 +6044,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x2840 = x2831 + x2836;
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2841 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x2841 != Fp::invalid());
+    if (kCheckRegs && x2841 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x2842 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x2842 != Fp::invalid());
+    if (kCheckRegs && x2842 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x2843 = x1901 * x2841;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -6139,33 +6137,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x2886 = x2885 + x2880;
     {
-      host(ctx, "plonkReadAccum", "bytes", host_args.data(), 0, host_outs.data(), 4);
-      auto x2887 = host_outs.at(0);
-      auto x2888 = host_outs.at(1);
-      auto x2889 = host_outs.at(2);
-      auto x2890 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x2887 = host_outs[0];
+      auto x2888 = host_outs[1];
+      auto x2889 = host_outs[2];
+      auto x2890 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2887);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2887) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x2887;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2888);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2888) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x2888;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2889);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2889) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x2889;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2890);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2890) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x2890;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -6369,25 +6367,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][20 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2966);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2966) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][20])");
         reg = x2966;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][21 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2974);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2974) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][21])");
         reg = x2974;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][22 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2982);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2982) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][22])");
         reg = x2982;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][23 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x2989);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x2989) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][23])");
         reg = x2989;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -6591,25 +6589,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][16 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3065);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3065) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][16])");
         reg = x3065;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][17 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3073);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3073) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][17])");
         reg = x3073;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][18 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3081);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3081) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][18])");
         reg = x3081;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][19 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3088);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3088) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][19])");
         reg = x3088;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -6813,25 +6811,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][12 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3164);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3164) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][12])");
         reg = x3164;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][13 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3172);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3172) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][13])");
         reg = x3172;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][14 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3180);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3180) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][14])");
         reg = x3180;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][15 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3187);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3187) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][15])");
         reg = x3187;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -7035,25 +7033,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3263);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3263) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x3263;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3271);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3271) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x3271;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3279);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3279) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x3279;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3286);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3286) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x3286;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -7257,50 +7255,50 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3362);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3362) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x3362;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3370);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3370) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x3370;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3378);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3378) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x3378;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x3385);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x3385) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x3385;
       }
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][24 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x3);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
       reg = x3;
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][25 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x2);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
       reg = x2;
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][26 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x2);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
       reg = x2;
     }
     // loc("zirgen/components/fpext.cpp":28:0)
     {
       auto& reg = args[4][27 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x2);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x2) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
       reg = x2;
     }
   }
@@ -7323,10 +7321,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3393 = args[3][7];
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3394 = args[2][9 * steps + ((cycle - 0) & mask)];
-    assert(x3394 != Fp::invalid());
+    if (kCheckRegs && x3394 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3395 = args[2][10 * steps + ((cycle - 0) & mask)];
-    assert(x3395 != Fp::invalid());
+    if (kCheckRegs && x3395 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3396 = x3386 * x3394;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7355,10 +7353,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3408 = x3399 + x3404;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3409 = args[2][11 * steps + ((cycle - 0) & mask)];
-    assert(x3409 != Fp::invalid());
+    if (kCheckRegs && x3409 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3410 = args[2][12 * steps + ((cycle - 0) & mask)];
-    assert(x3410 != Fp::invalid());
+    if (kCheckRegs && x3410 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3411 = x3386 * x3409;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7449,10 +7447,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3454 = x3453 + x3448;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3455 = args[2][13 * steps + ((cycle - 0) & mask)];
-    assert(x3455 != Fp::invalid());
+    if (kCheckRegs && x3455 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3456 = args[2][14 * steps + ((cycle - 0) & mask)];
-    assert(x3456 != Fp::invalid());
+    if (kCheckRegs && x3456 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3457 = x3386 * x3455;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7543,10 +7541,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3500 = x3499 + x3494;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3501 = args[2][15 * steps + ((cycle - 0) & mask)];
-    assert(x3501 != Fp::invalid());
+    if (kCheckRegs && x3501 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3502 = args[2][16 * steps + ((cycle - 0) & mask)];
-    assert(x3502 != Fp::invalid());
+    if (kCheckRegs && x3502 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3503 = x3386 * x3501;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7575,10 +7573,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3515 = x3506 + x3511;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3516 = args[2][17 * steps + ((cycle - 0) & mask)];
-    assert(x3516 != Fp::invalid());
+    if (kCheckRegs && x3516 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3517 = args[2][18 * steps + ((cycle - 0) & mask)];
-    assert(x3517 != Fp::invalid());
+    if (kCheckRegs && x3517 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3518 = x3386 * x3516;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7669,10 +7667,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3561 = x3560 + x3555;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3562 = args[2][19 * steps + ((cycle - 0) & mask)];
-    assert(x3562 != Fp::invalid());
+    if (kCheckRegs && x3562 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3563 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x3563 != Fp::invalid());
+    if (kCheckRegs && x3563 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3564 = x3386 * x3562;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7763,10 +7761,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3607 = x3606 + x3601;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3608 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x3608 != Fp::invalid());
+    if (kCheckRegs && x3608 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3609 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x3609 != Fp::invalid());
+    if (kCheckRegs && x3609 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3610 = x3386 * x3608;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7795,10 +7793,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3622 = x3613 + x3618;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3623 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x3623 != Fp::invalid());
+    if (kCheckRegs && x3623 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3624 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x3624 != Fp::invalid());
+    if (kCheckRegs && x3624 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3625 = x3386 * x3623;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7889,10 +7887,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3668 = x3667 + x3662;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3669 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x3669 != Fp::invalid());
+    if (kCheckRegs && x3669 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3670 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x3670 != Fp::invalid());
+    if (kCheckRegs && x3670 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3671 = x3386 * x3669;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -7983,10 +7981,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3714 = x3713 + x3708;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3715 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x3715 != Fp::invalid());
+    if (kCheckRegs && x3715 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3716 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x3716 != Fp::invalid());
+    if (kCheckRegs && x3716 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3717 = x3386 * x3715;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8015,10 +8013,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3729 = x3720 + x3725;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3730 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x3730 != Fp::invalid());
+    if (kCheckRegs && x3730 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3731 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x3731 != Fp::invalid());
+    if (kCheckRegs && x3731 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3732 = x3386 * x3730;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8109,10 +8107,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3775 = x3774 + x3769;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3776 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x3776 != Fp::invalid());
+    if (kCheckRegs && x3776 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3777 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x3777 != Fp::invalid());
+    if (kCheckRegs && x3777 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3778 = x3386 * x3776;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8203,10 +8201,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3821 = x3820 + x3815;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3822 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x3822 != Fp::invalid());
+    if (kCheckRegs && x3822 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3823 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x3823 != Fp::invalid());
+    if (kCheckRegs && x3823 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3824 = x3386 * x3822;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8235,10 +8233,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3836 = x3827 + x3832;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3837 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x3837 != Fp::invalid());
+    if (kCheckRegs && x3837 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3838 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x3838 != Fp::invalid());
+    if (kCheckRegs && x3838 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3839 = x3386 * x3837;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8329,10 +8327,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3882 = x3881 + x3876;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3883 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x3883 != Fp::invalid());
+    if (kCheckRegs && x3883 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3884 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x3884 != Fp::invalid());
+    if (kCheckRegs && x3884 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3885 = x3386 * x3883;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8361,10 +8359,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3897 = x3888 + x3893;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3898 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x3898 != Fp::invalid());
+    if (kCheckRegs && x3898 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3899 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x3899 != Fp::invalid());
+    if (kCheckRegs && x3899 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3900 = x3386 * x3898;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8455,10 +8453,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3943 = x3942 + x3937;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3944 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x3944 != Fp::invalid());
+    if (kCheckRegs && x3944 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3945 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x3945 != Fp::invalid());
+    if (kCheckRegs && x3945 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3946 = x3386 * x3944;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8549,10 +8547,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x3989 = x3988 + x3983;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3990 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x3990 != Fp::invalid());
+    if (kCheckRegs && x3990 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x3991 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x3991 != Fp::invalid());
+    if (kCheckRegs && x3991 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x3992 = x3386 * x3990;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8581,10 +8579,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4004 = x3995 + x4000;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4005 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x4005 != Fp::invalid());
+    if (kCheckRegs && x4005 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4006 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x4006 != Fp::invalid());
+    if (kCheckRegs && x4006 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4007 = x3386 * x4005;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8675,10 +8673,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4050 = x4049 + x4044;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4051 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x4051 != Fp::invalid());
+    if (kCheckRegs && x4051 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4052 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x4052 != Fp::invalid());
+    if (kCheckRegs && x4052 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4053 = x3386 * x4051;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8769,10 +8767,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4096 = x4095 + x4090;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4097 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x4097 != Fp::invalid());
+    if (kCheckRegs && x4097 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4098 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x4098 != Fp::invalid());
+    if (kCheckRegs && x4098 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4099 = x3386 * x4097;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8801,10 +8799,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4111 = x4102 + x4107;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4112 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x4112 != Fp::invalid());
+    if (kCheckRegs && x4112 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4113 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x4113 != Fp::invalid());
+    if (kCheckRegs && x4113 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4114 = x3386 * x4112;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8895,10 +8893,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4157 = x4156 + x4151;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4158 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x4158 != Fp::invalid());
+    if (kCheckRegs && x4158 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4159 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x4159 != Fp::invalid());
+    if (kCheckRegs && x4159 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4160 = x3386 * x4158;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -8989,10 +8987,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4203 = x4202 + x4197;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4204 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x4204 != Fp::invalid());
+    if (kCheckRegs && x4204 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4205 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x4205 != Fp::invalid());
+    if (kCheckRegs && x4205 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4206 = x3386 * x4204;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -9021,10 +9019,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4218 = x4209 + x4214;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4219 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x4219 != Fp::invalid());
+    if (kCheckRegs && x4219 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4220 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x4220 != Fp::invalid());
+    if (kCheckRegs && x4220 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4221 = x3386 * x4219;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -9115,10 +9113,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4264 = x4263 + x4258;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4265 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x4265 != Fp::invalid());
+    if (kCheckRegs && x4265 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4266 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x4266 != Fp::invalid());
+    if (kCheckRegs && x4266 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4267 = x3386 * x4265;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -9209,10 +9207,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4310 = x4309 + x4304;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4311 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x4311 != Fp::invalid());
+    if (kCheckRegs && x4311 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4312 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x4312 != Fp::invalid());
+    if (kCheckRegs && x4312 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4313 = x3386 * x4311;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -9241,10 +9239,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4325 = x4316 + x4321;
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4326 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x4326 != Fp::invalid());
+    if (kCheckRegs && x4326 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4327 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x4327 != Fp::invalid());
+    if (kCheckRegs && x4327 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4328 = x3386 * x4326;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -9334,33 +9332,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x4371 = x4370 + x4365;
     {
-      host(ctx, "plonkReadAccum", "bytes", host_args.data(), 0, host_outs.data(), 4);
-      auto x4372 = host_outs.at(0);
-      auto x4373 = host_outs.at(1);
-      auto x4374 = host_outs.at(2);
-      auto x4375 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x4372 = host_outs[0];
+      auto x4373 = host_outs[1];
+      auto x4374 = host_outs[2];
+      auto x4375 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4372);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4372) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x4372;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4373);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4373) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x4373;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4374);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4374) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x4374;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4375);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4375) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x4375;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -9564,25 +9562,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][20 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4451);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4451) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][20])");
         reg = x4451;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][21 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4459);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4459) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][21])");
         reg = x4459;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][22 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4467);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4467) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][22])");
         reg = x4467;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][23 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4474);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4474) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][23])");
         reg = x4474;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -9786,25 +9784,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][16 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4550);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4550) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][16])");
         reg = x4550;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][17 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4558);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4558) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][17])");
         reg = x4558;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][18 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4566);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4566) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][18])");
         reg = x4566;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][19 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4573);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4573) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][19])");
         reg = x4573;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -10008,25 +10006,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][12 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4649);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4649) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][12])");
         reg = x4649;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][13 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4657);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4657) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][13])");
         reg = x4657;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][14 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4665);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4665) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][14])");
         reg = x4665;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][15 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4672);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4672) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][15])");
         reg = x4672;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -10230,25 +10228,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4748);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4748) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x4748;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4756);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4756) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x4756;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4764);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4764) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x4764;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4771);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4771) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x4771;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -10452,25 +10450,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4847);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4847) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x4847;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4855);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4855) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x4855;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4863);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4863) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x4863;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x4870);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x4870) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x4870;
       }
     }
@@ -10532,25 +10530,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4898 = args[3][35];
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4899 = args[2][128 * steps + ((cycle - 0) & mask)];
-    assert(x4899 != Fp::invalid());
+    if (kCheckRegs && x4899 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][128], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4900 = args[2][129 * steps + ((cycle - 0) & mask)];
-    assert(x4900 != Fp::invalid());
+    if (kCheckRegs && x4900 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][129], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4901 = args[2][130 * steps + ((cycle - 0) & mask)];
-    assert(x4901 != Fp::invalid());
+    if (kCheckRegs && x4901 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4902 = args[2][131 * steps + ((cycle - 0) & mask)];
-    assert(x4902 != Fp::invalid());
+    if (kCheckRegs && x4902 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][131], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4903 = args[2][132 * steps + ((cycle - 0) & mask)];
-    assert(x4903 != Fp::invalid());
+    if (kCheckRegs && x4903 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][132], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4904 = args[2][133 * steps + ((cycle - 0) & mask)];
-    assert(x4904 != Fp::invalid());
+    if (kCheckRegs && x4904 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][133], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4905 = args[2][134 * steps + ((cycle - 0) & mask)];
-    assert(x4905 != Fp::invalid());
+    if (kCheckRegs && x4905 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][134], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4906 = x4871 * x4899;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -10659,25 +10657,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x4958 = x4950 + x4954;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4959 = args[2][135 * steps + ((cycle - 0) & mask)];
-    assert(x4959 != Fp::invalid());
+    if (kCheckRegs && x4959 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][135], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4960 = args[2][136 * steps + ((cycle - 0) & mask)];
-    assert(x4960 != Fp::invalid());
+    if (kCheckRegs && x4960 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][136], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4961 = args[2][137 * steps + ((cycle - 0) & mask)];
-    assert(x4961 != Fp::invalid());
+    if (kCheckRegs && x4961 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4962 = args[2][138 * steps + ((cycle - 0) & mask)];
-    assert(x4962 != Fp::invalid());
+    if (kCheckRegs && x4962 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][138], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4963 = args[2][139 * steps + ((cycle - 0) & mask)];
-    assert(x4963 != Fp::invalid());
+    if (kCheckRegs && x4963 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][139], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4964 = args[2][140 * steps + ((cycle - 0) & mask)];
-    assert(x4964 != Fp::invalid());
+    if (kCheckRegs && x4964 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][140], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x4965 = args[2][141 * steps + ((cycle - 0) & mask)];
-    assert(x4965 != Fp::invalid());
+    if (kCheckRegs && x4965 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][141], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x4966 = x4871 * x4959;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -10848,25 +10846,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5049 = x5048 + x5043;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5050 = args[2][156 * steps + ((cycle - 0) & mask)];
-    assert(x5050 != Fp::invalid());
+    if (kCheckRegs && x5050 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][156], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5051 = args[2][157 * steps + ((cycle - 0) & mask)];
-    assert(x5051 != Fp::invalid());
+    if (kCheckRegs && x5051 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][157], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5052 = args[2][158 * steps + ((cycle - 0) & mask)];
-    assert(x5052 != Fp::invalid());
+    if (kCheckRegs && x5052 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5053 = args[2][159 * steps + ((cycle - 0) & mask)];
-    assert(x5053 != Fp::invalid());
+    if (kCheckRegs && x5053 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][159], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5054 = args[2][160 * steps + ((cycle - 0) & mask)];
-    assert(x5054 != Fp::invalid());
+    if (kCheckRegs && x5054 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][160], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5055 = args[2][161 * steps + ((cycle - 0) & mask)];
-    assert(x5055 != Fp::invalid());
+    if (kCheckRegs && x5055 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][161], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5056 = args[2][162 * steps + ((cycle - 0) & mask)];
-    assert(x5056 != Fp::invalid());
+    if (kCheckRegs && x5056 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][162], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5057 = x4871 * x5050;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -10975,25 +10973,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5109 = x5101 + x5105;
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5110 = args[2][89 * steps + ((cycle - 0) & mask)];
-    assert(x5110 != Fp::invalid());
+    if (kCheckRegs && x5110 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5111 = args[2][90 * steps + ((cycle - 0) & mask)];
-    assert(x5111 != Fp::invalid());
+    if (kCheckRegs && x5111 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5112 = args[2][91 * steps + ((cycle - 0) & mask)];
-    assert(x5112 != Fp::invalid());
+    if (kCheckRegs && x5112 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5113 = args[2][92 * steps + ((cycle - 0) & mask)];
-    assert(x5113 != Fp::invalid());
+    if (kCheckRegs && x5113 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5114 = args[2][93 * steps + ((cycle - 0) & mask)];
-    assert(x5114 != Fp::invalid());
+    if (kCheckRegs && x5114 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5115 = args[2][94 * steps + ((cycle - 0) & mask)];
-    assert(x5115 != Fp::invalid());
+    if (kCheckRegs && x5115 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5116 = args[2][95 * steps + ((cycle - 0) & mask)];
-    assert(x5116 != Fp::invalid());
+    if (kCheckRegs && x5116 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5117 = x4871 * x5110;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11163,33 +11161,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x5200 = x5199 + x5194;
     {
-      host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-      auto x5201 = host_outs.at(0);
-      auto x5202 = host_outs.at(1);
-      auto x5203 = host_outs.at(2);
-      auto x5204 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x5201 = host_outs[0];
+      auto x5202 = host_outs[1];
+      auto x5203 = host_outs[2];
+      auto x5204 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][24 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5201);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5201) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
         reg = x5201;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][25 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5202);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5202) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
         reg = x5202;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][26 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5203);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5203) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
         reg = x5203;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][27 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5204);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5204) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
         reg = x5204;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -11393,25 +11391,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][28 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5280);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5280) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
         reg = x5280;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][29 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5288);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5288) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
         reg = x5288;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][30 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5296);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5296) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
         reg = x5296;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][31 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x5303);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x5303) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
         reg = x5303;
       }
     }
@@ -11435,10 +11433,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5311 = args[3][7];
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5312 = args[2][9 * steps + ((cycle - 0) & mask)];
-    assert(x5312 != Fp::invalid());
+    if (kCheckRegs && x5312 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5313 = args[2][10 * steps + ((cycle - 0) & mask)];
-    assert(x5313 != Fp::invalid());
+    if (kCheckRegs && x5313 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5314 = x5304 * x5312;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11467,10 +11465,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5326 = x5317 + x5322;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5327 = args[2][11 * steps + ((cycle - 0) & mask)];
-    assert(x5327 != Fp::invalid());
+    if (kCheckRegs && x5327 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5328 = args[2][12 * steps + ((cycle - 0) & mask)];
-    assert(x5328 != Fp::invalid());
+    if (kCheckRegs && x5328 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5329 = x5304 * x5327;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11561,10 +11559,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5372 = x5371 + x5366;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5373 = args[2][13 * steps + ((cycle - 0) & mask)];
-    assert(x5373 != Fp::invalid());
+    if (kCheckRegs && x5373 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5374 = args[2][14 * steps + ((cycle - 0) & mask)];
-    assert(x5374 != Fp::invalid());
+    if (kCheckRegs && x5374 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5375 = x5304 * x5373;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11655,10 +11653,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5418 = x5417 + x5412;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5419 = args[2][15 * steps + ((cycle - 0) & mask)];
-    assert(x5419 != Fp::invalid());
+    if (kCheckRegs && x5419 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5420 = args[2][16 * steps + ((cycle - 0) & mask)];
-    assert(x5420 != Fp::invalid());
+    if (kCheckRegs && x5420 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5421 = x5304 * x5419;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11687,10 +11685,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5433 = x5424 + x5429;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5434 = args[2][17 * steps + ((cycle - 0) & mask)];
-    assert(x5434 != Fp::invalid());
+    if (kCheckRegs && x5434 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5435 = args[2][18 * steps + ((cycle - 0) & mask)];
-    assert(x5435 != Fp::invalid());
+    if (kCheckRegs && x5435 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5436 = x5304 * x5434;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11781,10 +11779,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5479 = x5478 + x5473;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5480 = args[2][19 * steps + ((cycle - 0) & mask)];
-    assert(x5480 != Fp::invalid());
+    if (kCheckRegs && x5480 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5481 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x5481 != Fp::invalid());
+    if (kCheckRegs && x5481 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5482 = x5304 * x5480;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11875,10 +11873,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5525 = x5524 + x5519;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5526 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x5526 != Fp::invalid());
+    if (kCheckRegs && x5526 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5527 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x5527 != Fp::invalid());
+    if (kCheckRegs && x5527 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5528 = x5304 * x5526;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -11907,10 +11905,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5540 = x5531 + x5536;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5541 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x5541 != Fp::invalid());
+    if (kCheckRegs && x5541 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5542 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x5542 != Fp::invalid());
+    if (kCheckRegs && x5542 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5543 = x5304 * x5541;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12001,10 +11999,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5586 = x5585 + x5580;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5587 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x5587 != Fp::invalid());
+    if (kCheckRegs && x5587 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5588 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x5588 != Fp::invalid());
+    if (kCheckRegs && x5588 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5589 = x5304 * x5587;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12095,10 +12093,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5632 = x5631 + x5626;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5633 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x5633 != Fp::invalid());
+    if (kCheckRegs && x5633 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5634 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x5634 != Fp::invalid());
+    if (kCheckRegs && x5634 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5635 = x5304 * x5633;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12127,10 +12125,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5647 = x5638 + x5643;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5648 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x5648 != Fp::invalid());
+    if (kCheckRegs && x5648 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5649 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x5649 != Fp::invalid());
+    if (kCheckRegs && x5649 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5650 = x5304 * x5648;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12221,10 +12219,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5693 = x5692 + x5687;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5694 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x5694 != Fp::invalid());
+    if (kCheckRegs && x5694 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5695 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x5695 != Fp::invalid());
+    if (kCheckRegs && x5695 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5696 = x5304 * x5694;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12315,10 +12313,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5739 = x5738 + x5733;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5740 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x5740 != Fp::invalid());
+    if (kCheckRegs && x5740 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5741 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x5741 != Fp::invalid());
+    if (kCheckRegs && x5741 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5742 = x5304 * x5740;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12347,10 +12345,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5754 = x5745 + x5750;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5755 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x5755 != Fp::invalid());
+    if (kCheckRegs && x5755 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5756 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x5756 != Fp::invalid());
+    if (kCheckRegs && x5756 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5757 = x5304 * x5755;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12441,10 +12439,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5800 = x5799 + x5794;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5801 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x5801 != Fp::invalid());
+    if (kCheckRegs && x5801 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5802 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x5802 != Fp::invalid());
+    if (kCheckRegs && x5802 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5803 = x5304 * x5801;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12473,10 +12471,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5815 = x5806 + x5811;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5816 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x5816 != Fp::invalid());
+    if (kCheckRegs && x5816 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5817 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x5817 != Fp::invalid());
+    if (kCheckRegs && x5817 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5818 = x5304 * x5816;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12567,10 +12565,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5861 = x5860 + x5855;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5862 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x5862 != Fp::invalid());
+    if (kCheckRegs && x5862 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5863 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x5863 != Fp::invalid());
+    if (kCheckRegs && x5863 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5864 = x5304 * x5862;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12661,10 +12659,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5907 = x5906 + x5901;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5908 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x5908 != Fp::invalid());
+    if (kCheckRegs && x5908 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5909 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x5909 != Fp::invalid());
+    if (kCheckRegs && x5909 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5910 = x5304 * x5908;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12693,10 +12691,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5922 = x5913 + x5918;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5923 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x5923 != Fp::invalid());
+    if (kCheckRegs && x5923 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5924 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x5924 != Fp::invalid());
+    if (kCheckRegs && x5924 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5925 = x5304 * x5923;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12787,10 +12785,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x5968 = x5967 + x5962;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5969 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x5969 != Fp::invalid());
+    if (kCheckRegs && x5969 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x5970 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x5970 != Fp::invalid());
+    if (kCheckRegs && x5970 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x5971 = x5304 * x5969;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12881,10 +12879,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6014 = x6013 + x6008;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6015 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x6015 != Fp::invalid());
+    if (kCheckRegs && x6015 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6016 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x6016 != Fp::invalid());
+    if (kCheckRegs && x6016 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6017 = x5304 * x6015;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -12913,10 +12911,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6029 = x6020 + x6025;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6030 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x6030 != Fp::invalid());
+    if (kCheckRegs && x6030 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6031 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x6031 != Fp::invalid());
+    if (kCheckRegs && x6031 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6032 = x5304 * x6030;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13007,10 +13005,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6075 = x6074 + x6069;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6076 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x6076 != Fp::invalid());
+    if (kCheckRegs && x6076 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6077 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x6077 != Fp::invalid());
+    if (kCheckRegs && x6077 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6078 = x5304 * x6076;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13101,10 +13099,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6121 = x6120 + x6115;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6122 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x6122 != Fp::invalid());
+    if (kCheckRegs && x6122 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6123 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x6123 != Fp::invalid());
+    if (kCheckRegs && x6123 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6124 = x5304 * x6122;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13133,10 +13131,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6136 = x6127 + x6132;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6137 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x6137 != Fp::invalid());
+    if (kCheckRegs && x6137 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6138 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x6138 != Fp::invalid());
+    if (kCheckRegs && x6138 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6139 = x5304 * x6137;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13227,10 +13225,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6182 = x6181 + x6176;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6183 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x6183 != Fp::invalid());
+    if (kCheckRegs && x6183 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6184 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x6184 != Fp::invalid());
+    if (kCheckRegs && x6184 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6185 = x5304 * x6183;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13321,10 +13319,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6228 = x6227 + x6222;
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6229 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x6229 != Fp::invalid());
+    if (kCheckRegs && x6229 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6230 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x6230 != Fp::invalid());
+    if (kCheckRegs && x6230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6231 = x5304 * x6229;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13353,10 +13351,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6243 = x6234 + x6239;
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6244 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x6244 != Fp::invalid());
+    if (kCheckRegs && x6244 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6245 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x6245 != Fp::invalid());
+    if (kCheckRegs && x6245 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6246 = x5304 * x6244;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -13446,33 +13444,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x6289 = x6288 + x6283;
     {
-      host(ctx, "plonkReadAccum", "bytes", host_args.data(), 0, host_outs.data(), 4);
-      auto x6290 = host_outs.at(0);
-      auto x6291 = host_outs.at(1);
-      auto x6292 = host_outs.at(2);
-      auto x6293 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x6290 = host_outs[0];
+      auto x6291 = host_outs[1];
+      auto x6292 = host_outs[2];
+      auto x6293 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6290);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6290) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x6290;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6291);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6291) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x6291;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6292);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6292) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x6292;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6293);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6293) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x6293;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -13676,25 +13674,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][20 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6369);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6369) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][20])");
         reg = x6369;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][21 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6377);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6377) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][21])");
         reg = x6377;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][22 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6385);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6385) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][22])");
         reg = x6385;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][23 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6392);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6392) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][23])");
         reg = x6392;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -13898,25 +13896,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][16 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6468);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6468) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][16])");
         reg = x6468;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][17 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6476);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6476) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][17])");
         reg = x6476;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][18 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6484);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6484) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][18])");
         reg = x6484;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][19 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6491);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6491) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][19])");
         reg = x6491;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -14120,25 +14118,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][12 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6567);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6567) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][12])");
         reg = x6567;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][13 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6575);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6575) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][13])");
         reg = x6575;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][14 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6583);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6583) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][14])");
         reg = x6583;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][15 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6590);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6590) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][15])");
         reg = x6590;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -14342,25 +14340,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6666);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6666) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x6666;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6674);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6674) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x6674;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6682);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6682) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x6682;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6689);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6689) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x6689;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -14564,25 +14562,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6765);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6765) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x6765;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6773);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6773) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x6773;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6781);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6781) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x6781;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x6788);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x6788) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x6788;
       }
     }
@@ -14644,25 +14642,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6816 = args[3][35];
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6817 = args[2][128 * steps + ((cycle - 0) & mask)];
-    assert(x6817 != Fp::invalid());
+    if (kCheckRegs && x6817 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][128], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6818 = args[2][129 * steps + ((cycle - 0) & mask)];
-    assert(x6818 != Fp::invalid());
+    if (kCheckRegs && x6818 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][129], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6819 = args[2][130 * steps + ((cycle - 0) & mask)];
-    assert(x6819 != Fp::invalid());
+    if (kCheckRegs && x6819 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6820 = args[2][131 * steps + ((cycle - 0) & mask)];
-    assert(x6820 != Fp::invalid());
+    if (kCheckRegs && x6820 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][131], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6821 = args[2][132 * steps + ((cycle - 0) & mask)];
-    assert(x6821 != Fp::invalid());
+    if (kCheckRegs && x6821 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][132], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6822 = args[2][133 * steps + ((cycle - 0) & mask)];
-    assert(x6822 != Fp::invalid());
+    if (kCheckRegs && x6822 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][133], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6823 = args[2][134 * steps + ((cycle - 0) & mask)];
-    assert(x6823 != Fp::invalid());
+    if (kCheckRegs && x6823 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][134], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6824 = x6789 * x6817;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -14771,25 +14769,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6876 = x6868 + x6872;
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6877 = args[2][135 * steps + ((cycle - 0) & mask)];
-    assert(x6877 != Fp::invalid());
+    if (kCheckRegs && x6877 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][135], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6878 = args[2][136 * steps + ((cycle - 0) & mask)];
-    assert(x6878 != Fp::invalid());
+    if (kCheckRegs && x6878 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][136], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6879 = args[2][137 * steps + ((cycle - 0) & mask)];
-    assert(x6879 != Fp::invalid());
+    if (kCheckRegs && x6879 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6880 = args[2][138 * steps + ((cycle - 0) & mask)];
-    assert(x6880 != Fp::invalid());
+    if (kCheckRegs && x6880 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][138], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6881 = args[2][139 * steps + ((cycle - 0) & mask)];
-    assert(x6881 != Fp::invalid());
+    if (kCheckRegs && x6881 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][139], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6882 = args[2][140 * steps + ((cycle - 0) & mask)];
-    assert(x6882 != Fp::invalid());
+    if (kCheckRegs && x6882 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][140], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6883 = args[2][141 * steps + ((cycle - 0) & mask)];
-    assert(x6883 != Fp::invalid());
+    if (kCheckRegs && x6883 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][141], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6884 = x6789 * x6877;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -14960,25 +14958,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x6967 = x6966 + x6961;
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6968 = args[2][156 * steps + ((cycle - 0) & mask)];
-    assert(x6968 != Fp::invalid());
+    if (kCheckRegs && x6968 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][156], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6969 = args[2][157 * steps + ((cycle - 0) & mask)];
-    assert(x6969 != Fp::invalid());
+    if (kCheckRegs && x6969 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][157], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6970 = args[2][158 * steps + ((cycle - 0) & mask)];
-    assert(x6970 != Fp::invalid());
+    if (kCheckRegs && x6970 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6971 = args[2][159 * steps + ((cycle - 0) & mask)];
-    assert(x6971 != Fp::invalid());
+    if (kCheckRegs && x6971 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][159], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6972 = args[2][160 * steps + ((cycle - 0) & mask)];
-    assert(x6972 != Fp::invalid());
+    if (kCheckRegs && x6972 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][160], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6973 = args[2][161 * steps + ((cycle - 0) & mask)];
-    assert(x6973 != Fp::invalid());
+    if (kCheckRegs && x6973 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][161], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x6974 = args[2][162 * steps + ((cycle - 0) & mask)];
-    assert(x6974 != Fp::invalid());
+    if (kCheckRegs && x6974 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][162], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x6975 = x6789 * x6968;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15087,25 +15085,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7027 = x7019 + x7023;
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7028 = args[2][89 * steps + ((cycle - 0) & mask)];
-    assert(x7028 != Fp::invalid());
+    if (kCheckRegs && x7028 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7029 = args[2][90 * steps + ((cycle - 0) & mask)];
-    assert(x7029 != Fp::invalid());
+    if (kCheckRegs && x7029 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7030 = args[2][91 * steps + ((cycle - 0) & mask)];
-    assert(x7030 != Fp::invalid());
+    if (kCheckRegs && x7030 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7031 = args[2][92 * steps + ((cycle - 0) & mask)];
-    assert(x7031 != Fp::invalid());
+    if (kCheckRegs && x7031 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7032 = args[2][93 * steps + ((cycle - 0) & mask)];
-    assert(x7032 != Fp::invalid());
+    if (kCheckRegs && x7032 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7033 = args[2][94 * steps + ((cycle - 0) & mask)];
-    assert(x7033 != Fp::invalid());
+    if (kCheckRegs && x7033 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7034 = args[2][95 * steps + ((cycle - 0) & mask)];
-    assert(x7034 != Fp::invalid());
+    if (kCheckRegs && x7034 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7035 = x6789 * x7028;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15275,33 +15273,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x7118 = x7117 + x7112;
     {
-      host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-      auto x7119 = host_outs.at(0);
-      auto x7120 = host_outs.at(1);
-      auto x7121 = host_outs.at(2);
-      auto x7122 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x7119 = host_outs[0];
+      auto x7120 = host_outs[1];
+      auto x7121 = host_outs[2];
+      auto x7122 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][24 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7119);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7119) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
         reg = x7119;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][25 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7120);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7120) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
         reg = x7120;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][26 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7121);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7121) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
         reg = x7121;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][27 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7122);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7122) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
         reg = x7122;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -15505,25 +15503,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][28 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7198);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7198) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
         reg = x7198;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][29 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7206);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7206) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
         reg = x7206;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][30 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7214);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7214) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
         reg = x7214;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][31 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x7221);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x7221) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
         reg = x7221;
       }
     }
@@ -15547,10 +15545,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7229 = args[3][7];
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7230 = args[2][9 * steps + ((cycle - 0) & mask)];
-    assert(x7230 != Fp::invalid());
+    if (kCheckRegs && x7230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7231 = args[2][10 * steps + ((cycle - 0) & mask)];
-    assert(x7231 != Fp::invalid());
+    if (kCheckRegs && x7231 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7232 = x7222 * x7230;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15579,10 +15577,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7244 = x7235 + x7240;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7245 = args[2][11 * steps + ((cycle - 0) & mask)];
-    assert(x7245 != Fp::invalid());
+    if (kCheckRegs && x7245 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7246 = args[2][12 * steps + ((cycle - 0) & mask)];
-    assert(x7246 != Fp::invalid());
+    if (kCheckRegs && x7246 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7247 = x7222 * x7245;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15673,10 +15671,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7290 = x7289 + x7284;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7291 = args[2][13 * steps + ((cycle - 0) & mask)];
-    assert(x7291 != Fp::invalid());
+    if (kCheckRegs && x7291 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7292 = args[2][14 * steps + ((cycle - 0) & mask)];
-    assert(x7292 != Fp::invalid());
+    if (kCheckRegs && x7292 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7293 = x7222 * x7291;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15767,10 +15765,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7336 = x7335 + x7330;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7337 = args[2][15 * steps + ((cycle - 0) & mask)];
-    assert(x7337 != Fp::invalid());
+    if (kCheckRegs && x7337 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7338 = args[2][16 * steps + ((cycle - 0) & mask)];
-    assert(x7338 != Fp::invalid());
+    if (kCheckRegs && x7338 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7339 = x7222 * x7337;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15799,10 +15797,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7351 = x7342 + x7347;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7352 = args[2][17 * steps + ((cycle - 0) & mask)];
-    assert(x7352 != Fp::invalid());
+    if (kCheckRegs && x7352 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7353 = args[2][18 * steps + ((cycle - 0) & mask)];
-    assert(x7353 != Fp::invalid());
+    if (kCheckRegs && x7353 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7354 = x7222 * x7352;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15893,10 +15891,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7397 = x7396 + x7391;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7398 = args[2][19 * steps + ((cycle - 0) & mask)];
-    assert(x7398 != Fp::invalid());
+    if (kCheckRegs && x7398 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7399 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x7399 != Fp::invalid());
+    if (kCheckRegs && x7399 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7400 = x7222 * x7398;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -15987,10 +15985,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7443 = x7442 + x7437;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7444 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x7444 != Fp::invalid());
+    if (kCheckRegs && x7444 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7445 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x7445 != Fp::invalid());
+    if (kCheckRegs && x7445 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7446 = x7222 * x7444;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16019,10 +16017,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7458 = x7449 + x7454;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7459 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x7459 != Fp::invalid());
+    if (kCheckRegs && x7459 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7460 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x7460 != Fp::invalid());
+    if (kCheckRegs && x7460 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7461 = x7222 * x7459;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16113,10 +16111,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7504 = x7503 + x7498;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7505 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x7505 != Fp::invalid());
+    if (kCheckRegs && x7505 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7506 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x7506 != Fp::invalid());
+    if (kCheckRegs && x7506 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7507 = x7222 * x7505;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16207,10 +16205,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7550 = x7549 + x7544;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7551 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x7551 != Fp::invalid());
+    if (kCheckRegs && x7551 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7552 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x7552 != Fp::invalid());
+    if (kCheckRegs && x7552 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7553 = x7222 * x7551;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16239,10 +16237,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7565 = x7556 + x7561;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7566 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x7566 != Fp::invalid());
+    if (kCheckRegs && x7566 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7567 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x7567 != Fp::invalid());
+    if (kCheckRegs && x7567 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7568 = x7222 * x7566;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16333,10 +16331,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7611 = x7610 + x7605;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7612 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x7612 != Fp::invalid());
+    if (kCheckRegs && x7612 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7613 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x7613 != Fp::invalid());
+    if (kCheckRegs && x7613 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7614 = x7222 * x7612;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16427,10 +16425,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7657 = x7656 + x7651;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7658 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x7658 != Fp::invalid());
+    if (kCheckRegs && x7658 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7659 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x7659 != Fp::invalid());
+    if (kCheckRegs && x7659 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7660 = x7222 * x7658;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16459,10 +16457,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7672 = x7663 + x7668;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7673 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x7673 != Fp::invalid());
+    if (kCheckRegs && x7673 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7674 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x7674 != Fp::invalid());
+    if (kCheckRegs && x7674 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7675 = x7222 * x7673;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16553,10 +16551,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7718 = x7717 + x7712;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7719 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x7719 != Fp::invalid());
+    if (kCheckRegs && x7719 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7720 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x7720 != Fp::invalid());
+    if (kCheckRegs && x7720 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7721 = x7222 * x7719;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16585,10 +16583,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7733 = x7724 + x7729;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7734 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x7734 != Fp::invalid());
+    if (kCheckRegs && x7734 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7735 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x7735 != Fp::invalid());
+    if (kCheckRegs && x7735 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7736 = x7222 * x7734;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16679,10 +16677,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7779 = x7778 + x7773;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7780 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x7780 != Fp::invalid());
+    if (kCheckRegs && x7780 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7781 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x7781 != Fp::invalid());
+    if (kCheckRegs && x7781 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7782 = x7222 * x7780;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16773,10 +16771,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7825 = x7824 + x7819;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7826 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x7826 != Fp::invalid());
+    if (kCheckRegs && x7826 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7827 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x7827 != Fp::invalid());
+    if (kCheckRegs && x7827 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7828 = x7222 * x7826;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16805,10 +16803,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7840 = x7831 + x7836;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7841 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x7841 != Fp::invalid());
+    if (kCheckRegs && x7841 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7842 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x7842 != Fp::invalid());
+    if (kCheckRegs && x7842 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7843 = x7222 * x7841;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16899,10 +16897,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7886 = x7885 + x7880;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7887 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x7887 != Fp::invalid());
+    if (kCheckRegs && x7887 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7888 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x7888 != Fp::invalid());
+    if (kCheckRegs && x7888 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7889 = x7222 * x7887;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -16993,10 +16991,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7932 = x7931 + x7926;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7933 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x7933 != Fp::invalid());
+    if (kCheckRegs && x7933 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7934 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x7934 != Fp::invalid());
+    if (kCheckRegs && x7934 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7935 = x7222 * x7933;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17025,10 +17023,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7947 = x7938 + x7943;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7948 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x7948 != Fp::invalid());
+    if (kCheckRegs && x7948 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7949 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x7949 != Fp::invalid());
+    if (kCheckRegs && x7949 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7950 = x7222 * x7948;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17119,10 +17117,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x7993 = x7992 + x7987;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7994 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x7994 != Fp::invalid());
+    if (kCheckRegs && x7994 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x7995 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x7995 != Fp::invalid());
+    if (kCheckRegs && x7995 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x7996 = x7222 * x7994;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17213,10 +17211,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x8039 = x8038 + x8033;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8040 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x8040 != Fp::invalid());
+    if (kCheckRegs && x8040 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8041 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x8041 != Fp::invalid());
+    if (kCheckRegs && x8041 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x8042 = x7222 * x8040;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17245,10 +17243,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x8054 = x8045 + x8050;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8055 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x8055 != Fp::invalid());
+    if (kCheckRegs && x8055 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8056 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x8056 != Fp::invalid());
+    if (kCheckRegs && x8056 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x8057 = x7222 * x8055;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17339,10 +17337,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x8100 = x8099 + x8094;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8101 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x8101 != Fp::invalid());
+    if (kCheckRegs && x8101 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8102 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x8102 != Fp::invalid());
+    if (kCheckRegs && x8102 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x8103 = x7222 * x8101;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17433,10 +17431,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x8146 = x8145 + x8140;
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8147 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x8147 != Fp::invalid());
+    if (kCheckRegs && x8147 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8148 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x8148 != Fp::invalid());
+    if (kCheckRegs && x8148 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x8149 = x7222 * x8147;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17465,10 +17463,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x8161 = x8152 + x8157;
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8162 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x8162 != Fp::invalid());
+    if (kCheckRegs && x8162 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x8163 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x8163 != Fp::invalid());
+    if (kCheckRegs && x8163 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x8164 = x7222 * x8162;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -17558,33 +17556,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x8207 = x8206 + x8201;
     {
-      host(ctx, "plonkReadAccum", "bytes", host_args.data(), 0, host_outs.data(), 4);
-      auto x8208 = host_outs.at(0);
-      auto x8209 = host_outs.at(1);
-      auto x8210 = host_outs.at(2);
-      auto x8211 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x8208 = host_outs[0];
+      auto x8209 = host_outs[1];
+      auto x8210 = host_outs[2];
+      auto x8211 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8208);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8208) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x8208;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8209);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8209) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x8209;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8210);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8210) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x8210;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8211);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8211) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x8211;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -17788,25 +17786,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][20 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8287);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8287) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][20])");
         reg = x8287;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][21 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8295);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8295) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][21])");
         reg = x8295;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][22 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8303);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8303) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][22])");
         reg = x8303;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][23 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8310);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8310) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][23])");
         reg = x8310;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -18010,25 +18008,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][16 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8386);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8386) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][16])");
         reg = x8386;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][17 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8394);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8394) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][17])");
         reg = x8394;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][18 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8402);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8402) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][18])");
         reg = x8402;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][19 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8409);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8409) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][19])");
         reg = x8409;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -18232,25 +18230,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][12 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8485);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8485) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][12])");
         reg = x8485;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][13 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8493);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8493) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][13])");
         reg = x8493;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][14 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8501);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8501) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][14])");
         reg = x8501;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][15 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8508);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8508) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][15])");
         reg = x8508;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -18454,25 +18452,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8584);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8584) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x8584;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8592);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8592) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x8592;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8600);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8600) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x8600;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8607);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8607) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x8607;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -18676,31 +18674,31 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8683);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8683) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x8683;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8691);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8691) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x8691;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8699);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8699) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x8699;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x8706);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x8706) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x8706;
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x8707 = args[2][100 * steps + ((cycle - 0) & mask)];
-    assert(x8707 != Fp::invalid());
+    if (kCheckRegs && x8707 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][100], back 0)");
     if (x8707 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x8708 = args[3][8];
@@ -18760,25 +18758,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x8735 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8736 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x8736 != Fp::invalid());
+      if (kCheckRegs && x8736 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8737 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x8737 != Fp::invalid());
+      if (kCheckRegs && x8737 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8738 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x8738 != Fp::invalid());
+      if (kCheckRegs && x8738 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8739 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x8739 != Fp::invalid());
+      if (kCheckRegs && x8739 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8740 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x8740 != Fp::invalid());
+      if (kCheckRegs && x8740 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8741 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x8741 != Fp::invalid());
+      if (kCheckRegs && x8741 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8742 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x8742 != Fp::invalid());
+      if (kCheckRegs && x8742 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8743 = x8708 * x8736;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -18887,25 +18885,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x8795 = x8787 + x8791;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8796 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x8796 != Fp::invalid());
+      if (kCheckRegs && x8796 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8797 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x8797 != Fp::invalid());
+      if (kCheckRegs && x8797 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8798 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x8798 != Fp::invalid());
+      if (kCheckRegs && x8798 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8799 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x8799 != Fp::invalid());
+      if (kCheckRegs && x8799 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8800 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x8800 != Fp::invalid());
+      if (kCheckRegs && x8800 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8801 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x8801 != Fp::invalid());
+      if (kCheckRegs && x8801 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8802 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x8802 != Fp::invalid());
+      if (kCheckRegs && x8802 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8803 = x8708 * x8796;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19076,25 +19074,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x8886 = x8885 + x8880;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8887 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x8887 != Fp::invalid());
+      if (kCheckRegs && x8887 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8888 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x8888 != Fp::invalid());
+      if (kCheckRegs && x8888 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8889 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x8889 != Fp::invalid());
+      if (kCheckRegs && x8889 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8890 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x8890 != Fp::invalid());
+      if (kCheckRegs && x8890 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8891 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x8891 != Fp::invalid());
+      if (kCheckRegs && x8891 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8892 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x8892 != Fp::invalid());
+      if (kCheckRegs && x8892 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8893 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x8893 != Fp::invalid());
+      if (kCheckRegs && x8893 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/0(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8894 = x8708 * x8887;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19203,25 +19201,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x8946 = x8938 + x8942;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8947 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x8947 != Fp::invalid());
+      if (kCheckRegs && x8947 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8948 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x8948 != Fp::invalid());
+      if (kCheckRegs && x8948 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8949 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x8949 != Fp::invalid());
+      if (kCheckRegs && x8949 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8950 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x8950 != Fp::invalid());
+      if (kCheckRegs && x8950 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8951 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x8951 != Fp::invalid());
+      if (kCheckRegs && x8951 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8952 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x8952 != Fp::invalid());
+      if (kCheckRegs && x8952 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x8953 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x8953 != Fp::invalid());
+      if (kCheckRegs && x8953 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x8954 = x8708 * x8947;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19391,33 +19389,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x9037 = x9036 + x9031;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x9038 = host_outs.at(0);
-        auto x9039 = host_outs.at(1);
-        auto x9040 = host_outs.at(2);
-        auto x9041 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x9038 = host_outs[0];
+        auto x9039 = host_outs[1];
+        auto x9040 = host_outs[2];
+        auto x9041 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9038);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9038) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x9038;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9039);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9039) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x9039;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9040);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9040) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x9040;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9041);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9041) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x9041;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -19621,32 +19619,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9117);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9117) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x9117;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9125);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9125) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x9125;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9133);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9133) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x9133;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9140);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9140) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x9140;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x9141 = args[2][101 * steps + ((cycle - 0) & mask)];
-    assert(x9141 != Fp::invalid());
+    if (kCheckRegs && x9141 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][101], back 0)");
     if (x9141 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x9142 = args[3][8];
@@ -19706,25 +19704,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9169 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9170 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x9170 != Fp::invalid());
+      if (kCheckRegs && x9170 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9171 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x9171 != Fp::invalid());
+      if (kCheckRegs && x9171 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9172 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x9172 != Fp::invalid());
+      if (kCheckRegs && x9172 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9173 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x9173 != Fp::invalid());
+      if (kCheckRegs && x9173 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9174 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x9174 != Fp::invalid());
+      if (kCheckRegs && x9174 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9175 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x9175 != Fp::invalid());
+      if (kCheckRegs && x9175 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9176 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x9176 != Fp::invalid());
+      if (kCheckRegs && x9176 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9177 = x9142 * x9170;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -19833,25 +19831,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9229 = x9221 + x9225;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9230 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x9230 != Fp::invalid());
+      if (kCheckRegs && x9230 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9231 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x9231 != Fp::invalid());
+      if (kCheckRegs && x9231 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9232 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x9232 != Fp::invalid());
+      if (kCheckRegs && x9232 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9233 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x9233 != Fp::invalid());
+      if (kCheckRegs && x9233 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9234 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x9234 != Fp::invalid());
+      if (kCheckRegs && x9234 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9235 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x9235 != Fp::invalid());
+      if (kCheckRegs && x9235 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9236 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x9236 != Fp::invalid());
+      if (kCheckRegs && x9236 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9237 = x9142 * x9230;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20022,25 +20020,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9320 = x9319 + x9314;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9321 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x9321 != Fp::invalid());
+      if (kCheckRegs && x9321 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9322 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x9322 != Fp::invalid());
+      if (kCheckRegs && x9322 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9323 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x9323 != Fp::invalid());
+      if (kCheckRegs && x9323 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9324 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x9324 != Fp::invalid());
+      if (kCheckRegs && x9324 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9325 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x9325 != Fp::invalid());
+      if (kCheckRegs && x9325 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9326 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x9326 != Fp::invalid());
+      if (kCheckRegs && x9326 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9327 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x9327 != Fp::invalid());
+      if (kCheckRegs && x9327 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/1(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9328 = x9142 * x9321;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20149,25 +20147,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9380 = x9372 + x9376;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9381 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x9381 != Fp::invalid());
+      if (kCheckRegs && x9381 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9382 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x9382 != Fp::invalid());
+      if (kCheckRegs && x9382 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9383 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x9383 != Fp::invalid());
+      if (kCheckRegs && x9383 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9384 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x9384 != Fp::invalid());
+      if (kCheckRegs && x9384 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9385 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x9385 != Fp::invalid());
+      if (kCheckRegs && x9385 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9386 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x9386 != Fp::invalid());
+      if (kCheckRegs && x9386 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9387 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x9387 != Fp::invalid());
+      if (kCheckRegs && x9387 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9388 = x9142 * x9381;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20337,33 +20335,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x9471 = x9470 + x9465;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x9472 = host_outs.at(0);
-        auto x9473 = host_outs.at(1);
-        auto x9474 = host_outs.at(2);
-        auto x9475 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x9472 = host_outs[0];
+        auto x9473 = host_outs[1];
+        auto x9474 = host_outs[2];
+        auto x9475 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9472);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9472) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x9472;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9473);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9473) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x9473;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9474);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9474) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x9474;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9475);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9475) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x9475;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -20567,32 +20565,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9551);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9551) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x9551;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9559);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9559) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x9559;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9567);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9567) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x9567;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9574);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9574) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x9574;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x9575 = args[2][102 * steps + ((cycle - 0) & mask)];
-    assert(x9575 != Fp::invalid());
+    if (kCheckRegs && x9575 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][102], back 0)");
     if (x9575 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x9576 = args[3][8];
@@ -20652,25 +20650,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9603 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9604 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x9604 != Fp::invalid());
+      if (kCheckRegs && x9604 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9605 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x9605 != Fp::invalid());
+      if (kCheckRegs && x9605 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9606 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x9606 != Fp::invalid());
+      if (kCheckRegs && x9606 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9607 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x9607 != Fp::invalid());
+      if (kCheckRegs && x9607 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9608 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x9608 != Fp::invalid());
+      if (kCheckRegs && x9608 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9609 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x9609 != Fp::invalid());
+      if (kCheckRegs && x9609 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9610 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x9610 != Fp::invalid());
+      if (kCheckRegs && x9610 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9611 = x9576 * x9604;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20779,25 +20777,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9663 = x9655 + x9659;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9664 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x9664 != Fp::invalid());
+      if (kCheckRegs && x9664 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9665 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x9665 != Fp::invalid());
+      if (kCheckRegs && x9665 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9666 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x9666 != Fp::invalid());
+      if (kCheckRegs && x9666 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9667 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x9667 != Fp::invalid());
+      if (kCheckRegs && x9667 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9668 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x9668 != Fp::invalid());
+      if (kCheckRegs && x9668 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9669 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x9669 != Fp::invalid());
+      if (kCheckRegs && x9669 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9670 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x9670 != Fp::invalid());
+      if (kCheckRegs && x9670 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9671 = x9576 * x9664;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -20968,25 +20966,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9754 = x9753 + x9748;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9755 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x9755 != Fp::invalid());
+      if (kCheckRegs && x9755 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9756 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x9756 != Fp::invalid());
+      if (kCheckRegs && x9756 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9757 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x9757 != Fp::invalid());
+      if (kCheckRegs && x9757 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9758 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x9758 != Fp::invalid());
+      if (kCheckRegs && x9758 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9759 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x9759 != Fp::invalid());
+      if (kCheckRegs && x9759 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9760 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x9760 != Fp::invalid());
+      if (kCheckRegs && x9760 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9761 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x9761 != Fp::invalid());
+      if (kCheckRegs && x9761 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/2(ComputeWrap)/ComputeCycle/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9762 = x9576 * x9755;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -21095,25 +21093,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x9814 = x9806 + x9810;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9815 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x9815 != Fp::invalid());
+      if (kCheckRegs && x9815 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9816 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x9816 != Fp::invalid());
+      if (kCheckRegs && x9816 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9817 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x9817 != Fp::invalid());
+      if (kCheckRegs && x9817 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9818 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x9818 != Fp::invalid());
+      if (kCheckRegs && x9818 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9819 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x9819 != Fp::invalid());
+      if (kCheckRegs && x9819 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9820 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x9820 != Fp::invalid());
+      if (kCheckRegs && x9820 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x9821 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x9821 != Fp::invalid());
+      if (kCheckRegs && x9821 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x9822 = x9576 * x9815;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -21283,33 +21281,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x9905 = x9904 + x9899;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x9906 = host_outs.at(0);
-        auto x9907 = host_outs.at(1);
-        auto x9908 = host_outs.at(2);
-        auto x9909 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x9906 = host_outs[0];
+        auto x9907 = host_outs[1];
+        auto x9908 = host_outs[2];
+        auto x9909 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9906);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9906) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x9906;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9907);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9907) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x9907;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9908);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9908) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x9908;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9909);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9909) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x9909;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -21513,32 +21511,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9985);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9985) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x9985;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x9993);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x9993) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x9993;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10001);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10001) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x10001;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10008);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10008) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x10008;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x10009 = args[2][103 * steps + ((cycle - 0) & mask)];
-    assert(x10009 != Fp::invalid());
+    if (kCheckRegs && x10009 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][103], back 0)");
     if (x10009 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x10010 = args[3][8];
@@ -21598,25 +21596,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10037 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10038 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x10038 != Fp::invalid());
+      if (kCheckRegs && x10038 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10039 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x10039 != Fp::invalid());
+      if (kCheckRegs && x10039 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10040 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x10040 != Fp::invalid());
+      if (kCheckRegs && x10040 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10041 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x10041 != Fp::invalid());
+      if (kCheckRegs && x10041 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10042 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x10042 != Fp::invalid());
+      if (kCheckRegs && x10042 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10043 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x10043 != Fp::invalid());
+      if (kCheckRegs && x10043 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10044 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x10044 != Fp::invalid());
+      if (kCheckRegs && x10044 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10045 = x10010 * x10038;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -21725,25 +21723,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10097 = x10089 + x10093;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10098 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x10098 != Fp::invalid());
+      if (kCheckRegs && x10098 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10099 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x10099 != Fp::invalid());
+      if (kCheckRegs && x10099 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10100 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x10100 != Fp::invalid());
+      if (kCheckRegs && x10100 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10101 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x10101 != Fp::invalid());
+      if (kCheckRegs && x10101 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10102 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x10102 != Fp::invalid());
+      if (kCheckRegs && x10102 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10103 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x10103 != Fp::invalid());
+      if (kCheckRegs && x10103 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10104 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x10104 != Fp::invalid());
+      if (kCheckRegs && x10104 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10105 = x10010 * x10098;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -21914,25 +21912,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10188 = x10187 + x10182;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10189 = args[2][144 * steps + ((cycle - 0) & mask)];
-      assert(x10189 != Fp::invalid());
+      if (kCheckRegs && x10189 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10190 = args[2][145 * steps + ((cycle - 0) & mask)];
-      assert(x10190 != Fp::invalid());
+      if (kCheckRegs && x10190 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10191 = args[2][146 * steps + ((cycle - 0) & mask)];
-      assert(x10191 != Fp::invalid());
+      if (kCheckRegs && x10191 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10192 = args[2][147 * steps + ((cycle - 0) & mask)];
-      assert(x10192 != Fp::invalid());
+      if (kCheckRegs && x10192 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10193 = args[2][148 * steps + ((cycle - 0) & mask)];
-      assert(x10193 != Fp::invalid());
+      if (kCheckRegs && x10193 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10194 = args[2][149 * steps + ((cycle - 0) & mask)];
-      assert(x10194 != Fp::invalid());
+      if (kCheckRegs && x10194 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10195 = args[2][150 * steps + ((cycle - 0) & mask)];
-      assert(x10195 != Fp::invalid());
+      if (kCheckRegs && x10195 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10196 = x10010 * x10189;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -22041,25 +22039,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10248 = x10240 + x10244;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10249 = args[2][165 * steps + ((cycle - 0) & mask)];
-      assert(x10249 != Fp::invalid());
+      if (kCheckRegs && x10249 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][165], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10250 = args[2][166 * steps + ((cycle - 0) & mask)];
-      assert(x10250 != Fp::invalid());
+      if (kCheckRegs && x10250 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][166], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10251 = args[2][167 * steps + ((cycle - 0) & mask)];
-      assert(x10251 != Fp::invalid());
+      if (kCheckRegs && x10251 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][167], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10252 = args[2][168 * steps + ((cycle - 0) & mask)];
-      assert(x10252 != Fp::invalid());
+      if (kCheckRegs && x10252 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][168], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10253 = args[2][169 * steps + ((cycle - 0) & mask)];
-      assert(x10253 != Fp::invalid());
+      if (kCheckRegs && x10253 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][169], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10254 = args[2][170 * steps + ((cycle - 0) & mask)];
-      assert(x10254 != Fp::invalid());
+      if (kCheckRegs && x10254 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][170], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10255 = args[2][171 * steps + ((cycle - 0) & mask)];
-      assert(x10255 != Fp::invalid());
+      if (kCheckRegs && x10255 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][171], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10256 = x10010 * x10249;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -22168,25 +22166,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10308 = x10300 + x10304;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10309 = args[2][172 * steps + ((cycle - 0) & mask)];
-      assert(x10309 != Fp::invalid());
+      if (kCheckRegs && x10309 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][172], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10310 = args[2][173 * steps + ((cycle - 0) & mask)];
-      assert(x10310 != Fp::invalid());
+      if (kCheckRegs && x10310 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][173], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10311 = args[2][174 * steps + ((cycle - 0) & mask)];
-      assert(x10311 != Fp::invalid());
+      if (kCheckRegs && x10311 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][174], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10312 = args[2][175 * steps + ((cycle - 0) & mask)];
-      assert(x10312 != Fp::invalid());
+      if (kCheckRegs && x10312 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][175], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10313 = args[2][176 * steps + ((cycle - 0) & mask)];
-      assert(x10313 != Fp::invalid());
+      if (kCheckRegs && x10313 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][176], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10314 = args[2][177 * steps + ((cycle - 0) & mask)];
-      assert(x10314 != Fp::invalid());
+      if (kCheckRegs && x10314 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][177], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10315 = args[2][178 * steps + ((cycle - 0) & mask)];
-      assert(x10315 != Fp::invalid());
+      if (kCheckRegs && x10315 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/3(MemIOCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][178], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10316 = x10010 * x10309;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -22357,25 +22355,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10399 = x10398 + x10393;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10400 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x10400 != Fp::invalid());
+      if (kCheckRegs && x10400 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10401 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x10401 != Fp::invalid());
+      if (kCheckRegs && x10401 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10402 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x10402 != Fp::invalid());
+      if (kCheckRegs && x10402 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10403 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x10403 != Fp::invalid());
+      if (kCheckRegs && x10403 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10404 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x10404 != Fp::invalid());
+      if (kCheckRegs && x10404 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10405 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x10405 != Fp::invalid());
+      if (kCheckRegs && x10405 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10406 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x10406 != Fp::invalid());
+      if (kCheckRegs && x10406 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10407 = x10010 * x10400;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -22483,33 +22481,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10459 = x10451 + x10455;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x10460 = host_outs.at(0);
-        auto x10461 = host_outs.at(1);
-        auto x10462 = host_outs.at(2);
-        auto x10463 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x10460 = host_outs[0];
+        auto x10461 = host_outs[1];
+        auto x10462 = host_outs[2];
+        auto x10463 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10460);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10460) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x10460;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10461);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10461) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x10461;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10462);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10462) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x10462;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10463);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10463) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x10463;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -22713,25 +22711,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][32 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10539);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10539) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][32])");
           reg = x10539;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][33 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10547);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10547) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][33])");
           reg = x10547;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][34 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10555);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10555) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][34])");
           reg = x10555;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][35 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10562);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10562) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][35])");
           reg = x10562;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -22935,32 +22933,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10638);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10638) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x10638;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10646);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10646) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x10646;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10654);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10654) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x10654;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10661);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10661) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x10661;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x10662 = args[2][104 * steps + ((cycle - 0) & mask)];
-    assert(x10662 != Fp::invalid());
+    if (kCheckRegs && x10662 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][104], back 0)");
     if (x10662 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x10663 = args[3][8];
@@ -23020,25 +23018,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10690 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10691 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x10691 != Fp::invalid());
+      if (kCheckRegs && x10691 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10692 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x10692 != Fp::invalid());
+      if (kCheckRegs && x10692 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10693 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x10693 != Fp::invalid());
+      if (kCheckRegs && x10693 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10694 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x10694 != Fp::invalid());
+      if (kCheckRegs && x10694 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10695 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x10695 != Fp::invalid());
+      if (kCheckRegs && x10695 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10696 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x10696 != Fp::invalid());
+      if (kCheckRegs && x10696 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10697 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x10697 != Fp::invalid());
+      if (kCheckRegs && x10697 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10698 = x10663 * x10691;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -23147,25 +23145,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10750 = x10742 + x10746;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10751 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x10751 != Fp::invalid());
+      if (kCheckRegs && x10751 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10752 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x10752 != Fp::invalid());
+      if (kCheckRegs && x10752 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10753 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x10753 != Fp::invalid());
+      if (kCheckRegs && x10753 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10754 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x10754 != Fp::invalid());
+      if (kCheckRegs && x10754 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10755 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x10755 != Fp::invalid());
+      if (kCheckRegs && x10755 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10756 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x10756 != Fp::invalid());
+      if (kCheckRegs && x10756 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10757 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x10757 != Fp::invalid());
+      if (kCheckRegs && x10757 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10758 = x10663 * x10751;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -23336,25 +23334,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10841 = x10840 + x10835;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10842 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x10842 != Fp::invalid());
+      if (kCheckRegs && x10842 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10843 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x10843 != Fp::invalid());
+      if (kCheckRegs && x10843 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10844 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x10844 != Fp::invalid());
+      if (kCheckRegs && x10844 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10845 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x10845 != Fp::invalid());
+      if (kCheckRegs && x10845 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10846 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x10846 != Fp::invalid());
+      if (kCheckRegs && x10846 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10847 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x10847 != Fp::invalid());
+      if (kCheckRegs && x10847 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10848 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x10848 != Fp::invalid());
+      if (kCheckRegs && x10848 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/4(MultiplyCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10849 = x10663 * x10842;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -23463,25 +23461,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x10901 = x10893 + x10897;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10902 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x10902 != Fp::invalid());
+      if (kCheckRegs && x10902 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10903 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x10903 != Fp::invalid());
+      if (kCheckRegs && x10903 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10904 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x10904 != Fp::invalid());
+      if (kCheckRegs && x10904 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10905 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x10905 != Fp::invalid());
+      if (kCheckRegs && x10905 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10906 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x10906 != Fp::invalid());
+      if (kCheckRegs && x10906 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10907 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x10907 != Fp::invalid());
+      if (kCheckRegs && x10907 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x10908 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x10908 != Fp::invalid());
+      if (kCheckRegs && x10908 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x10909 = x10663 * x10902;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -23651,33 +23649,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x10992 = x10991 + x10986;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x10993 = host_outs.at(0);
-        auto x10994 = host_outs.at(1);
-        auto x10995 = host_outs.at(2);
-        auto x10996 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x10993 = host_outs[0];
+        auto x10994 = host_outs[1];
+        auto x10995 = host_outs[2];
+        auto x10996 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10993);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10993) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x10993;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10994);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10994) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x10994;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10995);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10995) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x10995;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x10996);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x10996) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x10996;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -23881,32 +23879,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11072);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11072) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x11072;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11080);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11080) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x11080;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11088);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11088) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x11088;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11095);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11095) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x11095;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x11096 = args[2][105 * steps + ((cycle - 0) & mask)];
-    assert(x11096 != Fp::invalid());
+    if (kCheckRegs && x11096 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][105], back 0)");
     if (x11096 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x11097 = args[3][8];
@@ -23966,25 +23964,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11124 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11125 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x11125 != Fp::invalid());
+      if (kCheckRegs && x11125 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11126 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x11126 != Fp::invalid());
+      if (kCheckRegs && x11126 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11127 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x11127 != Fp::invalid());
+      if (kCheckRegs && x11127 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11128 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x11128 != Fp::invalid());
+      if (kCheckRegs && x11128 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11129 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x11129 != Fp::invalid());
+      if (kCheckRegs && x11129 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11130 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x11130 != Fp::invalid());
+      if (kCheckRegs && x11130 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11131 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x11131 != Fp::invalid());
+      if (kCheckRegs && x11131 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11132 = x11097 * x11125;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -24093,25 +24091,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11184 = x11176 + x11180;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11185 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x11185 != Fp::invalid());
+      if (kCheckRegs && x11185 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11186 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x11186 != Fp::invalid());
+      if (kCheckRegs && x11186 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11187 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x11187 != Fp::invalid());
+      if (kCheckRegs && x11187 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11188 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x11188 != Fp::invalid());
+      if (kCheckRegs && x11188 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11189 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x11189 != Fp::invalid());
+      if (kCheckRegs && x11189 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11190 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x11190 != Fp::invalid());
+      if (kCheckRegs && x11190 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11191 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x11191 != Fp::invalid());
+      if (kCheckRegs && x11191 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11192 = x11097 * x11185;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -24282,25 +24280,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11275 = x11274 + x11269;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11276 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x11276 != Fp::invalid());
+      if (kCheckRegs && x11276 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11277 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x11277 != Fp::invalid());
+      if (kCheckRegs && x11277 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11278 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x11278 != Fp::invalid());
+      if (kCheckRegs && x11278 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11279 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x11279 != Fp::invalid());
+      if (kCheckRegs && x11279 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11280 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x11280 != Fp::invalid());
+      if (kCheckRegs && x11280 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11281 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x11281 != Fp::invalid());
+      if (kCheckRegs && x11281 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11282 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x11282 != Fp::invalid());
+      if (kCheckRegs && x11282 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/5(DivideCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11283 = x11097 * x11276;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -24409,25 +24407,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11335 = x11327 + x11331;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11336 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x11336 != Fp::invalid());
+      if (kCheckRegs && x11336 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11337 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x11337 != Fp::invalid());
+      if (kCheckRegs && x11337 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11338 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x11338 != Fp::invalid());
+      if (kCheckRegs && x11338 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11339 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x11339 != Fp::invalid());
+      if (kCheckRegs && x11339 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11340 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x11340 != Fp::invalid());
+      if (kCheckRegs && x11340 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11341 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x11341 != Fp::invalid());
+      if (kCheckRegs && x11341 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11342 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x11342 != Fp::invalid());
+      if (kCheckRegs && x11342 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11343 = x11097 * x11336;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -24597,33 +24595,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x11426 = x11425 + x11420;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x11427 = host_outs.at(0);
-        auto x11428 = host_outs.at(1);
-        auto x11429 = host_outs.at(2);
-        auto x11430 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x11427 = host_outs[0];
+        auto x11428 = host_outs[1];
+        auto x11429 = host_outs[2];
+        auto x11430 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11427);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11427) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x11427;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11428);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11428) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x11428;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11429);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11429) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x11429;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11430);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11430) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x11430;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -24827,104 +24825,104 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11506);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11506) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x11506;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11514);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11514) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x11514;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11522);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11522) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x11522;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11529);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11529) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x11529;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x11530 = args[2][106 * steps + ((cycle - 0) & mask)];
-    assert(x11530 != Fp::invalid());
+    if (kCheckRegs && x11530 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][106], back 0)");
     if (x11530 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x11531 = host_outs.at(0);
-        auto x11532 = host_outs.at(1);
-        auto x11533 = host_outs.at(2);
-        auto x11534 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x11531 = host_outs[0];
+        auto x11532 = host_outs[1];
+        auto x11533 = host_outs[2];
+        auto x11534 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11531);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11531) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x11531;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11532);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11532) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x11532;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11533);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11533) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x11533;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11534);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11534) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x11534;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x11535 = args[2][107 * steps + ((cycle - 0) & mask)];
-    assert(x11535 != Fp::invalid());
+    if (kCheckRegs && x11535 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][107], back 0)");
     if (x11535 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x11536 = host_outs.at(0);
-        auto x11537 = host_outs.at(1);
-        auto x11538 = host_outs.at(2);
-        auto x11539 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x11536 = host_outs[0];
+        auto x11537 = host_outs[1];
+        auto x11538 = host_outs[2];
+        auto x11539 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11536);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11536) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x11536;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11537);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11537) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x11537;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11538);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11538) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x11538;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11539);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11539) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x11539;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x11540 = args[2][108 * steps + ((cycle - 0) & mask)];
-    assert(x11540 != Fp::invalid());
+    if (kCheckRegs && x11540 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][108], back 0)");
     if (x11540 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x11541 = args[3][8];
@@ -24984,25 +24982,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11568 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11569 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x11569 != Fp::invalid());
+      if (kCheckRegs && x11569 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11570 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x11570 != Fp::invalid());
+      if (kCheckRegs && x11570 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11571 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x11571 != Fp::invalid());
+      if (kCheckRegs && x11571 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11572 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x11572 != Fp::invalid());
+      if (kCheckRegs && x11572 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11573 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x11573 != Fp::invalid());
+      if (kCheckRegs && x11573 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11574 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x11574 != Fp::invalid());
+      if (kCheckRegs && x11574 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11575 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x11575 != Fp::invalid());
+      if (kCheckRegs && x11575 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11576 = x11541 * x11569;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -25111,25 +25109,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11628 = x11620 + x11624;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11629 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x11629 != Fp::invalid());
+      if (kCheckRegs && x11629 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11630 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x11630 != Fp::invalid());
+      if (kCheckRegs && x11630 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11631 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x11631 != Fp::invalid());
+      if (kCheckRegs && x11631 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11632 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x11632 != Fp::invalid());
+      if (kCheckRegs && x11632 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11633 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x11633 != Fp::invalid());
+      if (kCheckRegs && x11633 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11634 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x11634 != Fp::invalid());
+      if (kCheckRegs && x11634 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11635 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x11635 != Fp::invalid());
+      if (kCheckRegs && x11635 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11636 = x11541 * x11629;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -25300,25 +25298,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11719 = x11718 + x11713;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11720 = args[2][144 * steps + ((cycle - 0) & mask)];
-      assert(x11720 != Fp::invalid());
+      if (kCheckRegs && x11720 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][144], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11721 = args[2][145 * steps + ((cycle - 0) & mask)];
-      assert(x11721 != Fp::invalid());
+      if (kCheckRegs && x11721 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][145], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11722 = args[2][146 * steps + ((cycle - 0) & mask)];
-      assert(x11722 != Fp::invalid());
+      if (kCheckRegs && x11722 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][146], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11723 = args[2][147 * steps + ((cycle - 0) & mask)];
-      assert(x11723 != Fp::invalid());
+      if (kCheckRegs && x11723 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][147], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11724 = args[2][148 * steps + ((cycle - 0) & mask)];
-      assert(x11724 != Fp::invalid());
+      if (kCheckRegs && x11724 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][148], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11725 = args[2][149 * steps + ((cycle - 0) & mask)];
-      assert(x11725 != Fp::invalid());
+      if (kCheckRegs && x11725 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][149], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11726 = args[2][150 * steps + ((cycle - 0) & mask)];
-      assert(x11726 != Fp::invalid());
+      if (kCheckRegs && x11726 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][150], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11727 = x11541 * x11720;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -25427,25 +25425,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11779 = x11771 + x11775;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11780 = args[2][165 * steps + ((cycle - 0) & mask)];
-      assert(x11780 != Fp::invalid());
+      if (kCheckRegs && x11780 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][165], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11781 = args[2][166 * steps + ((cycle - 0) & mask)];
-      assert(x11781 != Fp::invalid());
+      if (kCheckRegs && x11781 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][166], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11782 = args[2][167 * steps + ((cycle - 0) & mask)];
-      assert(x11782 != Fp::invalid());
+      if (kCheckRegs && x11782 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][167], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11783 = args[2][168 * steps + ((cycle - 0) & mask)];
-      assert(x11783 != Fp::invalid());
+      if (kCheckRegs && x11783 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][168], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11784 = args[2][169 * steps + ((cycle - 0) & mask)];
-      assert(x11784 != Fp::invalid());
+      if (kCheckRegs && x11784 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][169], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11785 = args[2][170 * steps + ((cycle - 0) & mask)];
-      assert(x11785 != Fp::invalid());
+      if (kCheckRegs && x11785 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][170], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11786 = args[2][171 * steps + ((cycle - 0) & mask)];
-      assert(x11786 != Fp::invalid());
+      if (kCheckRegs && x11786 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][171], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11787 = x11541 * x11780;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -25554,25 +25552,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11839 = x11831 + x11835;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11840 = args[2][172 * steps + ((cycle - 0) & mask)];
-      assert(x11840 != Fp::invalid());
+      if (kCheckRegs && x11840 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][172], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11841 = args[2][173 * steps + ((cycle - 0) & mask)];
-      assert(x11841 != Fp::invalid());
+      if (kCheckRegs && x11841 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][173], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11842 = args[2][174 * steps + ((cycle - 0) & mask)];
-      assert(x11842 != Fp::invalid());
+      if (kCheckRegs && x11842 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][174], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11843 = args[2][175 * steps + ((cycle - 0) & mask)];
-      assert(x11843 != Fp::invalid());
+      if (kCheckRegs && x11843 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][175], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11844 = args[2][176 * steps + ((cycle - 0) & mask)];
-      assert(x11844 != Fp::invalid());
+      if (kCheckRegs && x11844 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][176], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11845 = args[2][177 * steps + ((cycle - 0) & mask)];
-      assert(x11845 != Fp::invalid());
+      if (kCheckRegs && x11845 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][177], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11846 = args[2][178 * steps + ((cycle - 0) & mask)];
-      assert(x11846 != Fp::invalid());
+      if (kCheckRegs && x11846 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/8(ECallCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][178], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11847 = x11541 * x11840;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -25743,25 +25741,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x11930 = x11929 + x11924;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11931 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x11931 != Fp::invalid());
+      if (kCheckRegs && x11931 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11932 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x11932 != Fp::invalid());
+      if (kCheckRegs && x11932 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11933 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x11933 != Fp::invalid());
+      if (kCheckRegs && x11933 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11934 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x11934 != Fp::invalid());
+      if (kCheckRegs && x11934 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11935 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x11935 != Fp::invalid());
+      if (kCheckRegs && x11935 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11936 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x11936 != Fp::invalid());
+      if (kCheckRegs && x11936 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x11937 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x11937 != Fp::invalid());
+      if (kCheckRegs && x11937 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11938 = x11541 * x11931;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -25869,33 +25867,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":218:0)
       auto x11990 = x11982 + x11986;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x11991 = host_outs.at(0);
-        auto x11992 = host_outs.at(1);
-        auto x11993 = host_outs.at(2);
-        auto x11994 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x11991 = host_outs[0];
+        auto x11992 = host_outs[1];
+        auto x11993 = host_outs[2];
+        auto x11994 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11991);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11991) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x11991;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11992);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11992) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x11992;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11993);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11993) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x11993;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x11994);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x11994) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x11994;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -26099,25 +26097,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][32 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12070);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12070) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][32])");
           reg = x12070;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][33 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12078);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12078) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][33])");
           reg = x12078;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][34 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12086);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12086) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][34])");
           reg = x12086;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][35 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12093);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12093) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][35])");
           reg = x12093;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -26321,176 +26319,176 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12169);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12169) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x12169;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12177);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12177) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x12177;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12185);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12185) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x12185;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12192);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12192) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x12192;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12193 = args[2][109 * steps + ((cycle - 0) & mask)];
-    assert(x12193 != Fp::invalid());
+    if (kCheckRegs && x12193 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][109], back 0)");
     if (x12193 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x12194 = host_outs.at(0);
-        auto x12195 = host_outs.at(1);
-        auto x12196 = host_outs.at(2);
-        auto x12197 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x12194 = host_outs[0];
+        auto x12195 = host_outs[1];
+        auto x12196 = host_outs[2];
+        auto x12197 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12194);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12194) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x12194;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12195);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12195) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x12195;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12196);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12196) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x12196;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12197);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12197) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x12197;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12198 = args[2][110 * steps + ((cycle - 0) & mask)];
-    assert(x12198 != Fp::invalid());
+    if (kCheckRegs && x12198 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][110], back 0)");
     if (x12198 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x12199 = host_outs.at(0);
-        auto x12200 = host_outs.at(1);
-        auto x12201 = host_outs.at(2);
-        auto x12202 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x12199 = host_outs[0];
+        auto x12200 = host_outs[1];
+        auto x12201 = host_outs[2];
+        auto x12202 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12199);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12199) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x12199;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12200);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12200) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x12200;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12201);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12201) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x12201;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12202);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12202) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x12202;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12203 = args[2][111 * steps + ((cycle - 0) & mask)];
-    assert(x12203 != Fp::invalid());
+    if (kCheckRegs && x12203 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][111], back 0)");
     if (x12203 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x12204 = host_outs.at(0);
-        auto x12205 = host_outs.at(1);
-        auto x12206 = host_outs.at(2);
-        auto x12207 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x12204 = host_outs[0];
+        auto x12205 = host_outs[1];
+        auto x12206 = host_outs[2];
+        auto x12207 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12204);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12204) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x12204;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12205);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12205) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x12205;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12206);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12206) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x12206;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12207);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12207) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x12207;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12208 = args[2][112 * steps + ((cycle - 0) & mask)];
-    assert(x12208 != Fp::invalid());
+    if (kCheckRegs && x12208 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][112], back 0)");
     if (x12208 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x12209 = host_outs.at(0);
-        auto x12210 = host_outs.at(1);
-        auto x12211 = host_outs.at(2);
-        auto x12212 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x12209 = host_outs[0];
+        auto x12210 = host_outs[1];
+        auto x12211 = host_outs[2];
+        auto x12212 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12209);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12209) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x12209;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12210);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12210) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x12210;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12211);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12211) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x12211;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12212);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12212) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x12212;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12213 = args[2][113 * steps + ((cycle - 0) & mask)];
-    assert(x12213 != Fp::invalid());
+    if (kCheckRegs && x12213 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][113], back 0)");
     if (x12213 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x12214 = args[3][8];
@@ -26550,25 +26548,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12241 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12242 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x12242 != Fp::invalid());
+      if (kCheckRegs && x12242 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12243 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x12243 != Fp::invalid());
+      if (kCheckRegs && x12243 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12244 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x12244 != Fp::invalid());
+      if (kCheckRegs && x12244 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12245 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x12245 != Fp::invalid());
+      if (kCheckRegs && x12245 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12246 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x12246 != Fp::invalid());
+      if (kCheckRegs && x12246 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12247 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x12247 != Fp::invalid());
+      if (kCheckRegs && x12247 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12248 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x12248 != Fp::invalid());
+      if (kCheckRegs && x12248 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12249 = x12214 * x12242;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -26677,25 +26675,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12301 = x12293 + x12297;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12302 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x12302 != Fp::invalid());
+      if (kCheckRegs && x12302 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12303 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x12303 != Fp::invalid());
+      if (kCheckRegs && x12303 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12304 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x12304 != Fp::invalid());
+      if (kCheckRegs && x12304 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12305 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x12305 != Fp::invalid());
+      if (kCheckRegs && x12305 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12306 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x12306 != Fp::invalid());
+      if (kCheckRegs && x12306 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12307 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x12307 != Fp::invalid());
+      if (kCheckRegs && x12307 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12308 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x12308 != Fp::invalid());
+      if (kCheckRegs && x12308 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12309 = x12214 * x12302;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -26866,25 +26864,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12392 = x12391 + x12386;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12393 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x12393 != Fp::invalid());
+      if (kCheckRegs && x12393 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12394 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x12394 != Fp::invalid());
+      if (kCheckRegs && x12394 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12395 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x12395 != Fp::invalid());
+      if (kCheckRegs && x12395 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12396 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x12396 != Fp::invalid());
+      if (kCheckRegs && x12396 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12397 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x12397 != Fp::invalid());
+      if (kCheckRegs && x12397 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12398 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x12398 != Fp::invalid());
+      if (kCheckRegs && x12398 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12399 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x12399 != Fp::invalid());
+      if (kCheckRegs && x12399 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/13(ECallCopyInCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12400 = x12214 * x12393;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -26993,25 +26991,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12452 = x12444 + x12448;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12453 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x12453 != Fp::invalid());
+      if (kCheckRegs && x12453 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12454 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x12454 != Fp::invalid());
+      if (kCheckRegs && x12454 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12455 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x12455 != Fp::invalid());
+      if (kCheckRegs && x12455 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12456 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x12456 != Fp::invalid());
+      if (kCheckRegs && x12456 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12457 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x12457 != Fp::invalid());
+      if (kCheckRegs && x12457 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12458 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x12458 != Fp::invalid());
+      if (kCheckRegs && x12458 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12459 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x12459 != Fp::invalid());
+      if (kCheckRegs && x12459 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12460 = x12214 * x12453;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -27181,33 +27179,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x12543 = x12542 + x12537;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x12544 = host_outs.at(0);
-        auto x12545 = host_outs.at(1);
-        auto x12546 = host_outs.at(2);
-        auto x12547 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x12544 = host_outs[0];
+        auto x12545 = host_outs[1];
+        auto x12546 = host_outs[2];
+        auto x12547 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12544);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12544) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x12544;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12545);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12545) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x12545;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12546);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12546) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x12546;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12547);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12547) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x12547;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -27411,32 +27409,32 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12623);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12623) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x12623;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12631);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12631) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x12631;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12639);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12639) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x12639;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12646);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12646) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x12646;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x12647 = args[2][114 * steps + ((cycle - 0) & mask)];
-    assert(x12647 != Fp::invalid());
+    if (kCheckRegs && x12647 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][114], back 0)");
     if (x12647 != 0) {
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/FpExtReg/elem[0](Reg)"("./zirgen/components/plonk.h":218:0))
       auto x12648 = args[3][8];
@@ -27496,25 +27494,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12675 = args[3][35];
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12676 = args[2][130 * steps + ((cycle - 0) & mask)];
-      assert(x12676 != Fp::invalid());
+      if (kCheckRegs && x12676 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][130], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12677 = args[2][131 * steps + ((cycle - 0) & mask)];
-      assert(x12677 != Fp::invalid());
+      if (kCheckRegs && x12677 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][131], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12678 = args[2][132 * steps + ((cycle - 0) & mask)];
-      assert(x12678 != Fp::invalid());
+      if (kCheckRegs && x12678 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][132], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12679 = args[2][133 * steps + ((cycle - 0) & mask)];
-      assert(x12679 != Fp::invalid());
+      if (kCheckRegs && x12679 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][133], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12680 = args[2][134 * steps + ((cycle - 0) & mask)];
-      assert(x12680 != Fp::invalid());
+      if (kCheckRegs && x12680 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][134], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12681 = args[2][135 * steps + ((cycle - 0) & mask)];
-      assert(x12681 != Fp::invalid());
+      if (kCheckRegs && x12681 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][135], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12682 = args[2][136 * steps + ((cycle - 0) & mask)];
-      assert(x12682 != Fp::invalid());
+      if (kCheckRegs && x12682 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][136], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12683 = x12648 * x12676;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -27623,25 +27621,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12735 = x12727 + x12731;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12736 = args[2][137 * steps + ((cycle - 0) & mask)];
-      assert(x12736 != Fp::invalid());
+      if (kCheckRegs && x12736 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][137], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12737 = args[2][138 * steps + ((cycle - 0) & mask)];
-      assert(x12737 != Fp::invalid());
+      if (kCheckRegs && x12737 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][138], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12738 = args[2][139 * steps + ((cycle - 0) & mask)];
-      assert(x12738 != Fp::invalid());
+      if (kCheckRegs && x12738 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][139], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12739 = args[2][140 * steps + ((cycle - 0) & mask)];
-      assert(x12739 != Fp::invalid());
+      if (kCheckRegs && x12739 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][140], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12740 = args[2][141 * steps + ((cycle - 0) & mask)];
-      assert(x12740 != Fp::invalid());
+      if (kCheckRegs && x12740 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][141], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12741 = args[2][142 * steps + ((cycle - 0) & mask)];
-      assert(x12741 != Fp::invalid());
+      if (kCheckRegs && x12741 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][142], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12742 = args[2][143 * steps + ((cycle - 0) & mask)];
-      assert(x12742 != Fp::invalid());
+      if (kCheckRegs && x12742 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][143], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12743 = x12648 * x12736;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -27812,25 +27810,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12826 = x12825 + x12820;
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12827 = args[2][158 * steps + ((cycle - 0) & mask)];
-      assert(x12827 != Fp::invalid());
+      if (kCheckRegs && x12827 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][158], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12828 = args[2][159 * steps + ((cycle - 0) & mask)];
-      assert(x12828 != Fp::invalid());
+      if (kCheckRegs && x12828 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][159], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12829 = args[2][160 * steps + ((cycle - 0) & mask)];
-      assert(x12829 != Fp::invalid());
+      if (kCheckRegs && x12829 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/Reg (args[2][160], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12830 = args[2][161 * steps + ((cycle - 0) & mask)];
-      assert(x12830 != Fp::invalid());
+      if (kCheckRegs && x12830 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][161], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12831 = args[2][162 * steps + ((cycle - 0) & mask)];
-      assert(x12831 != Fp::invalid());
+      if (kCheckRegs && x12831 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][162], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12832 = args[2][163 * steps + ((cycle - 0) & mask)];
-      assert(x12832 != Fp::invalid());
+      if (kCheckRegs && x12832 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][163], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12833 = args[2][164 * steps + ((cycle - 0) & mask)];
-      assert(x12833 != Fp::invalid());
+      if (kCheckRegs && x12833 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/Mux/14(BigIntCycle)/RamBody/PlonkBody/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][164], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12834 = x12648 * x12827;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -27939,25 +27937,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       auto x12886 = x12878 + x12882;
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12887 = args[2][89 * steps + ((cycle - 0) & mask)];
-      assert(x12887 != Fp::invalid());
+      if (kCheckRegs && x12887 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][89], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12888 = args[2][90 * steps + ((cycle - 0) & mask)];
-      assert(x12888 != Fp::invalid());
+      if (kCheckRegs && x12888 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][90], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12889 = args[2][91 * steps + ((cycle - 0) & mask)];
-      assert(x12889 != Fp::invalid());
+      if (kCheckRegs && x12889 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/Reg (args[2][91], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12890 = args[2][92 * steps + ((cycle - 0) & mask)];
-      assert(x12890 != Fp::invalid());
+      if (kCheckRegs && x12890 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[0](Reg) (args[2][92], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12891 = args[2][93 * steps + ((cycle - 0) & mask)];
-      assert(x12891 != Fp::invalid());
+      if (kCheckRegs && x12891 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[1](Reg) (args[2][93], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12892 = args[2][94 * steps + ((cycle - 0) & mask)];
-      assert(x12892 != Fp::invalid());
+      if (kCheckRegs && x12892 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[2](Reg) (args[2][94], back 0)");
       // loc("Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg)"("./zirgen/compiler/edsl/component.h":154:0))
       auto x12893 = args[2][95 * steps + ((cycle - 0) & mask)];
-      assert(x12893 != Fp::invalid());
+      if (kCheckRegs && x12893 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/RamHeader/RamPlonkElement/U32Reg/byte[3](Reg) (args[2][95], back 0)");
       // loc("./zirgen/components/plonk.h":218:0)
       auto x12894 = x12648 * x12887;
       // loc("./zirgen/components/plonk.h":218:0)
@@ -28127,33 +28125,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("./zirgen/components/plonk.h":220:0)
       auto x12977 = x12976 + x12971;
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x12978 = host_outs.at(0);
-        auto x12979 = host_outs.at(1);
-        auto x12980 = host_outs.at(2);
-        auto x12981 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x12978 = host_outs[0];
+        auto x12979 = host_outs[1];
+        auto x12980 = host_outs[2];
+        auto x12981 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12978);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12978) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x12978;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12979);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12979) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x12979;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12980);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12980) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x12980;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x12981);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x12981) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x12981;
         }
         // loc("./zirgen/components/plonk.h":279:0)
@@ -28357,61 +28355,61 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][28 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13057);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13057) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][28])");
           reg = x13057;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][29 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13065);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13065) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][29])");
           reg = x13065;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][30 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13073);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13073) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][30])");
           reg = x13073;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][31 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13080);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13080) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][31])");
           reg = x13080;
         }
       }
     }
     // loc("zirgen/compiler/edsl/component.cpp":39:0)
     auto x13081 = args[2][115 * steps + ((cycle - 0) & mask)];
-    assert(x13081 != Fp::invalid());
+    if (kCheckRegs && x13081 == Fp::invalid()) return stepFailed(err, "read of unset register zirgen/compiler/edsl/component.cpp:39 (args[2][115], back 0)");
     if (x13081 != 0) {
       {
-        host(ctx, "plonkReadAccum", "ram", host_args.data(), 0, host_outs.data(), 4);
-        auto x13082 = host_outs.at(0);
-        auto x13083 = host_outs.at(1);
-        auto x13084 = host_outs.at(2);
-        auto x13085 = host_outs.at(3);
+        if (!host(ctx, ExternId::PlonkReadAccum, kExtraRam, "ram", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+        auto x13082 = host_outs[0];
+        auto x13083 = host_outs[1];
+        auto x13084 = host_outs[2];
+        auto x13085 = host_outs[3];
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][24 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13082);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13082) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][24])");
           reg = x13082;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][25 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13083);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13083) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][25])");
           reg = x13083;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][26 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13084);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13084) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][26])");
           reg = x13084;
         }
         // loc("zirgen/components/fpext.cpp":28:0)
         {
           auto& reg = args[4][27 * steps + cycle];
-          assert(reg == Fp::invalid() || reg == x13085);
+          if (kCheckRegs && reg != Fp::invalid() && reg != x13085) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][27])");
           reg = x13085;
         }
       }
@@ -28436,10 +28434,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13093 = args[3][7];
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13094 = args[2][9 * steps + ((cycle - 0) & mask)];
-    assert(x13094 != Fp::invalid());
+    if (kCheckRegs && x13094 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][9], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13095 = args[2][10 * steps + ((cycle - 0) & mask)];
-    assert(x13095 != Fp::invalid());
+    if (kCheckRegs && x13095 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][10], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13096 = x13086 * x13094;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28468,10 +28466,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13108 = x13099 + x13104;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13109 = args[2][11 * steps + ((cycle - 0) & mask)];
-    assert(x13109 != Fp::invalid());
+    if (kCheckRegs && x13109 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][11], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13110 = args[2][12 * steps + ((cycle - 0) & mask)];
-    assert(x13110 != Fp::invalid());
+    if (kCheckRegs && x13110 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][12], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13111 = x13086 * x13109;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28562,10 +28560,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13154 = x13153 + x13148;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13155 = args[2][13 * steps + ((cycle - 0) & mask)];
-    assert(x13155 != Fp::invalid());
+    if (kCheckRegs && x13155 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][13], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13156 = args[2][14 * steps + ((cycle - 0) & mask)];
-    assert(x13156 != Fp::invalid());
+    if (kCheckRegs && x13156 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][14], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13157 = x13086 * x13155;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28656,10 +28654,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13200 = x13199 + x13194;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13201 = args[2][15 * steps + ((cycle - 0) & mask)];
-    assert(x13201 != Fp::invalid());
+    if (kCheckRegs && x13201 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][15], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13202 = args[2][16 * steps + ((cycle - 0) & mask)];
-    assert(x13202 != Fp::invalid());
+    if (kCheckRegs && x13202 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][16], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13203 = x13086 * x13201;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28688,10 +28686,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13215 = x13206 + x13211;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13216 = args[2][17 * steps + ((cycle - 0) & mask)];
-    assert(x13216 != Fp::invalid());
+    if (kCheckRegs && x13216 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][17], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13217 = args[2][18 * steps + ((cycle - 0) & mask)];
-    assert(x13217 != Fp::invalid());
+    if (kCheckRegs && x13217 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][18], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13218 = x13086 * x13216;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28782,10 +28780,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13261 = x13260 + x13255;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13262 = args[2][19 * steps + ((cycle - 0) & mask)];
-    assert(x13262 != Fp::invalid());
+    if (kCheckRegs && x13262 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][19], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13263 = args[2][20 * steps + ((cycle - 0) & mask)];
-    assert(x13263 != Fp::invalid());
+    if (kCheckRegs && x13263 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][20], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13264 = x13086 * x13262;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28876,10 +28874,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13307 = x13306 + x13301;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13308 = args[2][21 * steps + ((cycle - 0) & mask)];
-    assert(x13308 != Fp::invalid());
+    if (kCheckRegs && x13308 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][21], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13309 = args[2][22 * steps + ((cycle - 0) & mask)];
-    assert(x13309 != Fp::invalid());
+    if (kCheckRegs && x13309 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][22], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13310 = x13086 * x13308;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -28908,10 +28906,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13322 = x13313 + x13318;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13323 = args[2][23 * steps + ((cycle - 0) & mask)];
-    assert(x13323 != Fp::invalid());
+    if (kCheckRegs && x13323 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][23], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13324 = args[2][24 * steps + ((cycle - 0) & mask)];
-    assert(x13324 != Fp::invalid());
+    if (kCheckRegs && x13324 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][24], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13325 = x13086 * x13323;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29002,10 +29000,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13368 = x13367 + x13362;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13369 = args[2][25 * steps + ((cycle - 0) & mask)];
-    assert(x13369 != Fp::invalid());
+    if (kCheckRegs && x13369 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][25], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13370 = args[2][26 * steps + ((cycle - 0) & mask)];
-    assert(x13370 != Fp::invalid());
+    if (kCheckRegs && x13370 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][26], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13371 = x13086 * x13369;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29096,10 +29094,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13414 = x13413 + x13408;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13415 = args[2][27 * steps + ((cycle - 0) & mask)];
-    assert(x13415 != Fp::invalid());
+    if (kCheckRegs && x13415 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][27], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13416 = args[2][28 * steps + ((cycle - 0) & mask)];
-    assert(x13416 != Fp::invalid());
+    if (kCheckRegs && x13416 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][28], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13417 = x13086 * x13415;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29128,10 +29126,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13429 = x13420 + x13425;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13430 = args[2][29 * steps + ((cycle - 0) & mask)];
-    assert(x13430 != Fp::invalid());
+    if (kCheckRegs && x13430 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][29], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13431 = args[2][30 * steps + ((cycle - 0) & mask)];
-    assert(x13431 != Fp::invalid());
+    if (kCheckRegs && x13431 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][30], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13432 = x13086 * x13430;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29222,10 +29220,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13475 = x13474 + x13469;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13476 = args[2][31 * steps + ((cycle - 0) & mask)];
-    assert(x13476 != Fp::invalid());
+    if (kCheckRegs && x13476 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][31], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13477 = args[2][32 * steps + ((cycle - 0) & mask)];
-    assert(x13477 != Fp::invalid());
+    if (kCheckRegs && x13477 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][32], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13478 = x13086 * x13476;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29316,10 +29314,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13521 = x13520 + x13515;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13522 = args[2][33 * steps + ((cycle - 0) & mask)];
-    assert(x13522 != Fp::invalid());
+    if (kCheckRegs && x13522 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][33], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13523 = args[2][34 * steps + ((cycle - 0) & mask)];
-    assert(x13523 != Fp::invalid());
+    if (kCheckRegs && x13523 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][34], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13524 = x13086 * x13522;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29348,10 +29346,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13536 = x13527 + x13532;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13537 = args[2][35 * steps + ((cycle - 0) & mask)];
-    assert(x13537 != Fp::invalid());
+    if (kCheckRegs && x13537 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][35], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13538 = args[2][36 * steps + ((cycle - 0) & mask)];
-    assert(x13538 != Fp::invalid());
+    if (kCheckRegs && x13538 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][36], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13539 = x13086 * x13537;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29442,10 +29440,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13582 = x13581 + x13576;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13583 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x13583 != Fp::invalid());
+    if (kCheckRegs && x13583 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13584 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x13584 != Fp::invalid());
+    if (kCheckRegs && x13584 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13585 = x13086 * x13583;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29474,10 +29472,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13597 = x13588 + x13593;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13598 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x13598 != Fp::invalid());
+    if (kCheckRegs && x13598 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13599 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x13599 != Fp::invalid());
+    if (kCheckRegs && x13599 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13600 = x13086 * x13598;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29568,10 +29566,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13643 = x13642 + x13637;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13644 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x13644 != Fp::invalid());
+    if (kCheckRegs && x13644 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13645 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x13645 != Fp::invalid());
+    if (kCheckRegs && x13645 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13646 = x13086 * x13644;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29662,10 +29660,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13689 = x13688 + x13683;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13690 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x13690 != Fp::invalid());
+    if (kCheckRegs && x13690 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13691 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x13691 != Fp::invalid());
+    if (kCheckRegs && x13691 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13692 = x13086 * x13690;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29694,10 +29692,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13704 = x13695 + x13700;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13705 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x13705 != Fp::invalid());
+    if (kCheckRegs && x13705 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13706 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x13706 != Fp::invalid());
+    if (kCheckRegs && x13706 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13707 = x13086 * x13705;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29788,10 +29786,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13750 = x13749 + x13744;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13751 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x13751 != Fp::invalid());
+    if (kCheckRegs && x13751 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13752 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x13752 != Fp::invalid());
+    if (kCheckRegs && x13752 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13753 = x13086 * x13751;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29882,10 +29880,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13796 = x13795 + x13790;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13797 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x13797 != Fp::invalid());
+    if (kCheckRegs && x13797 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13798 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x13798 != Fp::invalid());
+    if (kCheckRegs && x13798 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13799 = x13086 * x13797;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -29914,10 +29912,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13811 = x13802 + x13807;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13812 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x13812 != Fp::invalid());
+    if (kCheckRegs && x13812 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13813 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x13813 != Fp::invalid());
+    if (kCheckRegs && x13813 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13814 = x13086 * x13812;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30008,10 +30006,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13857 = x13856 + x13851;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13858 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x13858 != Fp::invalid());
+    if (kCheckRegs && x13858 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13859 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x13859 != Fp::invalid());
+    if (kCheckRegs && x13859 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13860 = x13086 * x13858;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30102,10 +30100,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13903 = x13902 + x13897;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13904 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x13904 != Fp::invalid());
+    if (kCheckRegs && x13904 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13905 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x13905 != Fp::invalid());
+    if (kCheckRegs && x13905 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13906 = x13086 * x13904;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30134,10 +30132,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13918 = x13909 + x13914;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13919 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x13919 != Fp::invalid());
+    if (kCheckRegs && x13919 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13920 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x13920 != Fp::invalid());
+    if (kCheckRegs && x13920 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13921 = x13086 * x13919;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30228,10 +30226,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x13964 = x13963 + x13958;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13965 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x13965 != Fp::invalid());
+    if (kCheckRegs && x13965 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x13966 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x13966 != Fp::invalid());
+    if (kCheckRegs && x13966 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x13967 = x13086 * x13965;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30322,10 +30320,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x14010 = x14009 + x14004;
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x14011 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x14011 != Fp::invalid());
+    if (kCheckRegs && x14011 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x14012 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x14012 != Fp::invalid());
+    if (kCheckRegs && x14012 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x14013 = x13086 * x14011;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30354,10 +30352,10 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     auto x14025 = x14016 + x14021;
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x14026 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x14026 != Fp::invalid());
+    if (kCheckRegs && x14026 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x14027 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x14027 != Fp::invalid());
+    if (kCheckRegs && x14027 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("./zirgen/components/plonk.h":218:0)
     auto x14028 = x13086 * x14026;
     // loc("./zirgen/components/plonk.h":218:0)
@@ -30447,33 +30445,33 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("./zirgen/components/plonk.h":220:0)
     auto x14071 = x14070 + x14065;
     {
-      host(ctx, "plonkReadAccum", "bytes", host_args.data(), 0, host_outs.data(), 4);
-      auto x14072 = host_outs.at(0);
-      auto x14073 = host_outs.at(1);
-      auto x14074 = host_outs.at(2);
-      auto x14075 = host_outs.at(3);
+      if (!host(ctx, ExternId::PlonkReadAccum, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 4)) return hostFailed(err);
+      auto x14072 = host_outs[0];
+      auto x14073 = host_outs[1];
+      auto x14074 = host_outs[2];
+      auto x14075 = host_outs[3];
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14072);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14072) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][0])");
         reg = x14072;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14073);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14073) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][1])");
         reg = x14073;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][2 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14074);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14074) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][2])");
         reg = x14074;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][3 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14075);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14075) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][3])");
         reg = x14075;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -30677,25 +30675,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][20 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14151);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14151) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][20])");
         reg = x14151;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][21 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14159);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14159) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][21])");
         reg = x14159;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][22 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14167);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14167) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][22])");
         reg = x14167;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][23 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14174);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14174) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][23])");
         reg = x14174;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -30899,25 +30897,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][16 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14250);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14250) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][16])");
         reg = x14250;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][17 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14258);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14258) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][17])");
         reg = x14258;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][18 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14266);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14266) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][18])");
         reg = x14266;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][19 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14273);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14273) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][19])");
         reg = x14273;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -31121,25 +31119,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][12 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14349);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14349) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][12])");
         reg = x14349;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][13 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14357);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14357) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][13])");
         reg = x14357;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][14 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14365);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14365) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][14])");
         reg = x14365;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][15 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14372);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14372) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][15])");
         reg = x14372;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -31343,25 +31341,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][8 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14448);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14448) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][8])");
         reg = x14448;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][9 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14456);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14456) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][9])");
         reg = x14456;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][10 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14464);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14464) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][10])");
         reg = x14464;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][11 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14471);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14471) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][11])");
         reg = x14471;
       }
       // loc("./zirgen/components/plonk.h":279:0)
@@ -31565,25 +31563,25 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][4 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14547);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14547) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][4])");
         reg = x14547;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][5 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14555);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14555) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][5])");
         reg = x14555;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][6 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14563);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14563) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][6])");
         reg = x14563;
       }
       // loc("zirgen/components/fpext.cpp":28:0)
       {
         auto& reg = args[4][7 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14570);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14570) return stepFailed(err, "conflicting write at zirgen/components/fpext.cpp:28 (args[4][7])");
         reg = x14570;
       }
     }
@@ -31591,5 +31589,5 @@ Fp step_verify_accum(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   return x2;
 }
 
-} // namespace risc0::circuit::rv32im
+} // namespace risc0::circuit::rv32im::RISC0_STEP_VARIANT
 // clang-format on
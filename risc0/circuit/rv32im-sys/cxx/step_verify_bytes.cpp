@@ -12,24 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// This code is automatically generated
+// Generated by the circuit compiler and rewritten by risc0/circuit/rewrite-cxx.py.
 
 #include "ffi.h"
 #include "fp.h"
 
 #include <array>
-#include <cassert>
-#include <stdexcept>
 
 // clang-format off
-namespace risc0::circuit::rv32im {
+namespace risc0::circuit::rv32im::RISC0_STEP_VARIANT {
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wunused-parameter"
 #pragma clang diagnostic ignored "-Wunused-variable"
 #endif
 
-Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args) {
+Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp** args, const char** err) {
   size_t mask = steps - 1;
   std::array<Fp, 96> host_args;
   std::array<Fp, 32> host_outs;
@@ -45,372 +43,372 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
   Fp x4(1);
   // loc("Top/Code/OneHot/hot[1](Reg)"("./zirgen/components/mux.h":49:0))
   auto x5 = args[0][2 * steps + ((cycle - 0) & mask)];
-  assert(x5 != Fp::invalid());
+  if (kCheckRegs && x5 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[1](Reg) (args[0][2], back 0)");
   // loc("Top/Code/OneHot/hot[3](Reg)"("./zirgen/components/mux.h":49:0))
   auto x6 = args[0][4 * steps + ((cycle - 0) & mask)];
-  assert(x6 != Fp::invalid());
+  if (kCheckRegs && x6 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[3](Reg) (args[0][4], back 0)");
   // loc("Top/Code/OneHot/hot[4](Reg)"("./zirgen/components/mux.h":49:0))
   auto x7 = args[0][5 * steps + ((cycle - 0) & mask)];
-  assert(x7 != Fp::invalid());
+  if (kCheckRegs && x7 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[4](Reg) (args[0][5], back 0)");
   // loc("Top/Code/OneHot/hot[5](Reg)"("./zirgen/components/mux.h":49:0))
   auto x8 = args[0][6 * steps + ((cycle - 0) & mask)];
-  assert(x8 != Fp::invalid());
+  if (kCheckRegs && x8 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[5](Reg) (args[0][6], back 0)");
   // loc("Top/Code/OneHot/hot[6](Reg)"("./zirgen/components/mux.h":49:0))
   auto x9 = args[0][7 * steps + ((cycle - 0) & mask)];
-  assert(x9 != Fp::invalid());
+  if (kCheckRegs && x9 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[6](Reg) (args[0][7], back 0)");
   // loc("Top/Code/OneHot/hot[7](Reg)"("./zirgen/components/mux.h":49:0))
   auto x10 = args[0][8 * steps + ((cycle - 0) & mask)];
-  assert(x10 != Fp::invalid());
+  if (kCheckRegs && x10 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[7](Reg) (args[0][8], back 0)");
   // loc("Top/Code/OneHot/hot[0](Reg)"("zirgen/circuit/rv32im/top.cpp":78:0))
   auto x11 = args[0][1 * steps + ((cycle - 0) & mask)];
-  assert(x11 != Fp::invalid());
+  if (kCheckRegs && x11 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[0](Reg) (args[0][1], back 0)");
   // loc("Top/Code/OneHot/hot[2](Reg)"("zirgen/circuit/rv32im/top.cpp":78:0))
   auto x12 = args[0][3 * steps + ((cycle - 0) & mask)];
-  assert(x12 != Fp::invalid());
+  if (kCheckRegs && x12 == Fp::invalid()) return stepFailed(err, "read of unset register Top/Code/OneHot/hot[2](Reg) (args[0][3], back 0)");
   if (x11 != 0) {
     // loc("zirgen/components/bytes.cpp":21:0)
     {
       auto& reg = args[2][0 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x3);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:21 (args[2][0])");
       reg = x3;
     }
     // loc("zirgen/components/bytes.cpp":22:0)
     {
       auto& reg = args[2][1 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x3);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x3) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:22 (args[2][1])");
       reg = x3;
     }
   }
   if (x5 != 0) {
     {
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x13 = host_outs.at(0);
-      auto x14 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x13 = host_outs[0];
+      auto x14 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][45 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x13);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x13) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][45])");
         reg = x13;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][46 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x14);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x14) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][46])");
         reg = x14;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x15 = host_outs.at(0);
-      auto x16 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x15 = host_outs[0];
+      auto x16 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][47 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x15);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x15) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][47])");
         reg = x15;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][48 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x16);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x16) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][48])");
         reg = x16;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x17 = host_outs.at(0);
-      auto x18 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x17 = host_outs[0];
+      auto x18 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][49 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x17);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x17) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][49])");
         reg = x17;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][50 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x18);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x18) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][50])");
         reg = x18;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x19 = host_outs.at(0);
-      auto x20 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x19 = host_outs[0];
+      auto x20 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][51 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x19);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x19) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][51])");
         reg = x19;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][52 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x20);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x20) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][52])");
         reg = x20;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x21 = host_outs.at(0);
-      auto x22 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x21 = host_outs[0];
+      auto x22 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][53 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x21);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x21) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][53])");
         reg = x21;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][54 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x22);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x22) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][54])");
         reg = x22;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x23 = host_outs.at(0);
-      auto x24 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x23 = host_outs[0];
+      auto x24 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][55 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x23);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x23) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][55])");
         reg = x23;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][56 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x24);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x24) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][56])");
         reg = x24;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x25 = host_outs.at(0);
-      auto x26 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x25 = host_outs[0];
+      auto x26 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][57 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x25);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x25) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][57])");
         reg = x25;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][58 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x26);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x26) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][58])");
         reg = x26;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x27 = host_outs.at(0);
-      auto x28 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x27 = host_outs[0];
+      auto x28 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][59 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x27);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x27) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][59])");
         reg = x27;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][60 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x28);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x28) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][60])");
         reg = x28;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x29 = host_outs.at(0);
-      auto x30 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x29 = host_outs[0];
+      auto x30 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][61 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x29);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x29) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][61])");
         reg = x29;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][62 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x30);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x30) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][62])");
         reg = x30;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x31 = host_outs.at(0);
-      auto x32 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x31 = host_outs[0];
+      auto x32 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][63 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x31);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x31) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][63])");
         reg = x31;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][64 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x32);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x32) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][64])");
         reg = x32;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x33 = host_outs.at(0);
-      auto x34 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x33 = host_outs[0];
+      auto x34 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][65 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x33);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x33) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][65])");
         reg = x33;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][66 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x34);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x34) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][66])");
         reg = x34;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x35 = host_outs.at(0);
-      auto x36 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x35 = host_outs[0];
+      auto x36 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][67 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x35);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x35) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][67])");
         reg = x35;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][68 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x36);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x36) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][68])");
         reg = x36;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x37 = host_outs.at(0);
-      auto x38 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x37 = host_outs[0];
+      auto x38 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][69 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x37);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x37) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][69])");
         reg = x37;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][70 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x38);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x38) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][70])");
         reg = x38;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x39 = host_outs.at(0);
-      auto x40 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x39 = host_outs[0];
+      auto x40 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][71 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x39);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x39) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][71])");
         reg = x39;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][72 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x40);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x40) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][72])");
         reg = x40;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x41 = host_outs.at(0);
-      auto x42 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x41 = host_outs[0];
+      auto x42 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][73 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x41);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x41) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][73])");
         reg = x41;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][74 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x42);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x42) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][74])");
         reg = x42;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x43 = host_outs.at(0);
-      auto x44 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x43 = host_outs[0];
+      auto x44 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][75 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x43);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x43) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][75])");
         reg = x43;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][76 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x44);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x44) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][76])");
         reg = x44;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x45 = host_outs.at(0);
-      auto x46 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x45 = host_outs[0];
+      auto x46 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][77 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x45);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x45) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][77])");
         reg = x45;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][78 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x46);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x46) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][78])");
         reg = x46;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x47 = host_outs.at(0);
-      auto x48 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x47 = host_outs[0];
+      auto x48 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][79 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x47);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x47) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][79])");
         reg = x47;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][80 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x48);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x48) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][80])");
         reg = x48;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x49 = host_outs.at(0);
-      auto x50 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x49 = host_outs[0];
+      auto x50 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][81 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x49);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x49) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][81])");
         reg = x49;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][82 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x50);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x50) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][82])");
         reg = x50;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x51 = host_outs.at(0);
-      auto x52 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x51 = host_outs[0];
+      auto x52 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][83 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x51);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x51) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][83])");
         reg = x51;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][84 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x52);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x52) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][84])");
         reg = x52;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x53 = host_outs.at(0);
-      auto x54 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x53 = host_outs[0];
+      auto x54 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x53);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x53) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][0])");
         reg = x53;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x54);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x54) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][1])");
         reg = x54;
       }
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x55 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x55 != Fp::invalid());
+    if (kCheckRegs && x55 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x56 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x56 != Fp::invalid());
+    if (kCheckRegs && x56 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x57 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x57 != Fp::invalid());
+    if (kCheckRegs && x57 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x58 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x58 != Fp::invalid());
+    if (kCheckRegs && x58 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x59 = x57 - x55;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -420,10 +418,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x62 = x59 * x61;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x62 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x62 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x59 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x58 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x58 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x63 = x56 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -431,7 +429,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x65 = x64 * x63;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x65 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x65 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x66 = x4 - x59;
@@ -445,14 +443,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x70 = x69 * x67;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x70 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x70 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x71 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x71 != Fp::invalid());
+    if (kCheckRegs && x71 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x72 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x72 != Fp::invalid());
+    if (kCheckRegs && x72 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x73 = x71 - x57;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -462,10 +460,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x76 = x73 * x75;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x76 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x76 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x73 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x72 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x72 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x77 = x58 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -473,7 +471,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x79 = x78 * x77;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x79 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x79 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x80 = x4 - x73;
@@ -487,14 +485,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x84 = x83 * x81;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x84 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x84 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x85 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x85 != Fp::invalid());
+    if (kCheckRegs && x85 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x86 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x86 != Fp::invalid());
+    if (kCheckRegs && x86 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x87 = x85 - x71;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -504,10 +502,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x90 = x87 * x89;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x90 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x90 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x87 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x86 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x86 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x91 = x72 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -515,7 +513,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x93 = x92 * x91;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x93 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x93 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x94 = x4 - x87;
@@ -529,14 +527,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x98 = x97 * x95;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x98 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x98 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x99 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x99 != Fp::invalid());
+    if (kCheckRegs && x99 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x100 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x100 != Fp::invalid());
+    if (kCheckRegs && x100 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x101 = x99 - x85;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -546,10 +544,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x104 = x101 * x103;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x104 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x104 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x101 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x100 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x100 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x105 = x86 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -557,7 +555,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x107 = x106 * x105;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x107 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x107 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x108 = x4 - x101;
@@ -571,14 +569,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x112 = x111 * x109;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x112 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x112 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x113 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x113 != Fp::invalid());
+    if (kCheckRegs && x113 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x114 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x114 != Fp::invalid());
+    if (kCheckRegs && x114 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x115 = x113 - x99;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -588,10 +586,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x118 = x115 * x117;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x118 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x118 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x115 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x114 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x114 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x119 = x100 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -599,7 +597,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x121 = x120 * x119;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x121 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x121 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x122 = x4 - x115;
@@ -613,14 +611,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x126 = x125 * x123;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x126 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x126 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x127 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x127 != Fp::invalid());
+    if (kCheckRegs && x127 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x128 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x128 != Fp::invalid());
+    if (kCheckRegs && x128 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x129 = x127 - x113;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -630,10 +628,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x132 = x129 * x131;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x132 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x132 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x129 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x128 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x128 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x133 = x114 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -641,7 +639,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x135 = x134 * x133;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x135 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x135 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x136 = x4 - x129;
@@ -655,14 +653,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x140 = x139 * x137;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x140 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x140 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x141 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x141 != Fp::invalid());
+    if (kCheckRegs && x141 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x142 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x142 != Fp::invalid());
+    if (kCheckRegs && x142 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x143 = x141 - x127;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -672,10 +670,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x146 = x143 * x145;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x146 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x146 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x143 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x142 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x142 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x147 = x128 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -683,7 +681,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x149 = x148 * x147;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x149 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x149 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x150 = x4 - x143;
@@ -697,14 +695,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x154 = x153 * x151;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x154 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x154 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x155 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x155 != Fp::invalid());
+    if (kCheckRegs && x155 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x156 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x156 != Fp::invalid());
+    if (kCheckRegs && x156 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x157 = x155 - x141;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -714,10 +712,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x160 = x157 * x159;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x160 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x160 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x157 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x156 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x156 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x161 = x142 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -725,7 +723,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x163 = x162 * x161;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x163 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x163 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x164 = x4 - x157;
@@ -739,14 +737,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x168 = x167 * x165;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x168 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x168 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x169 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x169 != Fp::invalid());
+    if (kCheckRegs && x169 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x170 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x170 != Fp::invalid());
+    if (kCheckRegs && x170 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x171 = x169 - x155;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -756,10 +754,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x174 = x171 * x173;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x174 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x174 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x171 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x170 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x170 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x175 = x156 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -767,7 +765,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x177 = x176 * x175;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x177 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x177 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x178 = x4 - x171;
@@ -781,14 +779,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x182 = x181 * x179;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x182 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x182 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x183 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x183 != Fp::invalid());
+    if (kCheckRegs && x183 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x184 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x184 != Fp::invalid());
+    if (kCheckRegs && x184 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x185 = x183 - x169;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -798,10 +796,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x188 = x185 * x187;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x188 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x188 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x185 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x184 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x184 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x189 = x170 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -809,7 +807,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x191 = x190 * x189;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x191 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x191 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x192 = x4 - x185;
@@ -823,14 +821,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x196 = x195 * x193;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x196 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x196 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x197 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x197 != Fp::invalid());
+    if (kCheckRegs && x197 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x198 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x198 != Fp::invalid());
+    if (kCheckRegs && x198 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x199 = x197 - x183;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -840,10 +838,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x202 = x199 * x201;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x202 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x202 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x199 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x198 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x198 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x203 = x184 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -851,7 +849,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x205 = x204 * x203;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x205 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x205 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x206 = x4 - x199;
@@ -865,14 +863,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x210 = x209 * x207;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x210 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x210 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x211 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x211 != Fp::invalid());
+    if (kCheckRegs && x211 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x212 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x212 != Fp::invalid());
+    if (kCheckRegs && x212 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x213 = x211 - x197;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -882,10 +880,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x216 = x213 * x215;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x216 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x216 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x213 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x212 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x212 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x217 = x198 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -893,7 +891,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x219 = x218 * x217;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x219 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x219 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x220 = x4 - x213;
@@ -907,14 +905,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x224 = x223 * x221;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x224 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x224 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x225 = args[2][69 * steps + ((cycle - 0) & mask)];
-    assert(x225 != Fp::invalid());
+    if (kCheckRegs && x225 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][69], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x226 = args[2][70 * steps + ((cycle - 0) & mask)];
-    assert(x226 != Fp::invalid());
+    if (kCheckRegs && x226 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][70], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x227 = x225 - x211;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -924,10 +922,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x230 = x227 * x229;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x230 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x230 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x227 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x226 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x226 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x231 = x212 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -935,7 +933,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x233 = x232 * x231;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x233 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x233 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x234 = x4 - x227;
@@ -949,14 +947,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x238 = x237 * x235;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x238 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x238 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x239 = args[2][71 * steps + ((cycle - 0) & mask)];
-    assert(x239 != Fp::invalid());
+    if (kCheckRegs && x239 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][71], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x240 = args[2][72 * steps + ((cycle - 0) & mask)];
-    assert(x240 != Fp::invalid());
+    if (kCheckRegs && x240 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][72], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x241 = x239 - x225;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -966,10 +964,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x244 = x241 * x243;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x244 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x244 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x241 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x240 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x240 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x245 = x226 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -977,7 +975,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x247 = x246 * x245;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x247 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x247 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x248 = x4 - x241;
@@ -991,14 +989,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x252 = x251 * x249;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x252 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x252 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x253 = args[2][73 * steps + ((cycle - 0) & mask)];
-    assert(x253 != Fp::invalid());
+    if (kCheckRegs && x253 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][73], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x254 = args[2][74 * steps + ((cycle - 0) & mask)];
-    assert(x254 != Fp::invalid());
+    if (kCheckRegs && x254 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][74], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x255 = x253 - x239;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1008,10 +1006,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x258 = x255 * x257;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x258 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x258 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x255 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x254 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x254 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x259 = x240 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1019,7 +1017,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x261 = x260 * x259;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x261 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x261 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x262 = x4 - x255;
@@ -1033,14 +1031,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x266 = x265 * x263;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x266 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x266 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x267 = args[2][75 * steps + ((cycle - 0) & mask)];
-    assert(x267 != Fp::invalid());
+    if (kCheckRegs && x267 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][75], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x268 = args[2][76 * steps + ((cycle - 0) & mask)];
-    assert(x268 != Fp::invalid());
+    if (kCheckRegs && x268 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][76], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x269 = x267 - x253;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1050,10 +1048,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x272 = x269 * x271;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x272 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x272 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x269 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x268 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x268 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x273 = x254 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1061,7 +1059,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x275 = x274 * x273;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x275 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x275 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x276 = x4 - x269;
@@ -1075,14 +1073,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x280 = x279 * x277;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x280 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x280 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x281 = args[2][77 * steps + ((cycle - 0) & mask)];
-    assert(x281 != Fp::invalid());
+    if (kCheckRegs && x281 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][77], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x282 = args[2][78 * steps + ((cycle - 0) & mask)];
-    assert(x282 != Fp::invalid());
+    if (kCheckRegs && x282 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][78], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x283 = x281 - x267;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1092,10 +1090,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x286 = x283 * x285;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x286 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x286 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x283 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x282 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x282 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x287 = x268 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1103,7 +1101,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x289 = x288 * x287;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x289 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x289 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x290 = x4 - x283;
@@ -1117,14 +1115,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x294 = x293 * x291;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x294 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x294 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x295 = args[2][79 * steps + ((cycle - 0) & mask)];
-    assert(x295 != Fp::invalid());
+    if (kCheckRegs && x295 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][79], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x296 = args[2][80 * steps + ((cycle - 0) & mask)];
-    assert(x296 != Fp::invalid());
+    if (kCheckRegs && x296 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][80], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x297 = x295 - x281;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1134,10 +1132,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x300 = x297 * x299;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x300 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x300 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x297 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x296 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x296 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x301 = x282 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1145,7 +1143,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x303 = x302 * x301;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x303 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x303 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x304 = x4 - x297;
@@ -1159,14 +1157,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x308 = x307 * x305;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x308 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x308 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x309 = args[2][81 * steps + ((cycle - 0) & mask)];
-    assert(x309 != Fp::invalid());
+    if (kCheckRegs && x309 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][81], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x310 = args[2][82 * steps + ((cycle - 0) & mask)];
-    assert(x310 != Fp::invalid());
+    if (kCheckRegs && x310 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][82], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x311 = x309 - x295;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1176,10 +1174,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x314 = x311 * x313;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x314 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x314 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x311 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x310 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x310 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x315 = x296 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1187,7 +1185,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x317 = x316 * x315;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x317 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x317 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x318 = x4 - x311;
@@ -1201,14 +1199,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x322 = x321 * x319;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x322 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x322 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x323 = args[2][83 * steps + ((cycle - 0) & mask)];
-    assert(x323 != Fp::invalid());
+    if (kCheckRegs && x323 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][83], back 0)");
     // loc("Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x324 = args[2][84 * steps + ((cycle - 0) & mask)];
-    assert(x324 != Fp::invalid());
+    if (kCheckRegs && x324 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_setup(BytesSetupStep)/BytesSetup/PlonkBody/BytesPlonkElement/Reg (args[2][84], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x325 = x323 - x309;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1218,10 +1216,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x328 = x325 * x327;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x328 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x328 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x325 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x324 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x324 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x329 = x310 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1229,7 +1227,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x331 = x330 * x329;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x331 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x331 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x332 = x4 - x325;
@@ -1243,14 +1241,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x336 = x335 * x333;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x336 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x336 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x337 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x337 != Fp::invalid());
+    if (kCheckRegs && x337 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x338 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x338 != Fp::invalid());
+    if (kCheckRegs && x338 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x339 = x337 - x323;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1260,10 +1258,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x342 = x339 * x341;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x342 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x342 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x339 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x338 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x338 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x343 = x324 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1271,7 +1269,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x345 = x344 * x343;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x345 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x345 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x346 = x4 - x339;
@@ -1285,279 +1283,279 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x350 = x349 * x347;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x350 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x350 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   if (x12 != 0) {
     {
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x351 = host_outs.at(0);
-      auto x352 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x351 = host_outs[0];
+      auto x352 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][37 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x351);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x351) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][37])");
         reg = x351;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][38 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x352);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x352) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][38])");
         reg = x352;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x353 = host_outs.at(0);
-      auto x354 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x353 = host_outs[0];
+      auto x354 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][39 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x353);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x353) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][39])");
         reg = x353;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][40 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x354);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x354) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][40])");
         reg = x354;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x355 = host_outs.at(0);
-      auto x356 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x355 = host_outs[0];
+      auto x356 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][41 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x355);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x355) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][41])");
         reg = x355;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][42 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x356);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x356) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][42])");
         reg = x356;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x357 = host_outs.at(0);
-      auto x358 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x357 = host_outs[0];
+      auto x358 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][43 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x357);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x357) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][43])");
         reg = x357;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][44 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x358);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x358) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][44])");
         reg = x358;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x359 = host_outs.at(0);
-      auto x360 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x359 = host_outs[0];
+      auto x360 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][45 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x359);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x359) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][45])");
         reg = x359;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][46 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x360);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x360) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][46])");
         reg = x360;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x361 = host_outs.at(0);
-      auto x362 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x361 = host_outs[0];
+      auto x362 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][47 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x361);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x361) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][47])");
         reg = x361;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][48 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x362);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x362) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][48])");
         reg = x362;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x363 = host_outs.at(0);
-      auto x364 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x363 = host_outs[0];
+      auto x364 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][49 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x363);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x363) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][49])");
         reg = x363;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][50 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x364);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x364) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][50])");
         reg = x364;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x365 = host_outs.at(0);
-      auto x366 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x365 = host_outs[0];
+      auto x366 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][51 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x365);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x365) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][51])");
         reg = x365;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][52 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x366);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x366) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][52])");
         reg = x366;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x367 = host_outs.at(0);
-      auto x368 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x367 = host_outs[0];
+      auto x368 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][53 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x367);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x367) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][53])");
         reg = x367;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][54 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x368);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x368) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][54])");
         reg = x368;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x369 = host_outs.at(0);
-      auto x370 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x369 = host_outs[0];
+      auto x370 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][55 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x369);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x369) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][55])");
         reg = x369;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][56 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x370);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x370) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][56])");
         reg = x370;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x371 = host_outs.at(0);
-      auto x372 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x371 = host_outs[0];
+      auto x372 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][57 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x371);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x371) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][57])");
         reg = x371;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][58 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x372);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x372) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][58])");
         reg = x372;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x373 = host_outs.at(0);
-      auto x374 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x373 = host_outs[0];
+      auto x374 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][59 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x373);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x373) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][59])");
         reg = x373;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][60 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x374);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x374) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][60])");
         reg = x374;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x375 = host_outs.at(0);
-      auto x376 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x375 = host_outs[0];
+      auto x376 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][61 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x375);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x375) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][61])");
         reg = x375;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][62 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x376);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x376) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][62])");
         reg = x376;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x377 = host_outs.at(0);
-      auto x378 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x377 = host_outs[0];
+      auto x378 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][63 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x377);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x377) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][63])");
         reg = x377;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][64 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x378);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x378) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][64])");
         reg = x378;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x379 = host_outs.at(0);
-      auto x380 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x379 = host_outs[0];
+      auto x380 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][65 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x379);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x379) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][65])");
         reg = x379;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][66 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x380);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x380) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][66])");
         reg = x380;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x381 = host_outs.at(0);
-      auto x382 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x381 = host_outs[0];
+      auto x382 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][67 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x381);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x381) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][67])");
         reg = x381;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][68 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x382);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x382) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][68])");
         reg = x382;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x383 = host_outs.at(0);
-      auto x384 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x383 = host_outs[0];
+      auto x384 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x383);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x383) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][0])");
         reg = x383;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x384);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x384) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][1])");
         reg = x384;
       }
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x385 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x385 != Fp::invalid());
+    if (kCheckRegs && x385 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x386 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x386 != Fp::invalid());
+    if (kCheckRegs && x386 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x387 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x387 != Fp::invalid());
+    if (kCheckRegs && x387 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x388 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x388 != Fp::invalid());
+    if (kCheckRegs && x388 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x389 = x387 - x385;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1567,10 +1565,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x392 = x389 * x391;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x392 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x392 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x389 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x388 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x388 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x393 = x386 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1578,7 +1576,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x395 = x394 * x393;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x395 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x395 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x396 = x4 - x389;
@@ -1592,14 +1590,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x400 = x399 * x397;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x400 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x400 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x401 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x401 != Fp::invalid());
+    if (kCheckRegs && x401 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x402 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x402 != Fp::invalid());
+    if (kCheckRegs && x402 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x403 = x401 - x387;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1609,10 +1607,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x406 = x403 * x405;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x406 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x406 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x403 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x402 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x402 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x407 = x388 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1620,7 +1618,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x409 = x408 * x407;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x409 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x409 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x410 = x4 - x403;
@@ -1634,14 +1632,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x414 = x413 * x411;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x414 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x414 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x415 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x415 != Fp::invalid());
+    if (kCheckRegs && x415 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x416 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x416 != Fp::invalid());
+    if (kCheckRegs && x416 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x417 = x415 - x401;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1651,10 +1649,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x420 = x417 * x419;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x420 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x420 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x417 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x416 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x416 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x421 = x402 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1662,7 +1660,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x423 = x422 * x421;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x423 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x423 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x424 = x4 - x417;
@@ -1676,14 +1674,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x428 = x427 * x425;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x428 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x428 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x429 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x429 != Fp::invalid());
+    if (kCheckRegs && x429 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x430 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x430 != Fp::invalid());
+    if (kCheckRegs && x430 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x431 = x429 - x415;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1693,10 +1691,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x434 = x431 * x433;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x434 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x434 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x431 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x430 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x430 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x435 = x416 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1704,7 +1702,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x437 = x436 * x435;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x437 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x437 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x438 = x4 - x431;
@@ -1718,14 +1716,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x442 = x441 * x439;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x442 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x442 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x443 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x443 != Fp::invalid());
+    if (kCheckRegs && x443 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x444 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x444 != Fp::invalid());
+    if (kCheckRegs && x444 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x445 = x443 - x429;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1735,10 +1733,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x448 = x445 * x447;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x448 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x448 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x445 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x444 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x444 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x449 = x430 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1746,7 +1744,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x451 = x450 * x449;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x451 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x451 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x452 = x4 - x445;
@@ -1760,14 +1758,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x456 = x455 * x453;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x456 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x456 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x457 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x457 != Fp::invalid());
+    if (kCheckRegs && x457 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x458 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x458 != Fp::invalid());
+    if (kCheckRegs && x458 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x459 = x457 - x443;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1777,10 +1775,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x462 = x459 * x461;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x462 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x462 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x459 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x458 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x458 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x463 = x444 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1788,7 +1786,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x465 = x464 * x463;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x465 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x465 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x466 = x4 - x459;
@@ -1802,14 +1800,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x470 = x469 * x467;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x470 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x470 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x471 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x471 != Fp::invalid());
+    if (kCheckRegs && x471 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x472 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x472 != Fp::invalid());
+    if (kCheckRegs && x472 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x473 = x471 - x457;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1819,10 +1817,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x476 = x473 * x475;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x476 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x476 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x473 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x472 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x472 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x477 = x458 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1830,7 +1828,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x479 = x478 * x477;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x479 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x479 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x480 = x4 - x473;
@@ -1844,14 +1842,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x484 = x483 * x481;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x484 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x484 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x485 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x485 != Fp::invalid());
+    if (kCheckRegs && x485 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x486 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x486 != Fp::invalid());
+    if (kCheckRegs && x486 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x487 = x485 - x471;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1861,10 +1859,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x490 = x487 * x489;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x490 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x490 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x487 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x486 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x486 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x491 = x472 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1872,7 +1870,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x493 = x492 * x491;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x493 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x493 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x494 = x4 - x487;
@@ -1886,14 +1884,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x498 = x497 * x495;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x498 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x498 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x499 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x499 != Fp::invalid());
+    if (kCheckRegs && x499 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x500 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x500 != Fp::invalid());
+    if (kCheckRegs && x500 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x501 = x499 - x485;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1903,10 +1901,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x504 = x501 * x503;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x504 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x504 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x501 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x500 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x500 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x505 = x486 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1914,7 +1912,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x507 = x506 * x505;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x507 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x507 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x508 = x4 - x501;
@@ -1928,14 +1926,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x512 = x511 * x509;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x512 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x512 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x513 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x513 != Fp::invalid());
+    if (kCheckRegs && x513 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x514 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x514 != Fp::invalid());
+    if (kCheckRegs && x514 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x515 = x513 - x499;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1945,10 +1943,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x518 = x515 * x517;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x518 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x518 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x515 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x514 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x514 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x519 = x500 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1956,7 +1954,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x521 = x520 * x519;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x521 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x521 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x522 = x4 - x515;
@@ -1970,14 +1968,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x526 = x525 * x523;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x526 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x526 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x527 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x527 != Fp::invalid());
+    if (kCheckRegs && x527 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x528 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x528 != Fp::invalid());
+    if (kCheckRegs && x528 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x529 = x527 - x513;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -1987,10 +1985,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x532 = x529 * x531;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x532 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x532 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x529 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x528 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x528 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x533 = x514 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -1998,7 +1996,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x535 = x534 * x533;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x535 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x535 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x536 = x4 - x529;
@@ -2012,14 +2010,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x540 = x539 * x537;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x540 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x540 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x541 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x541 != Fp::invalid());
+    if (kCheckRegs && x541 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x542 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x542 != Fp::invalid());
+    if (kCheckRegs && x542 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x543 = x541 - x527;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2029,10 +2027,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x546 = x543 * x545;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x546 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x546 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x543 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x542 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x542 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x547 = x528 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2040,7 +2038,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x549 = x548 * x547;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x549 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x549 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x550 = x4 - x543;
@@ -2054,14 +2052,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x554 = x553 * x551;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x554 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x554 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x555 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x555 != Fp::invalid());
+    if (kCheckRegs && x555 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x556 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x556 != Fp::invalid());
+    if (kCheckRegs && x556 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x557 = x555 - x541;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2071,10 +2069,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x560 = x557 * x559;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x560 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x560 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x557 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x556 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x556 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x561 = x542 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2082,7 +2080,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x563 = x562 * x561;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x563 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x563 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x564 = x4 - x557;
@@ -2096,14 +2094,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x568 = x567 * x565;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x568 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x568 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x569 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x569 != Fp::invalid());
+    if (kCheckRegs && x569 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x570 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x570 != Fp::invalid());
+    if (kCheckRegs && x570 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x571 = x569 - x555;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2113,10 +2111,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x574 = x571 * x573;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x574 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x574 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x571 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x570 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x570 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x575 = x556 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2124,7 +2122,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x577 = x576 * x575;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x577 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x577 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x578 = x4 - x571;
@@ -2138,14 +2136,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x582 = x581 * x579;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x582 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x582 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x583 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x583 != Fp::invalid());
+    if (kCheckRegs && x583 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x584 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x584 != Fp::invalid());
+    if (kCheckRegs && x584 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x585 = x583 - x569;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2155,10 +2153,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x588 = x585 * x587;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x588 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x588 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x585 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x584 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x584 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x589 = x570 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2166,7 +2164,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x591 = x590 * x589;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x591 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x591 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x592 = x4 - x585;
@@ -2180,14 +2178,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x596 = x595 * x593;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x596 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x596 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x597 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x597 != Fp::invalid());
+    if (kCheckRegs && x597 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x598 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x598 != Fp::invalid());
+    if (kCheckRegs && x598 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_init(RamInitStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x599 = x597 - x583;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2197,10 +2195,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x602 = x599 * x601;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x602 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x602 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x599 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x598 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x598 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x603 = x584 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2208,7 +2206,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x605 = x604 * x603;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x605 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x605 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x606 = x4 - x599;
@@ -2222,14 +2220,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x610 = x609 * x607;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x610 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x610 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x611 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x611 != Fp::invalid());
+    if (kCheckRegs && x611 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x612 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x612 != Fp::invalid());
+    if (kCheckRegs && x612 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x613 = x611 - x597;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2239,10 +2237,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x616 = x613 * x615;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x616 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x616 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x613 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x612 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x612 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x617 = x598 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2250,7 +2248,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x619 = x618 * x617;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x619 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x619 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x620 = x4 - x613;
@@ -2264,279 +2262,279 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x624 = x623 * x621;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x624 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x624 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   if (x6 != 0) {
     {
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x625 = host_outs.at(0);
-      auto x626 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x625 = host_outs[0];
+      auto x626 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][37 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x625);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x625) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][37])");
         reg = x625;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][38 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x626);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x626) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][38])");
         reg = x626;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x627 = host_outs.at(0);
-      auto x628 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x627 = host_outs[0];
+      auto x628 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][39 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x627);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x627) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][39])");
         reg = x627;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][40 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x628);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x628) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][40])");
         reg = x628;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x629 = host_outs.at(0);
-      auto x630 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x629 = host_outs[0];
+      auto x630 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][41 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x629);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x629) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][41])");
         reg = x629;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][42 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x630);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x630) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][42])");
         reg = x630;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x631 = host_outs.at(0);
-      auto x632 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x631 = host_outs[0];
+      auto x632 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][43 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x631);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x631) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][43])");
         reg = x631;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][44 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x632);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x632) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][44])");
         reg = x632;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x633 = host_outs.at(0);
-      auto x634 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x633 = host_outs[0];
+      auto x634 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][45 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x633);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x633) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][45])");
         reg = x633;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][46 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x634);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x634) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][46])");
         reg = x634;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x635 = host_outs.at(0);
-      auto x636 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x635 = host_outs[0];
+      auto x636 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][47 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x635);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x635) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][47])");
         reg = x635;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][48 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x636);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x636) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][48])");
         reg = x636;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x637 = host_outs.at(0);
-      auto x638 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x637 = host_outs[0];
+      auto x638 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][49 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x637);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x637) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][49])");
         reg = x637;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][50 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x638);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x638) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][50])");
         reg = x638;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x639 = host_outs.at(0);
-      auto x640 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x639 = host_outs[0];
+      auto x640 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][51 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x639);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x639) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][51])");
         reg = x639;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][52 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x640);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x640) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][52])");
         reg = x640;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x641 = host_outs.at(0);
-      auto x642 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x641 = host_outs[0];
+      auto x642 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][53 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x641);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x641) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][53])");
         reg = x641;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][54 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x642);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x642) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][54])");
         reg = x642;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x643 = host_outs.at(0);
-      auto x644 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x643 = host_outs[0];
+      auto x644 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][55 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x643);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x643) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][55])");
         reg = x643;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][56 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x644);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x644) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][56])");
         reg = x644;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x645 = host_outs.at(0);
-      auto x646 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x645 = host_outs[0];
+      auto x646 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][57 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x645);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x645) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][57])");
         reg = x645;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][58 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x646);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x646) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][58])");
         reg = x646;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x647 = host_outs.at(0);
-      auto x648 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x647 = host_outs[0];
+      auto x648 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][59 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x647);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x647) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][59])");
         reg = x647;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][60 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x648);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x648) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][60])");
         reg = x648;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x649 = host_outs.at(0);
-      auto x650 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x649 = host_outs[0];
+      auto x650 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][61 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x649);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x649) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][61])");
         reg = x649;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][62 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x650);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x650) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][62])");
         reg = x650;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x651 = host_outs.at(0);
-      auto x652 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x651 = host_outs[0];
+      auto x652 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][63 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x651);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x651) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][63])");
         reg = x651;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][64 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x652);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x652) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][64])");
         reg = x652;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x653 = host_outs.at(0);
-      auto x654 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x653 = host_outs[0];
+      auto x654 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][65 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x653);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x653) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][65])");
         reg = x653;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][66 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x654);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x654) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][66])");
         reg = x654;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x655 = host_outs.at(0);
-      auto x656 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x655 = host_outs[0];
+      auto x656 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][67 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x655);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x655) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][67])");
         reg = x655;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][68 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x656);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x656) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][68])");
         reg = x656;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x657 = host_outs.at(0);
-      auto x658 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x657 = host_outs[0];
+      auto x658 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x657);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x657) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][0])");
         reg = x657;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x658);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x658) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][1])");
         reg = x658;
       }
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x659 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x659 != Fp::invalid());
+    if (kCheckRegs && x659 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x660 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x660 != Fp::invalid());
+    if (kCheckRegs && x660 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x661 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x661 != Fp::invalid());
+    if (kCheckRegs && x661 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x662 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x662 != Fp::invalid());
+    if (kCheckRegs && x662 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x663 = x661 - x659;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2546,10 +2544,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x666 = x663 * x665;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x666 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x666 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x663 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x662 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x662 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x667 = x660 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2557,7 +2555,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x669 = x668 * x667;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x669 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x669 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x670 = x4 - x663;
@@ -2571,14 +2569,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x674 = x673 * x671;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x674 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x674 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x675 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x675 != Fp::invalid());
+    if (kCheckRegs && x675 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x676 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x676 != Fp::invalid());
+    if (kCheckRegs && x676 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x677 = x675 - x661;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2588,10 +2586,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x680 = x677 * x679;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x680 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x680 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x677 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x676 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x676 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x681 = x662 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2599,7 +2597,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x683 = x682 * x681;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x683 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x683 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x684 = x4 - x677;
@@ -2613,14 +2611,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x688 = x687 * x685;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x688 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x688 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x689 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x689 != Fp::invalid());
+    if (kCheckRegs && x689 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x690 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x690 != Fp::invalid());
+    if (kCheckRegs && x690 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x691 = x689 - x675;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2630,10 +2628,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x694 = x691 * x693;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x694 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x694 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x691 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x690 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x690 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x695 = x676 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2641,7 +2639,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x697 = x696 * x695;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x697 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x697 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x698 = x4 - x691;
@@ -2655,14 +2653,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x702 = x701 * x699;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x702 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x702 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x703 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x703 != Fp::invalid());
+    if (kCheckRegs && x703 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x704 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x704 != Fp::invalid());
+    if (kCheckRegs && x704 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x705 = x703 - x689;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2672,10 +2670,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x708 = x705 * x707;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x708 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x708 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x705 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x704 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x704 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x709 = x690 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2683,7 +2681,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x711 = x710 * x709;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x711 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x711 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x712 = x4 - x705;
@@ -2697,14 +2695,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x716 = x715 * x713;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x716 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x716 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x717 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x717 != Fp::invalid());
+    if (kCheckRegs && x717 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x718 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x718 != Fp::invalid());
+    if (kCheckRegs && x718 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x719 = x717 - x703;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2714,10 +2712,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x722 = x719 * x721;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x722 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x722 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x719 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x718 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x718 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x723 = x704 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2725,7 +2723,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x725 = x724 * x723;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x725 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x725 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x726 = x4 - x719;
@@ -2739,14 +2737,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x730 = x729 * x727;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x730 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x730 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x731 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x731 != Fp::invalid());
+    if (kCheckRegs && x731 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x732 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x732 != Fp::invalid());
+    if (kCheckRegs && x732 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x733 = x731 - x717;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2756,10 +2754,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x736 = x733 * x735;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x736 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x736 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x733 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x732 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x732 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x737 = x718 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2767,7 +2765,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x739 = x738 * x737;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x739 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x739 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x740 = x4 - x733;
@@ -2781,14 +2779,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x744 = x743 * x741;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x744 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x744 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x745 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x745 != Fp::invalid());
+    if (kCheckRegs && x745 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x746 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x746 != Fp::invalid());
+    if (kCheckRegs && x746 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x747 = x745 - x731;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2798,10 +2796,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x750 = x747 * x749;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x750 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x750 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x747 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x746 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x746 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x751 = x732 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2809,7 +2807,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x753 = x752 * x751;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x753 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x753 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x754 = x4 - x747;
@@ -2823,14 +2821,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x758 = x757 * x755;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x758 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x758 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x759 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x759 != Fp::invalid());
+    if (kCheckRegs && x759 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x760 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x760 != Fp::invalid());
+    if (kCheckRegs && x760 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x761 = x759 - x745;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2840,10 +2838,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x764 = x761 * x763;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x764 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x764 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x761 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x760 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x760 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x765 = x746 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2851,7 +2849,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x767 = x766 * x765;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x767 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x767 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x768 = x4 - x761;
@@ -2865,14 +2863,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x772 = x771 * x769;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x772 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x772 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x773 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x773 != Fp::invalid());
+    if (kCheckRegs && x773 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x774 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x774 != Fp::invalid());
+    if (kCheckRegs && x774 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x775 = x773 - x759;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2882,10 +2880,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x778 = x775 * x777;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x778 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x778 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x775 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x774 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x774 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x779 = x760 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2893,7 +2891,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x781 = x780 * x779;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x781 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x781 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x782 = x4 - x775;
@@ -2907,14 +2905,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x786 = x785 * x783;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x786 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x786 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x787 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x787 != Fp::invalid());
+    if (kCheckRegs && x787 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x788 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x788 != Fp::invalid());
+    if (kCheckRegs && x788 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x789 = x787 - x773;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2924,10 +2922,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x792 = x789 * x791;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x792 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x792 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x789 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x788 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x788 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x793 = x774 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2935,7 +2933,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x795 = x794 * x793;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x795 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x795 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x796 = x4 - x789;
@@ -2949,14 +2947,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x800 = x799 * x797;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x800 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x800 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x801 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x801 != Fp::invalid());
+    if (kCheckRegs && x801 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x802 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x802 != Fp::invalid());
+    if (kCheckRegs && x802 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x803 = x801 - x787;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -2966,10 +2964,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x806 = x803 * x805;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x806 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x806 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x803 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x802 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x802 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x807 = x788 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -2977,7 +2975,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x809 = x808 * x807;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x809 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x809 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x810 = x4 - x803;
@@ -2991,14 +2989,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x814 = x813 * x811;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x814 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x814 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x815 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x815 != Fp::invalid());
+    if (kCheckRegs && x815 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x816 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x816 != Fp::invalid());
+    if (kCheckRegs && x816 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x817 = x815 - x801;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3008,10 +3006,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x820 = x817 * x819;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x820 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x820 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x817 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x816 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x816 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x821 = x802 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3019,7 +3017,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x823 = x822 * x821;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x823 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x823 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x824 = x4 - x817;
@@ -3033,14 +3031,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x828 = x827 * x825;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x828 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x828 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x829 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x829 != Fp::invalid());
+    if (kCheckRegs && x829 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x830 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x830 != Fp::invalid());
+    if (kCheckRegs && x830 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x831 = x829 - x815;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3050,10 +3048,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x834 = x831 * x833;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x834 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x834 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x831 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x830 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x830 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x835 = x816 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3061,7 +3059,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x837 = x836 * x835;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x837 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x837 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x838 = x4 - x831;
@@ -3075,14 +3073,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x842 = x841 * x839;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x842 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x842 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x843 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x843 != Fp::invalid());
+    if (kCheckRegs && x843 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x844 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x844 != Fp::invalid());
+    if (kCheckRegs && x844 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x845 = x843 - x829;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3092,10 +3090,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x848 = x845 * x847;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x848 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x848 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x845 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x844 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x844 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x849 = x830 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3103,7 +3101,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x851 = x850 * x849;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x851 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x851 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x852 = x4 - x845;
@@ -3117,14 +3115,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x856 = x855 * x853;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x856 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x856 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x857 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x857 != Fp::invalid());
+    if (kCheckRegs && x857 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x858 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x858 != Fp::invalid());
+    if (kCheckRegs && x858 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x859 = x857 - x843;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3134,10 +3132,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x862 = x859 * x861;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x862 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x862 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x859 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x858 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x858 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x863 = x844 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3145,7 +3143,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x865 = x864 * x863;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x865 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x865 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x866 = x4 - x859;
@@ -3159,14 +3157,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x870 = x869 * x867;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x870 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x870 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x871 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x871 != Fp::invalid());
+    if (kCheckRegs && x871 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x872 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x872 != Fp::invalid());
+    if (kCheckRegs && x872 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_load(RamLoadStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x873 = x871 - x857;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3176,10 +3174,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x876 = x873 * x875;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x876 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x876 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x873 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x872 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x872 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x877 = x858 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3187,7 +3185,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x879 = x878 * x877;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x879 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x879 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x880 = x4 - x873;
@@ -3201,14 +3199,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x884 = x883 * x881;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x884 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x884 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x885 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x885 != Fp::invalid());
+    if (kCheckRegs && x885 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x886 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x886 != Fp::invalid());
+    if (kCheckRegs && x886 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x887 = x885 - x871;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3218,10 +3216,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x890 = x887 * x889;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x890 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x890 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x887 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x886 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x886 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x891 = x872 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3229,7 +3227,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x893 = x892 * x891;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x893 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x893 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x894 = x4 - x887;
@@ -3243,279 +3241,279 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x898 = x897 * x895;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x898 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x898 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   if (x7 != 0) {
     {
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x899 = host_outs.at(0);
-      auto x900 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x899 = host_outs[0];
+      auto x900 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][37 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x899);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x899) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][37])");
         reg = x899;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][38 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x900);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x900) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][38])");
         reg = x900;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x901 = host_outs.at(0);
-      auto x902 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x901 = host_outs[0];
+      auto x902 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][39 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x901);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x901) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][39])");
         reg = x901;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][40 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x902);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x902) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][40])");
         reg = x902;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x903 = host_outs.at(0);
-      auto x904 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x903 = host_outs[0];
+      auto x904 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][41 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x903);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x903) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][41])");
         reg = x903;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][42 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x904);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x904) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][42])");
         reg = x904;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x905 = host_outs.at(0);
-      auto x906 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x905 = host_outs[0];
+      auto x906 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][43 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x905);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x905) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][43])");
         reg = x905;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][44 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x906);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x906) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][44])");
         reg = x906;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x907 = host_outs.at(0);
-      auto x908 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x907 = host_outs[0];
+      auto x908 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][45 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x907);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x907) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][45])");
         reg = x907;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][46 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x908);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x908) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][46])");
         reg = x908;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x909 = host_outs.at(0);
-      auto x910 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x909 = host_outs[0];
+      auto x910 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][47 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x909);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x909) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][47])");
         reg = x909;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][48 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x910);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x910) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][48])");
         reg = x910;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x911 = host_outs.at(0);
-      auto x912 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x911 = host_outs[0];
+      auto x912 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][49 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x911);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x911) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][49])");
         reg = x911;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][50 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x912);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x912) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][50])");
         reg = x912;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x913 = host_outs.at(0);
-      auto x914 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x913 = host_outs[0];
+      auto x914 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][51 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x913);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x913) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][51])");
         reg = x913;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][52 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x914);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x914) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][52])");
         reg = x914;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x915 = host_outs.at(0);
-      auto x916 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x915 = host_outs[0];
+      auto x916 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][53 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x915);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x915) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][53])");
         reg = x915;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][54 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x916);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x916) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][54])");
         reg = x916;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x917 = host_outs.at(0);
-      auto x918 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x917 = host_outs[0];
+      auto x918 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][55 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x917);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x917) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][55])");
         reg = x917;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][56 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x918);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x918) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][56])");
         reg = x918;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x919 = host_outs.at(0);
-      auto x920 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x919 = host_outs[0];
+      auto x920 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][57 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x919);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x919) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][57])");
         reg = x919;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][58 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x920);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x920) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][58])");
         reg = x920;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x921 = host_outs.at(0);
-      auto x922 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x921 = host_outs[0];
+      auto x922 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][59 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x921);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x921) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][59])");
         reg = x921;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][60 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x922);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x922) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][60])");
         reg = x922;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x923 = host_outs.at(0);
-      auto x924 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x923 = host_outs[0];
+      auto x924 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][61 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x923);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x923) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][61])");
         reg = x923;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][62 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x924);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x924) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][62])");
         reg = x924;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x925 = host_outs.at(0);
-      auto x926 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x925 = host_outs[0];
+      auto x926 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][63 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x925);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x925) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][63])");
         reg = x925;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][64 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x926);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x926) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][64])");
         reg = x926;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x927 = host_outs.at(0);
-      auto x928 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x927 = host_outs[0];
+      auto x928 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][65 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x927);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x927) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][65])");
         reg = x927;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][66 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x928);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x928) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][66])");
         reg = x928;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x929 = host_outs.at(0);
-      auto x930 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x929 = host_outs[0];
+      auto x930 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][67 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x929);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x929) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][67])");
         reg = x929;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][68 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x930);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x930) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][68])");
         reg = x930;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x931 = host_outs.at(0);
-      auto x932 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x931 = host_outs[0];
+      auto x932 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x931);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x931) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][0])");
         reg = x931;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x932);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x932) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][1])");
         reg = x932;
       }
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x933 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x933 != Fp::invalid());
+    if (kCheckRegs && x933 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x934 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x934 != Fp::invalid());
+    if (kCheckRegs && x934 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x935 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x935 != Fp::invalid());
+    if (kCheckRegs && x935 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x936 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x936 != Fp::invalid());
+    if (kCheckRegs && x936 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x937 = x935 - x933;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3525,10 +3523,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x940 = x937 * x939;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x940 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x940 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x937 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x936 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x936 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x941 = x934 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3536,7 +3534,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x943 = x942 * x941;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x943 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x943 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x944 = x4 - x937;
@@ -3550,14 +3548,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x948 = x947 * x945;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x948 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x948 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x949 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x949 != Fp::invalid());
+    if (kCheckRegs && x949 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x950 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x950 != Fp::invalid());
+    if (kCheckRegs && x950 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x951 = x949 - x935;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3567,10 +3565,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x954 = x951 * x953;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x954 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x954 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x951 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x950 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x950 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x955 = x936 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3578,7 +3576,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x957 = x956 * x955;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x957 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x957 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x958 = x4 - x951;
@@ -3592,14 +3590,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x962 = x961 * x959;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x962 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x962 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x963 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x963 != Fp::invalid());
+    if (kCheckRegs && x963 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x964 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x964 != Fp::invalid());
+    if (kCheckRegs && x964 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x965 = x963 - x949;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3609,10 +3607,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x968 = x965 * x967;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x968 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x968 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x965 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x964 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x964 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x969 = x950 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3620,7 +3618,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x971 = x970 * x969;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x971 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x971 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x972 = x4 - x965;
@@ -3634,14 +3632,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x976 = x975 * x973;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x976 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x976 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x977 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x977 != Fp::invalid());
+    if (kCheckRegs && x977 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x978 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x978 != Fp::invalid());
+    if (kCheckRegs && x978 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x979 = x977 - x963;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3651,10 +3649,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x982 = x979 * x981;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x982 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x982 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x979 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x978 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x978 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x983 = x964 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3662,7 +3660,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x985 = x984 * x983;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x985 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x985 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x986 = x4 - x979;
@@ -3676,14 +3674,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x990 = x989 * x987;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x990 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x990 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x991 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x991 != Fp::invalid());
+    if (kCheckRegs && x991 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x992 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x992 != Fp::invalid());
+    if (kCheckRegs && x992 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x993 = x991 - x977;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3693,10 +3691,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x996 = x993 * x995;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x996 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x996 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x993 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x992 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x992 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x997 = x978 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3704,7 +3702,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x999 = x998 * x997;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x999 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x999 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1000 = x4 - x993;
@@ -3718,14 +3716,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1004 = x1003 * x1001;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1004 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1004 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1005 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x1005 != Fp::invalid());
+    if (kCheckRegs && x1005 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1006 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x1006 != Fp::invalid());
+    if (kCheckRegs && x1006 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1007 = x1005 - x991;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3735,10 +3733,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1010 = x1007 * x1009;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1010 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1010 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1007 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1006 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1006 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1011 = x992 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3746,7 +3744,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1013 = x1012 * x1011;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1013 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1013 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1014 = x4 - x1007;
@@ -3760,14 +3758,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1018 = x1017 * x1015;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1018 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1018 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1019 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x1019 != Fp::invalid());
+    if (kCheckRegs && x1019 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1020 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x1020 != Fp::invalid());
+    if (kCheckRegs && x1020 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1021 = x1019 - x1005;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3777,10 +3775,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1024 = x1021 * x1023;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1024 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1024 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1021 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1020 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1020 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1025 = x1006 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3788,7 +3786,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1027 = x1026 * x1025;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1027 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1027 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1028 = x4 - x1021;
@@ -3802,14 +3800,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1032 = x1031 * x1029;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1032 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1032 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1033 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x1033 != Fp::invalid());
+    if (kCheckRegs && x1033 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1034 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x1034 != Fp::invalid());
+    if (kCheckRegs && x1034 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1035 = x1033 - x1019;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3819,10 +3817,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1038 = x1035 * x1037;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1038 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1038 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1035 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1034 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1034 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1039 = x1020 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3830,7 +3828,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1041 = x1040 * x1039;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1041 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1041 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1042 = x4 - x1035;
@@ -3844,14 +3842,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1046 = x1045 * x1043;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1046 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1046 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1047 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x1047 != Fp::invalid());
+    if (kCheckRegs && x1047 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1048 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x1048 != Fp::invalid());
+    if (kCheckRegs && x1048 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1049 = x1047 - x1033;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3861,10 +3859,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1052 = x1049 * x1051;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1052 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1052 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1049 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1048 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1048 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1053 = x1034 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3872,7 +3870,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1055 = x1054 * x1053;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1055 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1055 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1056 = x4 - x1049;
@@ -3886,14 +3884,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1060 = x1059 * x1057;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1060 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1060 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1061 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x1061 != Fp::invalid());
+    if (kCheckRegs && x1061 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1062 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x1062 != Fp::invalid());
+    if (kCheckRegs && x1062 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1063 = x1061 - x1047;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3903,10 +3901,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1066 = x1063 * x1065;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1066 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1066 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1063 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1062 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1062 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1067 = x1048 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3914,7 +3912,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1069 = x1068 * x1067;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1069 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1069 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1070 = x4 - x1063;
@@ -3928,14 +3926,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1074 = x1073 * x1071;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1074 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1074 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1075 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x1075 != Fp::invalid());
+    if (kCheckRegs && x1075 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1076 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x1076 != Fp::invalid());
+    if (kCheckRegs && x1076 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1077 = x1075 - x1061;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3945,10 +3943,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1080 = x1077 * x1079;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1080 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1080 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1077 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1076 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1076 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1081 = x1062 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3956,7 +3954,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1083 = x1082 * x1081;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1083 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1083 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1084 = x4 - x1077;
@@ -3970,14 +3968,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1088 = x1087 * x1085;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1088 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1088 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1089 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x1089 != Fp::invalid());
+    if (kCheckRegs && x1089 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1090 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x1090 != Fp::invalid());
+    if (kCheckRegs && x1090 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1091 = x1089 - x1075;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -3987,10 +3985,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1094 = x1091 * x1093;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1094 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1094 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1091 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1090 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1090 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1095 = x1076 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -3998,7 +3996,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1097 = x1096 * x1095;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1097 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1097 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1098 = x4 - x1091;
@@ -4012,14 +4010,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1102 = x1101 * x1099;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1102 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1102 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1103 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x1103 != Fp::invalid());
+    if (kCheckRegs && x1103 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1104 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x1104 != Fp::invalid());
+    if (kCheckRegs && x1104 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1105 = x1103 - x1089;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4029,10 +4027,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1108 = x1105 * x1107;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1108 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1108 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1105 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1104 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1104 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1109 = x1090 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4040,7 +4038,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1111 = x1110 * x1109;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1111 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1111 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1112 = x4 - x1105;
@@ -4054,14 +4052,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1116 = x1115 * x1113;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1116 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1116 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1117 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x1117 != Fp::invalid());
+    if (kCheckRegs && x1117 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1118 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x1118 != Fp::invalid());
+    if (kCheckRegs && x1118 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1119 = x1117 - x1103;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4071,10 +4069,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1122 = x1119 * x1121;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1122 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1122 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1119 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1118 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1118 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1123 = x1104 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4082,7 +4080,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1125 = x1124 * x1123;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1125 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1125 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1126 = x4 - x1119;
@@ -4096,14 +4094,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1130 = x1129 * x1127;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1130 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1130 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1131 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x1131 != Fp::invalid());
+    if (kCheckRegs && x1131 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1132 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x1132 != Fp::invalid());
+    if (kCheckRegs && x1132 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1133 = x1131 - x1117;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4113,10 +4111,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1136 = x1133 * x1135;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1136 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1136 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1133 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1132 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1132 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1137 = x1118 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4124,7 +4122,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1139 = x1138 * x1137;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1139 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1139 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1140 = x4 - x1133;
@@ -4138,14 +4136,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1144 = x1143 * x1141;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1144 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1144 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1145 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x1145 != Fp::invalid());
+    if (kCheckRegs && x1145 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1146 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x1146 != Fp::invalid());
+    if (kCheckRegs && x1146 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/reset(ResetStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1147 = x1145 - x1131;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4155,10 +4153,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1150 = x1147 * x1149;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1150 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1150 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1147 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1146 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1146 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1151 = x1132 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4166,7 +4164,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1153 = x1152 * x1151;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1153 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1153 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1154 = x4 - x1147;
@@ -4180,14 +4178,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1158 = x1157 * x1155;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1158 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1158 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1159 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x1159 != Fp::invalid());
+    if (kCheckRegs && x1159 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1160 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x1160 != Fp::invalid());
+    if (kCheckRegs && x1160 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1161 = x1159 - x1145;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4197,10 +4195,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1164 = x1161 * x1163;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1164 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1164 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1161 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1160 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1160 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1165 = x1146 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4208,7 +4206,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1167 = x1166 * x1165;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1167 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1167 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1168 = x4 - x1161;
@@ -4222,279 +4220,279 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1172 = x1171 * x1169;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1172 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1172 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   if (x8 != 0) {
     {
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1173 = host_outs.at(0);
-      auto x1174 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1173 = host_outs[0];
+      auto x1174 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][37 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1173);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1173) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][37])");
         reg = x1173;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][38 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1174);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1174) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][38])");
         reg = x1174;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1175 = host_outs.at(0);
-      auto x1176 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1175 = host_outs[0];
+      auto x1176 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][39 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1175);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1175) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][39])");
         reg = x1175;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][40 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1176);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1176) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][40])");
         reg = x1176;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1177 = host_outs.at(0);
-      auto x1178 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1177 = host_outs[0];
+      auto x1178 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][41 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1177);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1177) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][41])");
         reg = x1177;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][42 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1178);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1178) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][42])");
         reg = x1178;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1179 = host_outs.at(0);
-      auto x1180 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1179 = host_outs[0];
+      auto x1180 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][43 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1179);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1179) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][43])");
         reg = x1179;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][44 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1180);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1180) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][44])");
         reg = x1180;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1181 = host_outs.at(0);
-      auto x1182 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1181 = host_outs[0];
+      auto x1182 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][45 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1181);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1181) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][45])");
         reg = x1181;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][46 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1182);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1182) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][46])");
         reg = x1182;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1183 = host_outs.at(0);
-      auto x1184 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1183 = host_outs[0];
+      auto x1184 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][47 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1183);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1183) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][47])");
         reg = x1183;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][48 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1184);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1184) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][48])");
         reg = x1184;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1185 = host_outs.at(0);
-      auto x1186 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1185 = host_outs[0];
+      auto x1186 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][49 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1185);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1185) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][49])");
         reg = x1185;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][50 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1186);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1186) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][50])");
         reg = x1186;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1187 = host_outs.at(0);
-      auto x1188 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1187 = host_outs[0];
+      auto x1188 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][51 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1187);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1187) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][51])");
         reg = x1187;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][52 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1188);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1188) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][52])");
         reg = x1188;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1189 = host_outs.at(0);
-      auto x1190 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1189 = host_outs[0];
+      auto x1190 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][53 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1189);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1189) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][53])");
         reg = x1189;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][54 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1190);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1190) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][54])");
         reg = x1190;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1191 = host_outs.at(0);
-      auto x1192 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1191 = host_outs[0];
+      auto x1192 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][55 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1191);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1191) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][55])");
         reg = x1191;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][56 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1192);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1192) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][56])");
         reg = x1192;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1193 = host_outs.at(0);
-      auto x1194 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1193 = host_outs[0];
+      auto x1194 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][57 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1193);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1193) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][57])");
         reg = x1193;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][58 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1194);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1194) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][58])");
         reg = x1194;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1195 = host_outs.at(0);
-      auto x1196 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1195 = host_outs[0];
+      auto x1196 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][59 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1195);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1195) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][59])");
         reg = x1195;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][60 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1196);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1196) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][60])");
         reg = x1196;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1197 = host_outs.at(0);
-      auto x1198 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1197 = host_outs[0];
+      auto x1198 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][61 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1197);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1197) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][61])");
         reg = x1197;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][62 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1198);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1198) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][62])");
         reg = x1198;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1199 = host_outs.at(0);
-      auto x1200 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1199 = host_outs[0];
+      auto x1200 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][63 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1199);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1199) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][63])");
         reg = x1199;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][64 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1200);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1200) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][64])");
         reg = x1200;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1201 = host_outs.at(0);
-      auto x1202 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1201 = host_outs[0];
+      auto x1202 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][65 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1201);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1201) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][65])");
         reg = x1201;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][66 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1202);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1202) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][66])");
         reg = x1202;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1203 = host_outs.at(0);
-      auto x1204 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1203 = host_outs[0];
+      auto x1204 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][67 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1203);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1203) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][67])");
         reg = x1203;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][68 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1204);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1204) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][68])");
         reg = x1204;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1205 = host_outs.at(0);
-      auto x1206 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1205 = host_outs[0];
+      auto x1206 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1205);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1205) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][0])");
         reg = x1205;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1206);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1206) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][1])");
         reg = x1206;
       }
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x1207 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x1207 != Fp::invalid());
+    if (kCheckRegs && x1207 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x1208 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x1208 != Fp::invalid());
+    if (kCheckRegs && x1208 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1209 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x1209 != Fp::invalid());
+    if (kCheckRegs && x1209 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1210 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x1210 != Fp::invalid());
+    if (kCheckRegs && x1210 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1211 = x1209 - x1207;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4504,10 +4502,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1214 = x1211 * x1213;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1214 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1214 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1211 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1210 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1210 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1215 = x1208 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4515,7 +4513,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1217 = x1216 * x1215;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1217 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1217 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1218 = x4 - x1211;
@@ -4529,14 +4527,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1222 = x1221 * x1219;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1222 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1222 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1223 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x1223 != Fp::invalid());
+    if (kCheckRegs && x1223 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1224 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x1224 != Fp::invalid());
+    if (kCheckRegs && x1224 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1225 = x1223 - x1209;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4546,10 +4544,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1228 = x1225 * x1227;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1228 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1228 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1225 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1224 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1224 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1229 = x1210 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4557,7 +4555,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1231 = x1230 * x1229;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1231 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1231 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1232 = x4 - x1225;
@@ -4571,14 +4569,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1236 = x1235 * x1233;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1236 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1236 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1237 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x1237 != Fp::invalid());
+    if (kCheckRegs && x1237 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1238 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x1238 != Fp::invalid());
+    if (kCheckRegs && x1238 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1239 = x1237 - x1223;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4588,10 +4586,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1242 = x1239 * x1241;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1242 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1242 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1239 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1238 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1238 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1243 = x1224 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4599,7 +4597,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1245 = x1244 * x1243;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1245 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1245 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1246 = x4 - x1239;
@@ -4613,14 +4611,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1250 = x1249 * x1247;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1250 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1250 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1251 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x1251 != Fp::invalid());
+    if (kCheckRegs && x1251 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1252 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x1252 != Fp::invalid());
+    if (kCheckRegs && x1252 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1253 = x1251 - x1237;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4630,10 +4628,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1256 = x1253 * x1255;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1256 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1256 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1253 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1252 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1252 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1257 = x1238 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4641,7 +4639,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1259 = x1258 * x1257;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1259 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1259 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1260 = x4 - x1253;
@@ -4655,14 +4653,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1264 = x1263 * x1261;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1264 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1264 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1265 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x1265 != Fp::invalid());
+    if (kCheckRegs && x1265 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1266 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x1266 != Fp::invalid());
+    if (kCheckRegs && x1266 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1267 = x1265 - x1251;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4672,10 +4670,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1270 = x1267 * x1269;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1270 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1270 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1267 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1266 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1266 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1271 = x1252 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4683,7 +4681,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1273 = x1272 * x1271;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1273 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1273 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1274 = x4 - x1267;
@@ -4697,14 +4695,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1278 = x1277 * x1275;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1278 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1278 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1279 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x1279 != Fp::invalid());
+    if (kCheckRegs && x1279 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1280 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x1280 != Fp::invalid());
+    if (kCheckRegs && x1280 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1281 = x1279 - x1265;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4714,10 +4712,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1284 = x1281 * x1283;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1284 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1284 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1281 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1280 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1280 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1285 = x1266 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4725,7 +4723,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1287 = x1286 * x1285;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1287 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1287 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1288 = x4 - x1281;
@@ -4739,14 +4737,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1292 = x1291 * x1289;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1292 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1292 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1293 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x1293 != Fp::invalid());
+    if (kCheckRegs && x1293 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1294 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x1294 != Fp::invalid());
+    if (kCheckRegs && x1294 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1295 = x1293 - x1279;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4756,10 +4754,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1298 = x1295 * x1297;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1298 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1298 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1295 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1294 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1294 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1299 = x1280 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4767,7 +4765,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1301 = x1300 * x1299;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1301 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1301 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1302 = x4 - x1295;
@@ -4781,14 +4779,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1306 = x1305 * x1303;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1306 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1306 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1307 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x1307 != Fp::invalid());
+    if (kCheckRegs && x1307 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1308 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x1308 != Fp::invalid());
+    if (kCheckRegs && x1308 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1309 = x1307 - x1293;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4798,10 +4796,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1312 = x1309 * x1311;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1312 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1312 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1309 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1308 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1308 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1313 = x1294 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4809,7 +4807,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1315 = x1314 * x1313;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1315 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1315 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1316 = x4 - x1309;
@@ -4823,14 +4821,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1320 = x1319 * x1317;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1320 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1320 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1321 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x1321 != Fp::invalid());
+    if (kCheckRegs && x1321 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1322 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x1322 != Fp::invalid());
+    if (kCheckRegs && x1322 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1323 = x1321 - x1307;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4840,10 +4838,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1326 = x1323 * x1325;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1326 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1326 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1323 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1322 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1322 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1327 = x1308 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4851,7 +4849,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1329 = x1328 * x1327;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1329 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1329 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1330 = x4 - x1323;
@@ -4865,14 +4863,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1334 = x1333 * x1331;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1334 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1334 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1335 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x1335 != Fp::invalid());
+    if (kCheckRegs && x1335 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1336 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x1336 != Fp::invalid());
+    if (kCheckRegs && x1336 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1337 = x1335 - x1321;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4882,10 +4880,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1340 = x1337 * x1339;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1340 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1340 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1337 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1336 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1336 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1341 = x1322 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4893,7 +4891,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1343 = x1342 * x1341;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1343 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1343 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1344 = x4 - x1337;
@@ -4907,14 +4905,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1348 = x1347 * x1345;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1348 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1348 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1349 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x1349 != Fp::invalid());
+    if (kCheckRegs && x1349 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1350 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x1350 != Fp::invalid());
+    if (kCheckRegs && x1350 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1351 = x1349 - x1335;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4924,10 +4922,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1354 = x1351 * x1353;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1354 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1354 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1351 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1350 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1350 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1355 = x1336 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4935,7 +4933,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1357 = x1356 * x1355;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1357 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1357 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1358 = x4 - x1351;
@@ -4949,14 +4947,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1362 = x1361 * x1359;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1362 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1362 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1363 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x1363 != Fp::invalid());
+    if (kCheckRegs && x1363 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1364 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x1364 != Fp::invalid());
+    if (kCheckRegs && x1364 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1365 = x1363 - x1349;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -4966,10 +4964,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1368 = x1365 * x1367;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1368 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1368 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1365 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1364 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1364 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1369 = x1350 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -4977,7 +4975,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1371 = x1370 * x1369;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1371 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1371 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1372 = x4 - x1365;
@@ -4991,14 +4989,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1376 = x1375 * x1373;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1376 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1376 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1377 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x1377 != Fp::invalid());
+    if (kCheckRegs && x1377 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1378 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x1378 != Fp::invalid());
+    if (kCheckRegs && x1378 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1379 = x1377 - x1363;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5008,10 +5006,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1382 = x1379 * x1381;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1382 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1382 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1379 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1378 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1378 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1383 = x1364 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5019,7 +5017,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1385 = x1384 * x1383;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1385 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1385 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1386 = x4 - x1379;
@@ -5033,14 +5031,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1390 = x1389 * x1387;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1390 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1390 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1391 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x1391 != Fp::invalid());
+    if (kCheckRegs && x1391 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1392 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x1392 != Fp::invalid());
+    if (kCheckRegs && x1392 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1393 = x1391 - x1377;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5050,10 +5048,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1396 = x1393 * x1395;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1396 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1396 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1393 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1392 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1392 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1397 = x1378 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5061,7 +5059,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1399 = x1398 * x1397;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1399 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1399 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1400 = x4 - x1393;
@@ -5075,14 +5073,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1404 = x1403 * x1401;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1404 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1404 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1405 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x1405 != Fp::invalid());
+    if (kCheckRegs && x1405 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1406 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x1406 != Fp::invalid());
+    if (kCheckRegs && x1406 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1407 = x1405 - x1391;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5092,10 +5090,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1410 = x1407 * x1409;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1410 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1410 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1407 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1406 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1406 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1411 = x1392 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5103,7 +5101,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1413 = x1412 * x1411;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1413 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1413 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1414 = x4 - x1407;
@@ -5117,14 +5115,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1418 = x1417 * x1415;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1418 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1418 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1419 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x1419 != Fp::invalid());
+    if (kCheckRegs && x1419 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1420 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x1420 != Fp::invalid());
+    if (kCheckRegs && x1420 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/body(BodyStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1421 = x1419 - x1405;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5134,10 +5132,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1424 = x1421 * x1423;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1424 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1424 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1421 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1420 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1420 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1425 = x1406 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5145,7 +5143,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1427 = x1426 * x1425;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1427 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1427 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1428 = x4 - x1421;
@@ -5159,14 +5157,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1432 = x1431 * x1429;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1432 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1432 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1433 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x1433 != Fp::invalid());
+    if (kCheckRegs && x1433 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1434 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x1434 != Fp::invalid());
+    if (kCheckRegs && x1434 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1435 = x1433 - x1419;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5176,10 +5174,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1438 = x1435 * x1437;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1438 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1438 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1435 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1434 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1434 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1439 = x1420 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5187,7 +5185,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1441 = x1440 * x1439;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1441 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1441 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1442 = x4 - x1435;
@@ -5201,279 +5199,279 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1446 = x1445 * x1443;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1446 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1446 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   if (x9 != 0) {
     {
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1447 = host_outs.at(0);
-      auto x1448 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1447 = host_outs[0];
+      auto x1448 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][37 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1447);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1447) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][37])");
         reg = x1447;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][38 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1448);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1448) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][38])");
         reg = x1448;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1449 = host_outs.at(0);
-      auto x1450 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1449 = host_outs[0];
+      auto x1450 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][39 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1449);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1449) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][39])");
         reg = x1449;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][40 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1450);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1450) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][40])");
         reg = x1450;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1451 = host_outs.at(0);
-      auto x1452 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1451 = host_outs[0];
+      auto x1452 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][41 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1451);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1451) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][41])");
         reg = x1451;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][42 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1452);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1452) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][42])");
         reg = x1452;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1453 = host_outs.at(0);
-      auto x1454 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1453 = host_outs[0];
+      auto x1454 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][43 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1453);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1453) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][43])");
         reg = x1453;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][44 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1454);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1454) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][44])");
         reg = x1454;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1455 = host_outs.at(0);
-      auto x1456 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1455 = host_outs[0];
+      auto x1456 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][45 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1455);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1455) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][45])");
         reg = x1455;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][46 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1456);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1456) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][46])");
         reg = x1456;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1457 = host_outs.at(0);
-      auto x1458 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1457 = host_outs[0];
+      auto x1458 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][47 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1457);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1457) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][47])");
         reg = x1457;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][48 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1458);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1458) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][48])");
         reg = x1458;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1459 = host_outs.at(0);
-      auto x1460 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1459 = host_outs[0];
+      auto x1460 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][49 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1459);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1459) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][49])");
         reg = x1459;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][50 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1460);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1460) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][50])");
         reg = x1460;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1461 = host_outs.at(0);
-      auto x1462 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1461 = host_outs[0];
+      auto x1462 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][51 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1461);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1461) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][51])");
         reg = x1461;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][52 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1462);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1462) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][52])");
         reg = x1462;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1463 = host_outs.at(0);
-      auto x1464 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1463 = host_outs[0];
+      auto x1464 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][53 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1463);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1463) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][53])");
         reg = x1463;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][54 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1464);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1464) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][54])");
         reg = x1464;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1465 = host_outs.at(0);
-      auto x1466 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1465 = host_outs[0];
+      auto x1466 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][55 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1465);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1465) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][55])");
         reg = x1465;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][56 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1466);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1466) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][56])");
         reg = x1466;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1467 = host_outs.at(0);
-      auto x1468 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1467 = host_outs[0];
+      auto x1468 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][57 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1467);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1467) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][57])");
         reg = x1467;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][58 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1468);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1468) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][58])");
         reg = x1468;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1469 = host_outs.at(0);
-      auto x1470 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1469 = host_outs[0];
+      auto x1470 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][59 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1469);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1469) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][59])");
         reg = x1469;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][60 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1470);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1470) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][60])");
         reg = x1470;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1471 = host_outs.at(0);
-      auto x1472 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1471 = host_outs[0];
+      auto x1472 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][61 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1471);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1471) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][61])");
         reg = x1471;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][62 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1472);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1472) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][62])");
         reg = x1472;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1473 = host_outs.at(0);
-      auto x1474 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1473 = host_outs[0];
+      auto x1474 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][63 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1473);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1473) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][63])");
         reg = x1473;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][64 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1474);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1474) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][64])");
         reg = x1474;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1475 = host_outs.at(0);
-      auto x1476 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1475 = host_outs[0];
+      auto x1476 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][65 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1475);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1475) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][65])");
         reg = x1475;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][66 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1476);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1476) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][66])");
         reg = x1476;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1477 = host_outs.at(0);
-      auto x1478 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1477 = host_outs[0];
+      auto x1478 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][67 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1477);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1477) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][67])");
         reg = x1477;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][68 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1478);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1478) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][68])");
         reg = x1478;
       }
-      host(ctx, "plonkRead", "bytes", host_args.data(), 0, host_outs.data(), 2);
-      auto x1479 = host_outs.at(0);
-      auto x1480 = host_outs.at(1);
+      if (!host(ctx, ExternId::PlonkRead, kExtraBytes, "bytes", host_args.data(), 0, host_outs.data(), 2)) return hostFailed(err);
+      auto x1479 = host_outs[0];
+      auto x1480 = host_outs[1];
       // loc("zirgen/components/bytes.cpp":16:0)
       {
         auto& reg = args[2][0 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1479);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1479) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:16 (args[2][0])");
         reg = x1479;
       }
       // loc("zirgen/components/bytes.cpp":17:0)
       {
         auto& reg = args[2][1 * steps + cycle];
-        assert(reg == Fp::invalid() || reg == x1480);
+        if (kCheckRegs && reg != Fp::invalid() && reg != x1480) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:17 (args[2][1])");
         reg = x1480;
       }
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x1481 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x1481 != Fp::invalid());
+    if (kCheckRegs && x1481 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x1482 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x1482 != Fp::invalid());
+    if (kCheckRegs && x1482 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1483 = args[2][37 * steps + ((cycle - 0) & mask)];
-    assert(x1483 != Fp::invalid());
+    if (kCheckRegs && x1483 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][37], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1484 = args[2][38 * steps + ((cycle - 0) & mask)];
-    assert(x1484 != Fp::invalid());
+    if (kCheckRegs && x1484 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][38], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1485 = x1483 - x1481;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5483,10 +5481,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1488 = x1485 * x1487;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1488 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1488 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1485 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1484 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1484 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1489 = x1482 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5494,7 +5492,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1491 = x1490 * x1489;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1491 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1491 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1492 = x4 - x1485;
@@ -5508,14 +5506,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1496 = x1495 * x1493;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1496 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1496 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1497 = args[2][39 * steps + ((cycle - 0) & mask)];
-    assert(x1497 != Fp::invalid());
+    if (kCheckRegs && x1497 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][39], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1498 = args[2][40 * steps + ((cycle - 0) & mask)];
-    assert(x1498 != Fp::invalid());
+    if (kCheckRegs && x1498 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][40], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1499 = x1497 - x1483;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5525,10 +5523,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1502 = x1499 * x1501;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1502 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1502 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1499 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1498 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1498 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1503 = x1484 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5536,7 +5534,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1505 = x1504 * x1503;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1505 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1505 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1506 = x4 - x1499;
@@ -5550,14 +5548,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1510 = x1509 * x1507;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1510 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1510 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1511 = args[2][41 * steps + ((cycle - 0) & mask)];
-    assert(x1511 != Fp::invalid());
+    if (kCheckRegs && x1511 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][41], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1512 = args[2][42 * steps + ((cycle - 0) & mask)];
-    assert(x1512 != Fp::invalid());
+    if (kCheckRegs && x1512 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][42], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1513 = x1511 - x1497;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5567,10 +5565,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1516 = x1513 * x1515;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1516 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1516 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1513 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1512 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1512 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1517 = x1498 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5578,7 +5576,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1519 = x1518 * x1517;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1519 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1519 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1520 = x4 - x1513;
@@ -5592,14 +5590,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1524 = x1523 * x1521;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1524 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1524 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1525 = args[2][43 * steps + ((cycle - 0) & mask)];
-    assert(x1525 != Fp::invalid());
+    if (kCheckRegs && x1525 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][43], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1526 = args[2][44 * steps + ((cycle - 0) & mask)];
-    assert(x1526 != Fp::invalid());
+    if (kCheckRegs && x1526 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][44], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1527 = x1525 - x1511;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5609,10 +5607,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1530 = x1527 * x1529;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1530 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1530 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1527 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1526 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1526 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1531 = x1512 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5620,7 +5618,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1533 = x1532 * x1531;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1533 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1533 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1534 = x4 - x1527;
@@ -5634,14 +5632,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1538 = x1537 * x1535;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1538 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1538 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1539 = args[2][45 * steps + ((cycle - 0) & mask)];
-    assert(x1539 != Fp::invalid());
+    if (kCheckRegs && x1539 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][45], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1540 = args[2][46 * steps + ((cycle - 0) & mask)];
-    assert(x1540 != Fp::invalid());
+    if (kCheckRegs && x1540 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][46], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1541 = x1539 - x1525;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5651,10 +5649,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1544 = x1541 * x1543;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1544 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1544 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1541 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1540 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1540 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1545 = x1526 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5662,7 +5660,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1547 = x1546 * x1545;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1547 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1547 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1548 = x4 - x1541;
@@ -5676,14 +5674,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1552 = x1551 * x1549;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1552 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1552 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1553 = args[2][47 * steps + ((cycle - 0) & mask)];
-    assert(x1553 != Fp::invalid());
+    if (kCheckRegs && x1553 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][47], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1554 = args[2][48 * steps + ((cycle - 0) & mask)];
-    assert(x1554 != Fp::invalid());
+    if (kCheckRegs && x1554 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][48], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1555 = x1553 - x1539;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5693,10 +5691,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1558 = x1555 * x1557;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1558 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1558 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1555 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1554 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1554 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1559 = x1540 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5704,7 +5702,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1561 = x1560 * x1559;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1561 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1561 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1562 = x4 - x1555;
@@ -5718,14 +5716,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1566 = x1565 * x1563;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1566 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1566 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1567 = args[2][49 * steps + ((cycle - 0) & mask)];
-    assert(x1567 != Fp::invalid());
+    if (kCheckRegs && x1567 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][49], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1568 = args[2][50 * steps + ((cycle - 0) & mask)];
-    assert(x1568 != Fp::invalid());
+    if (kCheckRegs && x1568 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][50], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1569 = x1567 - x1553;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5735,10 +5733,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1572 = x1569 * x1571;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1572 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1572 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1569 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1568 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1568 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1573 = x1554 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5746,7 +5744,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1575 = x1574 * x1573;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1575 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1575 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1576 = x4 - x1569;
@@ -5760,14 +5758,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1580 = x1579 * x1577;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1580 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1580 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1581 = args[2][51 * steps + ((cycle - 0) & mask)];
-    assert(x1581 != Fp::invalid());
+    if (kCheckRegs && x1581 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][51], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1582 = args[2][52 * steps + ((cycle - 0) & mask)];
-    assert(x1582 != Fp::invalid());
+    if (kCheckRegs && x1582 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][52], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1583 = x1581 - x1567;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5777,10 +5775,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1586 = x1583 * x1585;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1586 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1586 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1583 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1582 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1582 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1587 = x1568 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5788,7 +5786,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1589 = x1588 * x1587;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1589 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1589 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1590 = x4 - x1583;
@@ -5802,14 +5800,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1594 = x1593 * x1591;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1594 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1594 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1595 = args[2][53 * steps + ((cycle - 0) & mask)];
-    assert(x1595 != Fp::invalid());
+    if (kCheckRegs && x1595 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][53], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1596 = args[2][54 * steps + ((cycle - 0) & mask)];
-    assert(x1596 != Fp::invalid());
+    if (kCheckRegs && x1596 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][54], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1597 = x1595 - x1581;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5819,10 +5817,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1600 = x1597 * x1599;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1600 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1600 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1597 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1596 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1596 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1601 = x1582 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5830,7 +5828,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1603 = x1602 * x1601;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1603 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1603 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1604 = x4 - x1597;
@@ -5844,14 +5842,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1608 = x1607 * x1605;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1608 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1608 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1609 = args[2][55 * steps + ((cycle - 0) & mask)];
-    assert(x1609 != Fp::invalid());
+    if (kCheckRegs && x1609 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][55], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1610 = args[2][56 * steps + ((cycle - 0) & mask)];
-    assert(x1610 != Fp::invalid());
+    if (kCheckRegs && x1610 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][56], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1611 = x1609 - x1595;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5861,10 +5859,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1614 = x1611 * x1613;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1614 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1614 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1611 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1610 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1610 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1615 = x1596 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5872,7 +5870,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1617 = x1616 * x1615;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1617 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1617 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1618 = x4 - x1611;
@@ -5886,14 +5884,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1622 = x1621 * x1619;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1622 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1622 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1623 = args[2][57 * steps + ((cycle - 0) & mask)];
-    assert(x1623 != Fp::invalid());
+    if (kCheckRegs && x1623 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][57], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1624 = args[2][58 * steps + ((cycle - 0) & mask)];
-    assert(x1624 != Fp::invalid());
+    if (kCheckRegs && x1624 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][58], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1625 = x1623 - x1609;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5903,10 +5901,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1628 = x1625 * x1627;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1628 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1628 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1625 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1624 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1624 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1629 = x1610 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5914,7 +5912,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1631 = x1630 * x1629;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1631 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1631 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1632 = x4 - x1625;
@@ -5928,14 +5926,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1636 = x1635 * x1633;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1636 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1636 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1637 = args[2][59 * steps + ((cycle - 0) & mask)];
-    assert(x1637 != Fp::invalid());
+    if (kCheckRegs && x1637 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][59], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1638 = args[2][60 * steps + ((cycle - 0) & mask)];
-    assert(x1638 != Fp::invalid());
+    if (kCheckRegs && x1638 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][60], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1639 = x1637 - x1623;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5945,10 +5943,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1642 = x1639 * x1641;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1642 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1642 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1639 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1638 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1638 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1643 = x1624 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5956,7 +5954,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1645 = x1644 * x1643;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1645 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1645 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1646 = x4 - x1639;
@@ -5970,14 +5968,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1650 = x1649 * x1647;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1650 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1650 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1651 = args[2][61 * steps + ((cycle - 0) & mask)];
-    assert(x1651 != Fp::invalid());
+    if (kCheckRegs && x1651 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][61], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1652 = args[2][62 * steps + ((cycle - 0) & mask)];
-    assert(x1652 != Fp::invalid());
+    if (kCheckRegs && x1652 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][62], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1653 = x1651 - x1637;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -5987,10 +5985,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1656 = x1653 * x1655;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1656 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1656 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1653 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1652 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1652 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1657 = x1638 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -5998,7 +5996,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1659 = x1658 * x1657;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1659 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1659 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1660 = x4 - x1653;
@@ -6012,14 +6010,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1664 = x1663 * x1661;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1664 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1664 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1665 = args[2][63 * steps + ((cycle - 0) & mask)];
-    assert(x1665 != Fp::invalid());
+    if (kCheckRegs && x1665 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][63], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1666 = args[2][64 * steps + ((cycle - 0) & mask)];
-    assert(x1666 != Fp::invalid());
+    if (kCheckRegs && x1666 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][64], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1667 = x1665 - x1651;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -6029,10 +6027,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1670 = x1667 * x1669;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1670 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1670 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1667 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1666 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1666 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1671 = x1652 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -6040,7 +6038,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1673 = x1672 * x1671;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1673 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1673 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1674 = x4 - x1667;
@@ -6054,14 +6052,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1678 = x1677 * x1675;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1678 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1678 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1679 = args[2][65 * steps + ((cycle - 0) & mask)];
-    assert(x1679 != Fp::invalid());
+    if (kCheckRegs && x1679 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][65], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1680 = args[2][66 * steps + ((cycle - 0) & mask)];
-    assert(x1680 != Fp::invalid());
+    if (kCheckRegs && x1680 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][66], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1681 = x1679 - x1665;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -6071,10 +6069,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1684 = x1681 * x1683;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1684 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1684 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1681 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1680 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1680 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1685 = x1666 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -6082,7 +6080,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1687 = x1686 * x1685;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1687 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1687 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1688 = x4 - x1681;
@@ -6096,14 +6094,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1692 = x1691 * x1689;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1692 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1692 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1693 = args[2][67 * steps + ((cycle - 0) & mask)];
-    assert(x1693 != Fp::invalid());
+    if (kCheckRegs && x1693 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][67], back 0)");
     // loc("Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1694 = args[2][68 * steps + ((cycle - 0) & mask)];
-    assert(x1694 != Fp::invalid());
+    if (kCheckRegs && x1694 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/ram_fini(RamFiniStep)/BytesBody/PlonkBody/BytesPlonkElement/Reg (args[2][68], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1695 = x1693 - x1679;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -6113,10 +6111,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1698 = x1695 * x1697;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1698 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1698 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1695 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1694 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1694 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1699 = x1680 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -6124,7 +6122,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1701 = x1700 * x1699;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1701 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1701 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1702 = x4 - x1695;
@@ -6138,14 +6136,14 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1706 = x1705 * x1703;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1706 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1706 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1707 = args[2][0 * steps + ((cycle - 0) & mask)];
-    assert(x1707 != Fp::invalid());
+    if (kCheckRegs && x1707 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 0)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1708 = args[2][1 * steps + ((cycle - 0) & mask)];
-    assert(x1708 != Fp::invalid());
+    if (kCheckRegs && x1708 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1709 = x1707 - x1693;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -6155,10 +6153,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1712 = x1709 * x1711;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1712 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1712 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1709 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1708 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1708 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1713 = x1694 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -6166,7 +6164,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1715 = x1714 * x1713;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1715 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1715 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1716 = x4 - x1709;
@@ -6180,34 +6178,34 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1720 = x1719 * x1717;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1720 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1720 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   if (x10 != 0) {
     // loc("zirgen/components/bytes.cpp":26:0)
     {
       auto& reg = args[2][3 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x0);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x0) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:26 (args[2][3])");
       reg = x0;
     }
     // loc("zirgen/components/bytes.cpp":27:0)
     {
       auto& reg = args[2][4 * steps + cycle];
-      assert(reg == Fp::invalid() || reg == x0);
+      if (kCheckRegs && reg != Fp::invalid() && reg != x0) return stepFailed(err, "conflicting write at zirgen/components/bytes.cpp:27 (args[2][4])");
       reg = x0;
     }
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":62:0))
     auto x1721 = args[2][0 * steps + ((cycle - 1) & mask)];
-    assert(x1721 != Fp::invalid());
+    if (kCheckRegs && x1721 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][0], back 1)");
     // loc("Top/BytesHeader/BytesPlonkElement/Reg"("zirgen/components/bytes.cpp":63:0))
     auto x1722 = args[2][1 * steps + ((cycle - 1) & mask)];
-    assert(x1722 != Fp::invalid());
+    if (kCheckRegs && x1722 == Fp::invalid()) return stepFailed(err, "read of unset register Top/BytesHeader/BytesPlonkElement/Reg (args[2][1], back 1)");
     // loc("Top/mux(Mux)/bytes_fini(BytesFiniStep)/PlonkFini/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1723 = args[2][3 * steps + ((cycle - 0) & mask)];
-    assert(x1723 != Fp::invalid());
+    if (kCheckRegs && x1723 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_fini(BytesFiniStep)/PlonkFini/BytesPlonkElement/Reg (args[2][3], back 0)");
     // loc("Top/mux(Mux)/bytes_fini(BytesFiniStep)/PlonkFini/BytesPlonkElement/Reg"("./zirgen/compiler/edsl/component.h":154:0))
     auto x1724 = args[2][4 * steps + ((cycle - 0) & mask)];
-    assert(x1724 != Fp::invalid());
+    if (kCheckRegs && x1724 == Fp::invalid()) return stepFailed(err, "read of unset register Top/mux(Mux)/bytes_fini(BytesFiniStep)/PlonkFini/BytesPlonkElement/Reg (args[2][4], back 0)");
     // loc("zirgen/components/bytes.cpp":66:0)
     auto x1725 = x1723 - x1721;
     // loc("zirgen/components/bytes.cpp":67:0)
@@ -6217,10 +6215,10 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
     // loc("zirgen/components/bytes.cpp":69:0)
     auto x1728 = x1725 * x1727;
     // loc("zirgen/components/bytes.cpp":69:0)
-    if (x1728 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:69");
+    if (x1728 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:69");
     if (x1725 != 0) {
       // loc("zirgen/components/bytes.cpp":73:0)
-      if (x1724 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:73");
+      if (x1724 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:73");
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1729 = x1722 - x2;
       // loc("zirgen/components/bytes.cpp":75:0)
@@ -6228,7 +6226,7 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":75:0)
       auto x1731 = x1730 * x1729;
       // loc("zirgen/components/bytes.cpp":75:0)
-      if (x1731 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:75");
+      if (x1731 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:75");
     }
     // loc("zirgen/components/bytes.cpp":77:0)
     auto x1732 = x4 - x1725;
@@ -6242,11 +6240,11 @@ Fp step_verify_bytes(void* ctx, HostBridge host, size_t steps, size_t cycle, Fp*
       // loc("zirgen/components/bytes.cpp":79:0)
       auto x1736 = x1735 * x1733;
       // loc("zirgen/components/bytes.cpp":79:0)
-      if (x1736 != 0) throw std::runtime_error("eqz failed at: zirgen/components/bytes.cpp:79");
+      if (x1736 != 0) return stepFailed(err, "eqz failed at: zirgen/components/bytes.cpp:79");
     }
   }
   return x3;
 }
 
-} // namespace risc0::circuit::rv32im
+} // namespace risc0::circuit::rv32im::RISC0_STEP_VARIANT
 // clang-format on
@@ -14,6 +14,9 @@
 
 pub mod ffi;
 
+#[cfg(test)]
+mod tests;
+
 #[test]
 fn eval_check_size() {
     // Make sure the generated eval check/poly fp doesn't increase in
@@ -0,0 +1,196 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use rand::{rngs::SmallRng, Rng, SeedableRng};
+use risc0_core::field::{
+    baby_bear::{BabyBearElem, BabyBearExtElem},
+    Elem,
+};
+
+#[cfg(feature = "test-kernels")]
+use crate::ffi::{
+    risc0_circuit_rv32im_fp4_mul, risc0_circuit_rv32im_fp4vec_mul,
+    risc0_circuit_rv32im_fpvec_eltwise, risc0_circuit_rv32im_fpvec_lanes,
+};
+use crate::ffi::{risc0_circuit_rv32im_poly_fp, risc0_circuit_rv32im_poly_fp_batch, POLY_MIX_POWS};
+
+#[cfg(feature = "test-kernels")]
+const ITERATIONS: usize = 1 << 16;
+
+// Mostly uniform elements, with the edges of the field mixed in.
+fn random_elem(rng: &mut SmallRng) -> BabyBearElem {
+    if rng.gen_ratio(1, 8) {
+        let edges = [
+            BabyBearElem::ZERO,
+            BabyBearElem::ONE,
+            BabyBearElem::new(2),
+            -BabyBearElem::new(2),
+            -BabyBearElem::ONE,
+        ];
+        edges[rng.gen_range(0..edges.len())]
+    } else {
+        BabyBearElem::random(rng)
+    }
+}
+
+fn random_ext_elem(rng: &mut SmallRng) -> BabyBearExtElem {
+    BabyBearExtElem::new(
+        random_elem(rng),
+        random_elem(rng),
+        random_elem(rng),
+        random_elem(rng),
+    )
+}
+
+#[cfg(feature = "test-kernels")]
+fn count() -> usize {
+    let lanes = unsafe { risc0_circuit_rv32im_fpvec_lanes() };
+    assert!(lanes.is_power_of_two());
+    ITERATIONS / lanes * lanes
+}
+
+#[cfg(feature = "test-kernels")]
+#[test]
+fn fpvec_lanes_match_target_features() {
+    // The kernels are built for the target features of the crate, so building
+    // with e.g. `-C target-cpu=native` must select the wide lanes.
+    let expected = if cfg!(target_feature = "avx512f") {
+        16
+    } else if cfg!(target_feature = "avx2") {
+        8
+    } else {
+        4
+    };
+    assert_eq!(unsafe { risc0_circuit_rv32im_fpvec_lanes() }, expected);
+}
+
+#[cfg(feature = "test-kernels")]
+#[test]
+fn fpvec_matches_fp() {
+    let mut rng = SmallRng::seed_from_u64(2);
+    let count = count();
+    let a: Vec<_> = (0..count).map(|_| random_elem(&mut rng)).collect();
+    let b: Vec<_> = (0..count).map(|_| random_elem(&mut rng)).collect();
+    let ops: [(u32, fn(BabyBearElem, BabyBearElem) -> BabyBearElem); 4] = [
+        (0, |a, b| a + b),
+        (1, |a, b| a - b),
+        (2, |a, b| a * b),
+        (3, |a, _| -a),
+    ];
+    for (op, expected) in ops {
+        let mut out = vec![BabyBearElem::INVALID; count];
+        unsafe {
+            risc0_circuit_rv32im_fpvec_eltwise(op, out.as_mut_ptr(), a.as_ptr(), b.as_ptr(), count)
+        };
+        for i in 0..count {
+            assert_eq!(
+                out[i],
+                expected(a[i], b[i]),
+                "op {op}: {:?}, {:?}",
+                a[i],
+                b[i]
+            );
+        }
+    }
+}
+
+#[cfg(feature = "test-kernels")]
+#[test]
+fn fp4_mul_matches_ext_elem() {
+    let mut rng = SmallRng::seed_from_u64(3);
+    let a: Vec<_> = (0..ITERATIONS).map(|_| random_ext_elem(&mut rng)).collect();
+    let b: Vec<_> = (0..ITERATIONS).map(|_| random_ext_elem(&mut rng)).collect();
+    let mut out = vec![BabyBearExtElem::INVALID; ITERATIONS];
+    unsafe {
+        risc0_circuit_rv32im_fp4_mul(out.as_mut_ptr(), a.as_ptr(), b.as_ptr(), ITERATIONS);
+    }
+    for i in 0..ITERATIONS {
+        assert_eq!(out[i], a[i] * b[i], "{:?}, {:?}", a[i], b[i]);
+    }
+}
+
+#[cfg(feature = "test-kernels")]
+#[test]
+fn fp4vec_matches_fp4() {
+    let mut rng = SmallRng::seed_from_u64(4);
+    let count = count();
+    let a: Vec<_> = (0..count).map(|_| random_ext_elem(&mut rng)).collect();
+    let b4: Vec<_> = (0..count).map(|_| random_ext_elem(&mut rng)).collect();
+    let b: Vec<_> = (0..count).map(|_| random_elem(&mut rng)).collect();
+
+    let mut out = vec![BabyBearExtElem::INVALID; count];
+    unsafe {
+        risc0_circuit_rv32im_fp4vec_mul(
+            out.as_mut_ptr(),
+            a.as_ptr(),
+            b4.as_ptr(),
+            std::ptr::null(),
+            count,
+        )
+    };
+    for i in 0..count {
+        assert_eq!(out[i], a[i] * b4[i]);
+    }
+
+    unsafe {
+        risc0_circuit_rv32im_fp4vec_mul(
+            out.as_mut_ptr(),
+            a.as_ptr(),
+            std::ptr::null(),
+            b.as_ptr(),
+            count,
+        )
+    };
+    for i in 0..count {
+        assert_eq!(out[i], a[i] * b[i]);
+    }
+}
+
+#[test]
+fn poly_fp_batch_matches_poly_fp() {
+    // More columns than any of code, out, data, mix and accum has.
+    const COLS: usize = 256;
+    const STEPS: usize = 64;
+
+    let mut rng = SmallRng::seed_from_u64(5);
+    let groups: Vec<Vec<_>> = (0..5)
+        .map(|_| (0..COLS * STEPS).map(|_| random_elem(&mut rng)).collect())
+        .collect();
+    let args: Vec<_> = groups.iter().map(|group| group.as_ptr()).collect();
+    let mix_pows: Vec<_> = (0..POLY_MIX_POWS)
+        .map(|_| random_ext_elem(&mut rng))
+        .collect();
+
+    // Start off a lane boundary and wrap around the end, and leave a tail that
+    // isn't a multiple of the lane count.
+    let start = STEPS - 5;
+    let count = STEPS - 3;
+    let mut out = vec![BabyBearExtElem::INVALID; count];
+    unsafe {
+        risc0_circuit_rv32im_poly_fp_batch(
+            start,
+            count,
+            STEPS,
+            mix_pows.as_ptr(),
+            args.as_ptr(),
+            out.as_mut_ptr(),
+        )
+    };
+    for (i, tot) in out.iter().enumerate() {
+        let cycle = (start + i) % STEPS;
+        let expected =
+            unsafe { risc0_circuit_rv32im_poly_fp(cycle, STEPS, mix_pows.as_ptr(), args.as_ptr()) };
+        assert_eq!(*tot, expected, "cycle {cycle}");
+    }
+}
@@ -0,0 +1,157 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use risc0_circuit_rv32im::{CircuitImpl, REGISTER_GROUP_CODE, REGISTER_GROUP_DATA};
+use risc0_core::field::{baby_bear::BabyBearElem, Elem};
+use risc0_zkp::{
+    adapter::{
+        CircuitInfo, CircuitStep, CircuitStepContext, CircuitStepHandler, ExternId, ExtraId,
+        TapsProvider,
+    },
+    hal::cpu::CpuBuffer,
+};
+
+// Column of the `bytes_setup` one-hot selector in the code group.  Those rows
+// perform 21 `plonkRead("bytes")` externs per cycle, which makes the bridge
+// overhead dominate.
+const BYTES_SETUP_COLUMN: usize = 2;
+
+/// Dispatches externs by id.
+struct TypedHandler;
+
+impl CircuitStepHandler<BabyBearElem> for TypedHandler {
+    fn call(
+        &mut self,
+        _cycle: usize,
+        name: &str,
+        _extra: &str,
+        _args: &[BabyBearElem],
+        _outs: &mut [BabyBearElem],
+    ) -> anyhow::Result<()> {
+        unimplemented!("{name}")
+    }
+
+    fn call_extern(
+        &mut self,
+        _cycle: usize,
+        id: ExternId,
+        extra_id: ExtraId,
+        _extra: &str,
+        _args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> anyhow::Result<()> {
+        match (id, extra_id) {
+            (ExternId::PlonkRead, ExtraId::BYTES) => outs.fill(BabyBearElem::ZERO),
+            _ => unimplemented!("{}", id.name()),
+        }
+        Ok(())
+    }
+
+    fn sort(&mut self, _name: &str) {}
+}
+
+/// Dispatches externs through the string-keyed fallback bridge.
+struct StringHandler;
+
+impl CircuitStepHandler<BabyBearElem> for StringHandler {
+    const TYPED_EXTERNS: bool = false;
+
+    fn call(
+        &mut self,
+        _cycle: usize,
+        name: &str,
+        extra: &str,
+        _args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> anyhow::Result<()> {
+        match (name, extra) {
+            ("plonkRead", "bytes") => outs.fill(BabyBearElem::ZERO),
+            _ => unimplemented!("{name}"),
+        }
+        Ok(())
+    }
+
+    fn sort(&mut self, _name: &str) {}
+}
+
+struct Trace {
+    steps: usize,
+    code: CpuBuffer<BabyBearElem>,
+    io: CpuBuffer<BabyBearElem>,
+    data: CpuBuffer<BabyBearElem>,
+}
+
+impl Trace {
+    fn new(po2: usize) -> Self {
+        let steps = 1 << po2;
+        let taps = CircuitImpl::new().get_taps();
+        let code_size = taps.group_size(REGISTER_GROUP_CODE);
+        let data_size = taps.group_size(REGISTER_GROUP_DATA);
+        let code = CpuBuffer::from_fn(code_size * steps, |i| {
+            if i / steps == BYTES_SETUP_COLUMN {
+                BabyBearElem::ONE
+            } else {
+                BabyBearElem::ZERO
+            }
+        });
+        Self {
+            steps,
+            code,
+            io: CpuBuffer::from_fn(CircuitImpl::OUTPUT_SIZE, |_| BabyBearElem::ZERO),
+            data: CpuBuffer::from_fn(data_size * steps, |_| BabyBearElem::ZERO),
+        }
+    }
+
+    fn run<S: CircuitStepHandler<BabyBearElem>>(&self, handler: &mut S) {
+        let circuit = CircuitImpl::new();
+        let args = [&self.code, &self.io, &self.data].map(CpuBuffer::as_slice_sync);
+        for cycle in 0..self.steps {
+            let ctx = CircuitStepContext {
+                size: self.steps,
+                cycle,
+            };
+            circuit.step_verify_bytes(&ctx, handler, &args).unwrap();
+        }
+    }
+
+    fn run_range<S: CircuitStepHandler<BabyBearElem>>(&self, handler: &mut S) {
+        let circuit = CircuitImpl::new();
+        let args = [&self.code, &self.io, &self.data].map(CpuBuffer::as_slice_sync);
+        circuit
+            .step_verify_bytes_range(self.steps, 0..self.steps, handler, &args)
+            .unwrap();
+    }
+}
+
+pub fn externs(c: &mut Criterion) {
+    let mut group = c.benchmark_group("externs");
+    group.sample_size(10);
+    for po2 in [10, 14].iter() {
+        let trace = Trace::new(*po2);
+        group.throughput(Throughput::Elements(trace.steps as u64));
+        group.bench_function(BenchmarkId::new("typed", po2), |b| {
+            b.iter(|| trace.run(&mut TypedHandler));
+        });
+        group.bench_function(BenchmarkId::new("typed_range", po2), |b| {
+            b.iter(|| trace.run_range(&mut TypedHandler));
+        });
+        group.bench_function(BenchmarkId::new("string", po2), |b| {
+            b.iter(|| trace.run(&mut StringHandler));
+        });
+    }
+}
+
+criterion_group!(benches, externs);
+criterion_main!(benches);
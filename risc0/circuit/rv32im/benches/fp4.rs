@@ -0,0 +1,60 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use risc0_circuit_rv32im_sys::ffi::risc0_circuit_rv32im_fp4_mul;
+use risc0_core::field::{
+    baby_bear::{BabyBearElem, BabyBearExtElem},
+    Elem,
+};
+
+const COUNT: usize = 1 << 16;
+
+fn ext_elems(seed: u32) -> Vec<BabyBearExtElem> {
+    let mut x = BabyBearElem::new(seed);
+    (0..COUNT)
+        .map(|_| {
+            let elems = [(); 4].map(|_| {
+                x = x * x + BabyBearElem::new(seed);
+                x
+            });
+            BabyBearExtElem::new(elems[0], elems[1], elems[2], elems[3])
+        })
+        .collect()
+}
+
+pub fn fp4_mul(c: &mut Criterion) {
+    let mut group = c.benchmark_group("fp4_mul");
+    let a = ext_elems(3);
+    let b = ext_elems(7);
+    let mut out = vec![BabyBearExtElem::ZERO; COUNT];
+    group.throughput(Throughput::Elements(COUNT as u64));
+    group.bench_function("cpp", |bench| {
+        bench.iter(|| unsafe {
+            risc0_circuit_rv32im_fp4_mul(out.as_mut_ptr(), a.as_ptr(), b.as_ptr(), COUNT);
+            black_box(&out);
+        });
+    });
+    group.bench_function("rust", |bench| {
+        bench.iter(|| {
+            for ((out, a), b) in out.iter_mut().zip(&a).zip(&b) {
+                *out = *a * *b;
+            }
+            black_box(&out);
+        });
+    });
+}
+
+criterion_group!(benches, fp4_mul);
+criterion_main!(benches);
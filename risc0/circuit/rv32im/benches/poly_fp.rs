@@ -0,0 +1,59 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use risc0_circuit_rv32im::{testutil::EvalCheckParams, CircuitImpl};
+use risc0_core::field::{
+    baby_bear::{BabyBearElem, BabyBearExtElem},
+    ExtElem,
+};
+use risc0_zkp::adapter::PolyFp;
+
+const CHUNK_SIZE: usize = 64;
+
+pub fn poly_fp(c: &mut Criterion) {
+    let mut group = c.benchmark_group("poly_fp");
+    group.sample_size(10);
+    let circuit = CircuitImpl::new();
+    for po2 in [8, 12].iter() {
+        let params = EvalCheckParams::new(*po2);
+        let args: &[&[BabyBearElem]] = &[
+            &params.code,
+            &params.out,
+            &params.data,
+            &params.mix,
+            &params.accum,
+        ];
+        let mix_pows = circuit.poly_mix_pows(&params.poly_mix);
+        group.throughput(Throughput::Elements(params.domain as u64));
+        group.bench_function(BenchmarkId::new("scalar", po2), |b| {
+            b.iter(|| {
+                for cycle in 0..params.domain {
+                    circuit.poly_fp(cycle, params.domain, &mix_pows, args);
+                }
+            });
+        });
+        group.bench_function(BenchmarkId::new("batch", po2), |b| {
+            let mut out = [BabyBearExtElem::ZERO; CHUNK_SIZE];
+            b.iter(|| {
+                for cycle in (0..params.domain).step_by(CHUNK_SIZE) {
+                    circuit.poly_fp_batch(cycle, params.domain, &mix_pows, args, &mut out);
+                }
+            });
+        });
+    }
+}
+
+criterion_group!(benches, poly_fp);
+criterion_main!(benches);
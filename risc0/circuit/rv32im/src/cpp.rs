@@ -12,22 +12,68 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use std::{ffi::CStr, os::raw::c_void};
+use std::{cmp, ffi::CStr, ops::Range, os::raw::c_void, time::Instant};
 
 use anyhow::{anyhow, Result};
+use rayon::prelude::*;
 use risc0_circuit_rv32im_sys::ffi::{
-    get_trampoline, risc0_circuit_rv32im_poly_fp, risc0_circuit_rv32im_step_compute_accum,
-    risc0_circuit_rv32im_step_exec, risc0_circuit_rv32im_step_verify_accum,
-    risc0_circuit_rv32im_step_verify_bytes, risc0_circuit_rv32im_step_verify_mem,
-    risc0_circuit_string_free, risc0_circuit_string_ptr, Callback, RawError,
+    get_host_table, risc0_circuit_rv32im_eval_check, risc0_circuit_rv32im_poly_fp,
+    risc0_circuit_rv32im_poly_fp_batch, risc0_circuit_rv32im_set_checked,
+    risc0_circuit_rv32im_set_log, risc0_circuit_rv32im_step_compute_accum,
+    risc0_circuit_rv32im_step_compute_accum_range, risc0_circuit_rv32im_step_exec,
+    risc0_circuit_rv32im_step_exec_range, risc0_circuit_rv32im_step_verify_accum,
+    risc0_circuit_rv32im_step_verify_accum_range, risc0_circuit_rv32im_step_verify_bytes,
+    risc0_circuit_rv32im_step_verify_bytes_range, risc0_circuit_rv32im_step_verify_mem,
+    risc0_circuit_rv32im_step_verify_mem_range, risc0_circuit_string_free,
+    risc0_circuit_string_ptr, GroupBacks, HostBridge, HostTable, RawError, POLY_MIX_POWS,
+};
+use risc0_core::field::{
+    baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem},
+    Elem, ExtElem,
 };
-use risc0_core::field::baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem};
 use risc0_zkp::{
-    adapter::{CircuitProveDef, CircuitStep, CircuitStepContext, CircuitStepHandler, PolyFp},
+    adapter::{
+        CircuitProveDef, CircuitStep, CircuitStepContext, CircuitStepHandler, ExternId, ExtraId,
+        PolyFp, TapsProvider,
+    },
     hal::cpu::SyncSlice,
+    INV_RATE,
+};
+
+use crate::{
+    stats::StepStatsRecorder, CircuitImpl, REGISTER_GROUP_ACCUM, REGISTER_GROUP_CODE,
+    REGISTER_GROUP_DATA,
 };
 
-use crate::CircuitImpl;
+/// Smallest po2 for which the native eval_check stages row tiles before
+/// evaluating them.  Below this the register groups mostly stay in cache
+/// anyway, and the staging copy is pure overhead.
+const EVAL_TILE_MIN_PO2: usize = 20;
+
+/// Fewest cycles each rayon job of the native eval_check evaluates.  A
+/// multiple of the lane count of every FpVec build.
+const EVAL_JOB_MIN_CYCLES: usize = 1024;
+
+/// Selects which build of the generated step functions runs.
+///
+/// The default build skips the register checks.  The checked build fails a
+/// step that reads an unset register or overwrites one with a different value,
+/// and names the register in the error, which helps to diagnose a misbehaving
+/// segment.  The setting applies to the whole process.
+pub fn set_checked_steps(checked: bool) {
+    unsafe { risc0_circuit_rv32im_set_checked(checked) }
+}
+
+/// Selects whether the generated step functions call the `log` externs.
+///
+/// Those report the progress of the circuit, such as the pc of each body
+/// cycle, and are only useful when tracing a misbehaving segment.  They are
+/// off by default, in which case the step functions skip them without packing
+/// their arguments or calling into the handler.  The setting applies to the
+/// whole process.
+pub fn set_log_externs(enabled: bool) {
+    unsafe { risc0_circuit_rv32im_set_log(enabled) }
+}
 
 impl CircuitStep<BabyBearElem> for CircuitImpl {
     fn step_compute_accum<S: CircuitStepHandler<BabyBearElem>>(
@@ -37,12 +83,13 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
         args: &[SyncSlice<BabyBearElem>],
     ) -> Result<BabyBearElem> {
         call_step(
+            "step_compute_accum",
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_rv32im_step_compute_accum(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
                 )
             },
         )
@@ -55,12 +102,13 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
         args: &[SyncSlice<BabyBearElem>],
     ) -> Result<BabyBearElem> {
         call_step(
+            "step_verify_accum",
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_rv32im_step_verify_accum(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
                 )
             },
         )
@@ -73,13 +121,12 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
         args: &[SyncSlice<BabyBearElem>],
     ) -> Result<BabyBearElem> {
         call_step(
+            "step_exec",
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
-                risc0_circuit_rv32im_step_exec(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
-                )
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
+                risc0_circuit_rv32im_step_exec(err, ctx, table, size, cycle, args_ptr, args_len)
             },
         )
     }
@@ -91,12 +138,13 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
         args: &[SyncSlice<BabyBearElem>],
     ) -> Result<BabyBearElem> {
         call_step(
+            "step_verify_bytes",
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_rv32im_step_verify_bytes(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
                 )
             },
         )
@@ -109,12 +157,118 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
         args: &[SyncSlice<BabyBearElem>],
     ) -> Result<BabyBearElem> {
         call_step(
+            "step_verify_mem",
             ctx,
             handler,
             args,
-            |err, ctx, trampoline, size, cycle, args_ptr, args_len| unsafe {
+            |err, ctx, table, size, cycle, args_ptr, args_len| unsafe {
                 risc0_circuit_rv32im_step_verify_mem(
-                    err, ctx, trampoline, size, cycle, args_ptr, args_len,
+                    err, ctx, table, size, cycle, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_compute_accum_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            "step_compute_accum",
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_rv32im_step_compute_accum_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_verify_accum_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            "step_verify_accum",
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_rv32im_step_verify_accum_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_exec_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            "step_exec",
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_rv32im_step_exec_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_verify_bytes_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            "step_verify_bytes",
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_rv32im_step_verify_bytes_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
+                )
+            },
+        )
+    }
+
+    fn step_verify_mem_range<S: CircuitStepHandler<BabyBearElem>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        handler: &mut S,
+        args: &[SyncSlice<BabyBearElem>],
+    ) -> Result<BabyBearElem> {
+        call_step_range(
+            "step_verify_mem",
+            size,
+            cycles,
+            handler,
+            args,
+            |err, ctx, table, size, begin, end, args_ptr, args_len| unsafe {
+                risc0_circuit_rv32im_step_verify_mem_range(
+                    err, ctx, table, size, begin, end, args_ptr, args_len,
                 )
             },
         )
@@ -122,21 +276,210 @@ impl CircuitStep<BabyBearElem> for CircuitImpl {
 }
 
 impl PolyFp<BabyBear> for CircuitImpl {
+    fn poly_mix_pows(&self, mix: &BabyBearExtElem) -> Vec<BabyBearExtElem> {
+        let mut pow = BabyBearExtElem::ONE;
+        (0..POLY_MIX_POWS)
+            .map(|_| {
+                let cur = pow;
+                pow *= *mix;
+                cur
+            })
+            .collect()
+    }
+
     fn poly_fp(
         &self,
         cycle: usize,
         steps: usize,
-        mix: &BabyBearExtElem,
+        mix_pows: &[BabyBearExtElem],
         args: &[&[BabyBearElem]],
     ) -> BabyBearExtElem {
+        assert!(mix_pows.len() >= POLY_MIX_POWS);
         let args: Vec<*const BabyBearElem> = args.iter().map(|x| (*x).as_ptr()).collect();
-        unsafe { risc0_circuit_rv32im_poly_fp(cycle, steps, mix, args.as_ptr()) }
+        unsafe { risc0_circuit_rv32im_poly_fp(cycle, steps, mix_pows.as_ptr(), args.as_ptr()) }
+    }
+
+    fn poly_fp_batch(
+        &self,
+        cycle: usize,
+        steps: usize,
+        mix_pows: &[BabyBearExtElem],
+        args: &[&[BabyBearElem]],
+        out: &mut [BabyBearExtElem],
+    ) {
+        assert!(mix_pows.len() >= POLY_MIX_POWS);
+        let args: Vec<*const BabyBearElem> = args.iter().map(|x| (*x).as_ptr()).collect();
+        unsafe {
+            risc0_circuit_rv32im_poly_fp_batch(
+                cycle,
+                out.len(),
+                steps,
+                mix_pows.as_ptr(),
+                args.as_ptr(),
+                out.as_mut_ptr(),
+            )
+        }
+    }
+
+    fn eval_check(
+        &self,
+        check: &mut [BabyBearElem],
+        args: &[&[BabyBearElem]],
+        mix_pows: &[BabyBearExtElem],
+        po2: usize,
+        steps: usize,
+    ) -> bool {
+        let backs = (po2 >= EVAL_TILE_MIN_PO2).then(|| self.group_backs());
+        self.eval_check_tiles(check, args, mix_pows, po2, steps, backs.as_ref())
+    }
+}
+
+impl CircuitImpl {
+    /// Runs the native eval_check, staging row tiles if `backs` (see
+    /// [Self::group_backs]) is given.
+    pub(crate) fn eval_check_tiles(
+        &self,
+        check: &mut [BabyBearElem],
+        args: &[&[BabyBearElem]],
+        mix_pows: &[BabyBearExtElem],
+        po2: usize,
+        steps: usize,
+        backs: Option<&[Vec<u32>; 3]>,
+    ) -> bool {
+        let [code, out, data, global_mix, accum] = args else {
+            return false;
+        };
+        let domain = INV_RATE * steps;
+        assert_eq!(check.len(), BabyBearExtElem::EXT_SIZE * domain);
+        assert!(mix_pows.len() >= POLY_MIX_POWS);
+        let jobs = (4 * rayon::current_num_threads()).next_power_of_two();
+        let cycles = cmp::max(EVAL_JOB_MIN_CYCLES, domain / jobs);
+
+        // SAFETY: Each job only writes its own cycles of `check`, so sharing
+        // it between the jobs and writing through it is safe.
+        let check = unsafe { std::slice::from_raw_parts(check.as_ptr(), check.len()) };
+        (0..domain)
+            .into_par_iter()
+            .step_by(cycles)
+            .for_each(|begin| {
+                let groups: Option<Vec<GroupBacks>> = backs.map(|backs| {
+                    backs
+                        .iter()
+                        .map(|back| GroupBacks {
+                            back: back.as_ptr(),
+                            cols: back.len(),
+                        })
+                        .collect()
+                });
+                unsafe {
+                    risc0_circuit_rv32im_eval_check(
+                        check.as_ptr() as *mut BabyBearElem,
+                        code.as_ptr(),
+                        data.as_ptr(),
+                        accum.as_ptr(),
+                        global_mix.as_ptr(),
+                        out.as_ptr(),
+                        mix_pows.as_ptr(),
+                        po2,
+                        steps,
+                        groups
+                            .as_ref()
+                            .map_or(std::ptr::null(), |groups| groups.as_ptr()),
+                        begin,
+                        cmp::min(begin + cycles, domain),
+                    )
+                }
+            });
+        true
+    }
+
+    /// For each column of the code, data and accum groups, the furthest back
+    /// any tap reads.
+    pub(crate) fn group_backs(&self) -> [Vec<u32>; 3] {
+        let taps = self.get_taps();
+        [
+            REGISTER_GROUP_CODE,
+            REGISTER_GROUP_DATA,
+            REGISTER_GROUP_ACCUM,
+        ]
+        .map(|group| {
+            let mut backs = vec![0; taps.group_size(group)];
+            for tap in taps.group_taps(group) {
+                let back = &mut backs[tap.offset()];
+                *back = (*back).max(tap.back() as u32);
+            }
+            backs
+        })
     }
 }
 
 impl CircuitProveDef<BabyBear> for CircuitImpl {}
 
+/// Forwards extern calls from a step function to a [CircuitStepHandler].
+struct StepBridge<'a, S> {
+    handler: &'a mut S,
+    last_err: Option<anyhow::Error>,
+    stats: Option<StepStatsRecorder>,
+}
+
+impl<'a, S> StepBridge<'a, S> {
+    fn check(&mut self, result: Result<()>) -> bool {
+        match result {
+            Ok(()) => true,
+            Err(err) => {
+                self.last_err = Some(err);
+                false
+            }
+        }
+    }
+}
+
+impl<'a, S: CircuitStepHandler<BabyBearElem>> HostBridge for StepBridge<'a, S> {
+    fn call(
+        &mut self,
+        cycle: usize,
+        name: &str,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> bool {
+        let Some(stats) = &mut self.stats else {
+            let result = self.handler.call(cycle, name, extra, args, outs);
+            return self.check(result);
+        };
+        let start = Instant::now();
+        let result = self.handler.call(cycle, name, extra, args, outs);
+        let id = ExternId::from_name(name).map_or(ExternId::COUNT as u32, |id| id as u32);
+        let extra_id = ExtraId::from_name(extra);
+        stats.record(start, id, extra_id.0, extra, args.len(), outs.len());
+        self.check(result)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: u32,
+        extra_id: u32,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> bool {
+        let start = self.stats.is_some().then(Instant::now);
+        let result = match ExternId::from_u32(id) {
+            Some(id) => self
+                .handler
+                .call_extern(cycle, id, ExtraId(extra_id), extra, args, outs),
+            None => Err(anyhow!("Unknown extern id: {id}")),
+        };
+        if let (Some(stats), Some(start)) = (&mut self.stats, start) {
+            stats.record(start, id, extra_id, extra, args.len(), outs.len());
+        }
+        self.check(result)
+    }
+}
+
 pub(crate) fn call_step<S, F>(
+    step: &'static str,
     ctx: &CircuitStepContext,
     handler: &mut S,
     args: &[SyncSlice<BabyBearElem>],
@@ -147,37 +490,105 @@ where
     F: FnOnce(
         *mut RawError,
         *mut c_void,
-        Callback,
+        *const HostTable,
         usize,
         usize,
         *const *mut BabyBearElem,
         usize,
     ) -> BabyBearElem,
 {
-    let mut last_err = None;
-    let mut call =
-        |name: &str, extra: &str, args: &[BabyBearElem], outs: &mut [BabyBearElem]| match handler
-            .call(ctx.cycle, name, extra, args, outs)
-        {
-            Ok(()) => true,
-            Err(err) => {
-                last_err = Some(err);
-                false
-            }
-        };
-    let trampoline = get_trampoline(&call);
+    call_bridge(
+        step,
+        1,
+        handler,
+        args,
+        |err, bridge, table, args_ptr, args_len| {
+            inner(err, bridge, table, ctx.size, ctx.cycle, args_ptr, args_len)
+        },
+    )
+}
+
+pub(crate) fn call_step_range<S, F>(
+    step: &'static str,
+    size: usize,
+    cycles: Range<usize>,
+    handler: &mut S,
+    args: &[SyncSlice<BabyBearElem>],
+    inner: F,
+) -> Result<BabyBearElem>
+where
+    S: CircuitStepHandler<BabyBearElem>,
+    F: FnOnce(
+        *mut RawError,
+        *mut c_void,
+        *const HostTable,
+        usize,
+        usize,
+        usize,
+        *const *mut BabyBearElem,
+        usize,
+    ) -> BabyBearElem,
+{
+    if cycles.is_empty() {
+        return Ok(BabyBearElem::ZERO);
+    }
+    let len = cycles.len();
+    call_bridge(
+        step,
+        len,
+        handler,
+        args,
+        |err, bridge, table, args_ptr, args_len| {
+            inner(
+                err,
+                bridge,
+                table,
+                size,
+                cycles.start,
+                cycles.end,
+                args_ptr,
+                args_len,
+            )
+        },
+    )
+}
+
+fn call_bridge<S, F>(
+    step: &'static str,
+    cycles: usize,
+    handler: &mut S,
+    args: &[SyncSlice<BabyBearElem>],
+    inner: F,
+) -> Result<BabyBearElem>
+where
+    S: CircuitStepHandler<BabyBearElem>,
+    F: FnOnce(
+        *mut RawError,
+        *mut c_void,
+        *const HostTable,
+        *const *mut BabyBearElem,
+        usize,
+    ) -> BabyBearElem,
+{
+    let mut bridge = StepBridge {
+        handler,
+        last_err: None,
+        stats: StepStatsRecorder::start(step, cycles),
+    };
+    let table = get_host_table(&bridge, S::TYPED_EXTERNS);
     let mut err = RawError::default();
     let args: Vec<*mut BabyBearElem> = args.iter().map(SyncSlice::get_ptr).collect();
     let result = inner(
         &mut err,
-        &mut call as *mut _ as *mut c_void,
-        trampoline,
-        ctx.size,
-        ctx.cycle,
+        &mut bridge as *mut _ as *mut c_void,
+        &table,
         args.as_ptr(),
         args.len(),
     );
-    if let Some(err) = last_err {
+    if let Some(stats) = bridge.stats {
+        stats.finish();
+    }
+    if let Some(err) = bridge.last_err {
         return Err(err);
     }
     if err.msg.is_null() {
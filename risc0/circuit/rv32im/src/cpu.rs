@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+use std::cmp;
+
 use rayon::prelude::*;
 use risc0_core::field::{
     baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem},
@@ -28,6 +30,9 @@ use crate::{
     GLOBAL_MIX, GLOBAL_OUT, REGISTER_GROUP_ACCUM, REGISTER_GROUP_CODE, REGISTER_GROUP_DATA,
 };
 
+/// Number of consecutive cycles handed to each `poly_fp_batch` call.
+const EVAL_CHUNK_SIZE: usize = 64;
+
 pub struct CpuCircuitHal<'a, C: PolyFp<BabyBear>> {
     circuit: &'a C,
 }
@@ -80,21 +85,42 @@ where
 
         let args: &[&[BabyBearElem]] = &[code, out, data, mix, accum];
 
-        (0..domain).into_par_iter().for_each(|cycle| {
-            let tot = self.circuit.poly_fp(cycle, domain, &poly_mix, args);
-            let x = BabyBearElem::ROU_FWD[po2 + EXP_PO2].pow(cycle);
-            // TODO: what is this magic number 3?
-            let y = (BabyBearElem::new(3) * x).pow(1 << po2);
-            let ret = tot * (y - BabyBearElem::new(1)).inv();
-
-            // SAFETY: This conversion is to make the check slice mutable, which should be
-            // safe because each thread access will not overlap with each other.
+        let mix_pows = self.circuit.poly_mix_pows(&poly_mix);
+        {
+            // SAFETY: This conversion is to make the check slice mutable, which
+            // should be safe because nothing else reads it during the call.
             let check = unsafe {
                 std::slice::from_raw_parts_mut(check.as_ptr() as *mut BabyBearElem, check.len())
             };
-            for i in 0..BabyBearExtElem::EXT_SIZE {
-                check[i * domain + cycle] = ret.elems()[i];
+            if self.circuit.eval_check(check, args, &mix_pows, po2, steps) {
+                return;
             }
-        });
+        }
+
+        (0..domain)
+            .into_par_iter()
+            .step_by(EVAL_CHUNK_SIZE)
+            .for_each(|start| {
+                let end = cmp::min(start + EVAL_CHUNK_SIZE, domain);
+                let mut tots = [BabyBearExtElem::ZERO; EVAL_CHUNK_SIZE];
+                let tots = &mut tots[..end - start];
+                self.circuit
+                    .poly_fp_batch(start, domain, &mix_pows, args, tots);
+
+                // SAFETY: This conversion is to make the check slice mutable, which should be
+                // safe because each thread access will not overlap with each other.
+                let check = unsafe {
+                    std::slice::from_raw_parts_mut(check.as_ptr() as *mut BabyBearElem, check.len())
+                };
+                for (cycle, tot) in (start..end).zip(tots.iter()) {
+                    let x = BabyBearElem::ROU_FWD[po2 + EXP_PO2].pow(cycle);
+                    // TODO: what is this magic number 3?
+                    let y = (BabyBearElem::new(3) * x).pow(1 << po2);
+                    let ret = *tot * (y - BabyBearElem::new(1)).inv();
+                    for i in 0..BabyBearExtElem::EXT_SIZE {
+                        check[i * domain + cycle] = ret.elems()[i];
+                    }
+                }
+            });
     }
 }
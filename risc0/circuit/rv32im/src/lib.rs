@@ -26,13 +26,19 @@ pub mod layout;
 #[cfg(feature = "metal")]
 pub mod metal;
 pub mod poly_ext;
+#[cfg(feature = "prove")]
+mod stats;
 mod taps;
 
+#[cfg(feature = "prove")]
+pub use cpp::{set_checked_steps, set_log_externs};
 use risc0_zkp::{
     adapter::{CircuitCoreDef, TapsProvider},
     field::baby_bear::BabyBear,
     taps::TapSet,
 };
+#[cfg(feature = "prove")]
+pub use stats::{set_extern_stats, take_extern_stats, ExternStat, ExternStats, StepStats};
 
 pub struct CircuitImpl;
 
@@ -101,6 +107,114 @@ mod tests {
             .step_exec(&ctx, &mut custom, args.as_slice())
             .unwrap();
     }
+
+    #[cfg(feature = "prove")]
+    #[test]
+    fn poly_fp_batch() {
+        use risc0_core::field::baby_bear::BabyBearExtElem;
+        use risc0_zkp::adapter::PolyFp;
+
+        use crate::testutil::EvalCheckParams;
+
+        let circuit = CircuitImpl::new();
+        let params = EvalCheckParams::new(4);
+        let args: &[&[BabyBearElem]] = &[
+            &params.code,
+            &params.out,
+            &params.data,
+            &params.mix,
+            &params.accum,
+        ];
+        // Deliberately not a multiple of the lane count, so the tail is covered too.
+        let count = params.domain - 3;
+        let mix_pows = circuit.poly_mix_pows(&params.poly_mix);
+        let mut batch = vec![BabyBearExtElem::default(); count];
+        circuit.poly_fp_batch(0, params.domain, &mix_pows, args, &mut batch);
+        for (cycle, tot) in batch.iter().enumerate() {
+            assert_eq!(
+                *tot,
+                circuit.poly_fp(cycle, params.domain, &mix_pows, args),
+                "cycle {cycle}"
+            );
+        }
+    }
+
+    #[cfg(feature = "prove")]
+    #[test]
+    fn eval_check_native() {
+        use risc0_core::field::{baby_bear::BabyBearExtElem, Elem, ExtElem, RootsOfUnity};
+        use risc0_zkp::adapter::PolyFp;
+
+        use crate::testutil::EvalCheckParams;
+
+        let circuit = CircuitImpl::new();
+        let params = EvalCheckParams::new(4);
+        let args: &[&[BabyBearElem]] = &[
+            &params.code,
+            &params.out,
+            &params.data,
+            &params.mix,
+            &params.accum,
+        ];
+        let mut check = vec![BabyBearElem::ZERO; BabyBearExtElem::EXT_SIZE * params.domain];
+        let mix_pows = circuit.poly_mix_pows(&params.poly_mix);
+        assert!(circuit.eval_check(&mut check, args, &mix_pows, params.po2, params.steps));
+        for cycle in 0..params.domain {
+            let x = BabyBearElem::ROU_FWD[params.po2 + 2].pow(cycle);
+            let y = (BabyBearElem::new(3) * x).pow(params.steps);
+            let tot = circuit.poly_fp(cycle, params.domain, &mix_pows, args);
+            let ret = tot * (y - BabyBearElem::ONE).inv();
+            for i in 0..BabyBearExtElem::EXT_SIZE {
+                assert_eq!(
+                    check[i * params.domain + cycle],
+                    ret.elems()[i],
+                    "cycle {cycle}"
+                );
+            }
+        }
+    }
+
+    #[cfg(feature = "prove")]
+    #[test]
+    fn eval_check_tiled() {
+        use risc0_core::field::{baby_bear::BabyBearExtElem, Elem, ExtElem};
+        use risc0_zkp::adapter::PolyFp;
+
+        use crate::testutil::EvalCheckParams;
+
+        // Large enough for several tiles, well below the po2 that tiles by
+        // default.
+        let circuit = CircuitImpl::new();
+        let params = EvalCheckParams::new(10);
+        let args: &[&[BabyBearElem]] = &[
+            &params.code,
+            &params.out,
+            &params.data,
+            &params.mix,
+            &params.accum,
+        ];
+        let mix_pows = circuit.poly_mix_pows(&params.poly_mix);
+        let backs = circuit.group_backs();
+        let mut tiled = vec![BabyBearElem::ZERO; BabyBearExtElem::EXT_SIZE * params.domain];
+        let mut untiled = tiled.clone();
+        assert!(circuit.eval_check_tiles(
+            &mut tiled,
+            args,
+            &mix_pows,
+            params.po2,
+            params.steps,
+            Some(&backs)
+        ));
+        assert!(circuit.eval_check_tiles(
+            &mut untiled,
+            args,
+            &mix_pows,
+            params.po2,
+            params.steps,
+            None
+        ));
+        assert_eq!(tiled, untiled);
+    }
 }
 
 #[cfg(feature = "prove")]
@@ -0,0 +1,355 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! Opt-in statistics on the externs the generated step functions call.
+
+use std::{
+    collections::{BTreeMap, HashMap},
+    sync::{
+        atomic::{AtomicBool, Ordering},
+        Mutex,
+    },
+    time::Instant,
+};
+
+use risc0_zkp::adapter::ExternId;
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+
+static COLLECTED: Mutex<Collected> = Mutex::new(Collected {
+    steps: BTreeMap::new(),
+    externs: BTreeMap::new(),
+});
+
+/// Turns the collection of extern statistics on or off.
+///
+/// While on, every call into a step function records how long it took, and
+/// every extern it calls records its count, time and argument sizes, until
+/// they are taken with [take_extern_stats].  The setting and the totals apply
+/// to the whole process: nothing else takes them, so the statistics of proofs
+/// running at the same time are summed together.
+pub fn set_extern_stats(enabled: bool) {
+    ENABLED.store(enabled, Ordering::Relaxed);
+}
+
+/// Returns the statistics collected since the last call, and resets them.
+///
+/// Call [ExternStats::report] on the result to log them.
+pub fn take_extern_stats() -> ExternStats {
+    let collected = core::mem::take(&mut *COLLECTED.lock().unwrap());
+    ExternStats {
+        steps: collected
+            .steps
+            .into_iter()
+            .map(|(step, stat)| StepStats {
+                step,
+                cycles: stat.cycles,
+                nanos: stat.nanos,
+                extern_nanos: stat.extern_nanos,
+            })
+            .collect(),
+        externs: collected
+            .externs
+            .into_iter()
+            .map(|((step, id, _), stat)| ExternStat {
+                step,
+                name: ExternId::from_u32(id).map_or("unknown", ExternId::name),
+                extra: stat.extra,
+                calls: stat.calls,
+                nanos: stat.nanos,
+                args: stat.args,
+                outs: stat.outs,
+            })
+            .collect(),
+    }
+}
+
+/// Extern statistics collected while [set_extern_stats] was on.
+#[derive(Clone, Debug, Default)]
+pub struct ExternStats {
+    /// Totals for each step function.
+    pub steps: Vec<StepStats>,
+
+    /// Totals for each (name, extra) pair of externs called by each step
+    /// function.
+    pub externs: Vec<ExternStat>,
+}
+
+/// Totals for one step function.
+#[derive(Clone, Debug)]
+pub struct StepStats {
+    /// Name of the step function, like `step_exec`.
+    pub step: &'static str,
+
+    /// Number of cycles run.
+    pub cycles: u64,
+
+    /// Time spent in the step function, including its externs.
+    pub nanos: u64,
+
+    /// Part of `nanos` spent in externs.
+    pub extern_nanos: u64,
+}
+
+/// Totals for one kind of extern called by one step function.
+#[derive(Clone, Debug)]
+pub struct ExternStat {
+    /// Name of the step function, like `step_exec`.
+    pub step: &'static str,
+
+    /// Name of the extern, like `ramRead`.
+    pub name: &'static str,
+
+    /// The `extra` argument, like the plonk kind or the log format.
+    pub extra: String,
+
+    /// Number of calls.
+    pub calls: u64,
+
+    /// Time spent handling the calls.
+    pub nanos: u64,
+
+    /// Total number of arguments passed.
+    pub args: u64,
+
+    /// Total number of outputs returned.
+    pub outs: u64,
+}
+
+impl ExternStats {
+    /// Reports the statistics as `tracing` events, slowest externs first.
+    pub fn report(&self) {
+        for step in self.steps.iter() {
+            tracing::info!(
+                step = step.step,
+                cycles = step.cycles,
+                nanos = step.nanos,
+                extern_nanos = step.extern_nanos,
+                "step stats"
+            );
+        }
+        let mut externs: Vec<_> = self.externs.iter().collect();
+        externs.sort_by(|lhs, rhs| rhs.nanos.cmp(&lhs.nanos));
+        for stat in externs {
+            tracing::info!(
+                step = stat.step,
+                name = stat.name,
+                extra = stat.extra.as_str(),
+                calls = stat.calls,
+                nanos = stat.nanos,
+                args = stat.args,
+                outs = stat.outs,
+                "extern stats"
+            );
+        }
+    }
+}
+
+#[derive(Default)]
+struct Collected {
+    steps: BTreeMap<&'static str, StepTotals>,
+    // Keyed by step function, extern id and extra id.
+    externs: BTreeMap<(&'static str, u32, u32), ExternTotals>,
+}
+
+#[derive(Default)]
+struct StepTotals {
+    cycles: u64,
+    nanos: u64,
+    extern_nanos: u64,
+}
+
+#[derive(Default)]
+struct ExternTotals {
+    extra: String,
+    calls: u64,
+    nanos: u64,
+    args: u64,
+    outs: u64,
+}
+
+/// Statistics of one call into a step function, merged into the process-wide
+/// totals when it returns.
+pub(crate) struct StepStatsRecorder {
+    step: &'static str,
+    cycles: u64,
+    start: Instant,
+    extern_nanos: u64,
+    // Keyed by extern id and extra id.
+    externs: HashMap<(u32, u32), ExternTotals>,
+}
+
+impl StepStatsRecorder {
+    /// Starts recording a call running `cycles` cycles of `step`, if
+    /// statistics are on.
+    pub(crate) fn start(step: &'static str, cycles: usize) -> Option<Self> {
+        ENABLED.load(Ordering::Relaxed).then(|| Self {
+            step,
+            cycles: cycles as u64,
+            start: Instant::now(),
+            extern_nanos: 0,
+            externs: HashMap::new(),
+        })
+    }
+
+    /// Records an extern call that started at `start`.  Externs dispatched by
+    /// name that aren't known have an id of [ExternId::COUNT].
+    pub(crate) fn record(
+        &mut self,
+        start: Instant,
+        id: u32,
+        extra_id: u32,
+        extra: &str,
+        args: usize,
+        outs: usize,
+    ) {
+        let nanos = start.elapsed().as_nanos() as u64;
+        self.extern_nanos += nanos;
+        let totals = self
+            .externs
+            .entry((id, extra_id))
+            .or_insert_with(|| ExternTotals {
+                extra: extra.to_string(),
+                ..Default::default()
+            });
+        totals.calls += 1;
+        totals.nanos += nanos;
+        totals.args += args as u64;
+        totals.outs += outs as u64;
+    }
+
+    /// Merges this call into the process-wide totals.
+    pub(crate) fn finish(self) {
+        let nanos = self.start.elapsed().as_nanos() as u64;
+        let mut collected = COLLECTED.lock().unwrap();
+        let step = collected.steps.entry(self.step).or_default();
+        step.cycles += self.cycles;
+        step.nanos += nanos;
+        step.extern_nanos += self.extern_nanos;
+        for ((id, extra_id), stat) in self.externs {
+            let totals = collected
+                .externs
+                .entry((self.step, id, extra_id))
+                .or_insert_with(|| ExternTotals {
+                    extra: stat.extra,
+                    ..Default::default()
+                });
+            totals.calls += stat.calls;
+            totals.nanos += stat.nanos;
+            totals.args += stat.args;
+            totals.outs += stat.outs;
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use anyhow::Result;
+    use risc0_core::field::{baby_bear::BabyBearElem, Elem};
+    use risc0_zkp::{
+        adapter::{CircuitInfo, CircuitStep, CircuitStepHandler, ExternId, ExtraId, TapsProvider},
+        hal::cpu::CpuBuffer,
+    };
+
+    use super::{set_extern_stats, take_extern_stats};
+    use crate::{CircuitImpl, REGISTER_GROUP_ACCUM, REGISTER_GROUP_CODE, REGISTER_GROUP_DATA};
+
+    #[derive(Default)]
+    struct CountingHandler {
+        calls: u64,
+    }
+
+    impl CircuitStepHandler<BabyBearElem> for CountingHandler {
+        fn call(
+            &mut self,
+            _cycle: usize,
+            name: &str,
+            _extra: &str,
+            _args: &[BabyBearElem],
+            _outs: &mut [BabyBearElem],
+        ) -> Result<()> {
+            unimplemented!("{name}")
+        }
+
+        fn call_extern(
+            &mut self,
+            _cycle: usize,
+            id: ExternId,
+            extra_id: ExtraId,
+            _extra: &str,
+            _args: &[BabyBearElem],
+            _outs: &mut [BabyBearElem],
+        ) -> Result<()> {
+            assert_eq!(id, ExternId::PlonkWriteAccum);
+            assert_eq!(extra_id, ExtraId::BYTES);
+            self.calls += 1;
+            Ok(())
+        }
+
+        fn sort(&mut self, _name: &str) {
+            unimplemented!()
+        }
+    }
+
+    #[test]
+    fn step_range_stats() {
+        const STEPS: usize = 16;
+        let circuit = CircuitImpl::new();
+        let taps = circuit.get_taps();
+        let zeros = |size| CpuBuffer::from_fn(size, |_| BabyBearElem::ZERO);
+        // Every cycle is a bytes setup cycle, which writes accum plonk rows.
+        let code = CpuBuffer::from_fn(taps.group_size(REGISTER_GROUP_CODE) * STEPS, |i| {
+            if i / STEPS == 2 {
+                BabyBearElem::ONE
+            } else {
+                BabyBearElem::ZERO
+            }
+        });
+        let out = zeros(CircuitImpl::OUTPUT_SIZE);
+        let data = zeros(taps.group_size(REGISTER_GROUP_DATA) * STEPS);
+        let mix = zeros(CircuitImpl::MIX_SIZE);
+        let accum = zeros(taps.group_size(REGISTER_GROUP_ACCUM) * STEPS);
+        let args = [&code, &out, &data, &mix, &accum].map(CpuBuffer::as_slice_sync);
+
+        let mut handler = CountingHandler::default();
+        set_extern_stats(true);
+        circuit
+            .step_compute_accum_range(STEPS, 4..12, &mut handler, &args)
+            .unwrap();
+        set_extern_stats(false);
+        let stats = take_extern_stats();
+        assert_eq!(handler.calls, 8);
+
+        let step = stats
+            .steps
+            .iter()
+            .find(|step| step.step == "step_compute_accum")
+            .unwrap();
+        assert_eq!(step.cycles, 8);
+        assert!(step.extern_nanos <= step.nanos);
+
+        let externs: Vec<_> = stats
+            .externs
+            .iter()
+            .filter(|stat| stat.step == "step_compute_accum")
+            .collect();
+        assert_eq!(externs.len(), 1);
+        let stat = externs[0];
+        assert_eq!(stat.name, ExternId::PlonkWriteAccum.name());
+        assert_eq!(stat.extra, "bytes");
+        assert_eq!(stat.calls, handler.calls);
+        assert_eq!(stat.args, 4 * handler.calls);
+        assert_eq!(stat.outs, 0);
+    }
+}
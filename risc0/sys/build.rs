@@ -12,11 +12,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use std::{env, path::Path};
+use std::{
+    env,
+    path::{Path, PathBuf},
+};
 
 use risc0_build_kernel::{KernelBuild, KernelType};
 
 fn main() {
+    // The field headers of the C++ CPU kernels, shared with the circuit crates
+    // as `DEP_RISC0_SYS_INCLUDE`.
+    let cpu_include =
+        PathBuf::from(env::var("CARGO_MANIFEST_DIR").unwrap()).join("kernels/zkp/cpu");
+    println!("cargo:include={}", cpu_include.display());
+
+    if env::var("CARGO_FEATURE_CPU").is_ok() {
+        build_cpu_kernels();
+    }
+
     if env::var("CARGO_FEATURE_CUDA").is_ok() {
         build_cuda_kernels();
     }
@@ -26,6 +39,18 @@ fn main() {
     }
 }
 
+fn build_cpu_kernels() {
+    let dir = Path::new("kernels/zkp/cpu");
+    KernelBuild::new(KernelType::Cpp)
+        .files(
+            ["ntt.cpp", "poseidon2.cpp", "sha256.cpp"]
+                .iter()
+                .map(|x| dir.join(x)),
+        )
+        .deps(["fp.h", "fp4.h", "fpvec.h"].iter().map(|x| dir.join(x)))
+        .compile("cpu_kernels_zkp");
+}
+
 fn build_cuda_kernels() {
     const CUDA_KERNELS: &[(&str, &str, &[&str])] = &[(
         "zkp",
@@ -66,9 +66,8 @@ private:
     return (r > P ? r + P : r);
   }
 
-  // Multiply two numbers
-  static constexpr inline uint32_t mul(uint32_t a, uint32_t b) {
-    uint64_t o64 = uint64_t(a) * uint64_t(b);
+  // Montgomery reduce a 64 bit number, which must be less than P * 2^32
+  static constexpr inline uint32_t reduce(uint64_t o64) {
     uint32_t low = -uint32_t(o64);
     uint32_t red = M * low;
     o64 += uint64_t(red) * uint64_t(P);
@@ -76,6 +75,11 @@ private:
     return (ret >= P ? ret - P : ret);
   }
 
+  // Multiply two numbers
+  static constexpr inline uint32_t mul(uint32_t a, uint32_t b) {
+    return reduce(uint64_t(a) * uint64_t(b));
+  }
+
   // Encode / Decode
   static constexpr inline uint32_t encode(uint32_t a) { return mul(R2, a); }
   static constexpr inline uint32_t decode(uint32_t a) { return mul(1, a); }
@@ -96,6 +100,20 @@ public:
   /// Return the underlying value
   constexpr inline uint32_t asRaw() const { return val; }
 
+  /// Construct an Fp directly from its underlying value, as returned by asRaw()
+  static constexpr inline Fp fromRaw(uint32_t val) { return Fp(val, true); }
+
+  /// Multiply two numbers without reducing the result.  Up to four of these products may be summed
+  /// before the total is passed to reduceWide, which lets a sum of products pay for one reduction.
+  static constexpr inline uint64_t mulWide(Fp a, Fp b) { return uint64_t(a.val) * uint64_t(b.val); }
+
+  /// Reduce a sum of at most four mulWide products.
+  static constexpr inline Fp reduceWide(uint64_t o64) {
+    // 4 * P^2 < 2 * (P << 32), so one subtraction brings the sum into range for reduce.
+    constexpr uint64_t kShiftedP = uint64_t(P) << 32;
+    return Fp(reduce(o64 >= kShiftedP ? o64 - kShiftedP : o64), true);
+  }
+
   /// Get the largest value, basically P - 1.
   static constexpr inline Fp maxVal() { return P - 1; }
 
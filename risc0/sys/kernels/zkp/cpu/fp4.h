@@ -116,16 +116,25 @@ struct Fp4 {
   // representations, and then reduce module x^4 - B, which means powers >= 4 get shifted back 4 and
   // multiplied by -beta.  We could write this as a double loops with some if's and hope it gets
   // unrolled properly, but it'a small enough to just hand write.
+  //
+  // Each output coefficient is a sum of four products, so rather than reducing every product (and
+  // then the beta multiplies), we fold -beta into the high elements of rhs up front and reduce each
+  // sum of unreduced products once.
   constexpr Fp4 operator*(Fp4 rhs) const {
     // Rename the element arrays to something small for readability
 #define a elems
 #define b rhs.elems
-    return Fp4(a[0] * b[0] + NBETA * (a[1] * b[3] + a[2] * b[2] + a[3] * b[1]),
-               a[0] * b[1] + a[1] * b[0] + NBETA * (a[2] * b[3] + a[3] * b[2]),
-               a[0] * b[2] + a[1] * b[1] + a[2] * b[0] + NBETA * (a[3] * b[3]),
-               a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0]);
+#define m Fp::mulWide
+    Fp nb1 = NBETA * b[1];
+    Fp nb2 = NBETA * b[2];
+    Fp nb3 = NBETA * b[3];
+    return Fp4(Fp::reduceWide(m(a[0], b[0]) + m(a[1], nb3) + m(a[2], nb2) + m(a[3], nb1)),
+               Fp::reduceWide(m(a[0], b[1]) + m(a[1], b[0]) + m(a[2], nb3) + m(a[3], nb2)),
+               Fp::reduceWide(m(a[0], b[2]) + m(a[1], b[1]) + m(a[2], b[0]) + m(a[3], nb3)),
+               Fp::reduceWide(m(a[0], b[3]) + m(a[1], b[2]) + m(a[2], b[1]) + m(a[3], b[0])));
 #undef a
 #undef b
+#undef m
   }
   constexpr Fp4 operator*=(Fp4 rhs) {
     *this = *this * rhs;
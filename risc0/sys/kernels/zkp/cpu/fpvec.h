@@ -0,0 +1,483 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/// \file
+/// Defines FpVec and Fp4Vec, which hold N independent lanes of Fp and Fp4 and apply every
+/// operation to all lanes at once.
+///
+/// They are bit-exact with the scalar types: each lane of a result is exactly what Fp or Fp4 would
+/// produce for that lane's inputs.  The generic versions are plain loops over Fp, which the
+/// compiler is free to auto-vectorize.  When built with AVX2 (or AVX-512F) enabled, 8 (or 16) lane
+/// vectors instead use hand written Montgomery kernels.
+
+#include "fp.h"
+#include "fp4.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+// GCC 12's avx512fintrin.h reads _mm512_undefined_epi32() values, which warns as uninitialized
+// wherever the intrinsics are inlined.  The warnings point into the header, so silence them there.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+namespace risc0 {
+
+static_assert(sizeof(Fp) == sizeof(uint32_t), "FpVec loads and stores Fp as raw words");
+
+/// The natural number of lanes for the target.  Without vector kernels this is kept narrow, since
+/// the generic loops are costly to compile in the large generated functions.
+#if defined(__AVX512F__)
+constexpr size_t kFpVecLanes = 16;
+#elif defined(__AVX2__)
+constexpr size_t kFpVecLanes = 8;
+#else
+constexpr size_t kFpVecLanes = 4;
+#endif
+
+namespace detail {
+
+/// Lane storage and arithmetic for FpVec.  This is specialized below for the widths that the target
+/// has vector instructions for.
+template <size_t N> struct FpLanes {
+  Fp v[N];
+
+  static inline FpLanes broadcast(Fp x) {
+    FpLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = x;
+    }
+    return r;
+  }
+
+  static inline FpLanes load(const Fp* ptr) {
+    FpLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = ptr[i];
+    }
+    return r;
+  }
+
+  inline void store(Fp* ptr) const {
+    for (size_t i = 0; i < N; i++) {
+      ptr[i] = v[i];
+    }
+  }
+
+  inline Fp get(size_t i) const { return v[i]; }
+
+  inline void set(size_t i, Fp x) { v[i] = x; }
+
+  static inline FpLanes add(const FpLanes& a, const FpLanes& b) {
+    FpLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = a.v[i] + b.v[i];
+    }
+    return r;
+  }
+
+  static inline FpLanes sub(const FpLanes& a, const FpLanes& b) {
+    FpLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = a.v[i] - b.v[i];
+    }
+    return r;
+  }
+
+  static inline FpLanes mul(const FpLanes& a, const FpLanes& b) {
+    FpLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = a.v[i] * b.v[i];
+    }
+    return r;
+  }
+};
+
+// The vector kernels below follow Fp::add, Fp::sub and Fp::mul step for step (including their
+// wrapping behaviour on out of range inputs), so that every lane matches the scalar result.
+//
+// The conditional subtraction `r >= P ? r - P : r` is computed as `min(r, r - P)`: when r < P the
+// subtraction wraps to a value larger than r.
+
+#if defined(__AVX2__)
+
+template <> struct FpLanes<8> {
+  __m256i v;
+
+  static inline FpLanes make(__m256i x) { return FpLanes{x}; }
+
+  static inline FpLanes broadcast(Fp x) { return make(_mm256_set1_epi32(x.asRaw())); }
+
+  static inline FpLanes load(const Fp* ptr) {
+    return make(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+  }
+
+  inline void store(Fp* ptr) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v); }
+
+  inline Fp get(size_t i) const {
+    alignas(32) uint32_t raw[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(raw), v);
+    return Fp::fromRaw(raw[i]);
+  }
+
+  inline void set(size_t i, Fp x) {
+    alignas(32) uint32_t raw[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(raw), v);
+    raw[i] = x.asRaw();
+    v = _mm256_load_si256(reinterpret_cast<const __m256i*>(raw));
+  }
+
+  static inline FpLanes add(const FpLanes& a, const FpLanes& b) {
+    __m256i p = _mm256_set1_epi32(Fp::P);
+    __m256i r = _mm256_add_epi32(a.v, b.v);
+    return make(_mm256_min_epu32(r, _mm256_sub_epi32(r, p)));
+  }
+
+  static inline FpLanes sub(const FpLanes& a, const FpLanes& b) {
+    __m256i p = _mm256_set1_epi32(Fp::P);
+    __m256i r = _mm256_sub_epi32(a.v, b.v);
+    // r > P exactly when max(r, P + 1) == r
+    __m256i wrapped = _mm256_cmpeq_epi32(_mm256_max_epu32(r, _mm256_set1_epi32(Fp::P + 1)), r);
+    return make(_mm256_add_epi32(r, _mm256_and_si256(wrapped, p)));
+  }
+
+  static inline FpLanes mul(const FpLanes& a, const FpLanes& b) {
+    __m256i p = _mm256_set1_epi32(Fp::P);
+    // 64-bit products of the even and odd lanes
+    __m256i even = reduce(_mm256_mul_epu32(a.v, b.v));
+    __m256i odd = reduce(_mm256_mul_epu32(_mm256_srli_epi64(a.v, 32), _mm256_srli_epi64(b.v, 32)));
+    // The results are the high words of each 64-bit lane
+    __m256i r = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa);
+    return make(_mm256_min_epu32(r, _mm256_sub_epi32(r, p)));
+  }
+
+private:
+  // Montgomery reduction of each 64-bit lane: o + (M * -o mod 2^32) * P
+  static inline __m256i reduce(__m256i o) {
+    __m256i low = _mm256_sub_epi32(_mm256_setzero_si256(), o);
+    __m256i red = _mm256_mullo_epi32(low, _mm256_set1_epi32(Fp::M));
+    return _mm256_add_epi64(o, _mm256_mul_epu32(red, _mm256_set1_epi32(Fp::P)));
+  }
+};
+
+#endif // __AVX2__
+
+#if defined(__AVX512F__)
+
+template <> struct FpLanes<16> {
+  __m512i v;
+
+  static inline FpLanes make(__m512i x) { return FpLanes{x}; }
+
+  static inline FpLanes broadcast(Fp x) { return make(_mm512_set1_epi32(x.asRaw())); }
+
+  static inline FpLanes load(const Fp* ptr) { return make(_mm512_loadu_si512(ptr)); }
+
+  inline void store(Fp* ptr) const { _mm512_storeu_si512(ptr, v); }
+
+  inline Fp get(size_t i) const {
+    alignas(64) uint32_t raw[16];
+    _mm512_store_si512(raw, v);
+    return Fp::fromRaw(raw[i]);
+  }
+
+  inline void set(size_t i, Fp x) {
+    v = _mm512_mask_set1_epi32(v, __mmask16(1u << i), x.asRaw());
+  }
+
+  static inline FpLanes add(const FpLanes& a, const FpLanes& b) {
+    __m512i r = _mm512_add_epi32(a.v, b.v);
+    return make(_mm512_min_epu32(r, _mm512_sub_epi32(r, _mm512_set1_epi32(Fp::P))));
+  }
+
+  static inline FpLanes sub(const FpLanes& a, const FpLanes& b) {
+    __m512i p = _mm512_set1_epi32(Fp::P);
+    __m512i r = _mm512_sub_epi32(a.v, b.v);
+    return make(_mm512_mask_add_epi32(r, _mm512_cmpgt_epu32_mask(r, p), r, p));
+  }
+
+  static inline FpLanes mul(const FpLanes& a, const FpLanes& b) {
+    // 64-bit products of the even and odd lanes
+    __m512i even = reduce(_mm512_mul_epu32(a.v, b.v));
+    __m512i odd = reduce(_mm512_mul_epu32(_mm512_srli_epi64(a.v, 32), _mm512_srli_epi64(b.v, 32)));
+    // The results are the high words of each 64-bit lane
+    __m512i r = _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(even, 32), odd);
+    return make(_mm512_min_epu32(r, _mm512_sub_epi32(r, _mm512_set1_epi32(Fp::P))));
+  }
+
+private:
+  // Montgomery reduction of each 64-bit lane: o + (M * -o mod 2^32) * P
+  static inline __m512i reduce(__m512i o) {
+    __m512i low = _mm512_sub_epi32(_mm512_setzero_si512(), o);
+    __m512i red = _mm512_mullo_epi32(low, _mm512_set1_epi32(Fp::M));
+    return _mm512_add_epi64(o, _mm512_mul_epu32(red, _mm512_set1_epi32(Fp::P)));
+  }
+};
+
+#endif // __AVX512F__
+
+} // namespace detail
+
+/// N lanes of Fp.
+template <size_t N> class FpVec {
+  detail::FpLanes<N> lanes;
+
+  inline FpVec(detail::FpLanes<N> lanes, bool /*ignore*/) : lanes(lanes) {}
+
+public:
+  static constexpr size_t kLanes = N;
+
+  /// Default constructor, sets every lane to 0.
+  inline FpVec() : lanes(detail::FpLanes<N>::broadcast(Fp())) {}
+
+  /// Set every lane to x.
+  inline FpVec(Fp x) : lanes(detail::FpLanes<N>::broadcast(x)) {}
+
+  /// Load N consecutive elements.
+  static inline FpVec load(const Fp* ptr) { return FpVec(detail::FpLanes<N>::load(ptr), true); }
+
+  /// Load N consecutive rows of a column, starting at `row` and wrapping around after `mask`.
+  static inline FpVec loadRows(const Fp* col, size_t row, size_t mask) {
+    if (row + N - 1 <= mask) {
+      return load(col + row);
+    }
+    FpVec result;
+    for (size_t i = 0; i < N; i++) {
+      result.set(i, col[(row + i) & mask]);
+    }
+    return result;
+  }
+
+  /// Store N consecutive elements.
+  inline void store(Fp* ptr) const { lanes.store(ptr); }
+
+  /// Get the value of lane i.
+  inline Fp get(size_t i) const { return lanes.get(i); }
+
+  /// Set the value of lane i.
+  inline void set(size_t i, Fp x) { lanes.set(i, x); }
+
+  inline FpVec operator+(FpVec rhs) const {
+    return FpVec(detail::FpLanes<N>::add(lanes, rhs.lanes), true);
+  }
+
+  inline FpVec operator-() const { return FpVec() - *this; }
+
+  inline FpVec operator-(FpVec rhs) const {
+    return FpVec(detail::FpLanes<N>::sub(lanes, rhs.lanes), true);
+  }
+
+  inline FpVec operator*(FpVec rhs) const {
+    return FpVec(detail::FpLanes<N>::mul(lanes, rhs.lanes), true);
+  }
+
+  inline FpVec operator+=(FpVec rhs) {
+    *this = *this + rhs;
+    return *this;
+  }
+
+  inline FpVec operator-=(FpVec rhs) {
+    *this = *this - rhs;
+    return *this;
+  }
+
+  inline FpVec operator*=(FpVec rhs) {
+    *this = *this * rhs;
+    return *this;
+  }
+
+  /// True if every lane is equal.
+  inline bool operator==(FpVec rhs) const {
+    for (size_t i = 0; i < N; i++) {
+      if (get(i) != rhs.get(i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  inline bool operator!=(FpVec rhs) const { return !(*this == rhs); }
+};
+
+/// Overloads for the case where the LHS is a scalar Fp, which is applied to every lane.
+template <size_t N> inline FpVec<N> operator+(Fp a, FpVec<N> b) {
+  return FpVec<N>(a) + b;
+}
+
+template <size_t N> inline FpVec<N> operator-(Fp a, FpVec<N> b) {
+  return FpVec<N>(a) - b;
+}
+
+template <size_t N> inline FpVec<N> operator*(Fp a, FpVec<N> b) {
+  return FpVec<N>(a) * b;
+}
+
+/// N lanes of Fp4, stored as one FpVec per coefficient.
+template <size_t N> struct Fp4Vec {
+  /// The coefficients, see Fp4::elems
+  FpVec<N> elems[4];
+
+  /// Default constructor, sets every lane to 0.
+  inline Fp4Vec() {}
+
+  /// Convert from FpVec to Fp4Vec.
+  explicit inline Fp4Vec(FpVec<N> x) { elems[0] = x; }
+
+  /// Set every lane to x.
+  inline Fp4Vec(Fp4 x) {
+    for (size_t i = 0; i < 4; i++) {
+      elems[i] = x.elems[i];
+    }
+  }
+
+  /// Explicitly construct an Fp4Vec from parts
+  inline Fp4Vec(FpVec<N> a, FpVec<N> b, FpVec<N> c, FpVec<N> d) {
+    elems[0] = a;
+    elems[1] = b;
+    elems[2] = c;
+    elems[3] = d;
+  }
+
+  /// Get the value of lane i.
+  inline Fp4 get(size_t i) const {
+    return Fp4(elems[0].get(i), elems[1].get(i), elems[2].get(i), elems[3].get(i));
+  }
+
+  /// Set the value of lane i.
+  inline void set(size_t i, Fp4 x) {
+    for (size_t j = 0; j < 4; j++) {
+      elems[j].set(i, x.elems[j]);
+    }
+  }
+
+  inline Fp4Vec operator+=(Fp4Vec rhs) {
+    for (size_t i = 0; i < 4; i++) {
+      elems[i] += rhs.elems[i];
+    }
+    return *this;
+  }
+
+  inline Fp4Vec operator-=(Fp4Vec rhs) {
+    for (size_t i = 0; i < 4; i++) {
+      elems[i] -= rhs.elems[i];
+    }
+    return *this;
+  }
+
+  inline Fp4Vec operator+(Fp4Vec rhs) const {
+    Fp4Vec result = *this;
+    result += rhs;
+    return result;
+  }
+
+  inline Fp4Vec operator-(Fp4Vec rhs) const {
+    Fp4Vec result = *this;
+    result -= rhs;
+    return result;
+  }
+
+  inline Fp4Vec operator-() const { return Fp4Vec() - *this; }
+
+  inline Fp4Vec operator*=(FpVec<N> rhs) {
+    for (size_t i = 0; i < 4; i++) {
+      elems[i] *= rhs;
+    }
+    return *this;
+  }
+
+  inline Fp4Vec operator*(FpVec<N> rhs) const {
+    Fp4Vec result = *this;
+    result *= rhs;
+    return result;
+  }
+
+  // The same polynomial product as Fp4::operator*, reduced modulo x^4 - 11.
+  inline Fp4Vec operator*(Fp4Vec rhs) const {
+    const Fp nbeta(Fp::P - 11);
+    const FpVec<N>* a = elems;
+    const FpVec<N>* b = rhs.elems;
+    return Fp4Vec(a[0] * b[0] + nbeta * (a[1] * b[3] + a[2] * b[2] + a[3] * b[1]),
+                  a[0] * b[1] + a[1] * b[0] + nbeta * (a[2] * b[3] + a[3] * b[2]),
+                  a[0] * b[2] + a[1] * b[1] + a[2] * b[0] + nbeta * (a[3] * b[3]),
+                  a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0]);
+  }
+
+  /// Multiply every lane by the same Fp4.
+  inline Fp4Vec operator*(Fp4 rhs) const {
+    const Fp nbeta(Fp::P - 11);
+    const FpVec<N>* a = elems;
+    const Fp* b = rhs.elems;
+    return Fp4Vec(a[0] * b[0] + nbeta * (a[1] * b[3] + a[2] * b[2] + a[3] * b[1]),
+                  a[0] * b[1] + a[1] * b[0] + nbeta * (a[2] * b[3] + a[3] * b[2]),
+                  a[0] * b[2] + a[1] * b[1] + a[2] * b[0] + nbeta * (a[3] * b[3]),
+                  a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0]);
+  }
+
+  inline Fp4Vec operator*=(Fp4Vec rhs) {
+    *this = *this * rhs;
+    return *this;
+  }
+
+  inline Fp4Vec operator*=(Fp4 rhs) {
+    *this = *this * rhs;
+    return *this;
+  }
+
+  /// True if every lane is equal.
+  inline bool operator==(Fp4Vec rhs) const {
+    for (size_t i = 0; i < 4; i++) {
+      if (elems[i] != rhs.elems[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  inline bool operator!=(Fp4Vec rhs) const { return !(*this == rhs); }
+};
+
+/// Overloads for the cases where the LHS is the narrower type.
+template <size_t N> inline Fp4Vec<N> operator*(FpVec<N> a, Fp4Vec<N> b) {
+  return b * a;
+}
+
+template <size_t N> inline Fp4Vec<N> operator*(Fp4 a, Fp4Vec<N> b) {
+  return b * a;
+}
+
+template <size_t N> inline Fp4Vec<N> operator*(Fp a, Fp4Vec<N> b) {
+  return b * FpVec<N>(a);
+}
+
+/// An Fp4 applied to every lane of an FpVec.
+template <size_t N> inline Fp4Vec<N> operator*(FpVec<N> a, Fp4 b) {
+  return Fp4Vec<N>(a * b.elems[0], a * b.elems[1], a * b.elems[2], a * b.elems[3]);
+}
+
+template <size_t N> inline Fp4Vec<N> operator*(Fp4 a, FpVec<N> b) {
+  return b * a;
+}
+
+} // namespace risc0
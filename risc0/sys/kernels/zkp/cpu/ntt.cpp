@@ -0,0 +1,405 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// A CPU NTT over rows of Fp, computing the same transforms as `evaluate_ntt` and
+/// `interpolate_ntt` in risc0-zkp.
+///
+/// The levels of a transform are run two at a time (radix 4) in a few passes over each row.  The
+/// first levels only mix elements of small contiguous blocks, which are transformed in place.  The
+/// remaining levels are run a group at a time on tiles: a tile holds a few adjacent columns of a
+/// block viewed as a matrix, which is every element the butterflies of those levels combine with
+/// the elements of these columns.  Tiles are copied out to a small buffer, so that a transform of
+/// any size is run out of cache.  The kernels run on the calling thread: the caller spreads the
+/// rows, or if there are only a few rows, the blocks and tiles of each pass, over its own threads.
+
+#include "fp.h"
+#include "fpvec.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace risc0;
+
+namespace {
+
+using Vec = FpVec<kFpVecLanes>;
+
+// The largest supported transform has 2^kMaxBits elements.
+constexpr size_t kMaxBits = 27;
+
+// ROU_FWD[kMaxBits] and ROU_REV[kMaxBits].  The roots for smaller transforms are their powers.
+constexpr uint32_t kRouFwd = 137;
+constexpr uint32_t kRouRev = 749463956;
+
+constexpr size_t kLaneBits = kFpVecLanes == 16 ? 4 : kFpVecLanes == 8 ? 3 : 2;
+static_assert(size_t(1) << kLaneBits == kFpVecLanes, "kLaneBits is log2(kFpVecLanes)");
+
+// Levels up to kBlockBits are run in place on contiguous blocks of 2^kBlockBits elements.
+constexpr size_t kBlockBits = 12;
+
+// Levels above that are run up to kTileBits at a time, on tiles of 2^kTileBits rows of kTileCols
+// columns.
+constexpr size_t kTileBits = 11;
+constexpr size_t kTileCols = 16;
+static_assert(kTileCols % kFpVecLanes == 0, "Tile rows are whole vectors");
+static_assert(size_t(1) << kBlockBits >= kTileCols, "Tiles take whole columns of a block");
+
+// The twiddle tables of each level hold at most 2^kTableBits powers.
+constexpr size_t kTableBits = 11;
+static_assert(kBlockBits <= kTableBits + 1, "Block levels read their twiddles from the tables");
+static_assert(kTileBits <= kTableBits + 1, "Tile levels read their row twiddles from the tables");
+
+/// The primitive 2^s-th roots of unity for each level s, and their first powers.
+struct Roots {
+  Fp root[kMaxBits + 1];
+  // pows[s][i] is root[s]^i, for i < min(2^(s - 1), 2^kTableBits).
+  std::vector<Fp> pows[kMaxBits + 1];
+
+  explicit Roots(uint32_t maxRoot) {
+    root[kMaxBits] = Fp(maxRoot);
+    for (size_t s = kMaxBits; s > 0; s--) {
+      root[s - 1] = root[s] * root[s];
+    }
+    for (size_t s = 1; s <= kMaxBits; s++) {
+      pows[s].resize(size_t(1) << std::min(s - 1, kTableBits));
+      Fp cur(1);
+      for (Fp& pow : pows[s]) {
+        pow = cur;
+        cur *= root[s];
+      }
+    }
+  }
+
+  // True if the table of level s holds all of its twiddles.
+  bool full(size_t s) const { return size_t(1) << (s - 1) <= pows[s].size(); }
+};
+
+const Roots& getRoots(bool inverse) {
+  static const Roots fwd(kRouFwd);
+  static const Roots rev(kRouRev);
+  return inverse ? rev : fwd;
+}
+
+/// A view of 2^(hi - lo) rows of `cols` columns of a block of 2^hi elements, stored row-major at
+/// `data`: row r, column c is element `r * 2^lo + colBase + c` of the block.  A butterfly of any
+/// level above lo pairs the elements of a column with elements of the same column, so these
+/// levels can be run on the view alone.
+struct Tile {
+  Fp* data;
+  size_t cols;
+  size_t lo;
+  size_t hi;
+  size_t colBase;
+};
+
+/// Runs levels first..last on a tile, in ascending order, or descending if kInverse.
+template <bool kInverse> class TileLevels {
+  const Roots& roots;
+  const Tile& tile;
+  size_t rows;
+  // For levels whose tables are not full: root[s]^(colBase + c) for each column c.
+  Vec colPows[kMaxBits + 1][kTileCols / kFpVecLanes];
+
+public:
+  TileLevels(const Roots& roots, const Tile& tile, size_t first, size_t last)
+      : roots(roots), tile(tile), rows(size_t(1) << (tile.hi - tile.lo)) {
+    for (size_t s = first; s <= last; s++) {
+      if (!roots.full(s)) {
+        Fp base = pow(roots.root[s], tile.colBase);
+        for (size_t k = 0; k < tile.cols / kFpVecLanes; k++) {
+          colPows[s][k] = base * Vec::load(&roots.pows[s][k * kFpVecLanes]);
+        }
+      }
+    }
+  }
+
+  void run(size_t first, size_t last) {
+    if (!kInverse) {
+      size_t s = first;
+      for (; s + 1 <= last; s += 2) {
+        radix4(s);
+      }
+      if (s == last) {
+        radix2(s);
+      }
+    } else {
+      size_t s = last;
+      for (; s >= first + 1; s -= 2) {
+        radix4(s - 1);
+      }
+      if (s == first) {
+        radix2(s);
+      }
+    }
+  }
+
+private:
+  // The twiddles of level s for the columns of chunk k, in row j of a half block.
+  Vec twiddle(size_t s, size_t j, size_t k) const {
+    if (roots.full(s)) {
+      return Vec::load(&roots.pows[s][(j << tile.lo) + tile.colBase + k * kFpVecLanes]);
+    }
+    // root[s]^(j * 2^lo) is root[s - lo]^j
+    return roots.pows[s - tile.lo][j] * colPows[s][k];
+  }
+
+  Fp* at(size_t row, size_t k) const { return tile.data + row * tile.cols + k * kFpVecLanes; }
+
+  void radix2(size_t s) {
+    size_t half = size_t(1) << (s - tile.lo - 1);
+    for (size_t j = 0; j < half; j++) {
+      for (size_t k = 0; k < tile.cols / kFpVecLanes; k++) {
+        Vec w = twiddle(s, j, k);
+        for (size_t row = j; row < rows; row += 2 * half) {
+          Vec a = Vec::load(at(row, k));
+          Vec b = Vec::load(at(row + half, k));
+          if (!kInverse) {
+            b *= w;
+            (a + b).store(at(row, k));
+            (a - b).store(at(row + half, k));
+          } else {
+            (a + b).store(at(row, k));
+            ((a - b) * w).store(at(row + half, k));
+          }
+        }
+      }
+    }
+  }
+
+  // Levels s and s + 1 at once.
+  void radix4(size_t s) {
+    size_t quarter = size_t(1) << (s - tile.lo - 1);
+    for (size_t j = 0; j < quarter; j++) {
+      for (size_t k = 0; k < tile.cols / kFpVecLanes; k++) {
+        Vec w1 = twiddle(s, j, k);
+        Vec w2 = twiddle(s + 1, j, k);
+        Vec w3 = twiddle(s + 1, j + quarter, k);
+        for (size_t row = j; row < rows; row += 4 * quarter) {
+          Fp* p0 = at(row, k);
+          Fp* p1 = at(row + quarter, k);
+          Fp* p2 = at(row + 2 * quarter, k);
+          Fp* p3 = at(row + 3 * quarter, k);
+          Vec x0 = Vec::load(p0);
+          Vec x1 = Vec::load(p1);
+          Vec x2 = Vec::load(p2);
+          Vec x3 = Vec::load(p3);
+          if (!kInverse) {
+            x1 *= w1;
+            x3 *= w1;
+            Vec y0 = x0 + x1;
+            Vec y1 = x0 - x1;
+            Vec y2 = (x2 + x3) * w2;
+            Vec y3 = (x2 - x3) * w3;
+            (y0 + y2).store(p0);
+            (y1 + y3).store(p1);
+            (y0 - y2).store(p2);
+            (y1 - y3).store(p3);
+          } else {
+            Vec y0 = x0 + x2;
+            Vec y1 = x1 + x3;
+            Vec y2 = (x0 - x2) * w2;
+            Vec y3 = (x1 - x3) * w3;
+            (y0 + y1).store(p0);
+            ((y0 - y1) * w1).store(p1);
+            (y2 + y3).store(p2);
+            ((y2 - y3) * w1).store(p3);
+          }
+        }
+      }
+    }
+  }
+};
+
+// Runs level s on a contiguous block of 2^hi elements, one element at a time.  Only used for the
+// levels below a full vector.
+template <bool kInverse> void scalarLevel(const Roots& roots, Fp* block, size_t hi, size_t s) {
+  size_t half = size_t(1) << (s - 1);
+  for (size_t begin = 0; begin < size_t(1) << hi; begin += 2 * half) {
+    for (size_t i = 0; i < half; i++) {
+      Fp w = roots.pows[s][i];
+      Fp a = block[begin + i];
+      Fp b = block[begin + i + half];
+      if (!kInverse) {
+        b *= w;
+        block[begin + i] = a + b;
+        block[begin + i + half] = a - b;
+      } else {
+        block[begin + i] = a + b;
+        block[begin + i + half] = (a - b) * w;
+      }
+    }
+  }
+}
+
+/// One pass over a row: either levels first..hi of each contiguous block of 2^hi elements, or
+/// levels lo + 1..hi of each tile of kTileCols columns of each block of 2^hi elements.
+struct Pass {
+  bool block;
+  size_t lo;
+  size_t hi;
+  size_t first;
+  // Number of blocks or tiles in a row.
+  size_t units;
+};
+
+/// The passes that transform rows of 2^bits elements, skipping levels up to `expandBits`.
+std::vector<Pass> plan(size_t bits, size_t expandBits, bool inverse) {
+  std::vector<Pass> passes;
+  size_t blockHi = std::min(bits, kBlockBits);
+  if (expandBits < blockHi) {
+    passes.push_back({true, 0, blockHi, expandBits + 1, size_t(1) << (bits - blockHi)});
+  }
+  for (size_t lo = std::max(blockHi, expandBits); lo < bits;) {
+    size_t hi = std::min(bits, lo + kTileBits);
+    passes.push_back({false, lo, hi, lo + 1, (size_t(1) << (bits - hi + lo)) / kTileCols});
+    lo = hi;
+  }
+  if (inverse) {
+    std::reverse(passes.begin(), passes.end());
+  }
+  return passes;
+}
+
+template <bool kInverse> void runBlock(const Roots& roots, const Pass& pass, Fp* block) {
+  size_t vecLevels = pass.hi > kLaneBits ? kLaneBits + 1 : pass.hi + 1;
+  if (!kInverse) {
+    for (size_t s = pass.first; s < vecLevels; s++) {
+      scalarLevel<false>(roots, block, pass.hi, s);
+    }
+    size_t first = std::max(pass.first, vecLevels);
+    if (first <= pass.hi) {
+      Tile tile{block, kFpVecLanes, kLaneBits, pass.hi, 0};
+      TileLevels<false>(roots, tile, first, pass.hi).run(first, pass.hi);
+    }
+  } else {
+    if (vecLevels <= pass.hi) {
+      Tile tile{block, kFpVecLanes, kLaneBits, pass.hi, 0};
+      TileLevels<true>(roots, tile, vecLevels, pass.hi).run(vecLevels, pass.hi);
+    }
+    for (size_t s = vecLevels - 1; s >= 1; s--) {
+      scalarLevel<true>(roots, block, pass.hi, s);
+    }
+  }
+}
+
+template <bool kInverse> void runTile(const Roots& roots, const Pass& pass, Fp* row, size_t unit) {
+  thread_local std::vector<Fp> buf;
+  size_t groups = (size_t(1) << pass.lo) / kTileCols;
+  size_t rows = size_t(1) << (pass.hi - pass.lo);
+  Fp* block = row + ((unit / groups) << pass.hi);
+  size_t colBase = (unit % groups) * kTileCols;
+  buf.resize(rows * kTileCols);
+  for (size_t r = 0; r < rows; r++) {
+    std::copy_n(block + (r << pass.lo) + colBase, kTileCols, &buf[r * kTileCols]);
+  }
+  Tile tile{buf.data(), kTileCols, pass.lo, pass.hi, colBase};
+  TileLevels<kInverse>(roots, tile, pass.lo + 1, pass.hi).run(pass.lo + 1, pass.hi);
+  for (size_t r = 0; r < rows; r++) {
+    std::copy_n(&buf[r * kTileCols], kTileCols, block + (r << pass.lo) + colBase);
+  }
+}
+
+// Runs one block or tile of a pass over a row of 2^bits elements, and for the last pass of an
+// inverse transform, also scales its block by 2^-bits.
+template <bool kInverse>
+void runUnit(const Roots& roots, const Pass& pass, Fp* row, size_t bits, size_t unit) {
+  if (!pass.block) {
+    runTile<kInverse>(roots, pass, row, unit);
+    return;
+  }
+  Fp* block = row + (unit << pass.hi);
+  runBlock<kInverse>(roots, pass, block);
+  if (kInverse) {
+    Fp norm = inv(pow(Fp(2), bits));
+    size_t size = size_t(1) << pass.hi;
+    size_t i = 0;
+    for (; i + kFpVecLanes <= size; i += kFpVecLanes) {
+      (Vec::load(block + i) * norm).store(block + i);
+    }
+    for (; i < size; i++) {
+      block[i] *= norm;
+    }
+  }
+}
+
+template <bool kInverse> void batchNtt(Fp* io, size_t count, size_t bits, size_t expandBits) {
+  const Roots& roots = getRoots(kInverse);
+  std::vector<Pass> passes = plan(bits, expandBits, kInverse);
+  size_t size = size_t(1) << bits;
+  for (size_t i = 0; i < count; i++) {
+    for (const Pass& pass : passes) {
+      for (size_t unit = 0; unit < pass.units; unit++) {
+        runUnit<kInverse>(roots, pass, io + i * size, bits, unit);
+      }
+    }
+  }
+}
+
+template <bool kInverse>
+void runPass(Fp* io, size_t bits, size_t expandBits, size_t index, size_t begin, size_t end) {
+  const Roots& roots = getRoots(kInverse);
+  Pass pass = plan(bits, expandBits, kInverse)[index];
+  size_t size = size_t(1) << bits;
+  for (size_t i = begin; i < end; i++) {
+    runUnit<kInverse>(roots, pass, io + i / pass.units * size, bits, i % pass.units);
+  }
+}
+
+} // namespace
+
+/// Runs the forward NTT of `evaluate_ntt` on each of the `count` rows of 2^bits elements at `io`.
+/// As there, the input is in bit reversed order, and the levels up to `expandBits` are skipped,
+/// because an expanded input is already constant over each block of 2^expandBits elements.
+extern "C" void risc0_zkp_cpu_batch_evaluate_ntt(Fp* io,
+                                                 size_t count,
+                                                 size_t bits,
+                                                 size_t expandBits) {
+  batchNtt<false>(io, count, bits, expandBits);
+}
+
+/// Runs the inverse NTT of `interpolate_ntt` on each of the `count` rows of 2^bits elements at
+/// `io`, leaving the output in bit reversed order.
+extern "C" void risc0_zkp_cpu_batch_interpolate_ntt(Fp* io, size_t count, size_t bits) {
+  batchNtt<true>(io, count, bits, 0);
+}
+
+/// The number of passes of a transform of rows of 2^bits elements.
+extern "C" size_t risc0_zkp_cpu_ntt_passes(size_t bits, size_t expandBits, bool inverse) {
+  return plan(bits, expandBits, inverse).size();
+}
+
+/// The number of blocks or tiles that pass `index` of a transform runs on each row.
+extern "C" size_t
+risc0_zkp_cpu_ntt_pass_units(size_t bits, size_t expandBits, bool inverse, size_t index) {
+  return plan(bits, expandBits, inverse)[index].units;
+}
+
+/// Runs the blocks or tiles `begin..end` of pass `index` of a transform of the rows of 2^bits
+/// elements at `io`, where the units of the row `i` are numbered from `i * units`.  Running every
+/// unit of each pass in turn is the same as the batch transforms above.
+extern "C" void risc0_zkp_cpu_ntt_run_pass(Fp* io,
+                                           size_t bits,
+                                           size_t expandBits,
+                                           bool inverse,
+                                           size_t index,
+                                           size_t begin,
+                                           size_t end) {
+  if (inverse) {
+    runPass<true>(io, bits, expandBits, index, begin, end);
+  } else {
+    runPass<false>(io, bits, expandBits, index, begin, end);
+  }
+}
@@ -0,0 +1,227 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// A CPU Poseidon2 that permutes kFpVecLanes independent states at once, one in each lane of
+/// FpVec, computing the same hashes as `poseidon2_rows` and `poseidon2_fold` in the CUDA kernels.
+///
+/// The permutation follows poseidon2.cu step for step.  As there, the round constants and the
+/// diagonal of the internal matrix are passed in by the caller.
+
+#include "fp.h"
+#include "fpvec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace risc0;
+
+namespace {
+
+using Vec = FpVec<kFpVecLanes>;
+
+constexpr size_t N = kFpVecLanes;
+
+constexpr size_t kCells = 24;
+constexpr size_t kRoundsHalfFull = 4;
+constexpr size_t kRoundsPartial = 21;
+constexpr size_t kCellsRate = 16;
+constexpr size_t kCellsOut = 8;
+
+struct Poseidon2 {
+  const Fp* roundConstants;
+  const Fp* mIntDiag;
+
+  static inline Vec sbox(Vec x) {
+    Vec x2 = x * x;
+    Vec x4 = x2 * x2;
+    Vec x6 = x4 * x2;
+    return x6 * x;
+  }
+
+  static inline Vec twice(Vec x) { return x + x; }
+
+  static inline void multiplyBy4x4Circulant(Vec* x) {
+    // See appendix B of Poseidon2 paper.
+    Vec t0 = x[0] + x[1];
+    Vec t1 = x[2] + x[3];
+    Vec t2 = twice(x[1]) + t1;
+    Vec t3 = twice(x[3]) + t0;
+    Vec t4 = twice(twice(t1)) + t3;
+    Vec t5 = twice(twice(t0)) + t2;
+    Vec t6 = t3 + t5;
+    Vec t7 = t2 + t4;
+    x[0] = t6;
+    x[1] = t5;
+    x[2] = t7;
+    x[3] = t4;
+  }
+
+  static inline void multiplyByMExt(Vec* cells) {
+    // Optimized method for multiplication by M_EXT.
+    // See appendix B of Poseidon2 paper for additional details.
+    const Vec one = Fp::fromRaw(1);
+    Vec sums[4];
+    for (size_t i = 0; i < kCells / 4; i++) {
+      multiplyBy4x4Circulant(cells + i * 4);
+      for (size_t j = 0; j < 4; j++) {
+        Vec x = one * cells[i * 4 + j];
+        sums[j] += x;
+        cells[i * 4 + j] = x;
+      }
+    }
+    for (size_t i = 0; i < kCells; i++) {
+      cells[i] += sums[i % 4];
+    }
+  }
+
+  inline void multiplyByMInt(Vec* cells) const {
+    // Exploit the fact that off-diagonal entries of M_INT are all 1.
+    Vec sum;
+    for (size_t i = 0; i < kCells; i++) {
+      sum += cells[i];
+    }
+    for (size_t i = 0; i < kCells; i++) {
+      cells[i] = sum + mIntDiag[i] * cells[i];
+    }
+  }
+
+  inline void fullRound(Vec* cells, size_t round) const {
+    for (size_t i = 0; i < kCells; i++) {
+      cells[i] = sbox(cells[i] + roundConstants[round * kCells + i]);
+    }
+    multiplyByMExt(cells);
+  }
+
+  inline void partialRound(Vec* cells, size_t round) const {
+    cells[0] = sbox(cells[0] + roundConstants[round * kCells]);
+    multiplyByMInt(cells);
+  }
+
+  void mix(Vec* cells) const {
+    size_t round = 0;
+
+    // First linear layer.
+    multiplyByMExt(cells);
+
+    for (size_t i = 0; i < kRoundsHalfFull; i++) {
+      fullRound(cells, round++);
+    }
+    for (size_t i = 0; i < kRoundsPartial; i++) {
+      partialRound(cells, round++);
+    }
+    for (size_t i = 0; i < kRoundsHalfFull; i++) {
+      fullRound(cells, round++);
+    }
+  }
+
+  // Hashes the N rows starting at `rows`, whose column j starts at `rows + j * stride`.
+  void hashRows(Fp* out, const Fp* rows, size_t stride, size_t colSize) const {
+    Vec cells[kCells];
+    size_t used = 0;
+    for (size_t col = 0; col < colSize; col++) {
+      cells[used++] += Vec::load(rows + col * stride);
+      if (used == kCellsRate) {
+        mix(cells);
+        used = 0;
+      }
+    }
+    if (used != 0 || colSize == 0) {
+      mix(cells);
+    }
+    storeDigests(out, cells);
+  }
+
+  // Hashes the pairs of digests of N nodes at `in`, writing their parents to `out`.
+  void fold(Fp* out, const Fp* in) const {
+    // words[i] holds cell i of every node, transposed from the digests of the pairs.
+    Fp words[kCellsRate][N];
+    for (size_t lane = 0; lane < N; lane++) {
+      for (size_t i = 0; i < kCellsRate; i++) {
+        words[i][lane] = in[lane * kCellsRate + i];
+      }
+    }
+    Vec cells[kCells];
+    for (size_t i = 0; i < kCellsRate; i++) {
+      cells[i] = Vec::load(words[i]);
+    }
+    mix(cells);
+    storeDigests(out, cells);
+  }
+
+  static inline void storeDigests(Fp* out, const Vec* cells) {
+    Fp words[kCellsOut][N];
+    for (size_t i = 0; i < kCellsOut; i++) {
+      cells[i].store(words[i]);
+    }
+    for (size_t lane = 0; lane < N; lane++) {
+      for (size_t i = 0; i < kCellsOut; i++) {
+        out[lane * kCellsOut + i] = words[i][lane];
+      }
+    }
+  }
+};
+
+} // namespace
+
+/// Hashes each of the `count` rows at `matrix`, whose column j starts at `matrix + j * stride`,
+/// writing the digests of the rows to `out`.
+extern "C" void risc0_zkp_cpu_poseidon2_rows(const Fp* roundConstants,
+                                             const Fp* mIntDiag,
+                                             Fp* out,
+                                             const Fp* matrix,
+                                             size_t stride,
+                                             size_t count,
+                                             size_t colSize) {
+  Poseidon2 poseidon2{roundConstants, mIntDiag};
+  size_t row = 0;
+  for (; row + N <= count; row += N) {
+    poseidon2.hashRows(out + row * kCellsOut, matrix + row, stride, colSize);
+  }
+  if (row < count) {
+    // The last rows are copied out, padded to a whole group.
+    size_t rest = count - row;
+    std::vector<Fp> rows(colSize * N);
+    for (size_t col = 0; col < colSize; col++) {
+      std::memcpy(&rows[col * N], matrix + col * stride + row, rest * sizeof(Fp));
+    }
+    Fp digests[N * kCellsOut];
+    poseidon2.hashRows(digests, rows.data(), N, colSize);
+    std::memcpy(out + row * kCellsOut, digests, rest * kCellsOut * sizeof(Fp));
+  }
+}
+
+/// Hashes each of the `count` pairs of digests at `input`, writing the resulting digests to
+/// `output`.
+extern "C" void risc0_zkp_cpu_poseidon2_fold(const Fp* roundConstants,
+                                             const Fp* mIntDiag,
+                                             Fp* output,
+                                             const Fp* input,
+                                             size_t count) {
+  Poseidon2 poseidon2{roundConstants, mIntDiag};
+  size_t node = 0;
+  for (; node + N <= count; node += N) {
+    poseidon2.fold(output + node * kCellsOut, input + node * kCellsRate);
+  }
+  if (node < count) {
+    size_t rest = count - node;
+    Fp pairs[N * kCellsRate] = {};
+    Fp digests[N * kCellsOut];
+    std::memcpy(pairs, input + node * kCellsRate, rest * kCellsRate * sizeof(Fp));
+    poseidon2.fold(digests, pairs);
+    std::memcpy(output + node * kCellsOut, digests, rest * kCellsOut * sizeof(Fp));
+  }
+}
@@ -0,0 +1,450 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file
+/// A multi-buffer SHA-256 of the rows of a column-major matrix, computing the same digests as
+/// `sha_rows` in the CUDA kernels and `hash_raw_pod_slice` in risc0-zkp: each row is zero padded to
+/// a whole number of blocks, without the standard SHA-256 trailer.
+///
+/// Rows are hashed a group at a time, one row in each lane of a vector.  Word j of a row's message
+/// is its element of column j, so the words j of a group of adjacent rows are adjacent as well, and
+/// a single load of them is a transposed tile of the matrix: it gives every lane its next word.
+/// With the SHA extensions but no AVX-512, rows are instead compressed one at a time by the SHA
+/// instructions, from blocks copied out of a tile of columns of a group of rows.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__AVX512F__) || defined(__SHA__)
+// Silences GCC 12's uninitialized warnings from avx512fintrin.h, as in fpvec.h.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+namespace {
+
+constexpr uint32_t kRoundK[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+constexpr uint32_t kInitState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+// Words of a block per row.
+constexpr size_t kBlockWords = 16;
+
+/// The words of N rows, one in each lane.  This is specialized below for the widths that the target
+/// has vector instructions for.
+template <size_t N> struct ShaLanes {
+  uint32_t v[N];
+
+  static inline ShaLanes broadcast(uint32_t x) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = x;
+    }
+    return r;
+  }
+
+  // Loads N raw words and converts them from big-endian, like the words of a message.
+  static inline ShaLanes loadMessage(const uint32_t* ptr) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = __builtin_bswap32(ptr[i]);
+    }
+    return r;
+  }
+
+  inline void store(uint32_t* ptr) const {
+    for (size_t i = 0; i < N; i++) {
+      ptr[i] = v[i];
+    }
+  }
+
+  static inline ShaLanes add(const ShaLanes& a, const ShaLanes& b) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = a.v[i] + b.v[i];
+    }
+    return r;
+  }
+
+  static inline ShaLanes bitXor(const ShaLanes& a, const ShaLanes& b) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = a.v[i] ^ b.v[i];
+    }
+    return r;
+  }
+
+  static inline ShaLanes ch(const ShaLanes& x, const ShaLanes& y, const ShaLanes& z) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = (x.v[i] & y.v[i]) ^ (~x.v[i] & z.v[i]);
+    }
+    return r;
+  }
+
+  static inline ShaLanes maj(const ShaLanes& x, const ShaLanes& y, const ShaLanes& z) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = (x.v[i] & y.v[i]) ^ (x.v[i] & z.v[i]) ^ (y.v[i] & z.v[i]);
+    }
+    return r;
+  }
+
+  template <int kBits> static inline ShaLanes rotr(const ShaLanes& a) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = (a.v[i] >> kBits) | (a.v[i] << (32 - kBits));
+    }
+    return r;
+  }
+
+  template <int kBits> static inline ShaLanes shr(const ShaLanes& a) {
+    ShaLanes r;
+    for (size_t i = 0; i < N; i++) {
+      r.v[i] = a.v[i] >> kBits;
+    }
+    return r;
+  }
+};
+
+#if defined(__AVX2__)
+
+template <> struct ShaLanes<8> {
+  __m256i v;
+
+  static inline ShaLanes make(__m256i x) { return ShaLanes{x}; }
+
+  static inline ShaLanes broadcast(uint32_t x) { return make(_mm256_set1_epi32(x)); }
+
+  static inline ShaLanes loadMessage(const uint32_t* ptr) {
+    const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                          12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    return make(_mm256_shuffle_epi8(x, bswap));
+  }
+
+  inline void store(uint32_t* ptr) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v);
+  }
+
+  static inline ShaLanes add(const ShaLanes& a, const ShaLanes& b) {
+    return make(_mm256_add_epi32(a.v, b.v));
+  }
+
+  static inline ShaLanes bitXor(const ShaLanes& a, const ShaLanes& b) {
+    return make(_mm256_xor_si256(a.v, b.v));
+  }
+
+  static inline ShaLanes ch(const ShaLanes& x, const ShaLanes& y, const ShaLanes& z) {
+    // z ^ (x & (y ^ z))
+    return make(_mm256_xor_si256(z.v, _mm256_and_si256(x.v, _mm256_xor_si256(y.v, z.v))));
+  }
+
+  static inline ShaLanes maj(const ShaLanes& x, const ShaLanes& y, const ShaLanes& z) {
+    // y ^ ((x ^ y) & (y ^ z))
+    __m256i xy = _mm256_xor_si256(x.v, y.v);
+    __m256i yz = _mm256_xor_si256(y.v, z.v);
+    return make(_mm256_xor_si256(y.v, _mm256_and_si256(xy, yz)));
+  }
+
+  template <int kBits> static inline ShaLanes rotr(const ShaLanes& a) {
+    return make(_mm256_or_si256(_mm256_srli_epi32(a.v, kBits), _mm256_slli_epi32(a.v, 32 - kBits)));
+  }
+
+  template <int kBits> static inline ShaLanes shr(const ShaLanes& a) {
+    return make(_mm256_srli_epi32(a.v, kBits));
+  }
+};
+
+#endif // __AVX2__
+
+#if defined(__AVX512F__)
+
+template <> struct ShaLanes<16> {
+  __m512i v;
+
+  static inline ShaLanes make(__m512i x) { return ShaLanes{x}; }
+
+  static inline ShaLanes broadcast(uint32_t x) { return make(_mm512_set1_epi32(x)); }
+
+  static inline ShaLanes loadMessage(const uint32_t* ptr) {
+    // Byte swaps with rotates, which unlike byte shuffles need no AVX-512BW: bytes 1 and 3 of
+    // rotr(x, 8) and bytes 0 and 2 of rotl(x, 8) are in their swapped places.
+    __m512i x = _mm512_loadu_si512(ptr);
+    __m512i odd = _mm512_set1_epi32(0xff00ff00);
+    __m512i right = _mm512_ror_epi32(x, 8);
+    __m512i left = _mm512_rol_epi32(x, 8);
+    return make(_mm512_ternarylogic_epi32(odd, right, left, 0xca));
+  }
+
+  inline void store(uint32_t* ptr) const { _mm512_storeu_si512(ptr, v); }
+
+  static inline ShaLanes add(const ShaLanes& a, const ShaLanes& b) {
+    return make(_mm512_add_epi32(a.v, b.v));
+  }
+
+  static inline ShaLanes bitXor(const ShaLanes& a, const ShaLanes& b) {
+    return make(_mm512_xor_si512(a.v, b.v));
+  }
+
+  // The ternary logic immediates are the truth tables of the functions, with x, y and z selecting
+  // bits 2, 1 and 0 of the index.
+  static inline ShaLanes ch(const ShaLanes& x, const ShaLanes& y, const ShaLanes& z) {
+    return make(_mm512_ternarylogic_epi32(x.v, y.v, z.v, 0xca));
+  }
+
+  static inline ShaLanes maj(const ShaLanes& x, const ShaLanes& y, const ShaLanes& z) {
+    return make(_mm512_ternarylogic_epi32(x.v, y.v, z.v, 0xe8));
+  }
+
+  template <int kBits> static inline ShaLanes rotr(const ShaLanes& a) {
+    return make(_mm512_ror_epi32(a.v, kBits));
+  }
+
+  template <int kBits> static inline ShaLanes shr(const ShaLanes& a) {
+    return make(_mm512_srli_epi32(a.v, kBits));
+  }
+};
+
+#endif // __AVX512F__
+
+/// Hashes groups of kLanes rows, one row in each lane.
+template <size_t kLanes> struct MultiBufferSha {
+  // The rows hashed at a time.
+  static constexpr size_t N = kLanes;
+
+  using V = ShaLanes<N>;
+
+  static inline V xor3(const V& a, const V& b, const V& c) { return V::bitXor(V::bitXor(a, b), c); }
+
+  static inline V ep0(const V& x) {
+    return xor3(V::template rotr<2>(x), V::template rotr<13>(x), V::template rotr<22>(x));
+  }
+
+  static inline V ep1(const V& x) {
+    return xor3(V::template rotr<6>(x), V::template rotr<11>(x), V::template rotr<25>(x));
+  }
+
+  static inline V sig0(const V& x) {
+    return xor3(V::template rotr<7>(x), V::template rotr<18>(x), V::template shr<3>(x));
+  }
+
+  static inline V sig1(const V& x) {
+    return xor3(V::template rotr<17>(x), V::template rotr<19>(x), V::template shr<10>(x));
+  }
+
+  // Compresses one block of message words into the state of each lane.
+  static inline void compress(V state[8], V w[kBlockWords]) {
+    V a = state[0];
+    V b = state[1];
+    V c = state[2];
+    V d = state[3];
+    V e = state[4];
+    V f = state[5];
+    V g = state[6];
+    V h = state[7];
+    for (size_t i = 0; i < 64; i++) {
+      // w holds the last 16 words of the message schedule.
+      if (i >= kBlockWords) {
+        V& wi = w[i % kBlockWords];
+        V s = V::add(sig1(w[(i - 2) % kBlockWords]), w[(i - 7) % kBlockWords]);
+        wi = V::add(V::add(s, sig0(w[(i - 15) % kBlockWords])), wi);
+      }
+      V k = V::broadcast(kRoundK[i]);
+      V t1 = V::add(V::add(V::add(h, ep1(e)), V::add(V::ch(e, f, g), k)), w[i % kBlockWords]);
+      V t2 = V::add(ep0(a), V::maj(a, b, c));
+      h = g;
+      g = f;
+      f = e;
+      e = V::add(d, t1);
+      d = c;
+      c = b;
+      b = a;
+      a = V::add(t1, t2);
+    }
+    state[0] = V::add(state[0], a);
+    state[1] = V::add(state[1], b);
+    state[2] = V::add(state[2], c);
+    state[3] = V::add(state[3], d);
+    state[4] = V::add(state[4], e);
+    state[5] = V::add(state[5], f);
+    state[6] = V::add(state[6], g);
+    state[7] = V::add(state[7], h);
+  }
+
+  // Hashes the N rows starting at `rows`, whose column j starts at `rows + j * stride`.
+  static void hashGroup(uint32_t* out, const uint32_t* rows, size_t stride, size_t colSize) {
+    V state[8];
+    for (size_t i = 0; i < 8; i++) {
+      state[i] = V::broadcast(kInitState[i]);
+    }
+    for (size_t col = 0; col < colSize; col += kBlockWords) {
+      V w[kBlockWords];
+      for (size_t j = 0; j < kBlockWords; j++) {
+        w[j] = col + j < colSize ? V::loadMessage(rows + (col + j) * stride) : V::broadcast(0);
+      }
+      compress(state, w);
+    }
+    uint32_t words[8][N];
+    for (size_t i = 0; i < 8; i++) {
+      state[i].store(words[i]);
+    }
+    for (size_t lane = 0; lane < N; lane++) {
+      for (size_t i = 0; i < 8; i++) {
+        out[lane * 8 + i] = __builtin_bswap32(words[i][lane]);
+      }
+    }
+  }
+};
+
+// The SHA extensions path also needs SSE4.1 for the shuffles and blends around them, which
+// `-msha` alone doesn't enable.
+#if defined(__SHA__) && defined(__SSE4_1__) && !defined(__AVX512F__)
+
+/// Hashes rows one at a time with the SHA extensions.
+struct ShaNi {
+  // The rows copied out of a tile at a time, which is also the width of the column loads.
+  static constexpr size_t N = 8;
+
+  // Compresses a block of 64 message bytes, with the state kept as ABEF and CDGH.
+  static inline void compress(__m128i& abef, __m128i& cdgh, const uint32_t* block) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+    __m128i msg[4];
+    __m128i abefSave = abef;
+    __m128i cdghSave = cdgh;
+    // Rounds 4g to 4g + 3.  msg[g % 4] holds their words, which after the first four groups are
+    // scheduled a few groups ahead.
+    for (size_t g = 0; g < 16; g++) {
+      __m128i& cur = msg[g % 4];
+      if (g < 4) {
+        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 4 * g));
+        cur = _mm_shuffle_epi8(raw, bswap);
+      }
+      __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kRoundK + 4 * g));
+      __m128i wk = _mm_add_epi32(cur, k);
+      cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+      if (g >= 3 && g < 15) {
+        __m128i& next = msg[(g + 1) % 4];
+        next = _mm_add_epi32(next, _mm_alignr_epi8(cur, msg[(g + 3) % 4], 4));
+        next = _mm_sha256msg2_epu32(next, cur);
+      }
+      abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0e));
+      if (g >= 1 && g < 13) {
+        __m128i& prev = msg[(g + 3) % 4];
+        prev = _mm_sha256msg1_epu32(prev, cur);
+      }
+    }
+    abef = _mm_add_epi32(abef, abefSave);
+    cdgh = _mm_add_epi32(cdgh, cdghSave);
+  }
+
+  // Hashes the N rows starting at `rows`, whose column j starts at `rows + j * stride`.
+  static void hashGroup(uint32_t* out, const uint32_t* rows, size_t stride, size_t colSize) {
+    // ABEF and CDGH of the initial state, for each row.
+    __m128i abef[N];
+    __m128i cdgh[N];
+    for (size_t lane = 0; lane < N; lane++) {
+      abef[lane] = _mm_set_epi32(kInitState[0], kInitState[1], kInitState[4], kInitState[5]);
+      cdgh[lane] = _mm_set_epi32(kInitState[2], kInitState[3], kInitState[6], kInitState[7]);
+    }
+    for (size_t col = 0; col < colSize; col += kBlockWords) {
+      // tile[lane] is the block of row `lane`.
+      uint32_t tile[N][kBlockWords];
+      for (size_t j = 0; j < kBlockWords; j++) {
+        uint32_t words[N] = {};
+        if (col + j < colSize) {
+          std::memcpy(words, rows + (col + j) * stride, sizeof(words));
+        }
+        for (size_t lane = 0; lane < N; lane++) {
+          tile[lane][j] = words[lane];
+        }
+      }
+      for (size_t lane = 0; lane < N; lane++) {
+        compress(abef[lane], cdgh[lane], tile[lane]);
+      }
+    }
+    for (size_t lane = 0; lane < N; lane++) {
+      // Back from ABEF and CDGH to ABCD and EFGH, and to big-endian.
+      const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+      __m128i feba = _mm_shuffle_epi32(abef[lane], 0x1b);
+      __m128i dchg = _mm_shuffle_epi32(cdgh[lane], 0xb1);
+      __m128i dcba = _mm_blend_epi16(feba, dchg, 0xf0);
+      __m128i hgfe = _mm_alignr_epi8(dchg, feba, 8);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + lane * 8), _mm_shuffle_epi8(dcba, bswap));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + lane * 8 + 4),
+                       _mm_shuffle_epi8(hgfe, bswap));
+    }
+  }
+};
+
+using Engine = ShaNi;
+
+#elif defined(__AVX512F__)
+
+using Engine = MultiBufferSha<16>;
+
+#elif defined(__AVX2__)
+
+using Engine = MultiBufferSha<8>;
+
+#else
+
+using Engine = MultiBufferSha<4>;
+
+#endif
+
+} // namespace
+
+/// Hashes each of the `count` rows at `matrix`, whose column j starts at `matrix + j * stride`,
+/// writing the digests of the rows to `out`.
+extern "C" void risc0_zkp_cpu_sha_rows(uint32_t* out,
+                                       const uint32_t* matrix,
+                                       size_t stride,
+                                       size_t count,
+                                       size_t colSize) {
+  constexpr size_t N = Engine::N;
+  size_t row = 0;
+  for (; row + N <= count; row += N) {
+    Engine::hashGroup(out + row * 8, matrix + row, stride, colSize);
+  }
+  if (row < count) {
+    // The last rows are copied out, padded to a whole group.
+    size_t rest = count - row;
+    std::vector<uint32_t> rows(colSize * N);
+    for (size_t col = 0; col < colSize; col++) {
+      std::memcpy(&rows[col * N], matrix + col * stride + row, rest * sizeof(uint32_t));
+    }
+    uint32_t digests[N * 8];
+    Engine::hashGroup(digests, rows.data(), N, colSize);
+    std::memcpy(out + row * 8, digests, rest * 8 * sizeof(uint32_t));
+  }
+}
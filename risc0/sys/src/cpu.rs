@@ -0,0 +1,69 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+extern "C" {
+    pub fn risc0_zkp_cpu_batch_evaluate_ntt(
+        io: *mut u32,
+        count: usize,
+        bits: usize,
+        expand_bits: usize,
+    );
+
+    pub fn risc0_zkp_cpu_batch_interpolate_ntt(io: *mut u32, count: usize, bits: usize);
+
+    pub fn risc0_zkp_cpu_ntt_passes(bits: usize, expand_bits: usize, inverse: bool) -> usize;
+
+    pub fn risc0_zkp_cpu_ntt_pass_units(
+        bits: usize,
+        expand_bits: usize,
+        inverse: bool,
+        index: usize,
+    ) -> usize;
+
+    pub fn risc0_zkp_cpu_ntt_run_pass(
+        io: *mut u32,
+        bits: usize,
+        expand_bits: usize,
+        inverse: bool,
+        index: usize,
+        begin: usize,
+        end: usize,
+    );
+
+    pub fn risc0_zkp_cpu_poseidon2_fold(
+        round_constants: *const u32,
+        m_int_diag: *const u32,
+        output: *mut u32,
+        input: *const u32,
+        count: usize,
+    );
+
+    pub fn risc0_zkp_cpu_poseidon2_rows(
+        round_constants: *const u32,
+        m_int_diag: *const u32,
+        out: *mut u32,
+        matrix: *const u32,
+        stride: usize,
+        count: usize,
+        col_size: usize,
+    );
+
+    pub fn risc0_zkp_cpu_sha_rows(
+        out: *mut u32,
+        matrix: *const u32,
+        stride: usize,
+        count: usize,
+        col_size: usize,
+    );
+}
@@ -0,0 +1,39 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use risc0_core::field::{baby_bear::BabyBearExtElem, Elem};
+use risc0_zkp::prove::accum::prefix_products;
+
+fn benchmark_prefix_products(c: &mut Criterion) {
+    let mut group = c.benchmark_group("prefix_products");
+    group.sample_size(10);
+    let mut rng = rand::thread_rng();
+    for po2 in [16, 20, 22] {
+        let elems: Vec<_> = (0..1 << po2)
+            .map(|_| BabyBearExtElem::random(&mut rng))
+            .collect();
+        group.throughput(Throughput::Elements(elems.len() as u64));
+        group.bench_function(BenchmarkId::from_parameter(po2), |b| {
+            b.iter_batched_ref(
+                || elems.clone(),
+                |elems| prefix_products(elems),
+                criterion::BatchSize::LargeInput,
+            )
+        });
+    }
+}
+
+criterion_group!(benches, benchmark_prefix_products);
+criterion_main!(benches);
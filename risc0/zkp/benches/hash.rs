@@ -12,11 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use criterion::{criterion_group, criterion_main, Criterion};
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
 use risc0_core::field::{baby_bear::BabyBearElem, Elem};
-use risc0_zkp::core::hash::{
-    poseidon::{poseidon_mix, CELLS as POSEIDON_CELLS},
-    poseidon2::{poseidon2_mix, CELLS as POSEIDON2_CELLS},
+use risc0_zkp::core::{
+    digest::Digest,
+    hash::{
+        poseidon::{poseidon_mix, CELLS as POSEIDON_CELLS},
+        poseidon2::{poseidon2_mix, Poseidon2HashSuite, CELLS as POSEIDON2_CELLS},
+    },
 };
 
 fn benchmark_poseidon_mix(c: &mut Criterion) {
@@ -31,5 +34,63 @@ fn benchmark_poseidon2_mix(c: &mut Criterion) {
     c.bench_function("poseidon2_mix", |b| b.iter(|| poseidon2_mix(&mut cells)));
 }
 
-criterion_group!(benches, benchmark_poseidon_mix, benchmark_poseidon2_mix);
+// Hashes a column-major matrix a row at a time, and with hash_elem_rows, which
+// permutes several rows at once when built with the `cpu-poseidon2` feature.
+fn benchmark_poseidon2_rows(c: &mut Criterion) {
+    const ROWS: usize = 1 << 12;
+    const COLS: usize = 64;
+    let mut rng = rand::thread_rng();
+    let matrix: Vec<_> = (0..ROWS * COLS)
+        .map(|_| BabyBearElem::random(&mut rng))
+        .collect();
+    let hashfn = Poseidon2HashSuite::new_suite().hashfn;
+    let mut output = vec![Digest::ZERO; ROWS];
+
+    let mut group = c.benchmark_group("poseidon2_rows");
+    group.throughput(Throughput::Elements(ROWS as u64));
+    group.bench_function(BenchmarkId::new("hash_elem_slice", COLS), |b| {
+        b.iter(|| {
+            for (idx, output) in output.iter_mut().enumerate() {
+                let row: Vec<_> = (0..COLS).map(|col| matrix[col * ROWS + idx]).collect();
+                *output = *hashfn.hash_elem_slice(&row);
+            }
+        })
+    });
+    group.bench_function(BenchmarkId::new("hash_elem_rows", COLS), |b| {
+        b.iter(|| hashfn.hash_elem_rows(&mut output, &matrix, ROWS, COLS))
+    });
+    group.finish();
+}
+
+// Hashes pairs of digests one at a time, and with hash_pairs.
+fn benchmark_poseidon2_pairs(c: &mut Criterion) {
+    const NODES: usize = 1 << 12;
+    let hashfn = Poseidon2HashSuite::new_suite().hashfn;
+    let input: Vec<_> = (0..2 * NODES as u32)
+        .map(|x| *hashfn.hash_elem_slice(&[BabyBearElem::new(x)]))
+        .collect();
+    let mut output = vec![Digest::ZERO; NODES];
+
+    let mut group = c.benchmark_group("poseidon2_pairs");
+    group.throughput(Throughput::Elements(NODES as u64));
+    group.bench_function("hash_pair", |b| {
+        b.iter(|| {
+            for (output, pair) in output.iter_mut().zip(input.chunks_exact(2)) {
+                *output = *hashfn.hash_pair(&pair[0], &pair[1]);
+            }
+        })
+    });
+    group.bench_function("hash_pairs", |b| {
+        b.iter(|| hashfn.hash_pairs(&mut output, &input))
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    benchmark_poseidon_mix,
+    benchmark_poseidon2_mix,
+    benchmark_poseidon2_rows,
+    benchmark_poseidon2_pairs
+);
 criterion_main!(benches);
@@ -0,0 +1,55 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use risc0_core::field::{
+    baby_bear::{BabyBear, BabyBearElem},
+    Elem,
+};
+use risc0_zkp::{
+    core::hash::sha::Sha256HashSuite,
+    hal::{cpu::CpuHal, Hal},
+    INV_RATE,
+};
+
+// Runs with the native NTT when built with the `cpu-ntt` feature.  A single
+// row is transformed the way the check polynomial and FRI rounds are, and 64
+// rows the way the register groups are.
+fn benchmark_ntt(c: &mut Criterion) {
+    let hal: CpuHal<BabyBear> = CpuHal::new(Sha256HashSuite::new_suite());
+    let expand_bits = INV_RATE.ilog2() as usize;
+    let mut rng = rand::thread_rng();
+    for (count, po2s) in [(1, &[12, 16, 20, 22][..]), (64, &[12, 16][..])] {
+        let mut group = c.benchmark_group(format!("ntt/{count}"));
+        group.sample_size(10);
+        for &po2 in po2s {
+            let size = count << po2;
+            let input: Vec<_> = (0..size >> expand_bits)
+                .map(|_| BabyBearElem::random(&mut rng))
+                .collect();
+            let input = hal.copy_from_elem("input", &input);
+            let io = hal.alloc_elem("io", size);
+            group.throughput(Throughput::Elements(size as u64));
+            group.bench_function(BenchmarkId::new("evaluate", po2), |b| {
+                b.iter(|| hal.batch_expand_into_evaluate_ntt(&io, &input, count, expand_bits))
+            });
+            group.bench_function(BenchmarkId::new("interpolate", po2), |b| {
+                b.iter(|| hal.batch_interpolate_ntt(&io, count))
+            });
+        }
+    }
+}
+
+criterion_group!(benches, benchmark_ntt);
+criterion_main!(benches);
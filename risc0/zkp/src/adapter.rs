@@ -15,6 +15,7 @@
 //! Interface between the circuit and prover/verifier
 
 use alloc::vec::Vec;
+use core::ops::Range;
 
 use anyhow::Result;
 use risc0_core::field::{Elem, ExtElem, Field};
@@ -33,7 +34,138 @@ pub struct MixState<EE: ExtElem> {
     pub mul: EE,
 }
 
+/// Identifies an extern emitted by the circuit generator.
+///
+/// The discriminants are shared with `ExternId` in the generated C++
+/// (`cxx/ffi.h`) so that externs can be dispatched without comparing names.
+#[derive(Clone, Copy, Debug, PartialEq, Eq, PartialOrd, Ord)]
+#[repr(u32)]
+pub enum ExternId {
+    Halt = 0,
+    Trace = 1,
+    GetMajor = 2,
+    GetMinor = 3,
+    Divide = 4,
+    BigintQuotient = 5,
+    PageInfo = 6,
+    RamWrite = 7,
+    RamRead = 8,
+    PlonkWrite = 9,
+    PlonkRead = 10,
+    PlonkWriteAccum = 11,
+    PlonkReadAccum = 12,
+    Log = 13,
+    SyscallInit = 14,
+    SyscallBody = 15,
+    SyscallFini = 16,
+    WomWrite = 17,
+    WomRead = 18,
+    ReadIOPHeader = 19,
+    ReadIOPBody = 20,
+}
+
+impl ExternId {
+    pub const COUNT: usize = 21;
+
+    const ALL: [ExternId; Self::COUNT] = [
+        ExternId::Halt,
+        ExternId::Trace,
+        ExternId::GetMajor,
+        ExternId::GetMinor,
+        ExternId::Divide,
+        ExternId::BigintQuotient,
+        ExternId::PageInfo,
+        ExternId::RamWrite,
+        ExternId::RamRead,
+        ExternId::PlonkWrite,
+        ExternId::PlonkRead,
+        ExternId::PlonkWriteAccum,
+        ExternId::PlonkReadAccum,
+        ExternId::Log,
+        ExternId::SyscallInit,
+        ExternId::SyscallBody,
+        ExternId::SyscallFini,
+        ExternId::WomWrite,
+        ExternId::WomRead,
+        ExternId::ReadIOPHeader,
+        ExternId::ReadIOPBody,
+    ];
+
+    pub const fn from_u32(id: u32) -> Option<Self> {
+        if (id as usize) < Self::COUNT {
+            Some(Self::ALL[id as usize])
+        } else {
+            None
+        }
+    }
+
+    /// Looks up an extern by the name used in the string-keyed bridge.
+    pub fn from_name(name: &str) -> Option<Self> {
+        Self::ALL.into_iter().find(|id| id.name() == name)
+    }
+
+    /// The name of this extern in the string-keyed bridge.
+    pub const fn name(self) -> &'static str {
+        match self {
+            ExternId::Halt => "halt",
+            ExternId::Trace => "trace",
+            ExternId::GetMajor => "getMajor",
+            ExternId::GetMinor => "getMinor",
+            ExternId::Divide => "divide",
+            ExternId::BigintQuotient => "bigintQuotient",
+            ExternId::PageInfo => "pageInfo",
+            ExternId::RamWrite => "ramWrite",
+            ExternId::RamRead => "ramRead",
+            ExternId::PlonkWrite => "plonkWrite",
+            ExternId::PlonkRead => "plonkRead",
+            ExternId::PlonkWriteAccum => "plonkWriteAccum",
+            ExternId::PlonkReadAccum => "plonkReadAccum",
+            ExternId::Log => "log",
+            ExternId::SyscallInit => "syscallInit",
+            ExternId::SyscallBody => "syscallBody",
+            ExternId::SyscallFini => "syscallFini",
+            ExternId::WomWrite => "womWrite",
+            ExternId::WomRead => "womRead",
+            ExternId::ReadIOPHeader => "readIOPHeader",
+            ExternId::ReadIOPBody => "readIOPBody",
+        }
+    }
+}
+
+/// Interned form of the `extra` argument of an extern.
+///
+/// Plonk kinds have fixed ids shared by all circuits; ids from
+/// [ExtraId::FIRST_LOG] onwards name the log formats of a particular circuit.
+#[derive(Clone, Copy, Debug, PartialEq, Eq, PartialOrd, Ord)]
+#[repr(transparent)]
+pub struct ExtraId(pub u32);
+
+impl ExtraId {
+    pub const NONE: ExtraId = ExtraId(0);
+    pub const BYTES: ExtraId = ExtraId(1);
+    pub const RAM: ExtraId = ExtraId(2);
+    pub const WOM: ExtraId = ExtraId(3);
+    pub const FIRST_LOG: ExtraId = ExtraId(4);
+
+    /// Interns an `extra` string from the string-keyed bridge.
+    ///
+    /// Log formats aren't known here and map to [ExtraId::NONE].
+    pub fn from_name(extra: &str) -> Self {
+        match extra {
+            "bytes" => ExtraId::BYTES,
+            "ram" => ExtraId::RAM,
+            "wom" => ExtraId::WOM,
+            _ => ExtraId::NONE,
+        }
+    }
+}
+
 pub trait CircuitStepHandler<E: Elem> {
+    /// Whether the circuit should dispatch externs through [Self::call_extern].
+    ///
+    /// When false, every extern goes through the string-keyed [Self::call].
+    const TYPED_EXTERNS: bool = true;
+
     fn call(
         &mut self,
         cycle: usize,
@@ -43,9 +175,47 @@ pub trait CircuitStepHandler<E: Elem> {
         outs: &mut [E],
     ) -> Result<()>;
 
+    /// Performs an extern call identified by [ExternId].
+    ///
+    /// `extra` is the string form of `extra_id`. The default implementation
+    /// forwards to [Self::call].
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        extra_id: ExtraId,
+        extra: &str,
+        args: &[E],
+        outs: &mut [E],
+    ) -> Result<()> {
+        let _ = extra_id;
+        self.call(cycle, id.name(), extra, args, outs)
+    }
+
     fn sort(&mut self, name: &str);
 }
 
+/// A [CircuitStepHandler] that can run a plonk verify phase over many ranges
+/// of cycles at once.
+///
+/// A verify phase reads back the plonk table it is named after in sorted
+/// order.  Once the table is sorted, where the reads of each cycle start in
+/// it is fixed, so each range of cycles can be given its own handler.
+pub trait PlonkVerifyHandler<E: Elem>: CircuitStepHandler<E> {
+    /// Handles the externs of one range of cycles.
+    type Chunk<'a>: CircuitStepHandler<E>
+    where
+        Self: 'a;
+
+    /// Runs `verify` over ranges covering cycles `0..cycles` of the verify
+    /// phase reading the sorted plonk table `name`.
+    ///
+    /// Ranges may run concurrently and in any order.
+    fn run_verify<V>(&mut self, name: &str, cycles: usize, verify: V) -> Result<()>
+    where
+        V: for<'a> Fn(&mut Self::Chunk<'a>, Range<usize>) -> Result<()> + Sync;
+}
+
 pub struct CircuitStepContext {
     pub size: usize,
     pub cycle: usize,
@@ -86,16 +256,135 @@ pub trait CircuitStep<E: Elem> {
         custom: &mut S,
         args: &[SyncSlice<E>],
     ) -> Result<E>;
+
+    /// Runs `step_exec` for every cycle in `cycles` and returns the result of
+    /// the last one.
+    fn step_exec_range<S: CircuitStepHandler<E>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        custom: &mut S,
+        args: &[SyncSlice<E>],
+    ) -> Result<E> {
+        step_range(size, cycles, |ctx| self.step_exec(ctx, custom, args))
+    }
+
+    /// Runs `step_verify_bytes` for every cycle in `cycles` and returns the
+    /// result of the last one.
+    fn step_verify_bytes_range<S: CircuitStepHandler<E>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        custom: &mut S,
+        args: &[SyncSlice<E>],
+    ) -> Result<E> {
+        step_range(size, cycles, |ctx| {
+            self.step_verify_bytes(ctx, custom, args)
+        })
+    }
+
+    /// Runs `step_verify_mem` for every cycle in `cycles` and returns the
+    /// result of the last one.
+    fn step_verify_mem_range<S: CircuitStepHandler<E>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        custom: &mut S,
+        args: &[SyncSlice<E>],
+    ) -> Result<E> {
+        step_range(size, cycles, |ctx| self.step_verify_mem(ctx, custom, args))
+    }
+
+    /// Runs `step_compute_accum` for every cycle in `cycles` and returns the
+    /// result of the last one.
+    fn step_compute_accum_range<S: CircuitStepHandler<E>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        custom: &mut S,
+        args: &[SyncSlice<E>],
+    ) -> Result<E> {
+        step_range(size, cycles, |ctx| {
+            self.step_compute_accum(ctx, custom, args)
+        })
+    }
+
+    /// Runs `step_verify_accum` for every cycle in `cycles` and returns the
+    /// result of the last one.
+    fn step_verify_accum_range<S: CircuitStepHandler<E>>(
+        &self,
+        size: usize,
+        cycles: Range<usize>,
+        custom: &mut S,
+        args: &[SyncSlice<E>],
+    ) -> Result<E> {
+        step_range(size, cycles, |ctx| {
+            self.step_verify_accum(ctx, custom, args)
+        })
+    }
+}
+
+/// Default implementation of the `CircuitStep::step_*_range` methods, for
+/// circuits that have no batched entry point.
+fn step_range<E: Elem>(
+    size: usize,
+    cycles: Range<usize>,
+    mut step: impl FnMut(&CircuitStepContext) -> Result<E>,
+) -> Result<E> {
+    let mut result = E::ZERO;
+    for cycle in cycles {
+        result = step(&CircuitStepContext { size, cycle })?;
+    }
+    Ok(result)
 }
 
 pub trait PolyFp<F: Field> {
+    /// Returns the powers of `mix`, starting at `mix^0`, that `poly_fp`
+    /// combines the constraints with.
+    ///
+    /// They don't depend on the cycle, so callers compute them once per
+    /// `mix` and share them between cycles.
+    fn poly_mix_pows(&self, mix: &F::ExtElem) -> Vec<F::ExtElem>;
+
     fn poly_fp(
         &self,
         cycle: usize,
         steps: usize,
-        mix: &F::ExtElem,
+        mix_pows: &[F::ExtElem],
         args: &[&[F::Elem]],
     ) -> F::ExtElem;
+
+    /// Evaluates `poly_fp` for `out.len()` consecutive cycles starting at
+    /// `cycle`.
+    fn poly_fp_batch(
+        &self,
+        cycle: usize,
+        steps: usize,
+        mix_pows: &[F::ExtElem],
+        args: &[&[F::Elem]],
+        out: &mut [F::ExtElem],
+    ) {
+        for (i, out) in out.iter_mut().enumerate() {
+            *out = self.poly_fp(cycle + i, steps, mix_pows, args);
+        }
+    }
+
+    /// Evaluates `poly_fp` divided by the zerofier over the whole
+    /// `INV_RATE * steps` domain, writing element `i` of row `cycle` to
+    /// `check[i * INV_RATE * steps + cycle]`.
+    ///
+    /// Returns `false` if the circuit has no such driver, in which case the
+    /// caller has to evaluate the domain itself.
+    fn eval_check(
+        &self,
+        _check: &mut [F::Elem],
+        _args: &[&[F::Elem]],
+        _mix_pows: &[F::ExtElem],
+        _po2: usize,
+        _steps: usize,
+    ) -> bool {
+        false
+    }
 }
 
 pub trait PolyExt<F: Field> {
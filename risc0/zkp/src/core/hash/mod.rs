@@ -21,7 +21,7 @@ pub mod poseidon2;
 pub mod poseidon_254;
 pub mod sha;
 
-use alloc::{boxed::Box, rc::Rc, string::String};
+use alloc::{boxed::Box, rc::Rc, string::String, vec::Vec};
 
 use risc0_core::field::Field;
 
@@ -39,6 +39,33 @@ pub trait HashFn<F: Field>: Send + Sync {
     /// Generate a hash from a slice of extension field element.  This may be
     /// unpadded so this is only safe to used when the size is known.
     fn hash_ext_elem_slice(&self, slice: &[F::ExtElem]) -> Box<Digest>;
+
+    /// Generate a hash of each pair of adjacent [Digest]s in `input`, writing
+    /// the hash of `input[2 * i]` and `input[2 * i + 1]` to `output[i]`.
+    fn hash_pairs(&self, output: &mut [Digest], input: &[Digest]) {
+        for (output, pair) in output.iter_mut().zip(input.chunks_exact(2)) {
+            *output = *self.hash_pair(&pair[0], &pair[1]);
+        }
+    }
+
+    /// Generate a hash of each row of a column-major matrix of field elements,
+    /// in the same way as [hash_elem_slice](HashFn::hash_elem_slice). Row `i`
+    /// has `col_size` elements, the `j`-th of which is
+    /// `matrix[j * stride + i]`, and its hash is written to `output[i]`.
+    fn hash_elem_rows(
+        &self,
+        output: &mut [Digest],
+        matrix: &[F::Elem],
+        stride: usize,
+        col_size: usize,
+    ) {
+        let mut row = Vec::with_capacity(col_size);
+        for (idx, output) in output.iter_mut().enumerate() {
+            row.clear();
+            row.extend((0..col_size).map(|col| matrix[col * stride + idx]));
+            *output = *self.hash_elem_slice(row.as_slice());
+        }
+    }
 }
 
 /// A trait that sets the PRNG used by Fiat-Shamir.  We allow specialization at
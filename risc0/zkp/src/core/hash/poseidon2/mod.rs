@@ -59,6 +59,70 @@ impl HashFn<BabyBear> for Poseidon2HashFn {
             slice.iter().flat_map(|ee| ee.subelems().iter()),
         ))
     }
+
+    #[cfg(all(not(target_os = "zkvm"), feature = "cpu-poseidon2"))]
+    fn hash_pairs(&self, output: &mut [Digest], input: &[Digest]) {
+        native::fold(output, input)
+    }
+
+    #[cfg(all(not(target_os = "zkvm"), feature = "cpu-poseidon2"))]
+    fn hash_elem_rows(
+        &self,
+        output: &mut [Digest],
+        matrix: &[BabyBearElem],
+        stride: usize,
+        col_size: usize,
+    ) {
+        native::rows(output, matrix, stride, col_size)
+    }
+}
+
+/// The batched Poseidon2 in risc0-sys, which permutes several states at once
+/// in SIMD lanes.
+#[cfg(all(not(target_os = "zkvm"), feature = "cpu-poseidon2"))]
+mod native {
+    use risc0_core::field::baby_bear::BabyBearElem;
+    use risc0_sys::cpu::{risc0_zkp_cpu_poseidon2_fold, risc0_zkp_cpu_poseidon2_rows};
+
+    use super::consts::{M_INT_DIAG_ULVT, ROUND_CONSTANTS};
+    use crate::core::digest::Digest;
+
+    /// Hashes each pair of adjacent digests in `input` into `output`.
+    pub fn fold(output: &mut [Digest], input: &[Digest]) {
+        assert!(input.len() >= 2 * output.len());
+        unsafe {
+            risc0_zkp_cpu_poseidon2_fold(
+                ROUND_CONSTANTS.as_ptr() as *const u32,
+                M_INT_DIAG_ULVT.as_ptr() as *const u32,
+                output.as_mut_ptr() as *mut u32,
+                input.as_ptr() as *const u32,
+                output.len(),
+            )
+        };
+    }
+
+    /// Hashes each row of the column-major `matrix` into `output`, as
+    /// [HashFn::hash_elem_rows](crate::core::hash::HashFn::hash_elem_rows).
+    pub fn rows(output: &mut [Digest], matrix: &[BabyBearElem], stride: usize, col_size: usize) {
+        if output.is_empty() {
+            return;
+        }
+        if col_size > 0 {
+            assert!(output.len() <= stride);
+            assert!(matrix.len() >= (col_size - 1) * stride + output.len());
+        }
+        unsafe {
+            risc0_zkp_cpu_poseidon2_rows(
+                ROUND_CONSTANTS.as_ptr() as *const u32,
+                M_INT_DIAG_ULVT.as_ptr() as *const u32,
+                output.as_mut_ptr() as *mut u32,
+                matrix.as_ptr() as *const u32,
+                stride,
+                output.len(),
+                col_size,
+            )
+        };
+    }
 }
 
 struct Poseidon2RngFactory;
@@ -336,6 +400,36 @@ mod tests {
         tracing::debug!("output: {:?}", buf);
     }
 
+    #[cfg(feature = "cpu-poseidon2")]
+    #[test]
+    fn native_matches_scalar() {
+        use alloc::vec;
+
+        let hashfn = Poseidon2HashFn {};
+        // Counts on either side of the lanes of a batch, and column counts short
+        // of, at, and past the rate.
+        for (rows, cols) in [(1, 0), (5, 7), (16, 16), (37, 17), (64, 40)] {
+            let stride = rows + 3;
+            let matrix: Vec<Elem> = (0..(stride * cols) as u32)
+                .map(|x| Elem::new(x * 7 + 3))
+                .collect();
+            let mut actual = vec![Digest::ZERO; rows];
+            native::rows(&mut actual, &matrix, stride, cols);
+            for (idx, actual) in actual.iter().enumerate() {
+                let row: Vec<Elem> = (0..cols).map(|col| matrix[col * stride + idx]).collect();
+                assert_eq!(*hashfn.hash_elem_slice(&row), *actual);
+            }
+
+            let input: Vec<Digest> = actual.iter().cycle().take(2 * rows).copied().collect();
+            let mut actual = vec![Digest::ZERO; rows];
+            native::fold(&mut actual, &input);
+            for (idx, actual) in actual.iter().enumerate() {
+                let expected = hashfn.hash_pair(&input[2 * idx], &input[2 * idx + 1]);
+                assert_eq!(*expected, *actual);
+            }
+        }
+    }
+
     #[test]
     fn poseidon2_ext_matrices_match() {
         for i in 0..CELLS {
@@ -16,6 +16,8 @@
 
 #[cfg(not(target_os = "zkvm"))]
 pub mod cpu;
+#[cfg(all(not(target_os = "zkvm"), feature = "cpu-sha"))]
+pub mod native;
 #[cfg(not(target_os = "zkvm"))]
 mod rng;
 pub mod rust_crypto;
@@ -115,6 +117,24 @@ pub trait Sha256 {
     /// add the standard SHA-256 trailer and so is not a standards compliant
     /// hash.
     fn hash_raw_pod_slice<T: bytemuck::Pod>(slice: &[T]) -> Self::DigestPtr;
+
+    /// Generate a hash of each row of a column-major matrix of plain old data,
+    /// in the same way as [hash_raw_pod_slice](Sha256::hash_raw_pod_slice).
+    /// Row `i` has `col_size` elements, the `j`-th of which is
+    /// `matrix[j * stride + i]`, and its hash is written to `output[i]`.
+    fn hash_raw_pod_rows<T: bytemuck::Pod>(
+        output: &mut [Digest],
+        matrix: &[T],
+        stride: usize,
+        col_size: usize,
+    ) {
+        let mut row = Vec::with_capacity(col_size);
+        for (idx, output) in output.iter_mut().enumerate() {
+            row.clear();
+            row.extend((0..col_size).map(|col| matrix[col * stride + idx]));
+            *output = *Self::hash_raw_pod_slice(row.as_slice());
+        }
+    }
 }
 
 /// Input block to the SHA-256 hashing algorithm. SHA-256 consumes blocks in
@@ -303,20 +323,32 @@ impl Debug for Block {
 
 /// Wrap a Sha256 trait as a HashFn trait
 #[cfg(not(target_os = "zkvm"))]
-struct Sha256HashFn;
+struct Sha256HashFn<S> {
+    phantom: PhantomData<fn() -> S>,
+}
 
 #[cfg(not(target_os = "zkvm"))]
-impl<F: Field> super::HashFn<F> for Sha256HashFn {
+impl<F: Field, S: Sha256<DigestPtr = Box<Digest>>> super::HashFn<F> for Sha256HashFn<S> {
     fn hash_pair(&self, a: &Digest, b: &Digest) -> Box<Digest> {
-        cpu::Impl::hash_pair(a, b)
+        S::hash_pair(a, b)
     }
 
     fn hash_elem_slice(&self, slice: &[F::Elem]) -> Box<Digest> {
-        cpu::Impl::hash_raw_pod_slice(slice)
+        S::hash_raw_pod_slice(slice)
     }
 
     fn hash_ext_elem_slice(&self, slice: &[F::ExtElem]) -> Box<Digest> {
-        cpu::Impl::hash_raw_pod_slice(slice)
+        S::hash_raw_pod_slice(slice)
+    }
+
+    fn hash_elem_rows(
+        &self,
+        output: &mut [Digest],
+        matrix: &[F::Elem],
+        stride: usize,
+        col_size: usize,
+    ) {
+        S::hash_raw_pod_rows(output, matrix, stride, col_size)
     }
 }
 
@@ -330,6 +362,12 @@ impl<F: Field> super::RngFactory<F> for Sha256RngFactory {
     }
 }
 
+/// The [Sha256] implementation of [Sha256HashSuite::new_suite].
+#[cfg(all(not(target_os = "zkvm"), feature = "cpu-sha"))]
+type DefaultImpl = native::Impl;
+#[cfg(all(not(target_os = "zkvm"), not(feature = "cpu-sha")))]
+type DefaultImpl = cpu::Impl;
+
 /// Make a hash suite from a Sha256 trait
 pub struct Sha256HashSuite<F: Field> {
     phantom: PhantomData<F>,
@@ -339,10 +377,19 @@ pub struct Sha256HashSuite<F: Field> {
 impl<F: Field> Sha256HashSuite<F> {
     /// Construct a Sha256HashSuite
     pub fn new_suite() -> super::HashSuite<F> {
+        Self::new_suite_with_impl::<DefaultImpl>()
+    }
+
+    /// Construct a Sha256HashSuite that hashes with the given [Sha256]
+    /// implementation.
+    pub fn new_suite_with_impl<S: Sha256<DigestPtr = Box<Digest>> + 'static>(
+    ) -> super::HashSuite<F> {
         use alloc::rc::Rc;
         super::HashSuite {
             name: "sha-256".into(),
-            hashfn: Rc::new(Sha256HashFn {}),
+            hashfn: Rc::new(Sha256HashFn::<S> {
+                phantom: PhantomData,
+            }),
             rng: Rc::new(Sha256RngFactory {}),
         }
     }
@@ -350,7 +397,7 @@ impl<F: Field> Sha256HashSuite<F> {
 
 #[allow(missing_docs)]
 pub mod testutil {
-    use alloc::vec::Vec;
+    use alloc::{vec, vec::Vec};
     use core::ops::Deref;
 
     use hex::FromHex;
@@ -371,6 +418,7 @@ pub mod testutil {
         test_sha_basics::<S>();
         test_elems::<S>();
         test_extelems::<S>();
+        test_elem_rows::<S>();
     }
 
     fn test_sha_basics<S: Sha256>() {
@@ -491,6 +539,24 @@ pub mod testutil {
         assert_eq!(expected, actual);
     }
 
+    fn test_elem_rows<S: Sha256>() {
+        // Row counts on either side of the sizes of multi-row implementations, and
+        // column counts short of, at, and past a block.
+        for (rows, cols) in [(1, 0), (3, 7), (16, 16), (37, 17), (64, 33)] {
+            let stride = rows + 5;
+            let matrix: Vec<BabyBearElem> = (0..(stride * cols) as u32)
+                .map(|x| BabyBearElem::new(x * 7 + 3))
+                .collect();
+            let mut actual = vec![Digest::ZERO; rows];
+            S::hash_raw_pod_rows(&mut actual, &matrix, stride, cols);
+            for (idx, actual) in actual.iter().enumerate() {
+                let row: Vec<BabyBearElem> =
+                    (0..cols).map(|col| matrix[col * stride + idx]).collect();
+                assert_eq!(*S::hash_raw_pod_slice(row.as_slice()), *actual);
+            }
+        }
+    }
+
     fn test_hash_raw_pod_slice<S: Sha256>() {
         {
             let items: &[u32] = &[1];
@@ -0,0 +1,93 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! A [Sha256] implementation that hashes rows with the multi-buffer SHA-256 in
+//! risc0-sys.
+
+use alloc::boxed::Box;
+
+use risc0_sys::cpu::risc0_zkp_cpu_sha_rows;
+
+use super::{cpu, Block, Sha256};
+use crate::core::digest::Digest;
+
+/// A CPU-based [Sha256] implementation that hashes the rows of a matrix
+/// several at a time, in SIMD lanes or with the SHA extensions, depending on
+/// what the target supports. Everything else is hashed by [cpu::Impl].
+#[derive(Default, Clone)]
+pub struct Impl {}
+
+impl Sha256 for Impl {
+    type DigestPtr = Box<Digest>;
+
+    fn hash_bytes(bytes: &[u8]) -> Self::DigestPtr {
+        cpu::Impl::hash_bytes(bytes)
+    }
+
+    fn hash_words(words: &[u32]) -> Self::DigestPtr {
+        cpu::Impl::hash_words(words)
+    }
+
+    fn compress(state: &Digest, block_half1: &Digest, block_half2: &Digest) -> Self::DigestPtr {
+        cpu::Impl::compress(state, block_half1, block_half2)
+    }
+
+    fn compress_slice(state: &Digest, blocks: &[Block]) -> Self::DigestPtr {
+        cpu::Impl::compress_slice(state, blocks)
+    }
+
+    fn hash_raw_pod_slice<T: bytemuck::Pod>(pod: &[T]) -> Self::DigestPtr {
+        cpu::Impl::hash_raw_pod_slice(pod)
+    }
+
+    fn hash_raw_pod_rows<T: bytemuck::Pod>(
+        output: &mut [Digest],
+        matrix: &[T],
+        stride: usize,
+        col_size: usize,
+    ) {
+        // The native rows are made of words, one per element, which covers field
+        // elements.
+        let words = match bytemuck::try_cast_slice::<T, u32>(matrix) {
+            Ok(words) if words.len() == matrix.len() => words,
+            _ => return cpu::Impl::hash_raw_pod_rows(output, matrix, stride, col_size),
+        };
+        if output.is_empty() {
+            return;
+        }
+        if col_size > 0 {
+            assert!(output.len() <= stride);
+            assert!(words.len() >= (col_size - 1) * stride + output.len());
+        }
+        unsafe {
+            risc0_zkp_cpu_sha_rows(
+                output.as_mut_ptr() as *mut u32,
+                words.as_ptr(),
+                stride,
+                output.len(),
+                col_size,
+            )
+        };
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::Impl;
+
+    #[test]
+    fn test_impl() {
+        crate::core::hash::sha::testutil::test_sha_impl::<Impl>();
+    }
+}
@@ -16,6 +16,7 @@
 
 use core::{
     cell::{Ref, RefMut},
+    cmp,
     ops::Range,
 };
 use std::{cell::RefCell, fmt::Debug, rc::Rc};
@@ -323,6 +324,10 @@ impl<F: Field> Hal for CpuHal<F> {
         {
             let row_size = output.size() / count;
             assert_eq!(row_size * count, output.size());
+            #[cfg(feature = "cpu-ntt")]
+            if native_ntt::batch_evaluate(&mut output.as_slice_mut(), count, expand_bits) {
+                return;
+            }
             output
                 .as_slice_mut()
                 .par_chunks_exact_mut(row_size)
@@ -336,6 +341,10 @@ impl<F: Field> Hal for CpuHal<F> {
     fn batch_interpolate_ntt(&self, io: &Self::Buffer<Self::Elem>, count: usize) {
         let row_size = io.size() / count;
         assert_eq!(row_size * count, io.size());
+        #[cfg(feature = "cpu-ntt")]
+        if native_ntt::batch_interpolate(&mut io.as_slice_mut(), count) {
+            return;
+        }
         io.as_slice_mut()
             .par_chunks_exact_mut(row_size)
             .for_each(|row| {
@@ -391,17 +400,56 @@ impl<F: Field> Hal for CpuHal<F> {
     #[tracing::instrument(skip_all)]
     fn zk_shift(&self, io: &Self::Buffer<Self::Elem>, poly_count: usize) {
         let bits = log2_ceil(io.size() / poly_count);
-        let count = io.size();
         assert_eq!(io.size(), poly_count * (1 << bits));
-        let mut io = io.as_slice_mut();
-        (&mut io[..], 0..count)
-            .into_par_iter()
-            .for_each(|(io, idx)| {
-                let pos = idx & ((1 << bits) - 1);
-                let rev = bit_rev_32(pos as u32) >> (32 - bits);
-                let pow3 = Self::Elem::from_u64(3).pow(rev as usize);
-                *io *= pow3;
+        let factors = zk_shift_factors::<Self::Elem>(bits);
+        let chunk_size = cmp::min(factors.len(), ZK_SHIFT_CHUNK_SIZE);
+        io.as_slice_mut()
+            .par_chunks_exact_mut(chunk_size)
+            .enumerate()
+            .for_each(|(i, chunk)| {
+                let offset = i * chunk_size % factors.len();
+                for (x, factor) in chunk.iter_mut().zip(&factors[offset..]) {
+                    *x *= *factor;
+                }
+            });
+    }
+
+    #[tracing::instrument(skip_all)]
+    fn zk_shift_expand_into_evaluate_ntt(
+        &self,
+        output: &Self::Buffer<Self::Elem>,
+        input: &Self::Buffer<Self::Elem>,
+        count: usize,
+        expand_bits: usize,
+    ) {
+        let out_size = output.size() / count;
+        let in_size = input.size() / count;
+        let bits = log2_ceil(in_size);
+        assert_eq!(in_size, 1 << bits);
+        assert_eq!(out_size, in_size << expand_bits);
+        assert_eq!(out_size * count, output.size());
+        assert_eq!(in_size * count, input.size());
+        let factors = zk_shift_factors::<Self::Elem>(bits);
+        let mut output = output.as_slice_mut();
+        // Each row is shifted, expanded and evaluated while it is in cache.
+        output
+            .par_chunks_exact_mut(out_size)
+            .zip(input.as_slice_mut().par_chunks_exact_mut(in_size))
+            .for_each(|(output, input)| {
+                for (x, factor) in input.iter_mut().zip(factors.iter()) {
+                    *x *= *factor;
+                }
+                expand(output, input, expand_bits);
+                #[cfg(not(feature = "cpu-ntt"))]
+                evaluate_ntt::<Self::Elem, Self::Elem>(output, expand_bits);
+            });
+        // The native NTT transforms all the rows at once.
+        #[cfg(feature = "cpu-ntt")]
+        if !native_ntt::batch_evaluate(&mut output, count, expand_bits) {
+            output.par_chunks_exact_mut(out_size).for_each(|row| {
+                evaluate_ntt::<Self::Elem, Self::Elem>(row, expand_bits);
             });
+        }
     }
 
     fn mix_poly_coeffs(
@@ -555,25 +603,85 @@ impl<F: Field> Hal for CpuHal<F> {
         let mut output = output.as_slice_mut();
         let matrix = &*matrix.as_slice();
         let hashfn = self.suite.hashfn.as_ref();
-        output.par_iter_mut().enumerate().for_each(|(idx, output)| {
-            let column: Vec<Self::Elem> =
-                (0..col_size).map(|i| matrix[i * row_size + idx]).collect();
-            *output = *hashfn.hash_elem_slice(column.as_slice());
-        });
+        // Rows are handed to the hash a chunk at a time, so that an
+        // implementation can hash several of them at once.
+        const CHUNK_ROWS: usize = 256;
+        output
+            .par_chunks_mut(CHUNK_ROWS)
+            .enumerate()
+            .for_each(|(idx, output)| {
+                let matrix = &matrix[idx * CHUNK_ROWS..];
+                hashfn.hash_elem_rows(output, matrix, row_size, col_size);
+            });
     }
 
     fn hash_fold(&self, io: &Self::Buffer<Digest>, input_size: usize, output_size: usize) {
         assert!(io.size() >= 2 * input_size);
         assert_eq!(input_size, 2 * output_size);
-        let io = io.as_slice_sync();
-        let output = io.slice(output_size, output_size);
-        let input = io.slice(input_size, input_size);
+        let mut io = io.as_slice_mut();
+        let (lower, upper) = io.split_at_mut(input_size);
+        let output = &mut lower[output_size..];
+        let input = &upper[..input_size];
         let hashfn = self.suite.hashfn.as_ref();
-        (0..output.size()).into_par_iter().for_each(|idx| {
-            let in1 = input.get(2 * idx);
-            let in2 = input.get(2 * idx + 1);
-            output.set(idx, *hashfn.hash_pair(&in1, &in2));
-        });
+        // Nodes are handed to the hash a chunk at a time, so that an
+        // implementation can hash several of them at once.
+        const CHUNK_NODES: usize = 256;
+        output
+            .par_chunks_mut(CHUNK_NODES)
+            .zip(input.par_chunks(2 * CHUNK_NODES))
+            .for_each(|(output, input)| hashfn.hash_pairs(output, input));
+    }
+
+    fn hash_tree(&self, matrix: &Self::Buffer<Self::Elem>, rows: usize) -> Vec<Digest> {
+        assert!(rows.is_power_of_two());
+        let matrix = &*matrix.as_slice();
+        let col_size = matrix.len() / rows;
+        assert_eq!(matrix.len(), col_size * rows);
+        let hashfn = self.suite.hashfn.as_ref();
+        // The tree is cut into subtrees of at most 2^12 leaves, whose nodes fit
+        // in cache, and into enough subtrees to keep every thread busy.  Each
+        // subtree is hashed from its leaves to its root by a single task.
+        const MAX_SUBTREE_ROWS: usize = 1 << 12;
+        let tasks = (4 * rayon::current_num_threads()).next_power_of_two();
+        let subtree_rows = (rows / tasks).clamp(1, MAX_SUBTREE_ROWS);
+        let count = rows / subtree_rows;
+        let mut nodes = vec![Digest::ZERO; 2 * rows];
+
+        // The layers of each subtree, from its leaves up.
+        let mut subtrees: Vec<Vec<&mut [Digest]>> = (0..count).map(|_| Vec::new()).collect();
+        let mut upper = nodes.as_mut_slice();
+        let mut layer_size = rows;
+        while layer_size >= count {
+            let (rest, layer) = core::mem::take(&mut upper).split_at_mut(layer_size);
+            for (layers, part) in subtrees
+                .iter_mut()
+                .zip(layer.chunks_mut(layer_size / count))
+            {
+                layers.push(part);
+            }
+            upper = rest;
+            layer_size /= 2;
+        }
+        subtrees
+            .into_par_iter()
+            .enumerate()
+            .for_each(|(idx, mut layers)| {
+                let matrix = &matrix[idx * subtree_rows..];
+                hashfn.hash_elem_rows(&mut layers[0], matrix, rows, col_size);
+                for i in 1..layers.len() {
+                    let (lower, upper) = layers.split_at_mut(i);
+                    hashfn.hash_pairs(&mut upper[0], &lower[i - 1]);
+                }
+            });
+
+        // The layers above the subtrees are hashed on this thread.
+        let mut layer_size = count / 2;
+        while layer_size > 0 {
+            let (upper, lower) = nodes.split_at_mut(2 * layer_size);
+            hashfn.hash_pairs(&mut upper[layer_size..], &lower[..2 * layer_size]);
+            layer_size /= 2;
+        }
+        nodes
     }
 
     fn gather_sample(
@@ -600,14 +708,134 @@ impl<F: Field> Hal for CpuHal<F> {
     }
 }
 
+/// Number of elements [CpuHal::zk_shift] hands to a worker at a time.
+const ZK_SHIFT_CHUNK_SIZE: usize = 1 << 12;
+
+/// Returns the factors that [Hal::zk_shift] multiplies the rows of 2^bits
+/// coefficients by.  Coefficients are in bit reversed order, so coefficient
+/// `pos` of a row is multiplied by `3^bit_rev(pos)`.
+fn zk_shift_factors<E: Elem>(bits: usize) -> Vec<E> {
+    let size = 1 << bits;
+    let chunk_size = cmp::min(size, ZK_SHIFT_CHUNK_SIZE);
+    let three = E::from_u64(3);
+    let mut pows = vec![E::ZERO; size];
+    pows.par_chunks_exact_mut(chunk_size)
+        .enumerate()
+        .for_each(|(i, chunk)| {
+            let mut cur = three.pow(i * chunk_size);
+            for pow in chunk.iter_mut() {
+                *pow = cur;
+                cur *= three;
+            }
+        });
+    (0..size)
+        .into_par_iter()
+        .map(|pos| pows[(bit_rev_32(pos as u32) >> (32 - bits)) as usize])
+        .collect()
+}
+
+/// The native NTT in risc0-sys, which only transforms BabyBear rows.
+#[cfg(feature = "cpu-ntt")]
+mod native_ntt {
+    use core::{any::TypeId, cmp};
+
+    use rayon::prelude::*;
+    use risc0_core::field::{baby_bear::BabyBearElem, RootsOfUnity};
+    use risc0_sys::cpu::{
+        risc0_zkp_cpu_batch_evaluate_ntt, risc0_zkp_cpu_batch_interpolate_ntt,
+        risc0_zkp_cpu_ntt_pass_units, risc0_zkp_cpu_ntt_passes, risc0_zkp_cpu_ntt_run_pass,
+    };
+
+    use crate::core::log2_ceil;
+
+    // Returns `io` as raw BabyBear words and the log2 of its row size, if the
+    // native NTT can transform its rows.
+    fn as_raw<E: RootsOfUnity>(io: &mut [E], count: usize) -> Option<(&mut [u32], usize)> {
+        let row_size = io.len() / count;
+        let bits = log2_ceil(row_size);
+        let supported = TypeId::of::<E>() == TypeId::of::<BabyBearElem>()
+            && row_size == 1 << bits
+            && bits <= BabyBearElem::MAX_ROU_PO2;
+        // SAFETY: `E` is BabyBearElem, which is a single u32.
+        supported.then(|| {
+            let raw =
+                unsafe { std::slice::from_raw_parts_mut(io.as_mut_ptr() as *mut u32, io.len()) };
+            (raw, bits)
+        })
+    }
+
+    // Transforms the rows of `io` in parallel, or if there are too few rows to
+    // keep every thread busy, the blocks or tiles of each pass.
+    fn batch_ntt(io: &mut [u32], count: usize, bits: usize, expand_bits: usize, inverse: bool) {
+        let threads = rayon::current_num_threads();
+        if count >= threads {
+            io.par_chunks_exact_mut(1 << bits).for_each(|row| unsafe {
+                if inverse {
+                    risc0_zkp_cpu_batch_interpolate_ntt(row.as_mut_ptr(), 1, bits);
+                } else {
+                    risc0_zkp_cpu_batch_evaluate_ntt(row.as_mut_ptr(), 1, bits, expand_bits);
+                }
+            });
+            return;
+        }
+        // SAFETY: Each job only writes its own blocks or tiles of `io`, so
+        // sharing it between the jobs and writing through it is safe.
+        let io = unsafe { std::slice::from_raw_parts(io.as_ptr(), io.len()) };
+        for index in 0..unsafe { risc0_zkp_cpu_ntt_passes(bits, expand_bits, inverse) } {
+            let units =
+                count * unsafe { risc0_zkp_cpu_ntt_pass_units(bits, expand_bits, inverse, index) };
+            let chunk = cmp::max(1, units / (4 * threads));
+            (0..units)
+                .into_par_iter()
+                .step_by(chunk)
+                .for_each(|begin| unsafe {
+                    risc0_zkp_cpu_ntt_run_pass(
+                        io.as_ptr() as *mut u32,
+                        bits,
+                        expand_bits,
+                        inverse,
+                        index,
+                        begin,
+                        cmp::min(begin + chunk, units),
+                    )
+                });
+        }
+    }
+
+    /// Runs [evaluate_ntt](crate::core::ntt::evaluate_ntt) on each of the
+    /// `count` rows of `io`, or returns false if the rows aren't supported.
+    pub fn batch_evaluate<E: RootsOfUnity>(io: &mut [E], count: usize, expand_bits: usize) -> bool {
+        match as_raw(io, count) {
+            Some((io, bits)) if expand_bits <= bits => {
+                batch_ntt(io, count, bits, expand_bits, false);
+                true
+            }
+            _ => false,
+        }
+    }
+
+    /// Runs [interpolate_ntt](crate::core::ntt::interpolate_ntt) on each of
+    /// the `count` rows of `io`, or returns false if the rows aren't
+    /// supported.
+    pub fn batch_interpolate<E: RootsOfUnity>(io: &mut [E], count: usize) -> bool {
+        match as_raw(io, count) {
+            Some((io, bits)) => {
+                batch_ntt(io, count, bits, 0, true);
+                true
+            }
+            None => false,
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use hex::FromHex;
     use rand::thread_rng;
-    use risc0_core::field::baby_bear::BabyBear;
+    use risc0_core::field::baby_bear::{BabyBear, BabyBearElem};
 
     use super::*;
-    use crate::core::hash::sha::Sha256HashSuite;
+    use crate::core::hash::{poseidon2::Poseidon2HashSuite, sha::Sha256HashSuite};
 
     #[test]
     #[should_panic]
@@ -674,6 +902,77 @@ mod tests {
         });
     }
 
+    #[cfg(feature = "cpu-ntt")]
+    #[test]
+    fn native_ntt() {
+        let hal: CpuHal<BabyBear> = CpuHal::new(Sha256HashSuite::new_suite());
+        let mut rng = thread_rng();
+        // Sizes that only take blocks, and that take tiles as well, with fewer
+        // rows than threads, so the passes are split, and with more.
+        for (bits, count) in [(4, 3), (13, 2), (17, 1), (6, 1024)] {
+            let in_size = 1 << (bits - 2);
+            let input: Vec<_> = (0..in_size * count)
+                .map(|_| BabyBearElem::random(&mut rng))
+                .collect();
+            let mut golden = vec![BabyBearElem::ZERO; input.len() << 2];
+            for (row, input) in golden
+                .chunks_exact_mut(1 << bits)
+                .zip(input.chunks_exact(in_size))
+            {
+                expand(row, input, 2);
+                evaluate_ntt::<BabyBearElem, BabyBearElem>(row, 2);
+            }
+            let input = hal.copy_from_elem("input", &input);
+            let output = hal.alloc_elem("output", golden.len());
+            hal.batch_expand_into_evaluate_ntt(&output, &input, count, 2);
+            output.view(|output| assert_eq!(output, &golden[..]));
+
+            for row in golden.chunks_exact_mut(1 << bits) {
+                interpolate_ntt::<BabyBearElem, BabyBearElem>(row);
+            }
+            hal.batch_interpolate_ntt(&output, count);
+            output.view(|output| assert_eq!(output, &golden[..]));
+        }
+    }
+
+    #[test]
+    fn zk_shift_expand_into_evaluate_ntt() {
+        let hal: CpuHal<BabyBear> = CpuHal::new(Sha256HashSuite::new_suite());
+        let mut rng = thread_rng();
+        for (bits, count) in [(4, 3), (13, 2)] {
+            let coeffs: Vec<_> = (0..count << bits)
+                .map(|_| BabyBearElem::random(&mut rng))
+                .collect();
+            let shifted: Vec<_> = coeffs
+                .iter()
+                .enumerate()
+                .map(|(idx, coeff)| {
+                    let pos = idx & ((1 << bits) - 1);
+                    let rev = bit_rev_32(pos as u32) >> (32 - bits);
+                    *coeff * BabyBearElem::from_u64(3).pow(rev as usize)
+                })
+                .collect();
+            let mut evaluated = vec![BabyBearElem::ZERO; shifted.len() << 2];
+            for (row, shifted) in evaluated
+                .chunks_exact_mut(1 << (bits + 2))
+                .zip(shifted.chunks_exact(1 << bits))
+            {
+                expand(row, shifted, 2);
+                evaluate_ntt::<BabyBearElem, BabyBearElem>(row, 2);
+            }
+
+            let io = hal.copy_from_elem("io", &coeffs);
+            hal.zk_shift(&io, count);
+            io.view(|io| assert_eq!(io, &shifted[..]));
+
+            let input = hal.copy_from_elem("input", &coeffs);
+            let output = hal.alloc_elem("output", evaluated.len());
+            hal.zk_shift_expand_into_evaluate_ntt(&output, &input, count, 2);
+            input.view(|input| assert_eq!(input, &shifted[..]));
+            output.view(|output| assert_eq!(output, &evaluated[..]));
+        }
+    }
+
     #[test]
     fn hash_rows() {
         do_hash_rows(
@@ -682,4 +981,75 @@ mod tests {
             &["da5698be17b9b46962335799779fbeca8ce5d491c0d26243bafef9ea1837a9d8"],
         );
     }
+
+    #[test]
+    fn hash_rows_chunks() {
+        let mut rng = thread_rng();
+        // More rows than a chunk, and a column count that isn't a whole block.
+        let (rows, cols) = (1000, 37);
+        let input: Vec<_> = (0..rows * cols)
+            .map(|_| BabyBearElem::random(&mut rng))
+            .collect();
+        for suite in [Sha256HashSuite::new_suite(), Poseidon2HashSuite::new_suite()] {
+            let hal: CpuHal<BabyBear> = CpuHal::new(suite);
+            let hashfn = hal.get_hash_suite().hashfn.clone();
+            let matrix = hal.copy_from_elem("matrix", &input);
+            let output = hal.alloc_digest("output", rows);
+            hal.hash_rows(&output, &matrix);
+            output.view(|view| {
+                for (idx, actual) in view.iter().enumerate() {
+                    let row: Vec<_> = (0..cols).map(|col| input[col * rows + idx]).collect();
+                    assert_eq!(*hashfn.hash_elem_slice(&row), *actual);
+                }
+            });
+        }
+    }
+
+    #[test]
+    fn hash_fold_chunks() {
+        for suite in [Sha256HashSuite::new_suite(), Poseidon2HashSuite::new_suite()] {
+            let hal: CpuHal<BabyBear> = CpuHal::new(suite);
+            let hashfn = hal.get_hash_suite().hashfn.clone();
+            // More nodes than a chunk, and not a whole number of chunks.
+            let output_size = 300;
+            let input_size = 2 * output_size;
+            let digests: Vec<Digest> = (0..2 * input_size as u32)
+                .map(|x| *hashfn.hash_elem_slice(&[BabyBearElem::new(x)]))
+                .collect();
+            let io = hal.copy_from_digest("io", &digests);
+            hal.hash_fold(&io, input_size, output_size);
+            io.view(|view| {
+                for idx in 0..output_size {
+                    let input = &digests[input_size + 2 * idx..];
+                    let expected = hashfn.hash_pair(&input[0], &input[1]);
+                    assert_eq!(*expected, view[output_size + idx]);
+                }
+            });
+        }
+    }
+
+    #[test]
+    fn hash_tree() {
+        let mut rng = thread_rng();
+        for suite in [Sha256HashSuite::new_suite(), Poseidon2HashSuite::new_suite()] {
+            let hal: CpuHal<BabyBear> = CpuHal::new(suite);
+            // A single leaf, fewer leaves than subtrees, and several leaves per subtree.
+            for rows in [1, 4, 1 << 13] {
+                let cols = 3;
+                let input: Vec<_> = (0..rows * cols)
+                    .map(|_| BabyBearElem::random(&mut rng))
+                    .collect();
+                let matrix = hal.copy_from_elem("matrix", &input);
+                let nodes = hal.alloc_digest("nodes", rows * 2);
+                hal.hash_rows(&nodes.slice(rows, rows), &matrix);
+                let mut layer_size = rows / 2;
+                while layer_size > 0 {
+                    hal.hash_fold(&nodes, layer_size * 2, layer_size);
+                    layer_size /= 2;
+                }
+                let actual = hal.hash_tree(&matrix, rows);
+                nodes.view(|expected| assert_eq!(&actual[1..], &expected[1..]));
+            }
+        }
+    }
 }
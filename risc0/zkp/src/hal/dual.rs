@@ -220,6 +220,21 @@ where
         io.assert_eq();
     }
 
+    fn zk_shift_expand_into_evaluate_ntt(
+        &self,
+        output: &Self::Buffer<Self::Elem>,
+        input: &Self::Buffer<Self::Elem>,
+        count: usize,
+        expand_bits: usize,
+    ) {
+        self.lhs
+            .zk_shift_expand_into_evaluate_ntt(&output.lhs, &input.lhs, count, expand_bits);
+        self.rhs
+            .zk_shift_expand_into_evaluate_ntt(&output.rhs, &input.rhs, count, expand_bits);
+        input.assert_eq();
+        output.assert_eq();
+    }
+
     fn mix_poly_coeffs(
         &self,
         out: &Self::Buffer<Self::ExtElem>,
@@ -307,6 +322,13 @@ where
         io.assert_eq();
     }
 
+    fn hash_tree(&self, matrix: &Self::Buffer<Self::Elem>, rows: usize) -> Vec<Digest> {
+        let lhs = self.lhs.hash_tree(&matrix.lhs, rows);
+        let rhs = self.rhs.hash_tree(&matrix.rhs, rows);
+        assert_eq!(lhs, rhs);
+        rhs
+    }
+
     fn has_unified_memory(&self) -> bool {
         self.rhs.has_unified_memory()
     }
@@ -99,6 +99,20 @@ pub trait Hal {
 
     fn zk_shift(&self, io: &Self::Buffer<Self::Elem>, count: usize);
 
+    /// Applies [Hal::zk_shift] to the `count` rows of `input`, then evaluates
+    /// them into `output` as [Hal::batch_expand_into_evaluate_ntt] does.  HALs
+    /// can override this to do both in one pass over the rows.
+    fn zk_shift_expand_into_evaluate_ntt(
+        &self,
+        output: &Self::Buffer<Self::Elem>,
+        input: &Self::Buffer<Self::Elem>,
+        count: usize,
+        expand_bits: usize,
+    ) {
+        self.zk_shift(input, count);
+        self.batch_expand_into_evaluate_ntt(output, input, count, expand_bits);
+    }
+
     #[allow(clippy::too_many_arguments)]
     fn mix_poly_coeffs(
         &self,
@@ -141,6 +155,28 @@ pub trait Hal {
 
     fn hash_fold(&self, io: &Self::Buffer<Digest>, input_size: usize, output_size: usize);
 
+    /// Builds a Merkle tree over the `rows` rows of `matrix` and returns its
+    /// nodes on the host, as a heap style array of `2 * rows` digests where
+    /// node N has children 2N and 2N+1 and node 0 is unused.  By default this
+    /// runs [Hal::hash_rows] and then [Hal::hash_fold] once per layer.  HALs
+    /// can override this to build the tree in fewer passes.
+    fn hash_tree(&self, matrix: &Self::Buffer<Self::Elem>, rows: usize) -> Vec<Digest> {
+        let nodes = self.alloc_digest("nodes", rows * 2);
+        self.hash_rows(&nodes.slice(rows, rows), matrix);
+        tracing::info_span!("hash_fold").in_scope(|| {
+            let mut layer_size = rows / 2;
+            while layer_size > 0 {
+                self.hash_fold(&nodes, layer_size * 2, layer_size);
+                layer_size /= 2;
+            }
+        });
+        let mut nodes_host = Vec::with_capacity(nodes.size());
+        nodes.view(|view| {
+            nodes_host.extend_from_slice(view);
+        });
+        nodes_host
+    }
+
     fn gather_sample(
         &self,
         dst: &Self::Buffer<Self::Elem>,
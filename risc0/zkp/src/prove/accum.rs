@@ -12,80 +12,330 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use std::{collections::BTreeMap, sync::Mutex};
+use std::{
+    cmp,
+    marker::PhantomData,
+    ops::Range,
+    sync::{
+        atomic::{AtomicBool, AtomicUsize, Ordering},
+        Condvar, Mutex, OnceLock, PoisonError,
+    },
+    thread,
+};
 
 use anyhow::Result;
+use rayon::prelude::*;
 use risc0_core::field::{Elem, ExtElem, Field};
 
-use crate::adapter::CircuitStepHandler;
+use crate::adapter::{CircuitStepHandler, ExternId, ExtraId};
+
+/// The plonk kinds that can be accumulated, in slot order.
+pub const ACCUM_KINDS: [ExtraId; 3] = [ExtraId::BYTES, ExtraId::RAM, ExtraId::WOM];
+
+/// Smallest number of elements a worker scans at once in [prefix_products].
+const SCAN_CHUNK_SIZE: usize = 1 << 12;
+
+fn prefix_products_serial<E: Elem>(elems: &mut [E]) {
+    let mut tot = E::ONE;
+    for elem in elems.iter_mut() {
+        tot *= *elem;
+        *elem = tot;
+    }
+}
+
+/// Replaces each element of `elems` with the product of itself and all
+/// preceding elements.
+///
+/// Large slices are scanned in parallel blocks: each block is scanned on its
+/// own, then every block but the first is multiplied by the product of all
+/// the blocks before it.
+pub fn prefix_products<E: Elem>(elems: &mut [E]) {
+    let chunk_size = cmp::max(
+        SCAN_CHUNK_SIZE,
+        elems.len() / (4 * rayon::current_num_threads()),
+    );
+    if elems.len() <= chunk_size {
+        prefix_products_serial(elems);
+        return;
+    }
+    elems
+        .par_chunks_mut(chunk_size)
+        .for_each(prefix_products_serial);
+    let mut tot = E::ONE;
+    let carries: Vec<E> = elems
+        .chunks(chunk_size)
+        .map(|chunk| {
+            let carry = tot;
+            tot *= *chunk.last().unwrap();
+            carry
+        })
+        .collect();
+    elems
+        .par_chunks_mut(chunk_size)
+        .zip(carries)
+        .skip(1)
+        .for_each(|(chunk, carry)| {
+            for elem in chunk.iter_mut() {
+                *elem *= carry;
+            }
+        });
+}
+
+/// Running products of one tile of [Accum::accumulate], once known.
+struct TileProducts<E: Elem> {
+    /// The product of this tile's factors alone.
+    aggregate: OnceLock<[E; ACCUM_KINDS.len()]>,
+    /// The product of the factors of this tile and all tiles before it.
+    inclusive: OnceLock<[E; ACCUM_KINDS.len()]>,
+}
+
+/// The products of the tiles of one [Accum::accumulate] call, shared by its
+/// workers.
+struct TileBoard<E: Elem> {
+    tiles: Vec<TileProducts<E>>,
+    /// Set when a worker panics, so that the others stop waiting on tiles that
+    /// will never be published.
+    aborted: AtomicBool,
+    // Waiters sleep on `published` until a tile publishes its aggregate or
+    // the run is aborted.  The mutex only orders those wakeups.
+    lock: Mutex<()>,
+    published: Condvar,
+}
+
+impl<E: Elem> TileBoard<E> {
+    fn new(num_tiles: usize) -> Self {
+        TileBoard {
+            tiles: (0..num_tiles)
+                .map(|_| TileProducts {
+                    aggregate: OnceLock::new(),
+                    inclusive: OnceLock::new(),
+                })
+                .collect(),
+            aborted: AtomicBool::new(false),
+            lock: Mutex::new(()),
+            published: Condvar::new(),
+        }
+    }
+
+    fn is_aborted(&self) -> bool {
+        self.aborted.load(Ordering::Acquire)
+    }
+
+    fn notify(&self) {
+        drop(self.lock.lock().unwrap_or_else(PoisonError::into_inner));
+        self.published.notify_all();
+    }
+
+    fn publish_aggregate(&self, tile: usize, aggregate: [E; ACCUM_KINDS.len()]) {
+        self.tiles[tile].aggregate.set(aggregate).unwrap();
+        self.notify();
+    }
+
+    fn abort(&self) {
+        self.aborted.store(true, Ordering::Release);
+        self.notify();
+    }
+
+    /// Returns the product of the factors of all tiles before `tile`, or
+    /// `None` if the run was aborted.
+    ///
+    /// Walks back from `tile` multiplying aggregates until it reaches a tile
+    /// whose inclusive product is known.  Tiles are claimed in order and
+    /// publish their aggregates without waiting on anything, so unless a
+    /// worker panics, this always finishes.
+    fn carry_in(&self, tile: usize) -> Option<[E; ACCUM_KINDS.len()]> {
+        let mut carry = [E::ONE; ACCUM_KINDS.len()];
+        let mut pred = tile;
+        while pred > 0 {
+            let products = &self.tiles[pred - 1];
+            if let Some(inclusive) = products.inclusive.get() {
+                mul_products(&mut carry, inclusive);
+                break;
+            }
+            if let Some(aggregate) = products.aggregate.get() {
+                mul_products(&mut carry, aggregate);
+                pred -= 1;
+                continue;
+            }
+            let guard = self.lock.lock().unwrap_or_else(PoisonError::into_inner);
+            // Checked again under the lock, so that a wakeup sent in between
+            // isn't missed.
+            if products.aggregate.get().is_none() && !self.is_aborted() {
+                drop(
+                    self.published
+                        .wait(guard)
+                        .unwrap_or_else(PoisonError::into_inner),
+                );
+            }
+            if self.is_aborted() {
+                return None;
+            }
+        }
+        Some(carry)
+    }
+}
+
+/// Aborts a [TileBoard] if dropped while its worker is unwinding.
+struct AbortOnUnwind<'a, E: Elem>(&'a TileBoard<E>);
+
+impl<'a, E: Elem> Drop for AbortOnUnwind<'a, E> {
+    fn drop(&mut self) {
+        if thread::panicking() {
+            self.0.abort();
+        }
+    }
+}
+
+fn mul_products<E: Elem>(lhs: &mut [E; ACCUM_KINDS.len()], rhs: &[E; ACCUM_KINDS.len()]) {
+    for (lhs, rhs) in lhs.iter_mut().zip(rhs) {
+        *lhs *= *rhs;
+    }
+}
+
+/// Returns the slot of `kind` in [ACCUM_KINDS].
+fn slot(kind: ExtraId) -> usize {
+    let slot = kind.0.wrapping_sub(ExtraId::BYTES.0) as usize;
+    assert!(slot < ACCUM_KINDS.len(), "Unknown accum kind {kind:?}");
+    slot
+}
 
 /// Tracks grand product accumulations for PLONK-style permutation arguments.
 pub struct Accum<E: Elem> {
     /// Total number of cycles in this run.
     cycles: usize,
 
-    // We use two PLONK-style grand product accumulation checks;
-    // one for the memory permutation and a second for a lookup table.
-    // We have two `kinds`: memory and bytes.
-    kinds: BTreeMap<String, Vec<E>>,
+    // We use PLONK-style grand product accumulation checks; one for the
+    // memory permutation and others for lookup tables.  Each kind has a
+    // fixed slot, allocated up front so that handlers never need to
+    // synchronize with each other.
+    slots: [Vec<E>; ACCUM_KINDS.len()],
 }
 
 impl<E: Elem> Accum<E> {
     pub fn new(cycles: usize) -> Self {
         Accum {
             cycles,
-            kinds: BTreeMap::new(),
+            slots: [(); ACCUM_KINDS.len()].map(|_| vec![E::ONE; cycles]),
         }
     }
 
-    // Generates prefix products for grand product accumulation
-    pub fn calc_prefix_products(&mut self) {
-        for (_kind, elems) in self.kinds.iter_mut() {
-            let mut tot = E::ONE;
-            for elem in elems.iter_mut() {
-                tot *= *elem;
-                *elem = tot;
+    /// Computes the grand product accumulation of cycles `0..cycles` in
+    /// tiles of `tile_size` cycles, and verifies it.
+    ///
+    /// This fuses `step_compute_accum`, [prefix_products] and
+    /// `step_verify_accum` so that each tile is only brought into cache
+    /// once.  `compute` is called on every tile to record its factors.  The
+    /// tile is then scanned locally and publishes its product, and as soon
+    /// as the products of the tiles before it are known (by decoupled
+    /// look-back), its prefix products are completed and `verify` is called
+    /// on it.
+    ///
+    /// If `compute` or `verify` panics, the other workers stop and the panic
+    /// is raised again from here.
+    pub fn accumulate<F, C, V>(&mut self, cycles: usize, tile_size: usize, compute: C, verify: V)
+    where
+        F: Field<ExtElem = E>,
+        C: Fn(&mut Handler<'_, F>, Range<usize>) + Sync,
+        V: Fn(&mut Handler<'_, F>, Range<usize>) + Sync,
+    {
+        assert!(cycles <= self.cycles);
+        let num_tiles = (cycles + tile_size - 1) / tile_size;
+        let board = TileBoard::new(num_tiles);
+        let next_tile = AtomicUsize::new(0);
+        let handler = self.handler::<F>();
+        let workers = cmp::min(rayon::current_num_threads(), num_tiles);
+        // rayon raises a worker's panic again once every worker has returned.
+        (0..workers).into_par_iter().for_each(|_| {
+            let _guard = AbortOnUnwind(&board);
+            let mut handler = handler;
+            while !board.is_aborted() {
+                let tile = next_tile.fetch_add(1, Ordering::Relaxed);
+                if tile >= num_tiles {
+                    break;
+                }
+                let begin = tile * tile_size;
+                let end = cmp::min(begin + tile_size, cycles);
+                compute(&mut handler, begin..end);
+
+                let mut aggregate = [E::ONE; ACCUM_KINDS.len()];
+                for (slot, tot) in aggregate.iter_mut().enumerate() {
+                    // SAFETY: This worker claimed the tile, so no other thread
+                    // touches these cycles.
+                    let elems = unsafe { handler.tile(slot, begin..end) };
+                    prefix_products_serial(elems);
+                    *tot = *elems.last().unwrap();
+                }
+                board.publish_aggregate(tile, aggregate);
+
+                let Some(carry) = board.carry_in(tile) else {
+                    break;
+                };
+                let mut inclusive = aggregate;
+                mul_products(&mut inclusive, &carry);
+                board.tiles[tile].inclusive.set(inclusive).unwrap();
+                if tile > 0 {
+                    for (slot, carry) in carry.iter().enumerate() {
+                        // SAFETY: As above.
+                        for elem in unsafe { handler.tile(slot, begin..end) } {
+                            *elem *= *carry;
+                        }
+                    }
+                }
+                verify(&mut handler, begin..end);
             }
-        }
+        });
     }
 
-    fn get_ptr(&mut self, kind: String) -> *mut E {
-        self.kinds
-            .entry(kind)
-            .or_insert_with(|| vec![E::ONE; self.cycles])
-            .as_mut_ptr()
+    /// Returns a handler that accumulates into this [Accum].
+    ///
+    /// The handler may be shared and copied across threads, as long as
+    /// each cycle is only ever processed by one of them at a time.
+    pub fn handler<F: Field<ExtElem = E>>(&mut self) -> Handler<'_, F> {
+        let mut slots = [std::ptr::null_mut(); ACCUM_KINDS.len()];
+        for (ptr, elems) in slots.iter_mut().zip(self.slots.iter_mut()) {
+            *ptr = elems.as_mut_ptr();
+        }
+        Handler {
+            slots,
+            cycles: self.cycles,
+            phantom: PhantomData,
+        }
     }
 }
 
+/// Accumulates plonk factors for [Accum::handler].
 pub struct Handler<'a, F: Field> {
-    // p is a mutex lock that contains an Accum structure.
-    p: &'a Mutex<Accum<F::ExtElem>>,
+    slots: [*mut F::ExtElem; ACCUM_KINDS.len()],
     cycles: usize,
-    kinds: BTreeMap<String, *mut F::ExtElem>,
+    phantom: PhantomData<&'a mut Accum<F::ExtElem>>,
 }
 
 impl<'a, F: Field> Handler<'a, F> {
-    pub fn new(p: &'a Mutex<Accum<F::ExtElem>>) -> Self {
-        let cycles = p.lock().unwrap().cycles;
-        Handler {
-            p,
-            kinds: BTreeMap::new(),
-            cycles,
-        }
+    /// Returns the accumulations of `cycles` in slot `slot`.
+    ///
+    /// # Safety
+    ///
+    /// No other reference to these cycles of the slot may be live.
+    unsafe fn tile(&mut self, slot: usize, cycles: Range<usize>) -> &mut [F::ExtElem] {
+        assert!(cycles.end <= self.cycles);
+        std::slice::from_raw_parts_mut(self.slots[slot].add(cycles.start), cycles.len())
     }
+}
 
-    fn get_ptr(&mut self, kind: &str) -> *mut F::ExtElem {
-        if let Some(entry) = self.kinds.get_mut(kind) {
-            *entry
-        } else {
-            let mut p = self.p.lock().unwrap();
-            let ptr = p.get_ptr(kind.to_string());
-            self.kinds.insert(kind.to_string(), ptr);
-            ptr
-        }
+impl<'a, F: Field> Clone for Handler<'a, F> {
+    fn clone(&self) -> Self {
+        *self
     }
 }
 
+impl<'a, F: Field> Copy for Handler<'a, F> {}
+
+// SAFETY: Every extern call only touches the element of its own cycle in a
+// slot, so handlers running distinct cycles on different threads never
+// alias.
+unsafe impl<'a, F: Field> Send for Handler<'a, F> {}
+unsafe impl<'a, F: Field> Sync for Handler<'a, F> {}
+
 impl<'a, F: Field> CircuitStepHandler<F::Elem> for Handler<'a, F> {
     /// Performs an extern call
     fn call(
@@ -98,26 +348,41 @@ impl<'a, F: Field> CircuitStepHandler<F::Elem> for Handler<'a, F> {
         extra: &str,
         args: &[F::Elem],
         outs: &mut [F::Elem],
+    ) -> Result<()> {
+        let id =
+            ExternId::from_name(name).unwrap_or_else(|| panic!("Unknown accum operation {name}"));
+        self.call_extern(cycle, id, ExtraId::from_name(extra), extra, args, outs)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        // The plonk kind being accumulated.
+        kind: ExtraId,
+        _extra: &str,
+        args: &[F::Elem],
+        outs: &mut [F::Elem],
     ) -> Result<()> {
         assert!(cycle < self.cycles);
-        match name {
-            "plonkWriteAccum" => {
+        match id {
+            ExternId::PlonkWriteAccum => {
                 assert_eq!(args.len(), F::ExtElem::EXT_SIZE);
                 let elem = F::ExtElem::from_subelems(args.iter().copied());
-                let ptr = self.get_ptr(extra);
+                let ptr = self.slots[slot(kind)];
                 // Already checked that our cycle number is in range, so this offset is in the
                 // buffer.
                 unsafe { ptr.add(cycle).write(elem) };
             }
-            "plonkReadAccum" => {
+            ExternId::PlonkReadAccum => {
                 assert_eq!(outs.len(), F::ExtElem::EXT_SIZE);
-                let ptr = self.get_ptr(extra);
+                let ptr = self.slots[slot(kind)];
                 // Already checked that our cycle number is in range, so this offset is in the
                 // buffer.
                 let elem = unsafe { ptr.add(cycle).read() };
                 outs.clone_from_slice(elem.subelems());
             }
-            _ => panic!("Unknown accum operation {name}"),
+            _ => panic!("Unknown accum operation {}", id.name()),
         }
         Ok(())
     }
@@ -126,3 +391,123 @@ impl<'a, F: Field> CircuitStepHandler<F::Elem> for Handler<'a, F> {
         unimplemented!()
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use std::ops::Range;
+
+    use rand::thread_rng;
+    use risc0_core::field::{
+        baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem},
+        Elem, ExtElem,
+    };
+
+    use super::{
+        prefix_products, prefix_products_serial, Accum, Handler, ACCUM_KINDS, SCAN_CHUNK_SIZE,
+    };
+    use crate::adapter::{CircuitStepHandler, ExternId};
+
+    #[test]
+    fn prefix_products_matches_serial() {
+        let mut rng = thread_rng();
+        for len in [0, 1, SCAN_CHUNK_SIZE, 5 * SCAN_CHUNK_SIZE + 3, 1 << 18] {
+            let mut expected: Vec<_> = (0..len)
+                .map(|_| BabyBearExtElem::random(&mut rng))
+                .collect();
+            let mut actual = expected.clone();
+            prefix_products_serial(&mut expected);
+            prefix_products(&mut actual);
+            assert_eq!(actual, expected, "len {len}");
+        }
+    }
+
+    #[test]
+    fn accumulate_matches_prefix_products() {
+        const CYCLES: usize = 1000;
+        let mut rng = thread_rng();
+        let factors: Vec<Vec<_>> = ACCUM_KINDS
+            .iter()
+            .map(|_| {
+                (0..CYCLES)
+                    .map(|_| BabyBearExtElem::random(&mut rng))
+                    .collect()
+            })
+            .collect();
+        let expected: Vec<Vec<_>> = factors
+            .iter()
+            .map(|factors| {
+                let mut elems = factors.clone();
+                prefix_products(&mut elems);
+                elems
+            })
+            .collect();
+
+        // Tile sizes of 7 and 64 leave a partial last tile.
+        for tile_size in [1, 7, 64, CYCLES, 4 * CYCLES] {
+            let mut accum = Accum::new(CYCLES);
+            accum.accumulate::<BabyBear, _, _>(
+                CYCLES,
+                tile_size,
+                |handler: &mut Handler<'_, BabyBear>, cycles: Range<usize>| {
+                    for cycle in cycles {
+                        for (kind, factors) in ACCUM_KINDS.iter().zip(&factors) {
+                            handler
+                                .call_extern(
+                                    cycle,
+                                    ExternId::PlonkWriteAccum,
+                                    *kind,
+                                    "",
+                                    factors[cycle].subelems(),
+                                    &mut [],
+                                )
+                                .unwrap();
+                        }
+                    }
+                },
+                |handler: &mut Handler<'_, BabyBear>, cycles: Range<usize>| {
+                    for cycle in cycles {
+                        for (kind, expected) in ACCUM_KINDS.iter().zip(&expected) {
+                            let mut outs = [BabyBearElem::ZERO; BabyBearExtElem::EXT_SIZE];
+                            handler
+                                .call_extern(
+                                    cycle,
+                                    ExternId::PlonkReadAccum,
+                                    *kind,
+                                    "",
+                                    &[],
+                                    &mut outs,
+                                )
+                                .unwrap();
+                            assert_eq!(
+                                BabyBearExtElem::from_subelems(outs),
+                                expected[cycle],
+                                "tile size {tile_size}, cycle {cycle}"
+                            );
+                        }
+                    }
+                },
+            );
+            for (slot, expected) in accum.slots.iter().zip(&expected) {
+                assert_eq!(slot, expected, "tile size {tile_size}");
+            }
+        }
+    }
+
+    #[test]
+    #[should_panic(expected = "failed tile")]
+    fn accumulate_raises_panics() {
+        // Panicking in the first tile would otherwise leave the later tiles
+        // waiting for it forever.
+        let mut accum = Accum::<BabyBearExtElem>::new(1000);
+        accum.accumulate::<BabyBear, _, _>(
+            1000,
+            10,
+            |_, cycles| {
+                if cycles.start == 0 {
+                    panic!("failed tile");
+                }
+            },
+            |_, _| {},
+        );
+    }
+}
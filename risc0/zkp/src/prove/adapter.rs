@@ -12,24 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use std::sync::Mutex;
-
 use rand::thread_rng;
-use rayon::prelude::*;
 use risc0_core::field::{Elem, Field};
 
 use crate::{
-    adapter::{CircuitProveDef, CircuitStepContext, CircuitStepHandler, REGISTER_GROUP_ACCUM},
+    adapter::{CircuitProveDef, CircuitStepHandler, REGISTER_GROUP_ACCUM},
     hal::cpu::CpuBuffer,
-    prove::{
-        accum::{Accum, Handler},
-        executor::Executor,
-        write_iop::WriteIOP,
-    },
+    prove::{accum::Accum, executor::Executor, write_iop::WriteIOP},
     taps::TapSet,
     ZK_CYCLES,
 };
 
+/// Number of consecutive cycles each worker hands to a single
+/// `step_*_range` call.
+const ACCUM_CHUNK_SIZE: usize = 1024;
+
 pub struct ProveAdapter<'a, F, C, S>
 where
     F: Field,
@@ -77,42 +74,21 @@ where
             self.mix.as_slice_sync(),
             self.accum.as_slice_sync(),
         ];
-        let accum: Mutex<Accum<F::ExtElem>> = Mutex::new(Accum::new(self.steps));
-        tracing::info_span!("step_compute_accum").in_scope(|| {
+        let mut accum: Accum<F::ExtElem> = Accum::new(self.steps);
+        let cycles = self.steps - ZK_CYCLES;
+        tracing::info_span!("step_accum").in_scope(|| {
             // TODO: Add an way to be able to run this on cuda, metal, etc.
             let c = &self.exec.circuit;
-            (0..self.steps - ZK_CYCLES).into_par_iter().for_each_init(
-                || Handler::<F>::new(&accum),
-                |accum_handler, cycle| {
-                    c.step_compute_accum(
-                        &CircuitStepContext {
-                            size: self.steps,
-                            cycle,
-                        },
-                        accum_handler,
-                        args,
-                    )
-                    .unwrap();
+            accum.accumulate(
+                cycles,
+                ACCUM_CHUNK_SIZE,
+                |handler, tile| {
+                    c.step_compute_accum_range(self.steps, tile, handler, args)
+                        .unwrap();
                 },
-            );
-        });
-        tracing::info_span!("calc_prefix_products").in_scope(|| {
-            accum.lock().unwrap().calc_prefix_products();
-        });
-        tracing::info_span!("step_verify_accum").in_scope(|| {
-            let c = &self.exec.circuit;
-            (0..self.steps - ZK_CYCLES).into_par_iter().for_each_init(
-                || Handler::<F>::new(&accum),
-                |accum_handler, cycle| {
-                    c.step_verify_accum(
-                        &CircuitStepContext {
-                            size: self.steps,
-                            cycle,
-                        },
-                        accum_handler,
-                        args,
-                    )
-                    .unwrap();
+                |handler, tile| {
+                    c.step_verify_accum_range(self.steps, tile, handler, args)
+                        .unwrap();
                 },
             );
         });
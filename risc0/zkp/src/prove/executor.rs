@@ -22,8 +22,8 @@ use tracing::debug;
 
 use crate::{
     adapter::{
-        CircuitProveDef, CircuitStepContext, CircuitStepHandler, REGISTER_GROUP_CODE,
-        REGISTER_GROUP_DATA,
+        CircuitProveDef, CircuitStepContext, CircuitStepHandler, PlonkVerifyHandler,
+        REGISTER_GROUP_CODE, REGISTER_GROUP_DATA,
     },
     hal::{
         cpu::{CpuBuffer, SyncSlice},
@@ -165,13 +165,11 @@ where
         new_buf
     }
 
-    fn compute_verify(&mut self) {
+    // Make code be all zeros of zk cycles, and data be random
+    fn fill_zk_cycles(&mut self) {
         let mut rng = thread_rng();
         let code_buf = self.code.as_slice_sync();
-        let io_buf = self.io.as_slice_sync();
         let data_buf = self.data.as_slice_sync();
-
-        // Make code be all zeros of zk cycles, and data be random
         for i in self.cycle..self.steps {
             for j in 0..self.code_size {
                 code_buf.set(j * self.steps + i, F::Elem::ZERO);
@@ -180,48 +178,100 @@ where
                 data_buf.set(j * self.steps + i, F::Elem::random(&mut rng));
             }
         }
+    }
+
+    fn compute_verify(&mut self) {
+        self.fill_zk_cycles();
+
         // Do the verify cycles
-        let args: &[SyncSlice<F::Elem>] = &[code_buf, io_buf, data_buf];
+        let args: &[SyncSlice<F::Elem>] = &[
+            self.code.as_slice_sync(),
+            self.io.as_slice_sync(),
+            self.data.as_slice_sync(),
+        ];
 
         self.handler.sort("ram");
         tracing::info_span!("step_verify_mem").in_scope(|| {
-            for i in 0..self.cycle {
-                let ctx = CircuitStepContext {
-                    cycle: i,
-                    size: self.steps,
-                };
-                self.circuit
-                    .step_verify_mem(&ctx, &mut self.handler, args)
-                    .unwrap();
-            }
+            self.circuit
+                .step_verify_mem_range(self.steps, 0..self.cycle, &mut self.handler, args)
+                .unwrap();
         });
 
         self.handler.sort("bytes");
         tracing::info_span!("step_verify_bytes").in_scope(|| {
-            for i in 0..self.cycle {
-                let ctx = CircuitStepContext {
-                    cycle: i,
-                    size: self.steps,
-                };
-                self.circuit
-                    .step_verify_bytes(&ctx, &mut self.handler, args)
-                    .unwrap();
-            }
+            self.circuit
+                .step_verify_bytes_range(self.steps, 0..self.cycle, &mut self.handler, args)
+                .unwrap();
         });
     }
 
+    // Zero out 'invalid' entries in data and output.
+    fn zero_invalid(&mut self) {
+        self.data
+            .as_slice_mut()
+            .par_iter_mut()
+            .chain(self.io.as_slice_mut().par_iter_mut())
+            .for_each(|value| *value = value.valid_or_zero());
+    }
+
     #[tracing::instrument(skip_all)]
     pub fn finalize(&mut self) {
         assert!(self.halted);
         assert_eq!(self.cycle, self.steps - ZK_CYCLES);
 
         self.compute_verify();
+        self.zero_invalid();
+    }
+}
 
-        // Zero out 'invalid' entries in data and output.
-        self.data
-            .as_slice_mut()
-            .par_iter_mut()
-            .chain(self.io.as_slice_mut().par_iter_mut())
-            .for_each(|value| *value = value.valid_or_zero());
+impl<F, C, S> Executor<F, C, S>
+where
+    F: Field,
+    C: 'static + CircuitProveDef<F>,
+    S: PlonkVerifyHandler<F::Elem>,
+{
+    fn compute_verify_parallel(&mut self) {
+        self.fill_zk_cycles();
+
+        let args: &[SyncSlice<F::Elem>] = &[
+            self.code.as_slice_sync(),
+            self.io.as_slice_sync(),
+            self.data.as_slice_sync(),
+        ];
+        let circuit = self.circuit;
+        let steps = self.steps;
+
+        self.handler.sort("ram");
+        tracing::info_span!("step_verify_mem").in_scope(|| {
+            self.handler
+                .run_verify("ram", self.cycle, |handler, cycles| {
+                    circuit
+                        .step_verify_mem_range(steps, cycles, handler, args)
+                        .map(|_| ())
+                })
+                .unwrap();
+        });
+
+        self.handler.sort("bytes");
+        tracing::info_span!("step_verify_bytes").in_scope(|| {
+            self.handler
+                .run_verify("bytes", self.cycle, |handler, cycles| {
+                    circuit
+                        .step_verify_bytes_range(steps, cycles, handler, args)
+                        .map(|_| ())
+                })
+                .unwrap();
+        });
+    }
+
+    /// Same as [Self::finalize], but runs the verify phases over ranges of
+    /// cycles in parallel.
+    #[tracing::instrument(skip_all)]
+    pub fn finalize_parallel(&mut self) {
+        assert!(self.halted);
+        assert_eq!(self.cycle, self.steps - ZK_CYCLES);
+
+        self.compute_verify_parallel();
+        self.zero_invalid();
     }
 }
@@ -62,26 +62,13 @@ impl<H: Hal> MerkleTreeProver<H> {
     ) -> Self {
         assert_eq!(matrix.size(), rows * cols);
         let params = MerkleTreeParams::new(rows, cols, queries);
-        // Allocate nodes
-        let nodes = hal.alloc_digest("nodes", rows * 2);
-        // SHA-256 hash each column
-        hal.hash_rows(&nodes.slice(rows, rows), matrix);
-        // For each layer, sha up the layer below
-        tracing::info_span!("hash_fold").in_scope(|| {
-            for i in (0..params.layers).rev() {
-                let layer_size = 1 << i;
-                hal.hash_fold(&nodes, layer_size * 2, layer_size);
-            }
-        });
-        let mut nodes_host = Vec::with_capacity(nodes.size());
-        nodes.view(|view| {
-            nodes_host.extend_from_slice(view);
-        });
-        let root = nodes_host[1];
+        // Hash each column, and then each layer up from the one below
+        let nodes = hal.hash_tree(matrix, rows);
+        let root = nodes[1];
         MerkleTreeProver {
             params,
             matrix: matrix.clone(),
-            nodes: nodes_host,
+            nodes,
             root,
         }
     }
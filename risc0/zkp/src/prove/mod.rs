@@ -19,7 +19,7 @@
 //!
 //! [`risc0_zkvm::prove`]: https://docs.rs/risc0-zkvm/latest/risc0_zkvm/prove/index.html
 
-mod accum;
+pub mod accum;
 pub mod adapter;
 pub mod executor;
 mod fri;
@@ -64,11 +64,38 @@ impl<H: Hal> PolyGroup<H> {
         count: usize,
         size: usize,
         _name: &'static str,
+    ) -> Self {
+        Self::build(hal, coeffs, count, size, false)
+    }
+
+    /// Like [PolyGroup::new], but first shifts the polynomials with
+    /// [Hal::zk_shift], in the same pass over `coeffs` that evaluates them.
+    #[tracing::instrument(name = "PolyGroup", skip_all, fields(name = _name))]
+    pub fn new_zk_shifted(
+        hal: &H,
+        coeffs: H::Buffer<H::Elem>,
+        count: usize,
+        size: usize,
+        _name: &'static str,
+    ) -> Self {
+        Self::build(hal, coeffs, count, size, true)
+    }
+
+    fn build(
+        hal: &H,
+        coeffs: H::Buffer<H::Elem>,
+        count: usize,
+        size: usize,
+        zk_shift: bool,
     ) -> Self {
         assert_eq!(coeffs.size(), count * size);
         let domain = size * INV_RATE;
         let evaluated = hal.alloc_elem("evaluated", count * domain);
-        hal.batch_expand_into_evaluate_ntt(&evaluated, &coeffs, count, log2_ceil(INV_RATE));
+        if zk_shift {
+            hal.zk_shift_expand_into_evaluate_ntt(&evaluated, &coeffs, count, log2_ceil(INV_RATE));
+        } else {
+            hal.batch_expand_into_evaluate_ntt(&evaluated, &coeffs, count, log2_ceil(INV_RATE));
+        }
         hal.batch_bit_reverse(&coeffs, count);
         let merkle = MerkleTreeProver::new(hal, &evaluated, domain, count, QUERIES);
         PolyGroup {
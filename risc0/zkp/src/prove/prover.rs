@@ -33,15 +33,6 @@ pub struct Prover<'a, H: Hal> {
     po2: usize,
 }
 
-fn make_coeffs<H: Hal>(hal: &H, buf: H::Buffer<H::Elem>, count: usize) -> H::Buffer<H::Elem> {
-    // Do interpolate
-    hal.batch_interpolate_ntt(&buf, count);
-    // Convert f(x) -> f(3x), which effective multiplies cofficent c_i by 3^i.
-    #[cfg(not(feature = "circuit_debug"))]
-    hal.zk_shift(&buf, count);
-    buf
-}
-
 impl<'a, H: Hal> Prover<'a, H> {
     /// Creates a new prover.
     pub fn new(hal: &'a H, taps: &'a TapSet) -> Self {
@@ -84,14 +75,15 @@ impl<'a, H: Hal> Prover<'a, H> {
             self.taps.group_name(tap_group_index)
         );
 
-        let coeffs = make_coeffs(self.hal, buf, group_size);
-        let group_ref = self.groups[tap_group_index].insert(PolyGroup::new(
-            self.hal,
-            coeffs,
-            group_size,
-            self.cycles,
-            "data",
-        ));
+        // Do interpolate
+        self.hal.batch_interpolate_ntt(&buf, group_size);
+        // Convert f(x) -> f(3x), which effective multiplies cofficent c_i by 3^i,
+        // while evaluating the coefficients.
+        #[cfg(not(feature = "circuit_debug"))]
+        let group = PolyGroup::new_zk_shifted(self.hal, buf, group_size, self.cycles, "data");
+        #[cfg(feature = "circuit_debug")]
+        let group = PolyGroup::new(self.hal, buf, group_size, self.cycles, "data");
+        let group_ref = self.groups[tap_group_index].insert(group);
 
         group_ref.merkle.commit(&mut self.iop);
 
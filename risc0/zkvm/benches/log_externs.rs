@@ -0,0 +1,62 @@
+// Copyright 2023 RISC Zero, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use risc0_circuit_rv32im::set_log_externs;
+use risc0_zkvm::{get_prover_server, ExecutorEnv, ExecutorImpl, ProverOpts, VerifierContext};
+use risc0_zkvm_methods::FIB_ELF;
+
+// Proves the same segments with and without the `log` externs that body
+// cycles call, to show what skipping them saves per cycle.
+pub fn bench(c: &mut Criterion) {
+    let mut group = c.benchmark_group("log_externs");
+
+    let opts = ProverOpts::default();
+    let prover = get_prover_server(&opts).unwrap();
+    let ctx = VerifierContext::default();
+
+    for iterations in [1000u32, 10_000] {
+        let env = ExecutorEnv::builder()
+            .write_slice(&[iterations])
+            .build()
+            .unwrap();
+        let session = ExecutorImpl::from_elf(env, FIB_ELF).unwrap().run().unwrap();
+        let segments = session.resolve().unwrap();
+        let prove_cycles = segments
+            .iter()
+            .fold(0, |prove_cycles, segment| prove_cycles + (1 << segment.po2));
+        group.sample_size(10);
+        group.throughput(Throughput::Elements(prove_cycles as u64));
+        for enabled in [false, true] {
+            let name = if enabled { "on" } else { "off" };
+            let id = BenchmarkId::new(name, iterations);
+            group.bench_function(id, |b| {
+                set_log_externs(enabled);
+                b.iter(|| {
+                    for segment in segments.iter() {
+                        black_box(prover.prove_segment(&ctx, segment).unwrap());
+                    }
+                });
+            });
+        }
+    }
+    set_log_externs(false);
+
+    group.finish();
+}
+
+criterion_group!(name = benches;
+    config = Criterion::default();
+    targets = bench);
+criterion_main!(benches);
@@ -19,13 +19,13 @@ use lazy_regex::{regex, Captures};
 use rayon::prelude::*;
 use risc0_circuit_recursion::{CircuitImpl, Externs};
 use risc0_zkp::{
-    adapter::{CircuitInfo, CircuitStep, CircuitStepContext, CircuitStepHandler},
+    adapter::{CircuitInfo, CircuitStep, CircuitStepHandler, ExternId, ExtraId},
     field::{
         baby_bear::{BabyBear, BabyBearElem, BabyBearExtElem},
         Elem, ExtElem,
     },
     hal::cpu::SyncSlice,
-    prove::executor::Executor,
+    prove::{accum::Accum, executor::Executor},
     ZK_CYCLES,
 };
 
@@ -38,8 +38,9 @@ pub struct MachineContext {
     // Plonk table for sorting plonk elements in proper order
     wom_plonk: plonk::WomPlonk,
 
-    // Plonk accumulations for compute_accum and verify_accum phases
-    plonk_accum: plonk::PlonkAccum<BabyBear>,
+    // Plonk accumulations for compute_accum and verify_accum phases, indexed
+    // by cycle.  Allocated on first use.
+    plonk_accum: Option<Accum<BabyBearExtElem>>,
 
     iop_input: VecDeque<u32>,
     cur_iop_body: VecDeque<Vec<BabyBearElem>>,
@@ -53,34 +54,39 @@ impl<'a> MachineContext {
             wom: Vec::new(),
             iop_input,
             cur_iop_body: VecDeque::new(),
-            plonk_accum: plonk::PlonkAccum::new(),
+            plonk_accum: None,
             wom_plonk: plonk::WomPlonk::new(),
             iop_reads: BTreeMap::new(),
         }
     }
 
-    fn plonk_read(&mut self, name: &str, outs: &mut [BabyBearElem]) {
-        match name {
-            "wom" => self.wom_plonk.read(outs.try_into().unwrap()),
-            _ => panic!("Unknown plonk type {name}"),
+    fn plonk_read(&mut self, kind: ExtraId, outs: &mut [BabyBearElem]) {
+        match kind {
+            ExtraId::WOM => self.wom_plonk.read(outs.try_into().unwrap()),
+            _ => panic!("Unknown plonk type {kind:?}"),
         }
     }
 
-    fn plonk_write(&mut self, name: &str, args: &[BabyBearElem]) {
-        match name {
-            "wom" => self.wom_plonk.write(args.try_into().unwrap()),
-            _ => panic!("Unknown plonk type {name}"),
+    fn plonk_write(&mut self, kind: ExtraId, args: &[BabyBearElem]) {
+        match kind {
+            ExtraId::WOM => self.wom_plonk.write(args.try_into().unwrap()),
+            _ => panic!("Unknown plonk type {kind:?}"),
         }
     }
 
-    fn plonk_read_accum(&mut self, name: &str, outs: &mut [BabyBearElem]) {
-        assert_eq!(name, "wom");
-        self.plonk_accum.read(outs)
-    }
-
-    fn plonk_write_accum(&mut self, name: &str, args: &[BabyBearElem]) {
-        assert_eq!(name, "wom");
-        self.plonk_accum.write(args);
+    fn plonk_accum(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        kind: ExtraId,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> Result<()> {
+        assert_eq!(kind, ExtraId::WOM);
+        self.plonk_accum
+            .get_or_insert_with(|| Accum::new(1 << RECURSION_PO2))
+            .handler::<BabyBear>()
+            .call_extern(cycle, id, kind, "", args, outs)
     }
 
     fn log(&mut self, msg: &str, args: &[BabyBearElem]) {
@@ -205,51 +211,60 @@ impl risc0_circuit_recursion::Externs for MachineContext {
 impl CircuitStepHandler<BabyBearElem> for MachineContext {
     fn call(
         &mut self,
-        _cycle: usize,
+        cycle: usize,
         name: &str,
         extra: &str,
         args: &[BabyBearElem],
         outs: &mut [BabyBearElem],
     ) -> Result<()> {
-        match name {
-            "readIOPHeader" => {
+        let id = ExternId::from_name(name)
+            .unwrap_or_else(|| unimplemented!("Unsupported extern: {name}"));
+        self.call_extern(cycle, id, ExtraId::from_name(extra), extra, args, outs)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        extra_id: ExtraId,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> Result<()> {
+        match id {
+            ExternId::ReadIOPHeader => {
                 self.read_iop_header(args[0], args[1]);
                 Ok(())
             }
-            "readIOPBody" => {
+            ExternId::ReadIOPBody => {
                 outs.clone_from_slice(self.read_iop_body(args[2]).subelems());
                 Ok(())
             }
-            "womRead" => {
+            ExternId::WomRead => {
                 outs.clone_from_slice(&self.wom_read(args[0]).subelems());
                 Ok(())
             }
-            "womWrite" => {
+            ExternId::WomWrite => {
                 let val = BabyBearExtElem::from_subelems(args[1..5].into_iter().cloned());
                 self.wom_write(args[0], val);
                 Ok(())
             }
-            "plonkWrite" => {
-                self.plonk_write(extra, args);
-                Ok(())
-            }
-            "plonkRead" => {
-                self.plonk_read(extra, outs);
+            ExternId::PlonkWrite => {
+                self.plonk_write(extra_id, args);
                 Ok(())
             }
-            "plonkWriteAccum" => {
-                self.plonk_write_accum(extra, args);
+            ExternId::PlonkRead => {
+                self.plonk_read(extra_id, outs);
                 Ok(())
             }
-            "plonkReadAccum" => {
-                self.plonk_read_accum(extra, outs);
-                Ok(())
+            ExternId::PlonkWriteAccum | ExternId::PlonkReadAccum => {
+                self.plonk_accum(cycle, id, extra_id, args, outs)
             }
-            "log" => {
+            ExternId::Log => {
                 self.log(extra, args);
                 Ok(())
             }
-            _ => unimplemented!("Unsupported extern: {name}"),
+            _ => unimplemented!("Unsupported extern: {}", id.name()),
         }
     }
 
@@ -321,9 +336,14 @@ impl<'a> RecursionExecutor<'a> {
                 .collect();
             // TODO: Ugh, there has to be a better way to get at the handler.
             for elem in wom_plonk_elems.into_iter().flatten() {
-                self.executor
-                    .handler
-                    .call(0, "plonkWrite", "wom", elem.as_slice(), &mut [])?;
+                self.executor.handler.call_extern(
+                    0,
+                    ExternId::PlonkWrite,
+                    ExtraId::WOM,
+                    "wom",
+                    elem.as_slice(),
+                    &mut [],
+                )?;
             }
             Ok(())
         })?;
@@ -341,7 +361,8 @@ struct ParallelHandler<'a> {
     wom: &'a [BabyBearExtElem],
     plonk_queue: Vec<[BabyBearElem; 5]>,
     iop_reads: &'a BTreeMap<usize, Vec<BabyBearExtElem>>,
-    cur_iop_body: Option<&'a [BabyBearExtElem]>,
+    // Remaining IOP body reads, keyed by the cycle that started consuming them.
+    cur_iop_body: Option<(usize, &'a [BabyBearExtElem])>,
 }
 
 impl<'a> ParallelHandler<'a> {
@@ -384,14 +405,9 @@ impl<'a> ParallelHandler<'a> {
 
         // Run the step
         let args = self.args;
-        for row in begin..end {
-            self.cur_iop_body = None;
-            let ctx = CircuitStepContext {
-                size: 1 << RECURSION_PO2,
-                cycle: row,
-            };
-            CIRCUIT.step_exec(&ctx, &mut self, args).unwrap();
-        }
+        CIRCUIT
+            .step_exec_range(1 << RECURSION_PO2, begin..end, &mut self, args)
+            .unwrap();
         self
     }
 }
@@ -405,46 +421,59 @@ impl<'a> CircuitStepHandler<BabyBearElem> for ParallelHandler<'a> {
         &mut self,
         cycle: usize,
         name: &str,
+        extra: &str,
+        args: &[BabyBearElem],
+        outs: &mut [BabyBearElem],
+    ) -> Result<()> {
+        let id = ExternId::from_name(name).unwrap_or_else(|| panic!("Unimplemented extern {name}"));
+        self.call_extern(cycle, id, ExtraId::from_name(extra), extra, args, outs)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        _extra_id: ExtraId,
         _extra: &str,
         args: &[BabyBearElem],
         outs: &mut [BabyBearElem],
     ) -> Result<()> {
-        match name {
-            "log" => {
+        match id {
+            ExternId::Log => {
                 // TODO: Loggin is maybe still useful?
                 Ok(())
             }
-            "womWrite" => {
+            ExternId::WomWrite => {
                 // let addr = u32::from(args[0]) as usize;
                 // let val = BabyBearExtElem::from_subelems(args[1..5].into_iter().cloned());
                 // let goal = self.wom[addr];
-                // tracing::debug!("Cycle = {}, addr = {}, attempting to write = {:?}, should write
-                // = {:?}", cycle, addr, val, goal);
+                // tracing::debug!("Cycle = {}, addr = {}, attempting to write = {:?}, should
+                // write = {:?}", cycle, addr, val, goal);
                 // TODO, but harmless
                 Ok(())
             }
-            "plonkWrite" => {
+            ExternId::PlonkWrite => {
                 self.plonk_queue.push(args.try_into().unwrap());
                 Ok(())
             }
-            "womRead" => {
+            ExternId::WomRead => {
                 outs.clone_from_slice(self.wom[u32::from(args[0]) as usize].subelems());
                 Ok(())
             }
-            "readIOPHeader" => {
+            ExternId::ReadIOPHeader => {
                 // Nothing to do here; we've already precomputed.
                 Ok(())
             }
-            "readIOPBody" => {
-                if self.cur_iop_body.is_none() {
-                    self.cur_iop_body = Some(self.iop_reads.get(&cycle).unwrap().as_slice());
-                }
-                let cur_body = self.cur_iop_body.unwrap();
+            ExternId::ReadIOPBody => {
+                let cur_body = match self.cur_iop_body {
+                    Some((body_cycle, body)) if body_cycle == cycle => body,
+                    _ => self.iop_reads.get(&cycle).unwrap().as_slice(),
+                };
                 outs.clone_from_slice(cur_body[0].subelems());
-                self.cur_iop_body = Some(&cur_body[1..]);
+                self.cur_iop_body = Some((cycle, &cur_body[1..]));
                 Ok(())
             }
-            _ => panic!("Unimplemented extern {name}"),
+            _ => panic!("Unimplemented extern {}", id.name()),
         }
     }
 }
@@ -658,6 +658,9 @@ impl Prover {
     {
         let skip_seal = self.opts.skip_seal;
 
+        // The log externs are only reported at the trace level.
+        risc0_circuit_recursion::set_log_externs(tracing::enabled!(tracing::Level::TRACE));
+
         let machine_ctx = self.preflight()?;
 
         let split_points = core::mem::take(&mut self.split_points);
@@ -12,9 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use std::collections::VecDeque;
-
-use risc0_zkp::field::{self, ExtElem};
+use risc0_zkp::field;
 
 // Write once RAM
 #[derive(Ord, PartialOrd, Eq, PartialEq)]
@@ -64,38 +62,3 @@ impl WomPlonk {
         set_elem(4, row.val[3]);
     }
 }
-
-/// Plonk accumulations.  Saves factors to compute prefix products.
-pub struct PlonkAccum<F: field::Field> {
-    elems: VecDeque<F::ExtElem>,
-}
-
-impl<F: field::Field> PlonkAccum<F> {
-    pub fn new() -> Self {
-        PlonkAccum {
-            elems: VecDeque::new(),
-        }
-    }
-
-    // TODO: When the circuit supports ExtElem natively we should operate on those
-    // directly instead of converting from E::Elem.
-    pub fn write(&mut self, elems: &[F::Elem]) {
-        self.elems.extend(
-            elems
-                .chunks_exact(F::ExtElem::EXT_SIZE)
-                .map(|v| F::ExtElem::from_subelems(v.iter().cloned())),
-        );
-    }
-
-    pub fn read(&mut self, outs: &mut [F::Elem]) {
-        for out in outs.chunks_exact_mut(F::ExtElem::EXT_SIZE) {
-            out.clone_from_slice(self.elems.pop_front().unwrap().subelems());
-        }
-    }
-}
-
-impl<F: field::Field> Default for PlonkAccum<F> {
-    fn default() -> Self {
-        Self::new()
-    }
-}
@@ -75,11 +75,10 @@ impl Program {
             }
         }
         let coeffs = hal.copy_from_elem("coeffs", &code);
-        // Do interpolate & shift
+        // Do interpolate
         hal.batch_interpolate_ntt(&coeffs, self.code_size);
-        hal.zk_shift(&coeffs, self.code_size);
-        // Make the poly-group & extract the root
-        let code_group = PolyGroup::new(&hal, coeffs, self.code_size, cycles, "code");
+        // Make the shifted poly-group & extract the root
+        let code_group = PolyGroup::new_zk_shifted(&hal, coeffs, self.code_size, cycles, "code");
         let root = *code_group.merkle.root();
         tracing::trace!("Computed recursion code: {root:?}");
         root
@@ -12,17 +12,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use core::{cmp, ops::Deref};
-use std::collections::{BTreeMap, BTreeSet, VecDeque};
+use core::{
+    cmp,
+    ops::{Deref, Range},
+};
+use std::collections::{BTreeSet, VecDeque};
 
 use anyhow::{anyhow, Result};
 use lazy_regex::{regex, Captures};
+use rayon::prelude::*;
 use risc0_binfmt::MemoryImage;
 use risc0_core::field::{
-    baby_bear::{BabyBear, BabyBearElem as Elem},
+    baby_bear::{BabyBear, BabyBearElem as Elem, BabyBearExtElem},
     Elem as _,
 };
-use risc0_zkp::adapter::CircuitStepHandler;
+use risc0_zkp::{
+    adapter::{CircuitStepHandler, ExternId, ExtraId, PlonkVerifyHandler},
+    prove::accum::Accum,
+};
 use risc0_zkvm_platform::{
     memory::SYSTEM,
     syscall::{
@@ -64,17 +71,22 @@ pub struct MemoryState {
     pub ram_plonk: plonk::RamPlonk,
     pub bytes_plonk: plonk::BytesPlonk,
 
-    // Plonk accumulations for compute_accum and verify_accum phases
-    pub plonk_accum: BTreeMap<String, plonk::PlonkAccum<BabyBear>>,
+    // Plonk accumulations for compute_accum and verify_accum phases, indexed
+    // by cycle.  Allocated on first use.
+    pub plonk_accum: Option<Accum<BabyBearExtElem>>,
+
+    // Number of cycles in the segment.
+    steps: usize,
 }
 
 impl MemoryState {
-    pub(crate) fn new(image: MemoryImage) -> Self {
+    pub(crate) fn new(image: MemoryImage, steps: usize) -> Self {
         Self {
             ram: image,
             ram_plonk: plonk::RamPlonk::new(),
             bytes_plonk: plonk::BytesPlonk::new(),
-            plonk_accum: BTreeMap::new(),
+            plonk_accum: None,
+            steps,
         }
     }
 
@@ -163,23 +175,37 @@ impl CircuitStepHandler<Elem> for MachineContext {
         args: &[Elem],
         outs: &mut [Elem],
     ) -> Result<()> {
-        match name {
-            "halt" => {
+        let id = ExternId::from_name(name)
+            .unwrap_or_else(|| unimplemented!("Unsupported extern: {name}"));
+        self.call_extern(cycle, id, ExtraId::from_name(extra), extra, args, outs)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        extra_id: ExtraId,
+        extra: &str,
+        args: &[Elem],
+        outs: &mut [Elem],
+    ) -> Result<()> {
+        match id {
+            ExternId::Halt => {
                 self.halt(cycle, args[0], args[1]);
                 Ok(())
             }
-            "trace" => Ok(()),
-            "getMajor" => {
+            ExternId::Trace => Ok(()),
+            ExternId::GetMajor => {
                 outs[0] = self.get_major(args[0], args[1])?;
                 Ok(())
             }
-            "getMinor" => {
+            ExternId::GetMinor => {
                 let insn = merge_word8((args[0], args[1], args[2], args[3]));
                 let opcode = OpCode::decode(insn, 0)?;
                 outs[0] = opcode.minor.into();
                 Ok(())
             }
-            "divide" => {
+            ExternId::Divide => {
                 (
                     (outs[0], outs[1], outs[2], outs[3]),
                     (outs[4], outs[5], outs[6], outs[7]),
@@ -190,56 +216,51 @@ impl CircuitStepHandler<Elem> for MachineContext {
                 );
                 Ok(())
             }
-            "bigintQuotient" => {
+            ExternId::BigintQuotient => {
                 let (a, b) = args.split_at(bigint::WIDTH_BYTES * 2);
                 let q = self.bigint_quotient(a.try_into()?, b.try_into()?)?;
                 outs.copy_from_slice(&q[..]);
                 Ok(())
             }
-            "pageInfo" => {
+            ExternId::PageInfo => {
                 (outs[0], outs[1], outs[2]) = self.page_info(cycle);
                 Ok(())
             }
-            "ramWrite" => {
+            ExternId::RamWrite => {
                 self.ram_write(args[0], (args[1], args[2], args[3], args[4]), args[5])?;
                 Ok(())
             }
-            "ramRead" => {
+            ExternId::RamRead => {
                 (outs[0], outs[1], outs[2], outs[3]) = self.ram_read(cycle, args[0], args[1])?;
                 Ok(())
             }
-            "plonkWrite" => {
-                self.plonk_write(extra, args);
+            ExternId::PlonkWrite => {
+                self.plonk_write(cycle, extra_id, args);
                 Ok(())
             }
-            "plonkRead" => {
-                self.plonk_read(extra, outs);
+            ExternId::PlonkRead => {
+                self.plonk_read(extra_id, outs);
                 Ok(())
             }
-            "plonkWriteAccum" => {
-                self.plonk_write_accum(extra, args);
-                Ok(())
-            }
-            "plonkReadAccum" => {
-                self.plonk_read_accum(extra, outs);
-                Ok(())
+            ExternId::PlonkWriteAccum | ExternId::PlonkReadAccum => {
+                self.plonk_accum(cycle, id, extra_id, args, outs)
             }
-            "log" => {
+            ExternId::Log => {
                 self.log(extra, args);
                 Ok(())
             }
-            "syscallInit" => Ok(()),
-            "syscallBody" => {
+            ExternId::SyscallInit => Ok(()),
+            ExternId::SyscallBody => {
                 (outs[0], outs[1], outs[2], outs[3]) = split_word8(self.syscall_body()?);
                 Ok(())
             }
-            "syscallFini" => {
+            ExternId::SyscallFini => {
                 let (a0, a1) = self.syscall_fini()?;
                 (outs[0], outs[1], outs[2], outs[3]) = split_word8(a0);
                 (outs[4], outs[5], outs[6], outs[7]) = split_word8(a1);
                 Ok(())
             }
-            _ => unimplemented!("Unsupported extern: {name}"),
+            _ => unimplemented!("Unsupported extern: {}", id.name()),
         }
     }
 
@@ -250,6 +271,154 @@ impl CircuitStepHandler<Elem> for MachineContext {
     }
 }
 
+impl PlonkVerifyHandler<Elem> for MachineContext {
+    type Chunk<'a> = VerifyChunk<'a>;
+
+    fn run_verify<V>(&mut self, name: &str, cycles: usize, verify: V) -> Result<()>
+    where
+        V: for<'a> Fn(&mut Self::Chunk<'a>, Range<usize>) -> Result<()> + Sync,
+    {
+        let ram_plonk = &self.memory.ram_plonk;
+        let bytes_plonk = &self.memory.bytes_plonk;
+        let chunks = (cycles + VERIFY_CHUNK_SIZE - 1) / VERIFY_CHUNK_SIZE;
+        let writes = (0..chunks)
+            .into_par_iter()
+            .map(|chunk| {
+                let begin = chunk * VERIFY_CHUNK_SIZE;
+                let end = cmp::min(begin + VERIFY_CHUNK_SIZE, cycles);
+                let mut handler = VerifyChunk::new(begin..end);
+                match name {
+                    "ram" => handler.ram = Some(ram_plonk.cursor(ram_plonk.offsets.start(begin))),
+                    "bytes" => {
+                        handler.bytes = Some(bytes_plonk.cursor(bytes_plonk.offsets.start(begin)))
+                    }
+                    _ => panic!("Unknown plonk type {name}"),
+                }
+                verify(&mut handler, begin..end)?;
+                // The chunk read back exactly the rows its cycles wrote, so
+                // the next chunk's reads start where this chunk's ended.
+                if let Some(cursor) = &handler.ram {
+                    debug_assert_eq!(cursor.index(), ram_plonk.offsets.start(end));
+                }
+                if let Some(cursor) = &handler.bytes {
+                    debug_assert_eq!(cursor.index(), bytes_plonk.offsets.start(end));
+                }
+                Ok(handler.bytes_writes)
+            })
+            .collect::<Result<Vec<_>>>()?;
+
+        // Record the bytes rows the verify phase wrote, in cycle order.
+        let counts = writes
+            .par_iter()
+            .fold(
+                || vec![0; plonk::BYTES_ROWS],
+                |mut counts, writes| {
+                    for index in writes.rows.iter() {
+                        counts[*index as usize] += 1;
+                    }
+                    counts
+                },
+            )
+            .reduce_with(|mut lhs, rhs| {
+                for (lhs, rhs) in lhs.iter_mut().zip(rhs) {
+                    *lhs += rhs;
+                }
+                lhs
+            });
+        let bytes_plonk = &mut self.memory.bytes_plonk;
+        if let Some(counts) = counts {
+            bytes_plonk.add_counts(&counts);
+        }
+        for (chunk, writes) in writes.iter().enumerate() {
+            let begin = chunk * VERIFY_CHUNK_SIZE;
+            for (i, count) in writes.counts.iter().enumerate() {
+                bytes_plonk.offsets.record(begin + i, *count);
+            }
+        }
+        Ok(())
+    }
+}
+
+/// Number of consecutive cycles each worker verifies at a time in
+/// [MachineContext::run_verify].
+pub(crate) const VERIFY_CHUNK_SIZE: usize = 1 << 13;
+
+/// Bytes plonk rows written by a range of cycles.
+struct BytesWrites {
+    rows: Vec<u16>,
+    // How many rows each cycle of the range wrote.
+    counts: Vec<u32>,
+}
+
+/// Handles the plonk externs of one range of cycles of a verify phase.
+pub struct VerifyChunk<'a> {
+    cycles: Range<usize>,
+    ram: Option<plonk::RamCursor<'a>>,
+    bytes: Option<plonk::BytesCursor<'a>>,
+    bytes_writes: BytesWrites,
+}
+
+impl<'a> VerifyChunk<'a> {
+    fn new(cycles: Range<usize>) -> Self {
+        VerifyChunk {
+            bytes_writes: BytesWrites {
+                rows: Vec::new(),
+                counts: vec![0; cycles.len()],
+            },
+            cycles,
+            ram: None,
+            bytes: None,
+        }
+    }
+}
+
+impl<'a> CircuitStepHandler<Elem> for VerifyChunk<'a> {
+    fn call(
+        &mut self,
+        cycle: usize,
+        name: &str,
+        extra: &str,
+        args: &[Elem],
+        outs: &mut [Elem],
+    ) -> Result<()> {
+        let id = ExternId::from_name(name)
+            .unwrap_or_else(|| unimplemented!("Unsupported extern: {name}"));
+        self.call_extern(cycle, id, ExtraId::from_name(extra), extra, args, outs)
+    }
+
+    fn call_extern(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        extra_id: ExtraId,
+        _extra: &str,
+        args: &[Elem],
+        outs: &mut [Elem],
+    ) -> Result<()> {
+        match (id, extra_id) {
+            (ExternId::PlonkRead, ExtraId::RAM) => {
+                let cursor = self.ram.as_mut().expect("ram plonk is not being read");
+                cursor.read(outs.try_into()?);
+            }
+            (ExternId::PlonkRead, ExtraId::BYTES) => {
+                let cursor = self.bytes.as_mut().expect("bytes plonk is not being read");
+                cursor.read(outs.try_into()?);
+            }
+            (ExternId::PlonkWrite, ExtraId::BYTES) => {
+                let index = plonk::bytes_index(args.try_into()?);
+                self.bytes_writes.rows.push(index);
+                self.bytes_writes.counts[cycle - self.cycles.start] += 1;
+            }
+            _ => unimplemented!("Unsupported extern: {}", id.name()),
+        }
+        Ok(())
+    }
+
+    fn sort(&mut self, _: &str) {
+        unimplemented!()
+    }
+}
+
 impl MachineContext {
     pub fn new(segment: &Segment) -> Self {
         let syscall_out_data: Vec<u32> = segment
@@ -263,7 +432,7 @@ impl MachineContext {
             .map(|syscall| syscall.regs)
             .collect();
         MachineContext {
-            memory: MemoryState::new(segment.pre_image.deref().clone()),
+            memory: MemoryState::new(segment.pre_image.deref().clone(), 1 << segment.po2),
             faults: segment.faults.clone(),
             syscall_out_data: VecDeque::from(syscall_out_data),
             syscall_out_regs: VecDeque::from(syscall_out_regs),
@@ -629,38 +798,39 @@ impl MachineContext {
         Ok(())
     }
 
-    fn plonk_read(&mut self, name: &str, outs: &mut [Elem]) {
-        match name {
-            "ram" => self.memory.ram_plonk.read(outs.try_into().unwrap()),
-            "bytes" => self.memory.bytes_plonk.read(outs.try_into().unwrap()),
-            _ => panic!("Unknown plonk type {name}"),
-        }
-    }
-
-    fn plonk_write(&mut self, name: &str, args: &[Elem]) {
-        match name {
-            "ram" => self.memory.ram_plonk.write(args.try_into().unwrap()),
-            "bytes" => self.memory.bytes_plonk.write(args.try_into().unwrap()),
-            _ => panic!("Unknown plonk type {name}"),
+    fn plonk_read(&mut self, kind: ExtraId, outs: &mut [Elem]) {
+        match kind {
+            ExtraId::RAM => self.memory.ram_plonk.read(outs.try_into().unwrap()),
+            ExtraId::BYTES => self.memory.bytes_plonk.read(outs.try_into().unwrap()),
+            _ => panic!("Unknown plonk type {kind:?}"),
         }
     }
 
-    fn plonk_read_accum(&mut self, name: &str, outs: &mut [Elem]) {
-        if let Some(entry) = self.memory.plonk_accum.get_mut(name) {
-            entry.read(outs)
-        } else {
-            panic!("Unknown plonk accum {}", name);
+    fn plonk_write(&mut self, cycle: usize, kind: ExtraId, args: &[Elem]) {
+        match kind {
+            ExtraId::RAM => self.memory.ram_plonk.write(cycle, args.try_into().unwrap()),
+            ExtraId::BYTES => self
+                .memory
+                .bytes_plonk
+                .write(cycle, args.try_into().unwrap()),
+            _ => panic!("Unknown plonk type {kind:?}"),
         }
     }
 
-    fn plonk_write_accum(&mut self, name: &str, args: &[Elem]) {
-        if let Some(entry) = self.memory.plonk_accum.get_mut(name) {
-            entry.write(args);
-        } else {
-            let mut accum = plonk::PlonkAccum::new();
-            accum.write(args);
-            self.memory.plonk_accum.insert(name.to_string(), accum);
-        }
+    fn plonk_accum(
+        &mut self,
+        cycle: usize,
+        id: ExternId,
+        kind: ExtraId,
+        args: &[Elem],
+        outs: &mut [Elem],
+    ) -> Result<()> {
+        let steps = self.memory.steps;
+        self.memory
+            .plonk_accum
+            .get_or_insert_with(|| Accum::new(steps))
+            .handler::<BabyBear>()
+            .call_extern(cycle, id, kind, "", args, outs)
     }
 
     fn syscall_body(&mut self) -> Result<u32> {
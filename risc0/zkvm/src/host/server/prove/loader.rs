@@ -438,11 +438,10 @@ impl Loader {
             self.load_code(&mut code, cycles);
             // Copy into accel buffer
             let coeffs = hal.copy_from_elem("coeffs", &code);
-            // Do interpolate & shift
+            // Do interpolate
             hal.batch_interpolate_ntt(&coeffs, code_size);
-            hal.zk_shift(&coeffs, code_size);
-            // Make the poly-group & extract the root
-            let code_group = PolyGroup::new(hal, coeffs, code_size, cycles, "code");
+            // Make the shifted poly-group & extract the root
+            let code_group = PolyGroup::new_zk_shifted(hal, coeffs, code_size, cycles, "code");
             table.push(*code_group.merkle.root());
         }
 
@@ -12,23 +12,55 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use std::collections::VecDeque;
+use std::{cmp, mem};
 
-use risc0_core::field::{Elem, ExtElem, Field};
+use rayon::prelude::*;
+use risc0_core::field::Elem;
 use risc0_zkp::MAX_CYCLES;
 
-// Main RAM plonk rows have the following 7 plonk elements:
-// addr, cycle, isWrite, byte0, byte1, byte2, byte3
-#[derive(Ord, PartialOrd, Eq, PartialEq)]
-struct MainRamPlonkRow {
-    addr: u32,
-    // (cycle << 2) | mem_op
-    cycle_and_write_flag: u32,
-    val: u32,
+/// Where the rows of each cycle start in a plonk table.
+///
+/// A plonk table is read back in a later phase by the same cycles that wrote
+/// it, each reading as many rows as it wrote.  So once the table is sorted,
+/// the reads of a cycle start at the number of rows written by the cycles
+/// before it.
+#[derive(Default)]
+pub struct PlonkOffsets {
+    // starts[cycle] is the number of rows written before `cycle`.
+    starts: Vec<u32>,
+    rows: u32,
 }
 
+impl PlonkOffsets {
+    /// Records `count` rows written by `cycle`.  Cycles must be recorded in
+    /// order.
+    pub fn record(&mut self, cycle: usize, count: u32) {
+        debug_assert!(cycle + 1 >= self.starts.len());
+        while self.starts.len() <= cycle {
+            self.starts.push(self.rows);
+        }
+        self.rows += count;
+    }
+
+    /// Returns the index of the first row read by `cycle`.
+    pub fn start(&self, cycle: usize) -> usize {
+        self.starts.get(cycle).copied().unwrap_or(self.rows) as usize
+    }
+}
+
+// Main RAM plonk rows have the following 7 plonk elements:
+// addr, cycle, isWrite, byte0, byte1, byte2, byte3
+//
+// They are stored as columns: a sort key of (addr << 32) | (cycle << 2) |
+// mem_op, and the four bytes packed into a u32.
 pub struct RamPlonk {
-    main_ram: Vec<MainRamPlonkRow>,
+    keys: Vec<u64>,
+    vals: Vec<u32>,
+
+    sorted: bool,
+    read_pos: usize,
+
+    pub offsets: PlonkOffsets,
 }
 
 impl RamPlonk {
@@ -37,14 +69,19 @@ impl RamPlonk {
         assert!(MAX_CYCLES < ((u32::MAX as usize) << 2));
 
         RamPlonk {
-            main_ram: Vec::new(),
+            keys: Vec::new(),
+            vals: Vec::new(),
+            sorted: true,
+            read_pos: 0,
+            offsets: PlonkOffsets::default(),
         }
     }
 
-    pub fn write<E: Elem>(&mut self, elems: &[E; 7])
+    pub fn write<E: Elem>(&mut self, cycle: usize, elems: &[E; 7])
     where
         u32: From<E>,
     {
+        self.offsets.record(cycle, 1);
         let addr = u32::from(elems[0]);
         let cycle = u32::from(elems[1]);
         let mem_op = u32::from(elems[2]);
@@ -54,36 +91,149 @@ impl RamPlonk {
         for elem in &elems[3..] {
             debug_assert!(u32::from(*elem) < 256);
         }
-        self.main_ram.push(MainRamPlonkRow {
-            addr,
-            cycle_and_write_flag,
-            val: u32::from(elems[3])
+        self.keys
+            .push(((addr as u64) << 32) | cycle_and_write_flag as u64);
+        self.vals.push(
+            u32::from(elems[3])
                 + (u32::from(elems[4]) << 8)
                 + (u32::from(elems[5]) << 16)
                 + (u32::from(elems[6]) << 24),
-        });
+        );
+        self.sorted = false;
     }
 
     pub fn sort(&mut self) {
-        // Reverse sort all plonk rows so we can pop them off the back in order.
-        self.main_ram.sort_unstable_by(|a, b| b.cmp(a));
+        if !self.sorted {
+            radix_sort(&mut self.keys, &mut self.vals);
+            self.sorted = true;
+        }
     }
 
     pub fn read<E: Elem>(&mut self, elems: &mut [E; 7])
     where
         u32: From<E>,
     {
+        let mut cursor = self.cursor(self.read_pos);
+        cursor.read(elems);
+        self.read_pos = cursor.index;
+    }
+
+    /// Returns a cursor at the `index`-th row in sorted order.
+    pub fn cursor(&self, index: usize) -> RamCursor<'_> {
+        debug_assert!(self.sorted);
+        RamCursor {
+            keys: &self.keys,
+            vals: &self.vals,
+            index,
+        }
+    }
+}
+
+/// Reads a sorted [RamPlonk] from a given row on, leaving it in place.
+pub struct RamCursor<'a> {
+    keys: &'a [u64],
+    vals: &'a [u32],
+    index: usize,
+}
+
+impl<'a> RamCursor<'a> {
+    /// Returns the row the next read returns.
+    pub fn index(&self) -> usize {
+        self.index
+    }
+
+    pub fn read<E: Elem>(&mut self, elems: &mut [E; 7]) {
+        let key = self.keys[self.index];
+        let val = self.vals[self.index];
+        self.index += 1;
+
         let mut set_elem = |idx, val: u32| {
             elems[idx] = E::from_u64(val as u64);
         };
-        let row = self.main_ram.pop().unwrap();
-        set_elem(0, row.addr);
-        set_elem(1, row.cycle_and_write_flag >> 2);
-        set_elem(2, row.cycle_and_write_flag & 3);
-        set_elem(3, row.val & 0xFF);
-        set_elem(4, (row.val >> 8) & 0xFF);
-        set_elem(5, (row.val >> 16) & 0xFF);
-        set_elem(6, (row.val >> 24) & 0xFF);
+        set_elem(0, (key >> 32) as u32);
+        set_elem(1, (key as u32) >> 2);
+        set_elem(2, (key as u32) & 3);
+        set_elem(3, val & 0xFF);
+        set_elem(4, (val >> 8) & 0xFF);
+        set_elem(5, (val >> 16) & 0xFF);
+        set_elem(6, (val >> 24) & 0xFF);
+    }
+}
+
+/// Smallest number of rows each worker handles in a pass of [radix_sort].
+const RADIX_BLOCK_SIZE: usize = 1 << 16;
+
+/// Lets the workers of a [radix_sort] pass scatter into one buffer.
+struct ScatterPtr<T>(*mut T);
+
+// SAFETY: Each worker only writes to the disjoint set of positions its
+// offsets give it.
+unsafe impl<T> Sync for ScatterPtr<T> {}
+
+/// Sorts `keys` in place, stably, permuting `vals` along with them.
+///
+/// This is an LSD radix sort on bytes.  Each pass counts the digits of
+/// blocks of rows in parallel, then scatters every block to its own slots of
+/// the output.  Passes over digits that are the same for every key, such as
+/// the high bytes of addresses and cycles, are skipped.
+fn radix_sort(keys: &mut Vec<u64>, vals: &mut Vec<u32>) {
+    let len = keys.len();
+    let block_size = cmp::max(RADIX_BLOCK_SIZE, len / rayon::current_num_threads() + 1);
+    let mut keys_out = vec![0; len];
+    let mut vals_out = vec![0; len];
+    for shift in (0..u64::BITS).step_by(8) {
+        let digit = |key: u64| (key >> shift) as usize & 0xFF;
+        let counts: Vec<[usize; 256]> = keys
+            .par_chunks(block_size)
+            .map(|block| {
+                let mut counts = [0; 256];
+                for key in block {
+                    counts[digit(*key)] += 1;
+                }
+                counts
+            })
+            .collect();
+
+        let mut totals = [0; 256];
+        for block in counts.iter() {
+            for (total, count) in totals.iter_mut().zip(block) {
+                *total += count;
+            }
+        }
+        if totals.iter().any(|total| *total == len) {
+            continue;
+        }
+
+        // Each block writes the rows with a given digit after those of all
+        // smaller digits, and after those of earlier blocks.
+        let mut offsets = counts;
+        let mut pos = 0;
+        for digit in 0..256 {
+            for block in offsets.iter_mut() {
+                let count = block[digit];
+                block[digit] = pos;
+                pos += count;
+            }
+        }
+
+        let keys_dst = ScatterPtr(keys_out.as_mut_ptr());
+        let vals_dst = ScatterPtr(vals_out.as_mut_ptr());
+        keys.par_chunks(block_size)
+            .zip(vals.par_chunks(block_size))
+            .zip(offsets)
+            .for_each(|((keys, vals), mut offsets)| {
+                for (key, val) in keys.iter().zip(vals) {
+                    let pos = &mut offsets[digit(*key)];
+                    // SAFETY: `pos` is in bounds and owned by this block.
+                    unsafe {
+                        keys_dst.0.add(*pos).write(*key);
+                        vals_dst.0.add(*pos).write(*val);
+                    }
+                    *pos += 1;
+                }
+            });
+        mem::swap(keys, &mut keys_out);
+        mem::swap(vals, &mut vals_out);
     }
 }
 
@@ -91,79 +241,193 @@ impl RamPlonk {
 // in [0, 256).  We construct these into a short, [0, 256*256), and
 // count how many of each row occurs.
 pub struct BytesPlonk {
-    counts: Box<[u32; 256 * 256]>,
+    counts: Box<[u32; BYTES_ROWS]>,
+
+    // Once sorted, starts[index] is the position in sorted order of the first
+    // row at `index`, and starts[BYTES_ROWS] is the number of rows.
+    starts: Vec<u32>,
 
     read_pos: usize,
+
+    pub offsets: PlonkOffsets,
 }
 
+/// Number of distinct bytes plonk rows.
+pub const BYTES_ROWS: usize = 256 * 256;
+
 impl BytesPlonk {
     pub fn new() -> Self {
         BytesPlonk {
-            counts: Box::new([0; 256 * 256]),
+            counts: Box::new([0; BYTES_ROWS]),
+            starts: Vec::new(),
             read_pos: 0,
+            offsets: PlonkOffsets::default(),
         }
     }
 
-    pub fn write<E: Elem>(&mut self, elems: &[E; 2])
+    pub fn write<E: Elem>(&mut self, cycle: usize, elems: &[E; 2])
     where
         u32: From<E>,
     {
-        for elem in elems {
-            debug_assert!(u32::from(*elem) < 256);
+        self.offsets.record(cycle, 1);
+        self.counts[bytes_index(elems) as usize] += 1;
+        self.starts.clear();
+    }
+
+    /// Adds a histogram of rows, indexed as by [bytes_index].
+    pub fn add_counts(&mut self, counts: &[u32]) {
+        for (total, count) in self.counts.iter_mut().zip(counts) {
+            *total += count;
         }
-        let index = ((u32::from(elems[0]) << 8) + u32::from(elems[1])) as usize;
-        self.counts[index] += 1;
+        self.starts.clear();
     }
 
     pub fn sort(&mut self) {
-        // BytesPlonk is already sorted.
+        // The rows are already sorted by construction; find where each
+        // one starts.
+        if self.starts.is_empty() {
+            self.starts.reserve(BYTES_ROWS + 1);
+            let mut pos = 0;
+            for count in self.counts.iter() {
+                self.starts.push(pos);
+                pos += count;
+            }
+            self.starts.push(pos);
+        }
     }
 
     pub fn read<E: Elem>(&mut self, outs: &mut [E; 2]) {
-        while self.counts[self.read_pos] == 0 {
-            self.read_pos += 1;
-        }
-
-        let b1 = (self.read_pos >> 8) & 0xFF;
-        let b2 = self.read_pos & 0xFF;
+        self.cursor(self.read_pos).read(outs);
+        self.read_pos += 1;
+    }
 
-        self.counts[self.read_pos] -= 1;
+    /// Returns a cursor at the `index`-th row in sorted order.
+    pub fn cursor(&self, index: usize) -> BytesCursor<'_> {
+        debug_assert_eq!(self.starts.len(), BYTES_ROWS + 1);
+        let pos = self
+            .starts
+            .partition_point(|start| *start as usize <= index);
+        BytesCursor {
+            starts: &self.starts,
+            pos: pos.saturating_sub(1),
+            index,
+        }
+    }
+}
 
-        *outs = [E::from_u64(b1 as u64), E::from_u64(b2 as u64)];
+/// Packs a bytes plonk row into its index in [BytesPlonk].
+pub fn bytes_index<E: Elem>(elems: &[E; 2]) -> u16
+where
+    u32: From<E>,
+{
+    for elem in elems {
+        debug_assert!(u32::from(*elem) < 256);
     }
+    ((u32::from(elems[0]) << 8) + u32::from(elems[1])) as u16
 }
 
-/// Plonk accumulations.  Saves factors to compute prefix products.
-pub struct PlonkAccum<F: Field> {
-    elems: VecDeque<F::ExtElem>,
+/// Reads a sorted [BytesPlonk] from a given row on.
+pub struct BytesCursor<'a> {
+    starts: &'a [u32],
+    // The row at `index` in sorted order.
+    pos: usize,
+    index: usize,
 }
 
-impl<F: Field> PlonkAccum<F> {
-    pub fn new() -> Self {
-        PlonkAccum {
-            elems: VecDeque::new(),
+impl<'a> BytesCursor<'a> {
+    /// Returns the row the next read returns.
+    pub fn index(&self) -> usize {
+        self.index
+    }
+
+    pub fn read<E: Elem>(&mut self, outs: &mut [E; 2]) {
+        // Skip rows that were never written.
+        while self.starts[self.pos + 1] as usize <= self.index {
+            self.pos += 1;
         }
+        self.index += 1;
+        let b1 = (self.pos >> 8) & 0xFF;
+        let b2 = self.pos & 0xFF;
+        *outs = [E::from_u64(b1 as u64), E::from_u64(b2 as u64)];
     }
+}
 
-    // TODO: When the circuit supports ExtElem natively we should operate on those
-    // directly instead of converting from E::Elem.
-    pub fn write(&mut self, elems: &[F::Elem]) {
-        self.elems.extend(
-            elems
-                .chunks_exact(F::ExtElem::EXT_SIZE)
-                .map(|v| F::ExtElem::from_subelems(v.iter().cloned())),
-        );
+#[cfg(test)]
+mod tests {
+    use rand::{rngs::StdRng, Rng, SeedableRng};
+    use risc0_core::field::baby_bear::BabyBearElem;
+
+    use super::{radix_sort, BytesPlonk, RamPlonk};
+
+    #[test]
+    fn radix_sort_matches_sort() {
+        let mut rng = StdRng::seed_from_u64(1);
+        let mut keys: Vec<u64> = (0..300_000)
+            .map(|_| ((rng.gen_range(0..1u64 << 26)) << 32) | rng.gen_range(0..1 << 24))
+            .collect();
+        // Some duplicate keys, to check stability.
+        keys.extend_from_within(..1000);
+        let mut vals: Vec<u32> = (0..keys.len() as u32).collect();
+        let mut expected: Vec<_> = keys.iter().copied().zip(vals.iter().copied()).collect();
+        expected.sort();
+        radix_sort(&mut keys, &mut vals);
+        let actual: Vec<_> = keys.into_iter().zip(vals).collect();
+        assert_eq!(actual, expected);
     }
 
-    pub fn read(&mut self, outs: &mut [F::Elem]) {
-        for out in outs.chunks_exact_mut(F::ExtElem::EXT_SIZE) {
-            out.clone_from_slice(self.elems.pop_front().unwrap().subelems());
+    #[test]
+    fn cursors_match_reads() {
+        let mut rng = StdRng::seed_from_u64(1);
+        let mut ram = RamPlonk::new();
+        let mut bytes = BytesPlonk::new();
+        let mut bytes_expected = Vec::new();
+        for cycle in 0..1000 {
+            for _ in 0..rng.gen_range(0..4) {
+                let row = [
+                    rng.gen_range(0..64u32),
+                    cycle,
+                    rng.gen_range(0..4),
+                    rng.gen_range(0..256),
+                    rng.gen_range(0..256),
+                    rng.gen_range(0..256),
+                    rng.gen_range(0..256),
+                ];
+                ram.write(cycle as usize, &row.map(BabyBearElem::new));
+                let row = [rng.gen_range(0..256u32), rng.gen_range(0..256)].map(BabyBearElem::new);
+                bytes.write(cycle as usize, &row);
+                bytes_expected.push(row);
+            }
         }
-    }
-}
+        ram.sort();
+        bytes.sort();
+
+        let rows = ram.offsets.start(1000);
+        let mut ram_expected = vec![[BabyBearElem::new(0); 7]; rows];
+        for row in ram_expected.iter_mut() {
+            ram.read(row);
+        }
+        bytes_expected.sort_by_key(|row| row.map(u32::from));
+        for expected in bytes_expected.iter() {
+            let mut row = [BabyBearElem::new(0); 2];
+            bytes.read(&mut row);
+            assert_eq!(&row, expected);
+        }
+        for pair in ram_expected.windows(2) {
+            let key = |row: &[BabyBearElem; 7]| [row[0], row[1], row[2]].map(u32::from);
+            assert!(key(&pair[0]) <= key(&pair[1]));
+        }
+        for cycle in [0, 1, 500, 999] {
+            let mut ram_cursor = ram.cursor(ram.offsets.start(cycle));
+            let mut bytes_cursor = bytes.cursor(bytes.offsets.start(cycle));
+            for i in ram.offsets.start(cycle)..rows {
+                let mut ram_row = [BabyBearElem::new(0); 7];
+                ram_cursor.read(&mut ram_row);
+                assert_eq!(ram_row, ram_expected[i]);
 
-impl<F: Field> Default for PlonkAccum<F> {
-    fn default() -> Self {
-        Self::new()
+                let mut bytes_row = [BabyBearElem::new(0); 2];
+                bytes_cursor.read(&mut bytes_row);
+                assert_eq!(bytes_row, bytes_expected[i]);
+            }
+        }
     }
 }
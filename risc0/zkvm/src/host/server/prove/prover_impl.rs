@@ -121,6 +121,9 @@ where
         let (hal, circuit_hal) = (self.hal_pair.hal.as_ref(), &self.hal_pair.circuit_hal);
         let hashfn = &hal.get_hash_suite().name;
 
+        // The log externs are only reported at the trace level.
+        risc0_circuit_rv32im::set_log_externs(tracing::enabled!(tracing::Level::TRACE));
+
         let io = segment.prepare_globals()?;
         let machine = MachineContext::new(segment);
         let po2 = segment.po2 as usize;
@@ -128,7 +131,7 @@ where
 
         let loader = Loader::new();
         loader.load(|chunk, fini| executor.step(chunk, fini))?;
-        executor.finalize();
+        executor.finalize_parallel();
 
         let mut adapter = ProveAdapter::new(&mut executor);
         let mut prover = risc0_zkp::prove::Prover::new(hal, CIRCUIT.get_taps());
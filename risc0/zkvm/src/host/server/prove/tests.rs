@@ -241,6 +241,50 @@ fn memory_io() {
     assert_eq!(run_memio(&[(POS + 1, 0)]).unwrap(), ExitCode::Fault);
 }
 
+#[test]
+fn finalize_parallel_matches_finalize() {
+    use risc0_zkp::prove::executor::Executor;
+
+    use super::exec::{MachineContext, VERIFY_CHUNK_SIZE};
+    use crate::Loader;
+
+    // Enough cycles for the verify phases to span several chunks.
+    let env = ExecutorEnv::builder()
+        .write(&MultiTestSpec::BusyLoop { cycles: 1 << 15 })
+        .unwrap()
+        .build()
+        .unwrap();
+    let mut exec = ExecutorImpl::from_elf(env, MULTI_TEST_ELF).unwrap();
+    let session = exec.run().unwrap();
+    let segments = session.resolve().unwrap();
+    let segment = &segments[0];
+    let po2 = segment.po2 as usize;
+    let io = segment.prepare_globals().unwrap();
+
+    let executors: Vec<_> = [false, true]
+        .into_iter()
+        .map(|parallel| {
+            let machine = MachineContext::new(segment);
+            let mut executor = Executor::new(&CIRCUIT, machine, po2, po2, &io);
+            Loader::new()
+                .load(|chunk, fini| executor.step(chunk, fini))
+                .unwrap();
+            if parallel {
+                executor.finalize_parallel();
+            } else {
+                executor.finalize();
+            }
+            executor
+        })
+        .collect();
+    let [sequential, parallel] = &executors[..] else {
+        unreachable!()
+    };
+    assert!(sequential.cycle > 2 * VERIFY_CHUNK_SIZE);
+    assert!(*sequential.io.as_slice() == *parallel.io.as_slice());
+    assert!(*sequential.data.as_slice() == *parallel.data.as_slice());
+}
+
 #[test]
 fn session_events() {
     use std::{cell::RefCell, rc::Rc};